@@ -12,6 +12,11 @@
 
 
 
+#ifndef _HAVE_size_t
+typedef unsigned size_t;
+#define _HAVE_size_t
+#endif
+
 /* Structure that preceeds a user block in most cases.
 ** The aligned_malloc function may generate blocks where the start pointer
 ** and size are splitted to handle a memory hole that is needed for
@@ -45,6 +50,15 @@ extern struct freeblock*  _heaplast;    /* Last free block in list */
 
 
 
+/* The default allocator behind malloc and free. An alternative allocator
+** that replaces malloc and free may use these for the blocks it doesn't
+** manage itself.
+*/
+void* __fastcall__ _heapalloc (size_t size);
+void __fastcall__ _heapfree (void* block);
+
+
+
 /* End of _heap.h */
 
 #endif
@@ -118,6 +118,8 @@ int __fastcall__ putchar (int c);
 int __fastcall__ puts (const char* s);
 int __fastcall__ remove (const char* name);
 int __fastcall__ rename (const char* oldname, const char* newname);
+void __fastcall__ setbuf (FILE* f, char* buf);
+int __fastcall__ setvbuf (FILE* f, char* buf, int mode, size_t size);
 int snprintf (char* buf, size_t size, const char* format, ...);
 int sprintf (char* buf, const char* format, ...);
 int __fastcall__ ungetc (int c, FILE* f);
@@ -0,0 +1,104 @@
+/*
+** _fbuf.c
+**
+** (C) 2026, The cc65 Authors
+*/
+
+
+
+#include <stdio.h>
+#include <unistd.h>
+#include "_file.h"
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+int __fastcall__ _fbufflush (register FILE* f)
+/* Write out the pending output of a buffered stream, or drop the chars that
+** were read ahead and seek back over them, so the file position matches the
+** stream position again. Returns zero on success and EOF on errors.
+*/
+{
+    register struct _fbuf* b = _fbufget (f);
+    unsigned n = b->b_pos;
+    unsigned len = b->b_len;
+
+    /* Empty the buffer */
+    b->b_pos = 0;
+    b->b_len = 0;
+
+    if (b->b_flags & _FBUFWRITE) {
+        /* Write out the output */
+        b->b_flags &= ~_FBUFWRITE;
+        if (n != 0 && write (f->f_fd, b->b_buf, n) != n) {
+            f->f_flags |= _FERROR;
+            return EOF;
+        }
+    } else if (n < len) {
+        /* Give back the chars that were read ahead */
+        if (lseek (f->f_fd, (long) n - len, SEEK_CUR) < 0) {
+            f->f_flags |= _FERROR;
+            return EOF;
+        }
+    }
+    return 0;
+}
+
+
+
+int __fastcall__ _fbuffill (register FILE* f)
+/* Refill the buffer of a buffered stream and return the first char from it,
+** or EOF at the end of the file or on errors.
+*/
+{
+    register struct _fbuf* b;
+    int n;
+
+    /* Write out any pending output before reading */
+    if (_fbufflush (f) != 0) {
+        return EOF;
+    }
+
+    /* Read the next block */
+    b = _fbufget (f);
+    switch (n = read (f->f_fd, b->b_buf, b->b_size)) {
+
+        case -1:
+            /* Error */
+            f->f_flags |= _FERROR;
+            return EOF;
+
+        case 0:
+            /* EOF */
+            f->f_flags |= _FEOF;
+            return EOF;
+
+        default:
+            /* Return the first char */
+            b->b_len = n;
+            b->b_pos = 1;
+            return b->b_buf[0];
+
+    }
+}
+
+
+
+int __fastcall__ _fbufoffs (FILE* f)
+/* Return the number of chars the stream position of a buffered stream is
+** ahead of the file position: The pending output, or minus the number of
+** chars that were read ahead.
+*/
+{
+    register struct _fbuf* b = _fbufget (f);
+
+    if (b->b_flags & _FBUFWRITE) {
+        return b->b_pos;
+    }
+    return b->b_pos - b->b_len;
+}
@@ -0,0 +1,58 @@
+/*
+** _fbufclose.c
+**
+** (C) 2026, The cc65 Authors
+*/
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "_file.h"
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+int __fastcall__ _fbufrelease (register FILE* f)
+/* Flush the buffer of a buffered stream and release it. The stream is
+** unbuffered afterwards. Returns the result of _fbufflush.
+*/
+{
+    int res = _fbufflush (f);
+    register struct _fbuf* b = _fbufget (f);
+
+    if (b->b_flags & _FBUFALLOC) {
+        free (b->b_buf);
+    }
+    b->b_flags = 0;
+    f->f_flags &= ~_FBUFFERED;
+    return res;
+}
+
+
+
+int __fastcall__ _fbufclose (FILE* f)
+/* fclose for buffered streams */
+{
+    register struct _fbuf* b = _fbufget (f);
+    int res;
+
+    /* There's no need to seek back over the chars that were read ahead when
+    ** the file is closed anyway, and fclose must work without lseek.
+    */
+    if ((b->b_flags & _FBUFWRITE) == 0) {
+        b->b_len = b->b_pos;
+    }
+    res = _fbufrelease (f);
+
+    /* The stream is unbuffered now, so fclose closes the file */
+    if (fclose (f) != 0) {
+        res = EOF;
+    }
+    return res;
+}
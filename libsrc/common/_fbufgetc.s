@@ -0,0 +1,65 @@
+;
+; (C) 2026, The cc65 Authors
+;
+; int __fastcall__ _fbufgetc (FILE* f);
+; /* fgetc for buffered streams without a pushed back char */
+;
+
+        .export         __fbufgetc
+
+        .import         __fbuftab, __fbuffill
+        .importzp       ptr1, ptr2, tmp1
+
+        .include        "_file.inc"
+
+; ------------------------------------------------------------------------
+; Code
+
+.proc   __fbufgetc
+
+        sta     ptr1
+        stx     ptr1+1          ; Save f
+
+; The offset of the buffer in __fbuftab is three times the offset of f in
+; __filetab
+
+        sec
+        sbc     #<__filetab
+        sta     tmp1
+        asl     a
+        adc     tmp1            ; Carry is clear
+        tax
+
+; Check if there are chars left in the buffer. Buffers that hold output have
+; b_len set to zero, so b_pos < b_len is false for them.
+
+        lda     __fbuftab + _FBUF::b_pos,x
+        cmp     __fbuftab + _FBUF::b_len,x
+        lda     __fbuftab + _FBUF::b_pos+1,x
+        sbc     __fbuftab + _FBUF::b_len+1,x
+        bcs     Empty
+
+; Return b->b_buf[b->b_pos++]
+
+        lda     __fbuftab + _FBUF::b_buf,x
+        adc     __fbuftab + _FBUF::b_pos,x      ; Carry is clear
+        sta     ptr2
+        lda     __fbuftab + _FBUF::b_buf+1,x
+        adc     __fbuftab + _FBUF::b_pos+1,x
+        sta     ptr2+1
+        inc     __fbuftab + _FBUF::b_pos,x
+        bne     @L1
+        inc     __fbuftab + _FBUF::b_pos+1,x
+@L1:    ldy     #0
+        lda     (ptr2),y
+        ldx     #0
+        rts
+
+; No chars in the buffer, let the buffer code read the next block
+
+Empty:  lda     ptr1
+        ldx     ptr1+1
+        jmp     __fbuffill
+
+.endproc
+
@@ -0,0 +1,134 @@
+;
+; (C) 2026, The cc65 Authors
+;
+; int __fastcall__ _fbufputc (int c, FILE* f);
+; /* fputc for buffered streams */
+;
+
+        .export         __fbufputc
+
+        .import         __fbuftab, __fbufflush
+        .import         incsp2
+        .importzp       sp, ptr1, tmp1
+
+        .include        "_file.inc"
+
+; ------------------------------------------------------------------------
+; Code
+
+.proc   __fbufputc
+
+        sta     file
+        stx     file+1          ; Save f
+
+; The offset of the buffer in __fbuftab is three times the offset of f in
+; __filetab
+
+        sec
+        sbc     #<__filetab
+        sta     tmp1
+        asl     a
+        adc     tmp1            ; Carry is clear
+        tax
+
+; If the buffer doesn't hold output, drop the chars that were read ahead and
+; use it for output.
+
+        lda     __fbuftab + _FBUF::b_flags,x
+        and     #_FBUFWRITE
+        bne     Store
+        jsr     flush
+        lda     __fbuftab + _FBUF::b_flags,x
+        ora     #_FBUFWRITE
+        sta     __fbuftab + _FBUF::b_flags,x
+
+; b->b_buf[b->b_pos++] = c;
+
+Store:  lda     __fbuftab + _FBUF::b_buf,x
+        clc
+        adc     __fbuftab + _FBUF::b_pos,x
+        sta     ptr1
+        lda     __fbuftab + _FBUF::b_buf+1,x
+        adc     __fbuftab + _FBUF::b_pos+1,x
+        sta     ptr1+1
+        ldy     #0
+        lda     (sp),y
+        sta     (ptr1),y
+        inc     __fbuftab + _FBUF::b_pos,x
+        bne     @L1
+        inc     __fbuftab + _FBUF::b_pos+1,x
+
+; Write out the buffer if it is full ...
+
+@L1:    lda     __fbuftab + _FBUF::b_pos,x
+        cmp     __fbuftab + _FBUF::b_size,x
+        bne     @L2
+        lda     __fbuftab + _FBUF::b_pos+1,x
+        cmp     __fbuftab + _FBUF::b_size+1,x
+        beq     @L3
+
+; ... or at the end of a line in a line buffered stream
+
+@L2:    lda     __fbuftab + _FBUF::b_flags,x
+        and     #_FLINEBUF
+        beq     Done
+        lda     (sp),y          ; Y is still zero
+        cmp     #_FNEWLINE
+        bne     Done
+@L3:    jsr     flush
+        bne     ReturnEOF
+
+; Return the char written
+
+Done:   ldy     #0
+        lda     (sp),y
+        ldx     #0
+        jmp     incsp2
+
+; Return EOF
+
+ReturnEOF:
+        lda     #$FF
+        tax
+        jmp     incsp2
+
+.endproc
+
+; ------------------------------------------------------------------------
+; Write out the buffer of the stream. Returns the low byte of the result of
+; _fbufflush with the flags set accordingly, and the offset of the buffer in
+; X again.
+
+.proc   flush
+
+        lda     file
+        ldx     file+1
+        jsr     __fbufflush
+        pha
+        jsr     getbuf
+        pla
+        rts
+
+.endproc
+
+; ------------------------------------------------------------------------
+; Load the offset of the buffer of the saved stream in __fbuftab into X
+
+.proc   getbuf
+
+        lda     file
+        sec
+        sbc     #<__filetab
+        sta     tmp1
+        asl     a
+        adc     tmp1            ; Carry is clear
+        tax
+        rts
+
+.endproc
+
+; ------------------------------------------------------------------------
+; Data
+
+.bss
+file:   .res    2
@@ -0,0 +1,88 @@
+/*
+** _fbufread.c
+**
+** (C) 2026, The cc65 Authors
+*/
+
+
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "_file.h"
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+size_t __fastcall__ _fbufread (void* buf, size_t size, size_t count,
+                               register FILE* f)
+/* fread for buffered streams */
+{
+    register unsigned char* p = buf;
+    register struct _fbuf* b = _fbufget (f);
+    unsigned n = size * count;
+    unsigned avail;
+    int c;
+
+    if (n == 0) {
+        return count;
+    }
+
+    /* Write out any pending output before reading */
+    if ((b->b_flags & _FBUFWRITE) && _fbufflush (f) != 0) {
+        return 0;
+    }
+
+    /* Start with a pushed back character */
+    if (f->f_flags & _FPUSHBACK) {
+        f->f_flags &= ~_FPUSHBACK;
+        *p++ = f->f_pushback;
+        --n;
+    }
+
+    while (n) {
+
+        /* Copy what is in the buffer */
+        avail = b->b_len - b->b_pos;
+        if (avail) {
+            if (avail > n) {
+                avail = n;
+            }
+            memcpy (p, b->b_buf + b->b_pos, avail);
+            b->b_pos += avail;
+            p += avail;
+            n -= avail;
+            continue;
+        }
+
+        /* The buffer is empty. Read large blocks directly, everything else
+        ** through the buffer.
+        */
+        if (n >= b->b_size) {
+            switch (c = read (f->f_fd, p, n)) {
+                case -1:
+                    f->f_flags |= _FERROR;
+                    goto Done;
+                case 0:
+                    f->f_flags |= _FEOF;
+                    goto Done;
+            }
+            p += c;
+            n -= c;
+        } else if ((c = _fbuffill (f)) == EOF) {
+            break;
+        } else {
+            *p++ = c;
+            --n;
+        }
+    }
+
+Done:
+    /* Return the number of complete items read */
+    return (p - (unsigned char*) buf) / size;
+}
@@ -0,0 +1,46 @@
+;
+; (C) 2026, The cc65 Authors
+;
+; Buffers of the buffered streams.
+;
+; struct _fbuf* __fastcall__ _fbufget (FILE* f);
+; /* Return the entry in _fbuftab that belongs to f */
+;
+
+        .export         __fbuftab, __fbufget
+        .importzp       tmp1
+
+        .include        "stdio.inc"
+        .include        "_file.inc"
+
+; The offset of an entry in __fbuftab is three times the offset of the
+; stream in __filetab. Both offsets fit into a byte.
+
+.assert .sizeof(_FBUF) = 3 * .sizeof(_FILE), error, "Bad size of _FBUF"
+.assert FOPEN_MAX * .sizeof(_FBUF) <= 256, error, "_fbuftab too large"
+
+; ------------------------------------------------------------------------
+; Code
+
+.proc   __fbufget
+
+        sec
+        sbc     #<__filetab     ; Offset of f in __filetab
+        sta     tmp1
+        asl     a
+        adc     tmp1            ; Times three, carry is clear
+        adc     #<__fbuftab
+        ldx     #>__fbuftab
+        bcc     @L1
+        inx
+@L1:    rts
+
+.endproc
+
+; ------------------------------------------------------------------------
+; Data
+
+.bss
+__fbuftab:
+        .res    FOPEN_MAX * .sizeof(_FBUF)
+
@@ -0,0 +1,75 @@
+/*
+** _fbufwrite.c
+**
+** (C) 2026, The cc65 Authors
+*/
+
+
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "_file.h"
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+size_t __fastcall__ _fbufwrite (const void* buf, size_t size, size_t count,
+                                register FILE* f)
+/* fwrite for buffered streams */
+{
+    register const unsigned char* p = buf;
+    register struct _fbuf* b = _fbufget (f);
+    unsigned n = size * count;
+    unsigned room;
+
+    /* Drop chars that were read ahead, the buffer is used for output now */
+    if ((b->b_flags & _FBUFWRITE) == 0) {
+        _fbufflush (f);
+    }
+
+    while (n) {
+
+        /* Write large blocks directly if there is no pending output */
+        if (b->b_pos == 0 && n >= b->b_size) {
+            if (write (f->f_fd, p, n) != n) {
+                goto Error;
+            }
+            break;
+        }
+
+        /* Copy as much as fits into the buffer */
+        room = b->b_size - b->b_pos;
+        if (room > n) {
+            room = n;
+        }
+        memcpy (b->b_buf + b->b_pos, p, room);
+        b->b_flags |= _FBUFWRITE;
+        b->b_pos += room;
+        p += room;
+        n -= room;
+
+        /* Write out a full buffer */
+        if (b->b_pos == b->b_size && _fbufflush (f) != 0) {
+            return 0;
+        }
+    }
+
+    /* Line buffered streams are flushed if the data contains a newline */
+    if ((b->b_flags & _FLINEBUF) && (b->b_flags & _FBUFWRITE) &&
+        memchr (buf, '\n', size * count) && _fbufflush (f) != 0) {
+        return 0;
+    }
+
+    /* Done */
+    return count;
+
+Error:
+    f->f_flags |= _FERROR;
+    return 0;
+}
@@ -32,6 +32,31 @@ extern FILE _filetab[FOPEN_MAX];
 #define _FEOF           0x02
 #define _FERROR         0x04
 #define _FPUSHBACK      0x08
+#define _FBUFFERED      0x80            /* Stream has a buffer */
+
+/* Buffer of a stream. Streams are unbuffered unless setvbuf has given them a
+** buffer, so the table with the buffers is only linked in together with
+** setvbuf. The buffer holds either the chars from b_pos up to b_len that were
+** read but not yet consumed, or - if _FBUFWRITE is set - b_pos chars of
+** output that wait to be written. In the latter case, b_len is zero. An entry
+** is three times as large as a _FILE, so finding the buffer of a stream needs
+** no division.
+*/
+struct _fbuf {
+    unsigned char*  b_buf;              /* Stream buffer */
+    unsigned        b_size;             /* Size of the buffer */
+    unsigned        b_pos;              /* Index of next char in the buffer */
+    unsigned        b_len;              /* Number of chars read into buffer */
+    unsigned char   b_flags;
+};
+
+/* Buffer table, one entry for each entry in _filetab */
+extern struct _fbuf _fbuftab[FOPEN_MAX];
+
+/* Buffer flags */
+#define _FBUFWRITE      0x01            /* Buffer holds output */
+#define _FLINEBUF       0x02            /* Flush output at end of line */
+#define _FBUFALLOC      0x04            /* Buffer was allocated by setvbuf */
 
 
 
@@ -41,6 +66,63 @@ FILE* __fastcall__ _fopen (const char* name, const char* mode, FILE* f);
 FILE* _fdesc (void);
 /* Find a free FILE descriptor */
 
+struct _fbuf* __fastcall__ _fbufget (FILE* f);
+/* Return the entry in _fbuftab that belongs to f */
+
+int __fastcall__ _fbufflush (FILE* f);
+/* Write out the pending output of a buffered stream, or drop the chars that
+** were read ahead and seek back over them, so the file position matches the
+** stream position again. Returns zero on success and EOF on errors.
+*/
+
+int __fastcall__ _fbuffill (FILE* f);
+/* Refill the buffer of a buffered stream and return the first char from it,
+** or EOF at the end of the file or on errors.
+*/
+
+size_t __fastcall__ _fbufread (void* buf, size_t size, size_t count, FILE* f);
+/* fread for buffered streams */
+
+size_t __fastcall__ _fbufwrite (const void* buf, size_t size, size_t count,
+                                FILE* f);
+/* fwrite for buffered streams */
+
+int __fastcall__ _fbufrelease (FILE* f);
+/* Flush the buffer of a buffered stream and release it. The stream is
+** unbuffered afterwards. Returns the result of _fbufflush.
+*/
+
+int __fastcall__ _fbufoffs (FILE* f);
+/* Return the number of chars the stream position of a buffered stream is
+** ahead of the file position: The pending output, or minus the number of
+** chars that were read ahead.
+*/
+
+int __fastcall__ _fbufgetc (FILE* f);
+/* fgetc for buffered streams without a pushed back char */
+
+int __fastcall__ _fbufputc (int c, FILE* f);
+/* fputc for buffered streams */
+
+int __fastcall__ _fbufclose (FILE* f);
+/* fclose for buffered streams */
+
+
+
+/* The functions above are linked in with setvbuf. The other stdio functions
+** reach them through the following vectors, which setvbuf sets on startup.
+** The vectors may only be called for streams that have _FBUFFERED set.
+*/
+int __fastcall__ _fbufvgetc (FILE* f);
+int __fastcall__ _fbufvputc (int c, FILE* f);
+size_t __fastcall__ _fbufvread (void* buf, size_t size, size_t count,
+                                FILE* f);
+size_t __fastcall__ _fbufvwrite (const void* buf, size_t size, size_t count,
+                                 FILE* f);
+int __fastcall__ _fbufvflush (FILE* f);
+int __fastcall__ _fbufvclose (FILE* f);
+int __fastcall__ _fbufvoffs (FILE* f);
+
 
 
 /* End of _file.h */
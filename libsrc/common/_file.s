@@ -36,3 +36,20 @@ _stderr:
         .word   __filetab + (STDERR_FILENO * .sizeof(_FILE))
 
 
+;----------------------------------------------------------------------------
+; Vectors for the buffer code. setvbuf writes a jump to the buffer function
+; into each of them on startup, so the buffer code is only linked in with
+; setvbuf. They are only called for streams with _FBUFFERED set.
+
+.bss
+
+__fbufvec:
+__fbufvgetc:    .res    3
+__fbufvputc:    .res    3
+__fbufvread:    .res    3
+__fbufvwrite:   .res    3
+__fbufvflush:   .res    3
+__fbufvclose:   .res    3
+__fbufvoffs:    .res    3
+
+
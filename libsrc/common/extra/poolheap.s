@@ -0,0 +1,464 @@
+;
+; The cc65 Authors, 2026
+;
+; Size class pool allocator
+;
+; This module is not part of the library. It exports malloc, free,
+; _heapmemavail and _heapmaxavail, so linking it in front of the library
+; replaces the first fit allocator for small blocks:
+;
+;       cl65 -t sim6502 prog.c sim6502-poolheap.o
+;
+; Requests of up to POOL_MAXSIZE bytes are rounded up to one of the size
+; classes below. Each class has a list of free blocks, so allocating and
+; freeing a small block takes the same time regardless of the state of the
+; heap. When a list is empty, a page is taken from the top of the heap and
+; cut into blocks of that class. Pages are never returned to the heap. Larger
+; requests, and small ones when the top of the heap is exhausted, go to the
+; default allocator in _heapalloc.s.
+;
+; Pool blocks look like ordinary used blocks: They are preceeded by their size
+; and a pointer to themselves, so realloc and _heapblocksize work as usual.
+; The first byte of a pool page holds the class, the blocks follow. Since no
+; class fills a page completely, a pool block never ends at the heap top, so
+; realloc never tries to grow it in place. A bitmap with one bit per page of
+; the address space tells pool pages from the rest of the heap.
+;
+
+        .export         _malloc, _free
+        .export         __heapmemavail, __heapmaxavail
+        .import         __heapalloc, __heapfree, heapadd
+        .importzp       ptr1, ptr2, tmp1, tmp2
+
+        .include        "_heap.inc"
+
+        .macpack        generic
+
+POOL_MAXSIZE    = 80            ; Largest request served from the pools
+CLASSES         = 10            ; Number of size classes
+
+;-----------------------------------------------------------------------------
+; Tables
+
+.rodata
+
+; Block size including the admin space, and number of blocks per page for
+; each class. Indexed by class * 2.
+
+Classes:
+        .byte   8,  255 / 8
+        .byte   12, 255 / 12
+        .byte   16, 255 / 16
+        .byte   20, 255 / 20
+        .byte   24, 255 / 24
+        .byte   28, 255 / 28
+        .byte   36, 255 / 36
+        .byte   44, 255 / 44
+        .byte   52, 255 / 52
+        .byte   84, 255 / 84
+
+.assert (* - Classes) = CLASSES * 2, error, "Class table size mismatch"
+
+; Class * 2 for (size - 1) / 4
+
+SizeClass:
+        .byte   0, 2, 4, 6, 8, 10       ; 1 .. 24
+        .byte   12, 12                  ; 25 .. 32
+        .byte   14, 14                  ; 33 .. 40
+        .byte   16, 16                  ; 41 .. 48
+        .byte   18, 18, 18, 18          ; 49 .. 80
+        .byte   18, 18, 18, 18
+
+.assert (* - SizeClass) * 4 = POOL_MAXSIZE, error, "Size table size mismatch"
+
+Bits:   .byte   $01, $02, $04, $08, $10, $20, $40, $80
+
+;-----------------------------------------------------------------------------
+; Data
+
+.bss
+
+FreeList:
+        .res    CLASSES * 2     ; Free user blocks per class, zero if empty
+PageMap:
+        .res    256 / 8         ; One bit per page, set for pool pages
+Class:  .res    1               ; Class * 2 while refilling
+Size:   .res    1               ; Requested size while refilling
+Page:   .res    1               ; High byte of the new page
+
+;-----------------------------------------------------------------------------
+; void* __fastcall__ malloc (size_t size);
+
+.code
+
+.proc   _malloc
+
+        cpx     #0
+        bne     Heap            ; Large block
+        tay
+        beq     Heap            ; Zero size, let the heap return NULL
+        cmp     #POOL_MAXSIZE+1
+        bcs     Heap            ; Large block
+        sta     Size
+
+        dey
+        tya
+        lsr     a
+        lsr     a
+        tay
+        ldx     SizeClass,y
+
+; Take the first block from the free list of the class in X. The link to
+; the next free block is stored in the user data.
+
+Pop:    ldy     FreeList+1,x
+        beq     Refill          ; Jump if the list is empty
+        sty     ptr1+1
+        lda     FreeList,x
+        sta     ptr1
+        ldy     #0
+        lda     (ptr1),y
+        sta     FreeList,x
+        iny
+        lda     (ptr1),y
+        sta     FreeList+1,x
+        lda     ptr1
+        ldx     ptr1+1
+        rts
+
+; There is no room for another page (see below). Use the default allocator
+; for the requested size, so memory added with _heapadd, and the block that
+; _heapmaxavail reports, may still be used.
+
+NoPage: lda     Size
+        ldx     #0
+Heap:   jmp     __heapalloc
+
+; The list is empty. Find the first page above the heap top, and check
+; that it fits below the heap end.
+
+Refill: stx     Class
+        lda     __heapptr+1
+        ldy     __heapptr
+        beq     @L1             ; Heap top is page aligned
+        add     #1              ; Next page
+@L1:    cmp     __heapend+1     ; Page + $100 must be <= __heapend
+        bcs     NoPage          ; Not enough room, or page $FF
+
+; Take the page, and move the heap top above it
+
+        sta     Page
+        ldx     __heapptr
+        stx     ptr2
+        ldx     __heapptr+1
+        stx     ptr2+1          ; Old heap top
+        ldx     #0
+        stx     __heapptr
+        add     #1
+        sta     __heapptr+1
+
+; Put the space between the old heap top and the page on the free list if
+; it is large enough to hold a free block
+
+        txa                     ; A = 0
+        sub     ptr2
+        cmp     #HEAP_MIN_BLOCKSIZE
+        bcc     @L2             ; Too small, or no space at all
+        sta     ptr1
+        stx     ptr1+1          ; Size of the block
+        ldy     #usedblock::size
+        sta     (ptr2),y
+        iny
+        txa
+        sta     (ptr2),y
+        jsr     heapadd
+
+; Mark the page in the bitmap, and store the class in its first byte
+
+@L2:    lda     Page
+        lsr     a
+        lsr     a
+        lsr     a
+        tay
+        lda     Page
+        and     #$07
+        tax
+        lda     PageMap,y
+        ora     Bits,x
+        sta     PageMap,y
+
+        lda     Page
+        sta     ptr1+1
+        ldy     #0
+        sty     ptr1
+        lda     Class
+        sta     (ptr1),y
+        tax
+
+; Cut the rest of the page into blocks. Each one gets its size and a
+; pointer to itself, and the user data a link to the next one. Since no
+; class fills the page completely, the low bytes don't overflow.
+
+        lda     Classes,x
+        sta     tmp1            ; Block size
+        lda     Classes+1,x
+        sta     tmp2            ; Block count
+        lda     #1+HEAP_ADMIN_SPACE
+        sta     FreeList,x
+        lda     Page
+        sta     FreeList+1,x
+        inc     ptr1            ; First block follows the class byte
+
+@L3:    ldy     #usedblock::size
+        lda     tmp1
+        sta     (ptr1),y
+        iny
+        lda     #0
+        sta     (ptr1),y
+        iny                     ; usedblock::start
+        lda     ptr1
+        sta     (ptr1),y
+        iny
+        lda     ptr1+1
+        sta     (ptr1),y
+        iny                     ; User data
+        lda     ptr1
+        add     tmp1
+        tax                     ; Low byte of the next block
+        dec     tmp2
+        beq     @L4             ; Jump if this was the last one
+        txa
+        add     #HEAP_ADMIN_SPACE
+        sta     (ptr1),y
+        iny
+        lda     ptr1+1
+        sta     (ptr1),y
+        stx     ptr1
+        bne     @L3             ; Branch always
+
+@L4:    lda     #0
+        sta     (ptr1),y
+        iny
+        sta     (ptr1),y        ; End of list
+        ldx     Class
+        jmp     Pop
+
+.endproc
+
+;-----------------------------------------------------------------------------
+; void __fastcall__ free (void* block);
+
+.proc   _free
+
+        sta     ptr1
+        stx     ptr1+1          ; Save block
+        ora     ptr1+1
+        beq     Done            ; Ignore NULL pointers
+
+; The word below the user data points to the raw block. Pool blocks are
+; recognized by the page this one is in. To access the pointer, decrement
+; the high byte of the block address, the pointer is then at offset 254/255.
+
+        dex
+        stx     ptr2+1
+        lda     ptr1
+        sta     ptr2
+        ldy     #$FF
+        lda     (ptr2),y
+        sta     ptr2+1          ; High byte of the raw block
+        lsr     a
+        lsr     a
+        lsr     a
+        tay
+        lda     ptr2+1
+        and     #$07
+        tax
+        lda     PageMap,y
+        and     Bits,x
+        beq     Heap            ; Not a pool page
+
+; Push the block on the free list of the class stored in the page
+
+        ldy     #0
+        sty     ptr2
+        lda     (ptr2),y
+        tax
+        lda     FreeList,x
+        sta     (ptr1),y
+        iny
+        lda     FreeList+1,x
+        sta     (ptr1),y
+        lda     ptr1
+        sta     FreeList,x
+        lda     ptr1+1
+        sta     FreeList+1,x
+Done:   rts
+
+Heap:   lda     ptr1
+        ldx     ptr1+1
+        jmp     __heapfree
+
+.endproc
+
+;-----------------------------------------------------------------------------
+; size_t _heapmemavail (void);
+;
+; Same as the default version, plus the free blocks in the pools.
+
+.proc   __heapmemavail
+
+        lda     #0
+        sta     ptr2
+        sta     ptr2+1
+
+; Sum up the sizes of the blocks in the pools
+
+        ldx     #(CLASSES-1)*2
+@L1:    lda     FreeList,x
+        sta     ptr1
+        lda     FreeList+1,x
+@L2:    beq     @L4             ; Jump if end of list reached
+        sta     ptr1+1
+        lda     Classes,x
+        add     ptr2
+        sta     ptr2
+        bcc     @L3
+        inc     ptr2+1
+@L3:    ldy     #1
+        lda     (ptr1),y
+        pha
+        dey
+        lda     (ptr1),y
+        sta     ptr1
+        pla
+        jmp     @L2
+@L4:    dex
+        dex
+        bpl     @L1
+
+; Add the blocks on the free list
+
+        lda     __heapfirst
+        sta     ptr1
+        lda     __heapfirst+1
+@L5:    sta     ptr1+1
+        ora     ptr1
+        beq     @L6             ; Jump if end of free list reached
+
+        ldy     #freeblock::size
+        lda     (ptr1),y
+        add     ptr2
+        sta     ptr2
+        iny
+        lda     (ptr1),y
+        adc     ptr2+1
+        sta     ptr2+1
+
+        iny                     ; Points to F->next
+        lda     (ptr1),y
+        tax
+        iny
+        lda     (ptr1),y
+        stx     ptr1
+        jmp     @L5
+
+; Add the space at the heap top
+
+@L6:    lda     ptr2
+        add     __heapend
+        sta     ptr2
+        lda     ptr2+1
+        adc     __heapend+1
+        tax
+
+        lda     ptr2
+        sub     __heapptr
+        sta     ptr2
+        txa
+        sbc     __heapptr+1
+        tax
+        lda     ptr2
+        rts
+
+.endproc
+
+;-----------------------------------------------------------------------------
+; size_t _heapmaxavail (void);
+;
+; Same as the default version, but a free pool block may be larger than
+; anything else.
+
+.proc   __heapmaxavail
+
+; size_t Size = _heapend - _heapptr;
+
+        lda     __heapend
+        sub     __heapptr
+        sta     ptr2
+        lda     __heapend+1
+        sbc     __heapptr+1
+        sta     ptr2+1
+
+; Find the largest block on the free list
+
+        lda     __heapfirst
+        sta     ptr1
+        lda     __heapfirst+1
+@L1:    sta     ptr1+1
+        ora     ptr1
+        beq     @L3             ; Jump if end of free list reached
+
+        ldy     #freeblock::size
+        lda     ptr2
+        sub     (ptr1),y
+        iny
+        lda     ptr2+1
+        sbc     (ptr1),y
+        bcs     @L2
+
+        ldy     #freeblock::size
+        lda     (ptr1),y
+        sta     ptr2
+        iny
+        lda     (ptr1),y
+        sta     ptr2+1
+
+@L2:    iny                     ; Points to F->next
+        lda     (ptr1),y
+        tax
+        iny
+        lda     (ptr1),y
+        stx     ptr1
+        jmp     @L1
+
+; Check the pools, beginning with the largest class
+
+@L3:    ldx     #(CLASSES-1)*2
+@L4:    lda     FreeList+1,x
+        bne     @L5             ; Jump if the list isn't empty
+        dex
+        dex
+        bpl     @L4
+        bmi     @L6             ; Branch always
+
+@L5:    lda     ptr2+1
+        bne     @L6             ; Free list has the larger block
+        lda     Classes,x
+        cmp     ptr2
+        bcc     @L6
+        sta     ptr2            ; The pool block is larger
+
+; if (Size < HEAP_ADMIN_SPACE) return 0; return Size - HEAP_ADMIN_SPACE;
+
+@L6:    lda     ptr2
+        sub     #HEAP_ADMIN_SPACE
+        ldx     ptr2+1
+        bcs     @L8
+        bne     @L7
+        txa
+        rts
+
+@L7:    dex
+@L8:    rts
+
+.endproc
@@ -36,9 +36,15 @@
         tax
         rts
 
-; File is open. Reset the flags and close the file.
+; File is open. Leave buffered streams to the buffer code, which writes out
+; and releases the buffer and comes back here.
 
-@L1:    lda     #_FCLOSED
+@L1:    lda     (ptr1),y
+        bmi     @L2
+
+; Reset the flags and close the file.
+
+        lda     #_FCLOSED
         sta     (ptr1),y
 
         ldy     #_FILE::f_fd
@@ -46,5 +52,9 @@
         ldx     #0
         jmp     _close          ; Will set errno and return an error flag
 
+@L2:    lda     ptr1
+        ldx     ptr1+1
+        jmp     __fbufvclose
+
 .endproc
 
@@ -0,0 +1,46 @@
+/*
+** fflush.c
+**
+** (C) 2026, The cc65 Authors
+*/
+
+
+
+#include <stdio.h>
+#include <errno.h>
+#include "_file.h"
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+int __fastcall__ fflush (register FILE* f)
+{
+    int res = 0;
+
+    /* A NULL pointer flushes all streams */
+    if (f == 0) {
+        for (f = _filetab; f < _filetab + FOPEN_MAX; ++f) {
+            if ((f->f_flags & _FBUFFERED) && _fbufvflush (f) != 0) {
+                res = EOF;
+            }
+        }
+        return res;
+    }
+
+    /* Is the file open? */
+    if ((f->f_flags & _FOPEN) == 0) {
+        _seterrno (EBADF);
+        return EOF;
+    }
+
+    /* Only buffered streams have something to do */
+    if (f->f_flags & _FBUFFERED) {
+        res = _fbufvflush (f);
+    }
+    return res;
+}
@@ -0,0 +1,111 @@
+;
+; Ullrich von Bassewitz, 1998-06-02
+; The cc65 Authors, 2026: Rewritten in assembler, buffered streams
+;
+; int __fastcall__ fgetc (FILE* f);
+; /* Read a character from a stream */
+;
+
+        .export         _fgetc
+
+        .import         _read
+        .import         pusha0, pushax
+        .importzp       ptr1
+
+        .include        "_file.inc"
+
+; ------------------------------------------------------------------------
+; Code
+
+.proc   _fgetc
+
+        sta     ptr1
+        stx     ptr1+1          ; Save f
+
+; Check for the common case first: The file is open, there is no error
+; condition and no pushed back character. Buffered streams are handled by the
+; buffer code.
+
+        ldy     #_FILE::f_flags
+        lda     (ptr1),y
+        and     #(_FOPEN | _FERROR | _FEOF | _FPUSHBACK)
+        cmp     #_FOPEN
+        bne     Special
+        lda     (ptr1),y
+        bpl     Unbuffered
+        lda     ptr1
+        ldx     ptr1+1
+        jmp     __fbufvgetc
+
+; Return EOF if the file is not open or if there is an error condition.
+; Otherwise we have a pushed back character. Return it and reset the flag.
+
+Special:
+        tax
+        and     #_FOPEN
+        beq     ReturnEOF
+        txa
+        and     #(_FERROR | _FEOF)
+        bne     ReturnEOF
+
+        ldy     #_FILE::f_flags
+        lda     (ptr1),y
+        and     #<~_FPUSHBACK
+        sta     (ptr1),y        ; f->f_flags &= ~_FPUSHBACK;
+        ldy     #_FILE::f_pushback
+        lda     (ptr1),y
+        ldx     #0
+        rts
+
+; Unbuffered stream, read one byte
+
+Unbuffered:
+        lda     ptr1
+        sta     file
+        lda     ptr1+1
+        sta     file+1
+        ldy     #_FILE::f_fd
+        lda     (ptr1),y
+        jsr     pusha0          ; f->f_fd
+        lda     #<char
+        ldx     #>char
+        jsr     pushax          ; &char
+        lda     #<1
+        ldx     #>1
+        jsr     _read
+
+; Check the result: -1 is an error, zero means end of file
+
+        cpx     #0
+        bne     @Err
+        cmp     #0
+        beq     @Eof
+        lda     char
+        rts                     ; X is zero
+
+@Err:   lda     #_FERROR
+        bne     @L2             ; Branch always
+@Eof:   lda     #_FEOF
+@L2:    ldy     file
+        sty     ptr1
+        ldy     file+1
+        sty     ptr1+1
+        ldy     #_FILE::f_flags
+        ora     (ptr1),y
+        sta     (ptr1),y
+
+; Return EOF
+
+ReturnEOF:
+        lda     #$FF
+        tax
+        rts
+
+.endproc
+
+; ------------------------------------------------------------------------
+; Data
+
+.bss
+file:   .res    2
+char:   .res    1
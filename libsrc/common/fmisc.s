@@ -4,8 +4,7 @@
 ; Several small file stream functions
 ;
 
-        .export         _clearerr, _feof, _ferror, _fileno, _fflush
-        .import         return0
+        .export         _clearerr, _feof, _ferror, _fileno
         .importzp       ptr1
 
         .include        "_file.inc"
@@ -84,10 +83,4 @@ error:  lda     #<EBADF
         rts
 .endproc
 
-;
-; int __fastcall__ fflush (FILE* f);
-;
-
-_fflush = return0
-
 
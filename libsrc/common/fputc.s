@@ -0,0 +1,97 @@
+;
+; Ullrich von Bassewitz, 1998-06-02
+; The cc65 Authors, 2026: Rewritten in assembler, buffered streams
+;
+; int __fastcall__ fputc (int c, FILE* f);
+; /* Write a character to a stream */
+;
+
+        .export         _fputc
+
+        .import         _write
+        .import         pusha0, pushax, incsp2
+        .importzp       sp, ptr1, ptr2
+
+        .include        "_file.inc"
+
+; ------------------------------------------------------------------------
+; Code
+
+.proc   _fputc
+
+        sta     ptr1
+        stx     ptr1+1          ; Save f
+
+; Return EOF if the file is not open or if there is an error condition
+
+        ldy     #_FILE::f_flags
+        lda     (ptr1),y
+        and     #(_FOPEN | _FERROR | _FEOF)
+        cmp     #_FOPEN
+        bne     ReturnEOF
+
+; Buffered streams are handled by the buffer code
+
+        lda     (ptr1),y
+        bpl     Unbuffered
+        lda     ptr1
+        ldx     ptr1+1
+        jmp     __fbufvputc
+
+; Unbuffered stream, write the byte
+
+Unbuffered:
+        lda     ptr1
+        sta     file
+        lda     ptr1+1
+        sta     file+1
+        lda     sp
+        sta     ptr2
+        lda     sp+1
+        sta     ptr2+1          ; &c
+        ldy     #_FILE::f_fd
+        lda     (ptr1),y
+        jsr     pusha0          ; f->f_fd
+        lda     ptr2
+        ldx     ptr2+1
+        jsr     pushax          ; &c
+        lda     #<1
+        ldx     #>1
+        jsr     _write
+        cmp     #1
+        bne     @Err
+        cpx     #0
+        bne     @Err
+
+; Return the char written
+
+        ldy     #0
+        lda     (sp),y
+        ldx     #0
+        jmp     incsp2
+
+; Error
+
+@Err:   lda     file
+        sta     ptr1
+        lda     file+1
+        sta     ptr1+1
+        ldy     #_FILE::f_flags
+        lda     (ptr1),y
+        ora     #_FERROR
+        sta     (ptr1),y
+
+; Return EOF
+
+ReturnEOF:
+        lda     #$FF
+        tax
+        jmp     incsp2
+
+.endproc
+
+; ------------------------------------------------------------------------
+; Data
+
+.bss
+file:   .res    2
@@ -15,13 +15,21 @@
 
 int __fastcall__ fputs (const char* s, register FILE* f)
 {
+    size_t len;
+
     /* Check if the file is open or if there is an error condition */
     if ((f->f_flags & _FOPEN) == 0 || (f->f_flags & (_FERROR | _FEOF)) != 0) {
         return EOF;
     }
 
+    /* Buffered streams collect the output in the buffer */
+    len = strlen (s);
+    if (f->f_flags & _FBUFFERED) {
+        return _fbufvwrite (s, 1, len, f) == len? len : EOF;
+    }
+
     /* Write the string */
-    return write (f->f_fd, s, strlen (s));
+    return write (f->f_fd, s, len);
 }
 
 
@@ -63,10 +63,26 @@
         tax                             ; a/x = 0
         jmp     @L99                    ; Bail out
 
+; Buffered stream. Restore the register bank and call _fbufread with the
+; parameters that are still on the stack.
+
+@Buffered:
+        lda     file
+        ldx     file+1
+        ldy     save                    ; Restore zp register
+        sty     file
+        ldy     save+1
+        sty     file+1
+        jmp     __fbufvread
+
+; If the stream is buffered, leave the work to the buffered read function
+
+@L2:    lda     (file),y                ; get file->f_flags again
+        bmi     @Buffered
+
 ; Remember if we have a pushed back character and reset the flag.
 
-@L2:    tax                             ; X = 0
-        lda     (file),y
+        ldx     #0
         and     #_FPUSHBACK
         beq     @L3
         lda     (file),y
@@ -27,10 +27,10 @@ FILE* __fastcall__ freopen (const char* name, const char* mode, FILE* f)
         return (FILE*) _seterrno (EINVAL);      /* File not input */
     }
 
-    /* Close the file. Don't bother setting the flag, it will get
-    ** overwritten by _fopen.
+    /* Close the file. fclose writes out and releases the buffer of a buffered
+    ** stream.
     */
-    if (close (f->f_fd) < 0) {
+    if (fclose (f) != 0) {
         /* An error occured, errno is already set */
         return 0;
     }
@@ -37,6 +37,13 @@ int __fastcall__ fseek (register FILE* f, long offset, int whence)
         --offset;
     }
 
+    /* Write out the output of a buffered stream, or give back any chars that
+    ** were read ahead, so the file position matches the stream position.
+    */
+    if ((f->f_flags & _FBUFFERED) && _fbufvflush (f) != 0) {
+        return -1;
+    }
+
     /* Do the seek */
     res = lseek(f->f_fd, offset, whence);
 
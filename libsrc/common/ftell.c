@@ -33,6 +33,11 @@ long __fastcall__ ftell (register FILE* f)
     /* Call the low level function */
     pos = lseek (f->f_fd, 0L, SEEK_CUR);
 
+    /* Account for the contents of the buffer of a buffered stream */
+    if (pos >= 0 && (f->f_flags & _FBUFFERED)) {
+        pos += _fbufvoffs (f);
+    }
+
     /* If we didn't have an error, correct the return value in case we have
     ** a pushed back character.
     */
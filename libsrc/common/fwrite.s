@@ -49,6 +49,11 @@
         and     #_FERROR
         bne     @L1
 
+; If the stream is buffered, leave the work to the buffered write function
+
+        lda     (ptr1),y                ; get file->f_flags again
+        bmi     Buffered
+
 ; Build the stackframe for write()
 
         ldy     #_FILE::f_fd
@@ -116,6 +121,14 @@
         jsr     tosudivax               ; bytes / size -> a/x
         jmp     incsp6                  ; Drop params, return
 
+; Buffered stream. Call _fbufwrite with the parameters that are still on the
+; stack.
+
+Buffered:
+        lda     ptr1
+        ldx     ptr1+1
+        jmp     __fbufvwrite
+
 .endproc
 
 ; ------------------------------------------------------------------------
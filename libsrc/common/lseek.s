@@ -0,0 +1,23 @@
+;
+; 2026-10-19, The cc65 Authors
+;
+; off_t __fastcall__ lseek (int fd, off_t offset, int whence);
+; /* Fallback for targets that cannot seek: Fail with ENOSYS */
+;
+
+        .export         _lseek
+        .import         incsp6
+        .importzp       sreg
+
+        .include        "errno.inc"
+
+.proc   _lseek
+
+        jsr     incsp6          ; Drop fd and offset
+        lda     #<ENOSYS
+        jsr     __directerrno   ; Returns with $FFFF in AX
+        sta     sreg
+        sta     sreg+1
+        rts
+
+.endproc
@@ -85,8 +85,11 @@ int __fastcall__ posix_memalign (void** memptr, size_t alignment, size_t size)
     ** manage the used block, because the block returned by malloc() has that
     ** overhead added one time; and, the worst thing that might happen is that
     ** we cannot free the upper and lower blocks.
+    ** The block is taken from the free list directly, since the parts below
+    ** and above the aligned block are returned there, which doesn't work for
+    ** blocks of an alternative allocator.
     */
-    b = malloc (size + alignment);
+    b = _heapalloc (size + alignment);
 
     /* Handle out-of-memory */
     if (b == NULL) {
@@ -23,8 +23,11 @@ int __fastcall__ puts (const char* s)
 {
     static char nl = '\n';
 
-    /* Assume stdout is always open */
-    if (write (stdout->f_fd, s, strlen (s)) < 0 ||
+    /* Assume stdout is always open. If it is buffered, write out the
+    ** buffer first, so the output appears in the right order.
+    */
+    if (((stdout->f_flags & _FBUFFERED) && _fbufvflush (stdout) != 0) ||
+        write (stdout->f_fd, s, strlen (s)) < 0 ||
         write (stdout->f_fd, &nl, 1)        < 0) {
         stdout->f_flags |= _FERROR;
         return -1;
@@ -0,0 +1,22 @@
+/*
+** setbuf.c
+**
+** (C) 2026, The cc65 Authors
+*/
+
+
+
+#include <stdio.h>
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void __fastcall__ setbuf (FILE* f, char* buf)
+{
+    setvbuf (f, buf, buf? _IOFBF : _IONBF, BUFSIZ);
+}
@@ -0,0 +1,217 @@
+;
+; (C) 2026, The cc65 Authors
+;
+; int __fastcall__ setvbuf (FILE* f, char* buf, int mode, size_t size);
+; /* Give a stream a buffer or make it unbuffered */
+;
+
+        .export         _setvbuf
+        .constructor    initvec
+        .destructor     flushall, 16
+        .import         _malloc, _fflush, __fbufget, __fbufrelease
+        .import         __fbufgetc, __fbufputc, __fbufread, __fbufwrite
+        .import         __fbufflush, __fbufclose, __fbufoffs
+        .import         incsp6
+        .importzp       sp, ptr1
+
+        .include        "errno.inc"
+        .include        "stdio.inc"
+        .include        "_file.inc"
+
+; ------------------------------------------------------------------------
+; Code
+
+.proc   _setvbuf
+
+        sta     size
+        stx     size+1          ; Save size
+
+; Get f from the stack
+
+        ldy     #5
+        lda     (sp),y
+        sta     file+1
+        dey
+        lda     (sp),y
+        sta     file
+        jsr     getf
+
+; Check the parameters. The file must be open, the mode valid, and buffered
+; streams need a buffer size.
+
+        ldy     #_FILE::f_flags
+        lda     (ptr1),y
+        and     #_FOPEN
+        beq     @Inval
+        ldy     #1
+        lda     (sp),y
+        bne     @Inval          ; Mode out of range
+        dey
+        lda     (sp),y
+        sta     mode
+        cmp     #_IONBF
+        beq     @L1
+        bcs     @Inval          ; Mode out of range
+        lda     size
+        ora     size+1
+        bne     @L1             ; Jump if size is not zero
+
+; Invalid parameters
+
+@Inval: lda     #EINVAL
+@Err:   jsr     __seterrno
+@Error: lda     #$FF            ; Return -1
+        tax
+        jmp     incsp6
+
+; Write out and release the old buffer
+
+@L1:    ldy     #_FILE::f_flags
+        lda     (ptr1),y
+        bpl     @L2             ; Jump if unbuffered
+        lda     ptr1
+        ldx     ptr1+1
+        jsr     __fbufrelease   ; Returns zero or EOF
+        tax
+        bne     @Error          ; errno is already set
+        jsr     getf
+
+; Unbuffered streams are done
+
+@L2:    lda     mode
+        cmp     #_IONBF
+        beq     done
+
+; Use the caller's buffer, or allocate one
+
+        lda     #0              ; No buffer flags so far
+        sta     flags
+        ldy     #3
+        lda     (sp),y
+        tax
+        dey
+        lda     (sp),y
+        cpx     #0
+        bne     @L3
+        cmp     #0
+        bne     @L3
+        lda     size
+        ldx     size+1
+        jsr     _malloc
+        cpx     #0
+        bne     @L4
+        cmp     #0
+        bne     @L4
+        lda     #ENOMEM
+        bne     @Err            ; Branch always
+@L4:    ldy     #_FBUFALLOC
+        sty     flags
+
+; Install the buffer. Position and length of an unused entry in _fbuftab are
+; zero.
+
+@L3:    pha
+        txa
+        pha
+        lda     file
+        ldx     file+1
+        jsr     __fbufget
+        sta     ptr1
+        stx     ptr1+1          ; Buffer of f
+        ldy     #_FBUF::b_buf+1
+        pla
+        sta     (ptr1),y
+        dey
+        pla
+        sta     (ptr1),y
+        ldy     #_FBUF::b_size
+        lda     size
+        sta     (ptr1),y
+        iny
+        lda     size+1
+        sta     (ptr1),y
+
+        lda     flags
+        ldx     mode
+        cpx     #_IOLBF
+        bne     @L5
+        ora     #_FLINEBUF
+@L5:    ldy     #_FBUF::b_flags
+        sta     (ptr1),y
+
+        jsr     getf
+        ldy     #_FILE::f_flags
+        lda     (ptr1),y
+        ora     #_FBUFFERED
+        sta     (ptr1),y
+
+; Done, return zero
+
+done:   lda     #0
+        tax
+        jmp     incsp6
+
+.endproc
+
+; ------------------------------------------------------------------------
+; Load the saved file pointer into ptr1
+
+.proc   getf
+
+        lda     file
+        sta     ptr1
+        lda     file+1
+        sta     ptr1+1
+        rts
+
+.endproc
+
+; ------------------------------------------------------------------------
+; Set the vectors that lead the other stdio functions to the buffer code
+
+.proc   initvec
+
+        ldy     #(vecend - vectors - 1)
+@L1:    lda     vectors,y
+        sta     __fbufvec,y
+        dey
+        bpl     @L1
+        rts
+
+.endproc
+
+; ------------------------------------------------------------------------
+; Write out the output of all buffered streams when the program exits. This
+; runs after the functions registered with atexit, which may still write to
+; the streams.
+
+.proc   flushall
+
+        lda     #0
+        tax
+        jmp     _fflush         ; fflush (NULL);
+
+.endproc
+
+; ------------------------------------------------------------------------
+; Data
+
+; Jumps to the buffer code, in the order of the vectors in _file.s
+
+.rodata
+vectors:
+        jmp     __fbufgetc
+        jmp     __fbufputc
+        jmp     __fbufread
+        jmp     __fbufwrite
+        jmp     __fbufflush
+        jmp     __fbufclose
+        jmp     __fbufoffs
+vecend:
+
+.bss
+file:   .res    2
+size:   .res    2
+mode:   .res    1
+flags:  .res    1
+
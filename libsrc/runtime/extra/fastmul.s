@@ -0,0 +1,249 @@
+;
+; CC65 runtime: Table based multiplication for ints and 8x8 => 16 products
+;
+; This module is not part of the library. It exports the same entry points
+; as mul.s, mul8.s, umul8x8r16.s and imul8x8r16.s, so linking it in front of
+; the library replaces the shift-and-add loops of those modules:
+;
+;       cl65 -t sim6502 prog.c sim6502-fastmul.o
+;
+; The products are calculated from quarter squares:
+;
+;       a * b = f(a + b) - f(|a - b|)   with   f(n) = n * n / 4
+;
+; which is exact, since a + b and a - b are either both odd or both even.
+; The tables need 2K of RAM in segment MULTAB, which must be page aligned
+; and is filled by a constructor at startup. Linker configs opt in with
+;
+;       MULTAB: load = MAIN, type = bss, align = $100, optional = yes;
+;
+
+        .export         tosumulax, tosmulax, tosumula0, tosmula0
+        .export         umul8x8r16, umul8x8r16m
+        .export         imul8x8r16, imul8x8r16m
+        .constructor    initfastmul
+        .import         popsreg
+        .importzp       sreg, ptr1, ptr2, ptr3, ptr4, tmp1, tmp2, tmp3
+
+
+;---------------------------------------------------------------------------
+; Tables. sqr1 holds f(n) for n = 0..511, sqr2 holds f(|n - 255|), so the
+; difference above is sqr1[a + b] - sqr2[(a ^ $FF) + b].
+
+.segment        "MULTAB"
+        .align  256
+
+sqr1_lo:        .res    512
+sqr1_hi:        .res    512
+sqr2_lo:        .res    512
+sqr2_hi:        .res    512
+
+
+;---------------------------------------------------------------------------
+; Let ptr1..ptr4 point into the tables at the multiplicand in A. A following
+; mullo/mulhi with the multiplier in Y returns the low and high byte of the
+; product.
+
+.macro  mulsetup
+        sta     ptr1
+        sta     ptr2
+        eor     #$FF
+        sta     ptr3
+        sta     ptr4
+        lda     #>sqr1_lo
+        sta     ptr1+1
+        lda     #>sqr1_hi
+        sta     ptr2+1
+        lda     #>sqr2_lo
+        sta     ptr3+1
+        lda     #>sqr2_hi
+        sta     ptr4+1
+.endmacro
+
+; Low byte of the product. Leaves the borrow for mulhi in the carry.
+
+.macro  mullo
+        sec
+        lda     (ptr1),y
+        sbc     (ptr3),y
+.endmacro
+
+.macro  mulhi
+        lda     (ptr2),y
+        sbc     (ptr4),y
+.endmacro
+
+
+.code
+
+;---------------------------------------------------------------------------
+; 16x16 => 16 multiplication, left operand on the stack, right one in AX
+
+tosmulax:
+tosumulax:
+        cpx     #$00
+        beq     tosumula0       ; Do 8x16 multiplication if high byte zero
+        stx     tmp2            ; Save high byte of right operand
+        mulsetup                ; Multiply by the low byte
+        jsr     popsreg         ; Get left operand
+
+        ldy     sreg
+        mullo
+        sta     tmp1            ; Low byte of result
+        mulhi
+        sta     tmp3
+        ldy     sreg+1
+        mullo                   ; Low byte of left high * right low
+        clc
+        adc     tmp3
+        sta     tmp3
+
+        lda     tmp2            ; Low byte of left low * right high
+        sta     ptr1
+        eor     #$FF
+        sta     ptr3
+        ldy     sreg
+        mullo
+        clc
+        adc     tmp3
+        tax
+        lda     tmp1
+        rts
+
+;---------------------------------------------------------------------------
+; 16x8 => 16 multiplication, left operand on the stack, right one in A
+
+tosmula0:
+tosumula0:
+        mulsetup
+        jsr     popsreg         ; Get left operand
+
+        ldy     sreg
+        mullo
+        sta     tmp1            ; Low byte of result
+        mulhi
+        ldy     sreg+1
+        beq     @L1             ; Done if the high byte of left is zero
+        sta     tmp3
+        mullo
+        clc
+        adc     tmp3
+@L1:    tax
+        lda     tmp1
+        rts
+
+;---------------------------------------------------------------------------
+; 8x8 => 16 unsigned multiplication routine. Changes ptr2, ptr4 and the high
+; byte of ptr3 in addition to what umul8x8r16.s changes.
+;
+;   LHS            RHS          result      result in also
+; -------------------------------------------------------------
+;   .A (ptr3-low)  ptr1-low     .XA             ptr1
+;
+
+umul8x8r16:
+        sta     ptr3
+umul8x8r16m:
+        ldy     ptr1
+        lda     ptr3
+        mulsetup
+        mullo
+        sta     tmp1
+        mulhi
+        tax
+        lda     ptr1            ; Restore the LHS
+        sta     ptr3
+        stx     ptr1+1          ; Result in .XA and ptr1
+        lda     tmp1
+        sta     ptr1
+        rts
+
+;---------------------------------------------------------------------------
+; 8x8 => 16 signed multiplication routine. Multiplies the operands as
+; unsigned bytes, then subtracts the other operand from the high byte for
+; each negative one.
+;
+;   multiplicand  multiplier   product
+;   LHS             RHS        result
+; -------------------------------------------------------------
+;   .A (ptr3-low)   ptr1-low    .XA
+;
+
+imul8x8r16:
+        sta     ptr3
+imul8x8r16m:
+        ldy     ptr1
+        sty     tmp2            ; Remember RHS
+        lda     ptr3
+        mulsetup                ; ptr1-low is LHS now
+        mullo
+        sta     tmp1
+        mulhi
+        ldx     ptr1
+        bpl     @L1
+        sec
+        sbc     tmp2
+@L1:    bit     tmp2
+        bpl     @L2
+        sec
+        sbc     ptr1
+@L2:    tax
+        lda     tmp1
+        rts
+
+
+;---------------------------------------------------------------------------
+; Fill the tables. f(n + 1) = f(n) + (n + 1) / 2, so the difference of
+; neighbouring entries grows by one after each odd n.
+
+.segment        "ONCE"
+
+initfastmul:
+        ldy     #$00
+        sty     ptr1
+        sty     ptr2
+        sty     sreg            ; f(n)
+        sty     sreg+1
+        sty     tmp1            ; (n + 1) / 2
+        lda     #>sqr1_lo
+        sta     ptr1+1
+        lda     #>sqr1_hi
+        sta     ptr2+1
+        ldx     #2              ; Two pages
+@L1:    lda     sreg
+        sta     (ptr1),y
+        lda     sreg+1
+        sta     (ptr2),y
+        tya
+        lsr     a
+        bcc     @L2
+        inc     tmp1
+@L2:    clc
+        lda     sreg
+        adc     tmp1
+        sta     sreg
+        bcc     @L3
+        inc     sreg+1
+@L3:    iny
+        bne     @L1
+        inc     ptr1+1
+        inc     ptr2+1
+        dex
+        bne     @L1
+
+; sqr2[n] is sqr1[255 - n] in the first page and sqr1[n - 255] in the second
+
+@L4:    tya
+        eor     #$FF
+        tax
+        lda     sqr1_lo,x
+        sta     sqr2_lo,y
+        lda     sqr1_hi,x
+        sta     sqr2_hi,y
+        lda     sqr1_lo+1,y
+        sta     sqr2_lo+256,y
+        lda     sqr1_hi+1,y
+        sta     sqr2_hi+256,y
+        iny
+        bne     @L4
+        rts
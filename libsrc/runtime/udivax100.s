@@ -0,0 +1,36 @@
+;
+; CC65 runtime: Divide the primary register by 100 (unsigned)
+;
+; Divides by 10 twice. Returns the quotient in a/x and the remainder in y.
+;
+
+        .export         udivax100
+        .import         udivax10
+        .importzp       ptr1, tmp1
+
+.proc   udivax100
+
+        jsr     udivax10
+        sta     ptr1
+        tya
+        pha                     ; Save the first remainder
+        lda     ptr1
+        jsr     udivax10
+        sta     tmp1            ; Save the low byte of the quotient
+
+; Remainder = 10 * r2 + r1. r2 is less than 10, so there is no carry
+
+        sty     ptr1
+        tya
+        asl     a
+        asl     a
+        adc     ptr1
+        asl     a
+        sta     ptr1
+        pla
+        adc     ptr1
+        tay
+        lda     tmp1
+        rts
+
+.endproc
@@ -0,0 +1,84 @@
+;
+; CC65 runtime: Divide the primary register by 5 (unsigned)
+;
+; Works like udivax10. Returns the quotient in a/x and the remainder in y.
+;
+
+        .export         udivax5
+        .importzp       sreg, ptr1, tmp1
+
+.proc   udivax5
+
+        sta     tmp1            ; Remember the low byte of n
+        stx     sreg+1
+        lsr     sreg+1
+        ror     a
+        lsr     sreg+1
+        ror     a
+        lsr     sreg+1
+        ror     a
+        sta     sreg            ; sreg = n >> 3
+        ldx     sreg+1
+        stx     ptr1+1
+        lsr     ptr1+1
+        ror     a               ; ptr1+1/a = n >> 4
+        clc
+        adc     sreg
+        sta     ptr1
+        lda     ptr1+1
+        adc     sreg+1
+        sta     ptr1+1          ; q = (n >> 3) + (n >> 4)
+
+; q += q >> 4
+
+        sta     sreg+1
+        lda     ptr1
+        lsr     sreg+1
+        ror     a
+        lsr     sreg+1
+        ror     a
+        lsr     sreg+1
+        ror     a
+        lsr     sreg+1
+        ror     a
+        clc
+        adc     ptr1
+        sta     ptr1
+        lda     sreg+1
+        adc     ptr1+1
+        sta     ptr1+1
+
+; q += q >> 8
+
+        clc
+        adc     ptr1
+        sta     ptr1
+        bcc     @L1
+        inc     ptr1+1
+
+; The remainder n - q * 5 is less than 256, so the low bytes are enough
+
+@L1:    asl     a
+        asl     a
+        clc
+        adc     ptr1
+        eor     #$FF
+        sec
+        adc     tmp1
+
+; Correct the estimate
+
+@L2:    cmp     #5
+        bcc     @L3
+        sbc     #5
+        inc     ptr1
+        bne     @L2
+        inc     ptr1+1
+        bcs     @L2             ; Branch always
+
+@L3:    tay                     ; Remainder
+        lda     ptr1
+        ldx     ptr1+1
+        rts
+
+.endproc
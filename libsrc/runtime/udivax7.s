@@ -0,0 +1,93 @@
+;
+; CC65 runtime: Divide the primary register by 7 (unsigned)
+;
+; Works like udivax10. Returns the quotient in a/x and the remainder in y.
+;
+
+        .export         udivax7
+        .importzp       sreg, ptr1, tmp1
+
+.proc   udivax7
+
+        sta     tmp1            ; Remember the low byte of n
+        stx     sreg+1
+        lsr     sreg+1
+        ror     a
+        sta     sreg            ; sreg = n >> 1
+        ldx     sreg+1
+        stx     ptr1+1
+        lsr     ptr1+1
+        ror     a
+        lsr     ptr1+1
+        ror     a
+        lsr     ptr1+1
+        ror     a               ; ptr1+1/a = n >> 4
+        clc
+        adc     sreg
+        sta     ptr1
+        lda     ptr1+1
+        adc     sreg+1
+        sta     ptr1+1          ; q = (n >> 1) + (n >> 4)
+
+; q += q >> 6
+
+        sta     sreg+1
+        lda     ptr1
+        ldy     #6
+@L0:    lsr     sreg+1
+        ror     a
+        dey
+        bne     @L0
+        clc
+        adc     ptr1
+        sta     ptr1
+        lda     sreg+1
+        adc     ptr1+1
+        sta     ptr1+1
+
+; q += q >> 12
+
+        lsr     a
+        lsr     a
+        lsr     a
+        lsr     a
+        clc
+        adc     ptr1
+        bcc     @L1
+        inc     ptr1+1
+
+; q >>= 2
+
+@L1:    lsr     ptr1+1
+        ror     a
+        lsr     ptr1+1
+        ror     a
+        sta     ptr1
+
+; The remainder n - q * 7 is less than 256, so the low bytes are enough
+
+        asl     a
+        asl     a
+        asl     a
+        sec
+        sbc     ptr1
+        eor     #$FF
+        sec
+        adc     tmp1
+
+; Correct the estimate
+
+@L2:    cmp     #7
+        bcc     @L3
+        sbc     #7
+        inc     ptr1
+        bne     @L2
+        inc     ptr1+1
+        bcs     @L2             ; Branch always
+
+@L3:    tay                     ; Remainder
+        lda     ptr1
+        ldx     ptr1+1
+        rts
+
+.endproc
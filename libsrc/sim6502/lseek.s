@@ -0,0 +1,9 @@
+;
+; 2026-10-19, The cc65 Authors
+;
+; off_t __fastcall__ lseek (int fd, off_t offset, int whence);
+;
+
+        .export         _lseek
+
+_lseek          := $FFF6
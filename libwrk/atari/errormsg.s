@@ -0,0 +1,85 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.export		__sys_errlist
+
+.segment	"RODATA"
+
+__sys_errlist:
+	.addr	L0001
+	.addr	L0003
+	.addr	L0005
+	.addr	L0007
+	.addr	L0009
+	.addr	L000B
+	.addr	L000D
+	.addr	L000F
+	.addr	L0011
+	.addr	L0013
+	.addr	L0015
+	.addr	L0017
+	.addr	L0019
+	.addr	L001B
+	.addr	L001D
+	.addr	L001F
+	.addr	L0021
+	.addr	L0023
+	.addr	L0025
+L0003:
+	.byte	$4E,$6F,$20,$73,$75,$63,$68,$20,$66,$69,$6C,$65,$20,$6F,$72,$20
+	.byte	$64,$69,$72,$65,$63,$74,$6F,$72,$79,$00
+L001B:
+	.byte	$46,$75,$6E,$63,$74,$69,$6F,$6E,$20,$6E,$6F,$74,$20,$69,$6D,$70
+	.byte	$6C,$65,$6D,$65,$6E,$74,$65,$64,$00
+L0011:
+	.byte	$4E,$6F,$20,$73,$70,$61,$63,$65,$20,$6C,$65,$66,$74,$20,$6F,$6E
+	.byte	$20,$64,$65,$76,$69,$63,$65,$00
+L000D:
+	.byte	$44,$65,$76,$69,$63,$65,$20,$6F,$72,$20,$72,$65,$73,$6F,$75,$72
+	.byte	$63,$65,$20,$62,$75,$73,$79,$00
+L0019:
+	.byte	$49,$6E,$74,$65,$72,$72,$75,$70,$74,$65,$64,$20,$73,$79,$73,$74
+	.byte	$65,$6D,$20,$63,$61,$6C,$6C,$00
+L0025:
+	.byte	$55,$6E,$6B,$6E,$6F,$77,$6E,$20,$4F,$53,$20,$65,$72,$72,$6F,$72
+	.byte	$20,$63,$6F,$64,$65,$00
+L000B:
+	.byte	$54,$6F,$6F,$20,$6D,$61,$6E,$79,$20,$6F,$70,$65,$6E,$20,$66,$69
+	.byte	$6C,$65,$73,$00
+L0007:
+	.byte	$50,$65,$72,$6D,$69,$73,$73,$69,$6F,$6E,$20,$64,$65,$6E,$69,$65
+	.byte	$64,$00
+L0023:
+	.byte	$45,$78,$65,$63,$20,$66,$6F,$72,$6D,$61,$74,$20,$65,$72,$72,$6F
+	.byte	$72,$00
+L000F:
+	.byte	$49,$6E,$76,$61,$6C,$69,$64,$20,$61,$72,$67,$75,$6D,$65,$6E,$74
+	.byte	$00
+L0021:
+	.byte	$42,$61,$64,$20,$66,$69,$6C,$65,$20,$6E,$75,$6D,$62,$65,$72,$00
+L0009:
+	.byte	$4E,$6F,$20,$73,$75,$63,$68,$20,$64,$65,$76,$69,$63,$65,$00
+L0005:
+	.byte	$4F,$75,$74,$20,$6F,$66,$20,$6D,$65,$6D,$6F,$72,$79,$00
+L0001:
+	.byte	$55,$6E,$6B,$6E,$6F,$77,$6E,$20,$65,$72,$72,$6F,$72,$00
+L001D:
+	.byte	$49,$6C,$6C,$65,$67,$61,$6C,$20,$73,$65,$65,$6B,$00
+L0013:
+	.byte	$46,$69,$6C,$65,$20,$65,$78,$69,$73,$74,$73,$00
+L001F:
+	.byte	$52,$61,$6E,$67,$65,$20,$65,$72,$72,$6F,$72,$00
+L0017:
+	.byte	$49,$2F,$4F,$20,$65,$72,$72,$6F,$72,$00
+L0015:
+	.byte	$54,$72,$79,$20,$61,$67,$61,$69,$6E,$00
+
@@ -0,0 +1,120 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.export		_fseek
+	.import		__seterrno
+	.import		_lseek
+	.import		__fbufvflush
+	.import		__fbufvoffs
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ fseek (register __near__ struct _FILE *, long, int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fseek: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$06
+	ldx     #$04
+	jsr     regswap2
+	jsr     decsp6
+	ldy     #$01
+	lda     (regbank+4),y
+	and     #$01
+	bne     L0034
+	lda     #$07
+	jsr     __seterrno
+	jmp     L003B
+L0034:	lda     (regbank+4),y
+	and     #$08
+	beq     L003C
+	ldy     #$06
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L000B
+	tax
+	sta     sreg
+	sta     sreg+1
+	lda     #$01
+	iny
+	jsr     lsubeqysp
+L000B:	ldy     #$01
+L003C:	lda     (regbank+4),y
+	and     #$80
+	beq     L001E
+	ldy     #$06
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0014
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     __fbufvoffs
+	jsr     stax0sp
+	cpx     #$80
+	bcc     L0014
+	jsr     ldax0sp
+	jsr     axlong
+	ldy     #$08
+	jsr     laddeqysp
+L0014:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     __fbufvflush
+	cpx     #$00
+	bne     L003B
+	cmp     #$00
+	bne     L003B
+L001E:	tay
+	lda     (regbank+4),y
+	jsr     pusha0
+	ldy     #$0D
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     _lseek
+	ldy     #$02
+	jsr     steaxysp
+	ldy     #$05
+	jsr     ldeaxysp
+	lda     sreg+1
+	bmi     L0028
+	ldy     #$01
+	lda     (regbank+4),y
+	and     #$F5
+	sta     (regbank+4),y
+	ldx     #$00
+	jmp     L003D
+L0028:	ldy     #$01
+	lda     (regbank+4),y
+	ora     #$04
+	sta     (regbank+4),y
+L003B:	ldx     #$FF
+L003D:	txa
+	pha
+	ldy     #$0C
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	iny
+	jmp     addysp
+
+.endproc
+
@@ -0,0 +1,149 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_strchr
+	.export		_strqtok
+
+.segment	"RODATA"
+
+L003E:
+	.byte	$00
+L0004	:=	L003E+0
+
+; ---------------------------------------------------------------
+; __near__ unsigned char * __near__ __fastcall__ strqtok (register __near__ unsigned char *, __near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_strqtok: near
+
+.segment	"DATA"
+
+L0005:
+	.addr	L0004
+
+.segment	"BSS"
+
+L0002:
+	.res	1,$00
+L0003:
+	.res	2,$00
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	ldx     #$04
+	jsr     regswap2
+	lda     regbank+4
+	ora     regbank+4+1
+	bne     L0011
+	lda     L0005
+	sta     regbank+4
+	lda     L0005+1
+	sta     regbank+4+1
+	lda     L0002
+	cmp     #$22
+	bne     L0011
+	jmp     L004C
+L000F:	lda     L0002
+	bne     L0016
+	tax
+	jmp     L0001
+L0016:	inc     regbank+4
+	bne     L0011
+	inc     regbank+4+1
+L0011:	jsr     pushw0sp
+	ldy     #$00
+	lda     (regbank+4),y
+	sta     L0002
+	ldx     #$00
+	jsr     _strchr
+	stx     tmp1
+	ora     tmp1
+	bne     L000F
+	lda     L0002
+	cmp     #$22
+	beq     L001D
+	lda     regbank+4
+	sta     L0003
+	lda     regbank+4+1
+	sta     L0003+1
+	jmp     L0022
+L0020:	inc     regbank+4
+	bne     L0022
+	inc     regbank+4+1
+L0022:	ldy     #$00
+	lda     (regbank+4),y
+	sta     L0002
+	cmp     #$22
+	beq     L004B
+	jsr     pushw0sp
+	lda     L0002
+	ldx     #$00
+	jsr     _strchr
+	stx     tmp1
+	ora     tmp1
+	beq     L0020
+L004B:	lda     L0002
+	bne     L0036
+	jmp     L002E
+L001D:	inc     regbank+4
+	bne     L004C
+	inc     regbank+4+1
+L004C:	lda     #$00
+	sta     L0002
+	lda     regbank+4
+	sta     L0003
+	lda     regbank+4+1
+	sta     L0003+1
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	ldx     #$00
+	lda     #$22
+	jsr     _strchr
+	sta     regbank+4
+	stx     regbank+4+1
+	cpx     #$00
+	bne     L0036
+	cmp     #$00
+	bne     L0036
+	lda     #<(L003E)
+	sta     L0005
+	lda     #>(L003E)
+	jmp     L004E
+L0036:	lda     #$00
+	tay
+	sta     (regbank+4),y
+	inc     regbank+4
+	bne     L002E
+	inc     regbank+4+1
+L002E:	lda     regbank+4
+	sta     L0005
+	lda     regbank+4+1
+L004E:	sta     L0005+1
+	lda     L0003
+	ldx     L0003+1
+L0001:	pha
+	ldy     #$02
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp4
+
+.endproc
+
@@ -0,0 +1,688 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_stdin
+	.import		_stderr
+	.import		_fclose
+	.import		_fgets
+	.import		_fopen
+	.import		_fprintf
+	.import		_fread
+	.import		_printf
+	.import		_malloc
+	.import		_free
+	.import		__heapmaxavail
+	.import		_atexit
+	.import		_strerror
+	.import		_strlen
+	.import		__errno
+	.import		__sys
+	.import		_doesclrscrafterexit
+	.import		_cgetc
+	.export		_main
+
+.segment	"DATA"
+
+_verbose:
+	.word	$0001
+_C_dev:
+	.byte	$43,$3A,$00
+
+.segment	"RODATA"
+
+L00FB:
+	.byte	$43,$49,$4F,$20,$63,$61,$6C,$6C,$20,$74,$6F,$20,$63,$6C,$6F,$73
+	.byte	$65,$20,$63,$61,$73,$73,$65,$74,$74,$65,$20,$72,$65,$74,$75,$72
+	.byte	$6E,$65,$64,$20,$25,$64,$9B,$00
+L0067:
+	.byte	$63,$61,$6E,$6E,$6F,$74,$20,$61,$6C,$6C,$6F,$63,$20,$25,$6C,$64
+	.byte	$20,$62,$79,$74,$65,$73,$20,$2D,$2D,$20,$61,$62,$6F,$72,$74,$69
+	.byte	$6E,$67,$2E,$2E,$2E,$9B,$00
+L00C4:
+	.byte	$43,$49,$4F,$20,$63,$61,$6C,$6C,$20,$74,$6F,$20,$6F,$70,$65,$6E
+	.byte	$20,$63,$61,$73,$73,$65,$74,$74,$65,$20,$72,$65,$74,$75,$72,$6E
+	.byte	$65,$64,$20,$25,$64,$9B,$00
+L009D:
+	.byte	$66,$69,$6C,$65,$20,$69,$73,$20,$74,$6F,$6F,$20,$6C,$61,$72,$67
+	.byte	$65,$20,$28,$6D,$75,$73,$74,$20,$62,$65,$20,$3C,$20,$33,$32,$37
+	.byte	$36,$38,$29,$9B,$00
+L00DF:
+	.byte	$43,$49,$4F,$20,$63,$61,$6C,$6C,$20,$74,$6F,$20,$77,$72,$69,$74
+	.byte	$65,$20,$66,$69,$6C,$65,$20,$72,$65,$74,$75,$72,$6E,$65,$64,$20
+	.byte	$25,$64,$9B,$00
+L002A:
+	.byte	$75,$73,$69,$6E,$67,$20,$69,$6F,$63,$62,$20,$69,$6E,$64,$65,$78
+	.byte	$20,$24,$25,$30,$32,$58,$20,$28,$24,$25,$30,$34,$58,$29,$9B,$00
+L0050:
+	.byte	$65,$6D,$70,$74,$79,$20,$66,$69,$6C,$65,$6E,$61,$6D,$65,$2C,$20
+	.byte	$65,$78,$69,$74,$69,$6E,$67,$2E,$2E,$2E,$9B,$00
+L003F	:=	L0050+0
+L0020:
+	.byte	$63,$6F,$75,$6C,$64,$6E,$27,$74,$20,$66,$69,$6E,$64,$20,$61,$20
+	.byte	$66,$72,$65,$65,$20,$69,$6F,$63,$62,$9B,$00
+L006E:
+	.byte	$62,$75,$66,$66,$65,$72,$20,$73,$69,$7A,$65,$3A,$20,$25,$6C,$64
+	.byte	$20,$62,$79,$74,$65,$73,$9B,$00
+L00CD:
+	.byte	$77,$72,$69,$74,$69,$6E,$67,$20,$74,$6F,$20,$63,$61,$73,$73,$65
+	.byte	$74,$74,$65,$2E,$2E,$2E,$9B,$00
+L0085:
+	.byte	$72,$65,$61,$64,$69,$6E,$67,$20,$69,$6E,$70,$75,$74,$20,$66,$69
+	.byte	$6C,$65,$2E,$2E,$2E,$9B,$00
+L007C:
+	.byte	$63,$61,$6E,$6E,$6F,$74,$20,$6F,$70,$65,$6E,$20,$27,$25,$73,$27
+	.byte	$3A,$20,$25,$73,$9B,$00
+L00A8:
+	.byte	$66,$69,$6C,$65,$20,$73,$69,$7A,$65,$3A,$20,$25,$6C,$64,$20,$62
+	.byte	$79,$74,$65,$73,$9B,$00
+L00B0:
+	.byte	$6F,$70,$65,$6E,$69,$6E,$67,$20,$63,$61,$73,$73,$65,$74,$74,$65
+	.byte	$2E,$2E,$2E,$9B,$00
+L00A3:
+	.byte	$6E,$6F,$74,$20,$65,$6E,$6F,$75,$67,$68,$20,$6D,$65,$6D,$6F,$72
+	.byte	$79,$9B,$00
+L0091:
+	.byte	$72,$65,$61,$64,$20,$65,$72,$72,$6F,$72,$9B,$00
+L0032:
+	.byte	$9B,$66,$69,$6C,$65,$6E,$61,$6D,$65,$3A,$20,$00
+L0100:
+	.byte	$73,$75,$63,$63,$65,$73,$73,$9B,$00
+L0074:
+	.byte	$72,$62,$00
+L003A	:=	L00FB+38
+
+; ---------------------------------------------------------------
+; __near__ struct __iocb * __near__ findfreeiocb (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_findfreeiocb: near
+
+.segment	"CODE"
+
+	ldx     #$03
+	lda     #$40
+	jsr     pushax
+	jsr     decsp2
+	ldx     #$00
+	txa
+	jmp     L0104
+L0009:	ldy     #$03
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	cmp     #$FF
+	bne     L000F
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     incsp4
+L000F:	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$10
+	jsr     incaxy
+	ldy     #$02
+	jsr     staxysp
+	jsr     ldax0sp
+	jsr     incax1
+L0104:	jsr     stax0sp
+	cmp     #$08
+	txa
+	sbc     #$00
+	bvc     L000D
+	eor     #$80
+L000D:	bmi     L0009
+	ldx     #$00
+	txa
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int, __near__ __near__ unsigned char * *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldy     #$1E
+	jsr     subysp
+	ldx     #$80
+	lda     #$01
+	jsr     pushax
+	jsr     decsp6
+	jsr     _findfreeiocb
+	jsr     pushax
+	jsr     decsp2
+	jsr     _doesclrscrafterexit
+	tax
+	beq     L0018
+	lda     #<(_cgetc)
+	ldx     #>(_cgetc)
+	jsr     _atexit
+L0018:	ldy     #$03
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	bne     L001C
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(L0020)
+	ldx     #>(L0020)
+	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	ldx     #$00
+	lda     #$01
+	jmp     L0014
+L001C:	iny
+	jsr     ldaxysp
+	sec
+	sbc     #$40
+	pha
+	txa
+	sbc     #$03
+	tax
+	pla
+	jsr     asrax4
+	jsr     aslax4
+	jsr     stax0sp
+	lda     _verbose
+	ora     _verbose+1
+	beq     L0027
+	lda     #<(L002A)
+	ldx     #>(L002A)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _printf
+L0027:	ldy     #$2D
+	jsr     ldaxysp
+	cmp     #$02
+	txa
+	sbc     #$00
+	bvc     L0030
+	eor     #$80
+L0030:	jpl     L002E
+	lda     #<(L0032)
+	ldx     #>(L0032)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	lda     #$12
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$13
+	jsr     pusha0
+	lda     _stdin
+	ldx     _stdin+1
+	jsr     _fgets
+	ldy     #$26
+	jsr     staxysp
+	lda     #<(L003A)
+	ldx     #>(L003A)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldy     #$27
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	bne     L003C
+	lda     #<(L003F)
+	ldx     #>(L003F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0014
+L003C:	iny
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	beq     L0042
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$29
+	jsr     ldaxysp
+	jsr     _strlen
+	jsr     tosaddax
+	jsr     decax1
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	cmp     #$9B
+	bne     L0042
+	ldy     #$29
+	jsr     pushwysp
+	ldy     #$29
+	jsr     ldaxysp
+	jsr     _strlen
+	jsr     tosaddax
+	jsr     decax1
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+L0042:	ldy     #$27
+	jsr     ldaxysp
+	jsr     _strlen
+	stx     tmp1
+	ora     tmp1
+	bne     L004C
+	lda     #<(L0050)
+	ldx     #>(L0050)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     L0014
+L004C:	ldy     #$27
+	jsr     ldaxysp
+	jmp     L010A
+L002E:	ldy     #$2B
+	jsr     ldaxysp
+	jsr     incax2
+	jsr     ldaxi
+L010A:	ldy     #$28
+	jsr     staxysp
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     _malloc
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$0F
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	bne     L0063
+	jsr     __heapmaxavail
+	ldy     #$0A
+	jsr     staxysp
+	jsr     _malloc
+	ldy     #$0E
+	jsr     staxysp
+	ldy     #$0F
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	bne     L0063
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(L0067)
+	ldx     #>(L0067)
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$08
+	jsr     _fprintf
+	ldx     #$00
+	lda     #$01
+	jmp     L0014
+L0063:	lda     _verbose
+	ora     _verbose+1
+	beq     L006B
+	lda     #<(L006E)
+	ldx     #>(L006E)
+	jsr     pushax
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+L006B:	ldy     #$2B
+	jsr     pushwysp
+	lda     #<(L0074)
+	ldx     #>(L0074)
+	jsr     _fopen
+	ldy     #$10
+	jsr     staxysp
+	ldy     #$11
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	bne     L0076
+	dey
+	jsr     ldaxysp
+	jsr     _free
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(L007C)
+	ldx     #>(L007C)
+	jsr     pushax
+	ldy     #$2F
+	jsr     pushwysp
+	lda     __errno
+	ldx     __errno+1
+	jsr     _strerror
+	jsr     pushax
+	ldy     #$08
+	jsr     _fprintf
+	ldx     #$00
+	lda     #$01
+	jmp     L0014
+L0076:	lda     _verbose
+	ora     _verbose+1
+	beq     L0082
+	lda     #<(L0085)
+	ldx     #>(L0085)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L0082:	ldy     #$11
+	jsr     pushwysp
+	lda     #$01
+	jsr     pusha0
+	ldy     #$11
+	jsr     pushwysp
+	ldy     #$17
+	jsr     ldaxysp
+	jsr     _fread
+	ldy     #$0C
+	jsr     staxysp
+	ldy     #$0D
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	bne     L008D
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(L0091)
+	ldx     #>(L0091)
+L010C:	jsr     pushax
+	ldy     #$04
+	jsr     _fprintf
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     _fclose
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     _free
+	ldx     #$00
+	lda     #$01
+	jmp     L0014
+L008D:	iny
+	jsr     ldaxysp
+	jsr     axulong
+	cmp     #$00
+	txa
+	sbc     #$80
+	lda     sreg
+	sbc     #$00
+	lda     sreg+1
+	sbc     #$00
+	bcc     L0099
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(L009D)
+	ldx     #>(L009D)
+	jmp     L010C
+L0099:	ldy     #$0F
+	jsr     pushwysp
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     tosicmp
+	bne     L009F
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(L00A3)
+	ldx     #>(L00A3)
+	jmp     L010C
+L009F:	lda     _verbose
+	ora     _verbose+1
+	beq     L00A5
+	lda     #<(L00A8)
+	ldx     #>(L00A8)
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$06
+	jsr     _printf
+L00A5:	ldy     #$11
+	jsr     ldaxysp
+	jsr     _fclose
+	lda     _verbose
+	ora     _verbose+1
+	beq     L00AD
+	lda     #<(L00B0)
+	ldx     #>(L00B0)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L00AD:	ldy     #$03
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     #<(_C_dev)
+	ldy     #$04
+	sta     (ptr1),y
+	iny
+	lda     #>(_C_dev)
+	sta     (ptr1),y
+	ldy     #$03
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$08
+	ldy     #$0A
+	sta     (ptr1),y
+	ldy     #$03
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$80
+	ldy     #$0B
+	sta     (ptr1),y
+	ldy     #$03
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$03
+	ldy     #$02
+	sta     (ptr1),y
+	ldy     #$00
+	lda     (sp),y
+	ldy     #$05
+	sta     (sp),y
+	ldx     #$E4
+	lda     #$56
+	ldy     #$08
+	jsr     staxysp
+	lda     #$04
+	jsr     leaa0sp
+	jsr     __sys
+	ldy     #$06
+	lda     (sp),y
+	cmp     #$01
+	beq     L00C0
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(L00C4)
+	ldx     #>(L00C4)
+	jsr     pushax
+	ldy     #$0A
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$06
+	jsr     _fprintf
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     _free
+	ldx     #$00
+	lda     #$01
+	jmp     L0014
+L00C0:	lda     _verbose
+	ora     _verbose+1
+	beq     L00CA
+	lda     #<(L00CD)
+	ldx     #>(L00CD)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+L00CA:	ldy     #$03
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$0F
+	jsr     ldaxysp
+	ldy     #$04
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	ldy     #$03
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$0D
+	jsr     ldaxysp
+	ldy     #$08
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	ldy     #$03
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$0B
+	ldy     #$02
+	sta     (ptr1),y
+	ldy     #$00
+	lda     (sp),y
+	ldy     #$05
+	sta     (sp),y
+	ldx     #$E4
+	lda     #$56
+	ldy     #$08
+	jsr     staxysp
+	lda     #$04
+	jsr     leaa0sp
+	jsr     __sys
+	ldy     #$06
+	lda     (sp),y
+	cmp     #$01
+	beq     L00DB
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(L00DF)
+	ldx     #>(L00DF)
+	jsr     pushax
+	ldy     #$0A
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$06
+	jsr     _fprintf
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     _free
+	ldy     #$03
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$0C
+	ldy     #$02
+	sta     (ptr1),y
+	ldy     #$00
+	lda     (sp),y
+	ldy     #$05
+	sta     (sp),y
+	ldx     #$E4
+	lda     #$56
+	ldy     #$08
+	jsr     staxysp
+	lda     #$04
+	jsr     leaa0sp
+	jsr     __sys
+	ldx     #$00
+	lda     #$01
+	jmp     L0014
+L00DB:	ldy     #$0F
+	jsr     ldaxysp
+	jsr     _free
+	ldy     #$03
+	jsr     ldaxysp
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$0C
+	ldy     #$02
+	sta     (ptr1),y
+	ldy     #$00
+	lda     (sp),y
+	ldy     #$05
+	sta     (sp),y
+	ldx     #$E4
+	lda     #$56
+	ldy     #$08
+	jsr     staxysp
+	lda     #$04
+	jsr     leaa0sp
+	jsr     __sys
+	ldy     #$06
+	lda     (sp),y
+	cmp     #$01
+	beq     L00F7
+	lda     _stderr
+	ldx     _stderr+1
+	jsr     pushax
+	lda     #<(L00FB)
+	ldx     #>(L00FB)
+	jsr     pushax
+	ldy     #$0A
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$06
+	jsr     _fprintf
+	ldx     #$00
+	lda     #$01
+	jmp     L0014
+L00F7:	lda     #<(L0100)
+	ldx     #>(L0100)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldx     #$00
+	txa
+L0014:	ldy     #$2E
+	jmp     addysp
+
+.endproc
+
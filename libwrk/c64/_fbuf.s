@@ -0,0 +1,263 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_write
+	.import		_read
+	.import		__fbufget
+	.export		__fbufflush
+	.export		__fbuffill
+	.export		__fbufoffs
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ _fbufflush (register __near__ struct _FILE *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	__fbufflush: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$00
+	ldx     #$04
+	jsr     regswap2
+	lda     regbank+2
+	ldx     regbank+3
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     __fbufget
+	sta     regbank+2
+	stx     regbank+2+1
+	ldy     #$05
+	lda     (regbank+2),y
+	tax
+	dey
+	lda     (regbank+2),y
+	jsr     pushax
+	lda     #$00
+	ldy     #$04
+	sta     (regbank+2),y
+	iny
+	sta     (regbank+2),y
+	iny
+	sta     (regbank+2),y
+	iny
+	sta     (regbank+2),y
+	iny
+	lda     (regbank+2),y
+	ldx     #$00
+	and     #$01
+	beq     L0003
+	lda     (regbank+2),y
+	and     #$FE
+	sta     (regbank+2),y
+	lda     (sp,x)
+	ldy     #$01
+	ora     (sp),y
+	beq     L0003
+	lda     (regbank+4,x)
+	jsr     pusha0
+	ldy     #$01
+	lda     (regbank+2),y
+	tax
+	dey
+	lda     (regbank+2),y
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _write
+	ldy     #$00
+	cmp     (sp),y
+	bne     L0010
+	txa
+	iny
+	cmp     (sp),y
+	bne     L004A
+	ldx     #$00
+	jmp     L004B
+L0010:	iny
+L004A:	lda     (regbank+4),y
+	ora     #$04
+	sta     (regbank+4),y
+	ldx     #$FF
+L004B:	txa
+L0003:	pha
+	ldy     #$02
+L001B:	lda     (sp),y
+	sta     regbank+0,y
+	iny
+	cpy     #$06
+	bne     L001B
+	pla
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ _fbuffill (register __near__ struct _FILE *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	__fbuffill: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$00
+	ldx     #$04
+	jsr     regswap2
+	lda     regbank+2
+	ldx     regbank+3
+	jsr     pushax
+	jsr     decsp2
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     __fbufflush
+	cpx     #$00
+	bne     L004C
+	cmp     #$00
+	beq     L001D
+L004C:	ldx     #$FF
+	txa
+	jmp     L002B
+L001D:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     __fbufget
+	sta     regbank+2
+	stx     regbank+2+1
+	ldy     #$00
+	lda     (regbank+4),y
+	jsr     pusha0
+	ldy     #$01
+	lda     (regbank+2),y
+	tax
+	dey
+	lda     (regbank+2),y
+	jsr     pushax
+	ldy     #$03
+	lda     (regbank+2),y
+	tax
+	dey
+	lda     (regbank+2),y
+	jsr     _read
+	jsr     stax0sp
+	cpx     #$00
+	bne     L003D
+	cmp     #$00
+	beq     L0032
+	jmp     L0036
+L003D:	cpx     #$FF
+	bne     L0036
+	cmp     #$FF
+	bne     L0036
+	ldy     #$01
+	lda     (regbank+4),y
+	ora     #$04
+	sta     (regbank+4),y
+	txa
+	jmp     L002B
+L0032:	ldy     #$01
+	lda     (regbank+4),y
+	ora     #$02
+	sta     (regbank+4),y
+	dex
+	txa
+	jmp     L002B
+L0036:	jsr     ldax0sp
+	ldy     #$06
+	sta     (regbank+2),y
+	iny
+	txa
+	sta     (regbank+2),y
+	lda     #$01
+	ldy     #$04
+	sta     (regbank+2),y
+	iny
+	lda     #$00
+	sta     (regbank+2),y
+	ldy     #$01
+	lda     (regbank+2),y
+	tax
+	dey
+	lda     (regbank+2),y
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	ldx     #$00
+L002B:	pha
+	ldy     #$02
+L003E:	lda     (sp),y
+	sta     regbank+0,y
+	iny
+	cpy     #$06
+	bne     L003E
+	pla
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ _fbufoffs (__near__ struct _FILE *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	__fbufoffs: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     __fbufget
+	sta     regbank+4
+	stx     regbank+4+1
+	ldy     #$08
+	lda     (regbank+4),y
+	and     #$01
+	beq     L0042
+	ldy     #$05
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	jmp     L003F
+L0042:	ldy     #$05
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	jsr     pushax
+	ldy     #$07
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	jsr     tossubax
+L003F:	pha
+	ldy     #$00
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp4
+
+.endproc
+
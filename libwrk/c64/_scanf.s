@@ -0,0 +1,1085 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_memset
+	.import		__setjmp
+	.import		_longjmp
+	.import		__seterrno
+	.import		_isdigit
+	.import		_isspace
+	.import		_isxdigit
+	.import		_tolower
+	.export		__scanf
+
+.segment	"RODATA"
+
+_Bits:
+	.byte	$01
+	.byte	$02
+	.byte	$04
+	.byte	$08
+	.byte	$10
+	.byte	$20
+	.byte	$40
+	.byte	$80
+
+.segment	"BSS"
+
+_format:
+	.res	2,$00
+_D_:
+	.res	2,$00
+_ap:
+	.res	2,$00
+_JumpBuf:
+	.res	5,$00
+_F:
+	.res	1,$00
+_CharCount:
+	.res	2,$00
+_C:
+	.res	2,$00
+_Width:
+	.res	2,$00
+_IntVal:
+	.res	4,$00
+_Assignments:
+	.res	2,$00
+_IntBytes:
+	.res	1,$00
+_Converted:
+	.res	1,$00
+_Positive:
+	.res	1,$00
+_NoAssign:
+	.res	1,$00
+_Invert:
+	.res	1,$00
+_CharSet:
+	.res	32,$00
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ _scanf (__near__ const struct scanfdata *, __near__ const unsigned char *, __near__ unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	__scanf: near
+
+.segment	"BSS"
+
+L017E:
+	.res	1,$00
+L017F:
+	.res	1,$00
+L0180:
+	.res	1,$00
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	sta     _D_
+	stx     _D_+1
+	ldy     #$05
+	jsr     ldaxysp
+	sta     _format
+	stx     _format+1
+	ldy     #$03
+	jsr     ldaxysp
+	sta     _ap
+	stx     _ap+1
+	lda     #$00
+	sta     _Converted
+	sta     _Assignments
+	sta     _Assignments+1
+	sta     _CharCount
+	sta     _CharCount+1
+	lda     #<(_JumpBuf)
+	ldx     #>(_JumpBuf)
+	jsr     __setjmp
+	cmp     #$00
+	jne     L018D
+L0190:	jsr     _ReadChar
+	jmp     L01E6
+L0192:	lda     _F
+	cmp     #$25
+	beq     L0196
+	ldx     #$00
+	jsr     _isspace
+	tax
+	beq     L0198
+	jsr     _SkipWhite
+	jmp     L01E6
+L0198:	lda     _C
+	ldx     _C+1
+	jsr     pushax
+	lda     _F
+	jsr     tosicmp0
+	beq     L0190
+	jmp     L018D
+L0196:	jsr     _GetFormat
+	cmp     #$25
+	beq     L0198
+	lda     _F
+	cmp     #$2A
+	jsr     booleq
+	sta     _NoAssign
+	lda     _NoAssign
+	beq     L01A6
+	jsr     _GetFormat
+L01A6:	lda     #$FF
+	sta     _Width
+	sta     _Width+1
+	lda     _F
+	ldx     #$00
+	jsr     _isdigit
+	sta     L017E
+	lda     L017E
+	beq     L01B3
+	lda     #$00
+	sta     _Width
+	sta     _Width+1
+L01B2:	lda     _Width
+	ldx     _Width+1
+	jsr     mulax10
+	sta     ptr1
+	stx     ptr1+1
+	lda     _F
+	and     #$0F
+	clc
+	adc     ptr1
+	ldx     ptr1+1
+	bcc     L0319
+	inx
+L0319:	sta     _Width
+	stx     _Width+1
+	jsr     _GetFormat
+	ldx     #$00
+	jsr     _isdigit
+	tax
+	bne     L01B2
+L01B3:	lda     _Width
+	ora     _Width+1
+	bne     L01BA
+	lda     #$07
+	jsr     __seterrno
+	jmp     L0320
+L01BA:	lda     _Width
+	ldx     _Width+1
+	jsr     complax
+	sta     _Width
+	stx     _Width+1
+	lda     #$01
+	sta     _IntBytes
+	lda     _F
+	cmp     #$48
+	beq     L01CB
+	cmp     #$4A
+	beq     L0306
+	cmp     #$4C
+	beq     L01D4
+	cmp     #$54
+	beq     L01DE
+	cmp     #$5A
+	beq     L01DE
+	cmp     #$CC
+	beq     L01DE
+	jmp     L0307
+L01CB:	lda     _format
+	sta     ptr1
+	lda     _format+1
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	cmp     #$48
+	bne     L01DE
+	sty     _IntBytes
+	inc     _format
+	bne     L01DE
+	inc     _format+1
+	jmp     L01DE
+L01D4:	lda     _format
+	sta     ptr1
+	lda     _format+1
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	cmp     #$4C
+	bne     L0306
+	inc     _format
+	bne     L0306
+	inc     _format+1
+L0306:	lda     #$03
+	sta     _IntBytes
+L01DE:	jsr     _GetFormat
+L0307:	lda     _F
+	cmp     #$53
+	jeq     L01FC
+	bcs     L02F2
+	cmp     #$46
+	jeq     L02D2
+	bcs     L02F3
+	cmp     #$41
+	jeq     L02D2
+	cmp     #$43
+	jeq     L030C
+	cmp     #$44
+	beq     L01E8
+	cmp     #$45
+	jeq     L02D2
+	jmp     L02EB
+L02F3:	cmp     #$47
+	jeq     L02D2
+	cmp     #$49
+	beq     L01EE
+	cmp     #$4E
+	jeq     L02C2
+	cmp     #$4F
+	beq     L01F2
+	cmp     #$50
+	jeq     L02A8
+	jmp     L02EB
+L02F2:	cmp     #$C3
+	jeq     L02D2
+	bcs     L02F4
+	cmp     #$55
+	beq     L01E8
+	cmp     #$58
+	beq     L01F6
+	cmp     #$5B
+	jeq     L0246
+	cmp     #$C1
+	jeq     L02D2
+	jmp     L02EB
+L02F4:	cmp     #$C5
+	jeq     L02D2
+	cmp     #$C6
+	jeq     L02D2
+	cmp     #$C7
+	jeq     L02D2
+	cmp     #$D3
+	jeq     L02D2
+	cmp     #$D8
+	beq     L01F6
+	jmp     L02EB
+L01E8:	lda     #$0A
+	jsr     _ScanInt
+	jmp     L01E6
+L01EE:	lda     #$00
+	jsr     _ScanInt
+	jmp     L01E6
+L01F2:	lda     #$08
+	jsr     _ScanInt
+	jmp     L01E6
+L01F6:	lda     #$10
+	jsr     _ScanInt
+	jmp     L01E6
+L01FC:	jsr     _SkipWhite
+	jsr     _CheckEnd
+	lda     #$01
+	sta     _Converted
+	lda     _NoAssign
+	bne     L020D
+	lda     _ap
+	sec
+	sbc     #$02
+	sta     _ap
+	bcs     L020A
+	dec     _ap+1
+L020A:	ldx     _ap+1
+	jsr     ldaxi
+	sta     regbank+4
+	stx     regbank+4+1
+	jmp     L020D
+L0308:	lda     _NoAssign
+	bne     L0214
+	lda     regbank+4
+	ldx     regbank+4+1
+	sta     regsave
+	stx     regsave+1
+	jsr     incax1
+	sta     regbank+4
+	stx     regbank+4+1
+	lda     _C
+	ldy     #$00
+	sta     (regsave),y
+L0214:	jsr     _ReadChar
+L020D:	lda     _C+1
+	cmp     #$FF
+	bne     L031A
+	lda     _C
+	cmp     #$FF
+	beq     L030B
+L031A:	lda     _C
+	ldx     _C+1
+	jsr     _isspace
+	cmp     #$00
+	bne     L030B
+	inc     _Width
+	bne     L0212
+	inc     _Width+1
+L0212:	lda     _Width
+	ora     _Width+1
+	bne     L0308
+L030B:	lda     _NoAssign
+	jne     L01E6
+	tay
+	sta     (regbank+4),y
+	inc     _Assignments
+	jne     L01E6
+	inc     _Assignments+1
+	jmp     L01E6
+L030C:	lda     L017E
+	bne     L0221
+	ldx     #$FF
+	lda     #$FE
+	sta     _Width
+	stx     _Width+1
+L0221:	jsr     _CheckEnd
+	lda     #$01
+	sta     _Converted
+	lda     _NoAssign
+	bne     L0240
+	lda     _ap
+	sec
+	sbc     #$02
+	sta     _ap
+	bcs     L0231
+	dec     _ap+1
+L0231:	ldx     _ap+1
+	jsr     ldaxi
+	sta     regbank+4
+	stx     regbank+4+1
+	jmp     L0234
+L0232:	jsr     _CheckEnd
+	lda     regbank+4
+	ldx     regbank+4+1
+	sta     regsave
+	stx     regsave+1
+	jsr     incax1
+	sta     regbank+4
+	stx     regbank+4+1
+	lda     _C
+	ldy     #$00
+	sta     (regsave),y
+	jsr     _ReadChar
+L0234:	inc     _Width
+	bne     L0236
+	inc     _Width+1
+L0236:	lda     _Width
+	ora     _Width+1
+	bne     L0232
+	inc     _Assignments
+	jne     L01E6
+	inc     _Assignments+1
+	jmp     L01E6
+L023E:	jsr     _CheckEnd
+	jsr     _ReadChar
+L0240:	inc     _Width
+	bne     L0242
+	inc     _Width+1
+L0242:	lda     _Width
+	ora     _Width+1
+	bne     L023E
+	jmp     L01E6
+L0246:	lda     #<(_CharSet)
+	sta     ptr1
+	lda     #>(_CharSet)
+	sta     ptr1+1
+	lda     #$00
+	ldy     #$1F
+L02FF:	sta     (ptr1),y
+	dey
+	bpl     L02FF
+	jsr     _GetFormat
+	cmp     #$5E
+	jsr     booleq
+	sta     _Invert
+	lda     _Invert
+	beq     L030D
+	jsr     _GetFormat
+L030D:	lda     _F
+	cmp     #$5D
+	bne     L030E
+	jmp     L025D
+L0257:	lda     _format
+	sta     ptr1
+	lda     _format+1
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	cmp     #$2D
+	bne     L025D
+	lda     _F
+	sta     L0180
+	inc     _format
+	bne     L0262
+	inc     _format+1
+L0262:	jsr     _GetFormat
+	cmp     #$00
+	beq     L0267
+	cmp     #$5D
+	bne     L026F
+L0267:	lda     L0180
+	jsr     _AddCharToSet
+	lda     #$2D
+	jsr     _AddCharToSet
+	jmp     L030E
+L026F:	lda     L0180
+	jsr     _AddCharToSet
+	lda     _F
+	cmp     L0180
+	beq     L0305
+	inc     L0180
+	jmp     L026F
+L025D:	lda     _F
+	jsr     _AddCharToSet
+L0305:	jsr     _GetFormat
+L030E:	lda     _F
+	beq     L0312
+	cmp     #$5D
+	bne     L0257
+L0312:	lda     _F
+	bne     L027D
+	lda     _format
+	sec
+	sbc     #$01
+	sta     _format
+	bcs     L027D
+	dec     _format+1
+L027D:	lda     _Invert
+	beq     L031D
+	jsr     _InvertCharSet
+	lda     #$00
+L031D:	sta     L017F
+	lda     _NoAssign
+	bne     L0292
+	lda     _ap
+	sec
+	sbc     #$02
+	sta     _ap
+	bcs     L028F
+	dec     _ap+1
+L028F:	ldx     _ap+1
+	jsr     ldaxi
+	sta     regbank+4
+	stx     regbank+4+1
+	jmp     L0292
+L0313:	lda     _NoAssign
+	bne     L0314
+	lda     regbank+4
+	ldx     regbank+4+1
+	sta     regsave
+	stx     regsave+1
+	jsr     incax1
+	sta     regbank+4
+	stx     regbank+4+1
+	lda     _C
+	ldy     #$00
+	sta     (regsave),y
+L0314:	lda     #$01
+	sta     _Converted
+	sta     L017F
+	jsr     _ReadChar
+L0292:	jsr     _IsCharInSet
+	tax
+	beq     L0317
+	inc     _Width
+	bne     L0295
+	inc     _Width+1
+L0295:	lda     _Width
+	ora     _Width+1
+	bne     L0313
+L0317:	lda     L017F
+	jeq     L018D
+	lda     _NoAssign
+	jne     L01E6
+	tay
+	sta     (regbank+4),y
+	inc     _Assignments
+	jne     L01E6
+	inc     _Assignments+1
+	jmp     L01E6
+L02A8:	jsr     _SkipWhite
+	lda     _C
+	cmp     #$30
+	jne     L018D
+	lda     #$01
+	sta     _Converted
+	jsr     _ReadChar
+	lda     _C
+	cmp     #$58
+	beq     L02B7
+	cmp     #$D8
+	bne     L018D
+L02B7:	jsr     _ReadChar
+	lda     #$10
+	jsr     _ReadInt
+	jsr     _AssignInt
+	jmp     L01E6
+L02C2:	lda     _CharCount
+	ldx     _CharCount+1
+	jsr     pushax
+	lda     _C+1
+	cmp     #$FF
+	bne     L02C8
+	lda     _C
+	cmp     #$FF
+	bne     L02C8
+	lda     #$00
+	jmp     L02CA
+L02C8:	lda     #$01
+L02CA:	jsr     tossuba0
+	jsr     axulong
+	sta     _IntVal
+	stx     _IntVal+1
+	ldy     sreg
+	sty     _IntVal+2
+	ldy     sreg+1
+	sty     _IntVal+3
+	jsr     _AssignInt
+	lda     _NoAssign
+	bne     L01E6
+	lda     _Assignments
+	sec
+	sbc     #$01
+	sta     _Assignments
+	bcs     L01E6
+	dec     _Assignments+1
+	jmp     L01E6
+L02D2:	lda     #$0D
+	jsr     __seterrno
+	jmp     L0320
+L02EB:	lda     #$07
+	jsr     __seterrno
+	jmp     L0320
+L01E6:	jsr     _GetFormat
+	tax
+	jne     L0192
+	jmp     L02F6
+L018D:	lda     _C+1
+	cmp     #$FF
+	bne     L02F6
+	lda     _C
+	cmp     #$FF
+	bne     L02F6
+	lda     _Converted
+	bne     L02F6
+L0320:	lda     #$FF
+	sta     _Assignments
+	sta     _Assignments+1
+L02F6:	jsr     _PushBack
+	lda     _Assignments
+	ldx     _Assignments+1
+	pha
+	ldy     #$00
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ FindBit (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_FindBit: near
+
+.segment	"CODE"
+
+	pha
+	lsr     a
+	lsr     a
+	lsr     a
+	tax
+	pla
+	and     #$07
+	tay
+	lda     _Bits,y
+	jmp     L0010
+L0010:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ AddCharToSet (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AddCharToSet: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jsr     _FindBit
+	ora     _CharSet,x
+	sta     _CharSet,x
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ IsCharInSet (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_IsCharInSet: near
+
+.segment	"CODE"
+
+	lda     #$00
+	ldx     _C+1
+	bne     L1
+	lda     _C
+	jsr     _FindBit
+	and     _CharSet,x
+L1:	ldx     #$00
+	jmp     L002D
+L002D:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ InvertCharSet (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_InvertCharSet: near
+
+.segment	"CODE"
+
+	ldy     #$1F
+L1:	lda     _CharSet,y
+	eor     #$FF
+	sta     _CharSet,y
+	dey
+	bpl     L1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ PushBack (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_PushBack: near
+
+.segment	"CODE"
+
+	ldx     _C+1
+	bne     L0055
+	lda     _C
+	jsr     pusha0
+	lda     _D_
+	sta     ptr1
+	lda     _D_+1
+	sta     ptr1+1
+	ldy     #$02
+	lda     (ptr1),y
+	sta     jmpvec+1
+	iny
+	lda     (ptr1),y
+	sta     jmpvec+2
+	ldy     #$05
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     jmpvec
+	lda     _CharCount
+	bne     L0082
+	dec     _CharCount+1
+L0082:	dec     _CharCount
+L0055:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ ReadChar (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_ReadChar: near
+
+.segment	"CODE"
+
+	lda     _D_
+	sta     ptr1
+	lda     _D_+1
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	sta     jmpvec+1
+	iny
+	lda     (ptr1),y
+	sta     jmpvec+2
+	ldy     #$05
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     jmpvec
+	sta     _C
+	stx     _C+1
+	inx
+	beq     L00B6
+	inc     _CharCount
+	bne     L00B6
+	inc     _CharCount+1
+L00B6:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ Error (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_Error: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	pha
+	lda     #<(_JumpBuf)
+	ldx     #>(_JumpBuf)
+	jsr     pushax
+	pla
+	ldx     #>$0000
+	jmp     _longjmp
+	jsr     incsp1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ CheckEnd (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_CheckEnd: near
+
+.segment	"CODE"
+
+	ldx     _C+1
+	beq     L00D1
+	lda     #$02
+	jmp     _Error
+L00D1:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ SkipWhite (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_SkipWhite: near
+
+.segment	"CODE"
+
+	jmp     L00D7
+L00D5:	jsr     _ReadChar
+L00D7:	lda     _C
+	ldx     _C+1
+	jsr     _isspace
+	tax
+	bne     L00D5
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ ReadSign (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_ReadSign: near
+
+.segment	"CODE"
+
+	lda     _C
+	cmp     #'-'
+	bne     L00E3
+	sta     _Converted
+	jsr     _ReadChar
+	lda     #$00
+	beq     L00EC
+L00E3:	cmp     #'+'
+	bne     L00F1
+	sta     _Converted
+	jsr     _ReadChar
+L00F1:	lda     #$01
+L00EC:	sta     _Positive
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ __fastcall__ HexVal (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_HexVal: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldy     #$00
+	lda     (sp),y
+	ldx     #$00
+	jsr     _isdigit
+	beq     L00FE
+	ldx     #$00
+	lda     (sp,x)
+	ldy     #$30
+	jmp     L0321
+L00FE:	ldy     #$00
+	lda     (sp),y
+	ldx     #$00
+	jsr     _tolower
+	ldx     #$00
+	ldy     #$37
+L0321:	jsr     decaxy
+	ldx     #$00
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ ReadInt (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_ReadInt: near
+
+.segment	"BSS"
+
+L0105:
+	.res	1,$00
+L0106:
+	.res	1,$00
+
+.segment	"CODE"
+
+	jsr     pusha
+	lda     #$00
+	sta     L0106
+	sta     _IntVal
+	sta     _IntVal+1
+	sta     _IntVal+2
+	sta     _IntVal+3
+	jmp     L010C
+L0323:	inc     L0106
+	lda     _IntVal+3
+	sta     sreg+1
+	lda     _IntVal+2
+	sta     sreg
+	ldx     _IntVal+1
+	lda     _IntVal
+	jsr     pusheax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	jsr     aulong
+	jsr     axulong
+	jsr     tosmuleax
+	jsr     pusheax
+	ldx     #$00
+	lda     L0105
+	jsr     aulong
+	jsr     axulong
+	jsr     tosaddeax
+	sta     _IntVal
+	stx     _IntVal+1
+	ldy     sreg
+	sty     _IntVal+2
+	ldy     sreg+1
+	sty     _IntVal+3
+	jsr     _ReadChar
+L010C:	lda     _C
+	ldx     _C+1
+	jsr     _isxdigit
+	tax
+	beq     L0326
+	inc     _Width
+	bne     L0110
+	inc     _Width+1
+L0110:	lda     _Width
+	ora     _Width+1
+	beq     L0326
+	lda     _C
+	jsr     _HexVal
+	sta     L0105
+	ldy     #$00
+	cmp     (sp),y
+	txa
+	sbc     #$00
+	bcc     L0323
+L0326:	lda     L0106
+	bne     L0327
+	lda     #$01
+	jsr     _Error
+L0327:	lda     #$01
+	sta     _Converted
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ AssignInt (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_AssignInt: near
+
+.segment	"CODE"
+
+	lda     _NoAssign
+	bne     L013E
+	lda     _ap
+	sec
+	sbc     #$02
+	sta     _ap
+	bcs     L012A
+	dec     _ap+1
+L012A:	ldx     _ap+1
+	jsr     ldaxi
+	sta     ptr1
+	stx     ptr1+1
+	ldy     _IntBytes
+L0131:	lda     _IntVal,y
+	sta     (ptr1),y
+	dey
+	bpl     L0131
+	inc     _Assignments
+	bne     L013E
+	inc     _Assignments+1
+L013E:	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ ScanInt (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_ScanInt: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jsr     _SkipWhite
+	jsr     _ReadSign
+	ldy     #$00
+	lda     (sp),y
+	bne     L032B
+	lda     _C
+	cmp     #$30
+	bne     L032A
+	jsr     _ReadChar
+	lda     _C
+	cmp     #$58
+	beq     L0328
+	cmp     #$D8
+	bne     L0329
+L0328:	lda     #$10
+	ldy     #$00
+	sta     (sp),y
+	lda     #$01
+	sta     _Converted
+	jsr     _ReadChar
+	jmp     L0161
+L0329:	lda     #$08
+	ldy     #$00
+	sta     (sp),y
+	jsr     _PushBack
+	ldx     #$00
+	lda     #$30
+	sta     _C
+	stx     _C+1
+	jmp     L0161
+L032A:	lda     #$0A
+	sta     (sp),y
+L0161:	ldy     #$00
+L032B:	lda     (sp),y
+	jsr     _ReadInt
+	lda     _Positive
+	bne     L0166
+	lda     _IntVal+3
+	sta     sreg+1
+	lda     _IntVal+2
+	sta     sreg
+	ldx     _IntVal+1
+	lda     _IntVal
+	jsr     negeax
+	sta     _IntVal
+	stx     _IntVal+1
+	ldy     sreg
+	sty     _IntVal+2
+	ldy     sreg+1
+	sty     _IntVal+3
+L0166:	jsr     _AssignInt
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned char __near__ GetFormat (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_GetFormat: near
+
+.segment	"CODE"
+
+	lda     _format
+	sta     regsave
+	lda     _format+1
+	sta     regsave+1
+	inc     _format
+	bne     L0173
+	inc     _format+1
+L0173:	ldy     #0
+	lda     (regsave),y
+	ldx     #>$0000
+	sta     _F
+	rts
+
+.endproc
+
@@ -0,0 +1,135 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_malloc
+	.import		_memcpy
+	.import		_open
+	.import		__errno
+	.export		_opendir
+	.import		__dirread
+
+; ---------------------------------------------------------------
+; __near__ struct DIR * __near__ __fastcall__ opendir (register __near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_opendir: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$00
+	ldx     #$04
+	jsr     regswap2
+	jsr     decsp2
+	jsr     push0
+	ldy     #$15
+	jsr     subysp
+	lda     #$24
+	ldy     #$04
+	sta     (sp),y
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L005A
+	lda     (regbank+4,x)
+	beq     L005A
+	cmp     #$2E
+	bne     L005B
+	ldy     #$01
+	lda     (regbank+4),y
+	bne     L005B
+L005A:	ldy     #$05
+	sta     (sp),y
+	jmp     L0058
+L005B:	lda     (regbank+4,x)
+	cmp     #$30
+	beq     L0053
+	cmp     #$31
+	bne     L0057
+L0053:	ldy     #$01
+	lda     (regbank+4),y
+	cmp     #$3A
+	bne     L0057
+	iny
+	lda     (regbank+4),y
+	bne     L0057
+	lda     (regbank+4,x)
+	ldy     #$05
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	jmp     L0058
+L0057:	lda     #$07
+	jmp     L0059
+L0058:	lda     #$02
+	tay
+	jsr     staxysp
+	lda     #$04
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$04
+	jsr     _open
+	jsr     stax0sp
+	txa
+	bmi     L0046
+	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	lda     #$19
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$02
+	jsr     __dirread
+	tax
+	beq     L0046
+	ldx     #$00
+	lda     #$15
+	jsr     _malloc
+	ldy     #$15
+	jsr     staxysp
+	ldy     #$16
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L003F
+	ldy     #$18
+	jsr     pushwysp
+	lda     #$02
+	jsr     leaa0sp
+	jsr     pushax
+	ldx     #$00
+	lda     #$15
+	jsr     _memcpy
+	jmp     L0046
+L003F:	tax
+	lda     #$02
+L0059:	sta     __errno
+	stx     __errno+1
+L0046:	ldy     #$16
+	jsr     ldaxysp
+	pha
+	ldy     #$19
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	iny
+	jmp     addysp
+
+.endproc
+
@@ -0,0 +1,243 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		__errno
+	.import		__cbm_filetype
+	.export		_readdir
+	.import		__dirread
+	.import		__dirread1
+
+; ---------------------------------------------------------------
+; __near__ struct dirent * __near__ __fastcall__ readdir (register __near__ struct DIR *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_readdir: near
+
+.segment	"BSS"
+
+L0009:
+	.res	1,$00
+L000A:
+	.res	1,$00
+L000C:
+	.res	23,$00
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$00
+	ldx     #$04
+	jsr     regswap2
+	lda     regbank+2
+	ldx     regbank+3
+	jsr     pushax
+	lda     regbank+1
+	jsr     pusha
+	lda     regbank+0
+	jsr     pusha
+	ldy     #$40
+	jsr     subysp
+	ldy     #$03
+	lda     (regbank+4),y
+	sta     L000C+17+1
+	dey
+	lda     (regbank+4),y
+	sta     L000C+17
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	lda     #$02
+	jsr     leaa0sp
+	jsr     pushax
+	lda     #$02
+	jsr     __dirread
+	tax
+	jeq     L0008
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	lda     #<(L000C+19)
+	ldx     #>(L000C+19)
+	jsr     pushax
+	lda     #$02
+	jsr     __dirread
+	tax
+	jeq     L0008
+	lda     #$00
+	sta     regbank+0
+	lda     sp
+	sta     regbank+2
+	lda     sp+1
+	sta     regbank+2+1
+	jmp     L0087
+L001E:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     __dirread1
+	tax
+	jeq     L0008
+	inc     regbank+0
+	ldy     #$00
+	lda     (regbank+2),y
+	beq     L001C
+	inc     regbank+2
+	bne     L0087
+	inc     regbank+2+1
+L0087:	lda     regbank+0
+	cmp     #$40
+	bcc     L001E
+L001C:	ldy     #$03
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     regbank+0
+	jsr     incax4
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$02
+	sta     (regbank+4),y
+	iny
+	txa
+	sta     (regbank+4),y
+	ldx     #$00
+	lda     (sp,x)
+	cmp     #$42
+	jeq     L008E
+	txa
+	sta     regbank+1
+	sta     L000A
+	sta     L0009
+	lda     sp
+	sta     regbank+2
+	lda     sp+1
+	sta     regbank+2+1
+	jmp     L008D
+L0088:	lda     L0009
+	beq     L0043
+	cmp     #$01
+	beq     L0049
+	cmp     #$02
+	beq     L0064
+	cmp     #$03
+	jeq     L0071
+	jmp     L008C
+L0043:	lda     (regbank+2,x)
+	cmp     #$22
+	jne     L008C
+	lda     #$01
+	sta     L0009
+	jmp     L008C
+L0049:	ldy     #$00
+	lda     (regbank+2),y
+	cmp     #$22
+	bne     L008A
+	ldy     L000A
+	txa
+	sta     L000C,y
+	lda     L000A
+	sta     L000C+22
+	lda     L000C+17
+	cmp     #$03
+	lda     L000C+17+1
+	sbc     #$00
+	bcc     L0089
+	lda     #$02
+	sta     L0009
+	jmp     L008C
+L0089:	lda     #$05
+	sta     L000C+21
+	lda     #<(L000C)
+	ldx     #>(L000C)
+	jmp     L0008
+L008A:	lda     L000A
+	cmp     #$10
+	bcs     L008C
+	lda     #<(L000C)
+	ldx     #>(L000C)
+	clc
+	adc     L000A
+	bcc     L0060
+	inx
+L0060:	sta     ptr1
+	stx     ptr1+1
+	lda     (regbank+2),y
+	sta     (ptr1),y
+	inc     L000A
+	jmp     L008C
+L0064:	lda     (regbank+2,x)
+	cmp     #$20
+	beq     L008C
+	jsr     __cbm_filetype
+	sta     L000C+21
+	ldy     #$00
+	lda     (regbank+2),y
+	cmp     #$44
+	bne     L006A
+	lda     #$03
+	sta     L0009
+	jmp     L008C
+L006A:	lda     #<(L000C)
+	ldx     #>(L000C)
+	jmp     L0008
+L0071:	lda     (regbank+2,x)
+	cmp     #$45
+	beq     L0074
+	cmp     #$49
+	bne     L008B
+	lda     #$02
+	jmp     L0086
+L008B:	lda     #$04
+L0086:	sta     L000C+21
+L0074:	lda     #<(L000C)
+	ldx     #>(L000C)
+	jmp     L0008
+L008C:	inc     regbank+1
+	inc     regbank+2
+	bne     L0081
+	inc     regbank+2+1
+L0081:	ldx     #$00
+L008D:	lda     regbank+1
+	cmp     regbank+0
+	jcc     L0088
+	lda     #$0B
+	sta     __errno
+	stx     __errno+1
+L008E:	txa
+L0008:	pha
+	stx     tmp1
+	ldy     #$45
+	ldx     #$05
+L0085:	lda     (sp),y
+	sta     regbank+0,x
+	dey
+	dex
+	bpl     L0085
+	ldx     tmp1
+	pla
+	ldy     #$46
+	jmp     addysp
+
+.endproc
+
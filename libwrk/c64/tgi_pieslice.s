@@ -0,0 +1,102 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_tgi_line
+	.import		_tgi_arc
+	.export		_tgi_pieslice
+	.import		_tgi_imulround
+	.import		_cc65_sin
+	.import		_cc65_cos
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ tgi_pieslice (int, int, unsigned char, unsigned char, unsigned int, unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_tgi_pieslice: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$09
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$09
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     _tgi_arc
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     pushwysp
+	ldy     #$0B
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     _cc65_cos
+	jsr     _tgi_imulround
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$0F
+	jsr     pushwysp
+	ldy     #$0C
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     _cc65_sin
+	jsr     _tgi_imulround
+	jsr     tossubax
+	jsr     _tgi_line
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     pushwysp
+	ldy     #$0B
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     _cc65_cos
+	jsr     _tgi_imulround
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$0F
+	jsr     pushwysp
+	ldy     #$0C
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     _cc65_sin
+	jsr     _tgi_imulround
+	jsr     tossubax
+	jsr     _tgi_line
+	ldy     #$0A
+	jmp     addysp
+
+.endproc
+
@@ -0,0 +1,254 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_memchr
+	.import		_memcpy
+	.import		_write
+	.import		__fbufget
+	.import		__fbufflush
+	.export		__fbufwrite
+
+; ---------------------------------------------------------------
+; unsigned int __near__ __fastcall__ _fbufwrite (__near__ const void *, unsigned int, unsigned int, register __near__ struct _FILE *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	__fbufwrite: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$00
+	ldx     #$04
+	jsr     regswap2
+	lda     regbank+2
+	ldx     regbank+3
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+0
+	ldx     regbank+1
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     __fbufget
+	sta     regbank+0
+	stx     regbank+0+1
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     tosumulax
+	jsr     pushax
+	jsr     decsp2
+	ldy     #$08
+	lda     (regbank+0),y
+	and     #$01
+	jne     L002F
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     __fbufflush
+	jmp     L002F
+L000E:	ldy     #$05
+	lda     (regbank+0),y
+	tax
+	dey
+	lda     (regbank+0),y
+	cpx     #$00
+	bne     L0012
+	cmp     #$00
+	bne     L0012
+	iny
+	jsr     pushwysp
+	ldy     #$03
+	lda     (regbank+0),y
+	tax
+	dey
+	lda     (regbank+0),y
+	jsr     tosicmp
+	bcc     L0012
+	ldy     #$00
+	lda     (regbank+4),y
+	jsr     pusha0
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _write
+	ldy     #$02
+	cmp     (sp),y
+	jne     L001C
+	txa
+	iny
+	cmp     (sp),y
+	jeq     L000F
+	jmp     L001C
+L0012:	ldy     #$03
+	lda     (regbank+0),y
+	tax
+	dey
+	lda     (regbank+0),y
+	jsr     pushax
+	ldy     #$05
+	lda     (regbank+0),y
+	tax
+	dey
+	lda     (regbank+0),y
+	jsr     tossubax
+	jsr     stax0sp
+	sec
+	ldy     #$02
+	sbc     (sp),y
+	sta     tmp1
+	txa
+	iny
+	sbc     (sp),y
+	ora     tmp1
+	bcc     L001F
+	beq     L001F
+	jsr     ldaxysp
+	jsr     stax0sp
+L001F:	ldy     #$01
+	lda     (regbank+0),y
+	tax
+	dey
+	lda     (regbank+0),y
+	jsr     pushax
+	ldy     #$05
+	lda     (regbank+0),y
+	tax
+	dey
+	lda     (regbank+0),y
+	jsr     tosaddax
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _memcpy
+	ldy     #$08
+	lda     (regbank+0),y
+	ora     #$01
+	sta     (regbank+0),y
+	lda     regbank+0
+	ldx     regbank+0+1
+	jsr     pushax
+	ldy     #$05
+	lda     (regbank+0),y
+	tax
+	dey
+	lda     (regbank+0),y
+	sta     ptr1
+	stx     ptr1+1
+	dey
+	jsr     ldaxysp
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$04
+	jsr     staxspidx
+	jsr     ldax0sp
+	clc
+	adc     regbank+2
+	sta     regbank+2
+	txa
+	adc     regbank+2+1
+	sta     regbank+2+1
+	jsr     ldax0sp
+	ldy     #$02
+	jsr     subeqysp
+	ldy     #$05
+	lda     (regbank+0),y
+	tax
+	dey
+	lda     (regbank+0),y
+	jsr     pushax
+	ldy     #$03
+	lda     (regbank+0),y
+	tax
+	dey
+	lda     (regbank+0),y
+	jsr     tosicmp
+	bne     L002F
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     __fbufflush
+	cpx     #$00
+	bne     L004C
+	cmp     #$00
+	bne     L004D
+L002F:	ldy     #$03
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jne     L000E
+L000F:	ldy     #$08
+	lda     (regbank+0),y
+	and     #$02
+	beq     L0036
+	lda     (regbank+0),y
+	and     #$01
+	beq     L0036
+	ldy     #$11
+	jsr     pushwysp
+	lda     #$0A
+	jsr     pusha0
+	ldy     #$13
+	jsr     pushwysp
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     tosumulax
+	jsr     _memchr
+	stx     tmp1
+	ora     tmp1
+	beq     L0036
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     __fbufflush
+	cpx     #$00
+	bne     L004C
+	cmp     #$00
+	bne     L004D
+L0036:	ldy     #$0B
+	jsr     ldaxysp
+	jmp     L0003
+L001C:	ldy     #$01
+	lda     (regbank+4),y
+	ora     #$04
+	sta     (regbank+4),y
+L004C:	ldx     #$00
+L004D:	txa
+L0003:	pha
+	stx     tmp1
+	ldy     #$09
+	ldx     #$05
+L0046:	lda     (sp),y
+	sta     regbank+0,x
+	dey
+	dex
+	bpl     L0046
+	ldx     tmp1
+	pla
+	ldy     #$10
+	jmp     addysp
+
+.endproc
+
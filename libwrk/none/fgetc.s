@@ -0,0 +1,96 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.export		_fgetc
+	.import		_read
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ fgetc (register __near__ struct _FILE *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fgetc: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$00
+	ldx     #$04
+	jsr     regswap2
+	jsr     decsp1
+	ldy     #$01
+	lda     (regbank+4),y
+	and     #$01
+	beq     L0025
+	lda     (regbank+4),y
+	and     #$06
+	beq     L0027
+L0025:	ldx     #$FF
+	txa
+	jmp     L0016
+L0027:	lda     (regbank+4),y
+	and     #$08
+	beq     L000C
+	lda     (regbank+4),y
+	and     #$F7
+	sta     (regbank+4),y
+	iny
+	ldx     #$00
+	lda     (regbank+4),y
+	jmp     L0016
+L000C:	dey
+	lda     (regbank+4),y
+	jsr     pusha0
+	lda     #$02
+	jsr     leaa0sp
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     _read
+	cpx     #$00
+	bne     L0023
+	cmp     #$00
+	beq     L001D
+	jmp     L0021
+L0023:	cpx     #$FF
+	bne     L0021
+	cmp     #$FF
+	bne     L0021
+	ldy     #$01
+	lda     (regbank+4),y
+	ora     #$04
+	sta     (regbank+4),y
+	txa
+	jmp     L0016
+L001D:	ldy     #$01
+	lda     (regbank+4),y
+	ora     #$02
+	sta     (regbank+4),y
+	dex
+	txa
+	jmp     L0016
+L0021:	ldy     #$00
+	lda     (sp),y
+	ldx     #$00
+L0016:	pha
+	ldy     #$01
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp3
+
+.endproc
+
@@ -0,0 +1,284 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_memcpy
+	.import		_read
+	.import		__fbufget
+	.import		__fbufflush
+	.import		__fbuffill
+	.export		__fbufread
+
+; ---------------------------------------------------------------
+; unsigned int __near__ __fastcall__ _fbufread (__near__ void *, unsigned int, unsigned int, register __near__ struct _FILE *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	__fbufread: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$00
+	ldx     #$04
+	jsr     regswap2
+	lda     regbank+2
+	ldx     regbank+3
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     regbank+0
+	ldx     regbank+1
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     __fbufget
+	sta     regbank+0
+	stx     regbank+0+1
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     tosumulax
+	jsr     pushax
+	jsr     decsp4
+	ldy     #$04
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0008
+	ldy     #$0D
+	jsr     ldaxysp
+	jmp     L0003
+L0008:	ldy     #$08
+	lda     (regbank+0),y
+	and     #$01
+	beq     L000C
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     __fbufflush
+	cpx     #$00
+	bne     L000D
+	cmp     #$00
+	beq     L000C
+L000D:	ldx     #$00
+	txa
+	jmp     L0003
+L000C:	ldy     #$01
+	lda     (regbank+4),y
+	and     #$08
+	jeq     L004F
+	lda     (regbank+4),y
+	and     #$F7
+	sta     (regbank+4),y
+	lda     regbank+2
+	ldx     regbank+2+1
+	sta     regsave
+	stx     regsave+1
+	jsr     incax1
+	sta     regbank+2
+	stx     regbank+2+1
+	iny
+	lda     (regbank+4),y
+	ldy     #$00
+	jmp     L005D
+L001B:	ldy     #$07
+	lda     (regbank+0),y
+	tax
+	dey
+	lda     (regbank+0),y
+	jsr     pushax
+	ldy     #$05
+	lda     (regbank+0),y
+	tax
+	dey
+	lda     (regbank+0),y
+	jsr     tossubax
+	ldy     #$02
+	jsr     staxysp
+	ldy     #$03
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0021
+	iny
+	jsr     ldaxysp
+	sec
+	ldy     #$04
+	sbc     (sp),y
+	sta     tmp1
+	txa
+	iny
+	sbc     (sp),y
+	ora     tmp1
+	bcc     L0023
+	beq     L0023
+	jsr     ldaxysp
+	ldy     #$02
+	jsr     staxysp
+L0023:	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$01
+	lda     (regbank+0),y
+	tax
+	dey
+	lda     (regbank+0),y
+	jsr     pushax
+	ldy     #$05
+	lda     (regbank+0),y
+	tax
+	dey
+	lda     (regbank+0),y
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _memcpy
+	lda     regbank+0
+	ldx     regbank+0+1
+	jsr     pushax
+	ldy     #$05
+	lda     (regbank+0),y
+	tax
+	dey
+	lda     (regbank+0),y
+	sta     ptr1
+	stx     ptr1+1
+	iny
+	jsr     ldaxysp
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	ldy     #$04
+	jsr     staxspidx
+	dey
+	jsr     ldaxysp
+	clc
+	adc     regbank+2
+	sta     regbank+2
+	txa
+	adc     regbank+2+1
+	sta     regbank+2+1
+	ldy     #$03
+	jsr     ldaxysp
+	jmp     L005A
+L0021:	ldy     #$07
+	jsr     pushwysp
+	ldy     #$03
+	lda     (regbank+0),y
+	tax
+	dey
+	lda     (regbank+0),y
+	jsr     tosicmp
+	bcc     L0031
+	ldy     #$00
+	lda     (regbank+4),y
+	jsr     pusha0
+	lda     regbank+2
+	ldx     regbank+2+1
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     _read
+	jsr     stax0sp
+	cpx     #$00
+	bne     L0043
+	cmp     #$00
+	beq     L0040
+	jmp     L0039
+L0043:	cpx     #$FF
+	bne     L0039
+	cmp     #$FF
+	bne     L0039
+	ldy     #$01
+	lda     (regbank+4),y
+	ora     #$04
+	sta     (regbank+4),y
+	jmp     L001C
+L0040:	ldy     #$01
+	lda     (regbank+4),y
+	ora     #$02
+	sta     (regbank+4),y
+	jmp     L001C
+L0039:	jsr     ldax0sp
+	clc
+	adc     regbank+2
+	sta     regbank+2
+	txa
+	adc     regbank+2+1
+	sta     regbank+2+1
+	jsr     ldax0sp
+	jmp     L005A
+L0031:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     __fbuffill
+	jsr     stax0sp
+	cpx     #$FF
+	bne     L0059
+	cmp     #$FF
+	beq     L001C
+L0059:	lda     regbank+2
+	ldx     regbank+2+1
+	sta     regsave
+	stx     regsave+1
+	jsr     incax1
+	sta     regbank+2
+	stx     regbank+2+1
+	ldy     #$00
+	lda     (sp),y
+L005D:	sta     (regsave),y
+	ldx     #$00
+	lda     #$01
+L005A:	ldy     #$04
+	jsr     subeqysp
+L004F:	ldy     #$05
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jne     L001B
+L001C:	lda     regbank+2
+	sec
+	ldy     #$10
+	sbc     (sp),y
+	pha
+	lda     regbank+2+1
+	iny
+	sbc     (sp),y
+	tax
+	pla
+	jsr     pushax
+	ldy     #$11
+	jsr     ldaxysp
+	jsr     tosudivax
+L0003:	pha
+	stx     tmp1
+	ldy     #$0B
+	ldx     #$05
+L0055:	lda     (sp),y
+	sta     regbank+0,x
+	dey
+	dex
+	bpl     L0055
+	ldx     tmp1
+	pla
+	ldy     #$12
+	jmp     addysp
+
+.endproc
+
@@ -0,0 +1,149 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.export		_fgetc
+	.import		_read
+	.import		__fbuffill
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ fgetc (register __near__ struct _FILE *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fgetc: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$00
+	ldx     #$04
+	jsr     regswap2
+	jsr     decsp1
+	ldy     #$01
+	lda     (regbank+4),y
+	and     #$01
+	beq     L002D
+	lda     (regbank+4),y
+	and     #$06
+	beq     L002F
+L002D:	ldx     #$FF
+	txa
+	jmp     L001E
+L002F:	lda     (regbank+4),y
+	and     #$08
+	beq     L000C
+	lda     (regbank+4),y
+	and     #$F7
+	sta     (regbank+4),y
+	iny
+	ldx     #$00
+	lda     (regbank+4),y
+	jmp     L001E
+L000C:	lda     regbank+4
+	ldx     regbank+4+1
+	ldy     #$03
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	beq     L0011
+	ldy     #$08
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	jsr     pushax
+	ldy     #$0A
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	jsr     tosicmp
+	bcs     L0013
+	ldy     #$04
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	jsr     pushax
+	ldy     #$08
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	sta     regsave
+	stx     regsave+1
+	jsr     incax1
+	sta     (regbank+4),y
+	iny
+	txa
+	sta     (regbank+4),y
+	lda     regsave
+	ldx     regsave+1
+	jsr     tosaddax
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1,x)
+	jmp     L001E
+L0013:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     __fbuffill
+	jmp     L001E
+L0011:	tay
+	lda     (regbank+4),y
+	jsr     pusha0
+	lda     #$02
+	jsr     leaa0sp
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     _read
+	cpx     #$00
+	bne     L002B
+	cmp     #$00
+	beq     L0025
+	jmp     L0029
+L002B:	cpx     #$FF
+	bne     L0029
+	cmp     #$FF
+	bne     L0029
+	ldy     #$01
+	lda     (regbank+4),y
+	ora     #$04
+	sta     (regbank+4),y
+	txa
+	jmp     L001E
+L0025:	ldy     #$01
+	lda     (regbank+4),y
+	ora     #$02
+	sta     (regbank+4),y
+	dex
+	txa
+	jmp     L001E
+L0029:	ldy     #$00
+	lda     (sp),y
+	ldx     #$00
+L001E:	pha
+	ldy     #$01
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp3
+
+.endproc
+
@@ -0,0 +1,148 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.export		_fputc
+	.import		_write
+	.import		__fbufflush
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ fputc (int, register __near__ struct _FILE *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fputc: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$00
+	ldx     #$04
+	jsr     regswap2
+	ldy     #$01
+	lda     (regbank+4),y
+	and     #$01
+	jeq     L000B
+	lda     (regbank+4),y
+	and     #$06
+	jne     L000B
+	lda     regbank+4
+	ldx     regbank+4+1
+	ldy     #$03
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L000C
+	ldy     #$01
+	lda     (regbank+4),y
+	and     #$10
+	bne     L000E
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     __fbufflush
+	ldy     #$01
+	lda     (regbank+4),y
+	ora     #$10
+	sta     (regbank+4),y
+L000E:	ldy     #$04
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	jsr     pushax
+	ldy     #$08
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	sta     regsave
+	stx     regsave+1
+	jsr     incax1
+	sta     (regbank+4),y
+	iny
+	txa
+	sta     (regbank+4),y
+	lda     regsave
+	ldx     regsave+1
+	jsr     tosaddax
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$02
+	lda     (sp),y
+	ldy     #$00
+	sta     (ptr1),y
+	ldy     #$08
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	jsr     pushax
+	ldy     #$06
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	jsr     tosicmp
+	beq     L0039
+	ldy     #$01
+	lda     (regbank+4),y
+	ldx     #$00
+	and     #$20
+	beq     L0026
+	iny
+	lda     (sp),y
+	cmp     #$0A
+	bne     L003D
+L0039:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     __fbufflush
+	cpx     #$00
+	bne     L000B
+	cmp     #$00
+	bne     L000B
+	jmp     L0026
+L000C:	tay
+	lda     (regbank+4),y
+	jsr     pusha0
+	lda     #$04
+	jsr     leaa0sp
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     _write
+	cpx     #$00
+	bne     L003C
+	cmp     #$01
+	beq     L0026
+L003C:	ldy     #$01
+	lda     (regbank+4),y
+	ora     #$04
+	sta     (regbank+4),y
+L000B:	ldx     #$FF
+	txa
+	jmp     L0002
+L0026:	ldy     #$02
+L003D:	lda     (sp),y
+L0002:	pha
+	ldy     #$00
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp4
+
+.endproc
+
@@ -0,0 +1,91 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.export		_fputs
+	.import		_strlen
+	.import		_write
+	.import		__fbufvwrite
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ fputs (__near__ const unsigned char *, register __near__ struct _FILE *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fputs: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$00
+	ldx     #$04
+	jsr     regswap2
+	jsr     decsp2
+	ldy     #$01
+	lda     (regbank+4),y
+	and     #$01
+	beq     L0020
+	lda     (regbank+4),y
+	and     #$06
+	beq     L0004
+L0020:	ldx     #$FF
+	txa
+	jmp     L0003
+L0004:	ldy     #$05
+	jsr     ldaxysp
+	jsr     _strlen
+	jsr     stax0sp
+	ldy     #$01
+	lda     (regbank+4),y
+	and     #$80
+	beq     L0010
+	ldy     #$07
+	jsr     pushwysp
+	lda     #$01
+	jsr     pusha0
+	ldy     #$07
+	jsr     pushwysp
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     __fbufvwrite
+	ldy     #$00
+	cmp     (sp),y
+	bne     L0017
+	txa
+	iny
+	cmp     (sp),y
+	bne     L0017
+	jsr     ldax0sp
+	jmp     L0003
+L0017:	ldx     #$FF
+	txa
+	jmp     L0003
+L0010:	dey
+	lda     (regbank+4),y
+	jsr     pusha0
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _write
+L0003:	pha
+	ldy     #$02
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp6
+
+.endproc
+
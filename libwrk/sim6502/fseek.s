@@ -0,0 +1,102 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.export		_fseek
+	.import		__seterrno
+	.import		_lseek
+	.import		__fbufvflush
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ fseek (register __near__ struct _FILE *, long, int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fseek: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$06
+	ldx     #$04
+	jsr     regswap2
+	jsr     decsp4
+	ldy     #$01
+	lda     (regbank+4),y
+	and     #$01
+	bne     L002B
+	lda     #$07
+	jsr     __seterrno
+	jmp     L0031
+L002B:	lda     (regbank+4),y
+	and     #$08
+	beq     L0032
+	ldy     #$04
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L000B
+	tax
+	sta     sreg
+	sta     sreg+1
+	lda     #$01
+	iny
+	jsr     lsubeqysp
+L000B:	ldy     #$01
+L0032:	lda     (regbank+4),y
+	and     #$80
+	beq     L0012
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     __fbufvflush
+	cpx     #$00
+	bne     L0031
+	cmp     #$00
+	bne     L0031
+L0012:	tay
+	lda     (regbank+4),y
+	jsr     pusha0
+	ldy     #$0B
+	jsr     ldeaxysp
+	jsr     pusheax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     _lseek
+	jsr     steax0sp
+	jsr     ldeax0sp
+	lda     sreg+1
+	bmi     L001F
+	ldy     #$01
+	lda     (regbank+4),y
+	and     #$F5
+	sta     (regbank+4),y
+	ldx     #$00
+	jmp     L0033
+L001F:	ldy     #$01
+	lda     (regbank+4),y
+	ora     #$04
+	sta     (regbank+4),y
+L0031:	ldx     #$FF
+L0033:	txa
+	pha
+	ldy     #$0A
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	iny
+	jmp     addysp
+
+.endproc
+
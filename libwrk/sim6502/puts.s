@@ -0,0 +1,96 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_stdout
+	.export		_puts
+	.import		_strlen
+	.import		_write
+	.import		__fbufvflush
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ puts (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_puts: near
+
+.segment	"DATA"
+
+L0004:
+	.byte	$0A
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     _stdout
+	sta     ptr1
+	lda     _stdout+1
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	and     #$80
+	beq     L001A
+	lda     _stdout
+	ldx     _stdout+1
+	jsr     __fbufvflush
+	cpx     #$00
+	bne     L001E
+	cmp     #$00
+	bne     L001E
+L001A:	lda     _stdout
+	sta     ptr1
+	lda     _stdout+1
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	jsr     pusha0
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _strlen
+	jsr     _write
+	cpx     #$80
+	bcs     L001E
+	lda     _stdout
+	sta     ptr1
+	lda     _stdout+1
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	jsr     pusha0
+	lda     #<(L0004)
+	ldx     #>(L0004)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     _write
+	cpx     #$80
+	bcs     L001E
+	ldx     #$00
+	txa
+	jmp     incsp2
+L001E:	lda     _stdout
+	sta     ptr1
+	lda     _stdout+1
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	ora     #$04
+	sta     (ptr1),y
+	ldx     #$FF
+	txa
+	jmp     incsp2
+
+.endproc
+
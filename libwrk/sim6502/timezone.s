@@ -0,0 +1,24 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.export		__tz
+
+.segment	"DATA"
+
+__tz:
+	.byte	$00
+	.dword	$00000000
+	.byte	$55,$54,$43,$00
+	.res	1,$00
+	.byte	$55,$54,$43,$00
+	.res	1,$00
+
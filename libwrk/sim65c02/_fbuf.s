@@ -0,0 +1,300 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_write
+	.import		_read
+	.import		_lseek
+	.import		__fbufget
+	.export		__fbufflush
+	.export		__fbuffill
+	.export		__fbufoffs
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ _fbufflush (register __near__ struct _FILE *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	__fbufflush: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$00
+	ldx     #$04
+	jsr     regswap2
+	lda     regbank+2
+	ldx     regbank+3
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     __fbufget
+	sta     regbank+2
+	stx     regbank+2+1
+	ldy     #$05
+	lda     (regbank+2),y
+	tax
+	dey
+	lda     (regbank+2),y
+	jsr     pushax
+	ldy     #$07
+	lda     (regbank+2),y
+	tax
+	dey
+	lda     (regbank+2),y
+	jsr     pushax
+	lda     #$00
+	ldy     #$04
+	sta     (regbank+2),y
+	iny
+	sta     (regbank+2),y
+	iny
+	sta     (regbank+2),y
+	iny
+	sta     (regbank+2),y
+	iny
+	lda     (regbank+2),y
+	and     #$01
+	beq     L000C
+	ldx     #$00
+	lda     (regbank+2),y
+	and     #$FE
+	sta     (regbank+2),y
+	ldy     #$02
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	beq     L0003
+	lda     (regbank+4)
+	jsr     pusha0
+	ldy     #$01
+	lda     (regbank+2),y
+	tax
+	lda     (regbank+2)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _write
+	ldy     #$02
+	cmp     (sp),y
+	bne     L0011
+	txa
+	iny
+	cmp     (sp),y
+	beq     L001E
+L0011:	ldy     #$01
+	lda     (regbank+4),y
+	ora     #$04
+	sta     (regbank+4),y
+	ldx     #$FF
+	bra     L0057
+L000C:	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosicmp
+	bcs     L001E
+	lda     (regbank+4)
+	jsr     pusha0
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     axulong
+	jsr     tossubeax
+	jsr     pusheax
+	ldx     #$00
+	txa
+	jsr     _lseek
+	lda     sreg+1
+	asl     a
+	lda     #$00
+	tax
+	bcc     L0003
+	ldy     #$01
+	lda     (regbank+4),y
+	ora     #$04
+	sta     (regbank+4),y
+	dex
+	bra     L0057
+L001E:	ldx     #$00
+L0057:	txa
+L0003:	pha
+	stx     tmp1
+	ldy     #$07
+	ldx     #$03
+L0027:	lda     (sp),y
+	sta     regbank+2,x
+	dey
+	dex
+	bpl     L0027
+	ldx     tmp1
+	pla
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ _fbuffill (register __near__ struct _FILE *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	__fbuffill: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$00
+	ldx     #$04
+	jsr     regswap2
+	lda     regbank+2
+	ldx     regbank+3
+	jsr     pushax
+	jsr     decsp2
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     __fbufflush
+	cpx     #$00
+	bne     L0058
+	cmp     #$00
+	beq     L0029
+L0058:	ldx     #$FF
+	txa
+	bra     L0037
+L0029:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     __fbufget
+	sta     regbank+2
+	stx     regbank+2+1
+	lda     (regbank+4)
+	jsr     pusha0
+	ldy     #$01
+	lda     (regbank+2),y
+	tax
+	lda     (regbank+2)
+	jsr     pushax
+	ldy     #$03
+	lda     (regbank+2),y
+	tax
+	dey
+	lda     (regbank+2),y
+	jsr     _read
+	jsr     stax0sp
+	cpx     #$00
+	bne     L0049
+	cmp     #$00
+	beq     L003E
+	bra     L0042
+L0049:	cpx     #$FF
+	bne     L0042
+	cmp     #$FF
+	bne     L0042
+	ldy     #$01
+	lda     (regbank+4),y
+	ora     #$04
+	sta     (regbank+4),y
+	txa
+	bra     L0037
+L003E:	ldy     #$01
+	lda     (regbank+4),y
+	ora     #$02
+	sta     (regbank+4),y
+	dex
+	txa
+	bra     L0037
+L0042:	jsr     ldax0sp
+	ldy     #$06
+	sta     (regbank+2),y
+	iny
+	txa
+	sta     (regbank+2),y
+	lda     #$01
+	ldy     #$04
+	sta     (regbank+2),y
+	iny
+	dea
+	sta     (regbank+2),y
+	ldy     #$01
+	lda     (regbank+2),y
+	tax
+	lda     (regbank+2)
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	ldx     #$00
+L0037:	pha
+	ldy     #$02
+L004A:	lda     (sp),y
+	sta     regbank+0,y
+	iny
+	cpy     #$06
+	bne     L004A
+	pla
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ _fbufoffs (__near__ struct _FILE *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	__fbufoffs: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     __fbufget
+	sta     regbank+4
+	stx     regbank+4+1
+	ldy     #$08
+	lda     (regbank+4),y
+	and     #$01
+	beq     L004E
+	ldy     #$05
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	bra     L004B
+L004E:	ldy     #$05
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	jsr     pushax
+	ldy     #$07
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	jsr     tossubax
+L004B:	pha
+	lda     (sp)
+	sta     regbank+4
+	ldy     #$01
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp4
+
+.endproc
+
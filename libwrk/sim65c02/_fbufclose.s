@@ -0,0 +1,141 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_fclose
+	.import		_free
+	.import		__fbufget
+	.import		__fbufflush
+	.export		__fbufrelease
+	.export		__fbufclose
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ _fbufrelease (register __near__ struct _FILE *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	__fbufrelease: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$00
+	ldx     #$04
+	jsr     regswap2
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     __fbufflush
+	jsr     pushax
+	lda     regbank+2
+	ldx     regbank+3
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     __fbufget
+	sta     regbank+2
+	stx     regbank+2+1
+	ldy     #$08
+	lda     (regbank+2),y
+	and     #$04
+	beq     L0025
+	ldy     #$01
+	lda     (regbank+2),y
+	tax
+	lda     (regbank+2)
+	jsr     _free
+	lda     #$00
+	ldy     #$08
+L0025:	sta     (regbank+2),y
+	ldy     #$01
+	lda     (regbank+4),y
+	and     #$7F
+	sta     (regbank+4),y
+	ldy     #$03
+	jsr     ldaxysp
+	pha
+	ldy     #$04
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	lda     (sp)
+	sta     regbank+2
+	ldy     #$01
+	lda     (sp),y
+	sta     regbank+3
+	pla
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ _fbufclose (__near__ struct _FILE *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	__fbufclose: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     __fbufget
+	sta     regbank+4
+	stx     regbank+4+1
+	jsr     decsp2
+	ldy     #$08
+	lda     (regbank+4),y
+	and     #$01
+	bne     L0014
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	ldy     #$05
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	ldy     #$06
+	jsr     staxspidx
+L0014:	ldy     #$05
+	jsr     ldaxysp
+	jsr     __fbufrelease
+	jsr     stax0sp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fclose
+	cpx     #$00
+	bne     L0026
+	cmp     #$00
+	beq     L001D
+L0026:	ldx     #$FF
+	txa
+	jsr     stax0sp
+L001D:	jsr     ldax0sp
+	pha
+	ldy     #$02
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp6
+
+.endproc
+
@@ -0,0 +1,95 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.export		_fflush
+	.import		__seterrno
+	.import		__filetab
+	.import		__fbufvflush
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ fflush (register __near__ struct _FILE *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fflush: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$00
+	ldx     #$04
+	jsr     regswap2
+	jsr     push0
+	lda     regbank+4
+	ora     regbank+4+1
+	bne     L0005
+	lda     #<(__filetab)
+	sta     regbank+4
+	lda     #>(__filetab)
+	sta     regbank+4+1
+	bra     L0008
+L000B:	ldy     #$01
+	lda     (regbank+4),y
+	and     #$80
+	beq     L0011
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     __fbufvflush
+	cpx     #$00
+	bne     L0012
+	cmp     #$00
+	beq     L0011
+L0012:	ldx     #$FF
+	txa
+	jsr     stax0sp
+L0011:	lda     #$03
+	clc
+	adc     regbank+4
+	sta     regbank+4
+	bcc     L0008
+	inc     regbank+4+1
+L0008:	lda     regbank+4
+	cmp     #<(__filetab+24)
+	lda     regbank+4+1
+	sbc     #>(__filetab+24)
+	bcc     L000B
+	bra     L0028
+L0005:	ldy     #$01
+	lda     (regbank+4),y
+	and     #$01
+	bne     L002C
+	lda     #$10
+	jsr     __seterrno
+	ldx     #$FF
+	txa
+	bra     L0003
+L002C:	lda     (regbank+4),y
+	and     #$80
+	beq     L0028
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     __fbufvflush
+	jsr     stax0sp
+L0028:	jsr     ldax0sp
+L0003:	pha
+	ldy     #$02
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp4
+
+.endproc
+
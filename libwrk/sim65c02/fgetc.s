@@ -0,0 +1,149 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.export		_fgetc
+	.import		_read
+	.import		__fbuffill
+
+; ---------------------------------------------------------------
+; int __near__ __fastcall__ fgetc (register __near__ struct _FILE *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fgetc: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$00
+	ldx     #$04
+	jsr     regswap2
+	jsr     decsp1
+	ldy     #$01
+	lda     (regbank+4),y
+	and     #$01
+	beq     L002E
+	lda     (regbank+4),y
+	and     #$06
+	beq     L0030
+L002E:	ldx     #$FF
+	txa
+	jmp     L001F
+L0030:	lda     (regbank+4),y
+	and     #$08
+	beq     L000C
+	lda     (regbank+4),y
+	and     #$F7
+	sta     (regbank+4),y
+	iny
+	ldx     #$00
+	lda     (regbank+4),y
+	jmp     L001F
+L000C:	lda     regbank+4
+	ldx     regbank+4+1
+	ldy     #$03
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	beq     L0011
+	ldy     #$08
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	jsr     pushax
+	ldy     #$0A
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	jsr     tosicmp
+	bcs     L0013
+	ldy     #$04
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	jsr     pushax
+	ldy     #$08
+	lda     (regbank+4),y
+	tax
+	dey
+	lda     (regbank+4),y
+	sta     regsave
+	stx     regsave+1
+	ina
+	bne     L0031
+	inx
+L0031:	sta     (regbank+4),y
+	iny
+	txa
+	sta     (regbank+4),y
+	lda     regsave
+	ldx     regsave+1
+	jsr     tosaddax
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1)
+	bra     L001F
+L0013:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     __fbuffill
+	bra     L001F
+L0011:	lda     (regbank+4)
+	jsr     pusha0
+	lda     #$02
+	jsr     leaa0sp
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     _read
+	cpx     #$00
+	bne     L002C
+	cmp     #$00
+	beq     L0026
+	bra     L002A
+L002C:	cpx     #$FF
+	bne     L002A
+	cmp     #$FF
+	bne     L002A
+	ldy     #$01
+	lda     (regbank+4),y
+	ora     #$04
+	sta     (regbank+4),y
+	txa
+	bra     L001F
+L0026:	ldy     #$01
+	lda     (regbank+4),y
+	ora     #$02
+	sta     (regbank+4),y
+	dex
+	txa
+	bra     L001F
+L002A:	lda     (sp)
+	ldx     #$00
+L001F:	pha
+	ldy     #$01
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp3
+
+.endproc
+
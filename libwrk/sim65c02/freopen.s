@@ -0,0 +1,59 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.import		_fclose
+	.export		_freopen
+	.import		__seterrno
+	.import		__fopen
+
+; ---------------------------------------------------------------
+; __near__ struct _FILE * __near__ __fastcall__ freopen (__near__ const unsigned char *, __near__ const unsigned char *, __near__ struct _FILE *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_freopen: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	and     #$01
+	bne     L0013
+	lda     #$07
+	jsr     __seterrno
+	ldx     #$00
+	jmp     incsp6
+L0013:	jsr     ldax0sp
+	jsr     _fclose
+	cpx     #$00
+	bne     L0014
+	cmp     #$00
+	beq     L000A
+L0014:	ldx     #$00
+	txa
+	jmp     incsp6
+L000A:	ldy     #$07
+	jsr     pushwysp
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     __fopen
+	jmp     incsp6
+
+.endproc
+
@@ -0,0 +1,88 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.export		_ftell
+	.import		__seterrno
+	.import		_lseek
+	.import		__fbufvoffs
+
+; ---------------------------------------------------------------
+; long __near__ __fastcall__ ftell (register __near__ struct _FILE *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_ftell: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$00
+	ldx     #$04
+	jsr     regswap2
+	jsr     decsp4
+	ldy     #$01
+	lda     (regbank+4),y
+	and     #$01
+	bne     L0004
+	lda     #$07
+	jsr     __seterrno
+	ldx     #$FF
+	stx     sreg
+	stx     sreg+1
+	txa
+	bra     L0003
+L0004:	lda     (regbank+4)
+	jsr     pusha0
+	jsr     pushl0
+	jsr     _lseek
+	jsr     steax0sp
+	jsr     ldeax0sp
+	lda     sreg+1
+	bmi     L0010
+	ldy     #$01
+	lda     (regbank+4),y
+	and     #$80
+	beq     L0010
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     __fbufvoffs
+	jsr     axlong
+	jsr     laddeq0sp
+L0010:	jsr     ldeax0sp
+	jsr     pusheax
+	ldx     #$00
+	stz     sreg
+	stz     sreg+1
+	lda     #$01
+	jsr     tosgeeax
+	beq     L0018
+	ldy     #$01
+	lda     (regbank+4),y
+	and     #$08
+	beq     L0018
+	ldx     #$00
+	tya
+	jsr     lsubeq0sp
+L0018:	jsr     ldeax0sp
+L0003:	pha
+	ldy     #$04
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp6
+
+.endproc
+
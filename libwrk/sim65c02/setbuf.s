@@ -0,0 +1,46 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.export		_setbuf
+	.import		_setvbuf
+
+; ---------------------------------------------------------------
+; void __near__ __fastcall__ setbuf (__near__ struct _FILE *, __near__ unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_setbuf: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0006
+	lda     #$00
+	bra     L0008
+L0006:	lda     #$02
+L0008:	jsr     pusha0
+	ldx     #$01
+	lda     #$00
+	jsr     _setvbuf
+	jmp     incsp4
+
+.endproc
+
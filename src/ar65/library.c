@@ -40,6 +40,7 @@
 /* common */
 #include "cmdline.h"
 #include "exprdefs.h"
+#include "hashfunc.h"
 #include "libdefs.h"
 #include "print.h"
 #include "symdefs.h"
@@ -98,7 +99,7 @@ static void ReadHeader (void)
         Error ("`%s' is not a valid library file", LibName);
     }
     Header.Version = Read16 (Lib);
-    if (Header.Version != LIB_VERSION) {
+    if (Header.Version != LIB_VERSION && Header.Version != LIB_VERSION_OLD) {
         Error ("Wrong data version in `%s'", LibName);
     }
     Header.Flags   = Read16 (Lib);
@@ -123,6 +124,34 @@ static void ReadIndexEntry (void)
 
 
 
+static void ReadExportIndex (void)
+/* Read the export index of a library file and add the exports to the
+** modules.
+*/
+{
+    unsigned long Buckets = ReadVar (Lib);
+    while (Buckets--) {
+        unsigned long Count = ReadVar (Lib);
+        while (Count--) {
+
+            /* Read the name and the module index */
+            char*         Name   = ReadStr (Lib);
+            unsigned long Module = ReadVar (Lib);
+            ObjData*      O;
+
+            /* Add the name to the module */
+            if (Module >= CollCount (&ObjPool)) {
+                Error ("Invalid export index in `%s'", LibName);
+            }
+            O = CollAtUnchecked (&ObjPool, Module);
+            CollAppend (&O->Strings, Name);
+            CollAppend (&O->Exports, Name);
+        }
+    }
+}
+
+
+
 static void ReadIndex (void)
 /* Read the index of a library file */
 {
@@ -139,14 +168,20 @@ static void ReadIndex (void)
         ReadIndexEntry ();
     }
 
-    /* Read basic object file data from the actual entries */
-    for (I = 0; I < CollCount (&ObjPool); ++I) {
+    /* Read the exports from the export index if we have one. Otherwise read
+    ** basic object file data from the actual entries.
+    */
+    if (Header.Version == LIB_VERSION) {
+        ReadExportIndex ();
+    } else {
+        for (I = 0; I < CollCount (&ObjPool); ++I) {
 
-        /* Get the object file entry */
-        ObjData* O = CollAtUnchecked (&ObjPool, I);
+            /* Get the object file entry */
+            ObjData* O = CollAtUnchecked (&ObjPool, I);
 
-        /* Read data */
-        ObjReadData (Lib, O);
+            /* Read data */
+            ObjReadData (Lib, O);
+        }
     }
 }
 
@@ -186,13 +221,84 @@ static void WriteIndexEntry (const ObjData* O)
 
 
 
+static void WriteExportIndex (void)
+/* Write the export index of a library file */
+{
+    unsigned      I, J;
+    unsigned      Count;
+    unsigned      Buckets;
+    unsigned      Pos;
+    unsigned*     Start;
+    unsigned*     Modules;
+    const char**  Names;
+
+    /* Count the exports and determine the size of the hash table */
+    Count = 0;
+    for (I = 0; I < CollCount (&ObjPool); ++I) {
+        const ObjData* O = CollConstAt (&ObjPool, I);
+        Count += CollCount (&O->Exports);
+    }
+    Buckets = Count / 4 + 1;
+
+    /* Count the entries in each bucket and determine where the bucket starts
+    ** in the list of all entries.
+    */
+    Start = xmalloc ((Buckets + 1) * sizeof (Start[0]));
+    memset (Start, 0, (Buckets + 1) * sizeof (Start[0]));
+    for (I = 0; I < CollCount (&ObjPool); ++I) {
+        const ObjData* O = CollConstAt (&ObjPool, I);
+        for (J = 0; J < CollCount (&O->Exports); ++J) {
+            ++Start[HashStr (CollConstAt (&O->Exports, J)) % Buckets + 1];
+        }
+    }
+    for (I = 1; I <= Buckets; ++I) {
+        Start[I] += Start[I-1];
+    }
+
+    /* Sort the entries into the buckets. Afterwards, Start[I] is the end of
+    ** bucket I.
+    */
+    Modules = xmalloc (Count * sizeof (Modules[0]));
+    Names   = xmalloc (Count * sizeof (Names[0]));
+    for (I = 0; I < CollCount (&ObjPool); ++I) {
+        const ObjData* O = CollConstAt (&ObjPool, I);
+        for (J = 0; J < CollCount (&O->Exports); ++J) {
+            const char* Name = CollConstAt (&O->Exports, J);
+            Pos = Start[HashStr (Name) % Buckets]++;
+            Modules[Pos] = I;
+            Names[Pos]   = Name;
+        }
+    }
+
+    /* Write the hash table */
+    WriteVar (NewLib, Buckets);
+    Pos = 0;
+    for (I = 0; I < Buckets; ++I) {
+        WriteVar (NewLib, Start[I] - Pos);
+        while (Pos < Start[I]) {
+            WriteStr (NewLib, Names[Pos]);
+            WriteVar (NewLib, Modules[Pos]);
+            ++Pos;
+        }
+    }
+
+    /* Free the tables */
+    xfree (Start);
+    xfree (Modules);
+    xfree (Names);
+}
+
+
+
 static void WriteIndex (void)
 /* Write the index of a library file */
 {
     unsigned I;
 
-    /* Sync I/O in case the last operation was a read */
-    fseek (NewLib, 0, SEEK_CUR);
+    /* The index goes to the end of the file. This will also sync I/O in case
+    ** the last operation was a read.
+    */
+    fseek (NewLib, 0, SEEK_END);
 
     /* Remember the current offset in the header */
     Header.IndexOffs = ftell (NewLib);
@@ -204,6 +310,9 @@ static void WriteIndex (void)
     for (I = 0; I < CollCount (&ObjPool); ++I) {
         WriteIndexEntry (CollConstAt (&ObjPool, I));
     }
+
+    /* Write the export index */
+    WriteExportIndex ();
 }
 
 
@@ -214,10 +323,31 @@ static void WriteIndex (void)
 
 
 
-void LibOpen (const char* Name, int MustExist, int NeedTemp)
-/* Open an existing library and a temporary copy. If MustExist is true, the
-** old library is expected to exist. If NeedTemp is true, a temporary library
-** is created.
+static void CreateTempLib (void)
+/* Create a temporary library that replaces the old one when done */
+{
+    /* Create the temporary library name */
+    NewLibName = xmalloc (strlen (LibName) + strlen (".temp") + 1);
+    strcpy (NewLibName, LibName);
+    strcat (NewLibName, ".temp");
+
+    /* Create the temporary library */
+    NewLib = fopen (NewLibName, "w+b");
+    if (NewLib == 0) {
+        Error ("Cannot create temporary library file: %s", strerror (errno));
+    }
+
+    /* Write a dummy header to the temp file */
+    WriteHeader ();
+}
+
+
+
+void LibOpen (const char* Name, int MustExist, int Modify)
+/* Open an existing library. If MustExist is true, the old library is
+** expected to exist. If Modify is true, the library is prepared for changes:
+** An existing library is updated in place, otherwise a temporary library is
+** created.
 */
 {
     /* Remember the name */
@@ -246,35 +376,43 @@ void LibOpen (const char* Name, int MustExist, int NeedTemp)
 
     }
 
-    if (NeedTemp) {
-
-        /* Create the temporary library name */
-        NewLibName = xmalloc (strlen (Name) + strlen (".temp") + 1);
-        strcpy (NewLibName, Name);
-        strcat (NewLibName, ".temp");
+    if (Modify) {
+        if (Lib) {
+            /* New modules and the new index are appended to the existing
+            ** library, and the header is rewritten last, so the library
+            ** stays valid if we're interrupted.
+            */
+            unsigned I;
+            Lib = freopen (Name, "r+b", Lib);
+            if (Lib == 0) {
+                Error ("Cannot open library `%s' for writing: %s",
+                       Name, strerror (errno));
+            }
+            NewLib = Lib;
 
-        /* Create the temporary library */
-        NewLib = fopen (NewLibName, "w+b");
-        if (NewLib == 0) {
-            Error ("Cannot create temporary library file: %s", strerror (errno));
+            /* The data of the existing modules is already where it belongs */
+            for (I = 0; I < CollCount (&ObjPool); ++I) {
+                ((ObjData*) CollAtUnchecked (&ObjPool, I))->Flags |= OBJ_HAVEDATA;
+            }
+        } else {
+            CreateTempLib ();
         }
-
-        /* Write a dummy header to the temp file */
-        WriteHeader ();
     }
 }
 
 
 
 unsigned long LibCopyTo (FILE* F, unsigned long Bytes)
-/* Copy data from F to the temp library file, return the start position in
-** the temporary library file.
+/* Copy data from F to the end of the new library file, return the start
+** position in the new library file.
 */
 {
     unsigned char Buf [4096];
 
     /* Remember the position */
-    unsigned long Pos = ftell (NewLib);
+    unsigned long Pos;
+    fseek (NewLib, 0, SEEK_END);
+    Pos = ftell (NewLib);
 
     /* Copy loop */
     while (Bytes) {
@@ -334,16 +472,33 @@ static void LibCheckExports (ObjData* O)
 
 
 void LibClose (void)
-/* Write remaining data, close both files and copy the temp file to the old
-** filename
+/* Write remaining data and the new index, and close the library. A temporary
+** library replaces the old one.
 */
 {
-    /* Do we have a temporary library? */
+    /* Do we have a new library? */
     if (NewLib) {
 
         unsigned I;
-        unsigned char Buf [4096];
-        size_t Count;
+
+        /* When updating in place, the data of replaced and deleted modules
+        ** and the old indexes remain in the file. If they make up too much
+        ** of it, write a new library that contains all modules instead.
+        */
+        if (NewLib == Lib) {
+            unsigned long Used = LIB_HDR_SIZE;
+            for (I = 0; I < CollCount (&ObjPool); ++I) {
+                Used += ((const ObjData*) CollConstAt (&ObjPool, I))->Size;
+            }
+            fseek (Lib, 0, SEEK_END);
+            if ((unsigned long) ftell (Lib) - Used > Used / 2) {
+                Print (stdout, 1, "%s: Compacting library `%s'\n", ProgName, LibName);
+                for (I = 0; I < CollCount (&ObjPool); ++I) {
+                    ((ObjData*) CollAtUnchecked (&ObjPool, I))->Flags &= ~OBJ_HAVEDATA;
+                }
+                CreateTempLib ();
+            }
+        }
 
         /* Walk through the object file list, inserting exports into the
         ** export list checking for duplicates. Copy any data that is still
@@ -361,8 +516,7 @@ void LibClose (void)
             if ((O->Flags & OBJ_HAVEDATA) == 0) {
                 /* Data is still in the old library */
                 fseek (Lib, O->Start, SEEK_SET);
-                O->Start = ftell (NewLib);
-                LibCopyTo (Lib, O->Size);
+                O->Start = LibCopyTo (Lib, O->Size);
                 O->Flags |= OBJ_HAVEDATA;
             }
         }
@@ -371,37 +525,35 @@ void LibClose (void)
         WriteIndex ();
 
         /* Write the updated header */
+        Header.Version = LIB_VERSION;
         WriteHeader ();
 
-        /* Close the file */
-        if (Lib && fclose (Lib) != 0) {
-            Error ("Error closing library: %s", strerror (errno));
-        }
+        if (NewLib != Lib) {
 
-        /* Reopen the library and truncate it */
-        Lib = fopen (LibName, "wb");
-        if (Lib == 0) {
-            Error ("Cannot open library `%s' for writing: %s",
-                   LibName, strerror (errno));
-        }
+            /* Close both files */
+            if (Lib && fclose (Lib) != 0) {
+                Error ("Error closing library: %s", strerror (errno));
+            }
+            Lib = 0;
+            if (fclose (NewLib) != 0) {
+                Error ("Problem closing temporary library file: %s", strerror (errno));
+            }
 
-        /* Copy the temporary library to the new one */
-        fseek (NewLib, 0, SEEK_SET);
-        while ((Count = fread (Buf, 1, sizeof (Buf), NewLib)) != 0) {
-            if (fwrite (Buf, 1, Count, Lib) != Count) {
-                Error ("Cannot write to `%s': %s", LibName, strerror (errno));
+            /* Replace the old library by the new one. Some systems don't
+            ** allow to rename a file to the name of an existing one.
+            */
+            if (rename (NewLibName, LibName) != 0) {
+                if (remove (LibName) != 0 || rename (NewLibName, LibName) != 0) {
+                    Error ("Cannot rename `%s' to `%s': %s",
+                           NewLibName, LibName, strerror (errno));
+                }
             }
         }
+        NewLib = 0;
     }
 
-    /* Close both files */
+    /* Close the library */
     if (Lib && fclose (Lib) != 0) {
         Error ("Problem closing `%s': %s", LibName, strerror (errno));
     }
-    if (NewLib && fclose (NewLib) != 0) {
-        Error ("Problem closing temporary library file: %s", strerror (errno));
-    }
-    if (NewLibName && remove (NewLibName) != 0) {
-        Error ("Problem deleting temporary library file: %s", strerror (errno));
-    }
 }
@@ -59,23 +59,24 @@ extern const char* LibName;
 
 
 
-void LibOpen (const char* Name, int MustExist, int NeedTemp);
-/* Open an existing library and a temporary copy. If MustExist is true, the
-** old library is expected to exist. If NeedTemp is true, a temporary library
-** is created.
+void LibOpen (const char* Name, int MustExist, int Modify);
+/* Open an existing library. If MustExist is true, the old library is
+** expected to exist. If Modify is true, the library is prepared for changes:
+** An existing library is updated in place, otherwise a temporary library is
+** created.
 */
 
 unsigned long LibCopyTo (FILE* F, unsigned long Bytes);
-/* Copy data from F to the temp library file, return the start position in
-** the temporary library file.
+/* Copy data from F to the end of the new library file, return the start
+** position in the new library file.
 */
 
 void LibCopyFrom (unsigned long Pos, unsigned long Bytes, FILE* F);
 /* Copy data from the library file into another file */
 
 void LibClose (void);
-/* Write remaining data, close both files and copy the temp file to the old
-** filename
+/* Write remaining data and the new index, and close the library. A temporary
+** library replaces the old one.
 */
 
 
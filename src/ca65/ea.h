@@ -56,8 +56,13 @@ struct EffAddr {
     unsigned            AddrMode;       /* Actual addressing mode used */
     unsigned long       AddrModeBit;    /* Addressing mode as bit mask */
     unsigned char       Opcode;         /* Opcode */
+    unsigned char       RelaxKind;      /* RELAX_xxx or RELAX_NONE */
+    unsigned char       ShortOpcode;    /* Opcode of the relaxed form */
 };
 
+/* Value for RelaxKind if the linker must not shorten the instruction */
+#define RELAX_NONE      0xFF
+
 
 
 /* End of ea.h */
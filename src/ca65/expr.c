@@ -57,6 +57,7 @@
 #include "objfile.h"
 #include "segment.h"
 #include "sizeof.h"
+#include "span.h"
 #include "studyexpr.h"
 #include "symbol.h"
 #include "symtab.h"
@@ -171,6 +172,63 @@ int IsFarRange (long Val)
 
 
 
+static int LayoutRefs (ExprNode* Expr, int Fix)
+/* Return true if the value of the expression depends on the layout of a
+** segment that the linker may change (see --link-relax). If Fix is true,
+** fix the layout of all these segments. Must only be called for expressions
+** known to be valid.
+*/
+{
+    int Refs = 0;
+
+    if (Expr == 0) {
+        return 0;
+    }
+
+    switch (Expr->Op) {
+
+        case EXPR_SYMBOL:
+            if (SymHasExpr (Expr->V.Sym)) {
+                Refs = LayoutRefs (GetSymExpr (Expr->V.Sym), Fix);
+            }
+            break;
+
+        case EXPR_SECTION:
+            Refs = !SegLayoutFixed (Expr->V.SecNum);
+            if (Refs && Fix) {
+                FixSegLayout (Expr->V.SecNum);
+            }
+            break;
+
+        case EXPR_ULABEL:
+            if (ULabCanResolve ()) {
+                ExprNode* E = ULabResolve (Expr->V.IVal);
+                Refs = LayoutRefs (E, Fix);
+                FreeExpr (E);
+            }
+            break;
+
+        default:
+            Refs  = LayoutRefs (Expr->Left, Fix);
+            Refs |= LayoutRefs (Expr->Right, Fix);
+            break;
+    }
+
+    return Refs;
+}
+
+
+
+int IsLayoutDependent (ExprNode* Expr)
+/* Return true if the value of the expression depends on the layout of a
+** segment that the linker may change (see --link-relax).
+*/
+{
+    return LayoutRefs (Expr, 0);
+}
+
+
+
 int IsEasyConst (const ExprNode* E, long* Val)
 /* Do some light checking if the given node is a constant. Don't care if E is
 ** a complex expression. If E is a constant, return true and place its value
@@ -773,6 +831,8 @@ static ExprNode* FuncSizeOf (void)
 
     /* Assume an error */
     SizeSym = 0;
+    Scope   = 0;
+    Sym     = 0;
 
     /* Check for a cheap local which needs special handling */
     if (CurTok.Tok == TOK_LOCAL_IDENT) {
@@ -842,6 +902,17 @@ static ExprNode* FuncSizeOf (void)
     if (SizeSym == 0 || !SymIsConst (SizeSym, &Size)) {
         Error ("Size of `%m%p%m%p' is unknown", &ScopeName, &Name);
         Size = 0;
+    } else if (LinkRelax) {
+        /* The linker must not change the size */
+        if (Scope) {
+            unsigned I;
+            for (I = 0; I < CollCount (&Scope->Spans); ++I) {
+                const Span* S = CollConstAt (&Scope->Spans, I);
+                FixSegLayout (S->Seg->Num);
+            }
+        } else if (SymHasExpr (Sym)) {
+            LayoutRefs (GetSymExpr (Sym), 1);
+        }
     }
 
     /* Free the string buffers */
@@ -1637,9 +1708,14 @@ long ConstExpression (void)
     ED_Init (&D);
     StudyExpr (Expr, &D);
 
-    /* Check if the expression is constant */
+    /* Check if the expression is constant. If the value depends on the
+    ** layout of a segment, the linker must not change it.
+    */
     if (ED_IsConst (&D)) {
         Val = D.Val;
+        if (LinkRelax) {
+            LayoutRefs (Expr, 1);
+        }
     } else {
         Error ("Constant expression expected");
         Val = 0;
@@ -1670,7 +1746,8 @@ void FreeExpr (ExprNode* Root)
 ExprNode* SimplifyExpr (ExprNode* Expr, const ExprDesc* D)
 /* Try to simplify the given expression tree */
 {
-    if (Expr->Op != EXPR_LITERAL && ED_IsConst (D)) {
+    if (Expr->Op != EXPR_LITERAL && ED_IsConst (D) &&
+        (!LinkRelax || !IsLayoutDependent (Expr))) {
         /* No external references */
         FreeExpr (Expr);
         Expr = GenLiteralExpr (D->Val);
@@ -1790,10 +1867,22 @@ ExprNode* GenBranchExpr (unsigned Offs)
     /* Read Expression() */
     N = Expression ();
 
-    /* If the expression is a cheap constant, generate a simpler tree */
-    if (IsEasyConst (N, &Val)) {
+    /* If the linker may shorten code, it must be able to recognize the
+    ** position of the instruction, so use the same form as for labels:
+    ** N - (Seg + (PC + Offs))
+    */
+    if (LinkRelax && GetRelocMode ()) {
 
-        /* Free the constant expression tree */
+        Root = NewExprNode (EXPR_MINUS);
+        Root->Left  = N;
+        Root->Right = GenAddExpr (GenSectionExpr (GetCurrentSegNum ()),
+                                  GenLiteralExpr (GetPC () + Offs));
+
+    } else if (IsEasyConst (N, &Val)) {
+
+        /* The expression is a cheap constant, generate a simpler tree.
+        ** Free the constant expression tree.
+        */
         FreeExpr (N);
 
         /* Generate the final expression:
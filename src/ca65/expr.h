@@ -118,6 +118,11 @@ ExprNode* GenDWordExpr (ExprNode* Expr);
 ExprNode* GenNE (ExprNode* Expr, long Val);
 /* Generate an expression that compares Expr and Val for inequality */
 
+int IsLayoutDependent (ExprNode* Expr);
+/* Return true if the value of the expression depends on the layout of a
+** segment that the linker may change (see --link-relax).
+*/
+
 int IsConstExpr (ExprNode* Expr, long* Val);
 /* Return true if the given expression is a constant expression, that is, one
 ** with no references to external symbols. If Val is not NULL and the
@@ -63,6 +63,12 @@ struct Fragment {
     union {
         unsigned char   Data[sizeof (ExprNode*)];       /* Literal values */
         ExprNode*       Expr;                           /* Expression */
+        struct {
+            ExprNode*       Expr;       /* Address expression */
+            unsigned char   Kind;       /* Kind of relaxation, RELAX_xxx */
+            unsigned char   Short;      /* Opcode of the short form */
+            unsigned char   Long[3];    /* Opcode bytes of the long form */
+        } R;                                            /* FRAG_RELAX */
     } V;
 };
 
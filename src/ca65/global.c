@@ -66,6 +66,7 @@ unsigned char DbgSyms            = 0;   /* Add debug symbols */
 unsigned char LineCont           = 0;   /* Allow line continuation */
 unsigned char LargeAlignment     = 0;   /* Don't warn about large alignments */
 unsigned char RelaxChecks        = 0;   /* Relax a few assembler checks */
+unsigned char LinkRelax          = 0;   /* Let the linker shorten code */
 
 /* Emulation features */
 unsigned char DollarIsPC         = 0;   /* Allow the $ symbol as current PC */
@@ -68,6 +68,7 @@ extern unsigned char    DbgSyms;            /* Add debug symbols */
 extern unsigned char    LineCont;           /* Allow line continuation */
 extern unsigned char    LargeAlignment;     /* Don't warn about large alignments */
 extern unsigned char    RelaxChecks;        /* Relax a few assembler checks */
+extern unsigned char    LinkRelax;          /* Let the linker shorten code */
 
 /* Emulation features */
 extern unsigned char    DollarIsPC;         /* Allow the $ symbol as current PC */
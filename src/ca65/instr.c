@@ -42,6 +42,7 @@
 #include "attrib.h"
 #include "bitops.h"
 #include "check.h"
+#include "fragdefs.h"
 #include "mmodel.h"
 
 /* ca65 */
@@ -55,6 +56,7 @@
 #include "instr.h"
 #include "nexttok.h"
 #include "objcode.h"
+#include "segment.h"
 #include "spool.h"
 #include "studyexpr.h"
 #include "symtab.h"
@@ -1078,11 +1080,27 @@ static unsigned char Sweet16ExtBytes[AMSW16I_COUNT] = {
 
 
 
+static int CanRelax (void)
+/* Return true if the linker may shorten instructions for the current CPU */
+{
+    /* The 65816 and the 4510 have a movable direct page, and the direct page
+    ** of the HuC6280 isn't at address zero.
+    */
+    return LinkRelax && GetRelocMode () &&
+           (CPU == CPU_6502 || CPU == CPU_6502X ||
+            CPU == CPU_65SC02 || CPU == CPU_65C02);
+}
+
+
+
 static int EvalEA (const InsDesc* Ins, EffAddr* A)
 /* Evaluate the effective address. All fields in A will be valid after calling
 ** this function. The function returns true on success and false on errors.
 */
 {
+    unsigned long AvailModes;
+    int           IsConst = 0;
+
     /* Get the set of possible addressing modes */
     GetEA (A);
 
@@ -1091,6 +1109,9 @@ static int EvalEA (const InsDesc* Ins, EffAddr* A)
     */
     A->AddrModeSet &= Ins->AddrMode;
 
+    /* Remember them before removing the ones that are too small */
+    AvailModes = A->AddrModeSet;
+
     /* If we have an expression, check it and remove any addressing modes that
     ** are too small for the expression size. Since we have to study the
     ** expression anyway, do also replace it by a simpler one if possible.
@@ -1103,6 +1124,7 @@ static int EvalEA (const InsDesc* Ins, EffAddr* A)
         StudyExpr (A->Expr, &ED);
 
         /* Simplify it if possible */
+        IsConst = ED_IsConst (&ED);
         A->Expr = SimplifyExpr (A->Expr, &ED);
 
         if (ED.AddrSize == ADDR_SIZE_DEFAULT) {
@@ -1180,6 +1202,25 @@ static int EvalEA (const InsDesc* Ins, EffAddr* A)
     /* Build the opcode */
     A->Opcode = Ins->BaseCode | EATab[Ins->ExtCode][A->AddrMode];
 
+    /* If the address wasn't known, and there is a shorter form of the
+    ** instruction, the linker may replace it. The zero page modes are one
+    ** below the corresponding absolute ones.
+    */
+    A->RelaxKind = RELAX_NONE;
+    if (A->Expr && !IsConst && CanRelax ()) {
+        if ((A->AddrModeBit & (AM65_ABS | AM65_ABS_X | AM65_ABS_Y)) != 0 &&
+            (AvailModes & (A->AddrModeBit >> 1)) != 0) {
+            A->RelaxKind   = (A->AddrModeBit == AM65_ABS)? RELAX_ZP : RELAX_ZP_IND;
+            A->ShortOpcode = Ins->BaseCode | EATab[Ins->ExtCode][A->AddrMode-1];
+        } else if (A->Opcode == 0x4C && A->AddrModeBit == AM65_ABS) {
+            /* A jump may become a BRA. Without BRA, it may only be replaced
+            ** together with a conditional branch over it.
+            */
+            A->RelaxKind   = RELAX_BRANCH;
+            A->ShortOpcode = (CPU == CPU_6502 || CPU == CPU_6502X)? 0x00 : 0x80;
+        }
+    }
+
     /* If feature force_range is active, and we have immediate addressing mode,
     ** limit the expression to the maximum possible value.
     */
@@ -1211,7 +1252,10 @@ static void EmitCode (EffAddr* A)
             break;
 
         case 2:
-            if (CPU == CPU_65816 && (A->AddrModeBit & (AM65_ABS | AM65_ABS_X | AM65_ABS_Y))) {
+            if (A->RelaxKind != RELAX_NONE) {
+                /* The linker may replace it by a shorter form */
+                EmitRelax (A->RelaxKind, A->Opcode, A->ShortOpcode, A->Expr);
+            } else if (CPU == CPU_65816 && (A->AddrModeBit & (AM65_ABS | AM65_ABS_X | AM65_ABS_Y))) {
                 /* This is a 16 bit mode that uses an address. If in 65816,
                 ** mode, force this address into 16 bit range to allow
                 ** addressing inside a 64K segment.
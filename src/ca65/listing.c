@@ -373,6 +373,14 @@ void CreateListing (void)
                     B = AddMult (B, 'x', Frag->Len*2);
                     break;
 
+                case FRAG_RELAX:
+                    /* List the long form */
+                    for (I = 0; I < Frag->Len - 2U; ++I) {
+                        B = AddHex (B, Frag->V.R.Long[I]);
+                    }
+                    B = AddMult (B, 'r', 4);
+                    break;
+
                 default:
                     Internal ("Invalid fragment type: %u", Frag->Type);
 
@@ -121,6 +121,7 @@ static void Usage (void)
             "  --ignore-case\t\t\tIgnore case of symbols\n"
             "  --include-dir dir\t\tSet an include directory search path\n"
             "  --large-alignment\t\tDon't warn about large alignments\n"
+            "  --link-relax\t\t\tLet the linker shorten instructions\n"
             "  --listing name\t\tCreate a listing file if assembly was ok\n"
             "  --list-bytes n\t\tMaximum number of bytes per listing line\n"
             "  --memory-model model\t\tSet the memory model\n"
@@ -520,6 +521,19 @@ static void OptLargeAlignment (const char* Opt attribute ((unused)),
 
 
 
+static void OptLinkRelax (const char* Opt attribute ((unused)),
+                          const char* Arg attribute ((unused)))
+/* Handle the --link-relax option */
+{
+    /* Let macros know that the linker decides about the size of branches */
+    if (!LinkRelax) {
+        LinkRelax = 1;
+        NewSymbol ("__LINK_RELAX__", 1);
+    }
+}
+
+
+
 static void OptListBytes (const char* Opt, const char* Arg)
 /* Set the maximum number of bytes per listing line */
 {
@@ -915,6 +929,7 @@ int main (int argc, char* argv [])
         { "--ignore-case",      0,      OptIgnoreCase           },
         { "--include-dir",      1,      OptIncludeDir           },
         { "--large-alignment",  0,      OptLargeAlignment       },
+        { "--link-relax",       0,      OptLinkRelax            },
         { "--list-bytes",       1,      OptListBytes            },
         { "--listing",          1,      OptListing              },
         { "--memory-model",     1,      OptMemoryModel          },
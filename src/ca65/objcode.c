@@ -151,6 +151,21 @@ void EmitPCRel (unsigned char OPC, ExprNode* Expr, unsigned Size)
 
 
 
+void EmitRelax (unsigned char Kind, unsigned char OPC, unsigned char ShortOPC,
+                ExprNode* Expr)
+/* Emit an instruction with a two byte address that the linker may replace by
+** a shorter form. Kind is one of the RELAX_xxx constants.
+*/
+{
+    Fragment* F = GenFragment (FRAG_RELAX, 3);
+    F->V.R.Expr    = Expr;
+    F->V.R.Kind    = Kind;
+    F->V.R.Short   = ShortOPC;
+    F->V.R.Long[0] = OPC;
+}
+
+
+
 void EmitData (const void* D, unsigned Size)
 /* Emit data into the current segment */
 {
@@ -68,6 +68,12 @@ void EmitSigned (ExprNode* Expr, unsigned Size);
 void EmitPCRel (unsigned char OPC, ExprNode* Expr, unsigned Size);
 /* Emit an opcode with a PC relative argument of one or two bytes */
 
+void EmitRelax (unsigned char Kind, unsigned char OPC, unsigned char ShortOPC,
+                ExprNode* Expr);
+/* Emit an instruction with a two byte address that the linker may replace by
+** a shorter form. Kind is one of the RELAX_xxx constants.
+*/
+
 void EmitData (const void* Data, unsigned Size);
 /* Emit data into the current segment */
 
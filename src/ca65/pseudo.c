@@ -1754,6 +1754,14 @@ static void DoScope (void)
 
 
 
+static void DoSection (void)
+/* Start a new section of the active segment */
+{
+    NewSection ();
+}
+
+
+
 static void DoSegment (void)
 /* Switch to another segment */
 {
@@ -2090,6 +2098,7 @@ static CtrlDesc CtrlCmdTab [] = {
     { ccNone,           DoInvalid       },      /* .RIGHT */
     { ccNone,           DoROData        },
     { ccNone,           DoScope         },
+    { ccNone,           DoSection       },
     { ccNone,           DoSegment       },
     { ccNone,           DoUnexpected    },      /* .SET */
     { ccNone,           DoSetCPU        },
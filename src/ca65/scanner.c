@@ -46,6 +46,7 @@
 #include "check.h"
 #include "filestat.h"
 #include "fname.h"
+#include "textfile.h"
 #include "xmalloc.h"
 
 /* ca65 */
@@ -75,7 +76,7 @@ Token CurTok = STATIC_TOKEN_INITIALIZER;
 /* Struct to handle include files. */
 typedef struct InputFile InputFile;
 struct InputFile {
-    FILE*           F;                  /* Input file descriptor */
+    TextFile*       F;                  /* Input file contents */
     FilePos         Pos;                /* Position in file */
     token_t         Tok;                /* Last token */
     int             C;                  /* Last character */
@@ -272,6 +273,7 @@ struct DotKeyword {
     { ".RIGHT",         TOK_RIGHT               },
     { ".RODATA",        TOK_RODATA              },
     { ".SCOPE",         TOK_SCOPE               },
+    { ".SECTION",       TOK_SECTION             },
     { ".SEGMENT",       TOK_SEGMENT             },
     { ".SET",           TOK_SET                 },
     { ".SETCPU",        TOK_SETCPU              },
@@ -376,38 +378,16 @@ static void IFNextChar (CharSource* S)
 
         /* End of current line reached, read next line */
         SB_Clear (&S->V.File.Line);
-        while (1) {
-
-            int N = fgetc (S->V.File.F);
-            if (N == EOF) {
-                /* End of file. Accept files without a newline at the end */
-                if (SB_NotEmpty (&S->V.File.Line)) {
-                    break;
-                }
-
-                /* No more data - add an empty line to the listing. This
-                ** is a small hack needed to keep the PC output in sync.
-                */
-                NewListingLine (&EmptyStrBuf, S->V.File.Pos.Name, FCount);
-                C = EOF;
-                return;
-
-            /* Check for end of line */
-            } else if (N == '\n') {
-
-                /* End of line */
-                break;
-
-            /* Collect other stuff */
-            } else {
+        if (!TF_GetLine (S->V.File.F, &S->V.File.Line)) {
 
-                /* Append data to line */
-                SB_AppendChar (&S->V.File.Line, N);
-
-            }
+            /* No more data - add an empty line to the listing. This
+            ** is a small hack needed to keep the PC output in sync.
+            */
+            NewListingLine (&EmptyStrBuf, S->V.File.Pos.Name, FCount);
+            C = EOF;
+            return;
         }
 
-
         /* If we come here, we have a new input line. To avoid problems
         ** with strange line terminators, remove all whitespace from the
         ** end of the line, then add a single newline.
@@ -461,10 +441,8 @@ void IFDone (CharSource* S)
     /* Free the line buffer */
     SB_Done (&S->V.File.Line);
 
-    /* Close the input file and decrement the file count. We will ignore
-    ** errors here, since we were just reading from the file.
-    */
-    (void) fclose (S->V.File.F);
+    /* Free the file contents and decrement the file count */
+    FreeTextFile (S->V.File.F);
     --FCount;
 }
 
@@ -486,7 +464,7 @@ int NewInputFile (const char* Name)
 {
     int         RetCode = 0;            /* Return code. Assume an error. */
     char*       PathName = 0;
-    FILE*       F;
+    TextFile*   F;
     struct stat Buf;
     StrBuf      NameBuf;                /* No need to initialize */
     StrBuf      Path = AUTO_STRBUF_INITIALIZER;
@@ -499,7 +477,7 @@ int NewInputFile (const char* Name)
     */
     if (FCount == 0) {
         /* Main file */
-        F = fopen (Name, "r");
+        F = ReadTextFile (Name);
         if (F == 0) {
             Fatal ("Cannot open input file `%s': %s", Name, strerror (errno));
         }
@@ -508,7 +486,7 @@ int NewInputFile (const char* Name)
         ** directories.
         */
         PathName = SearchFile (IncSearchPath, Name);
-        if (PathName == 0 || (F = fopen (PathName, "r")) == 0) {
+        if (PathName == 0 || (F = ReadTextFile (PathName)) == 0) {
             /* Not found or cannot open, print an error and bail out */
             Error ("Cannot open include file `%s': %s", Name, strerror (errno));
             goto ExitPoint;
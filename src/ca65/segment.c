@@ -87,6 +87,9 @@ Collection SegmentList = STATIC_COLLECTION_INITIALIZER;
 /* Currently active segment */
 Segment* ActiveSeg;
 
+/* Number of segments that were started by .section */
+static unsigned SectionCount = 0;
+
 
 
 /*****************************************************************************/
@@ -114,6 +117,7 @@ static Segment* NewSegFromDef (SegDef* Def)
     S->PC        = 0;
     S->AbsPC     = 0;
     S->Def       = Def;
+    S->FixedLayout = 0;
 
     /* Insert it into the segment list */
     CollAppend (&SegmentList, S);
@@ -128,7 +132,7 @@ static Segment* NewSegment (const char* Name, unsigned char AddrSize)
 /* Create a new segment, insert it into the global list and return it */
 {
     /* Check for too many segments */
-    if (CollCount (&SegmentList) >= 256) {
+    if (CollCount (&SegmentList) - SectionCount >= 256) {
         Fatal ("Too many segments");
     }
 
@@ -174,11 +178,13 @@ Fragment* GenFragment (unsigned char Type, unsigned short Len)
         /* Relocatable mode is switched per segment */
         if (!ActiveSeg->RelocMode) {
             ActiveSeg->AbsPC += F->Len;
+            ActiveSeg->FixedLayout = 1;
         }
     } else {
         /* Relocatable mode is switched globally */
         if (!RelocMode) {
             AbsPC += F->Len;
+            ActiveSeg->FixedLayout = 1;
         }
     }
 
@@ -191,8 +197,9 @@ Fragment* GenFragment (unsigned char Type, unsigned short Len)
 void UseSeg (const SegDef* D)
 /* Use the segment with the given name */
 {
-    unsigned I;
-    for (I = 0; I < CollCount (&SegmentList); ++I) {
+    /* Search backwards, so we will find the last section of a segment */
+    unsigned I = CollCount (&SegmentList);
+    while (I-- > 0) {
         Segment* Seg = CollAtUnchecked (&SegmentList, I);
         if (strcmp (Seg->Def->Name, D->Name) == 0) {
             /* We found this segment. Check if the type is identical */
@@ -217,6 +224,38 @@ void UseSeg (const SegDef* D)
 
 
 
+void NewSection (void)
+/* Start a new section of the active segment. The linker may remove the
+** section if nothing references it.
+*/
+{
+    Segment* S;
+
+    /* Labels in absolute mode are plain numbers, so the linker wouldn't see
+    ** any references to them.
+    */
+    if (!GetRelocMode ()) {
+        Error ("Cannot start a new section in absolute mode");
+        return;
+    }
+
+    /* If nothing was emitted so far, use the current section */
+    if (ActiveSeg->FragCount == 0) {
+        ActiveSeg->Flags |= SEG_FLAG_GC;
+        return;
+    }
+
+    /* Otherwise create a new one with the same definition */
+    S = NewSegFromDef (ActiveSeg->Def);
+    S->Flags = SEG_FLAG_GC;
+    ++SectionCount;
+
+    /* Make it the active one */
+    ActiveSeg = S;
+}
+
+
+
 unsigned long GetPC (void)
 /* Get the program counter of the current segment */
 {
@@ -314,6 +353,13 @@ void SegAlign (unsigned long Alignment, int FillVal)
         /* Calculate the number of fill bytes */
         Count = AlignCount (ActiveSeg->PC, Alignment);
 
+        /* The fill bytes depend on the size of the preceding code, so the
+        ** linker must not change it.
+        */
+        if (Alignment > 1) {
+            ActiveSeg->FixedLayout = 1;
+        }
+
     }
 
 
@@ -352,6 +398,79 @@ unsigned char GetSegAddrSize (unsigned SegNum)
 
 
 
+void FixSegLayout (unsigned SegNum)
+/* Mark the segment with the given number so that the linker won't shorten
+** any code in it. This is necessary if offsets within the segment were used
+** by the assembler.
+*/
+{
+    ((Segment*) CollAt (&SegmentList, SegNum))->FixedLayout = 1;
+}
+
+
+
+int SegLayoutFixed (unsigned SegNum)
+/* Return true if the linker must not shorten code in the given segment */
+{
+    return ((Segment*) CollAt (&SegmentList, SegNum))->FixedLayout;
+}
+
+
+
+static int IsRelaxable (const Segment* S, const Fragment* F)
+/* Return true if the relaxable fragment F is written as such */
+{
+    return !S->FixedLayout &&
+           (F->V.R.Kind != RELAX_BRANCH || F->V.R.Short != 0);
+}
+
+
+
+static void JoinLongBranches (Segment* S)
+/* Join a conditional branch over a following jump into one relaxable unit,
+** so the linker may replace both by a branch with the inverted condition.
+** The fragments of the jump and the branch distance stay with a size of
+** zero, so the fragment lists of the listing remain intact.
+*/
+{
+    Fragment* Opc  = 0;
+    Fragment* Dist = 0;
+    Fragment* F    = S->Root;
+    while (F) {
+        long Val;
+        if (F->Type == FRAG_RELAX && F->V.R.Kind == RELAX_BRANCH && F->Len == 3 &&
+            Opc != 0 && Opc->Type == FRAG_LITERAL && Opc->Len == 1 &&
+            (Opc->V.Data[0] & 0x1F) == 0x10 && Opc->V.Data[0] != 0x80 &&
+            Dist->Type == FRAG_SEXPR && Dist->Len == 1 &&
+            IsConstExpr (Dist->V.Expr, &Val) && Val == 3) {
+
+            unsigned char OPC = Opc->V.Data[0];
+
+            /* The branch opcode fragment becomes the unit */
+            Opc->Type         = FRAG_RELAX;
+            Opc->Len          = 5;
+            Opc->V.R.Expr     = F->V.R.Expr;
+            Opc->V.R.Kind     = RELAX_BRANCH;
+            Opc->V.R.Short    = OPC ^ 0x20;
+            Opc->V.R.Long[0]  = OPC;
+            Opc->V.R.Long[1]  = 0x03;
+            Opc->V.R.Long[2]  = F->V.R.Long[0];
+
+            /* Empty the others */
+            FreeExpr (Dist->V.Expr);
+            Dist->Type = FRAG_LITERAL;
+            Dist->Len  = 0;
+            F->Type    = FRAG_LITERAL;
+            F->Len     = 0;
+        }
+        Opc  = Dist;
+        Dist = F;
+        F    = F->Next;
+    }
+}
+
+
+
 void SegDone (void)
 /* Check the segments for range and other errors. Do cleanup. */
 {
@@ -365,9 +484,33 @@ void SegDone (void)
     unsigned I;
     for (I = 0; I < CollCount (&SegmentList); ++I) {
         Segment* S = CollAtUnchecked (&SegmentList, I);
-        Fragment* F = S->Root;
+        Fragment* F;
+
+        /* Join long branches if the linker may relax them */
+        if (LinkRelax && !S->FixedLayout) {
+            JoinLongBranches (S);
+        }
+
+        F = S->Root;
         while (F) {
-            if (F->Type == FRAG_EXPR || F->Type == FRAG_SEXPR) {
+            if (F->Type == FRAG_RELAX) {
+
+                /* We have an address expression that must fit into a word */
+                ExprDesc ED;
+                ED_Init (&ED);
+                StudyExpr (F->V.R.Expr, &ED);
+                if (ED_IsConst (&ED)) {
+                    if (((unsigned long)ED.Val) > U_Hi[1]) {
+                        LIError (&F->LI,
+                                 "Range error (%lu not in [0..%lu])",
+                                 (unsigned long)ED.Val, U_Hi[1]);
+                    }
+                } else if (RelaxChecks == 0 && ED.AddrSize > ADDR_SIZE_ABS) {
+                    LIError (&F->LI, "Range error");
+                }
+                ED_Done (&ED);
+
+            } else if (F->Type == FRAG_EXPR || F->Type == FRAG_SEXPR) {
 
                 /* We have an expression, study it */
                 ExprDesc ED;
@@ -397,15 +540,20 @@ void SegDone (void)
                         }
                     }
 
-                    /* We don't need the expression tree any longer */
-                    FreeExpr (F->V.Expr);
+                    /* Convert the fragment into a literal fragment, unless
+                    ** the value may be changed by the linker.
+                    */
+                    if (!LinkRelax || !IsLayoutDependent (F->V.Expr)) {
+
+                        /* We don't need the expression tree any longer */
+                        FreeExpr (F->V.Expr);
 
-                    /* Convert the fragment into a literal fragment */
-                    for (J = 0; J < F->Len; ++J) {
-                        F->V.Data[J] = ED.Val & 0xFF;
-                        ED.Val >>= 8;
+                        for (J = 0; J < F->Len; ++J) {
+                            F->V.Data[J] = ED.Val & 0xFF;
+                            ED.Val >>= 8;
+                        }
+                        F->Type = FRAG_LITERAL;
                     }
-                    F->Type = FRAG_LITERAL;
 
                 } else if (RelaxChecks == 0) {
 
@@ -460,6 +608,10 @@ void SegDump (void)
                 State = 1;
                 printf ("\n  Expression (%u): ", F->Len);
                 DumpExpr (F->V.Expr, SymResolve);
+            } else if (F->Type == FRAG_RELAX) {
+                State = 1;
+                printf ("\n  Relaxable (%u, kind %u): ", F->Len, F->V.R.Kind);
+                DumpExpr (F->V.R.Expr, SymResolve);
             } else if (F->Type == FRAG_FILL) {
                 State = 1;
                 printf ("\n  Fill bytes (%u)", F->Len);
@@ -526,6 +678,7 @@ static void WriteOneSeg (Segment* Seg)
 /* Write one segment to the object file */
 {
     Fragment* Frag;
+    unsigned long FragCount;
     unsigned long DataSize;
     unsigned long EndPos;
 
@@ -535,13 +688,23 @@ static void WriteOneSeg (Segment* Seg)
     unsigned long SizePos = ObjGetFilePos ();
     ObjWrite32 (0);
 
+    /* Relaxable fragments that cannot be relaxed are written in their long
+    ** form, which needs two fragments.
+    */
+    FragCount = Seg->FragCount;
+    for (Frag = Seg->Root; Frag; Frag = Frag->Next) {
+        if (Frag->Type == FRAG_RELAX && !IsRelaxable (Seg, Frag)) {
+            ++FragCount;
+        }
+    }
+
     /* Write the segment data */
     ObjWriteVar (GetStringId (Seg->Def->Name)); /* Name of the segment */
     ObjWriteVar (Seg->Flags);                   /* Segment flags */
     ObjWriteVar (Seg->PC);                      /* Size */
     ObjWriteVar (Seg->Align);                   /* Segment alignment */
     ObjWrite8 (Seg->Def->AddrSize);             /* Address size of the segment */
-    ObjWriteVar (Seg->FragCount);               /* Number of fragments */
+    ObjWriteVar (FragCount);                    /* Number of fragments */
 
     /* Now walk through the fragment list for this segment and write the
     ** fragments.
@@ -585,6 +748,22 @@ static void WriteOneSeg (Segment* Seg)
                 ObjWriteVar (Frag->Len);
                 break;
 
+            case FRAG_RELAX:
+                if (IsRelaxable (Seg, Frag)) {
+                    ObjWrite8 (FRAG_RELAX | Frag->Len);
+                    ObjWrite8 (Frag->V.R.Kind);
+                    ObjWrite8 (Frag->V.R.Short);
+                    ObjWriteData (Frag->V.R.Long, Frag->Len - 2);
+                } else {
+                    ObjWrite8 (FRAG_LITERAL);
+                    ObjWriteVar (Frag->Len - 2);
+                    ObjWriteData (Frag->V.R.Long, Frag->Len - 2);
+                    WriteLineInfo (&Frag->LI);
+                    ObjWrite8 (FRAG_EXPR16);
+                }
+                WriteExpr (Frag->V.R.Expr);
+                break;
+
             default:
                 Internal ("Invalid fragment type: %u", Frag->Type);
 
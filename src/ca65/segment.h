@@ -69,6 +69,7 @@ struct Segment {
     unsigned long   AbsPC;              /* PC if in local absolute mode */
                                         /* (OrgPerSeg is true) */
     SegDef*         Def;                /* Segment definition (name and type) */
+    int             FixedLayout;        /* Linker must not shorten code */
 };
 
 /* Definitions for predefined segments */
@@ -99,6 +100,11 @@ Fragment* GenFragment (unsigned char Type, unsigned short Len);
 void UseSeg (const SegDef* D);
 /* Use the given segment */
 
+void NewSection (void);
+/* Start a new section of the active segment. The linker may remove the
+** section if nothing references it.
+*/
+
 #if defined(HAVE_INLINE)
 INLINE const SegDef* GetCurrentSegDef (void)
 /* Get a pointer to the segment defininition of the current segment */
@@ -138,6 +144,15 @@ void SegAlign (unsigned long Alignment, int FillVal);
 unsigned char GetSegAddrSize (unsigned SegNum);
 /* Return the address size of the segment with the given number */
 
+void FixSegLayout (unsigned SegNum);
+/* Mark the segment with the given number so that the linker won't shorten
+** any code in it. This is necessary if offsets within the segment were used
+** by the assembler.
+*/
+
+int SegLayoutFixed (unsigned SegNum);
+/* Return true if the linker must not shorten code in the given segment */
+
 unsigned long GetPC (void);
 /* Get the program counter of the current segment */
 
@@ -242,6 +242,7 @@ typedef enum token_t {
     TOK_RIGHT,
     TOK_RODATA,
     TOK_SCOPE,
+    TOK_SECTION,
     TOK_SEGMENT,
     TOK_SET,
     TOK_SETCPU,
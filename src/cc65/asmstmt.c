@@ -46,10 +46,12 @@
 #include "error.h"
 #include "expr.h"
 #include "function.h"
+#include "global.h"
 #include "litpool.h"
 #include "scanner.h"
 #include "segments.h"
 #include "stackptr.h"
+#include "staticframe.h"
 #include "symtab.h"
 #include "asmstmt.h"
 
@@ -225,6 +227,11 @@ static void ParseGVarArg (StrBuf* T, unsigned Arg)
         return;
     }
 
+    /* The assembler code may take the address of a function */
+    if (StaticFrames && (Sym->Flags & SC_FUNC) == SC_FUNC) {
+        SF_AddRef (Sym);
+    }
+
     /* Check for external linkage */
     if (Sym->Flags & (SC_EXTERN | SC_STORAGE | SC_FUNC)) {
         /* External linkage or a function */
@@ -455,6 +462,11 @@ void AsmStatement (void)
         ParseAsm ();
     }
 
+    /* Inline assembler code may call anything */
+    if (StaticFrames && CurrentFunc) {
+        SF_AddCall (F_GetFuncEntry (CurrentFunc), 0);
+    }
+
     /* Closing paren needed */
     ConsumeRParen ();
 }
@@ -244,7 +244,9 @@ CodeEntry* NewCodeEntry (opc_t OPC, am_t AM, const char* Arg,
     /* Initialize the fields */
     E->OPC    = D->OPC;
     E->AM     = AM;
-    E->Size   = GetInsnSize (E->OPC, E->AM);
+    E->Size    = GetInsnSize (E->OPC, E->AM);
+    E->Cycles  = GetInsnCycles (E->OPC, E->AM);
+    E->Penalty = GetInsnPenalty (E->OPC, E->AM);
     E->Arg    = GetArgCopy (Arg);
     E->Flags  = NumArg (E->Arg, &E->Num)? CEF_NUMARG : 0;   /* Needs E->Arg */
     E->Info   = D->Info;
@@ -288,16 +290,18 @@ void FreeCodeEntry (CodeEntry* E)
 
 void CE_ReplaceOPC (CodeEntry* E, opc_t OPC)
 /* Replace the opcode of the instruction. This will also replace related info,
-** Size, Use and Chg, but it will NOT update any arguments or labels.
+** Size, Cycles, Use and Chg, but it will NOT update any arguments or labels.
 */
 {
     /* Get the opcode descriptor */
     const OPCDesc* D = GetOPCDesc (OPC);
 
     /* Replace the opcode */
-    E->OPC  = OPC;
-    E->Info = D->Info;
-    E->Size = GetInsnSize (E->OPC, E->AM);
+    E->OPC     = OPC;
+    E->Info    = D->Info;
+    E->Size    = GetInsnSize (E->OPC, E->AM);
+    E->Cycles  = GetInsnCycles (E->OPC, E->AM);
+    E->Penalty = GetInsnPenalty (E->OPC, E->AM);
     SetUseChgInfo (E, D);
 }
 
@@ -1472,11 +1476,15 @@ void CE_Output (const CodeEntry* E)
     if (Debug) {
         char Use [128];
         char Chg [128];
-        WriteOutput ("%*s; USE: %-12s CHG: %-12s SIZE: %u",
+        WriteOutput ("%*s; USE: %-12s CHG: %-12s SIZE: %u  CYCLES: %u",
                      (int)(30-Chars), "",
                      RegInfoDesc (E->Use, Use),
                      RegInfoDesc (E->Chg, Chg),
-                     E->Size);
+                     E->Size,
+                     E->Cycles);
+        if (E->Penalty) {
+            WriteOutput ("+%u", E->Penalty);
+        }
 
         if (E->RI) {
             char RegIn[32];
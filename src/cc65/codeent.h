@@ -61,6 +61,7 @@
 /* Flags used */
 #define CEF_USERMARK    0x0001U         /* Generic mark by user functions */
 #define CEF_NUMARG      0x0002U         /* Insn has numerical argument */
+#define CEF_CASECMP     0x0004U         /* Compare of a switch case chain */
 
 /* Code entry structure */
 typedef struct CodeEntry CodeEntry;
@@ -68,6 +69,8 @@ struct CodeEntry {
     unsigned char       OPC;            /* Opcode */
     unsigned char       AM;             /* Adressing mode */
     unsigned char       Size;           /* Estimated size */
+    unsigned char       Cycles;         /* Estimated cycles */
+    unsigned char       Penalty;        /* Max. extra cycles */
     unsigned char       Flags;          /* Flags */
     char*               Arg;            /* Argument as string */
     unsigned long       Num;            /* Numeric argument */
@@ -183,6 +186,26 @@ INLINE void CE_ResetMark (CodeEntry* E)
 #  define CE_ResetMark(E)       ((E)->Flags &= ~CEF_USERMARK)
 #endif
 
+#if defined(HAVE_INLINE)
+INLINE int CE_IsCaseCmp (const CodeEntry* E)
+/* Return true if the instruction is a compare of a switch case chain */
+{
+    return (E->Flags & CEF_CASECMP) != 0;
+}
+#else
+#  define CE_IsCaseCmp(E)       (((E)->Flags & CEF_CASECMP) != 0)
+#endif
+
+#if defined(HAVE_INLINE)
+INLINE void CE_SetCaseCmp (CodeEntry* E)
+/* Mark the instruction as a compare of a switch case chain */
+{
+    E->Flags |= CEF_CASECMP;
+}
+#else
+#  define CE_SetCaseCmp(E)      ((E)->Flags |= CEF_CASECMP)
+#endif
+
 #if defined(HAVE_INLINE)
 INLINE int CE_HasNumArg (const CodeEntry* E)
 /* Return true if the instruction has a numeric argument */
@@ -50,6 +50,7 @@
 #include "asmlabel.h"
 #include "casenode.h"
 #include "codeseg.h"
+#include "coptswitch.h"
 #include "dataseg.h"
 #include "error.h"
 #include "global.h"
@@ -340,9 +341,22 @@ void g_defcodelabel (unsigned label)
 
 
 
+static void g_newsection (void)
+/* Start a new section for a data object if requested, so the linker may
+** remove it if it isn't used.
+*/
+{
+    if (FunctionSections) {
+        AddDataLine (".section");
+    }
+}
+
+
+
 void g_defdatalabel (unsigned label)
 /* Define a local data label */
 {
+    g_newsection ();
     AddDataLine ("%s:", LocalLabelName (label));
 }
 
@@ -366,6 +380,14 @@ void g_aliasdatalabel (unsigned label, unsigned baselabel, long offs)
 
 
 
+void g_aliasregbank (unsigned label, unsigned offs)
+/* Define label as a local alias for regbank+offs */
+{
+    AddDataLine ("%s\t:=\tregbank+%u", LocalLabelName (label), offs);
+}
+
+
+
 /*****************************************************************************/
 /*                     Functions handling global labels                      */
 /*****************************************************************************/
@@ -376,6 +398,7 @@ void g_defgloblabel (const char* Name)
 /* Define a global label with the given name */
 {
     /* Global labels are always data labels */
+    g_newsection ();
     AddDataLine ("_%s:", Name);
 }
 
@@ -2539,6 +2562,334 @@ void g_rsub (unsigned flags, unsigned long val)
 
 
 
+/* Size and average cycles of a multiplication by a constant using the generic
+** runtime routines, including pushing the lhs and loading the constant.
+*/
+#define MUL_INT_CALL_SIZE       10
+#define MUL_INT_CALL_CYCLES     400
+#define MUL_LONG_CALL_SIZE      16
+#define MUL_LONG_CALL_CYCLES    1800
+
+/* Maximum number of helper calls for a multiplication by a constant */
+#define MUL_MAX_HELPERS         4
+
+/* Maximum number of digits of a constant multiplier in an add/shift chain */
+#define MUL_MAX_DIGITS          33
+
+/* Runtime helpers that multiply the primary register by a small constant */
+static const struct {
+    unsigned long       Factor;
+    const char*         Name;
+    unsigned            Cycles;
+} MulHelpers[] = {
+    {  3,   "mulax3",   44      },
+    {  5,   "mulax5",   51      },
+    {  6,   "mulax6",   50      },
+    {  7,   "mulax7",   60      },
+    {  9,   "mulax9",   58      },
+    { 10,   "mulax10",  57      },
+};
+#define MUL_HELPER_COUNT        (sizeof (MulHelpers) / sizeof (MulHelpers[0]))
+
+
+
+static void MulShiftCost (unsigned Bits, int IsLong, unsigned* Size, unsigned* Cycles)
+/* Return size and cycles of the code generated by g_asl */
+{
+    /* Cycles per bit of the shift subroutines */
+    unsigned BitCycles = IsLong? 17 : 7;
+
+    *Size   = 0;
+    *Cycles = 0;
+    if (IsLong && Bits >= 16) {
+        *Size   += 7;
+        *Cycles += 12;
+        Bits    -= 16;
+    }
+    if (Bits >= 8) {
+        *Size   += IsLong? 9 : 3;
+        *Cycles += IsLong? 14 : 4;
+        Bits    -= 8;
+    }
+    if (Bits >= 4) {
+        *Size   += 3;
+        *Cycles += 18 + BitCycles * 4;
+        Bits    -= 4;
+    }
+    if (Bits > 0) {
+        *Size   += 3;
+        *Cycles += 18 + BitCycles * Bits;
+    }
+}
+
+
+
+static int MulHelperChain (unsigned long Val, unsigned MaxSteps,
+                           unsigned long* Factors, unsigned* Size,
+                           unsigned* Cycles)
+/* Find the fastest way to multiply an int by Val using at most MaxSteps
+** calls of the multiplication and shift helpers. On success, store the
+** factors, the size and the cycles, and return the number of steps. Return
+** -1 if Val can't be factored this way.
+*/
+{
+    unsigned long SubFactors[MUL_MAX_HELPERS];
+    unsigned      SubSize, SubCycles;
+    int           Steps = -1;
+    unsigned      I;
+
+    *Size   = 0;
+    *Cycles = 0;
+    if (Val == 1) {
+        return 0;
+    }
+    if (Val == 0 || MaxSteps == 0) {
+        return -1;
+    }
+
+    /* Try a shift by the power of two contained in Val, then the helpers */
+    for (I = 0; I <= MUL_HELPER_COUNT; ++I) {
+
+        unsigned long F;
+        unsigned      S, C;
+        int           N;
+
+        if (I == 0) {
+            unsigned Bits = 0;
+            while ((Val & (1UL << Bits)) == 0) {
+                ++Bits;
+            }
+            if (Bits == 0) {
+                continue;
+            }
+            F = 1UL << Bits;
+            MulShiftCost (Bits, 0, &S, &C);
+        } else {
+            F = MulHelpers[I-1].Factor;
+            if (Val % F != 0) {
+                continue;
+            }
+            S = 3;
+            C = MulHelpers[I-1].Cycles;
+        }
+
+        N = MulHelperChain (Val / F, MaxSteps - 1, SubFactors, &SubSize, &SubCycles);
+        if (N >= 0 && (Steps < 0 || C + SubCycles < *Cycles)) {
+            Steps      = N + 1;
+            *Size      = S + SubSize;
+            *Cycles    = C + SubCycles;
+            Factors[0] = F;
+            memcpy (Factors + 1, SubFactors, N * sizeof (SubFactors[0]));
+        }
+    }
+
+    return Steps;
+}
+
+
+
+static unsigned MulChainDigits (unsigned long Val, int NAF, signed char* Digits)
+/* Store the digits of Val, lowest first, and return their count. If NAF is
+** true, use the non adjacent form with the digits -1, 0 and 1, which has the
+** fewest non zero digits, otherwise use the binary digits. Val must be less
+** than 2^31.
+*/
+{
+    unsigned Count = 0;
+    while (Val != 0) {
+        signed char D = 0;
+        if (Val & 0x01) {
+            D = (NAF && (Val & 0x03) == 0x03)? -1 : 1;
+            Val = (D < 0)? Val + 1 : Val - 1;
+        }
+        Digits[Count++] = D;
+        Val >>= 1;
+    }
+    return Count;
+}
+
+
+
+static void MulChainCost (const signed char* Digits, unsigned Count,
+                          int IsLong, unsigned* Size, unsigned* Cycles)
+/* Return size and cycles of the add/shift chain for the given digits */
+{
+    /* Save the operand, shift, add or subtract, load the high byte */
+    static const unsigned char Sizes[2][4]  = { { 6, 3, 11, 2 }, { 14, 7, 21, 2 } };
+    static const unsigned char Timing[2][4] = { { 9, 7, 18, 3 }, { 21, 17, 36, 3 } };
+
+    unsigned I;
+
+    *Size   = Sizes[IsLong][0] + Sizes[IsLong][3];
+    *Cycles = Timing[IsLong][0] + Timing[IsLong][3];
+    for (I = 0; I + 1 < Count; ++I) {
+        *Size   += Sizes[IsLong][1];
+        *Cycles += Timing[IsLong][1];
+        if (Digits[I] != 0) {
+            *Size   += Sizes[IsLong][2];
+            *Cycles += Timing[IsLong][2];
+        }
+    }
+}
+
+
+
+static void MulChainEmit (const signed char* Digits, unsigned Count, int IsLong)
+/* Multiply the primary register by the constant with the given digits. The
+** operand is saved in ptr1 (and ptr2 for longs), and the result is built in
+** a, tmp1 (and sreg for longs).
+*/
+{
+    static const char* const AddOps[2] = { "clc", "adc" };
+    static const char* const SubOps[2] = { "sec", "sbc" };
+
+    AddCodeLine ("sta ptr1");
+    AddCodeLine ("stx ptr1+1");
+    AddCodeLine ("stx tmp1");
+    if (IsLong) {
+        AddCodeLine ("ldy sreg");
+        AddCodeLine ("sty ptr2");
+        AddCodeLine ("ldy sreg+1");
+        AddCodeLine ("sty ptr2+1");
+    }
+
+    /* The highest digit is always one, start with the operand and process
+    ** the remaining digits by Horner's method.
+    */
+    while (Count-- > 1) {
+
+        const char* const* Ops;
+
+        AddCodeLine ("asl a");
+        AddCodeLine ("rol tmp1");
+        if (IsLong) {
+            AddCodeLine ("rol sreg");
+            AddCodeLine ("rol sreg+1");
+        }
+
+        if (Digits[Count-1] == 0) {
+            continue;
+        }
+        Ops = (Digits[Count-1] > 0)? AddOps : SubOps;
+        AddCodeLine ("%s", Ops[0]);
+        AddCodeLine ("%s ptr1", Ops[1]);
+        AddCodeLine ("tay");
+        AddCodeLine ("lda tmp1");
+        AddCodeLine ("%s ptr1+1", Ops[1]);
+        AddCodeLine ("sta tmp1");
+        if (IsLong) {
+            AddCodeLine ("lda sreg");
+            AddCodeLine ("%s ptr2", Ops[1]);
+            AddCodeLine ("sta sreg");
+            AddCodeLine ("lda sreg+1");
+            AddCodeLine ("%s ptr2+1", Ops[1]);
+            AddCodeLine ("sta sreg+1");
+        }
+        AddCodeLine ("tya");
+    }
+
+    AddCodeLine ("ldx tmp1");
+}
+
+
+
+static int MulByConst (unsigned flags, unsigned long val)
+/* Try to multiply the primary register by the constant val without calling
+** the generic multiplication, using a sequence of helper calls for ints or
+** an inline add/shift chain. The fastest sequence is used whose size relative
+** to the call of the generic routine is allowed by the code size factor.
+** Return true if code was generated.
+*/
+{
+    unsigned long Factors[MUL_MAX_HELPERS];
+    signed char   Digits[MUL_MAX_DIGITS];
+    signed char   NAFDigits[MUL_MAX_DIGITS];
+    unsigned      Count, NAFCount;
+    unsigned      Size, Cycles, NAFSize, NAFCycles;
+    unsigned      MaxSize, BestCycles;
+    unsigned      Shift;
+    int           Steps;
+    int           IsLong = ((flags & CF_TYPEMASK) == CF_LONG);
+
+    /* Determine the limits */
+    if (IsLong) {
+        MaxSize    = MUL_LONG_CALL_SIZE * IS_Get (&CodeSizeFactor) / 100;
+        BestCycles = MUL_LONG_CALL_CYCLES;
+        val &= 0xFFFFFFFFUL;
+    } else {
+        MaxSize    = MUL_INT_CALL_SIZE * IS_Get (&CodeSizeFactor) / 100;
+        BestCycles = MUL_INT_CALL_CYCLES;
+        val &= 0xFFFFUL;
+    }
+    if (val < 2 || val >= 0x80000000UL) {
+        return 0;
+    }
+
+    /* Try the helpers for ints */
+    Steps = -1;
+    if (!IsLong) {
+        Steps = MulHelperChain (val, MUL_MAX_HELPERS, Factors, &Size, &Cycles);
+        if (Steps >= 0 && Size <= MaxSize && Cycles < BestCycles) {
+            BestCycles = Cycles;
+        } else {
+            Steps = -1;
+        }
+    }
+
+    /* Try an add/shift chain for the odd part of val followed by a shift,
+    ** using the cheaper digit representation.
+    */
+    Shift = 0;
+    while ((val & (1UL << Shift)) == 0) {
+        ++Shift;
+    }
+    Count    = MulChainDigits (val >> Shift, 0, Digits);
+    NAFCount = MulChainDigits (val >> Shift, 1, NAFDigits);
+    MulChainCost (Digits, Count, IsLong, &Size, &Cycles);
+    MulChainCost (NAFDigits, NAFCount, IsLong, &NAFSize, &NAFCycles);
+    if (NAFCycles < Cycles) {
+        memcpy (Digits, NAFDigits, NAFCount);
+        Count  = NAFCount;
+        Size   = NAFSize;
+        Cycles = NAFCycles;
+    }
+    if (Shift > 0) {
+        MulShiftCost (Shift, IsLong, &NAFSize, &NAFCycles);
+        Size   += NAFSize;
+        Cycles += NAFCycles;
+    }
+    if (Count > 1 && Size <= MaxSize && Cycles < BestCycles) {
+        MulChainEmit (Digits, Count, IsLong);
+        if (Shift > 0) {
+            g_asl (flags, Shift);
+        }
+        return 1;
+    }
+
+    /* Use the helpers if they are faster than the generic routine */
+    if (Steps >= 0) {
+        int I;
+        for (I = 0; I < Steps; ++I) {
+            int P2 = PowerOf2 (Factors[I]);
+            if (P2 >= 0) {
+                g_asl (flags, P2);
+            } else {
+                unsigned J = 0;
+                while (MulHelpers[J].Factor != Factors[I]) {
+                    ++J;
+                }
+                AddCodeLine ("jsr %s", MulHelpers[J].Name);
+            }
+        }
+        return 1;
+    }
+
+    /* No way found */
+    return 0;
+}
+
+
+
 void g_mul (unsigned flags, unsigned long val)
 /* Primary = TOS * Primary */
 {
@@ -2603,29 +2954,10 @@ void g_mul (unsigned flags, unsigned long val)
                 /* FALLTHROUGH */
 
             case CF_INT:
-                switch (val) {
-                    case 3:
-                        AddCodeLine ("jsr mulax3");
-                        return;
-                    case 5:
-                        AddCodeLine ("jsr mulax5");
-                        return;
-                    case 6:
-                        AddCodeLine ("jsr mulax6");
-                        return;
-                    case 7:
-                        AddCodeLine ("jsr mulax7");
-                        return;
-                    case 9:
-                        AddCodeLine ("jsr mulax9");
-                        return;
-                    case 10:
-                        AddCodeLine ("jsr mulax10");
-                        return;
-                }
-                break;
-
             case CF_LONG:
+                if (MulByConst (flags, val)) {
+                    return;
+                }
                 break;
 
             default:
@@ -2646,6 +2978,54 @@ void g_mul (unsigned flags, unsigned long val)
 
 
 
+static const char* UDivHelper (unsigned long val)
+/* Return the name of the runtime helper that divides the primary register by
+** the unsigned constant val without a loop, or NULL if there is none.
+*/
+{
+    switch (val) {
+        case 3:         return "udivax3";
+        case 5:         return "udivax5";
+        case 7:         return "udivax7";
+        case 10:        return "udivax10";
+        case 100:       return "udivax100";
+        default:        return 0;
+    }
+}
+
+
+
+static int UDivShift (unsigned long val)
+/* If val is d * 2^n, where d has a division helper, return n, otherwise
+** return -1.
+*/
+{
+    int n = 0;
+    while (val != 0 && UDivHelper (val) == 0) {
+        if ((val & 0x01) != 0) {
+            return -1;
+        }
+        val >>= 1;
+        ++n;
+    }
+    return (val != 0)? n : -1;
+}
+
+
+
+static unsigned UDivPrepare (unsigned flags)
+/* Make sure the lhs in the primary is a complete int before calling one of
+** the division helpers, and return the flags for operating on it.
+*/
+{
+    if ((flags & CF_TYPEMASK) == CF_CHAR && (flags & CF_FORCECHAR)) {
+        AddCodeLine ("ldx #$00");
+    }
+    return (flags & ~(CF_TYPEMASK | CF_FORCECHAR)) | CF_INT;
+}
+
+
+
 void g_div (unsigned flags, unsigned long val)
 /* Primary = TOS / Primary */
 {
@@ -2658,6 +3038,17 @@ void g_div (unsigned flags, unsigned long val)
     if ((flags & CF_CONST) && (p2 = PowerOf2 (val)) >= 0) {
         /* Generate a shift instead */
         g_asr (flags, p2);
+    } else if ((flags & CF_CONST) && (flags & CF_UNSIGNED) &&
+               (flags & CF_TYPEMASK) != CF_LONG &&
+               (p2 = UDivShift (val)) >= 0) {
+        /* Shift by the power of two contained in the divisor, and divide by
+        ** the remaining factor using a helper.
+        */
+        flags = UDivPrepare (flags);
+        if (p2 > 0) {
+            g_asr (flags, p2);
+        }
+        AddCodeLine ("jsr %s", UDivHelper (val >> p2));
     } else {
         /* Generate a division */
         if (flags & CF_CONST) {
@@ -2683,6 +3074,13 @@ void g_mod (unsigned flags, unsigned long val)
     if ((flags & CF_CONST) && (flags & CF_UNSIGNED) && val != 0xFFFFFFFF && (p2 = PowerOf2 (val)) >= 0) {
         /* We can do that with an AND operation */
         g_and (flags, val - 1);
+    } else if ((flags & CF_CONST) && (flags & CF_UNSIGNED) &&
+               (flags & CF_TYPEMASK) != CF_LONG && UDivHelper (val) != 0) {
+        /* The division helpers return the remainder in Y */
+        UDivPrepare (flags);
+        AddCodeLine ("jsr %s", UDivHelper (val));
+        AddCodeLine ("tya");
+        AddCodeLine ("ldx #$00");
     } else {
         /* Do it the hard way... */
         if (flags & CF_CONST) {
@@ -4109,6 +4507,169 @@ void g_ge (unsigned flags, unsigned long val)
 
 
 
+/*****************************************************************************/
+/*                  Long operations with an operand in memory                */
+/*****************************************************************************/
+
+
+
+static unsigned LongOpStaticSize (void (*Gen) (unsigned, unsigned long),
+                                  unsigned Flags)
+/* Return the size of the code generated by g_longopstatic, or zero if there
+** is no inline code for the operation.
+*/
+{
+    /* Size of an instruction that addresses the variable */
+    unsigned M = ((Flags & CF_ADDRMASK) == CF_REGVAR)? 2 : 3;
+
+    /* Size of the code that turns the flags into a boolean */
+    unsigned B = (Flags & CF_UNSIGNED)? 3 : 10;
+
+    if (Gen == g_add || Gen == g_sub) {
+        return 4 * M + 13;
+    } else if (Gen == g_and || Gen == g_or || Gen == g_xor) {
+        return 4 * M + 12;
+    } else if (Gen == g_eq || Gen == g_ne) {
+        return 4 * M + 13;
+    } else if (Gen == g_lt || Gen == g_ge) {
+        return 4 * M + 5 + B;
+    } else if (Gen == g_gt || Gen == g_le) {
+        return 4 * M + 12 + B;
+    } else {
+        return 0;
+    }
+}
+
+
+
+int g_inlinelongop (void (*Gen) (unsigned, unsigned long), unsigned Flags)
+/* Return true if the binary long operation with the generator function Gen
+** should be done by g_longopstatic instead of pushing the lhs and calling the
+** runtime. Flags contain the type and the address flags of the rhs.
+*/
+{
+    unsigned M    = ((Flags & CF_ADDRMASK) == CF_REGVAR)? 2 : 3;
+    unsigned Size = LongOpStaticSize (Gen, Flags);
+
+    /* pusheax, loading the variable into eax and calling the runtime */
+    unsigned CallSize = 3 + (4 * M + 4) + 3;
+
+    return Size != 0 && Size * 100 <= CallSize * IS_Get (&CodeSizeFactor);
+}
+
+
+
+void g_longopstatic (void (*Gen) (unsigned, unsigned long), unsigned Flags,
+                     unsigned long Label, long Offs)
+/* Primary = Primary <op> long variable in memory. Gen is the generator
+** function of the operation and must have been accepted by g_inlinelongop.
+*/
+{
+    char     Op[4][256];
+    unsigned I;
+    unsigned L;
+
+    /* Create the names of the four bytes of the variable */
+    for (I = 0; I < 4; ++I) {
+        strcpy (Op[I], GetLabelName (Flags, Label, Offs + I));
+    }
+
+    if (Gen == g_eq || Gen == g_ne) {
+
+        /* Compare from the low to the high byte, stop at the first
+        ** difference.
+        */
+        L = GetLocalLabel ();
+        AddCodeLine ("cmp %s", Op[0]);
+        AddCodeLine ("bne %s", LocalLabelName (L));
+        AddCodeLine ("cpx %s", Op[1]);
+        AddCodeLine ("bne %s", LocalLabelName (L));
+        AddCodeLine ("lda sreg");
+        AddCodeLine ("cmp %s", Op[2]);
+        AddCodeLine ("bne %s", LocalLabelName (L));
+        AddCodeLine ("lda sreg+1");
+        AddCodeLine ("cmp %s", Op[3]);
+        g_defcodelabel (L);
+        AddCodeLine ("jsr %s", (Gen == g_eq)? "booleq" : "boolne");
+
+    } else if (Gen == g_lt || Gen == g_ge || Gen == g_gt || Gen == g_le) {
+
+        /* Subtract the rhs from the lhs for < and >=, and the lhs from the
+        ** rhs for > and <=, so the condition is always "less" or "not less".
+        */
+        int Less = (Gen == g_lt || Gen == g_gt);
+        if (Gen == g_lt || Gen == g_ge) {
+            AddCodeLine ("cmp %s", Op[0]);
+            AddCodeLine ("txa");
+            AddCodeLine ("sbc %s", Op[1]);
+            AddCodeLine ("lda sreg");
+            AddCodeLine ("sbc %s", Op[2]);
+            AddCodeLine ("lda sreg+1");
+            AddCodeLine ("sbc %s", Op[3]);
+        } else {
+            AddCodeLine ("sta ptr1");
+            AddCodeLine ("stx ptr1+1");
+            AddCodeLine ("lda %s", Op[0]);
+            AddCodeLine ("cmp ptr1");
+            AddCodeLine ("lda %s", Op[1]);
+            AddCodeLine ("sbc ptr1+1");
+            AddCodeLine ("lda %s", Op[2]);
+            AddCodeLine ("sbc sreg");
+            AddCodeLine ("lda %s", Op[3]);
+            AddCodeLine ("sbc sreg+1");
+        }
+        if (Flags & CF_UNSIGNED) {
+            AddCodeLine ("jsr %s", Less? "boolult" : "booluge");
+        } else {
+            /* The sign of the difference is N xor V */
+            L = GetLocalLabel ();
+            AddCodeLine ("%s %s", Less? "bvc" : "bvs", LocalLabelName (L));
+            AddCodeLine ("eor #$80");
+            g_defcodelabel (L);
+            AddCodeLine ("asl a");          /* Bit 7 -> carry */
+            AddCodeLine ("lda #$00");
+            AddCodeLine ("ldx #$00");
+            AddCodeLine ("rol a");
+        }
+
+    } else {
+
+        /* Arithmetic and bitwise operations work the same on all bytes */
+        const char* Ins;
+        if (Gen == g_add) {
+            AddCodeLine ("clc");
+            Ins = "adc";
+        } else if (Gen == g_sub) {
+            AddCodeLine ("sec");
+            Ins = "sbc";
+        } else if (Gen == g_and) {
+            Ins = "and";
+        } else if (Gen == g_or) {
+            Ins = "ora";
+        } else if (Gen == g_xor) {
+            Ins = "eor";
+        } else {
+            Internal ("g_longopstatic: Invalid operation");
+            return;
+        }
+        AddCodeLine ("%s %s", Ins, Op[0]);
+        AddCodeLine ("tay");
+        AddCodeLine ("txa");
+        AddCodeLine ("%s %s", Ins, Op[1]);
+        AddCodeLine ("tax");
+        AddCodeLine ("lda sreg");
+        AddCodeLine ("%s %s", Ins, Op[2]);
+        AddCodeLine ("sta sreg");
+        AddCodeLine ("lda sreg+1");
+        AddCodeLine ("%s %s", Ins, Op[3]);
+        AddCodeLine ("sta sreg+1");
+        AddCodeLine ("tya");
+
+    }
+}
+
+
+
 /*****************************************************************************/
 /*                         Allocating static storage                         */
 /*****************************************************************************/
@@ -4288,35 +4849,23 @@ void g_initstatic (unsigned InitLabel, unsigned VarLabel, unsigned Size)
 
 
 
-void g_switch (Collection* Nodes, unsigned DefaultLabel, unsigned Depth)
-/* Generate code for a switch statement */
+/* Minimum number of case values on one level for a binary search */
+#define SWITCH_BSEARCH_MIN      8
+
+
+
+static void g_casechain (Collection* Nodes, unsigned First, unsigned Last,
+                         unsigned DefaultLabel, unsigned Depth,
+                         const char* Compare)
+/* Generate a linear chain of compares for the case nodes First to Last of one
+** level of a switch statement.
+*/
 {
     unsigned NextLabel = 0;
     unsigned I;
 
-    /* Setup registers and determine which compare insn to use */
-    const char* Compare;
-    switch (Depth) {
-        case 1:
-            Compare = "cmp #$%02X";
-            break;
-        case 2:
-            Compare = "cpx #$%02X";
-            break;
-        case 3:
-            AddCodeLine ("ldy sreg");
-            Compare = "cpy #$%02X";
-            break;
-        case 4:
-            AddCodeLine ("ldy sreg+1");
-            Compare = "cpy #$%02X";
-            break;
-        default:
-            Internal ("Invalid depth in g_switch: %u", Depth);
-    }
-
     /* Walk over all nodes */
-    for (I = 0; I < CollCount (Nodes); ++I) {
+    for (I = First; I <= Last; ++I) {
 
         /* Get the next case node */
         CaseNode* N = CollAtUnchecked (Nodes, I);
@@ -4333,13 +4882,16 @@ void g_switch (Collection* Nodes, unsigned DefaultLabel, unsigned Depth)
         /* If this is the last level, jump directly to the case code if found */
         if (Depth == 1) {
 
+            /* Allow the optimizer to replace the chain by a jump table */
+            MarkCaseCompare (CS->Code);
+
             /* Branch if equal */
             g_falsejump (0, CN_GetLabel (N));
 
         } else {
 
             /* Determine the next label */
-            if (I == CollCount (Nodes) - 1) {
+            if (I == Last) {
                 /* Last node means not found */
                 g_truejump (0, DefaultLabel);
             } else {
@@ -4360,6 +4912,99 @@ void g_switch (Collection* Nodes, unsigned DefaultLabel, unsigned Depth)
 
 
 
+static void g_casesearch (Collection* Nodes, unsigned First, unsigned Last,
+                          unsigned DefaultLabel, unsigned Depth,
+                          const char* Compare)
+/* Generate a binary search for the case nodes First to Last of one level of
+** a switch statement. Small ranges are handled by a compare chain.
+*/
+{
+    unsigned  Mid;
+    unsigned  UpperLabel;
+    CaseNode* N;
+
+    /* Use a linear chain if there are only a few nodes */
+    if (Last - First + 1 < SWITCH_BSEARCH_MIN) {
+        g_casechain (Nodes, First, Last, DefaultLabel, Depth, Compare);
+        return;
+    }
+
+    /* Compare against the node in the middle */
+    Mid = (First + Last) / 2;
+    N = CollAtUnchecked (Nodes, Mid);
+    AddCodeLine (Compare, CN_GetValue (N));
+    if (Depth == 1) {
+        g_falsejump (0, CN_GetLabel (N));
+    } else {
+        unsigned NextLabel = GetLocalLabel ();
+        g_truejump (0, NextLabel);
+        g_switch (N->Nodes, DefaultLabel, Depth-1);
+        g_defcodelabel (NextLabel);
+    }
+
+    /* The carry flag is still set from the compare. If it is set, the value
+    ** is greater than the one we compared against.
+    */
+    UpperLabel = GetLocalLabel ();
+    AddCodeLine ("jcs %s", LocalLabelName (UpperLabel));
+
+    /* Search both halves */
+    g_casesearch (Nodes, First, Mid-1, DefaultLabel, Depth, Compare);
+    g_defcodelabel (UpperLabel);
+    g_casesearch (Nodes, Mid+1, Last, DefaultLabel, Depth, Compare);
+}
+
+
+
+void g_switch (Collection* Nodes, unsigned DefaultLabel, unsigned Depth)
+/* Generate code for a switch statement */
+{
+    unsigned Count = CollCount (Nodes);
+    unsigned Range;
+
+    /* Setup registers and determine which compare insn to use */
+    const char* Compare;
+    switch (Depth) {
+        case 1:
+            Compare = "cmp #$%02X";
+            break;
+        case 2:
+            Compare = "cpx #$%02X";
+            break;
+        case 3:
+            AddCodeLine ("ldy sreg");
+            Compare = "cpy #$%02X";
+            break;
+        case 4:
+            AddCodeLine ("ldy sreg+1");
+            Compare = "cpy #$%02X";
+            break;
+        default:
+            Internal ("Invalid depth in g_switch: %u", Depth);
+    }
+
+    /* Without any nodes, there is nothing to compare */
+    if (Count == 0) {
+        g_jump (DefaultLabel);
+        return;
+    }
+
+    /* Dense case values in the last byte are turned into a jump table by the
+    ** optimizer, which expects a compare chain. Otherwise use a binary search
+    ** if there are many values.
+    */
+    Range = CN_GetValue ((CaseNode*) CollLast (Nodes)) -
+            CN_GetValue ((CaseNode*) CollAtUnchecked (Nodes, 0)) + 1;
+    if (Depth == 1 && CS->Code->Optimize &&
+        SwitchTableIsProfitable (CS->Code, Count, Range)) {
+        g_casechain (Nodes, 0, Count - 1, DefaultLabel, Depth, Compare);
+    } else {
+        g_casesearch (Nodes, 0, Count - 1, DefaultLabel, Depth, Compare);
+    }
+}
+
+
+
 /*****************************************************************************/
 /*                       User supplied assembler code                        */
 /*****************************************************************************/
@@ -146,6 +146,9 @@ void g_defdatalabel (unsigned label);
 void g_aliasdatalabel (unsigned label, unsigned baselabel, long offs);
 /* Define label as a local alias for baselabel+offs */
 
+void g_aliasregbank (unsigned label, unsigned offs);
+/* Define label as a local alias for regbank+offs */
+
 
 
 /*****************************************************************************/
@@ -440,6 +443,18 @@ void g_le (unsigned flags, unsigned long val);
 void g_gt (unsigned flags, unsigned long val);
 void g_ge (unsigned flags, unsigned long val);
 
+int g_inlinelongop (void (*Gen) (unsigned, unsigned long), unsigned Flags);
+/* Return true if the binary long operation with the generator function Gen
+** should be done by g_longopstatic instead of pushing the lhs and calling the
+** runtime. Flags contain the type and the address flags of the rhs.
+*/
+
+void g_longopstatic (void (*Gen) (unsigned, unsigned long), unsigned Flags,
+                     unsigned long Label, long Offs);
+/* Primary = Primary <op> long variable in memory. Gen is the generator
+** function of the operation and must have been accepted by g_inlinelongop.
+*/
+
 void g_res (unsigned n);
 /* Reserve static storage, n bytes */
 
@@ -333,6 +333,11 @@ static const FuncInfo FuncInfoTable[] = {
     { "tosxorax",       REG_AX,               REG_AXY | REG_TMP1             },
     { "tosxoreax",      REG_EAX,              REG_EAXY | REG_TMP1            },
     { "tsteax",         REG_EAX,              REG_Y                          },
+    { "udivax10",       REG_AX,               REG_EAXY | REG_PTR1 | REG_TMP1 },
+    { "udivax100",      REG_AX,               REG_EAXY | REG_PTR1 | REG_TMP1 },
+    { "udivax3",        REG_AX,               REG_EAXY | REG_PTR1 | REG_TMP1 },
+    { "udivax5",        REG_AX,               REG_EAXY | REG_PTR1 | REG_TMP1 },
+    { "udivax7",        REG_AX,               REG_EAXY | REG_PTR1 | REG_TMP1 },
     { "utsteax",        REG_EAX,              REG_Y                          },
 };
 #define FuncInfoCount   (sizeof(FuncInfoTable) / sizeof(FuncInfoTable[0]))
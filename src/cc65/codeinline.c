@@ -0,0 +1,310 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                codeinline.c                               */
+/*                                                                           */
+/*                   Inline calls of small static functions                  */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <string.h>
+
+/* common */
+#include "coll.h"
+
+/* cc65 */
+#include "codeent.h"
+#include "codeinline.h"
+#include "codelab.h"
+#include "dataseg.h"
+#include "funcdesc.h"
+#include "segments.h"
+#include "symtab.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Maximum size in bytes of the code of a function that is inlined with a
+** code size factor of 100. Functions declared inline may be twice as large.
+*/
+#define INLINE_MAX_SIZE         24
+
+
+
+/*****************************************************************************/
+/*                             Helper functions                              */
+/*****************************************************************************/
+
+
+
+static int IsExternalJump (const CodeEntry* E)
+/* Return true if E is a jump or branch to a label outside of its segment */
+{
+    return (E->Info & OF_BRA) != 0 &&
+           (E->JumpTo == 0 || E->JumpTo->Owner == 0);
+}
+
+
+
+static int HasLocalData (const Segments* Seg)
+/* Return true if the function with the given segments has data of its own.
+** Such data is defined in the scope of the function and cannot be referenced
+** from other functions.
+*/
+{
+    return CollCount (&Seg->Data->Lines)   > 0 ||
+           CollCount (&Seg->ROData->Lines) > 0 ||
+           CollCount (&Seg->BSS->Lines)    > 0;
+}
+
+
+
+static int RefersToLabel (CodeSeg* S, const char* Arg)
+/* Return true if Arg contains the name of one of the labels in S */
+{
+    unsigned I;
+    for (I = 0; I < CS_GetEntryCount (S); ++I) {
+        CodeEntry* E = CS_GetEntry (S, I);
+        unsigned J;
+        for (J = 0; J < CE_GetLabelCount (E); ++J) {
+            if (strstr (Arg, CE_GetLabel (E, J)->Name) != 0) {
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+
+
+static int CanInline (CodeSeg* Callee, unsigned Limit)
+/* Check if the code in Callee can be copied to the place of a call */
+{
+    unsigned Size = 0;
+    unsigned I;
+
+    for (I = 0; I < CS_GetEntryCount (Callee); ++I) {
+
+        CodeEntry* E = CS_GetEntry (Callee, I);
+
+        /* A return becomes a jump behind the call, a tail call a subroutine
+        ** call followed by such a jump. The final return is removed.
+        */
+        if (E->OPC == OP65_RTS) {
+            if (I < CS_GetEntryCount (Callee) - 1) {
+                Size += 3;
+            }
+            continue;
+        }
+        Size += E->Size;
+        if (IsExternalJump (E)) {
+            if (E->OPC != OP65_JMP) {
+                /* Conditional branch out of the function */
+                return 0;
+            }
+            Size += 3;
+        }
+
+        /* Reject anything that depends on being a subroutine or on the
+        ** address of the function code.
+        */
+        if (E->OPC == OP65_RTI || E->OPC == OP65_BRK) {
+            return 0;
+        }
+        if (E->OPC == OP65_JMP && E->AM != AM65_BRA) {
+            /* Indirect jump */
+            return 0;
+        }
+        if (E->Arg != 0 && E->JumpTo == 0 && RefersToLabel (Callee, E->Arg)) {
+            /* A label used other than as a jump target */
+            return 0;
+        }
+    }
+
+    /* Check the size */
+    return Size <= Limit;
+}
+
+
+
+static CodeSeg* GetInlineCallee (const CodeSeg* S, const CodeEntry* E)
+/* If E is a call of a function whose code may replace the call in S, return
+** the code segment of that function. Otherwise return NULL.
+*/
+{
+    SymEntry* Func;
+    unsigned  Limit;
+
+    /* Must be a subroutine call of a C function */
+    if (E->OPC != OP65_JSR || E->Arg[0] != '_') {
+        return 0;
+    }
+
+    /* Must be a static function defined in this translation unit. Calls with
+    ** a variable argument list pass the argument size in Y, and wrappers may
+    ** depend on being called.
+    */
+    Func = FindGlobalSym (E->Arg + 1);
+    if (Func == 0                                                       ||
+        (Func->Flags & (SC_FUNC | SC_DEF | SC_EXTERN)) != (SC_FUNC | SC_DEF) ||
+        Func == S->Func                                                 ||
+        Func->V.F.Seg == 0                                              ||
+        strcmp (Func->AsmName, E->Arg) != 0                             ||
+        (Func->V.F.Func->Flags & (FD_VARIADIC | FD_CALL_WRAPPER)) != 0  ||
+        HasLocalData (Func->V.F.Seg)) {
+        return 0;
+    }
+
+    /* Functions declared inline may be larger */
+    Limit = INLINE_MAX_SIZE * S->CodeSizeFactor / 100;
+    if (Func->Flags & SC_INLINE) {
+        Limit *= 2;
+    }
+
+    /* Check the code */
+    if (!CanInline (Func->V.F.Seg->Code, Limit)) {
+        return 0;
+    }
+
+    /* Ok */
+    return Func->V.F.Seg->Code;
+}
+
+
+
+static unsigned InlineCall (CodeSeg* S, unsigned Index, CodeSeg* Callee)
+/* Replace the call at Index in S by the code in Callee. Return the index of
+** the entry following the inserted code.
+*/
+{
+    Collection Copies = STATIC_COLLECTION_INITIALIZER;
+    CodeEntry* Next   = CS_GetEntry (S, Index + 1);
+    CodeLabel* Cont   = 0;
+    unsigned   Pos    = Index + 1;
+    unsigned   Count  = CS_GetEntryCount (Callee);
+    unsigned   I;
+
+    /* Execution continues behind the call after the final return */
+    if (Count > 0 && CS_GetEntry (Callee, Count - 1)->OPC == OP65_RTS) {
+        --Count;
+    }
+
+    /* Insert a copy of the code behind the call. Remember the first copy of
+    ** each entry, so labels and jumps can be resolved later.
+    */
+    for (I = 0; I < Count; ++I) {
+
+        CodeEntry* E = CS_GetEntry (Callee, I);
+        CodeEntry* X;
+
+        if (E->OPC == OP65_RTS || (E->OPC == OP65_JMP && IsExternalJump (E))) {
+
+            /* A tail call must return here */
+            if (E->OPC == OP65_JMP) {
+                X = NewCodeEntry (OP65_JSR, AM65_ABS, E->Arg, 0, E->LI);
+                CS_InsertEntry (S, X, Pos++);
+                CollAppend (&Copies, X);
+            }
+
+            /* Continue behind the call */
+            if (Cont == 0) {
+                Cont = CS_GenLabel (S, Next);
+            }
+            X = NewCodeEntry (OP65_JMP, AM65_BRA, Cont->Name, Cont, E->LI);
+            if (E->OPC == OP65_RTS) {
+                CollAppend (&Copies, X);
+            }
+
+        } else {
+            X = NewCodeEntry (E->OPC, E->AM, E->Arg, 0, E->LI);
+            CollAppend (&Copies, X);
+        }
+        CS_InsertEntry (S, X, Pos++);
+
+        /* Replace the labels of the original by one new label */
+        if (CE_HasLabel (E)) {
+            CS_GenLabel (S, CollAt (&Copies, I));
+        }
+    }
+
+    /* Let the jumps within the copied code use the new labels. The labels of
+    ** the removed final return are replaced by a label behind the call.
+    */
+    for (I = 0; I < Count; ++I) {
+        CodeEntry* E = CS_GetEntry (Callee, I);
+        if (E->JumpTo != 0 && E->JumpTo->Owner != 0 && E->OPC != OP65_RTS) {
+            CodeLabel* L;
+            unsigned Target = CS_GetEntryIndex (Callee, E->JumpTo->Owner);
+            if (Target < Count) {
+                L = CE_GetLabel ((CodeEntry*) CollAt (&Copies, Target), 0);
+            } else {
+                if (Cont == 0) {
+                    Cont = CS_GenLabel (S, Next);
+                }
+                L = Cont;
+            }
+            CL_AddRef (L, CollAt (&Copies, I));
+        }
+    }
+    DoneCollection (&Copies);
+
+    /* Remove the call. Its labels move to the first inserted entry. */
+    CS_DelEntry (S, Index);
+
+    /* Return the index of the entry following the copy */
+    return Pos - 1;
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void InlineCalls (CodeSeg* S)
+/* Replace calls of small static functions in S by a copy of their code */
+{
+    unsigned I = 0;
+    while (I + 1 < CS_GetEntryCount (S)) {
+
+        CodeSeg* Callee = GetInlineCallee (S, CS_GetEntry (S, I));
+        if (Callee) {
+            /* Don't look at the inserted code again, so recursive functions
+            ** cannot expand endlessly.
+            */
+            I = InlineCall (S, I, Callee);
+        } else {
+            ++I;
+        }
+    }
+}
@@ -56,6 +56,7 @@
 #include "coptc02.h"
 #include "coptcmp.h"
 #include "coptind.h"
+#include "coptloop.h"
 #include "coptneg.h"
 #include "coptptrload.h"
 #include "coptptrstore.h"
@@ -65,6 +66,7 @@
 #include "coptstop.h"
 #include "coptstore.h"
 #include "coptsub.h"
+#include "coptswitch.h"
 #include "copttest.h"
 #include "error.h"
 #include "global.h"
@@ -684,6 +686,7 @@ static OptFunc DOptJumpTarget3  = { OptJumpTarget3,  "OptJumpTarget3",  100, 0,
 static OptFunc DOptLoad1        = { OptLoad1,        "OptLoad1",        100, 0, 0, 0, 0, 0 };
 static OptFunc DOptLoad2        = { OptLoad2,        "OptLoad2",        200, 0, 0, 0, 0, 0 };
 static OptFunc DOptLoad3        = { OptLoad3,        "OptLoad3",          0, 0, 0, 0, 0, 0 };
+static OptFunc DOptLoopCounter  = { OptLoopCounter,  "OptLoopCounter",    0, 0, 0, 0, 0, 0 };
 static OptFunc DOptNegAX1       = { OptNegAX1,       "OptNegAX1",       165, 0, 0, 0, 0, 0 };
 static OptFunc DOptNegAX2       = { OptNegAX2,       "OptNegAX2",       200, 0, 0, 0, 0, 0 };
 static OptFunc DOptRTS          = { OptRTS,          "OptRTS",          100, 0, 0, 0, 0, 0 };
@@ -729,6 +732,7 @@ static OptFunc DOptStoreLoad    = { OptStoreLoad,    "OptStoreLoad",      0, 0,
 static OptFunc DOptSub1         = { OptSub1,         "OptSub1",         100, 0, 0, 0, 0, 0 };
 static OptFunc DOptSub2         = { OptSub2,         "OptSub2",         100, 0, 0, 0, 0, 0 };
 static OptFunc DOptSub3         = { OptSub3,         "OptSub3",         100, 0, 0, 0, 0, 0 };
+static OptFunc DOptSwitchTable  = { OptSwitchTable,  "OptSwitchTable",    0, 0, 0, 0, 0, 0 };
 static OptFunc DOptTest1        = { OptTest1,        "OptTest1",         65, 0, 0, 0, 0, 0 };
 static OptFunc DOptTest2        = { OptTest2,        "OptTest2",         50, 0, 0, 0, 0, 0 };
 static OptFunc DOptTransfers1   = { OptTransfers1,   "OptTransfers1",     0, 0, 0, 0, 0, 0 };
@@ -783,6 +787,7 @@ static OptFunc* OptFuncs[] = {
     &DOptLoad1,
     &DOptLoad2,
     &DOptLoad3,
+    &DOptLoopCounter,
     &DOptNegAX1,
     &DOptNegAX2,
     &DOptPrecalc,
@@ -828,6 +833,7 @@ static OptFunc* OptFuncs[] = {
     &DOptSub1,
     &DOptSub2,
     &DOptSub3,
+    &DOptSwitchTable,
     &DOptTest1,
     &DOptTest2,
     &DOptTransfers1,
@@ -1063,6 +1069,18 @@ static void WriteDebugOutput (CodeSeg* S, const char* Step)
             WriteOutput ("Code after applying `%s':\n", Step);
         }
 
+        /* Output the size and the straight line timing of the code */
+        if (CS_GetEntryCount (S) > 0) {
+            unsigned I, Size = 0;
+            unsigned MaxCycles;
+            unsigned Cycles = CS_GetCycles (S, 0, CS_GetEntryCount (S), &MaxCycles);
+            for (I = 0; I < CS_GetEntryCount (S); ++I) {
+                Size += CS_GetEntry (S, I)->Size;
+            }
+            WriteOutput ("; Size: %u bytes, estimated cycles: %u-%u\n",
+                         Size, Cycles, MaxCycles);
+        }
+
         /* Output the code segment */
         CS_Output (S);
     }
@@ -1076,9 +1094,11 @@ static unsigned RunOptFunc (CodeSeg* S, OptFunc* F, unsigned Max)
     unsigned Changes, C;
 
     /* Don't run the function if it is disabled or if it is prohibited by the
-    ** code size factor
+    ** code size factor. The steps that are gated by the code size factor
+    ** trade size for speed, so they are always run when optimizing for speed.
     */
-    if (F->Disabled || F->CodeSizeFactor > S->CodeSizeFactor) {
+    if (F->Disabled ||
+        (F->CodeSizeFactor > S->CodeSizeFactor && !S->OptimizeSpeed)) {
         return 0;
     }
 
@@ -1263,6 +1283,7 @@ static unsigned RunOptGroup4 (CodeSeg* S)
 
     /* Repeat some of the steps here */
     Changes += RunOptFunc (S, &DOptShift3, 1);
+    Changes += RunOptFunc (S, &DOptLoopCounter, 1);
     Changes += RunOptFunc (S, &DOptPush1, 1);
     Changes += RunOptFunc (S, &DOptPush2, 1);
     Changes += RunOptFunc (S, &DOptUnusedLoads, 1);
@@ -1376,6 +1397,16 @@ static unsigned RunOptGroup7 (CodeSeg* S)
         Changes += RunOptFunc (S, &DOptDeadCode, 1);
     }
 
+    /* Replace dense compare chains by jump tables. This must be the last
+    ** step that changes labels, since the jump targets are not visible for
+    ** the optimizer afterwards. Branch distances must be adjusted again.
+    */
+    C = RunOptFunc (S, &DOptSwitchTable, 1);
+    Changes += C;
+    if (C) {
+        Changes += RunOptFunc (S, &DOptBranchDist, 3);
+    }
+
     /* Return the number of changes */
     return Changes;
 }
@@ -483,6 +483,8 @@ CodeSeg* NewCodeSeg (const char* SegName, SymEntry* Func)
 
     /* Copy the global optimization settings */
     S->Optimize       = (unsigned char) IS_Get (&Optimize);
+    S->OptimizeSpeed  = (unsigned char) IS_Get (&OptimizeSpeed);
+    S->InlineFuncs    = (unsigned char) IS_Get (&InlineFuncs);
     S->CodeSizeFactor = (unsigned) IS_Get (&CodeSizeFactor);
 
     /* Return the new struct */
@@ -767,6 +769,33 @@ int CS_RangeHasLabel (CodeSeg* S, unsigned Start, unsigned Count)
 
 
 
+unsigned CS_GetCycles (CodeSeg* S, unsigned Start, unsigned Count,
+                       unsigned* MaxCycles)
+/* Return the estimated number of cycles needed to execute each of the code
+** entries in the given range once. If MaxCycles is not NULL, the estimate
+** including all page crossing and taken branch penalties is stored there.
+*/
+{
+    unsigned Cycles  = 0;
+    unsigned Penalty = 0;
+
+    /* Sum up the timing of all entries */
+    CHECK (Start + Count <= CS_GetEntryCount (S));
+    while (Count--) {
+        const CodeEntry* E = CollAtUnchecked (&S->Entries, Start++);
+        Cycles  += E->Cycles;
+        Penalty += E->Penalty;
+    }
+
+    /* Return the results */
+    if (MaxCycles) {
+        *MaxCycles = Cycles + Penalty;
+    }
+    return Cycles;
+}
+
+
+
 CodeLabel* CS_AddLabel (CodeSeg* S, const char* Name)
 /* Add a code label for the next instruction to follow */
 {
@@ -1332,7 +1361,12 @@ void CS_OutputPrologue (const CodeSeg* S)
     if (Func) {
         /* Get the function descriptor */
         CS_PrintFunctionHeader (S);
-        WriteOutput (".segment\t\"%s\"\n\n.proc\t_%s", S->SegName, Func->Name);
+        WriteOutput (".segment\t\"%s\"\n", S->SegName);
+        if (FunctionSections) {
+            /* Let the linker remove the function if it isn't used */
+            WriteOutput (".section\n");
+        }
+        WriteOutput ("\n.proc\t_%s", Func->Name);
         if (IsQualNear (Func->Type)) {
             WriteOutput (": near");
         } else if (IsQualFar (Func->Type)) {
@@ -1490,7 +1524,13 @@ void CS_GenRegInfo (CodeSeg* S)
                 */
                 CodeLabel* Label = CE_GetLabel (E, 0);
                 unsigned Entry;
-                if (WasJump) {
+                if (WasJump && CL_GetRefCount (Label) == 0) {
+                    /* Label isn't referenced by code, for example one that
+                    ** is only referenced from a jump table.
+                    */
+                    RC_Invalidate (&Regs);
+                    Entry = 0;
+                } else if (WasJump) {
                     /* Preceeding insn was an unconditional branch */
                     CodeEntry* J = CL_GetRef(Label, 0);
                     if (J->RI) {
@@ -83,6 +83,8 @@ struct CodeSeg {
 
     /* Optimization settings for this segment */
     unsigned char   Optimize;                   /* On/off switch */
+    unsigned char   OptimizeSpeed;              /* Decide by cycles, not size */
+    unsigned char   InlineFuncs;                /* Inline calls of small functions */
     unsigned        CodeSizeFactor;
 };
 
@@ -192,6 +194,13 @@ int CS_RangeHasLabel (CodeSeg* S, unsigned Start, unsigned Count);
 ** possible span instead.
 */
 
+unsigned CS_GetCycles (CodeSeg* S, unsigned Start, unsigned Count,
+                       unsigned* MaxCycles);
+/* Return the estimated number of cycles needed to execute each of the code
+** entries in the given range once. If MaxCycles is not NULL, the estimate
+** including all page crossing and taken branch penalties is stored there.
+*/
+
 #if defined(HAVE_INLINE)
 INLINE int CS_HavePendingLabel (const CodeSeg* S)
 /* Return true if there are open labels that will get attached to the next
@@ -258,12 +267,12 @@ INLINE void CS_ResetAllMarks (CodeSeg* S)
 /* Remove all user marks from the code segment */
 {
     if (CS_GetEntryCount (S) > 0) {
-        CS_ResetMarks (S, 0, CS_GetEntryCount (S));
+        CS_ResetMarks (S, 0, CS_GetEntryCount (S) - 1);
     }
 }
 #else
 #  define CS_ResetAllMarks(S) \
-        ((CS_GetEntryCount (S) > 0)? CS_ResetMarks (S, 0, CS_GetEntryCount (S)) : (void) 0)
+        ((CS_GetEntryCount (S) > 0)? CS_ResetMarks (S, 0, CS_GetEntryCount (S) - 1) : (void) 0)
 #endif
 
 int CS_IsBasicBlock (CodeSeg* S, unsigned First, unsigned Last);
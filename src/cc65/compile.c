@@ -46,6 +46,7 @@
 #include "asmlabel.h"
 #include "asmstmt.h"
 #include "codegen.h"
+#include "codeinline.h"
 #include "codeopt.h"
 #include "compile.h"
 #include "declare.h"
@@ -57,9 +58,11 @@
 #include "litpool.h"
 #include "macrotab.h"
 #include "output.h"
+#include "pch.h"
 #include "pragma.h"
 #include "preproc.h"
 #include "standard.h"
+#include "staticframe.h"
 #include "symtab.h"
 
 
@@ -350,6 +353,9 @@ void Compile (const char* FileName)
     if (IS_Get (&InlineStdFuncs)) {
         DefineNumericMacro ("__OPT_s__", 1);
     }
+    if (IS_Get (&OptimizeSpeed)) {
+        DefineNumericMacro ("__OPT_t__", 1);
+    }
     if (IS_Get (&EagerlyInlineFuncs)) {
         DefineNumericMacro ("__EAGERLY_INLINE_FUNCS__", 1);
     }
@@ -382,8 +388,22 @@ void Compile (const char* FileName)
     /* Open the input file */
     OpenMainFile (FileName);
 
-    /* Are we supposed to compile or just preprocess the input? */
-    if (PreprocessOnly) {
+    /* Read a precompiled header if requested. It is read before the main
+    ** file as if it was included at the top.
+    */
+    if (SB_NotEmpty (&PCHName)) {
+        LoadPCH (SB_GetConstBuf (&PCHName));
+    }
+
+    /* Are we supposed to compile, precompile a header or just preprocess
+    ** the input?
+    */
+    if (SB_NotEmpty (&CreatePCHName)) {
+
+        /* Preprocess the input and write it to the precompiled header */
+        CreatePCH (SB_GetConstBuf (&CreatePCHName));
+
+    } else if (PreprocessOnly) {
 
         /* Open the file */
         OpenOutputFile ();
@@ -408,6 +428,9 @@ void Compile (const char* FileName)
         PrintMacroStats (stdout);
     }
 
+    /* Tell how many include files were skipped */
+    PrintIncludeStats ();
+
     /* Print an error report */
     ErrorReport ();
 }
@@ -419,6 +442,11 @@ void FinishCompile (void)
 {
     SymEntry* Entry;
 
+    /* Allocate the static frames of the functions */
+    if (StaticFrames) {
+        SF_Allocate ();
+    }
+
     /* Walk over all global symbols:
     ** - for functions, do clean-up and optimizations
     ** - generate code for uninitialized global variables
@@ -428,6 +456,9 @@ void FinishCompile (void)
             /* Function which is defined and referenced or extern */
             MoveLiteralPool (Entry->V.F.LitPool);
             CS_MergeLabels (Entry->V.F.Seg->Code);
+            if (Entry->V.F.Seg->Code->InlineFuncs) {
+                InlineCalls (Entry->V.F.Seg->Code);
+            }
             RunOpt (Entry->V.F.Seg->Code);
         } else if ((Entry->Flags & (SC_STORAGE | SC_DEF | SC_STATIC)) == (SC_STORAGE | SC_STATIC)) {
             /* Assembly definition of uninitialized global variable */
@@ -0,0 +1,417 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 coptloop.c                                */
+/*                                                                           */
+/*                               Optimize loops                              */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <string.h>
+
+/* cc65 */
+#include "asmlabel.h"
+#include "codeent.h"
+#include "codeinfo.h"
+#include "coptloop.h"
+#include "dataseg.h"
+#include "segments.h"
+#include "symentry.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Zero page locations that may hold a loop counter, in order of preference.
+** The optimizer must track their use, so it knows whether they are free.
+*/
+static const struct {
+    const char* Name;
+    unsigned    Reg;
+} CounterLocs[] = {
+    { "tmp1",   REG_TMP1        },
+    { "ptr1",   REG_PTR1_LO     },
+    { "ptr1+1", REG_PTR1_HI     },
+    { "ptr2",   REG_PTR2_LO     },
+    { "ptr2+1", REG_PTR2_HI     },
+    { "sreg",   REG_SREG_LO     },
+    { "sreg+1", REG_SREG_HI     },
+};
+
+
+
+/*****************************************************************************/
+/*                             Helper functions                              */
+/*****************************************************************************/
+
+
+
+static int IsCounterStore (const CodeEntry* E)
+/* Check if E stores A into a variable that may be a loop counter: A static
+** variable or a register variable.
+*/
+{
+    return E->OPC == OP65_STA &&
+           ((E->AM == AM65_ABS && IsLocalLabelName (E->Arg)) ||
+            (E->AM == AM65_ZP && strncmp (E->Arg, "regbank+", 8) == 0));
+}
+
+
+
+static int IsCounterInsn (const CodeEntry* E, opc_t OPC, const CodeEntry* Store)
+/* Check if E is the instruction OPC accessing the counter stored by Store */
+{
+    return E->OPC == OPC && E->AM == Store->AM && strcmp (E->Arg, Store->Arg) == 0;
+}
+
+
+
+static int DataUsesName (const DataSeg* D, const char* Name)
+/* Return true if the data segment contains Name in another line than the
+** one defining Name as a label.
+*/
+{
+    unsigned Len = strlen (Name);
+    unsigned I;
+    for (I = 0; I < CollCount (&D->Lines); ++I) {
+        const char* Line = CollConstAt (&D->Lines, I);
+        if (strncmp (Line, Name, Len) == 0 && Line[Len] == ':') {
+            continue;
+        }
+        if (strstr (Line, Name) != 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+
+static int CounterIsPrivate (CodeSeg* S, unsigned First, unsigned Last,
+                             const char* Counter, unsigned Count,
+                             CodeEntry** Uses)
+/* Check that the counter is referenced by no other instruction from First to
+** Last than the Count ones in Uses, and not by the data of the function.
+*/
+{
+    unsigned I;
+    for (I = First; I <= Last; ++I) {
+        const CodeEntry* E = CS_GetEntry (S, I);
+        if (E->Arg != 0 && strstr (E->Arg, Counter) != 0) {
+            unsigned J = 0;
+            while (J < Count && Uses[J] != E) {
+                ++J;
+            }
+            if (J == Count) {
+                return 0;
+            }
+        }
+    }
+    if (S->Func) {
+        const Segments* Seg = S->Func->V.F.Seg;
+        if (DataUsesName (Seg->Data, Counter)   ||
+            DataUsesName (Seg->ROData, Counter) ||
+            DataUsesName (Seg->BSS, Counter)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+
+
+static int LoopIsClosed (CodeSeg* S, unsigned First, unsigned Last,
+                         const CodeEntry* Entry, const CodeEntry* Back)
+/* Check that the loop from First to Last is entered only by falling into
+** First or by the jump Entry, and that the only jump to First is Back.
+*/
+{
+    unsigned I, J, K;
+
+    /* Mark the loop */
+    CS_ResetAllMarks (S);
+    for (I = First; I <= Last; ++I) {
+        CE_SetMark (CS_GetEntry (S, I));
+    }
+
+    /* Check all jumps to labels within the loop */
+    for (I = First; I <= Last; ++I) {
+        CodeEntry* E = CS_GetEntry (S, I);
+        for (J = 0; J < CE_GetLabelCount (E); ++J) {
+            CodeLabel* L = CE_GetLabel (E, J);
+            for (K = 0; K < CL_GetRefCount (L); ++K) {
+                CodeEntry* From = CL_GetRef (L, K);
+                if ((I == First && From == Back) || From == Entry) {
+                    continue;
+                }
+                if (I == First || !CE_HasMark (From)) {
+                    return 0;
+                }
+            }
+        }
+    }
+
+    /* The loop is closed */
+    return 1;
+}
+
+
+
+static int LoopHasOneExit (CodeSeg* S, unsigned First, unsigned Last)
+/* Check that the loop from First to Last is left only by falling through
+** its last instruction, so the counter has its final value behind the loop.
+*/
+{
+    unsigned I;
+    for (I = First; I <= Last; ++I) {
+        const CodeEntry* E = CS_GetEntry (S, I);
+        if (E->Info & OF_BRA) {
+            unsigned Target;
+            if (E->JumpTo == 0 || E->JumpTo->Owner == 0) {
+                return 0;
+            }
+            Target = CS_GetEntryIndex (S, E->JumpTo->Owner);
+            if (Target < First || Target > Last) {
+                return 0;
+            }
+        } else if (E->Info & OF_RET) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+
+
+static unsigned GetLoopRegs (CodeSeg* S, unsigned First, unsigned Last)
+/* Return the registers used or changed by the instructions of the loop */
+{
+    unsigned Regs = REG_NONE;
+    unsigned I;
+    for (I = First; I <= Last; ++I) {
+        const CodeEntry* E = CS_GetEntry (S, I);
+        Regs |= E->Use | E->Chg;
+    }
+    return Regs;
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+unsigned OptLoopCounter (CodeSeg* S)
+/* Search for counted loops of the form
+**
+**      sta     Lxxxx           ; Counter := Start, Start is known
+**      jmp     L2
+** L1:  ...                     ; Body
+**      inc     Lxxxx
+** L2:  lda     Lxxxx
+**      cmp     #End
+**      jcc     L1              ; or jne
+**
+** where the counter is a static variable which is not used anywhere else in
+** the function. Since the number of iterations is known, enter the body
+** directly and count down in a register or zero page location that the
+** body doesn't use, or in the counter itself:
+**
+**      ldx     #End-Start
+** L1:  ...
+**      dex
+**      jne     L1
+**
+** A register variable (regbank+n) may also be the counter, if the body
+** doesn't use it and the loop is left only at its end. It is referenced
+** outside the loop by the code saving and restoring the register bank, so
+** it gets its final value End behind the loop. Counters on the C stack are
+** not handled: Their initial store shares the "sta (sp),y" with the
+** increment, and pushes within the body change their offset.
+*/
+{
+    unsigned Changes = 0;
+    unsigned I;
+
+    /* Walk over the entries */
+    I = 1;
+    while (I + 1 < CS_GetEntryCount (S)) {
+
+        CodeEntry* L[4];
+        CodeEntry* Uses[3];
+        CodeEntry* Store;
+        CodeEntry* Jump;
+        CodeEntry* X;
+        unsigned   Tail;
+        unsigned   Count;
+        unsigned   Regs;
+        int        RegVar;
+        int        Private;
+        const char* Counter;
+        LineInfo*  LI;
+        unsigned   J;
+
+        /* Check the loop entry */
+        Store = CS_GetEntry (S, I-1);
+        Jump  = CS_GetEntry (S, I);
+        if (Jump->OPC != OP65_JMP                       ||
+            Jump->JumpTo == 0                           ||
+            Jump->JumpTo->Owner == 0                    ||
+            CE_HasLabel (Jump)                          ||
+            !IsCounterStore (Store)                     ||
+            Store->RI == 0                              ||
+            !RegValIsKnown (Store->RI->In.RegA)         ||
+            !CE_HasLabel (CS_GetNextEntry (S, I))) {
+            ++I;
+            continue;
+        }
+        Counter = Store->Arg;
+        RegVar  = (Store->AM == AM65_ZP);
+
+        /* Check the test at the end of the loop */
+        Tail = CS_GetEntryIndex (S, Jump->JumpTo->Owner);
+        if (Tail <= I + 1                                       ||
+            Tail + 3 >= CS_GetEntryCount (S)                    ||
+            !CS_GetEntries (S, L, Tail - 1, 4)                  ||
+            !IsCounterInsn (L[0], OP65_INC, Store)              ||
+            !IsCounterInsn (L[1], OP65_LDA, Store)              ||
+            CE_GetLabelCount (L[1]) != 1                        ||
+            CL_GetRefCount (CE_GetLabel (L[1], 0)) != 1         ||
+            L[2]->OPC != OP65_CMP                               ||
+            !CE_IsConstImm (L[2])                               ||
+            CE_HasLabel (L[2])                                  ||
+            (L[3]->OPC != OP65_BCC && L[3]->OPC != OP65_JCC &&
+             L[3]->OPC != OP65_BNE && L[3]->OPC != OP65_JNE)    ||
+            L[3]->JumpTo == 0                                   ||
+            L[3]->JumpTo->Owner != CS_GetNextEntry (S, I)       ||
+            CE_HasLabel (L[3])) {
+            ++I;
+            continue;
+        }
+
+        /* Determine the number of iterations. It is known to be one at
+        ** least, so the test can be skipped when entering the loop.
+        */
+        Count = (L[2]->Num - Store->RI->In.RegA) & 0xFF;
+        if (Count == 0 ||
+            ((L[3]->OPC == OP65_BCC || L[3]->OPC == OP65_JCC) &&
+             (unsigned) Store->RI->In.RegA >= L[2]->Num)) {
+            ++I;
+            continue;
+        }
+
+        /* The counter must not be used otherwise, in the function or, for a
+        ** register variable, in the loop, which must be left only at its end
+        ** then. The loop must not be entered anywhere else. The value of A
+        ** at the start of the body and behind the loop must not be used,
+        ** since it was loaded from the counter.
+        */
+        Uses[0] = Store;
+        Uses[1] = L[0];
+        Uses[2] = L[1];
+        if (RegVar) {
+            Private = CounterIsPrivate (S, I + 1, Tail + 2, Counter, 3, Uses) &&
+                      LoopHasOneExit (S, I + 1, Tail + 2);
+        } else {
+            Private = CounterIsPrivate (S, 0, CS_GetEntryCount (S) - 1,
+                                        Counter, 3, Uses);
+        }
+        if (!Private                                                    ||
+            !LoopIsClosed (S, I + 1, Tail + 2, Jump, L[3])              ||
+            RegAUsed (S, I + 1)                                         ||
+            RegAUsed (S, Tail + 3)) {
+            CS_ResetAllMarks (S);
+            ++I;
+            continue;
+        }
+        CS_ResetAllMarks (S);
+
+        /* Determine the registers that are free within and behind the loop */
+        Regs = GetLoopRegs (S, I + 1, Tail - 2) |
+               GetRegInfo (S, Tail + 3, REG_ALL & ~REG_A);
+
+        /* Give a register variable its final value behind the loop */
+        if (RegVar) {
+            LI = L[1]->LI;
+            X = NewCodeEntry (OP65_LDA, AM65_IMM, MakeHexArg (L[2]->Num), 0, LI);
+            CS_InsertEntry (S, X, Tail + 3);
+            X = NewCodeEntry (OP65_STA, AM65_ZP, Counter, 0, LI);
+            CS_InsertEntry (S, X, Tail + 4);
+        }
+
+        /* Replace the test by a count down and a branch on not zero */
+        LI = L[0]->LI;
+        if ((Regs & REG_X) == 0) {
+            X = NewCodeEntry (OP65_DEX, AM65_IMP, 0, 0, LI);
+        } else if ((Regs & REG_Y) == 0) {
+            X = NewCodeEntry (OP65_DEY, AM65_IMP, 0, 0, LI);
+        } else {
+            for (J = 0; J < sizeof (CounterLocs) / sizeof (CounterLocs[0]); ++J) {
+                if ((Regs & CounterLocs[J].Reg) == 0) {
+                    Counter = CounterLocs[J].Name;
+                    break;
+                }
+            }
+            X = NewCodeEntry (OP65_DEC, (Counter == Store->Arg)? Store->AM : AM65_ZP,
+                              Counter, 0, LI);
+        }
+        CS_InsertEntry (S, X, Tail);
+        CE_ReplaceOPC (L[3], (L[3]->OPC == OP65_BCC || L[3]->OPC == OP65_BNE)?
+                             OP65_BNE : OP65_JNE);
+        CS_DelEntries (S, Tail + 1, 2);
+        CS_DelEntry (S, Tail - 1);
+
+        /* Load the count instead of jumping to the test */
+        LI = Store->LI;
+        if (X->OPC == OP65_DEX) {
+            X = NewCodeEntry (OP65_LDX, AM65_IMM, MakeHexArg (Count), 0, LI);
+            CS_InsertEntry (S, X, I + 1);
+        } else if (X->OPC == OP65_DEY) {
+            X = NewCodeEntry (OP65_LDY, AM65_IMM, MakeHexArg (Count), 0, LI);
+            CS_InsertEntry (S, X, I + 1);
+        } else {
+            X = NewCodeEntry (OP65_LDA, AM65_IMM, MakeHexArg (Count), 0, LI);
+            CS_InsertEntry (S, X, I + 1);
+            X = NewCodeEntry (OP65_STA, (Counter == Store->Arg)? Store->AM : AM65_ZP,
+                              Counter, 0, LI);
+            CS_InsertEntry (S, X, I + 2);
+        }
+        CS_DelEntry (S, I);
+        CS_DelEntry (S, I - 1);
+
+        /* Remember, we had changes */
+        ++Changes;
+    }
+
+    /* Return the number of changes made */
+    return Changes;
+}
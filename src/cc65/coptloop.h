@@ -0,0 +1,75 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 coptloop.h                                */
+/*                                                                           */
+/*                               Optimize loops                              */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef COPTLOOP_H
+#define COPTLOOP_H
+
+
+
+/* cc65 */
+#include "codeseg.h"
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+unsigned OptLoopCounter (CodeSeg* S);
+/* Search for counted loops of the form
+**
+**      sta     Lxxxx           ; Counter := Start, Start is known
+**      jmp     L2
+** L1:  ...                     ; Body
+**      inc     Lxxxx
+** L2:  lda     Lxxxx
+**      cmp     #End
+**      jcc     L1              ; or jne
+**
+** where the counter is a static variable which is not used anywhere else in
+** the function. Since the number of iterations is known, enter the body
+** directly and count down in a register or zero page location that the
+** body doesn't use, or in the counter itself:
+**
+**      ldx     #End-Start
+** L1:  ...
+**      dex
+**      jne     L1
+*/
+
+
+
+/* End of coptloop.h */
+
+#endif
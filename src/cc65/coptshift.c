@@ -182,6 +182,68 @@ static unsigned GetShift (const char* Name)
 
 
 
+static unsigned GetShiftCycles (unsigned Shift)
+/* Return the estimated number of cycles a call to the shift subroutine for
+** the given shift takes, including the jsr and rts. For shift counts in Y,
+** the timing of a single shift step is used, which underestimates these
+** subroutines.
+*/
+{
+    unsigned Count = SHIFT_COUNT (Shift);
+    unsigned Step;
+
+    /* The subroutines save X in tmp1 and shift A and tmp1 together */
+    if (SHIFT_TYPE (Shift) == SHIFT_TYPE_ASR) {
+        Step = GetInsnCycles (OP65_CPX, AM65_IMM) +
+               GetInsnCycles (OP65_ROR, AM65_ZP)  +
+               GetInsnCycles (OP65_ROR, AM65_ACC);
+    } else {
+        Step = GetInsnCycles (OP65_ROL, AM65_ZP)  +
+               GetInsnCycles (OP65_ASL, AM65_ACC);
+    }
+    if (Count == SHIFT_COUNT_Y) {
+        Count = 1;
+    }
+
+    return GetInsnCycles (OP65_JSR, AM65_ABS) +
+           GetInsnCycles (OP65_STX, AM65_ZP)  +
+           Count * Step                       +
+           GetInsnCycles (OP65_LDX, AM65_ZP)  +
+           GetInsnCycles (OP65_RTS, AM65_IMP);
+}
+
+
+
+static unsigned GetShiftLoopCycles (void)
+/* Return the estimated number of cycles of the inline loop used for shift
+** counts in Y, for a single shift step and including the correction behind
+** the loop.
+*/
+{
+    return GetInsnCycles (OP65_ASL, AM65_ACC) +
+           GetInsnCycles (OP65_DEY, AM65_IMP) +
+           GetInsnCycles (OP65_BPL, AM65_BRA) + 1 +     /* Taken */
+           GetInsnCycles (OP65_ROR, AM65_ACC);
+}
+
+
+
+static int InlineShiftOk (const CodeSeg* S, unsigned OldCycles,
+                          unsigned NewCycles, int SizeOk)
+/* Decide if a call to a shift subroutine taking OldCycles may be replaced by
+** inline code taking NewCycles. When optimizing for speed, the estimated
+** cycles decide, otherwise SizeOk, the result of checking the code size
+** factor, is returned.
+*/
+{
+    if (S->OptimizeSpeed) {
+        return NewCycles < OldCycles;
+    }
+    return SizeOk;
+}
+
+
+
 /*****************************************************************************/
 /*                              Optimize shifts                              */
 /*****************************************************************************/
@@ -227,7 +289,9 @@ unsigned OptShift1 (CodeSeg* S)
 
                     CodeLabel* L;
 
-                    if (S->CodeSizeFactor < 200) {
+                    if (!InlineShiftOk (S, GetShiftCycles (Shift),
+                                        GetShiftLoopCycles (),
+                                        S->CodeSizeFactor >= 200)) {
                         goto NextEntry;
                     }
 
@@ -334,6 +398,7 @@ unsigned OptShift2 (CodeSeg* S)
     while (I < CS_GetEntryCount (S)) {
         unsigned Shift;
         unsigned Count, Count2;
+        unsigned Cycles;
         unsigned K;
         CodeEntry* L[4];
 
@@ -351,17 +416,22 @@ unsigned OptShift2 (CodeSeg* S)
             SHIFT_TYPE (Shift = GetShift (L[2]->Arg)) == SHIFT_TYPE_ASR &&
             (Count = SHIFT_COUNT (Shift)) > 0) {
 
+            Cycles = GetShiftCycles (Shift);
             if (L[3]->OPC == OP65_JSR                                           &&
                 SHIFT_TYPE (Shift = GetShift (L[3]->Arg)) == SHIFT_TYPE_ASR     &&
                 (Count2 = SHIFT_COUNT (Shift)) > 0) {
 
                 /* Found a second jsr asraxN */
+                Cycles += GetShiftCycles (Shift);
                 Count += Count2;
                 K = 4;
             } else {
                 K = 3;
             }
-            if (Count * 100 <= S->CodeSizeFactor        &&
+            if (InlineShiftOk (S, Cycles,
+                               Count * (GetInsnCycles (OP65_CMP, AM65_IMM) +
+                                        GetInsnCycles (OP65_ROR, AM65_ACC)),
+                               Count * 100 <= S->CodeSizeFactor)        &&
                 !RegXUsed (S, I+K)) {
 
                 CodeEntry* X;
@@ -500,7 +570,9 @@ unsigned OptShift4 (CodeSeg* S)
 
                 CodeLabel* L;
 
-                if (S->CodeSizeFactor < 200) {
+                if (!InlineShiftOk (S, GetShiftCycles (Shift),
+                                    GetShiftLoopCycles (),
+                                    S->CodeSizeFactor >= 200)) {
                     /* Not acceptable */
                     goto NextEntry;
                 }
@@ -697,6 +769,8 @@ unsigned OptShift6 (CodeSeg* S)
 
         unsigned   Shift;
         unsigned   Count;
+        unsigned   Size;
+        unsigned   Cycles;
         CodeEntry* X;
         unsigned   IP;
 
@@ -723,12 +797,16 @@ unsigned OptShift6 (CodeSeg* S)
             ** and replaces a txa, so for a shift count of 1, we get a factor
             ** of 200, which matches nicely the CodeSizeFactor enabled with -Oi
             */
-            if (Count > 1 || S->CodeSizeFactor > 200) {
-                unsigned Size = 4 + 3 * Count;
-                if ((Size * 100 / 3) > S->CodeSizeFactor) {
-                    /* Not acceptable */
-                    goto NextEntry;
-                }
+            Cycles = GetInsnCycles (OP65_STX, AM65_ZP) +
+                     Count * (GetInsnCycles (OP65_ASL, AM65_ACC) +
+                              GetInsnCycles (OP65_ROL, AM65_ZP)) +
+                     GetInsnCycles (OP65_LDX, AM65_ZP);
+            Size = 4 + 3 * Count;
+            if (!InlineShiftOk (S, GetShiftCycles (Shift), Cycles,
+                                (Count == 1 && S->CodeSizeFactor <= 200) ||
+                                (Size * 100 / 3) <= S->CodeSizeFactor)) {
+                /* Not acceptable */
+                goto NextEntry;
             }
 
             /* Inline the code. Insertion point is behind the subroutine call */
@@ -879,7 +879,7 @@ unsigned OptSize1 (CodeSeg* S)
     unsigned I;
 
     /* Are we optimizing for size */
-    int OptForSize = (S->CodeSizeFactor < 100);
+    int OptForSize = (S->CodeSizeFactor < 100 && !S->OptimizeSpeed);
 
     /* Walk over the entries */
     I = 0;
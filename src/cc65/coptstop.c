@@ -2026,6 +2026,18 @@ unsigned OptStackOps (CodeSeg* S)
                     Data.UsedRegs |= Data.Lhs.X.LoadEntry->Use;
                 }
 
+                /* A Lhs load from a zeropage location that is changed between
+                ** the push and the op cannot be used directly by the op.
+                */
+                if (Data.Lhs.A.LoadEntry &&
+                    (Data.Lhs.A.LoadEntry->Use & ChangedRegs & REG_ZP) != 0) {
+                    Data.Lhs.A.Flags &= ~LI_DIRECT;
+                }
+                if (Data.Lhs.X.LoadEntry &&
+                    (Data.Lhs.X.LoadEntry->Use & ChangedRegs & REG_ZP) != 0) {
+                    Data.Lhs.X.Flags &= ~LI_DIRECT;
+                }
+
                 /* Check the preconditions. If they aren't ok, reset the insn
                 ** pointer to the pushax and start over. We will loose part of
                 ** load tracking but at least a/x has probably lost between
@@ -0,0 +1,500 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                coptswitch.c                               */
+/*                                                                           */
+/*                     Optimize switch statement dispatch                    */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <string.h>
+
+/* common */
+#include "check.h"
+#include "strbuf.h"
+#include "xsprintf.h"
+
+/* cc65 */
+#include "asmlabel.h"
+#include "codeent.h"
+#include "codeinfo.h"
+#include "coptswitch.h"
+#include "dataseg.h"
+#include "segments.h"
+#include "symentry.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Size and execution time of the table dispatch code, not counting the
+** table itself
+*/
+#define TABLE_CODE_SIZE         19
+#define TABLE_CODE_CYCLES       32
+
+/* Maximum number of instructions checked for the use of the flags at a
+** case label
+*/
+#define MAX_FLAG_CHECK          16
+
+/* Number of table entries output per line */
+#define TABLE_ENTRIES_PER_LINE  8
+
+
+
+/*****************************************************************************/
+/*                             Helper functions                              */
+/*****************************************************************************/
+
+
+
+static int IsCaseCompare (CodeSeg* S, unsigned I, opc_t Branch)
+/* Check if the entries at index I and I+1 are a compare of A with a byte
+** sized immediate value followed by the given branch to a local label.
+*/
+{
+    CodeEntry* L[2];
+
+    return CS_GetEntries (S, L, I, 2)                   &&
+           L[0]->OPC == OP65_CMP                        &&
+           CE_IsCaseCmp (L[0])                          &&
+           CE_IsConstImm (L[0])                         &&
+           L[0]->Num <= 0xFF                            &&
+           L[1]->OPC == Branch                          &&
+           L[1]->JumpTo != 0                            &&
+           !CE_HasLabel (L[1]);
+}
+
+
+
+static int CaseUsesFlags (CodeSeg* S, CodeEntry* E)
+/* Check if the case code starting at E may use the flags before changing
+** them. The compare chain enters it with Z and C set, the table dispatch
+** doesn't.
+*/
+{
+    int        LoadF = 1;           /* N and Z not yet changed */
+    int        Carry = 1;           /* C not yet changed */
+    unsigned   Count;
+
+    for (Count = 0; Count < MAX_FLAG_CHECK; ++Count) {
+
+        int Index;
+
+        /* Follow jumps. A jump out of the function, like a tail call of a
+        ** runtime function, is treated like a return.
+        */
+        if (E->Info & OF_UBRA) {
+            if (E->JumpTo == 0) {
+                return 0;
+            }
+            E = E->JumpTo->Owner;
+            if (E == 0) {
+                return 1;
+            }
+            continue;
+        }
+
+        /* Branches use the flags, a return leaves the function */
+        if (E->Info & OF_CBRA) {
+            return 1;
+        } else if (E->Info & OF_RET) {
+            return 0;
+        }
+
+        switch (E->OPC) {
+            case OP65_ADC:
+            case OP65_SBC:
+            case OP65_ROL:
+            case OP65_ROR:
+                if (Carry) {
+                    return 1;
+                }
+                break;
+            case OP65_ASL:
+            case OP65_LSR:
+            case OP65_CLC:
+            case OP65_SEC:
+                Carry = 0;
+                break;
+            case OP65_BRK:
+            case OP65_PHP:
+                return 1;
+            case OP65_PLP:
+                return 0;
+            case OP65_JSR:
+                /* The boolean transformers evaluate the flags, other
+                ** subroutines don't.
+                */
+                return FindBoolCmpCond (E->Arg) != CMP_INV;
+            default:
+                break;
+        }
+        if (E->Info & OF_CMP) {
+            Carry = 0;
+        }
+        if (E->Info & OF_SETF) {
+            LoadF = 0;
+        }
+        if (!LoadF && !Carry) {
+            return 0;
+        }
+
+        /* Next entry */
+        Index = CS_GetEntryIndex (S, E) + 1;
+        if (Index >= (int) CS_GetEntryCount (S)) {
+            break;
+        }
+        E = CS_GetEntry (S, Index);
+    }
+
+    /* Don't know */
+    return 1;
+}
+
+
+
+static void TableArg (char* Buf, size_t Size, const char* Name, unsigned Min)
+/* Create the argument for a table access, the index starts at Min */
+{
+    if (Min > 0) {
+        xsprintf (Buf, Size, "%s-%u", Name, Min);
+    } else {
+        xsprintf (Buf, Size, "%s", Name);
+    }
+}
+
+
+
+static void OutputTable (DataSeg* D, const char* Name, const char* Op,
+                         CodeLabel** Targets, unsigned Count)
+/* Output one half of the jump table. The entries are the target addresses
+** minus one for the rts of the dispatch code.
+*/
+{
+    unsigned I;
+
+    DS_AddLine (D, "%s:", Name);
+    for (I = 0; I < Count; I += TABLE_ENTRIES_PER_LINE) {
+
+        StrBuf   Line = AUTO_STRBUF_INITIALIZER;
+        unsigned J;
+
+        SB_Printf (&Line, "\t%s\t", Op);
+        for (J = I; J < Count && J < I + TABLE_ENTRIES_PER_LINE; ++J) {
+            if (J > I) {
+                SB_AppendChar (&Line, ',');
+            }
+            SB_AppendStr (&Line, Targets[J]->Name);
+            SB_AppendStr (&Line, "-1");
+        }
+        SB_Terminate (&Line);
+        DS_AddLine (D, "%s", SB_GetConstBuf (&Line));
+        SB_Done (&Line);
+    }
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+int SwitchTableIsProfitable (const CodeSeg* S, unsigned Count, unsigned Range)
+/* Return true if dispatching Count case values spread over Range byte values
+** through a jump table is preferable to a compare chain, taking the
+** optimization settings of S into account.
+*/
+{
+    /* A compare chain needs a compare and a short branch per case value.
+    ** On average, half of the compares fail before one matches.
+    */
+    unsigned ChainSize   = 4 * Count;
+    unsigned ChainCycles = 2 * (Count + 1) + 1;
+
+    /* The table needs two bytes per possible value in the range */
+    unsigned TableSize   = TABLE_CODE_SIZE + 2 * Range;
+
+    /* When optimizing for speed, the size of the table doesn't matter */
+    return ChainCycles > TABLE_CODE_CYCLES &&
+           (S->OptimizeSpeed || TableSize * 100 <= ChainSize * S->CodeSizeFactor);
+}
+
+
+
+void MarkCaseCompare (CodeSeg* S)
+/* Mark the last entry of S, which must be the compare of a case value, as
+** part of a compare chain that OptSwitchTable may replace.
+*/
+{
+    CodeEntry* E = CS_GetEntry (S, CS_GetEntryCount (S) - 1);
+    CHECK (E->OPC == OP65_CMP);
+    CE_SetCaseCmp (E);
+}
+
+
+
+unsigned OptSwitchTable (CodeSeg* S)
+/* Search for compare chains of the form
+**
+**      cmp     #$xx
+**      jeq     Lxx
+**      cmp     #$yy
+**      jeq     Lyy
+**      ...
+**      jmp     Ldefault
+**
+** as generated for switch statements, and replace them by a jump through a
+** table of target addresses if the case values are dense enough.
+*/
+{
+    unsigned Changes = 0;
+    unsigned I;
+
+    /* We need the data segments of the function for the table */
+    if (S->Func == 0) {
+        return 0;
+    }
+
+    /* Walk over the entries */
+    I = 0;
+    while (I < CS_GetEntryCount (S)) {
+
+        CodeLabel*  Targets[256];
+        CodeLabel*  Default;
+        CodeEntry*  Tail;
+        CodeEntry*  DefEntry;
+        CodeEntry*  X;
+        LineInfo*   LI;
+        unsigned    Min, Max, Count, Last, J;
+        unsigned    Used;
+        int         Inverted;
+        unsigned    Start = I;
+
+        /* Check for the start of a compare chain */
+        if (!IsCaseCompare (S, I, OP65_JEQ) && !IsCaseCompare (S, I, OP65_BEQ)) {
+            ++I;
+            continue;
+        }
+
+        /* Collect the case values and their targets. If a value appears
+        ** more than once, the first compare wins.
+        */
+        memset (Targets, 0, sizeof (Targets));
+        Min   = 0xFF;
+        Max   = 0;
+        Count = 0;
+        while (IsCaseCompare (S, I, OP65_JEQ) || IsCaseCompare (S, I, OP65_BEQ)) {
+            CodeEntry* E = CS_GetEntry (S, I);
+            unsigned   V = (unsigned) E->Num;
+
+            /* Only the first compare may have a label, since we need a
+            ** single entry point.
+            */
+            if (I > Start && CE_HasLabel (E)) {
+                break;
+            }
+            if (Targets[V] == 0) {
+                Targets[V] = CS_GetEntry (S, I+1)->JumpTo;
+                if (V < Min) {
+                    Min = V;
+                }
+                if (V > Max) {
+                    Max = V;
+                }
+                ++Count;
+            }
+            I += 2;
+        }
+
+        /* Determine how the chain ends. It may end with a jump to the
+        ** default label, or with an inverted compare for the last case value
+        ** that falls through into the case code. Otherwise the chain falls
+        ** through into the default code.
+        */
+        X = (I < CS_GetEntryCount (S))? CS_GetEntry (S, I) : 0;
+        if (X == 0 || (I > Start && CE_HasLabel (X))) {
+            /* Nothing we can handle */
+            continue;
+        } else if ((X->OPC == OP65_JMP || X->OPC == OP65_BRA) && X->JumpTo != 0) {
+            Tail = X;
+            Last = I + 1;
+        } else if ((IsCaseCompare (S, I, OP65_JNE) || IsCaseCompare (S, I, OP65_BNE)) &&
+                   I + 2 < CS_GetEntryCount (S)                                        &&
+                   Targets[X->Num] == 0) {
+            Tail = CS_GetEntry (S, I+1);
+            Last = I + 2;
+            if (X->Num < Min) {
+                Min = X->Num;
+            }
+            if (X->Num > Max) {
+                Max = X->Num;
+            }
+            ++Count;
+        } else {
+            Tail = 0;
+            Last = I;
+        }
+
+        /* Check if the table is worth it */
+        if (!SwitchTableIsProfitable (S, Count, Max - Min + 1)) {
+            continue;
+        }
+
+        /* Determine the code at the default label and at the target of an
+        ** inverted last compare.
+        */
+        Inverted = (Tail != 0 && (Tail->OPC == OP65_JNE || Tail->OPC == OP65_BNE));
+        DefEntry = (Tail == 0)? X : Tail->JumpTo->Owner;
+
+        /* The code at the targets must not use the flags, since they are
+        ** not set as by a matching compare. One of the index registers must
+        ** be unused, since the dispatch code destroys it.
+        */
+        Used = REG_NONE;
+        for (J = Min; J <= Max; ++J) {
+            CodeEntry* T;
+            if (Targets[J] != 0) {
+                T = Targets[J]->Owner;
+            } else if (Inverted && J == X->Num) {
+                T = CS_GetEntry (S, Last);
+            } else {
+                T = DefEntry;
+            }
+            if (T == 0 || CaseUsesFlags (S, T)) {
+                break;
+            }
+            Used |= GetRegInfo (S, CS_GetEntryIndex (S, T), REG_XY);
+        }
+        if (J <= Max || (Used & REG_XY) == REG_XY) {
+            continue;
+        }
+
+        /* Create the default label and the label of an inverted last
+        ** compare.
+        */
+        if (Tail == 0) {
+            Default = CS_GenLabel (S, X);
+        } else {
+            Default = Tail->JumpTo;
+            if (Inverted) {
+                Targets[X->Num] = CS_GenLabel (S, CS_GetEntry (S, Last));
+            }
+        }
+
+        /* Values without a case go to the default label */
+        for (J = Min; J <= Max; ++J) {
+            if (Targets[J] == 0) {
+                Targets[J] = Default;
+            }
+        }
+
+        /* Insert the dispatch code in front of the chain. Use Y as index if
+        ** possible, since X often holds the high byte of the value.
+        */
+        {
+            const char* Lo = LocalLabelName (GetLocalLabel ());
+            char        LoName[64];
+            char        HiName[64];
+            char        Arg[80];
+            DataSeg*    D = S->Func->V.F.Seg->ROData;
+            unsigned    Ins = Start;
+            int         UseY = (Used & REG_Y) == 0;
+
+            LI = CS_GetEntry (S, Start)->LI;
+
+            strcpy (LoName, Lo);
+            strcpy (HiName, LocalLabelName (GetLocalLabel ()));
+
+            if (Min > 0) {
+                X = NewCodeEntry (OP65_CMP, AM65_IMM, MakeHexArg (Min), 0, LI);
+                CS_InsertEntry (S, X, Ins++);
+                X = NewCodeEntry (OP65_JCC, AM65_BRA, Default->Name, Default, LI);
+                CS_InsertEntry (S, X, Ins++);
+            }
+            if (Max < 0xFF) {
+                X = NewCodeEntry (OP65_CMP, AM65_IMM, MakeHexArg (Max + 1), 0, LI);
+                CS_InsertEntry (S, X, Ins++);
+                X = NewCodeEntry (OP65_JCS, AM65_BRA, Default->Name, Default, LI);
+                CS_InsertEntry (S, X, Ins++);
+            }
+            X = NewCodeEntry (UseY? OP65_TAY : OP65_TAX, AM65_IMP, 0, 0, LI);
+            CS_InsertEntry (S, X, Ins++);
+            TableArg (Arg, sizeof (Arg), HiName, Min);
+            X = NewCodeEntry (OP65_LDA, UseY? AM65_ABSY : AM65_ABSX, Arg, 0, LI);
+            CS_InsertEntry (S, X, Ins++);
+            X = NewCodeEntry (OP65_PHA, AM65_IMP, 0, 0, LI);
+            CS_InsertEntry (S, X, Ins++);
+            TableArg (Arg, sizeof (Arg), LoName, Min);
+            X = NewCodeEntry (OP65_LDA, UseY? AM65_ABSY : AM65_ABSX, Arg, 0, LI);
+            CS_InsertEntry (S, X, Ins++);
+            X = NewCodeEntry (OP65_PHA, AM65_IMP, 0, 0, LI);
+            CS_InsertEntry (S, X, Ins++);
+            X = NewCodeEntry (UseY? OP65_TYA : OP65_TXA, AM65_IMP, 0, 0, LI);
+            CS_InsertEntry (S, X, Ins++);
+            X = NewCodeEntry (OP65_RTS, AM65_IMP, 0, 0, LI);
+            CS_InsertEntry (S, X, Ins++);
+
+            /* The targets are referenced from the table from now on, which
+            ** the optimizer doesn't know about. Remove the references of the
+            ** chain without deleting the labels, as CS_DelEntry would do
+            ** with the last reference. No later step removes unreferenced
+            ** labels.
+            */
+            for (J = Ins; J < Ins + Last - Start; ++J) {
+                X = CS_GetEntry (S, J);
+                if (X->JumpTo != 0) {
+                    CollDeleteItem (&X->JumpTo->JumpFrom, X);
+                    CE_ClearJumpTo (X);
+                }
+            }
+
+            /* Move the labels of the chain to the dispatch code and delete
+            ** the chain.
+            */
+            CS_MoveLabels (S, CS_GetEntry (S, Ins), CS_GetEntry (S, Start));
+            CS_DelEntries (S, Ins, Last - Start);
+
+            /* Output the table */
+            OutputTable (D, LoName, ".lobytes", Targets + Min, Max - Min + 1);
+            OutputTable (D, HiName, ".hibytes", Targets + Min, Max - Min + 1);
+
+            /* Continue behind the new code */
+            I = Ins;
+            ++Changes;
+        }
+    }
+
+    /* Return the number of changes made */
+    return Changes;
+}
@@ -0,0 +1,97 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                coptswitch.h                               */
+/*                                                                           */
+/*                     Optimize switch statement dispatch                    */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef COPTSWITCH_H
+#define COPTSWITCH_H
+
+
+
+/* cc65 */
+#include "codeseg.h"
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+int SwitchTableIsProfitable (const CodeSeg* S, unsigned Count, unsigned Range);
+/* Return true if dispatching Count case values spread over Range byte values
+** through a jump table is preferable to a compare chain, taking the
+** optimization settings of S into account.
+*/
+
+void MarkCaseCompare (CodeSeg* S);
+/* Mark the last entry of S, which must be the compare of a case value, as
+** part of a compare chain that OptSwitchTable may replace.
+*/
+
+unsigned OptSwitchTable (CodeSeg* S);
+/* Search for compare chains of the form
+**
+**      cmp     #$xx
+**      jeq     Lxx
+**      cmp     #$yy
+**      jeq     Lyy
+**      ...
+**      jmp     Ldefault
+**
+** as generated for switch statements, and replace them by a jump through a
+** table of target addresses if the case values are dense enough:
+**
+**      cmp     #min
+**      jcc     Ldefault
+**      cmp     #max+1
+**      jcs     Ldefault
+**      tay
+**      lda     Lhi-min,y
+**      pha
+**      lda     Llo-min,y
+**      pha
+**      tya
+**      rts
+**
+** The tables contain the target addresses minus one, as expected by rts.
+** Only compares marked by MarkCaseCompare are replaced. The code at the
+** targets must neither use the flags set by the compare nor the index
+** register; X is used instead of Y if Y is in use. Since the jump targets
+** are not visible for other optimizer steps, this must run after all steps
+** that move, merge or remove labels.
+*/
+
+
+
+/* End of coptswitch.h */
+
+#endif
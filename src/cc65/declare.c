@@ -452,6 +452,24 @@ static void ParseStorageClass (DeclSpec* D, unsigned DefStorage)
 
 
 
+static unsigned OptionalFuncSpec (void)
+/* Read an optional inline function specifier and return SC_INLINE if there
+** was one.
+*/
+{
+    unsigned Flags = 0;
+    while (CurTok.Tok == TOK_INLINE) {
+        if (Flags & SC_INLINE) {
+            Error ("Duplicate function specifier `inline'");
+        }
+        Flags |= SC_INLINE;
+        NextToken ();
+    }
+    return Flags;
+}
+
+
+
 static void ParseEnumDecl (void)
 /* Process an enum declaration . */
 {
@@ -1596,6 +1614,10 @@ void ParseDecl (const DeclSpec* Spec, Declaration* D, declmode_t Mode)
     /* If we have a function, add a special storage class */
     if (IsTypeFunc (D->Type)) {
         D->StorageClass |= SC_FUNC;
+    } else if (D->StorageClass & SC_INLINE) {
+        /* Only functions may be declared inline */
+        Error ("`inline' is only allowed for functions");
+        D->StorageClass &= ~SC_INLINE;
     }
 
     /* Parse attributes for this declaration */
@@ -1674,6 +1696,7 @@ void ParseDeclSpec (DeclSpec* D, unsigned DefStorage, long DefType)
 /* Parse a declaration specification */
 {
     TypeCode Qualifiers;
+    unsigned FuncSpec;
 
     /* Initialize the DeclSpec struct */
     InitDeclSpec (D);
@@ -1681,11 +1704,23 @@ void ParseDeclSpec (DeclSpec* D, unsigned DefStorage, long DefType)
     /* There may be qualifiers *before* the storage class specifier */
     Qualifiers = OptionalQualifiers (T_QUAL_CONST | T_QUAL_VOLATILE);
 
-    /* Now get the storage class specifier for this declaration */
+    /* Now get the storage class specifier for this declaration. It may be
+    ** preceeded or followed by the inline function specifier.
+    */
+    FuncSpec = OptionalFuncSpec ();
     ParseStorageClass (D, DefStorage);
+    D->StorageClass |= FuncSpec | OptionalFuncSpec ();
 
     /* Parse the type specifiers passing any initial type qualifiers */
     ParseTypeSpec (D, DefType, Qualifiers);
+
+    /* The inline function specifier may also follow the type, and more
+    ** qualifiers may follow it.
+    */
+    if (CurTok.Tok == TOK_INLINE) {
+        D->StorageClass |= OptionalFuncSpec ();
+        D->Type[0].C |= OptionalQualifiers (T_QUAL_CONST | T_QUAL_VOLATILE);
+    }
 }
 
 
@@ -33,6 +33,7 @@
 #include "shiftexpr.h"
 #include "stackptr.h"
 #include "standard.h"
+#include "staticframe.h"
 #include "stdfunc.h"
 #include "symtab.h"
 #include "typecmp.h"
@@ -527,6 +528,17 @@ static void FunctionCall (ExprDesc* Expr)
              !IsQualCDecl (Expr->Type));
     }
 
+    /* Remember the call for the allocation of static frames. Wrapped calls
+    ** go through the wrapper, which may do anything.
+    */
+    if (StaticFrames && CurrentFunc) {
+        if (IsFuncPtr || Func->WrappedCall) {
+            SF_AddCall (F_GetFuncEntry (CurrentFunc), 0);
+        } else {
+            SF_AddCall (F_GetFuncEntry (CurrentFunc), (const char*) Expr->Name);
+        }
+    }
+
     /* Parse the parameter list */
     ParamSize = FunctionParamList (Func, IsFastcall);
 
@@ -732,6 +744,9 @@ static void Primary (ExprDesc* E)
                     /* Function */
                     E->Flags = E_LOC_GLOBAL | E_RTYPE_LVAL;
                     E->Name = (unsigned long) Sym->Name;
+                    if (StaticFrames) {
+                        SF_AddRef (Sym);
+                    }
                 } else if ((Sym->Flags & SC_AUTO) == SC_AUTO) {
                     /* Local variable. If this is a parameter for a variadic
                     ** function, we have to add some address calculations, and the
@@ -1858,6 +1873,60 @@ void hie10 (ExprDesc* Expr)
 
 
 
+static int LongOpStatic (void (*Gen) (unsigned, unsigned long),
+                         const ExprDesc* Expr, const ExprDesc* Expr2,
+                         const CodeMark* Mark)
+/* Handle a binary operation on two longs without pushing the lhs if the rhs
+** is a variable in static memory or in the register bank, and the code
+** generator thinks this is worth it. The lhs is in the primary and was
+** pushed at Mark, no code for the rhs has been generated. Return true if
+** the operation was done.
+*/
+{
+    unsigned      Flags;
+    unsigned long Label;
+    long          Offs;
+
+    /* Both operands must be longs */
+    if (!IsClassInt (Expr->Type) || SizeOf (Expr->Type) != SIZEOF_LONG ||
+        !IsClassInt (Expr2->Type) || SizeOf (Expr2->Type) != SIZEOF_LONG) {
+        return 0;
+    }
+
+    /* The rhs must be a variable at a fixed address */
+    if (!ED_IsLVal (Expr2) || ED_IsBitField (Expr2) ||
+        !ED_CodeRangeIsEmpty (Expr2)) {
+        return 0;
+    }
+    switch (ED_GetLoc (Expr2)) {
+        case E_LOC_ABS:
+            Label = Expr2->IVal;
+            Offs  = 0;
+            break;
+        case E_LOC_GLOBAL:
+        case E_LOC_STATIC:
+        case E_LOC_REGISTER:
+            Label = Expr2->Name;
+            Offs  = Expr2->IVal;
+            break;
+        default:
+            return 0;
+    }
+
+    /* The operation is unsigned if one of the operands is unsigned */
+    Flags = TypeOf (Expr->Type) | TypeOf (Expr2->Type) | GlobalModeFlags (Expr2);
+    if (!g_inlinelongop (Gen, Flags)) {
+        return 0;
+    }
+
+    /* Remove the push of the lhs and do the operation */
+    RemoveCode (Mark);
+    g_longopstatic (Gen, Flags, Label, Offs);
+    return 1;
+}
+
+
+
 static void hie_internal (const GenDesc* Ops,   /* List of generators */
                           ExprDesc* Expr,
                           void (*hienext) (ExprDesc*),
@@ -1918,6 +1987,14 @@ static void hie_internal (const GenDesc* Ops,   /* List of generators */
 
         /* Check for a constant expression */
         rconst = (ED_IsConstAbs (&Expr2) && ED_CodeRangeIsEmpty (&Expr2));
+
+        /* Long operations with a variable in memory may be done inline */
+        if (!lconst && !rconst && LongOpStatic (Gen->Func, Expr, &Expr2, &Mark2)) {
+            Expr->Type = promoteint (Expr->Type, Expr2.Type);
+            ED_MakeRValExpr (Expr);
+            continue;
+        }
+
         if (!rconst) {
             /* Not constant, load into the primary */
             LoadExpr (CF_NONE, &Expr2);
@@ -2134,6 +2211,16 @@ static void hie_compare (const GenDesc* Ops,    /* List of generators */
 
         /* Check for a constant expression */
         rconst = (ED_IsConstAbs (&Expr2) && ED_CodeRangeIsEmpty (&Expr2));
+
+        /* Long compares with a variable in memory may be done inline */
+        if (!ED_IsConstAbs (Expr) && !rconst &&
+            LongOpStatic (GenFunc, Expr, &Expr2, &Mark2)) {
+            ED_MakeRValExpr (Expr);
+            Expr->Type = type_int;
+            ED_TestDone (Expr);
+            continue;
+        }
+
         if (!rconst) {
             /* Not constant, load into the primary */
             LoadExpr (CF_NONE, &Expr2);
@@ -2618,6 +2705,11 @@ static void parseadd (ExprDesc* Expr)
             /* Generate code for the add */
             g_inc (flags | CF_CONST, Expr2.IVal);
 
+        } else if (LongOpStatic (g_add, Expr, &Expr2, &Mark)) {
+
+            /* Long addition of a variable in memory, done inline */
+            Expr->Type = promoteint (lhst, Expr2.Type);
+
         } else {
 
             /* Not constant, load into the primary */
@@ -2801,6 +2893,13 @@ static void parsesub (ExprDesc* Expr)
 
         }
 
+    } else if (LongOpStatic (g_sub, Expr, &Expr2, &Mark2)) {
+
+        /* Long subtraction of a variable in memory, done inline */
+        Expr->Type = promoteint (lhst, Expr2.Type);
+        ED_MakeRValExpr (Expr);
+        ED_MarkAsUntested (Expr);
+
     } else {
 
         /* Not constant, load into the primary */
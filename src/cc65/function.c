@@ -49,6 +49,7 @@
 #include "scanner.h"
 #include "stackptr.h"
 #include "standard.h"
+#include "staticframe.h"
 #include "stmt.h"
 #include "symtab.h"
 #include "function.h"
@@ -130,6 +131,14 @@ const char* F_GetFuncName (const Function* F)
 
 
 
+struct SymEntry* F_GetFuncEntry (const Function* F)
+/* Return the symbol table entry of the current function */
+{
+    return F->FuncEntry;
+}
+
+
+
 unsigned F_GetParamCount (const Function* F)
 /* Return the parameter count for the current function */
 {
@@ -577,6 +586,11 @@ void NewFunc (SymEntry* Func)
     /* Restore the register variables */
     F_RestoreRegVars (CurrentFunc);
 
+    /* Tell the static frames which part of the register bank we use */
+    if (StaticFrames) {
+        SF_SetRegVars (Func, CurrentFunc->RegOffs, IS_Get (&EnableRegVars));
+    }
+
     /* Generate the exit code */
     g_leave ();
 
@@ -61,6 +61,9 @@ extern Function* CurrentFunc;
 const char* F_GetFuncName (const Function* F);
 /* Return the name of the current function */
 
+struct SymEntry* F_GetFuncEntry (const Function* F);
+/* Return the symbol table entry of the current function */
+
 unsigned F_GetParamCount (const Function* F);
 /* Return the parameter count for the current function */
 
@@ -49,10 +49,13 @@ unsigned char DebugInfo         = 0;    /* Add debug info to the obj */
 unsigned char PreprocessOnly    = 0;    /* Just preprocess the input */
 unsigned char DebugOptOutput    = 0;    /* Output debug stuff */
 unsigned      RegisterSpace     = 6;    /* Space available for register vars */
+unsigned char StaticFrames      = 0;    /* Overlay static local variables */
+unsigned char FunctionSections  = 0;    /* One section per function/object */
 
 /* Stackable options */
 IntStack WritableStrings    = INTSTACK(0);  /* Literal strings are r/w */
 IntStack LocalStrings       = INTSTACK(0);  /* Emit string literals immediately */
+IntStack InlineFuncs        = INTSTACK(0);  /* Inline small static functions */
 IntStack InlineStdFuncs     = INTSTACK(0);  /* Inline some standard functions */
 IntStack EagerlyInlineFuncs = INTSTACK(0);  /* Eagerly inline some known functions */
 IntStack EnableRegVars      = INTSTACK(0);  /* Enable register variables */
@@ -62,6 +65,7 @@ IntStack StaticLocals       = INTSTACK(0);  /* Make local variables static */
 IntStack SignedChars        = INTSTACK(0);  /* Make characters signed by default */
 IntStack CheckStack         = INTSTACK(0);  /* Generate stack overflow checks */
 IntStack Optimize           = INTSTACK(0);  /* Optimize flag */
+IntStack OptimizeSpeed      = INTSTACK(0);  /* Optimize for speed */
 IntStack CodeSizeFactor     = INTSTACK(100);/* Size factor for generated code */
 IntStack DataAlignment      = INTSTACK(1);  /* Alignment for data */
 
@@ -69,3 +73,5 @@ IntStack DataAlignment      = INTSTACK(1);  /* Alignment for data */
 StrBuf DepName     = STATIC_STRBUF_INITIALIZER; /* Name of dependencies file */
 StrBuf FullDepName = STATIC_STRBUF_INITIALIZER; /* Name of full dependencies file */
 StrBuf DepTarget   = STATIC_STRBUF_INITIALIZER; /* Name of dependency target */
+StrBuf CreatePCHName = STATIC_STRBUF_INITIALIZER; /* Name of PCH file to create */
+StrBuf PCHName     = STATIC_STRBUF_INITIALIZER; /* Name of PCH file to use */
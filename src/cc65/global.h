@@ -57,10 +57,13 @@ extern unsigned char    DebugInfo;              /* Add debug info to the obj */
 extern unsigned char    PreprocessOnly;         /* Just preprocess the input */
 extern unsigned char    DebugOptOutput;         /* Output debug stuff */
 extern unsigned         RegisterSpace;          /* Space available for register vars */
+extern unsigned char    StaticFrames;           /* Overlay static local variables */
+extern unsigned char    FunctionSections;       /* One section per function/object */
 
 /* Stackable options */
 extern IntStack         WritableStrings;        /* Literal strings are r/w */
 extern IntStack         LocalStrings;           /* Emit string literals immediately */
+extern IntStack         InlineFuncs;            /* Inline small static functions */
 extern IntStack         InlineStdFuncs;         /* Inline some standard functions */
 extern IntStack         EagerlyInlineFuncs;     /* Eagerly inline some known functions */
 extern IntStack         EnableRegVars;          /* Enable register variables */
@@ -70,6 +73,7 @@ extern IntStack         StaticLocals;           /* Make local variables static *
 extern IntStack         SignedChars;            /* Make characters signed by default */
 extern IntStack         CheckStack;             /* Generate stack overflow checks */
 extern IntStack         Optimize;               /* Optimize flag */
+extern IntStack         OptimizeSpeed;          /* Optimize for speed */
 extern IntStack         CodeSizeFactor;         /* Size factor for generated code */
 extern IntStack         DataAlignment;          /* Alignment for data */
 
@@ -77,6 +81,8 @@ extern IntStack         DataAlignment;          /* Alignment for data */
 extern StrBuf           DepName;                /* Name of dependencies file */
 extern StrBuf           FullDepName;            /* Name of full dependencies file */
 extern StrBuf           DepTarget;              /* Name of dependency target */
+extern StrBuf           CreatePCHName;          /* Name of PCH file to create */
+extern StrBuf           PCHName;                /* Name of PCH file to use */
 
 
 
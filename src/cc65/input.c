@@ -38,12 +38,14 @@
 #include <errno.h>
 
 /* common */
+#include "chartype.h"
 #include "check.h"
 #include "coll.h"
 #include "filestat.h"
 #include "fname.h"
 #include "print.h"
 #include "strbuf.h"
+#include "textfile.h"
 #include "xmalloc.h"
 
 /* cc65 */
@@ -53,6 +55,7 @@
 #include "incpath.h"
 #include "input.h"
 #include "lineinfo.h"
+#include "macrotab.h"
 #include "output.h"
 
 
@@ -73,6 +76,14 @@ char NextC = '\0';
 /* Maximum count of nested includes */
 #define MAX_INC_NESTING         16
 
+/* State of the include guard detection for an active file */
+typedef enum {
+    GUARD_START,                /* Nothing seen so far */
+    GUARD_INSIDE,               /* Inside #ifndef at the start of the file */
+    GUARD_DONE,                 /* #endif for the guard seen */
+    GUARD_NONE                  /* File is not guarded */
+} GuardState;
+
 /* Struct that describes an input file */
 typedef struct IFile IFile;
 struct IFile {
@@ -81,6 +92,8 @@ struct IFile {
     unsigned long   Size;       /* File size */
     unsigned long   MTime;      /* Time of last modification */
     InputType       Type;       /* Type of input file */
+    char*           Guard;      /* Name of include guard macro if any */
+    unsigned char   Once;       /* Include only once (#pragma once) */
     char            Name[1];    /* Name of file (dynamically allocated) */
 };
 
@@ -88,9 +101,14 @@ struct IFile {
 typedef struct AFile AFile;
 struct AFile {
     unsigned    Line;           /* Line number for this file */
-    FILE*       F;              /* Input file stream */
+    TextFile*   F;              /* Input file contents */
     IFile*      Input;          /* Points to corresponding IFile */
+    IFile*      Origin;         /* File the current line comes from */
     int         SearchPath;     /* True if we've added a path for this file */
+    int         Preprocessed;   /* True if the file is already preprocessed */
+    GuardState  GuardState;     /* State of include guard detection */
+    int         GuardLevel;     /* #if nesting level outside the guard */
+    char*       Guard;          /* Name of include guard macro */
 };
 
 /* List of all input files */
@@ -102,6 +120,10 @@ static Collection AFiles = STATIC_COLLECTION_INITIALIZER;
 /* Input stack used when preprocessing. */
 static Collection InputStack = STATIC_COLLECTION_INITIALIZER;
 
+/* Statistics for include files */
+static unsigned IncludeCount = 0;       /* Number of #include requests */
+static unsigned IncludeSkips = 0;       /* Number of files not read again */
+
 
 
 /*****************************************************************************/
@@ -125,6 +147,8 @@ static IFile* NewIFile (const char* Name, InputType Type)
     IF->Size  = 0;
     IF->MTime = 0;
     IF->Type  = Type;
+    IF->Guard = 0;
+    IF->Once  = 0;
     memcpy (IF->Name, Name, Len+1);
 
     /* Insert the new structure into the IFile collection */
@@ -142,7 +166,7 @@ static IFile* NewIFile (const char* Name, InputType Type)
 
 
 
-static AFile* NewAFile (IFile* IF, FILE* F)
+static AFile* NewAFile (IFile* IF, TextFile* F)
 /* Create a new AFile, push it onto the stack, add the path of the file to
 ** the path search list, and finally return a pointer to the new AFile struct.
 */
@@ -156,6 +180,11 @@ static AFile* NewAFile (IFile* IF, FILE* F)
     AF->Line  = 0;
     AF->F     = F;
     AF->Input = IF;
+    AF->Origin = IF;
+    AF->Preprocessed = 0;
+    AF->GuardState   = GUARD_START;
+    AF->GuardLevel   = 0;
+    AF->Guard        = 0;
 
     /* Increment the usage counter of the corresponding IFile. If this
     ** is the first use, set the file data and output debug info if
@@ -204,6 +233,7 @@ static AFile* NewAFile (IFile* IF, FILE* F)
 static void FreeAFile (AFile* AF)
 /* Free an AFile structure */
 {
+    xfree (AF->Guard);
     xfree (AF);
 }
 
@@ -247,8 +277,8 @@ void OpenMainFile (const char* Name)
     /* Setup a new IFile structure for the main file */
     IFile* IF = NewIFile (Name, IT_MAIN);
 
-    /* Open the file for reading */
-    FILE* F = fopen (Name, "r");
+    /* Read the file */
+    TextFile* F = ReadTextFile (Name);
     if (F == 0) {
         /* Cannot open */
         Fatal ("Cannot open input file `%s': %s", Name, strerror (errno));
@@ -271,9 +301,9 @@ void OpenMainFile (const char* Name)
 void OpenIncludeFile (const char* Name, InputType IT)
 /* Open an include file and insert it into the tables. */
 {
-    char*  N;
-    FILE*  F;
-    IFile* IF;
+    char*     N;
+    TextFile* F;
+    IFile*    IF;
 
     /* Check for the maximum include nesting */
     if (CollCount (&AFiles) > MAX_INC_NESTING) {
@@ -299,8 +329,19 @@ void OpenIncludeFile (const char* Name, InputType IT)
     /* We don't need N any longer, since we may now use IF->Name */
     xfree (N);
 
-    /* Open the file */
-    F = fopen (IF->Name, "r");
+    /* If we know that reading the file again wouldn't have any effect,
+    ** because it was marked with #pragma once or is wrapped into an include
+    ** guard whose macro is defined, don't open it at all.
+    */
+    ++IncludeCount;
+    if ((IF->Once && IF->Usage > 0) || (IF->Guard && IsMacro (IF->Guard))) {
+        ++IncludeSkips;
+        Print (stdout, 2, "Skipped include file `%s'\n", IF->Name);
+        return;
+    }
+
+    /* Read the file */
+    F = ReadTextFile (IF->Name);
     if (F == 0) {
         /* Error opening the file */
         PPError ("Cannot open include file `%s': %s", IF->Name, strerror (errno));
@@ -316,6 +357,76 @@ void OpenIncludeFile (const char* Name, InputType IT)
 
 
 
+void OpenPreprocessedFile (const char* Name, FILE* F)
+/* Insert an already opened file with preprocessed input into the tables. The
+** lines of the file will not be run through the preprocessor, and F is read
+** starting at its current position. F is closed when it has been read.
+*/
+{
+    AFile*    AF;
+    TextFile* TF;
+
+    /* Search the list of all input files for this file. If we don't find
+    ** it, create a new IFile object.
+    */
+    IFile* IF = FindFile (Name);
+    if (IF == 0) {
+        IF = NewIFile (Name, IT_USRINC);
+
+        /* The lines of the file refer to the files they were read from, so
+        ** the file itself must not show up in the debug info. Count it as
+        ** used, so NewAFile doesn't add it.
+        */
+        IF->Usage = 1;
+    }
+
+    /* Read the remainder of the file */
+    TF = NewTextFile (F);
+    if (TF == 0) {
+        Fatal ("Cannot read `%s': %s", Name, strerror (errno));
+    }
+    (void) fclose (F);
+
+    /* Allocate a new AFile structure and mark it */
+    AF = NewAFile (IF, TF);
+    AF->Preprocessed = 1;
+}
+
+
+
+void AddInputFile (const char* Name, InputType Type,
+                   unsigned long Size, unsigned long MTime,
+                   const char* Guard, int Once)
+/* Add a file to the list of input files without reading it. This is used for
+** files that were read when creating a precompiled header, so they show up
+** in the dependencies and are not read again if they are guarded by the
+** macro Guard (may be NULL) or by #pragma once.
+*/
+{
+    IFile* IF = FindFile (Name);
+    if (IF == 0) {
+        IF = NewIFile (Name, Type);
+        IF->Size  = Size;
+        IF->MTime = MTime;
+
+        /* The file counts as read, since its contents are part of the
+        ** precompiled header.
+        */
+        IF->Usage = 1;
+        g_fileinfo (IF->Name, IF->Size, IF->MTime);
+    }
+    if (Guard && IF->Guard == 0) {
+        IF->Guard = xstrdup (Guard);
+    }
+    if (Once) {
+        IF->Once = 1;
+    }
+}
+
+
+
+
+
 static void CloseIncludeFile (void)
 /* Close an include file and switch to the higher level file. Set Input to
 ** NULL if this was the main file.
@@ -332,8 +443,16 @@ static void CloseIncludeFile (void)
     /* Get the current active input file */
     Input = (AFile*) CollLast (&AFiles);
 
-    /* Close the current input file (we're just reading so no error check) */
-    fclose (Input->F);
+    /* Free the contents of the current input file */
+    FreeTextFile (Input->F);
+
+    /* If the complete file was wrapped into an include guard, remember the
+    ** name of the guard macro.
+    */
+    if (Input->GuardState == GUARD_DONE && Input->Input->Guard == 0) {
+        Input->Input->Guard = Input->Guard;
+        Input->Guard = 0;
+    }
 
     /* Delete the last active file from the active file collection */
     CollDelete (&AFiles, AFileCount-1);
@@ -349,6 +468,32 @@ static void CloseIncludeFile (void)
 
 
 
+static void SetLineMarker (AFile* Input)
+/* Set the location of the following lines of preprocessed input from the
+** marker in Line, which has the format "#<line> <file name>".
+*/
+{
+    const char* S;
+    unsigned    LineNum = 0;
+    IFile*      IF;
+
+    SB_Terminate (Line);
+    S = SB_GetConstBuf (Line) + 1;
+    while (IsDigit (*S)) {
+        LineNum = LineNum * 10 + (*S++ - '0');
+    }
+    if (*S++ != ' ' || LineNum == 0) {
+        Fatal ("Invalid line marker in `%s'", Input->Input->Name);
+    }
+
+    /* The file is one of the files read when the input was preprocessed */
+    IF = FindFile (S);
+    Input->Origin = IF? IF : Input->Input;
+    Input->Line   = LineNum - 1;
+}
+
+
+
 static void GetInputChar (void)
 /* Read the next character from the input stream and make CurC and NextC
 ** valid. If end of line is reached, both are set to NUL, no more lines
@@ -449,18 +594,19 @@ int NextLine (void)
     }
     Input = CollLast (&AFiles);
 
-    /* Read characters until we have one complete line */
+    /* Read lines until we have one complete line */
     while (1) {
 
-        /* Read the next character */
-        int C = fgetc (Input->F);
+        /* Remember where the new part of the line starts */
+        unsigned Start = SB_GetLen (Line);
 
-        /* Check for EOF */
-        if (C == EOF) {
+        /* Read the next line from the file and check for EOF */
+        if (!TF_GetLine (Input->F, Line)) {
 
-            /* Accept files without a newline at the end */
+            /* Accept files where the last line ends with a line
+            ** continuation character.
+            */
             if (SB_NotEmpty (Line)) {
-                ++Input->Line;
                 break;
             }
 
@@ -477,34 +623,44 @@ int NextLine (void)
             continue;
         }
 
-        /* Check for end of line */
-        if (C == '\n') {
-
-            /* We got a new line */
-            ++Input->Line;
-
-            /* If the \n is preceeded by a \r, remove the \r, so we can read
-            ** DOS/Windows files under *nix.
-            */
-            if (SB_LookAtLast (Line) == '\r') {
-                SB_Drop (Line, 1);
+        /* Lines from preprocessed input start with a blank, or they are
+        ** markers that set the location of the following lines.
+        */
+        if (Input->Preprocessed) {
+            if (SB_LookAt (Line, 0) == '#') {
+                SetLineMarker (Input);
+                SB_Clear (Line);
+                continue;
             }
-
-            /* If we don't have a line continuation character at the end,
-            ** we're done with this line. Otherwise replace the character
-            ** by a newline and continue reading.
-            */
-            if (SB_LookAtLast (Line) == '\\') {
-                Line->Buf[Line->Len-1] = '\n';
-            } else {
-                break;
+            if (SB_NotEmpty (Line)) {
+                memmove (Line->Buf, Line->Buf + 1, --Line->Len);
             }
+            ++Input->Line;
+            break;
+        }
 
-        } else if (C != '\0') {         /* Ignore embedded NULs */
+        /* We got a new line */
+        ++Input->Line;
 
-            /* Just some character, add it to the line */
-            SB_AppendChar (Line, C);
+        /* Remove embedded NULs */
+        if (memchr (Line->Buf + Start, '\0', Line->Len - Start) != 0) {
+            unsigned I, J;
+            for (I = J = Start; I < Line->Len; ++I) {
+                if (Line->Buf[I] != '\0') {
+                    Line->Buf[J++] = Line->Buf[I];
+                }
+            }
+            Line->Len = J;
+        }
 
+        /* If we don't have a line continuation character at the end,
+        ** we're done with this line. Otherwise replace the character
+        ** by a newline and continue reading.
+        */
+        if (SB_LookAtLast (Line) == '\\') {
+            Line->Buf[Line->Len-1] = '\n';
+        } else {
+            break;
         }
     }
 
@@ -515,7 +671,7 @@ int NextLine (void)
     InitLine (Line);
 
     /* Create line information for this line */
-    UpdateLineInfo (Input->Input, Input->Line, Line);
+    UpdateLineInfo (Input->Origin, Input->Line, Line);
 
     /* Done */
     return 1;
@@ -531,13 +687,125 @@ const char* GetInputFile (const struct IFile* IF)
 
 
 
+static AFile* CurrentAFile (void)
+/* Return the current active input file or NULL if there is none */
+{
+    unsigned AFileCount = CollCount (&AFiles);
+    return (AFileCount > 0)? (AFile*) CollAt (&AFiles, AFileCount-1) : 0;
+}
+
+
+
+void GuardContent (int IfLevel)
+/* Tell the include guard detection that the current file contains code or a
+** preprocessor directive at the given #if nesting level. Anything outside of
+** an #ifndef/#endif block enclosing the complete file means that the file is
+** not guarded.
+*/
+{
+    AFile* AF = CurrentAFile ();
+    if (AF && (AF->GuardState != GUARD_INSIDE || IfLevel <= AF->GuardLevel)) {
+        AF->GuardState = GUARD_NONE;
+    }
+}
+
+
+
+void GuardIfndef (const char* Macro, int IfLevel)
+/* Tell the include guard detection about an #ifndef for the given macro.
+** IfLevel is the #if nesting level before the directive.
+*/
+{
+    AFile* AF = CurrentAFile ();
+    if (AF && AF->GuardState == GUARD_START) {
+        AF->GuardState = GUARD_INSIDE;
+        AF->GuardLevel = IfLevel;
+        AF->Guard      = xstrdup (Macro);
+    } else {
+        GuardContent (IfLevel);
+    }
+}
+
+
+
+void GuardEndif (int IfLevel)
+/* Tell the include guard detection about an #endif. IfLevel is the #if
+** nesting level after the directive.
+*/
+{
+    AFile* AF = CurrentAFile ();
+    if (AF && AF->GuardState == GUARD_INSIDE && IfLevel == AF->GuardLevel) {
+        AF->GuardState = GUARD_DONE;
+    } else {
+        GuardContent (IfLevel);
+    }
+}
+
+
+
+void IncludeOnce (void)
+/* Mark the current input file so it is read only once (#pragma once) */
+{
+    AFile* AF = CurrentAFile ();
+    if (AF) {
+        AF->Input->Once = 1;
+    }
+}
+
+
+
+void PrintIncludeStats (void)
+/* Print statistics about include files if requested */
+{
+    Print (stdout, 1, "%u of %u include files skipped because of include "
+           "guards or #pragma once\n", IncludeSkips, IncludeCount);
+}
+
+
+
+int InputIsPreprocessed (void)
+/* Return true if the current input line comes from a preprocessed file */
+{
+    const AFile* AF = CurrentAFile ();
+    return AF != 0 && AF->Preprocessed;
+}
+
+
+
+unsigned GetInputFileCount (void)
+/* Return the number of input files seen so far */
+{
+    return CollCount (&IFiles);
+}
+
+
+
+const char* GetInputFileInfo (unsigned Index, InputType* Type,
+                              unsigned long* Size, unsigned long* MTime,
+                              const char** Guard, int* Once)
+/* Return the name of the input file with the given index and store its type,
+** size, time of last modification, include guard macro (NULL if none) and
+** #pragma once flag into the given variables.
+*/
+{
+    const IFile* IF = (const IFile*) CollAt (&IFiles, Index);
+    *Type  = IF->Type;
+    *Size  = IF->Size;
+    *MTime = IF->MTime;
+    *Guard = IF->Guard;
+    *Once  = IF->Once;
+    return IF->Name;
+}
+
+
+
 const char* GetCurrentFile (void)
 /* Return the name of the current input file */
 {
     unsigned AFileCount = CollCount (&AFiles);
     if (AFileCount > 0) {
         const AFile* AF = (const AFile*) CollAt (&AFiles, AFileCount-1);
-        return AF->Input->Name;
+        return AF->Origin->Name;
     } else {
         /* No open file. Use the main file if we have one. */
         unsigned IFileCount = CollCount (&IFiles);
@@ -84,6 +84,23 @@ void OpenMainFile (const char* Name);
 void OpenIncludeFile (const char* Name, InputType IT);
 /* Open an include file and insert it into the tables. */
 
+void OpenPreprocessedFile (const char* Name, FILE* F);
+/* Insert an already opened file with preprocessed input into the tables. The
+** lines of the file will not be run through the preprocessor, and F is read
+** starting at its current position. F is closed when it has been read. Each
+** line of the file starts with a blank, or it is a line marker of the form
+** "#<line> <file name>" that sets the location of the following lines.
+*/
+
+void AddInputFile (const char* Name, InputType Type,
+                   unsigned long Size, unsigned long MTime,
+                   const char* Guard, int Once);
+/* Add a file to the list of input files without reading it. This is used for
+** files that were read when creating a precompiled header, so they show up
+** in the dependencies and are not read again if they are guarded by the
+** macro Guard (may be NULL) or by #pragma once.
+*/
+
 void NextChar (void);
 /* Read the next character from the input stream and make CurC and NextC
 ** valid. If end of line is reached, both are set to NUL, no more lines
@@ -104,6 +121,43 @@ int NextLine (void);
 const char* GetInputFile (const struct IFile* IF);
 /* Return a filename from an IFile struct */
 
+void GuardContent (int IfLevel);
+/* Tell the include guard detection that the current file contains code or a
+** preprocessor directive at the given #if nesting level. Anything outside of
+** an #ifndef/#endif block enclosing the complete file means that the file is
+** not guarded.
+*/
+
+void GuardIfndef (const char* Macro, int IfLevel);
+/* Tell the include guard detection about an #ifndef for the given macro.
+** IfLevel is the #if nesting level before the directive.
+*/
+
+void GuardEndif (int IfLevel);
+/* Tell the include guard detection about an #endif. IfLevel is the #if
+** nesting level after the directive.
+*/
+
+void IncludeOnce (void);
+/* Mark the current input file so it is read only once (#pragma once) */
+
+void PrintIncludeStats (void);
+/* Print statistics about include files if requested */
+
+int InputIsPreprocessed (void);
+/* Return true if the current input line comes from a preprocessed file */
+
+unsigned GetInputFileCount (void);
+/* Return the number of input files seen so far */
+
+const char* GetInputFileInfo (unsigned Index, InputType* Type,
+                              unsigned long* Size, unsigned long* MTime,
+                              const char** Guard, int* Once);
+/* Return the name of the input file with the given index and store its type,
+** size, time of last modification, include guard macro (NULL if none) and
+** #pragma once flag into the given variables.
+*/
+
 const char* GetCurrentFile (void);
 /* Return the name of the current input file */
 
@@ -50,6 +50,7 @@
 #include "locals.h"
 #include "stackptr.h"
 #include "standard.h"
+#include "staticframe.h"
 #include "symtab.h"
 #include "typeconv.h"
 
@@ -94,6 +95,21 @@ static void AllocStorage (unsigned Label, void (*UseSeg) (), unsigned Size)
 
 
 
+static void AllocLocalStorage (unsigned Label, unsigned Size)
+/* Reserve Size bytes of static storage for a local variable. With static
+** frames, the storage is part of the frame of the current function, which
+** is allocated at the end of the translation unit.
+*/
+{
+    if (StaticFrames) {
+        SF_AddVar (F_GetFuncEntry (CurrentFunc), Label, Size);
+    } else {
+        AllocStorage (Label, g_usebss, Size);
+    }
+}
+
+
+
 static void ParseRegisterDecl (Declaration* Decl, int Reg)
 /* Parse the declaration of a register variable. Reg is the offset of the
 ** variable in the register bank.
@@ -312,7 +328,7 @@ static void ParseAutoDecl (Declaration* Decl)
                 Size = ParseInit (Sym->Type);
 
                 /* Allocate space for the variable */
-                AllocStorage (DataLabel, g_usebss, Size);
+                AllocLocalStorage (DataLabel, Size);
 
                 /* Generate code to copy this data into the variable space */
                 g_initstatic (InitLabel, DataLabel, Size);
@@ -320,7 +336,7 @@ static void ParseAutoDecl (Declaration* Decl)
             } else {
 
                 /* Allocate space for the variable */
-                AllocStorage (DataLabel, g_usebss, Size);
+                AllocLocalStorage (DataLabel, Size);
 
                 /* Parse the expression */
                 hie1 (&Expr);
@@ -341,7 +357,7 @@ static void ParseAutoDecl (Declaration* Decl)
         } else {
 
             /* No assignment - allocate a label and space for the variable */
-            AllocStorage (DataLabel, g_usebss, Size);
+            AllocLocalStorage (DataLabel, Size);
 
         }
     }
@@ -281,6 +281,25 @@ int MacroCmp (const Macro* M1, const Macro* M2)
 
 
 
+void WalkMacros (void (*Func) (Macro* M, void* Data), void* Data)
+/* Call Func for all macros in the macro table. Data is passed to Func. */
+{
+    unsigned I;
+    Macro* M;
+
+    for (I = 0; I < MACRO_TAB_SIZE; ++I) {
+        M = MacroTab[I];
+        while (M) {
+            /* Remember the next macro, Func may remove M from the table */
+            Macro* Next = M->Next;
+            Func (M, Data);
+            M = Next;
+        }
+    }
+}
+
+
+
 void PrintMacroStats (FILE* F)
 /* Print macro statistics to the given text file. */
 {
@@ -121,6 +121,9 @@ void AddMacroArg (Macro* M, const char* Arg);
 int MacroCmp (const Macro* M1, const Macro* M2);
 /* Compare two macros and return zero if both are identical. */
 
+void WalkMacros (void (*Func) (Macro* M, void* Data), void* Data);
+/* Call Func for all macros in the macro table. Data is passed to Func. */
+
 void PrintMacroStats (FILE* F);
 /* Print macro statistics to the given text file. */
 
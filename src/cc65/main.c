@@ -89,6 +89,7 @@ static void Usage (void)
             "  -Oi\t\t\t\tOptimize code, inline more code\n"
             "  -Or\t\t\t\tEnable register variables\n"
             "  -Os\t\t\t\tInline some standard functions\n"
+            "  -Ot\t\t\t\tOptimize code for speed\n"
             "  -T\t\t\t\tInclude source as comment\n"
             "  -V\t\t\t\tPrint the compiler version number\n"
             "  -W warning[,...]\t\tSuppress warnings\n"
@@ -112,6 +113,7 @@ static void Usage (void)
             "  --cpu type\t\t\tSet cpu type (6502, 65c02)\n"
             "  --create-dep name\t\tCreate a make dependency file\n"
             "  --create-full-dep name\tCreate a full make dependency file\n"
+            "  --create-pch name\t\tCreate a precompiled header\n"
             "  --data-name seg\t\tSet the name of the DATA segment\n"
             "  --debug\t\t\tDebug mode\n"
             "  --debug-info\t\t\tAdd debug info to object file\n"
@@ -120,8 +122,10 @@ static void Usage (void)
             "  --disable-opt name\t\tDisable an optimization step\n"
             "  --eagerly-inline-funcs\t\tEagerly inline some known functions\n"
             "  --enable-opt name\t\tEnable an optimization step\n"
+            "  --function-sections\t\tPut functions and data into own sections\n"
             "  --help\t\t\tHelp (this text)\n"
             "  --include-dir dir\t\tSet an include directory search path\n"
+            "  --inline-funcs\t\tInline small static functions\n"
             "  --inline-stdfuncs\t\tInline some standard functions\n"
             "  --list-opt-steps\t\tList all optimizer steps and exit\n"
             "  --list-warnings\t\tList available warning types for -W\n"
@@ -132,8 +136,10 @@ static void Usage (void)
             "  --rodata-name seg\t\tSet the name of the RODATA segment\n"
             "  --signed-chars\t\tDefault characters are signed\n"
             "  --standard std\t\tLanguage standard (c89, c99, cc65)\n"
+            "  --static-frames\t\tMake local variables static and overlay them\n"
             "  --static-locals\t\tMake local variables static\n"
             "  --target sys\t\t\tSet the target system\n"
+            "  --use-pch name\t\tUse a precompiled header\n"
             "  --verbose\t\t\tIncrease verbosity\n"
             "  --version\t\t\tPrint the compiler version number\n"
             "  --writable-strings\t\tMake string literals writable\n",
@@ -448,6 +454,14 @@ static void OptCreateFullDep (const char* Opt attribute ((unused)),
 
 
 
+static void OptCreatePCH (const char* Opt, const char* Arg)
+/* Handle the --create-pch option */
+{
+    FileNameOption (Opt, Arg, &CreatePCHName);
+}
+
+
+
 static void OptCPU (const char* Opt, const char* Arg)
 /* Handle the --cpu option */
 {
@@ -601,6 +615,15 @@ static void OptEnableOpt (const char* Opt attribute ((unused)), const char* Arg)
 
 
 
+static void OptFunctionSections (const char* Opt attribute ((unused)),
+                                 const char* Arg attribute ((unused)))
+/* Put each function and data object into its own section */
+{
+    FunctionSections = 1;
+}
+
+
+
 static void OptHelp (const char* Opt attribute ((unused)),
                      const char* Arg attribute ((unused)))
 /* Print usage information and exit */
@@ -620,6 +643,15 @@ static void OptIncludeDir (const char* Opt attribute ((unused)), const char* Arg
 
 
 
+static void OptInlineFuncs (const char* Opt attribute((unused)),
+                            const char* Arg attribute((unused)))
+/* Inline small static functions */
+{
+    IS_Set (&InlineFuncs, 1);
+}
+
+
+
 static void OptInlineStdFuncs (const char* Opt attribute((unused)),
                                const char* Arg attribute((unused)))
 /* Inline some standard functions */
@@ -745,6 +777,16 @@ static void OptStandard (const char* Opt, const char* Arg)
 
 
 
+static void OptStaticFrames (const char* Opt attribute ((unused)),
+                             const char* Arg attribute ((unused)))
+/* Place local variables in overlaid static frames */
+{
+    StaticFrames = 1;
+    IS_Set (&StaticLocals, 1);
+}
+
+
+
 static void OptStaticLocals (const char* Opt attribute ((unused)),
                              const char* Arg attribute ((unused)))
 /* Place local variables in static storage */
@@ -762,6 +804,14 @@ static void OptTarget (const char* Opt attribute ((unused)), const char* Arg)
 
 
 
+static void OptUsePCH (const char* Opt, const char* Arg)
+/* Handle the --use-pch option */
+{
+    FileNameOption (Opt, Arg, &PCHName);
+}
+
+
+
 static void OptVerbose (const char* Opt attribute ((unused)),
                         const char* Arg attribute ((unused)))
 /* Increase verbosity */
@@ -849,6 +899,7 @@ int main (int argc, char* argv[])
         { "--cpu",                  1,      OptCPU                  },
         { "--create-dep",           1,      OptCreateDep            },
         { "--create-full-dep",      1,      OptCreateFullDep        },
+        { "--create-pch",           1,      OptCreatePCH            },
         { "--data-name",            1,      OptDataName             },
         { "--debug",                0,      OptDebug                },
         { "--debug-info",           0,      OptDebugInfo            },
@@ -858,8 +909,10 @@ int main (int argc, char* argv[])
         { "--disable-opt",          1,      OptDisableOpt           },
         { "--eagerly-inline-funcs", 0,      OptEagerlyInlineFuncs   },
         { "--enable-opt",           1,      OptEnableOpt            },
+        { "--function-sections",    0,      OptFunctionSections     },
         { "--help",                 0,      OptHelp                 },
         { "--include-dir",          1,      OptIncludeDir           },
+        { "--inline-funcs",         0,      OptInlineFuncs          },
         { "--inline-stdfuncs",      0,      OptInlineStdFuncs       },
         { "--list-opt-steps",       0,      OptListOptSteps         },
         { "--list-warnings",        0,      OptListWarnings         },
@@ -870,8 +923,10 @@ int main (int argc, char* argv[])
         { "--rodata-name",          1,      OptRodataName           },
         { "--signed-chars",         0,      OptSignedChars          },
         { "--standard",             1,      OptStandard             },
+        { "--static-frames",        0,      OptStaticFrames         },
         { "--static-locals",        0,      OptStaticLocals         },
         { "--target",               1,      OptTarget               },
+        { "--use-pch",              1,      OptUsePCH               },
         { "--verbose",              0,      OptVerbose              },
         { "--version",              0,      OptVersion              },
         { "--writable-strings",     0,      OptWritableStrings      },
@@ -986,6 +1041,9 @@ int main (int argc, char* argv[])
                             case 's':
                                 IS_Set (&InlineStdFuncs, 1);
                                 break;
+                            case 't':
+                                IS_Set (&OptimizeSpeed, 1);
+                                break;
                         }
                     }
                     break;
@@ -1052,7 +1110,8 @@ int main (int argc, char* argv[])
     Compile (InputFile);
 
     /* Create the output file if we didn't had any errors */
-    if (PreprocessOnly == 0 && (ErrorCount == 0 || Debug)) {
+    if (PreprocessOnly == 0 && SB_IsEmpty (&CreatePCHName) &&
+        (ErrorCount == 0 || Debug)) {
 
         /* Emit literals, externals, do cleanup and optimizations */
         FinishCompile ();
@@ -185,6 +185,7 @@ typedef struct {
     opc_t           OPC;                /* Opcode */
     char            Mnemo[9];           /* Mnemonic */
     unsigned char   Size;               /* Size, 0 = check addressing mode */
+    unsigned char   Cycles;             /* Cycles, zero page form if Size is 0 */
     unsigned short  Use;                /* Registers used by this insn */
     unsigned short  Chg;                /* Registers changed by this insn */
     unsigned short  Info;               /* Additional information */
@@ -209,6 +210,16 @@ const OPCDesc* FindOP65 (const char* OPC);
 unsigned GetInsnSize (opc_t OPC, am_t AM);
 /* Return the size of the given instruction */
 
+unsigned GetInsnCycles (opc_t OPC, am_t AM);
+/* Return the number of cycles the given instruction takes, not counting any
+** extra cycles for page crossings or taken branches.
+*/
+
+unsigned GetInsnPenalty (opc_t OPC, am_t AM);
+/* Return the maximum number of extra cycles the given instruction may take
+** because of page crossings or taken branches.
+*/
+
 #if defined(HAVE_INLINE)
 INLINE const OPCDesc* GetOPCDesc (opc_t OPC)
 /* Get an opcode description */
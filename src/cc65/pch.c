@@ -0,0 +1,544 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                   pch.c                                   */
+/*                                                                           */
+/*                Precompiled headers for the cc65 C compiler                */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+/* common */
+#include "chartype.h"
+#include "coll.h"
+#include "filestat.h"
+#include "print.h"
+#include "strbuf.h"
+#include "version.h"
+#include "xmalloc.h"
+
+/* cc65 */
+#include "error.h"
+#include "input.h"
+#include "macrotab.h"
+#include "pch.h"
+#include "preproc.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Magic string at the start of a precompiled header and format version.
+** The format is line oriented: After the magic line, there is one line per
+** predefined macro ('P'), per input file ('F'), per macro defined ('M') or
+** undefined ('U') by the header, followed by a line containing just 'T' and
+** the preprocessed text of the header. Each line of the text starts with a
+** blank, or it is a marker with the original location of the lines that
+** follow.
+*/
+#define PCH_MAGIC       "CC65PCH"
+#define PCH_VERSION     2U
+
+/* An input file recorded in a precompiled header */
+typedef struct PCHDep PCHDep;
+struct PCHDep {
+    InputType           Type;           /* Type of the input file */
+    unsigned long       Size;           /* Size of the file */
+    unsigned long       MTime;          /* Time of last modification */
+    char*               Guard;          /* Include guard macro or NULL */
+    int                 Once;           /* File uses #pragma once */
+    char                Name[1];        /* Name of file, dynamically allocated */
+};
+
+/* Copies of the macros that were defined before the header was read */
+static Collection PredefMacros = STATIC_COLLECTION_INITIALIZER;
+
+
+
+/*****************************************************************************/
+/*                              Helper functions                             */
+/*****************************************************************************/
+
+
+
+static int IsVolatileMacro (const char* Name)
+/* Return true if the macro with the given name changes with every compiler
+** run, so it must not be compared or stored.
+*/
+{
+    return strcmp (Name, "__DATE__") == 0 || strcmp (Name, "__TIME__") == 0;
+}
+
+
+
+static Macro* CloneMacro (const Macro* M)
+/* Return a copy of the given macro */
+{
+    int I;
+    Macro* C = NewMacro (M->Name);
+    C->ArgCount = M->ArgCount;
+    for (I = 0; I < M->ArgCount; ++I) {
+        CollAppend (&C->FormalArgs, xstrdup (CollConstAt (&M->FormalArgs, I)));
+    }
+    SB_Copy (&C->Replacement, &M->Replacement);
+    C->Variadic = M->Variadic;
+    return C;
+}
+
+
+
+static const Macro* FindPredefMacro (const char* Name)
+/* Find a macro in the list of predefined macros */
+{
+    unsigned I;
+    for (I = 0; I < CollCount (&PredefMacros); ++I) {
+        const Macro* M = CollConstAt (&PredefMacros, I);
+        if (strcmp (M->Name, Name) == 0) {
+            return M;
+        }
+    }
+    return 0;
+}
+
+
+
+static void WriteMacro (FILE* F, char Kind, const Macro* M)
+/* Write a macro definition preceeded by Kind to the given file */
+{
+    int I;
+
+    fprintf (F, "%c %s %d %u", Kind, M->Name, M->ArgCount, M->Variadic);
+    for (I = 0; I < M->ArgCount; ++I) {
+        fprintf (F, " %s", (const char*) CollConstAt (&M->FormalArgs, I));
+    }
+    fprintf (F, " %u:", SB_GetLen (&M->Replacement));
+    fwrite (SB_GetConstBuf (&M->Replacement), 1, SB_GetLen (&M->Replacement), F);
+    fputc ('\n', F);
+}
+
+
+
+static int ReadWord (FILE* F, StrBuf* Word)
+/* Skip white space and read a word delimited by white space. Return false
+** if there is no word.
+*/
+{
+    int C;
+
+    SB_Clear (Word);
+    do {
+        C = getc (F);
+    } while (C != EOF && C != '\n' && IsSpace (C));
+    while (C != EOF && !IsSpace (C)) {
+        SB_AppendChar (Word, C);
+        C = getc (F);
+    }
+    if (C != EOF) {
+        ungetc (C, F);
+    }
+    SB_Terminate (Word);
+    return SB_NotEmpty (Word);
+}
+
+
+
+static Macro* ReadMacro (FILE* F)
+/* Read a macro definition as written by WriteMacro without the kind. Return
+** NULL if the definition is invalid.
+*/
+{
+    StrBuf   Word = STATIC_STRBUF_INITIALIZER;
+    Macro*   M;
+    int      ArgCount;
+    unsigned Variadic;
+    unsigned Len;
+    int      I;
+
+    /* Read the name and create the macro */
+    if (!ReadWord (F, &Word)) {
+        SB_Done (&Word);
+        return 0;
+    }
+    M = NewMacro (SB_GetConstBuf (&Word));
+
+    /* Read the formal arguments */
+    if (fscanf (F, "%d %u", &ArgCount, &Variadic) != 2) {
+        goto Invalid;
+    }
+    for (I = 0; I < ArgCount; ++I) {
+        if (!ReadWord (F, &Word)) {
+            goto Invalid;
+        }
+        CollAppend (&M->FormalArgs, xstrdup (SB_GetConstBuf (&Word)));
+    }
+    M->ArgCount = ArgCount;
+    M->Variadic = (unsigned char) Variadic;
+
+    /* Read the replacement text */
+    if (fscanf (F, " %u:", &Len) != 1) {
+        goto Invalid;
+    }
+    while (Len--) {
+        int C = getc (F);
+        if (C == EOF) {
+            goto Invalid;
+        }
+        SB_AppendChar (&M->Replacement, C);
+    }
+    if (getc (F) != '\n') {
+        goto Invalid;
+    }
+
+    SB_Done (&Word);
+    return M;
+
+Invalid:
+    SB_Done (&Word);
+    FreeMacro (M);
+    return 0;
+}
+
+
+
+static void RememberMacro (Macro* M, void* Data attribute ((unused)))
+/* Remember a copy of a predefined macro */
+{
+    if (!IsVolatileMacro (M->Name)) {
+        CollAppend (&PredefMacros, CloneMacro (M));
+    }
+}
+
+
+
+static void WriteHeaderMacro (Macro* M, void* Data)
+/* Write M to the file given as Data if it was defined by the header */
+{
+    if (!IsVolatileMacro (M->Name)) {
+        const Macro* P = FindPredefMacro (M->Name);
+        if (P == 0 || MacroCmp (M, P) != 0) {
+            WriteMacro ((FILE*) Data, 'M', M);
+        }
+    }
+}
+
+
+
+static void CountMacro (Macro* M, void* Data)
+/* Count all macros that are not volatile */
+{
+    if (!IsVolatileMacro (M->Name)) {
+        ++*(unsigned*) Data;
+    }
+}
+
+
+
+static void FreePCHDeps (Collection* Deps)
+/* Free all entries in a collection of PCHDep structures */
+{
+    unsigned I;
+    for (I = 0; I < CollCount (Deps); ++I) {
+        PCHDep* D = CollAtUnchecked (Deps, I);
+        xfree (D->Guard);
+        xfree (D);
+    }
+    DoneCollection (Deps);
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void CreatePCH (const char* Name)
+/* Preprocess the main input file and write the resulting text together with
+** all macros defined by it to the precompiled header with the given name.
+*/
+{
+    StrBuf      Text = STATIC_STRBUF_INITIALIZER;
+    StrBuf      Marker = STATIC_STRBUF_INITIALIZER;
+    const char* LastName = 0;
+    unsigned    LastLine = 0;
+    FILE*       F;
+    unsigned    I;
+
+    /* Remember which macros existed before the header is read */
+    WalkMacros (RememberMacro, 0);
+
+    /* Preprocess the input and collect the resulting lines. Mark where
+    ** they came from, so diagnostics and debug info refer to the original
+    ** files when the header is used.
+    */
+    while (NextLine ()) {
+
+        const char* FileName;
+        unsigned    LineNum;
+
+        /* Preprocess the line. This may read more lines, for directives and
+        ** comments spanning lines, so the result belongs to the last line
+        ** read. There is none after the end of the input.
+        */
+        Preprocess ();
+        FileName = GetCurrentFile ();
+        LineNum  = GetCurrentLine ();
+
+        /* Add a marker if the line doesn't follow the last one */
+        if (LineNum != 0 && (FileName != LastName || LineNum != LastLine + 1)) {
+            SB_Printf (&Marker, "#%u %s\n", LineNum, FileName);
+            SB_Append (&Text, &Marker);
+        }
+        LastName = FileName;
+        LastLine = LineNum;
+
+        /* Add the line itself */
+        SB_AppendChar (&Text, ' ');
+        SB_Append (&Text, Line);
+        SB_AppendChar (&Text, '\n');
+    }
+
+    /* Don't write anything if we had errors */
+    if (ErrorCount == 0) {
+
+        /* Open the output file */
+        F = fopen (Name, "wb");
+        if (F == 0) {
+            Fatal ("Cannot open precompiled header `%s': %s", Name, strerror (errno));
+        }
+
+        /* Write the header and the macros that must match when loading */
+        fprintf (F, "%s %u %u\n", PCH_MAGIC, PCH_VERSION, GetVersionAsNumber ());
+        for (I = 0; I < CollCount (&PredefMacros); ++I) {
+            WriteMacro (F, 'P', CollConstAt (&PredefMacros, I));
+        }
+
+        /* Write the input files read together with their size and time of
+        ** last modification, so we can check if the header is out of date,
+        ** and with the include guard or #pragma once state, so they are
+        ** not read again when included after the header. A missing guard
+        ** is written as "-", which cannot be a macro name.
+        */
+        for (I = 0; I < GetInputFileCount (); ++I) {
+            InputType     Type;
+            unsigned long Size;
+            unsigned long MTime;
+            const char*   Guard;
+            int           Once;
+            const char*   FileName = GetInputFileInfo (I, &Type, &Size, &MTime,
+                                                       &Guard, &Once);
+            fprintf (F, "F %u %lu %lu %d %s %s\n", (unsigned) Type, Size,
+                     MTime, Once, Guard? Guard : "-", FileName);
+        }
+
+        /* Write all changes to the macro table made by the header */
+        WalkMacros (WriteHeaderMacro, F);
+        for (I = 0; I < CollCount (&PredefMacros); ++I) {
+            const Macro* M = CollConstAt (&PredefMacros, I);
+            if (FindMacro (M->Name) == 0) {
+                fprintf (F, "U %s\n", M->Name);
+            }
+        }
+
+        /* Write the preprocessed text */
+        fputs ("T\n", F);
+        fwrite (SB_GetConstBuf (&Text), 1, SB_GetLen (&Text), F);
+
+        /* Close the file, check for errors */
+        if (fclose (F) != 0) {
+            remove (Name);
+            Fatal ("Cannot write to precompiled header (disk full?)");
+        }
+        Print (stdout, 1, "Wrote precompiled header `%s'\n", Name);
+    }
+
+    /* Cleanup */
+    for (I = 0; I < CollCount (&PredefMacros); ++I) {
+        FreeMacro (CollAtUnchecked (&PredefMacros, I));
+    }
+    CollDeleteAll (&PredefMacros);
+    SB_Done (&Marker);
+    SB_Done (&Text);
+}
+
+
+
+int LoadPCH (const char* Name)
+/* Load the precompiled header with the given name. The macros from the
+** header are defined and its preprocessed text is pushed as input, so it is
+** read before the remainder of the current input file. Returns true if the
+** header was loaded, and false if it was out of date or did not match the
+** current settings.
+*/
+{
+    Collection    Deps = STATIC_COLLECTION_INITIALIZER;
+    StrBuf        Word = STATIC_STRBUF_INITIALIZER;
+    unsigned      Version;
+    unsigned      CompilerVersion;
+    unsigned      PredefCount = 0;
+    unsigned      MacroCount = 0;
+    const char*   Reason = 0;
+    Macro*        M;
+    unsigned      I;
+    int           Kind;
+
+    /* Open the file */
+    FILE* F = fopen (Name, "rb");
+    if (F == 0) {
+        Fatal ("Cannot open precompiled header `%s': %s", Name, strerror (errno));
+    }
+
+    /* Check the header */
+    if (!ReadWord (F, &Word) || SB_CompareStr (&Word, PCH_MAGIC) != 0 ||
+        fscanf (F, "%u %u\n", &Version, &CompilerVersion) != 2 ||
+        Version != PCH_VERSION) {
+        Fatal ("`%s' is not a valid precompiled header", Name);
+    }
+    if (CompilerVersion != GetVersionAsNumber ()) {
+        Reason = "was created by another compiler version";
+        goto Reject;
+    }
+
+    /* Read and check the predefined macros */
+    while ((Kind = getc (F)) == 'P') {
+        const Macro* E;
+        if ((M = ReadMacro (F)) == 0) {
+            goto Invalid;
+        }
+        E = FindMacro (M->Name);
+        if (E == 0 || MacroCmp (M, E) != 0) {
+            Reason = "was created with different macro definitions";
+            FreeMacro (M);
+            goto Reject;
+        }
+        FreeMacro (M);
+        ++PredefCount;
+    }
+    WalkMacros (CountMacro, &MacroCount);
+    if (MacroCount != PredefCount) {
+        Reason = "was created with different macro definitions";
+        goto Reject;
+    }
+
+    /* Read the input files and check if any of them has changed */
+    while (Kind == 'F') {
+        unsigned      Type;
+        unsigned long Size;
+        unsigned long MTime;
+        int           Once;
+        char*         Guard;
+        struct stat   Buf;
+        PCHDep*       D;
+
+        if (fscanf (F, "%u %lu %lu %d", &Type, &Size, &MTime, &Once) != 4 ||
+            !ReadWord (F, &Word) || getc (F) != ' ') {
+            goto Invalid;
+        }
+        Guard = (SB_CompareStr (&Word, "-") == 0)?
+                    0 : xstrdup (SB_GetConstBuf (&Word));
+        SB_Clear (&Word);
+        while ((Kind = getc (F)) != EOF && Kind != '\n') {
+            SB_AppendChar (&Word, Kind);
+        }
+        SB_Terminate (&Word);
+
+        if (FileStat (SB_GetConstBuf (&Word), &Buf) != 0 ||
+            (unsigned long) Buf.st_size != Size ||
+            (unsigned long) Buf.st_mtime != MTime) {
+            Reason = "is out of date";
+            xfree (Guard);
+            goto Reject;
+        }
+
+        /* The header is a normal include file when used with a PCH */
+        if (Type == IT_MAIN) {
+            Type = IT_USRINC;
+        }
+        D = xmalloc (sizeof (PCHDep) + SB_GetLen (&Word));
+        D->Type  = (InputType) Type;
+        D->Size  = Size;
+        D->MTime = MTime;
+        D->Guard = Guard;
+        D->Once  = Once;
+        memcpy (D->Name, SB_GetConstBuf (&Word), SB_GetLen (&Word) + 1);
+        CollAppend (&Deps, D);
+
+        Kind = getc (F);
+    }
+
+    /* The header may be used. Apply the macro definitions */
+    while (Kind == 'M' || Kind == 'U') {
+        if (Kind == 'M') {
+            if ((M = ReadMacro (F)) == 0) {
+                goto Invalid;
+            }
+            UndefineMacro (M->Name);
+            InsertMacro (M);
+        } else {
+            if (!ReadWord (F, &Word) || getc (F) != '\n') {
+                goto Invalid;
+            }
+            UndefineMacro (SB_GetConstBuf (&Word));
+        }
+        Kind = getc (F);
+    }
+    if (Kind != 'T' || getc (F) != '\n') {
+        goto Invalid;
+    }
+
+    /* Remember the input files of the header for the dependencies */
+    for (I = 0; I < CollCount (&Deps); ++I) {
+        const PCHDep* D = CollConstAt (&Deps, I);
+        AddInputFile (D->Name, D->Type, D->Size, D->MTime, D->Guard, D->Once);
+    }
+    FreePCHDeps (&Deps);
+    SB_Done (&Word);
+
+    /* The remainder of the file is the preprocessed text. It is read by the
+    ** input module, which also closes the file.
+    */
+    OpenPreprocessedFile (Name, F);
+    Print (stdout, 1, "Loaded precompiled header `%s'\n", Name);
+    return 1;
+
+Reject:
+    PPWarning ("Precompiled header `%s' %s, ignoring it", Name, Reason);
+    fclose (F);
+    FreePCHDeps (&Deps);
+    SB_Done (&Word);
+    return 0;
+
+Invalid:
+    Fatal ("`%s' is not a valid precompiled header", Name);
+}
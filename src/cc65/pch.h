@@ -0,0 +1,61 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                   pch.h                                   */
+/*                                                                           */
+/*                Precompiled headers for the cc65 C compiler                */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef PCH_H
+#define PCH_H
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void CreatePCH (const char* Name);
+/* Preprocess the main input file and write the resulting text together with
+** all macros defined by it to the precompiled header with the given name.
+*/
+
+int LoadPCH (const char* Name);
+/* Load the precompiled header with the given name. The macros from the
+** header are defined and its preprocessed text is pushed as input, so it is
+** read before the remainder of the current input file. Returns true if the
+** header was loaded, and false if it was out of date or did not match the
+** current settings.
+*/
+
+
+
+/* End of pch.h */
+
+#endif
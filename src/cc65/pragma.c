@@ -49,6 +49,7 @@
 #include "litpool.h"
 #include "scanner.h"
 #include "scanstrbuf.h"
+#include "staticframe.h"
 #include "symtab.h"
 #include "pragma.h"
 #include "wrappedcall.h"
@@ -76,6 +77,7 @@ typedef enum {
     PRAGMA_CODESIZE,
     PRAGMA_DATA_NAME,
     PRAGMA_DATASEG,                                     /* obsolete */
+    PRAGMA_INLINE_FUNCS,
     PRAGMA_INLINE_STDFUNCS,
     PRAGMA_LOCAL_STRINGS,
     PRAGMA_MESSAGE,
@@ -113,6 +115,7 @@ static const struct Pragma {
     { "codesize",               PRAGMA_CODESIZE           },
     { "data-name",              PRAGMA_DATA_NAME          },
     { "dataseg",                PRAGMA_DATASEG            },      /* obsolete */
+    { "inline-funcs",           PRAGMA_INLINE_FUNCS       },
     { "inline-stdfuncs",        PRAGMA_INLINE_STDFUNCS    },
     { "local-strings",          PRAGMA_LOCAL_STRINGS      },
     { "message",                PRAGMA_MESSAGE            },
@@ -527,6 +530,9 @@ static void WrappedCallPragma (StrBuf* B)
 
         PushWrappedCall(Entry, Val);
         Entry->Flags |= SC_REF;
+        if (StaticFrames) {
+            SF_AddRef (Entry);
+        }
         Entry->V.F.Func->Flags |= FD_CALL_WRAPPER;
 
     } else {
@@ -850,6 +856,10 @@ static void ParsePragma (void)
             SegNamePragma (&B, SEG_DATA);
             break;
 
+        case PRAGMA_INLINE_FUNCS:
+            FlagPragma (&B, &InlineFuncs);
+            break;
+
         case PRAGMA_INLINE_STDFUNCS:
             FlagPragma (&B, &InlineStdFuncs);
             break;
@@ -1039,10 +1039,88 @@ static void DoError (void)
 
 
 
+static int IsGuardCondition (ident Ident)
+/* Check if the remainder of the line is "!defined(X)" or "!defined X", which
+** may start an include guard like "#ifndef X". Return the name of the macro
+** in Ident in this case. The line is not changed.
+*/
+{
+    StrBuf      Copy = AUTO_STRBUF_INITIALIZER;
+    StrBuf      Cond = AUTO_STRBUF_INITIALIZER;
+    const char* S;
+    unsigned    Len = 0;
+    int         HaveParen = 0;
+    int         Found = 0;
+
+    /* Remove comments and white space from a copy of the line */
+    SB_CopyBuf (&Copy, SB_GetConstBuf (Line) + SB_GetIndex (Line),
+                SB_GetLen (Line) - SB_GetIndex (Line));
+    SB_Terminate (&Copy);
+    Pass1 (&Copy, &Cond);
+    SB_Terminate (&Cond);
+
+    /* Check the condition */
+    S = SB_GetConstBuf (&Cond);
+    while (IsSpace (*S)) {
+        ++S;
+    }
+    if (*S++ == '!') {
+        while (IsSpace (*S)) {
+            ++S;
+        }
+        if (strncmp (S, "defined", 7) == 0 && !IsIdent (S[7]) && !IsDigit (S[7])) {
+            S += 7;
+            while (IsSpace (*S)) {
+                ++S;
+            }
+            if (*S == '(') {
+                HaveParen = 1;
+                ++S;
+                while (IsSpace (*S)) {
+                    ++S;
+                }
+            }
+            if (IsIdent (*S)) {
+                while (Len < MAX_IDENTLEN && (IsIdent (S[Len]) || IsDigit (S[Len]))) {
+                    Ident[Len] = S[Len];
+                    ++Len;
+                }
+                Ident[Len] = '\0';
+                S += Len;
+                while (IsSpace (*S)) {
+                    ++S;
+                }
+                if (HaveParen && *S == ')') {
+                    HaveParen = 0;
+                    ++S;
+                    while (IsSpace (*S)) {
+                        ++S;
+                    }
+                }
+                Found = (!HaveParen && *S == '\0');
+            }
+        }
+    }
+
+    SB_Done (&Copy);
+    SB_Done (&Cond);
+    return Found;
+}
+
+
+
 static int DoIf (int Skip)
 /* Process #if directive */
 {
     ExprDesc Expr;
+    ident    Ident;
+
+    /* "#if !defined(X)" may start an include guard like "#ifndef X" */
+    if (IsGuardCondition (Ident)) {
+        GuardIfndef (Ident, IfIndex);
+    } else {
+        GuardContent (IfIndex);
+    }
 
     /* We're about to abuse the compiler expression parser to evaluate the
     ** #if expression. Save the current tokens to come back here later.
@@ -1102,6 +1180,12 @@ static int DoIfDef (int skip, int flag)
     if (MacName (Ident) == 0) {
         return 0;
     } else {
+        /* An #ifndef may start an include guard */
+        if (flag) {
+            GuardContent (IfIndex);
+        } else {
+            GuardIfndef (Ident, IfIndex);
+        }
         return PushIf (skip, flag, IsMacro(Ident));
     }
 }
@@ -1171,9 +1255,11 @@ Done:
 
 
 
-static void DoPragma (void)
+static int DoPragma (void)
 /* Handle a #pragma line by converting the #pragma preprocessor directive into
-** the _Pragma() compiler operator.
+** the _Pragma() compiler operator. #pragma once is handled here, since it
+** affects the preprocessor only. The function returns false in this case,
+** and true if the line was converted.
 */
 {
     /* Skip blanks following the #pragma directive */
@@ -1183,6 +1269,17 @@ static void DoPragma (void)
     SB_Clear (MLine);
     Pass1 (Line, MLine);
 
+    /* Check for #pragma once. Comments following it became white space */
+    while (IsSpace (SB_LookAtLast (MLine))) {
+        SB_Drop (MLine, 1);
+    }
+    SB_Terminate (MLine);
+    if (strcmp (SB_GetConstBuf (MLine), "once") == 0) {
+        IncludeOnce ();
+        ClearLine ();
+        return 0;
+    }
+
     /* Convert the directive into the operator */
     SB_CopyStr (Line, "_Pragma (");
     SB_Reset (MLine);
@@ -1192,6 +1289,7 @@ static void DoPragma (void)
     /* Initialize reading from line */
     SB_Reset (Line);
     InitLine (Line);
+    return 1;
 }
 
 
@@ -1230,6 +1328,12 @@ void Preprocess (void)
 {
     int         Skip;
     ident       Directive;
+    pptoken_t   Tok;
+
+    /* Lines read from a precompiled header have already been preprocessed */
+    if (InputIsPreprocessed ()) {
+        return;
+    }
 
     /* Create the output buffer if we don't already have one */
     if (MLine == 0) {
@@ -1253,9 +1357,22 @@ void Preprocess (void)
             }
             if (!IsSym (Directive)) {
                 PPError ("Preprocessor directive expected");
+                GuardContent (IfIndex);
                 ClearLine ();
             } else {
-                switch (FindPPToken (Directive)) {
+                Tok = FindPPToken (Directive);
+
+                /* Tell the include guard detection about the directive. The
+                ** ones that may start or end a guard are handled separately.
+                ** #else and #elif belong to the level of their #if.
+                */
+                if (Tok == PP_ELSE || Tok == PP_ELIF) {
+                    GuardContent (IfIndex - 1);
+                } else if (Tok != PP_IF && Tok != PP_IFNDEF && Tok != PP_ENDIF) {
+                    GuardContent (IfIndex);
+                }
+
+                switch (Tok) {
 
                     case PP_DEFINE:
                         if (!Skip) {
@@ -1313,6 +1430,9 @@ void Preprocess (void)
 
                             /* Remove the clause that needs a terminator */
                             Skip = (IfStack[IfIndex--] & IFCOND_SKIP) != 0;
+
+                            /* This may end an include guard */
+                            GuardEndif (IfIndex);
                         } else {
                             PPError ("Unexpected `#endif'");
                         }
@@ -1350,8 +1470,7 @@ void Preprocess (void)
                         break;
 
                     case PP_PRAGMA:
-                        if (!Skip) {
-                            DoPragma ();
+                        if (!Skip && DoPragma ()) {
                             goto Done;
                         }
                         break;
@@ -1396,6 +1515,12 @@ void Preprocess (void)
 
     PreprocessLine ();
 
+    /* Tell the include guard detection if the line contains code */
+    SkipWhitespace (0);
+    if (CurC != '\0') {
+        GuardContent (IfIndex);
+    }
+
 Done:
     if (Verbosity > 1 && SB_NotEmpty (Line)) {
         printf ("%s(%u): %.*s\n", GetCurrentFile (), GetCurrentLine (),
@@ -0,0 +1,634 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                               staticframe.c                               */
+/*                                                                           */
+/*                 Overlaid static frames for local variables                */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <string.h>
+
+/* common */
+#include "attrib.h"
+#include "chartype.h"
+#include "coll.h"
+#include "xmalloc.h"
+
+/* cc65 */
+#include "asmlabel.h"
+#include "codeent.h"
+#include "codegen.h"
+#include "codeseg.h"
+#include "error.h"
+#include "global.h"
+#include "segments.h"
+#include "staticframe.h"
+#include "symtab.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* State of a frame while checking the call graph */
+enum {
+    SF_UNKNOWN,                 /* Not checked yet */
+    SF_CHECKING,                /* Currently being checked */
+    SF_CLOSED,                  /* Only calls closed functions, no recursion */
+    SF_OPEN                     /* May call unknown code or itself */
+};
+
+/* A variable in a static frame */
+typedef struct FrameVar FrameVar;
+struct FrameVar {
+    unsigned            Label;          /* Data label of the variable */
+    unsigned            Offs;           /* Offset in the frame */
+    unsigned            Size;           /* Size of the variable */
+    unsigned long       Weight;         /* Weighted number of references */
+};
+
+/* The static frame of a function */
+struct StaticFrame {
+    Collection          Callees;        /* Names of called functions */
+    Collection          Vars;           /* Variables in the frame */
+    Collection          ZPVars;         /* Variables in the register bank */
+    unsigned            Size;           /* Size of the frame */
+    unsigned            Start;          /* Offset in the frame area */
+    unsigned            Mark;           /* Mark for graph traversals */
+    unsigned            Refs;           /* References to the function */
+    unsigned            Calls;          /* Direct calls of the function */
+    unsigned            RegOffs;        /* Start of the register variables */
+    unsigned            RegLimit;       /* Free register bank while active */
+    unsigned char       State;          /* Check state, see above */
+    unsigned char       CallsUnknown;   /* Calls code we don't know */
+    unsigned char       RegVars;        /* May use the free register bank */
+    unsigned char       Rooted;         /* Only called from main() */
+};
+
+
+
+/*****************************************************************************/
+/*                              Helper functions                             */
+/*****************************************************************************/
+
+
+
+static StaticFrame* FrameOf (const SymEntry* Sym)
+/* Return the frame of a function symbol, or NULL if the symbol is not a
+** function or the function has no frame.
+*/
+{
+    return ((Sym->Flags & SC_FUNC) == SC_FUNC)? Sym->V.F.Frame : 0;
+}
+
+
+
+static StaticFrame* GetFrame (SymEntry* Func)
+/* Return the frame of the given function, creating it if necessary */
+{
+    StaticFrame* F = Func->V.F.Frame;
+    if (F == 0) {
+        F = xmalloc (sizeof (StaticFrame));
+        InitCollection (&F->Callees);
+        InitCollection (&F->Vars);
+        InitCollection (&F->ZPVars);
+        F->Size         = 0;
+        F->Start        = 0;
+        F->Mark         = 0;
+        F->Refs         = 0;
+        F->Calls        = 0;
+        F->RegOffs      = RegisterSpace;
+        F->RegLimit     = 0;
+        F->State        = SF_UNKNOWN;
+        F->CallsUnknown = 0;
+        F->RegVars      = 0;
+        F->Rooted       = 0;
+        Func->V.F.Frame = F;
+    }
+    return F;
+}
+
+
+
+static void FreeFrame (SymEntry* Func)
+/* Free the frame of the given function */
+{
+    StaticFrame* F = Func->V.F.Frame;
+    unsigned     I;
+
+    for (I = 0; I < CollCount (&F->Callees); ++I) {
+        xfree (CollAtUnchecked (&F->Callees, I));
+    }
+    DoneCollection (&F->Callees);
+    for (I = 0; I < CollCount (&F->Vars); ++I) {
+        xfree (CollAtUnchecked (&F->Vars, I));
+    }
+    DoneCollection (&F->Vars);
+    for (I = 0; I < CollCount (&F->ZPVars); ++I) {
+        xfree (CollAtUnchecked (&F->ZPVars, I));
+    }
+    DoneCollection (&F->ZPVars);
+    xfree (F);
+    Func->V.F.Frame = 0;
+}
+
+
+
+static SymEntry* GetCallee (const char* Name)
+/* Return the symbol of a function defined in this translation unit with the
+** given name, or NULL if there is no such function.
+*/
+{
+    SymEntry* Sym = FindGlobalSym (Name);
+    if (Sym && (Sym->Flags & SC_FUNC) == SC_FUNC && SymIsDef (Sym)) {
+        return Sym;
+    }
+    return 0;
+}
+
+
+
+static int IsClosed (SymEntry* Func)
+/* Check if the function and everything it calls is known to the compiler,
+** does not recurse, and the address of the function is never taken. Only the
+** frames of such functions are overlaid.
+*/
+{
+    StaticFrame* F = Func->V.F.Frame;
+    unsigned     I;
+
+    /* A function without a frame doesn't call anything */
+    if (F == 0) {
+        return 1;
+    }
+
+    switch (F->State) {
+        case SF_CLOSED:
+            return 1;
+        case SF_OPEN:
+            return 0;
+        case SF_CHECKING:
+            /* We're called recursively */
+            F->State = SF_OPEN;
+            return 0;
+        default:
+            break;
+    }
+
+    /* Check all functions called. A function whose address is taken may be
+    ** an interrupt handler, which can run while any other function is active,
+    ** so it doesn't qualify either.
+    */
+    F->State = SF_CHECKING;
+    if (F->CallsUnknown || F->Refs > F->Calls) {
+        F->State = SF_OPEN;
+        return 0;
+    }
+    for (I = 0; I < CollCount (&F->Callees); ++I) {
+        SymEntry* Callee = GetCallee (CollConstAt (&F->Callees, I));
+        if (Callee == 0 || !IsClosed (Callee)) {
+            F->State = SF_OPEN;
+            return 0;
+        }
+    }
+
+    /* A recursive call may have marked the frame as open meanwhile */
+    if (F->State == SF_CHECKING) {
+        F->State = SF_CLOSED;
+    }
+    return F->State == SF_CLOSED;
+}
+
+
+
+static int Reaches (const SymEntry* From, const SymEntry* To, unsigned Mark)
+/* Check if the function From may call the function To directly or through
+** other functions of the translation unit. Mark is used to visit each frame
+** only once and must be unique for each top level call.
+*/
+{
+    StaticFrame* F = FrameOf (From);
+    unsigned     I;
+
+    if (F == 0 || F->Mark == Mark) {
+        return 0;
+    }
+    F->Mark = Mark;
+
+    for (I = 0; I < CollCount (&F->Callees); ++I) {
+        const SymEntry* Callee = GetCallee (CollConstAt (&F->Callees, I));
+        if (Callee && (Callee == To || Reaches (Callee, To, Mark))) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+
+static int CompareVarWeight (void* Data attribute ((unused)),
+                             const void* Left, const void* Right)
+/* Compare function for CollSort, orders variables by decreasing weight per
+** byte, and smaller variables first if that is the same.
+*/
+{
+    const FrameVar* L = Left;
+    const FrameVar* R = Right;
+    unsigned long LW = L->Weight * R->Size;
+    unsigned long RW = R->Weight * L->Size;
+    if (LW != RW) {
+        return (LW > RW)? -1 : 1;
+    }
+    if (L->Size != R->Size) {
+        return (L->Size < R->Size)? -1 : 1;
+    }
+    return (L->Offs < R->Offs)? -1 : 1;
+}
+
+
+
+static int RefersTo (const char* Arg, const char* Name)
+/* Check if the operand Arg refers to the label Name */
+{
+    unsigned Len = strlen (Name);
+    while ((Arg = strstr (Arg, Name)) != 0) {
+        if (!IsAlNum (Arg[Len]) && Arg[Len] != '_') {
+            return 1;
+        }
+        Arg += Len;
+    }
+    return 0;
+}
+
+
+
+static void WeighVars (SymEntry* Func, StaticFrame* F)
+/* Count the references to the variables of a function. References within
+** loops count four times per nesting level, so the variables used in the
+** innermost loops get the highest weight.
+*/
+{
+    CodeSeg*       S     = Func->V.F.Seg->Code;
+    unsigned       Count = CS_GetEntryCount (S);
+    unsigned char* Depth = xmalloc (Count + 1);
+    unsigned       I, J;
+
+    /* Determine the loop nesting of each entry. A backward jump closes a
+    ** loop that starts at its target.
+    */
+    memset (Depth, 0, Count + 1);
+    for (I = 0; I < Count; ++I) {
+        CodeEntry* E = CS_GetEntry (S, I);
+        if (E->JumpTo && E->JumpTo->Owner) {
+            unsigned Target = CS_GetEntryIndex (S, E->JumpTo->Owner);
+            for (J = Target; J <= I; ++J) {
+                if (Depth[J] < 4) {
+                    ++Depth[J];
+                }
+            }
+        }
+    }
+
+    /* Weigh the references */
+    for (I = 0; I < CollCount (&F->Vars); ++I) {
+        FrameVar*   V    = CollAtUnchecked (&F->Vars, I);
+        const char* Name = LocalLabelName (V->Label);
+        V->Weight = 0;
+        for (J = 0; J < Count; ++J) {
+            const CodeEntry* E = CS_GetEntry (S, J);
+            if (E->Arg && RefersTo (E->Arg, Name)) {
+                V->Weight += 1UL << (2 * Depth[J]);
+            }
+        }
+    }
+
+    xfree (Depth);
+}
+
+
+
+static void FindRegLimits (void)
+/* Determine for each function whether it is only called from main() through
+** functions of this translation unit, and how much of the register bank is
+** unused by all functions that may be active at the same time.
+*/
+{
+    SymEntry* Func;
+    unsigned  Changes;
+    unsigned  I;
+
+    /* Start with the functions on their own. Functions with external linkage
+    ** and functions whose address is taken may be called from anywhere, so
+    ** we don't know what's in the register bank. main() is called from the
+    ** startup code, which doesn't use it.
+    */
+    for (Func = GetGlobalSymTab ()->SymHead; Func; Func = Func->NextSym) {
+        StaticFrame* F = FrameOf (Func);
+        if (F && SymIsDef (Func)) {
+            F->RegLimit = F->RegOffs;
+            F->Rooted   = strcmp (Func->Name, "main") == 0 ||
+                          ((Func->Flags & SC_EXTERN) == 0 && F->Refs <= F->Calls);
+        }
+    }
+
+    /* Propagate the information down the call graph */
+    do {
+        Changes = 0;
+        for (Func = GetGlobalSymTab ()->SymHead; Func; Func = Func->NextSym) {
+            StaticFrame* F = FrameOf (Func);
+            if (F == 0 || !SymIsDef (Func)) {
+                continue;
+            }
+            for (I = 0; I < CollCount (&F->Callees); ++I) {
+                SymEntry*    Callee = GetCallee (CollConstAt (&F->Callees, I));
+                StaticFrame* C      = Callee? Callee->V.F.Frame : 0;
+                if (C == 0) {
+                    continue;
+                }
+                if (C->Rooted && !F->Rooted) {
+                    C->Rooted = 0;
+                    ++Changes;
+                }
+                if (C->RegLimit > F->RegLimit) {
+                    C->RegLimit = F->RegLimit;
+                    ++Changes;
+                }
+            }
+        }
+    } while (Changes);
+}
+
+
+
+static void PlaceRegVars (SymEntry* Func, StaticFrame* F)
+/* Move the most used variables of a leaf function into the free part of the
+** register bank, as far as they fit.
+*/
+{
+    unsigned Offs = 0;
+    unsigned I;
+
+    /* Sort the variables by use and move them to the register bank */
+    WeighVars (Func, F);
+    CollSort (&F->Vars, CompareVarWeight, 0);
+    I = 0;
+    while (I < CollCount (&F->Vars)) {
+        FrameVar* V = CollAtUnchecked (&F->Vars, I);
+        if (Offs + V->Size <= F->RegLimit) {
+            V->Offs = Offs;
+            Offs += V->Size;
+            CollAppend (&F->ZPVars, V);
+            CollDelete (&F->Vars, I);
+        } else {
+            ++I;
+        }
+    }
+
+    /* Lay out the remaining variables again */
+    F->Size = 0;
+    for (I = 0; I < CollCount (&F->Vars); ++I) {
+        FrameVar* V = CollAtUnchecked (&F->Vars, I);
+        V->Offs = F->Size;
+        F->Size += V->Size;
+    }
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void SF_AddVar (SymEntry* Func, unsigned Label, unsigned Size)
+/* Add a static local variable with the given data label and size to the
+** frame of the function Func.
+*/
+{
+    StaticFrame* F = GetFrame (Func);
+    FrameVar*    V = xmalloc (sizeof (FrameVar));
+
+    /* Variables are placed one after the other */
+    V->Label = Label;
+    V->Offs   = F->Size;
+    V->Size   = Size;
+    V->Weight = 0;
+    CollAppend (&F->Vars, V);
+    F->Size += Size;
+}
+
+
+
+void SF_AddCall (SymEntry* Func, const char* Callee)
+/* Remember that the function Func calls the function with the given name.
+** A NULL name means that Func calls code not known to the compiler, for
+** example through a function pointer or from inline assembler code.
+*/
+{
+    StaticFrame* F = GetFrame (Func);
+    SymEntry*    Sym;
+    unsigned     I;
+
+    if (Callee == 0) {
+        F->CallsUnknown = 1;
+        return;
+    }
+
+    /* Count the call, so it isn't mistaken for taking the address */
+    Sym = FindGlobalSym (Callee);
+    if (Sym && (Sym->Flags & SC_FUNC) == SC_FUNC) {
+        ++GetFrame (Sym)->Calls;
+    }
+
+    /* Remember each callee only once */
+    for (I = 0; I < CollCount (&F->Callees); ++I) {
+        if (strcmp (CollConstAt (&F->Callees, I), Callee) == 0) {
+            return;
+        }
+    }
+    CollAppend (&F->Callees, xstrdup (Callee));
+}
+
+
+
+void SF_AddRef (SymEntry* Func)
+/* Remember that the function Func is referenced by name. References that
+** are not calls take the address of the function, which may then be called
+** from anywhere.
+*/
+{
+    ++GetFrame (Func)->Refs;
+}
+
+
+
+void SF_SetRegVars (SymEntry* Func, unsigned RegOffs, int Enabled)
+/* Remember that the register variables of the function Func start at offset
+** RegOffs in the register bank. If Enabled is true, variables of Func may be
+** placed into the part of the register bank that is unused while Func is
+** active.
+*/
+{
+    StaticFrame* F = GetFrame (Func);
+    F->RegOffs = RegOffs;
+    F->RegVars = (Enabled != 0);
+}
+
+
+
+void SF_Allocate (void)
+/* Allocate the static frames of all functions in the translation unit.
+** Frames of functions that can never be active at the same time share the
+** same memory. The data labels of the variables are defined accordingly.
+** Only the call graph of this translation unit is known: The object files
+** have no call edges, so the linker cannot overlay the frames of different
+** modules, and a function calling into another module is never closed.
+*/
+{
+    SymEntry* Func;
+    unsigned  Size;
+    unsigned  Changes;
+    unsigned  Mark;
+    unsigned  I;
+
+    /* Determine which functions are closed. A closed function may only call
+    ** other closed functions, so while it is active, the only other closed
+    ** functions that may be active are the ones on its call chain.
+    */
+    for (Func = GetGlobalSymTab ()->SymHead; Func; Func = Func->NextSym) {
+        if (FrameOf (Func)) {
+            IsClosed (Func);
+        }
+    }
+
+    /* Variables of leaf functions go into the register bank if all functions
+    ** that may be active at the same time leave enough of it unused. Leaf
+    ** functions never run at the same time, so they all share the space.
+    */
+    FindRegLimits ();
+    for (Func = GetGlobalSymTab ()->SymHead; Func; Func = Func->NextSym) {
+        StaticFrame* F = FrameOf (Func);
+        if (F && F->RegVars && F->Rooted && F->RegLimit > 0 &&
+            F->State == SF_CLOSED && CollCount (&F->Callees) == 0) {
+            PlaceRegVars (Func, F);
+        }
+    }
+
+    /* Warn about recursive functions. Their variables are not overlaid with
+    ** other frames, but they are overwritten by the recursive calls.
+    */
+    Mark = 0;
+    for (Func = GetGlobalSymTab ()->SymHead; Func; Func = Func->NextSym) {
+        StaticFrame* F = FrameOf (Func);
+        if (F && F->State == SF_OPEN && CollCount (&F->Vars) > 0 &&
+            Reaches (Func, Func, ++Mark)) {
+            Warning ("Static local variables of recursive function `%s' "
+                     "are overwritten by recursive calls, use "
+                     "`#pragma static-locals (off)' to keep them on the stack",
+                     Func->Name);
+        }
+    }
+
+    /* Place the frame of each closed function behind the frames of all
+    ** closed functions calling it. Since the closed functions don't recurse,
+    ** this terminates.
+    */
+    do {
+        Changes = 0;
+        for (Func = GetGlobalSymTab ()->SymHead; Func; Func = Func->NextSym) {
+            StaticFrame* F = FrameOf (Func);
+            if (F == 0 || F->State != SF_CLOSED) {
+                continue;
+            }
+            for (I = 0; I < CollCount (&F->Callees); ++I) {
+                SymEntry*    Callee = GetCallee (CollConstAt (&F->Callees, I));
+                StaticFrame* C      = Callee->V.F.Frame;
+                if (C && C->Start < F->Start + F->Size) {
+                    C->Start = F->Start + F->Size;
+                    ++Changes;
+                }
+            }
+        }
+    } while (Changes);
+
+    /* The overlay area is followed by the frames of all other functions */
+    Size = 0;
+    for (Func = GetGlobalSymTab ()->SymHead; Func; Func = Func->NextSym) {
+        StaticFrame* F = FrameOf (Func);
+        if (F && F->State == SF_CLOSED && F->Start + F->Size > Size) {
+            Size = F->Start + F->Size;
+        }
+    }
+    for (Func = GetGlobalSymTab ()->SymHead; Func; Func = Func->NextSym) {
+        StaticFrame* F = FrameOf (Func);
+        if (F && F->State != SF_CLOSED) {
+            F->Start = Size;
+            Size += F->Size;
+        }
+    }
+
+    /* Reserve the memory and define the variable labels */
+    if (Size > 0) {
+        unsigned Area = GetLocalLabel ();
+        g_usebss ();
+        g_defdatalabel (Area);
+        g_res (Size);
+        for (Func = GetGlobalSymTab ()->SymHead; Func; Func = Func->NextSym) {
+            StaticFrame* F = FrameOf (Func);
+            if (F == 0) {
+                continue;
+            }
+            for (I = 0; I < CollCount (&F->Vars); ++I) {
+                const FrameVar* V = CollConstAt (&F->Vars, I);
+                g_aliasdatalabel (V->Label, Area, F->Start + V->Offs);
+            }
+        }
+    }
+
+    /* Define the labels of the variables in the register bank */
+    for (Func = GetGlobalSymTab ()->SymHead; Func; Func = Func->NextSym) {
+        StaticFrame* F = FrameOf (Func);
+        if (F == 0) {
+            continue;
+        }
+        for (I = 0; I < CollCount (&F->ZPVars); ++I) {
+            const FrameVar* V = CollConstAt (&F->ZPVars, I);
+            g_aliasregbank (V->Label, V->Offs);
+        }
+    }
+
+    /* Free the frames */
+    for (Func = GetGlobalSymTab ()->SymHead; Func; Func = Func->NextSym) {
+        if (FrameOf (Func)) {
+            FreeFrame (Func);
+        }
+    }
+}
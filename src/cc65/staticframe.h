@@ -0,0 +1,94 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                               staticframe.h                               */
+/*                                                                           */
+/*                 Overlaid static frames for local variables                */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef STATICFRAME_H
+#define STATICFRAME_H
+
+
+
+/* cc65 */
+#include "symentry.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* The static frame of a function */
+typedef struct StaticFrame StaticFrame;
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void SF_AddVar (SymEntry* Func, unsigned Label, unsigned Size);
+/* Add a static local variable with the given data label and size to the
+** frame of the function Func.
+*/
+
+void SF_AddCall (SymEntry* Func, const char* Callee);
+/* Remember that the function Func calls the function with the given name.
+** A NULL name means that Func calls code not known to the compiler, for
+** example through a function pointer or from inline assembler code.
+*/
+
+void SF_AddRef (SymEntry* Func);
+/* Remember that the function Func is referenced by name. References that
+** are not calls take the address of the function, which may then be called
+** from anywhere.
+*/
+
+void SF_SetRegVars (SymEntry* Func, unsigned RegOffs, int Enabled);
+/* Remember that the register variables of the function Func start at offset
+** RegOffs in the register bank. If Enabled is true, variables of Func may be
+** placed into the part of the register bank that is unused while Func is
+** active.
+*/
+
+void SF_Allocate (void);
+/* Allocate the static frames of all functions in the translation unit.
+** Frames of functions that can never be active at the same time share the
+** same memory. The data labels of the variables are defined accordingly.
+*/
+
+
+
+/* End of staticframe.h */
+
+#endif
@@ -414,9 +414,13 @@ static void ForStatement (void)
 {
     ExprDesc lval1;
     ExprDesc lval3;
+    int HaveTestExpr;
     int HaveIncExpr;
+    CodeMark TestExprStart;
+    CodeMark TestExprEnd;
     CodeMark IncExprStart;
     CodeMark IncExprEnd;
+    CodeMark Here;
     int PendingToken;
 
     /* Get several local labels needed later */
@@ -442,34 +446,29 @@ static void ForStatement (void)
     }
     ConsumeSemi ();
 
-    /* Label for the test expressions */
-    g_defcodelabel (TestLabel);
+    /* The test expression is moved to the end of the loop, so the loop is
+    ** entered by a jump to the test, and each iteration needs just one
+    ** conditional branch back to the body.
+    */
+    HaveTestExpr = (CurTok.Tok != TOK_SEMI);
+    if (HaveTestExpr) {
+        g_jump (TestLabel);
+    }
 
     /* Parse the test expression */
-    if (CurTok.Tok != TOK_SEMI) {
+    GetCodePos (&TestExprStart);
+    if (HaveTestExpr) {
         Test (BodyLabel, 1);
-        g_jump (BreakLabel);
-    } else {
-        g_jump (BodyLabel);
     }
+    GetCodePos (&TestExprEnd);
     ConsumeSemi ();
 
-    /* Remember the start of the increment expression */
-    GetCodePos (&IncExprStart);
-
-    /* Label for the increment expression */
-    g_defcodelabel (IncLabel);
-
     /* Parse the increment expression */
+    GetCodePos (&IncExprStart);
     HaveIncExpr = (CurTok.Tok != TOK_RPAREN);
     if (HaveIncExpr) {
         Expression0 (&lval3);
     }
-
-    /* Jump to the test */
-    g_jump (TestLabel);
-
-    /* Remember the end of the increment expression */
     GetCodePos (&IncExprEnd);
 
     /* Skip the closing paren */
@@ -479,17 +478,18 @@ static void ForStatement (void)
     g_defcodelabel (BodyLabel);
     Statement (&PendingToken);
 
-    /* If we had an increment expression, move the code to the bottom of
-    ** the loop. In this case we don't need to jump there at the end of
-    ** the loop body.
+    /* Move the increment expression and the test to the bottom of the loop.
+    ** Without a test, jump back to the start of the body.
     */
-    if (HaveIncExpr) {
-        CodeMark Here;
+    g_defcodelabel (IncLabel);
+    GetCodePos (&Here);
+    MoveCode (&IncExprStart, &IncExprEnd, &Here);
+    if (HaveTestExpr) {
+        g_defcodelabel (TestLabel);
         GetCodePos (&Here);
-        MoveCode (&IncExprStart, &IncExprEnd, &Here);
+        MoveCode (&TestExprStart, &TestExprEnd, &Here);
     } else {
-        /* Jump back to the increment expression */
-        g_jump (IncLabel);
+        g_jump (BodyLabel);
     }
 
     /* Skip a pending token if we have one */
@@ -36,6 +36,7 @@
 #include <string.h>
 
 /* common */
+#include "hashfunc.h"
 #include "xmalloc.h"
 
 /* cc65 */
@@ -71,6 +72,7 @@ SymEntry* NewSymEntry (const char* Name, unsigned Flags)
     E->Type     = 0;
     E->Attr     = 0;
     E->AsmName  = 0;
+    E->Hash     = HashStr (Name);
     E->V.BssName = 0;
     memcpy (E->Name, Name, Len+1);
 
@@ -116,6 +118,7 @@ void DumpSymEntry (FILE* F, const SymEntry* E)
         { "SC_DEF",         SC_DEF              },
         { "SC_REF",         SC_REF              },
         { "SC_ZEROPAGE",    SC_ZEROPAGE         },
+        { "SC_INLINE",      SC_INLINE           },
     };
 
     unsigned I;
@@ -98,6 +98,8 @@ struct LiteralPool;
 
 #define SC_HAVEATTR     0x10000U        /* Symbol has attributes */
 
+#define SC_INLINE       0x20000U        /* Function declared inline */
+
 
 
 /* Symbol table entry */
@@ -112,6 +114,7 @@ struct SymEntry {
     Type*                       Type;     /* Symbol type */
     Collection*                 Attr;     /* Attribute list if any */
     char*                       AsmName;  /* Assembler name if any */
+    unsigned                    Hash;     /* Full hash value of the name */
 
     /* Data that differs for the different symbol types */
     union {
@@ -151,6 +154,7 @@ struct SymEntry {
             struct FuncDesc*    Func;     /* Function descriptor */
             struct Segments*    Seg;      /* Segments for this function */
             struct LiteralPool* LitPool;  /* Literal pool for this function */
+            struct StaticFrame* Frame;    /* Static frame for --static-frames */
         } F;
 
         /* Segment name for tentantive global definitions */
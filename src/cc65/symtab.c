@@ -67,22 +67,28 @@
 
 
 /* An empty symbol table */
+static SymEntry* EmptyTab[1] = { 0 };
 SymTable        EmptySymTab = {
     0,          /* PrevTab */
     0,          /* SymHead */
     0,          /* SymTail */
     0,          /* SymCount */
     1,          /* Size */
-    { 0 }       /* Tab[1] */
+    EmptyTab    /* Tab */
 };
 
-/* Symbol table sizes */
+/* Initial symbol table sizes. The tables grow if they get too crowded, so
+** these are just starting points that avoid resizing for the common case.
+*/
 #define SYMTAB_SIZE_GLOBAL      211U
 #define SYMTAB_SIZE_FUNCTION     29U
 #define SYMTAB_SIZE_BLOCK        13U
 #define SYMTAB_SIZE_STRUCT       19U
 #define SYMTAB_SIZE_LABEL         7U
 
+/* Maximum average length of the hash chains before a table is resized */
+#define SYMTAB_MAX_LOAD           2U
+
 /* The current and root symbol tables */
 static unsigned         LexicalLevel    = 0;    /* For safety checks */
 static SymTable*        SymTab0         = 0;
@@ -105,7 +111,7 @@ static SymTable* NewSymTable (unsigned Size)
     unsigned I;
 
     /* Allocate memory for the table */
-    SymTable* S = xmalloc (sizeof (SymTable) + (Size-1) * sizeof (SymEntry*));
+    SymTable* S = xmalloc (sizeof (SymTable));
 
     /* Initialize the symbol table structure */
     S->PrevTab  = 0;
@@ -113,6 +119,7 @@ static SymTable* NewSymTable (unsigned Size)
     S->SymTail  = 0;
     S->SymCount = 0;
     S->Size     = Size;
+    S->Tab      = xmalloc (Size * sizeof (SymEntry*));
     for (I = 0; I < Size; ++I) {
         S->Tab[I] = 0;
     }
@@ -135,11 +142,42 @@ static void FreeSymTable (SymTable* S)
     }
 
     /* Free the table itself */
+    xfree (S->Tab);
     xfree (S);
 }
 
 
 
+static void GrowSymTable (SymTable* S)
+/* Increase the size of the hash table of S and rehash all symbols */
+{
+    unsigned  I;
+    SymEntry* Sym;
+
+    /* Allocate the new hash table. Keep the size odd, so the modulo
+    ** operation uses all bits of the hash value.
+    */
+    unsigned NewSize = S->Size * 2 + 1;
+    xfree (S->Tab);
+    S->Tab = xmalloc (NewSize * sizeof (SymEntry*));
+    for (I = 0; I < NewSize; ++I) {
+        S->Tab[I] = 0;
+    }
+    S->Size = NewSize;
+
+    /* Rehash all symbols using the remembered full hash values. The double
+    ** linked list contains all symbols of the table, so we can walk it
+    ** instead of the old hash chains.
+    */
+    for (Sym = S->SymHead; Sym; Sym = Sym->NextSym) {
+        unsigned Hash = Sym->Hash % NewSize;
+        Sym->NextHash = S->Tab[Hash];
+        S->Tab[Hash]  = Sym;
+    }
+}
+
+
+
 /*****************************************************************************/
 /*                         Check symbols in a table                          */
 /*****************************************************************************/
@@ -409,8 +447,10 @@ static SymEntry* FindSymInTable (const SymTable* T, const char* Name, unsigned H
     /* Get the start of the hash chain */
     SymEntry* E = T->Tab [Hash % T->Size];
     while (E) {
-        /* Compare the name */
-        if (strcmp (E->Name, Name) == 0) {
+        /* Compare the name. Check the full hash first, so we will call
+        ** strcmp only for symbols that are most probably a match.
+        */
+        if (E->Hash == Hash && strcmp (E->Name, Name) == 0) {
             /* Found */
             return E;
         }
@@ -521,8 +561,12 @@ SymEntry* FindStructField (const Type* T, const char* Name)
 static void AddSymEntry (SymTable* T, SymEntry* S)
 /* Add a symbol to a symbol table */
 {
-    /* Get the hash value for the name */
-    unsigned Hash = HashStr (S->Name) % T->Size;
+    unsigned Hash;
+
+    /* Resize the hash table if the chains get too long */
+    if (T->SymCount >= T->Size * SYMTAB_MAX_LOAD) {
+        GrowSymTable (T);
+    }
 
     /* Insert the symbol into the list of all symbols in this level */
     if (T->SymTail) {
@@ -537,6 +581,7 @@ static void AddSymEntry (SymTable* T, SymEntry* S)
     ++T->SymCount;
 
     /* Insert the symbol into the hash chain */
+    Hash = S->Hash % T->Size;
     S->NextHash  = T->Tab[Hash];
     T->Tab[Hash] = S;
 
@@ -847,8 +892,9 @@ SymEntry* AddGlobalSym (const char* Name, const Type* T, unsigned Flags)
         ** additional fields.
         */
         if (IsFunc) {
-            Entry->V.F.Func = GetFuncDesc (Entry->Type);
-            Entry->V.F.Seg  = 0;
+            Entry->V.F.Func  = GetFuncDesc (Entry->Type);
+            Entry->V.F.Seg   = 0;
+            Entry->V.F.Frame = 0;
         }
 
         /* Add the assembler name of the symbol */
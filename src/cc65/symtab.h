@@ -58,8 +58,8 @@ struct SymTable {
     SymEntry*           SymHead;        /* Double linked list of symbols */
     SymEntry*           SymTail;        /* Double linked list of symbols */
     unsigned            SymCount;       /* Count of symbols in this table */
-    unsigned            Size;           /* Size of table */
-    SymEntry*           Tab[1];         /* Actual table, dynamically allocated */
+    unsigned            Size;           /* Size of hash table */
+    SymEntry**          Tab;            /* Hash table, grows with SymCount */
 };
 
 /* An empty symbol table */
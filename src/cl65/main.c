@@ -770,8 +770,11 @@ static void Usage (void)
             "  --debug-info\t\t\tAdd debug info\n"
             "  --feature name\t\tSet an emulation feature\n"
             "  --force-import sym\t\tForce an import of symbol `sym'\n"
+            "  --function-sections\t\tPut functions and data into own sections\n"
+            "  --gc-sections\t\t\tRemove unused sections when linking\n"
             "  --help\t\t\tHelp (this text)\n"
             "  --include-dir dir\t\tSet a compiler include directory path\n"
+            "  --inline-funcs\t\tInline small static functions\n"
             "  --ld-args options\t\tPass options to the linker\n"
             "  --lib file\t\t\tLink this library\n"
             "  --lib-path path\t\tSpecify a library search path\n"
@@ -792,6 +795,7 @@ static void Usage (void)
             "  --signed-chars\t\tDefault characters are signed\n"
             "  --standard std\t\tLanguage standard (c89, c99, cc65)\n"
             "  --start-addr addr\t\tSet the default start address\n"
+            "  --static-frames\t\tMake local variables static and overlay them\n"
             "  --static-locals\t\tMake local variables static\n"
             "  --target sys\t\t\tSet the target system\n"
             "  --version\t\t\tPrint the version number\n"
@@ -1019,6 +1023,24 @@ static void OptForceImport (const char* Opt attribute ((unused)), const char* Ar
 
 
 
+static void OptFunctionSections (const char* Opt attribute ((unused)),
+                                 const char* Arg attribute ((unused)))
+/* Put each function and data object into its own section */
+{
+    CmdAddArg (&CC65, "--function-sections");
+}
+
+
+
+static void OptGCSections (const char* Opt attribute ((unused)),
+                           const char* Arg attribute ((unused)))
+/* Remove unused sections when linking */
+{
+    CmdAddArg (&LD65, "--gc-sections");
+}
+
+
+
 static void OptHelp (const char* Opt attribute ((unused)),
                      const char* Arg attribute ((unused)))
 /* Print help - cl65 */
@@ -1037,6 +1059,15 @@ static void OptIncludeDir (const char* Opt attribute ((unused)), const char* Arg
 
 
 
+static void OptInlineFuncs (const char* Opt attribute ((unused)),
+                            const char* Arg attribute ((unused)))
+/* Inline small static functions (compiler) */
+{
+    CmdAddArg (&CC65, "--inline-funcs");
+}
+
+
+
 static void OptLdArgs (const char* Opt attribute ((unused)), const char* Arg)
 /* Pass arguments to the linker */
 {
@@ -1228,6 +1259,15 @@ static void OptStartAddr (const char* Opt attribute ((unused)), const char* Arg)
 
 
 
+static void OptStaticFrames (const char* Opt attribute ((unused)),
+                             const char* Arg attribute ((unused)))
+/* Place local variables in overlaid static frames */
+{
+    CmdAddArg (&CC65, "--static-frames");
+}
+
+
+
 static void OptStaticLocals (const char* Opt attribute ((unused)),
                              const char* Arg attribute ((unused)))
 /* Place local variables in static storage */
@@ -1317,8 +1357,11 @@ int main (int argc, char* argv [])
         { "--debug-info",        0, OptDebugInfo      },
         { "--feature",           1, OptFeature        },
         { "--force-import",      1, OptForceImport    },
+        { "--function-sections", 0, OptFunctionSections },
+        { "--gc-sections",       0, OptGCSections     },
         { "--help",              0, OptHelp           },
         { "--include-dir",       1, OptIncludeDir     },
+        { "--inline-funcs",      0, OptInlineFuncs    },
         { "--ld-args",           1, OptLdArgs         },
         { "--lib",               1, OptLib            },
         { "--lib-path",          1, OptLibPath        },
@@ -1339,6 +1382,7 @@ int main (int argc, char* argv [])
         { "--signed-chars",      0, OptSignedChars    },
         { "--standard",          1, OptStandard       },
         { "--start-addr",        1, OptStartAddr      },
+        { "--static-frames",     0, OptStaticFrames   },
         { "--static-locals",     0, OptStaticLocals   },
         { "--target",            1, OptTarget         },
         { "--verbose",           0, OptVerbose        },
@@ -0,0 +1,223 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 dbgdefs.h                                 */
+/*                                                                           */
+/*                   Definitions for the binary debug info file              */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef DBGDEFS_H
+#define DBGDEFS_H
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* The binary debug info file contains the same information as the text
+** version, but in tables with fixed size records, so it can be loaded
+** without parsing. All values are 32 bit little endian words. The file
+** consists of
+**
+**   - the header: magic, major and minor version, the number of items of
+**     each kind in the order of the DBG_KIND_xxx constants, the number of
+**     words in the list pool and the size of the string pool in bytes,
+**   - the item tables in the order of the DBG_KIND_xxx constants. The id of
+**     an item is its index in the table,
+**   - the indexes in the order of the DBG_INDEX_xxx constants. Each one
+**     contains the ids of all items of a kind in sort order,
+**   - the list pool. Lists of ids are stored as the index of the first id
+**     in the pool and the number of ids,
+**   - the string pool. Strings are stored as offsets into the pool and are
+**     terminated by a zero byte. The pool is padded with zero bytes to a
+**     multiple of four.
+*/
+#define DBG_MAGIC               0x47424443UL    /* "CDBG" */
+#define DBG_VER_MAJOR           2U
+#define DBG_VER_MINOR           0U
+
+/* Value used for missing ids */
+#define DBG_INV_ID              0xFFFFFFFFUL
+
+/* Item kinds */
+enum {
+    DBG_KIND_CSYM,
+    DBG_KIND_FILE,
+    DBG_KIND_LIB,
+    DBG_KIND_LINE,
+    DBG_KIND_MOD,
+    DBG_KIND_SCOPE,
+    DBG_KIND_SEG,
+    DBG_KIND_SPAN,
+    DBG_KIND_SYM,
+    DBG_KIND_TYPE,
+    DBG_KIND_COUNT
+};
+
+/* Size of the header in words */
+#define DBG_HDR_SIZE            (3 + DBG_KIND_COUNT + 2)
+
+/* C symbols */
+enum {
+    DBG_CSYM_NAME,                      /* Name */
+    DBG_CSYM_SCOPE,                     /* Scope id */
+    DBG_CSYM_TYPE,                      /* Type id */
+    DBG_CSYM_SC,                        /* Storage class, DBG_SC_xxx */
+    DBG_CSYM_OFFS,                      /* Offset, signed */
+    DBG_CSYM_SYM,                       /* Id of asm symbol or DBG_INV_ID */
+    DBG_CSYM_RECSIZE
+};
+
+/* Source files */
+enum {
+    DBG_FILE_NAME,                      /* Name */
+    DBG_FILE_SIZE,                      /* Size of file */
+    DBG_FILE_MTIME,                     /* Modification time */
+    DBG_FILE_MODS,                      /* List of module ids */
+    DBG_FILE_MODCOUNT,
+    DBG_FILE_RECSIZE
+};
+
+/* Libraries */
+enum {
+    DBG_LIB_NAME,                       /* Name */
+    DBG_LIB_RECSIZE
+};
+
+/* Line infos */
+enum {
+    DBG_LINE_FILE,                      /* File id */
+    DBG_LINE_LINE,                      /* Line number */
+    DBG_LINE_TYPE,                      /* Line type */
+    DBG_LINE_COUNT,                     /* Macro nesting count */
+    DBG_LINE_SPANS,                     /* List of span ids */
+    DBG_LINE_SPANCOUNT,
+    DBG_LINE_RECSIZE
+};
+
+/* Modules */
+enum {
+    DBG_MOD_NAME,                       /* Name */
+    DBG_MOD_FILE,                       /* Id of main source file */
+    DBG_MOD_LIB,                        /* Library id or DBG_INV_ID */
+    DBG_MOD_RECSIZE
+};
+
+/* Scopes */
+enum {
+    DBG_SCOPE_NAME,                     /* Name */
+    DBG_SCOPE_MOD,                      /* Module id */
+    DBG_SCOPE_TYPE,                     /* Scope type, SCOPE_xxx */
+    DBG_SCOPE_SIZE,                     /* Size of scope */
+    DBG_SCOPE_PARENT,                   /* Parent scope or DBG_INV_ID */
+    DBG_SCOPE_SYM,                      /* Label symbol or DBG_INV_ID */
+    DBG_SCOPE_SPANS,                    /* List of span ids */
+    DBG_SCOPE_SPANCOUNT,
+    DBG_SCOPE_RECSIZE
+};
+
+/* Segments */
+enum {
+    DBG_SEG_NAME,                       /* Name */
+    DBG_SEG_START,                      /* Start address */
+    DBG_SEG_SIZE,                       /* Size */
+    DBG_SEG_ONAME,                      /* Output file name or DBG_INV_ID */
+    DBG_SEG_OOFFS,                      /* Offset in output file */
+    DBG_SEG_RECSIZE
+};
+
+/* Spans */
+enum {
+    DBG_SPAN_SEG,                       /* Segment id */
+    DBG_SPAN_START,                     /* Start relative to segment */
+    DBG_SPAN_SIZE,                      /* Size */
+    DBG_SPAN_TYPE,                      /* Type id or DBG_INV_ID */
+    DBG_SPAN_RECSIZE
+};
+
+/* Assembler symbols */
+enum {
+    DBG_SYM_NAME,                       /* Name */
+    DBG_SYM_TYPE,                       /* Symbol type, DBG_SYM_xxx */
+    DBG_SYM_VALUE,                      /* Value, signed */
+    DBG_SYM_SIZE,                       /* Size or zero if unknown */
+    DBG_SYM_EXP,                        /* Export for imports or DBG_INV_ID */
+    DBG_SYM_SEG,                        /* Segment id or DBG_INV_ID */
+    DBG_SYM_SCOPE,                      /* Scope id or DBG_INV_ID */
+    DBG_SYM_PARENT,                     /* Parent for cheap locals or DBG_INV_ID */
+    DBG_SYM_DEFS,                       /* Line ids of the definition */
+    DBG_SYM_DEFCOUNT,
+    DBG_SYM_REFS,                       /* Line ids of references */
+    DBG_SYM_REFCOUNT,
+    DBG_SYM_RECSIZE
+};
+
+/* Types */
+enum {
+    DBG_TYPE_VAL,                       /* Type string as in the text file */
+    DBG_TYPE_RECSIZE
+};
+
+/* Storage classes of C symbols */
+enum {
+    DBG_SC_AUTO,
+    DBG_SC_REG,
+    DBG_SC_STATIC,
+    DBG_SC_EXTERN
+};
+
+/* Types of assembler symbols */
+enum {
+    DBG_SYM_EQUATE,
+    DBG_SYM_LABEL,
+    DBG_SYM_IMPORT
+};
+
+/* Indexes. Names are compared with strcmp, files with equal names are sorted
+** by modification time and size, symbols with equal values by name, and spans
+** with equal start addresses by end address. All remaining ties are sorted by
+** id. This is the order the debug info library uses for text files.
+*/
+enum {
+    DBG_INDEX_FILE_BYNAME,
+    DBG_INDEX_MOD_BYNAME,
+    DBG_INDEX_SCOPE_BYNAME,
+    DBG_INDEX_SEG_BYNAME,
+    DBG_INDEX_SPAN_BYADDR,
+    DBG_INDEX_SYM_BYNAME,
+    DBG_INDEX_SYM_BYVAL,
+    DBG_INDEX_COUNT
+};
+
+
+
+/* End of dbgdefs.h */
+
+#endif
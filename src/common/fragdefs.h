@@ -65,6 +65,19 @@
 
 #define FRAG_FILL       0x20            /* Fill bytes */
 
+#define FRAG_RELAX      0x18            /* Instruction the linker may shorten */
+
+/* A FRAG_RELAX fragment contains an instruction with a two byte address in
+** its long form. The byte count is the size of the long form. It is followed
+** by the kind of relaxation, the opcode of the short form, the opcode bytes
+** of the long form and the address expression. The short form is always two
+** bytes: The short opcode followed by a zero page address or a branch
+** distance.
+*/
+#define RELAX_ZP        0x00            /* Absolute address, may be zero page */
+#define RELAX_ZP_IND    0x01            /* Same, but indexed */
+#define RELAX_BRANCH    0x02            /* Jump, may be a branch */
+
 
 
 /* End of fragdefs.h */
@@ -44,9 +44,12 @@
 
 
 
-/* Defines for magic and version */
+/* Defines for magic and version. Libraries with the previous version have
+** no export index but can still be read.
+*/
 #define LIB_MAGIC       0x7A55616E
-#define LIB_VERSION     0x000D
+#define LIB_VERSION     0x000E
+#define LIB_VERSION_OLD 0x000D
 
 /* Size of an library file header */
 #define LIB_HDR_SIZE    12
@@ -64,6 +67,19 @@ struct LibHeader {
 
 
 
+/* The index at IndexOffs contains the number of modules followed by one
+** entry for each module (name, flags, mtime, start and size). It is followed
+** by the export index, a hash table of all exported names: The number of
+** buckets, then for each bucket the number of entries and the entries
+** themselves, each one consisting of the name and the index of the module
+** exporting it. The bucket of a name is HashStr (Name) % BucketCount.
+**
+** Modules aren't necessarily contiguous. Updates may append new module
+** data and a new index to the file and leave the old data unused.
+*/
+
+
+
 /* End of libdefs.h */
 
 #endif
@@ -46,6 +46,7 @@
 
 /* Segment flags */
 #define SEG_FLAG_NONE           0x00
+#define SEG_FLAG_GC             0x01    /* Linker may remove it if unused */
 
 
 
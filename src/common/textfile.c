@@ -0,0 +1,171 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 textfile.c                                */
+/*                                                                           */
+/*                   Text files read into memory as a whole                  */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <string.h>
+#include <errno.h>
+
+/* common */
+#include "textfile.h"
+#include "xmalloc.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Initial size of the file buffer */
+#define TF_BLOCKSIZE    0x4000U
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+TextFile* NewTextFile (FILE* F)
+/* Read the remainder of the already opened file F into memory and return a
+** TextFile for it. F is not closed. Returns NULL and sets errno if there was
+** a read error.
+*/
+{
+    unsigned Allocated = TF_BLOCKSIZE;
+
+    /* Allocate the structure */
+    TextFile* T = xmalloc (sizeof (TextFile));
+    T->Buf  = xmalloc (Allocated);
+    T->Size = 0;
+    T->Pos  = 0;
+
+    /* Read the file doubling the buffer size until we get less than we asked
+    ** for. We don't try to determine the size in advance, so this works for
+    ** all kinds of streams.
+    */
+    while (1) {
+        T->Size += fread (T->Buf + T->Size, 1, Allocated - T->Size, F);
+        if (T->Size < Allocated) {
+            break;
+        }
+        Allocated *= 2;
+        T->Buf = xrealloc (T->Buf, Allocated);
+    }
+
+    /* Check for errors */
+    if (ferror (F)) {
+        int Error = errno;
+        FreeTextFile (T);
+        errno = Error;
+        return 0;
+    }
+
+    /* Return the new text file */
+    return T;
+}
+
+
+
+TextFile* ReadTextFile (const char* Name)
+/* Read the file with the given name into memory and return a TextFile for
+** it. Returns NULL and sets errno if the file cannot be opened or read.
+*/
+{
+    TextFile* T;
+    int       Error;
+
+    /* Open the file. We use binary mode, so the size of what we're reading
+    ** is the size of the file. Carriage returns are handled when reading.
+    */
+    FILE* F = fopen (Name, "rb");
+    if (F == 0) {
+        return 0;
+    }
+
+    /* Read it and close it */
+    T = NewTextFile (F);
+    Error = errno;
+    (void) fclose (F);
+    errno = Error;
+
+    /* Return the result */
+    return T;
+}
+
+
+
+void FreeTextFile (TextFile* F)
+/* Free a TextFile including the file contents */
+{
+    xfree (F->Buf);
+    xfree (F);
+}
+
+
+
+int TF_GetLine (TextFile* F, StrBuf* Line)
+/* Append the next line from F to Line. The line terminator is not stored,
+** a carriage return in front of it is removed. The function returns false
+** if the end of file is reached and there was no more data, true otherwise.
+** Line is not terminated.
+*/
+{
+    const char* Start;
+    const char* End;
+    unsigned    Len;
+
+    /* Check for end of file */
+    if (F->Pos >= F->Size) {
+        return 0;
+    }
+
+    /* Search for the end of the line */
+    Start = F->Buf + F->Pos;
+    End   = memchr (Start, '\n', F->Size - F->Pos);
+    if (End) {
+        Len = End - Start;
+        F->Pos += Len + 1;
+        if (Len > 0 && Start[Len-1] == '\r') {
+            --Len;
+        }
+    } else {
+        /* Last line without a line terminator */
+        Len = F->Size - F->Pos;
+        F->Pos = F->Size;
+    }
+
+    /* Append the line */
+    SB_AppendBuf (Line, Start, Len);
+    return 1;
+}
@@ -0,0 +1,111 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                 textfile.h                                */
+/*                                                                           */
+/*                   Text files read into memory as a whole                  */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+/* Reading a text file into memory in one go and handing out lines or single
+** characters from there is a lot faster than reading it character by
+** character with the stdio functions.
+*/
+
+
+
+#ifndef TEXTFILE_H
+#define TEXTFILE_H
+
+
+
+#include <stdio.h>
+
+/* common */
+#include "inline.h"
+#include "strbuf.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+typedef struct TextFile TextFile;
+struct TextFile {
+    char*       Buf;                    /* File contents */
+    unsigned    Size;                   /* Size of the file contents */
+    unsigned    Pos;                    /* Read position */
+};
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+TextFile* NewTextFile (FILE* F);
+/* Read the remainder of the already opened file F into memory and return a
+** TextFile for it. F is not closed. Returns NULL and sets errno if there was
+** a read error.
+*/
+
+TextFile* ReadTextFile (const char* Name);
+/* Read the file with the given name into memory and return a TextFile for
+** it. Returns NULL and sets errno if the file cannot be opened or read.
+*/
+
+void FreeTextFile (TextFile* F);
+/* Free a TextFile including the file contents */
+
+int TF_GetLine (TextFile* F, StrBuf* Line);
+/* Append the next line from F to Line. The line terminator is not stored,
+** a carriage return in front of it is removed. The function returns false
+** if the end of file is reached and there was no more data, true otherwise.
+** Line is not terminated.
+*/
+
+#if defined(HAVE_INLINE)
+INLINE int TF_GetChar (TextFile* F)
+/* Return the next character from F or EOF */
+{
+    return (F->Pos < F->Size)? (unsigned char) F->Buf[F->Pos++] : EOF;
+}
+#else
+#  define TF_GetChar(F)                                         \
+        (((F)->Pos < (F)->Size)?                                \
+            (unsigned char) (F)->Buf[(F)->Pos++] : EOF)
+#endif
+
+
+
+/* End of textfile.h */
+
+#endif
@@ -33,6 +33,8 @@
 
 
 
+#include <string.h>
+
 /* da65 */
 #include "error.h"
 #include "attrtab.h"
@@ -56,6 +58,14 @@ static unsigned short AttrTab[0x10000];
 
 
 
+void ResetAttrTab (void)
+/* Clear all attributes */
+{
+    memset (AttrTab, 0, sizeof (AttrTab));
+}
+
+
+
 void AddrCheck (unsigned Addr)
 /* Check if the given address has a valid range */
 {
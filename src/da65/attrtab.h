@@ -85,6 +85,9 @@ typedef enum attr_t {
 
 
 
+void ResetAttrTab (void);
+/* Clear all attributes */
+
 void AddrCheck (unsigned Addr);
 /* Check if the given address has a valid range */
 
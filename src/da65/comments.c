@@ -85,3 +85,17 @@ const char* GetComment (unsigned Addr)
     /* Return the label if any */
     return CommentTab[Addr];
 }
+
+
+
+void ResetComments (void)
+/* Remove all comments */
+{
+    unsigned Addr;
+    for (Addr = 0; Addr < 0x10000; ++Addr) {
+        if (CommentTab[Addr]) {
+            xfree ((char*) CommentTab[Addr]);
+            CommentTab[Addr] = 0;
+        }
+    }
+}
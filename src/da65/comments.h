@@ -54,6 +54,9 @@ void SetComment (unsigned Addr, const char* Comment);
 const char* GetComment (unsigned Addr);
 /* Return the comment for an address */
 
+void ResetComments (void);
+/* Remove all comments */
+
 
 
 /* End of comments.h */
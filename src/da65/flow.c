@@ -0,0 +1,351 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                   flow.c                                  */
+/*                                                                           */
+/*                       Control flow analysis for da65                      */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <string.h>
+
+/* common */
+#include "print.h"
+
+/* da65 */
+#include "attrtab.h"
+#include "code.h"
+#include "flow.h"
+#include "handler.h"
+#include "opctable.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Flow information for each address */
+enum {
+    fiInsn      = 0x01,         /* First byte of a reached instruction */
+    fiOperand   = 0x02,         /* Operand byte of a reached instruction */
+    fiVector    = 0x04,         /* Jump vector used by a reached instruction */
+    fiQueued    = 0x08,         /* Address was added to the work list */
+    fiUnused    = 0x10,         /* Not reached, marked as data */
+};
+static unsigned char FlowInfo[0x10000];
+
+/* Work list of addresses where execution may start. Since an address is
+** added only once, the list cannot overflow.
+*/
+static unsigned Pending[0x10000];
+static unsigned PendingCount = 0;
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+static int InImage (unsigned Addr)
+/* Return true if the given address is part of the loaded code */
+{
+    return Addr >= CodeStart && Addr <= CodeEnd;
+}
+
+
+
+static int IsFree (unsigned Addr)
+/* Return true if the byte at the given address may become part of an
+** instruction.
+*/
+{
+    attr_t Style;
+
+    if (!InImage (Addr) || (FlowInfo[Addr] & (fiInsn | fiOperand | fiVector))) {
+        return 0;
+    }
+    Style = GetStyleAttr (Addr);
+    return Style == atDefault || Style == atCode;
+}
+
+
+
+static int IsMnemo (const OpcDesc* D, const char* Mnemo)
+/* Return true if D has the given mnemonic */
+{
+    return strcmp (D->Mnemo, Mnemo) == 0;
+}
+
+
+
+static void AddEntry (unsigned Addr)
+/* Add an address where execution may start to the work list */
+{
+    Addr &= 0xFFFF;
+    if (InImage (Addr) && (FlowInfo[Addr] & fiQueued) == 0) {
+        FlowInfo[Addr] |= fiQueued;
+        Pending[PendingCount++] = Addr;
+    }
+}
+
+
+
+static void AddVector (unsigned Addr)
+/* Remember a jump vector within the code, and add its target */
+{
+    if (IsFree (Addr) && GetStyleAttr (Addr) == atDefault &&
+        IsFree (Addr + 1) && GetStyleAttr (Addr + 1) == atDefault) {
+        FlowInfo[Addr]     |= fiVector;
+        FlowInfo[Addr + 1] |= fiVector;
+        AddEntry (GetCodeWord (Addr));
+    }
+}
+
+
+
+static void FollowFlow (unsigned Addr)
+/* Follow the control flow from the given address until it ends or runs into
+** something that cannot be code.
+*/
+{
+    while (IsFree (Addr)) {
+
+        const OpcDesc* D = &OpcTable[GetCodeByte (Addr)];
+        OpcHandler     H = D->Handler;
+        unsigned       I;
+
+        /* The insn must be valid, and it must neither overlap other insns
+        ** or data nor cross a segment boundary.
+        */
+        if (D->Flags & flIllegal) {
+            return;
+        }
+        for (I = 1; I < D->Size; ++I) {
+            if (!IsFree (Addr + I) || IsSegmentStart (Addr + I) ||
+                IsSegmentEnd (Addr + I - 1)) {
+                return;
+            }
+        }
+
+        /* Remember the insn */
+        FlowInfo[Addr] |= fiInsn;
+        for (I = 1; I < D->Size; ++I) {
+            FlowInfo[Addr + I] |= fiOperand;
+        }
+
+        /* Check where execution continues. The target addresses are
+        ** calculated the same way as in the output handlers, so the labels
+        ** match.
+        */
+        if (H == OH_Rts) {
+            return;
+        } else if (H == OH_JmpAbsolute) {
+            AddEntry (GetCodeWord (Addr + 1));
+            return;
+        } else if (H == OH_Relative) {
+            AddEntry (Addr + 2 + (signed char) GetCodeByte (Addr + 1));
+            if (IsMnemo (D, "bra")) {
+                return;
+            }
+        } else if (H == OH_RelativeLong) {
+            AddEntry (Addr + 3 + (signed short) GetCodeWord (Addr + 1));
+            if (IsMnemo (D, "brl")) {
+                return;
+            }
+        } else if (H == OH_RelativeLong4510) {
+            AddEntry (Addr + 2 + (signed short) GetCodeWord (Addr + 1));
+            if (IsMnemo (D, "lbra")) {
+                return;
+            }
+        } else if (H == OH_BitBranch) {
+            AddEntry (Addr + 3 + (signed char) GetCodeByte (Addr + 2));
+        } else if (H == OH_AccumulatorBitBranch) {
+            AddEntry (Addr + 3 + (signed char) GetCodeByte (Addr + 1));
+        } else if (H == OH_SpecialPage) {
+            AddEntry (0xFF00 + GetCodeByte (Addr + 1));
+        } else if (H == OH_Absolute) {
+            if (IsMnemo (D, "jsr")) {
+                AddEntry (GetCodeWord (Addr + 1));
+            }
+        } else if (H == OH_AbsoluteLong) {
+            if (IsMnemo (D, "jsl") || IsMnemo (D, "jml")) {
+                AddEntry (GetCodeWord (Addr + 1));
+            }
+            if (IsMnemo (D, "jml")) {
+                return;
+            }
+        } else if (H == OH_JmpAbsoluteIndirect) {
+            /* A vector within the code is followed. Indexed jumps use
+            ** tables of unknown size, so they end the flow.
+            */
+            AddVector (GetCodeWord (Addr + 1));
+            if (!IsMnemo (D, "jsr")) {
+                return;
+            }
+        } else if (H == OH_JmpAbsoluteXIndirect || H == OH_JmpDirectIndirect) {
+            if (!IsMnemo (D, "jsr")) {
+                return;
+            }
+        } else if (H == OH_AbsoluteIndirect) {
+            if (IsMnemo (D, "jml")) {
+                return;
+            }
+        } else if (H == OH_Implicit) {
+            /* brk is usually followed by data, or is data itself */
+            if (IsMnemo (D, "brk") || IsMnemo (D, "stp") || IsMnemo (D, "rtl")) {
+                return;
+            }
+        }
+
+        /* Continue with the next insn */
+        Addr += D->Size;
+    }
+}
+
+
+
+static void AddEntries (void)
+/* Add the entry points to the work list: The start of code ranges and the
+** targets of address tables from the info file, and the hardware vectors if
+** they are part of the code.
+*/
+{
+    unsigned Addr;
+    unsigned TabStart = 0;
+
+    for (Addr = CodeStart; Addr <= CodeEnd; ++Addr) {
+        attr_t Style = GetStyleAttr (Addr);
+        attr_t Prev  = (Addr > CodeStart)? GetStyleAttr (Addr - 1) : atDefault;
+        if (Style != Prev) {
+            TabStart = Addr;
+        }
+        switch (Style) {
+
+            case atCode:
+                if (Style != Prev) {
+                    AddEntry (Addr);
+                }
+                break;
+
+            case atAddrTab:
+            case atRtsTab:
+                if (((Addr - TabStart) & 0x01) == 0 && Addr < CodeEnd &&
+                    GetStyleAttr (Addr + 1) == Style) {
+                    AddEntry (GetCodeWord (Addr) + (Style == atRtsTab));
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    /* NMI, RESET and IRQ vectors */
+    if (CodeStart <= 0xFFFA && CodeEnd == 0xFFFF) {
+        for (Addr = 0xFFFA; Addr < 0x10000; Addr += 2) {
+            AddVector (Addr);
+        }
+    }
+
+    /* If we have nothing else, start at the beginning of the code */
+    if (PendingCount == 0) {
+        AddEntry (CodeStart);
+    }
+}
+
+
+
+static unsigned Percent (unsigned long Part, unsigned long Total)
+/* Return Part as a percentage of Total */
+{
+    return (unsigned) ((Part * 100 + Total / 2) / Total);
+}
+
+
+
+void AnalyzeFlow (void)
+/* Follow the control flow of the loaded code from all known entry points and
+** mark the instructions found as code and all bytes not reached as data.
+** Bytes that already have a style set by the info file are not changed.
+*/
+{
+    unsigned      Addr;
+    unsigned long Total  = CodeEnd - CodeStart + 1;
+    unsigned long Code   = 0;
+    unsigned long Data   = 0;
+    unsigned long Unused = 0;
+
+    /* Follow the flow from all entry points */
+    memset (FlowInfo, 0, sizeof (FlowInfo));
+    AddEntries ();
+    while (PendingCount > 0) {
+        FollowFlow (Pending[--PendingCount]);
+    }
+
+    /* Set the styles */
+    for (Addr = CodeStart; Addr <= CodeEnd; ++Addr) {
+        attr_t Style = GetStyleAttr (Addr);
+        if (Style == atCode || (FlowInfo[Addr] & (fiInsn | fiOperand))) {
+            if (Style == atDefault && (FlowInfo[Addr] & fiInsn)) {
+                MarkAddr (Addr, atCode);
+            }
+            ++Code;
+        } else if (Style != atDefault) {
+            ++Data;
+        } else if (FlowInfo[Addr] & fiVector) {
+            MarkAddr (Addr, atAddrTab);
+            ++Data;
+        } else {
+            MarkAddr (Addr, atByteTab);
+            FlowInfo[Addr] |= fiUnused;
+            ++Unused;
+        }
+    }
+
+    /* Print the coverage */
+    Print (stderr, 1, "Flow analysis of %lu bytes:\n", Total);
+    Print (stderr, 1, "  Code:        %5lu bytes (%u%%)\n",
+           Code, Percent (Code, Total));
+    Print (stderr, 1, "  Data:        %5lu bytes (%u%%)\n",
+           Data, Percent (Data, Total));
+    Print (stderr, 1, "  Not reached: %5lu bytes (%u%%)\n",
+           Unused, Percent (Unused, Total));
+    Addr = CodeStart;
+    while (Addr <= CodeEnd) {
+        unsigned Start = Addr++;
+        if (FlowInfo[Start] & fiUnused) {
+            while (Addr <= CodeEnd && (FlowInfo[Addr] & fiUnused)) {
+                ++Addr;
+            }
+            Print (stderr, 2, "  Not reached: $%04X-$%04X\n", Start, Addr - 1);
+        }
+    }
+}
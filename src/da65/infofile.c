@@ -183,6 +183,7 @@ static void GlobalSection (void)
         {   "COMMENTCOLUMN",    INFOTOK_COMMENT_COLUMN  },
         {   "COMMENTS",         INFOTOK_COMMENTS        },
         {   "CPU",              INFOTOK_CPU             },
+        {   "FLOWANALYSIS",     INFOTOK_FLOWANALYSIS    },
         {   "HEXOFFS",          INFOTOK_HEXOFFS         },
         {   "INPUTNAME",        INFOTOK_INPUTNAME       },
         {   "INPUTOFFS",        INFOTOK_INPUTOFFS       },
@@ -249,6 +250,16 @@ static void GlobalSection (void)
                 InfoNextTok ();
                 break;
 
+            case INFOTOK_FLOWANALYSIS:
+                InfoNextTok ();
+                InfoBoolToken ();
+                switch (InfoTok) {
+                    case INFOTOK_FALSE: FlowAnalysis = 0; break;
+                    case INFOTOK_TRUE:  FlowAnalysis = 1; break;
+                }
+                InfoNextTok ();
+                break;
+
             case INFOTOK_HEXOFFS:
                 InfoNextTok ();
                 InfoBoolToken ();
@@ -410,3 +410,19 @@ void DefOutOfRangeLabels (void)
 
     SeparatorLine ();
 }
+
+
+
+void ResetLabels (void)
+/* Remove all labels. Since the label attributes are kept in the attribute
+** table, it must be reset, too.
+*/
+{
+    unsigned Addr;
+    for (Addr = 0; Addr < 0x10000; ++Addr) {
+        if (SymTab[Addr]) {
+            xfree ((char*) SymTab[Addr]);
+            SymTab[Addr] = 0;
+        }
+    }
+}
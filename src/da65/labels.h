@@ -97,6 +97,11 @@ void ForwardLabel (unsigned Offs);
 void DefOutOfRangeLabels (void);
 /* Output any labels that are out of the loaded code range */
 
+void ResetLabels (void);
+/* Remove all labels. Since the label attributes are kept in the attribute
+** table, it must be reset, too.
+*/
+
 
 
 /* End of labels.h */
@@ -37,6 +37,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <errno.h>
 #include <limits.h>
 #include <time.h>
 
@@ -47,6 +48,7 @@
 #include "fname.h"
 #include "print.h"
 #include "version.h"
+#include "xmalloc.h"
 
 /* da65 */
 #include "attrtab.h"
@@ -54,6 +56,7 @@
 #include "comments.h"
 #include "data.h"
 #include "error.h"
+#include "flow.h"
 #include "global.h"
 #include "infofile.h"
 #include "labels.h"
@@ -64,6 +67,43 @@
 
 
 
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Name of the batch file if we have one */
+static const char* BatchFile = 0;
+
+/* Options that may be changed by an info file. In batch mode, they're saved
+** after reading the command line and restored for each input file.
+*/
+typedef struct Options Options;
+struct Options {
+    const char*         InFile;
+    const char*         OutFile;
+    const char*         InfoFile;
+    cpu_t               CPU;
+    const OpcDesc*      OpcTable;
+    unsigned char       FlowAnalysis;
+    unsigned char       UseHexOffs;
+    signed char         NewlineAfterJMP;
+    signed char         NewlineAfterRTS;
+    long                StartAddr;
+    long                InputOffs;
+    long                InputSize;
+    unsigned            Comments;
+    unsigned            PageLength;
+    unsigned            LBreak;
+    unsigned            MCol;
+    unsigned            ACol;
+    unsigned            CCol;
+    unsigned            TCol;
+};
+
+
+
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
@@ -86,10 +126,12 @@ static void Usage (void)
             "\n"
             "Long options:\n"
             "  --argument-column n\tSpecify argument start column\n"
+            "  --batch name\t\tDisassemble the files listed in a batch file\n"
             "  --comment-column n\tSpecify comment start column\n"
             "  --comments n\t\tSet the comment level for the output\n"
             "  --cpu type\t\tSet cpu type\n"
             "  --debug-info\t\tAdd debug info to object file\n"
+            "  --flow-analysis\tFollow the control flow to find code\n"
             "  --formfeeds\t\tAdd formfeeds to the output\n"
             "  --help\t\tHelp (this text)\n"
             "  --hexoffs\t\tUse hexadecimal label offsets\n"
@@ -192,6 +234,14 @@ static void OptCommentColumn (const char* Opt, const char* Arg)
 
 
 
+static void OptBatch (const char* Opt attribute ((unused)), const char* Arg)
+/* Handle the --batch option */
+{
+    BatchFile = Arg;
+}
+
+
+
 static void OptComments (const char* Opt, const char* Arg)
 /* Handle the --comments option */
 {
@@ -226,6 +276,15 @@ static void OptDebugInfo (const char* Opt attribute ((unused)),
 
 
 
+static void OptFlowAnalysis (const char* Opt attribute ((unused)),
+                             const char* Arg attribute ((unused)))
+/* Handle the --flow-analysis option */
+{
+    FlowAnalysis = 1;
+}
+
+
+
 static void OptFormFeeds (const char* Opt attribute ((unused)),
                           const char* Arg attribute ((unused)))
 /* Add form feeds to the output */
@@ -503,6 +562,11 @@ static void OnePass (void)
 static void Disassemble (void)
 /* Disassemble the code */
 {
+    /* Find code and data by following the control flow if requested */
+    if (FlowAnalysis) {
+        AnalyzeFlow ();
+    }
+
     /* Pass 1 */
     Pass = 1;
     OnePass ();
@@ -520,17 +584,204 @@ static void Disassemble (void)
 
 
 
+static void SaveOptions (Options* O)
+/* Save the options that may be changed by an info file */
+{
+    O->InFile           = InFile;
+    O->OutFile          = OutFile;
+    O->InfoFile         = InfoAvail ()? InfoGetName () : 0;
+    O->CPU              = CPU;
+    O->OpcTable         = OpcTable;
+    O->FlowAnalysis     = FlowAnalysis;
+    O->UseHexOffs       = UseHexOffs;
+    O->NewlineAfterJMP  = NewlineAfterJMP;
+    O->NewlineAfterRTS  = NewlineAfterRTS;
+    O->StartAddr        = StartAddr;
+    O->InputOffs        = InputOffs;
+    O->InputSize        = InputSize;
+    O->Comments         = Comments;
+    O->PageLength       = PageLength;
+    O->LBreak           = LBreak;
+    O->MCol             = MCol;
+    O->ACol             = ACol;
+    O->CCol             = CCol;
+    O->TCol             = TCol;
+}
+
+
+
+static void RestoreOptions (const Options* O)
+/* Restore the options saved by SaveOptions */
+{
+    InFile              = O->InFile;
+    OutFile             = O->OutFile;
+    InfoSetName (O->InfoFile);
+    CPU                 = O->CPU;
+    OpcTable            = O->OpcTable;
+    FlowAnalysis        = O->FlowAnalysis;
+    UseHexOffs          = O->UseHexOffs;
+    NewlineAfterJMP     = O->NewlineAfterJMP;
+    NewlineAfterRTS     = O->NewlineAfterRTS;
+    StartAddr           = O->StartAddr;
+    InputOffs           = O->InputOffs;
+    InputSize           = O->InputSize;
+    Comments            = O->Comments;
+    PageLength          = O->PageLength;
+    LBreak              = O->LBreak;
+    MCol                = O->MCol;
+    ACol                = O->ACol;
+    CCol                = O->CCol;
+    TCol                = O->TCol;
+}
+
+
+
+static void DisassembleFile (void)
+/* Check the options, then load and disassemble the input file */
+{
+    /* Must have an input file */
+    if (InFile == 0) {
+        AbEnd ("No input file");
+    }
+
+    /* Check the formatting options for reasonable values. Note: We will not
+    ** really check that they make sense, just that they aren't complete
+    ** garbage.
+    */
+    if (MCol >= ACol) {
+        AbEnd ("mnemonic-column value must be smaller than argument-column value");
+    }
+    if (ACol >= CCol) {
+        AbEnd ("argument-column value must be smaller than comment-column value");
+    }
+    if (CCol >= TCol) {
+        AbEnd ("comment-column value must be smaller than text-column value");
+    }
+
+    /* If no CPU given, use the default CPU */
+    if (CPU == CPU_UNKNOWN) {
+        CPU = CPU_6502;
+    }
+
+    /* Load the input file */
+    LoadCode ();
+
+    /* Open the output file */
+    OpenOutput (OutFile);
+
+    /* Disassemble the code */
+    Disassemble ();
+
+    /* Close the output file */
+    CloseOutput ();
+}
+
+
+
+static void Batch (const char* Name)
+/* Disassemble all files listed in a batch file. Each line contains the name
+** of an input file, optionally followed by the names of an info file and an
+** output file. A dash may be used instead of a name to use the one from the
+** info file or the command line. Without an output file, the name of the
+** input file with the extension ".dis" is used. Text after a '#' is ignored.
+*/
+{
+    static const char Sep[] = " \t\r\n";
+
+    Options  Saved;
+    char     Line[1024];
+    unsigned LineNum = 0;
+    FILE*    F;
+
+    /* Open the batch file */
+    F = fopen (Name, "r");
+    if (F == 0) {
+        AbEnd ("Cannot open `%s': %s", Name, strerror (errno));
+    }
+
+    /* Remember the options from the command line */
+    SaveOptions (&Saved);
+
+    while (fgets (Line, sizeof (Line), F) != 0) {
+
+        char*    Names[3];
+        char*    P;
+        char*    Out = 0;
+        unsigned Count = 0;
+
+        /* Split the line into names */
+        ++LineNum;
+        if (strchr (Line, '\n') == 0 && !feof (F)) {
+            AbEnd ("%s:%u: Line too long", Name, LineNum);
+        }
+        P = strtok (Line, Sep);
+        while (P != 0 && *P != '#') {
+            if (Count >= sizeof (Names) / sizeof (Names[0])) {
+                AbEnd ("%s:%u: Too many file names", Name, LineNum);
+            }
+            Names[Count++] = P;
+            P = strtok (0, Sep);
+        }
+        if (Count == 0) {
+            continue;
+        }
+
+        /* Start over with the options from the command line and empty
+        ** tables.
+        */
+        RestoreOptions (&Saved);
+        ResetLabels ();
+        ResetComments ();
+        ResetSegments ();
+        ResetAttrTab ();
+
+        /* Use the names from the batch file */
+        if (strcmp (Names[0], "-") != 0) {
+            InFile = Names[0];
+        }
+        if (Count > 1 && strcmp (Names[1], "-") != 0) {
+            InfoSetName (Names[1]);
+        }
+        if (Count > 2 && strcmp (Names[2], "-") != 0) {
+            OutFile = Names[2];
+        }
+
+        /* Read the info file, and make up an output name if we don't have
+        ** one.
+        */
+        ReadInfoFile ();
+        if (InFile == 0) {
+            AbEnd ("%s:%u: No input file", Name, LineNum);
+        }
+        if (OutFile == 0) {
+            OutFile = Out = MakeFilename (InFile, OutExt);
+        }
+
+        /* Disassemble */
+        Print (stderr, 1, "Disassembling `%s' to `%s'\n", InFile, OutFile);
+        DisassembleFile ();
+        xfree (Out);
+    }
+
+    /* Close the batch file */
+    (void) fclose (F);
+}
+
+
+
 int main (int argc, char* argv [])
 /* Assembler main program */
 {
     /* Program long options */
     static const LongOpt OptTab[] = {
         { "--argument-column",  1,      OptArgumentColumn       },
+        { "--batch",            1,      OptBatch                },
         { "--bytes-per-line",   1,      OptBytesPerLine         },
         { "--comment-column",   1,      OptCommentColumn        },
         { "--comments",         1,      OptComments             },
         { "--cpu",              1,      OptCPU                  },
         { "--debug-info",       0,      OptDebugInfo            },
+        { "--flow-analysis",    0,      OptFlowAnalysis         },
         { "--formfeeds",        0,      OptFormFeeds            },
         { "--help",             0,      OptHelp                 },
         { "--hexoffs",          0,      OptHexOffs              },
@@ -613,50 +864,22 @@ int main (int argc, char* argv [])
         ++I;
     }
 
-    /* Try to read the info file */
-    ReadInfoFile ();
-
-    /* Must have an input file */
-    if (InFile == 0) {
-        AbEnd ("No input file");
-    }
-
-    /* Check the formatting options for reasonable values. Note: We will not
-    ** really check that they make sense, just that they aren't complete
-    ** garbage.
-    */
-    if (MCol >= ACol) {
-        AbEnd ("mnemonic-column value must be smaller than argument-column value");
-    }
-    if (ACol >= CCol) {
-        AbEnd ("argument-column value must be smaller than comment-column value");
-    }
-    if (CCol >= TCol) {
-        AbEnd ("comment-column value must be smaller than text-column value");
-    }
-
-    /* If no CPU given, use the default CPU */
-    if (CPU == CPU_UNKNOWN) {
-        CPU = CPU_6502;
-    }
-
     /* Get the current time and convert it to string so it can be used in
     ** the output page headers.
     */
     T = time (0);
     strftime (Now, sizeof (Now), "%Y-%m-%d %H:%M:%S", localtime (&T));
 
-    /* Load the input file */
-    LoadCode ();
-
-    /* Open the output file */
-    OpenOutput (OutFile);
-
-    /* Disassemble the code */
-    Disassemble ();
-
-    /* Close the output file */
-    CloseOutput ();
+    /* Disassemble either the files from the batch file, or the one given */
+    if (BatchFile) {
+        if (InFile) {
+            AbEnd ("Cannot use an input file together with --batch");
+        }
+        Batch (BatchFile);
+    } else {
+        ReadInfoFile ();
+        DisassembleFile ();
+    }
 
     /* Done */
     return EXIT_SUCCESS;
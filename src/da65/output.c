@@ -102,7 +102,10 @@ void OpenOutput (const char* Name)
         F = stdout;
     }
 
-    /* Output the header and initialize stuff */
+    /* Output the header and initialize stuff. In batch mode, every output
+    ** file starts on page one.
+    */
+    Page = 1;
     PageHeader ();
     Line = 5;
     Col  = 1;
@@ -72,6 +72,7 @@ typedef enum token_t {
     INFOTOK_COMMENT_COLUMN,
     INFOTOK_COMMENTS,
     INFOTOK_CPU,
+    INFOTOK_FLOWANALYSIS,
     INFOTOK_HEXOFFS,
     INFOTOK_INPUTNAME,
     INFOTOK_INPUTOFFS,
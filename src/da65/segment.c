@@ -137,3 +137,20 @@ unsigned GetSegmentAddrSize (unsigned Addr)
 
     return 0;
 }
+
+
+
+void ResetSegments (void)
+/* Remove all segments. Since the segment bounds are kept in the attribute
+** table, it must be reset, too.
+*/
+{
+    unsigned I;
+    for (I = 0; I < HASH_SIZE; ++I) {
+        while (StartTab[I]) {
+            Segment* S = StartTab[I];
+            StartTab[I] = S->NextStart;
+            xfree (S);
+        }
+    }
+}
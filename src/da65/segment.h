@@ -53,6 +53,11 @@ char* GetSegmentStartName (unsigned Addr);
 unsigned GetSegmentAddrSize (unsigned Addr);
 /* Return the address size of the segment which starts at the given address */
 
+void ResetSegments (void);
+/* Remove all segments. Since the segment bounds are kept in the attribute
+** table, it must be reset, too.
+*/
+
 
 
 /* End of segment.h */
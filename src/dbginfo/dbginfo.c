@@ -59,6 +59,95 @@
 #define VER_MAJOR       2U
 #define VER_MINOR       0U
 
+/* The following definitions describe the binary debug info file. They are
+** taken from common/dbgdefs.h, so this module can be used standalone.
+*/
+#define DBG_MAGIC               0x47424443UL    /* "CDBG" */
+#define DBG_VER_MAJOR           2U
+#define DBG_VER_MINOR           0U
+#define DBG_INV_ID              0xFFFFFFFFUL
+
+/* Item kinds */
+enum {
+    DBG_KIND_CSYM,
+    DBG_KIND_FILE,
+    DBG_KIND_LIB,
+    DBG_KIND_LINE,
+    DBG_KIND_MOD,
+    DBG_KIND_SCOPE,
+    DBG_KIND_SEG,
+    DBG_KIND_SPAN,
+    DBG_KIND_SYM,
+    DBG_KIND_TYPE,
+    DBG_KIND_COUNT
+};
+
+/* Size of the header in words */
+#define DBG_HDR_SIZE            (3 + DBG_KIND_COUNT + 2)
+
+/* Record layouts */
+enum {
+    DBG_CSYM_NAME, DBG_CSYM_SCOPE, DBG_CSYM_TYPE, DBG_CSYM_SC, DBG_CSYM_OFFS,
+    DBG_CSYM_SYM, DBG_CSYM_RECSIZE
+};
+enum {
+    DBG_FILE_NAME, DBG_FILE_SIZE, DBG_FILE_MTIME, DBG_FILE_MODS,
+    DBG_FILE_MODCOUNT, DBG_FILE_RECSIZE
+};
+enum {
+    DBG_LIB_NAME, DBG_LIB_RECSIZE
+};
+enum {
+    DBG_LINE_FILE, DBG_LINE_LINE, DBG_LINE_TYPE, DBG_LINE_COUNT,
+    DBG_LINE_SPANS, DBG_LINE_SPANCOUNT, DBG_LINE_RECSIZE
+};
+enum {
+    DBG_MOD_NAME, DBG_MOD_FILE, DBG_MOD_LIB, DBG_MOD_RECSIZE
+};
+enum {
+    DBG_SCOPE_NAME, DBG_SCOPE_MOD, DBG_SCOPE_TYPE, DBG_SCOPE_SIZE,
+    DBG_SCOPE_PARENT, DBG_SCOPE_SYM, DBG_SCOPE_SPANS, DBG_SCOPE_SPANCOUNT,
+    DBG_SCOPE_RECSIZE
+};
+enum {
+    DBG_SEG_NAME, DBG_SEG_START, DBG_SEG_SIZE, DBG_SEG_ONAME, DBG_SEG_OOFFS,
+    DBG_SEG_RECSIZE
+};
+enum {
+    DBG_SPAN_SEG, DBG_SPAN_START, DBG_SPAN_SIZE, DBG_SPAN_TYPE,
+    DBG_SPAN_RECSIZE
+};
+enum {
+    DBG_SYM_NAME, DBG_SYM_TYPE, DBG_SYM_VALUE, DBG_SYM_SIZE, DBG_SYM_EXP,
+    DBG_SYM_SEG, DBG_SYM_SCOPE, DBG_SYM_PARENT, DBG_SYM_DEFS,
+    DBG_SYM_DEFCOUNT, DBG_SYM_REFS, DBG_SYM_REFCOUNT, DBG_SYM_RECSIZE
+};
+enum {
+    DBG_TYPE_VAL, DBG_TYPE_RECSIZE
+};
+
+/* Storage classes of C symbols */
+enum {
+    DBG_SC_AUTO, DBG_SC_REG, DBG_SC_STATIC, DBG_SC_EXTERN
+};
+
+/* Types of assembler symbols */
+enum {
+    DBG_SYM_EQUATE, DBG_SYM_LABEL, DBG_SYM_IMPORT
+};
+
+/* Indexes */
+enum {
+    DBG_INDEX_FILE_BYNAME,
+    DBG_INDEX_MOD_BYNAME,
+    DBG_INDEX_SCOPE_BYNAME,
+    DBG_INDEX_SEG_BYNAME,
+    DBG_INDEX_SPAN_BYADDR,
+    DBG_INDEX_SYM_BYNAME,
+    DBG_INDEX_SYM_BYVAL,
+    DBG_INDEX_COUNT
+};
+
 /* Dynamic strings */
 typedef struct StrBuf StrBuf;
 struct StrBuf {
@@ -102,10 +191,23 @@ struct SpanInfoListEntry {
     void*               Data;           /* Either SpanInfo* or SpanInfo** */
 };
 
+/* To speed up lookups, the span info list has an address index. Each index
+** entry covers (1 << Shift) addresses starting at Base, and contains the
+** position of the first list entry with an address in this range, so the
+** entries for the range are those from Index[I] to Index[I+1]-1. Shift is
+** chosen so the index has at most SPAN_INDEX_SIZE entries. For 16 bit
+** address spaces Shift is zero, and the index maps each address directly.
+*/
+#define SPAN_INDEX_SIZE         0x10000U
+
 typedef struct SpanInfoList SpanInfoList;
 struct SpanInfoList {
     unsigned            Count;          /* Number of entries */
     SpanInfoListEntry*  List;           /* Dynamic array with entries */
+    cc65_addr           Base;           /* First address in the list */
+    cc65_addr           Last;           /* Last address in the list */
+    unsigned            Shift;          /* Address bits per index entry */
+    unsigned*           Index;          /* Address index */
 };
 
 /* Input tokens */
@@ -205,7 +307,7 @@ struct DbgInfo {
     Collection          ScopeInfoByName;/* Scope infos sorted by name */
     Collection          SegInfoByName;  /* Segment infos sorted by name */
     Collection          SymInfoByName;  /* Symbol infos sorted by name */
-    Collection          SymInfoByVal;   /* Symbol infos sorted by value */
+    Collection          LabelInfoByVal; /* Label symbols sorted by value */
 
     /* Other stuff */
     SpanInfoList        SpanInfoByAddr; /* Span infos sorted by unique address */
@@ -233,6 +335,7 @@ struct InputData {
     StrBuf              SVal;           /* String constant */
     cc65_errorfunc      Error;          /* Function called in case of errors */
     DbgInfo*            Info;           /* Pointer to debug info */
+    Collection          SpanInfoByAddr; /* Span infos by address if known */
 };
 
 /* Typedefs for the item structures. Do also serve as forwards */
@@ -888,6 +991,16 @@ static void CollAppendId (Collection* C, unsigned Id)
 
 
 
+static void CollTruncate (Collection* C, unsigned Count)
+/* Remove all items from position Count to the end of the collection */
+{
+    if (Count < C->Count) {
+        C->Count = Count;
+    }
+}
+
+
+
 static void* CollAt (const Collection* C, unsigned Index)
 /* Return the item at the given index */
 {
@@ -960,8 +1073,17 @@ static void CollQuickSort (Collection* C, int Lo, int Hi,
 static void CollSort (Collection* C, int (*Compare) (const void*, const void*))
 /* Sort the collection using the given compare function. */
 {
-    if (C->Count > 1) {
-        CollQuickSort (C, 0, C->Count-1, Compare);
+    unsigned I;
+
+    /* Collections are often sorted already, for example when they were read
+    ** from a binary debug info file. Since the quicksort is quadratic on
+    ** sorted input, check for this case first.
+    */
+    for (I = 1; I < C->Count; ++I) {
+        if (Compare (C->Items[I-1].Ptr, C->Items[I].Ptr) > 0) {
+            CollQuickSort (C, 0, C->Count-1, Compare);
+            break;
+        }
     }
 }
 
@@ -1319,7 +1441,8 @@ static int CompareFileInfoByName (const void* L, const void* R)
 {
     /* Sort by file name. If names are equal, sort by timestamp,
     ** then sort by size. Which means, identical files will go
-    ** together.
+    ** together. Ties are resolved by id, so the order doesn't depend on
+    ** the format of the debug info file.
     */
     int Res = strcmp (((const FileInfo*) L)->Name,
                       ((const FileInfo*) R)->Name);
@@ -1336,7 +1459,7 @@ static int CompareFileInfoByName (const void* L, const void* R)
     } else if (((const FileInfo*) L)->Size < ((const FileInfo*) R)->Size) {
         return -1;
     } else {
-        return 0;
+        return (int)((const FileInfo*) L)->Id - (int)((const FileInfo*) R)->Id;
     }
 }
 
@@ -1523,8 +1646,12 @@ static void CopyModInfo (cc65_moduledata* D, const ModInfo* M)
 static int CompareModInfoByName (const void* L, const void* R)
 /* Helper function to sort module infos in a collection by name */
 {
-    /* Compare module name */
-    return strcmp (((const ModInfo*) L)->Name, ((const ModInfo*) R)->Name);
+    /* Compare module name, then id */
+    int Res = strcmp (((const ModInfo*) L)->Name, ((const ModInfo*) R)->Name);
+    if (Res == 0) {
+        Res = (int)((const ModInfo*) L)->Id - (int)((const ModInfo*) R)->Id;
+    }
+    return Res;
 }
 
 
@@ -1683,9 +1810,13 @@ static void CopySegInfo (cc65_segmentdata* D, const SegInfo* S)
 static int CompareSegInfoByName (const void* L, const void* R)
 /* Helper function to sort segment infos in a collection by name */
 {
-    /* Sort by file name */
-    return strcmp (((const SegInfo*) L)->Name,
-                   ((const SegInfo*) R)->Name);
+    /* Sort by segment name, then id */
+    int Res = strcmp (((const SegInfo*) L)->Name,
+                      ((const SegInfo*) R)->Name);
+    if (Res == 0) {
+        Res = (int)((const SegInfo*) L)->Id - (int)((const SegInfo*) R)->Id;
+    }
+    return Res;
 }
 
 
@@ -1753,7 +1884,7 @@ static int CompareSpanInfoByAddr (const void* L, const void* R)
 ** equal, line spans with smaller end address are considered smaller. This
 ** means, that when CompareSpanInfoByAddr is used for sorting, a range with
 ** identical start addresses will have smaller spans first, followed by
-** larger spans.
+** larger spans. Identical spans are sorted by id.
 */
 {
     /* Sort by start of span */
@@ -1766,7 +1897,7 @@ static int CompareSpanInfoByAddr (const void* L, const void* R)
     } else if (((const SpanInfo*) L)->End < ((const SpanInfo*) R)->End) {
         return -1;
     } else {
-        return 0;
+        return (int)((const SpanInfo*) L)->Id - (int)((const SpanInfo*) R)->Id;
     }
 }
 
@@ -1864,9 +1995,16 @@ static void CopySymInfo (cc65_symboldata* D, const SymInfo* S)
 static int CompareSymInfoByName (const void* L, const void* R)
 /* Helper function to sort symbol infos in a collection by name */
 {
-    /* Sort by symbol name */
-    return strcmp (((const SymInfo*) L)->Name,
-                   ((const SymInfo*) R)->Name);
+    /* Sort by symbol name, then by id. Symbols with the same name are common
+    ** (cheap locals, symbols in different scopes), and the id keeps them in
+    ** the same order for text and binary debug info files.
+    */
+    int Res = strcmp (((const SymInfo*) L)->Name,
+                      ((const SymInfo*) R)->Name);
+    if (Res == 0) {
+        Res = (int)((const SymInfo*) L)->Id - (int)((const SymInfo*) R)->Id;
+    }
+    return Res;
 }
 
 
@@ -1875,7 +2013,7 @@ static int CompareSymInfoByVal (const void* L, const void* R)
 /* Helper function to sort symbol infos in a collection by value */
 {
     /* Sort by symbol value. If both are equal, sort by symbol name so it
-    ** looks nice when such a list is returned.
+    ** looks nice when such a list is returned, then by id.
     */
     if (((const SymInfo*) L)->Value > ((const SymInfo*) R)->Value) {
         return 1;
@@ -2187,6 +2325,45 @@ static void InitSpanInfoList (SpanInfoList* L)
 {
     L->Count = 0;
     L->List  = 0;
+    L->Base  = 0;
+    L->Last  = 0;
+    L->Shift = 0;
+    L->Index = 0;
+}
+
+
+
+static void CreateSpanInfoIndex (SpanInfoList* L)
+/* Create the address index for a span info list */
+{
+    unsigned I, J;
+    unsigned Count;
+
+    /* Determine the address range and the number of addresses covered by one
+    ** index entry.
+    */
+    L->Base  = L->List[0].Addr;
+    L->Last  = L->List[L->Count-1].Addr;
+    L->Shift = 0;
+    while (((L->Last - L->Base) >> L->Shift) >= SPAN_INDEX_SIZE) {
+        ++L->Shift;
+    }
+
+    /* Allocate the index. It has an additional entry at the end, so the
+    ** end of the range for the last entry can be determined.
+    */
+    Count = ((L->Last - L->Base) >> L->Shift) + 1;
+    L->Index = xmalloc ((Count + 1) * sizeof (L->Index[0]));
+
+    /* The list is sorted by address, so the index can be filled in one pass */
+    for (I = 0, J = 0; I < Count; ++I) {
+        cc65_addr Offs = (cc65_addr) I << L->Shift;
+        while (L->List[J].Addr - L->Base < Offs) {
+            ++J;
+        }
+        L->Index[I] = J;
+    }
+    L->Index[Count] = L->Count;
 }
 
 
@@ -2205,8 +2382,7 @@ static void CreateSpanInfoList (SpanInfoList* L, Collection* SpanInfos)
     cc65_addr End;
 
     /* Initialize and check if there's something to do */
-    L->Count = 0;
-    L->List  = 0;
+    InitSpanInfoList (L);
     if (CollCount (SpanInfos) == 0) {
         /* No entries */
         return;
@@ -2339,6 +2515,9 @@ static void CreateSpanInfoList (SpanInfoList* L, Collection* SpanInfos)
             }
         }
     }
+
+    /* Step 6: Create the address index */
+    CreateSpanInfoIndex (L);
 }
 
 
@@ -2361,8 +2540,9 @@ static void DoneSpanInfoList (SpanInfoList* L)
         }
     }
 
-    /* Delete the list */
+    /* Delete the list and the index */
     xfree (L->List);
+    xfree (L->Index);
 }
 
 
@@ -2400,7 +2580,7 @@ static DbgInfo* NewDbgInfo (const char* FileName)
     CollInit (&Info->ScopeInfoByName);
     CollInit (&Info->SegInfoByName);
     CollInit (&Info->SymInfoByName);
-    CollInit (&Info->SymInfoByVal);
+    CollInit (&Info->LabelInfoByVal);
 
     InitSpanInfoList (&Info->SpanInfoByAddr);
 
@@ -2471,7 +2651,7 @@ static void FreeDbgInfo (DbgInfo* Info)
     CollDone (&Info->ScopeInfoByName);
     CollDone (&Info->SegInfoByName);
     CollDone (&Info->SymInfoByName);
-    CollDone (&Info->SymInfoByVal);
+    CollDone (&Info->LabelInfoByVal);
 
     /* Free span info */
     DoneSpanInfoList (&Info->SpanInfoByAddr);
@@ -3190,7 +3370,7 @@ static void ParseInfo (InputData* D)
             case TOK_SYM:
                 CollGrow (&D->Info->SymInfoById,   D->IVal);
                 CollGrow (&D->Info->SymInfoByName, D->IVal);
-                CollGrow (&D->Info->SymInfoByVal,  D->IVal);
+                CollGrow (&D->Info->LabelInfoByVal, D->IVal);
                 break;
 
             case TOK_TYPE:
@@ -4403,7 +4583,7 @@ static void ParseSym (InputData* D)
     /* Remember it */
     CollReplaceExpand (&D->Info->SymInfoById, S, Id);
     CollAppend (&D->Info->SymInfoByName, S);
-    CollAppend (&D->Info->SymInfoByVal, S);
+    CollAppend (&D->Info->LabelInfoByVal, S);
 
 ErrorExit:
     /* Entry point in case of errors */
@@ -4609,6 +4789,522 @@ ErrorExit:
 
 
 
+/*****************************************************************************/
+/*                          Binary debug info files                          */
+/*****************************************************************************/
+
+
+
+/* Data used when reading a binary debug info file */
+typedef struct BinData BinData;
+struct BinData {
+    unsigned char*      Data;           /* File contents */
+    unsigned long       Size;           /* Size of file in words */
+    unsigned long       Count[DBG_KIND_COUNT];  /* Number of items */
+    unsigned long       Table[DBG_KIND_COUNT];  /* Position of item tables */
+    unsigned long       Index[DBG_INDEX_COUNT]; /* Position of indexes */
+    unsigned long       Lists;          /* Position of list pool */
+    unsigned long       ListCount;      /* Size of list pool in words */
+    const char*         Strings;        /* String pool */
+    unsigned long       StrSize;        /* Size of string pool in bytes */
+};
+
+/* Record sizes in words */
+static const unsigned BinRecSize[DBG_KIND_COUNT] = {
+    DBG_CSYM_RECSIZE,
+    DBG_FILE_RECSIZE,
+    DBG_LIB_RECSIZE,
+    DBG_LINE_RECSIZE,
+    DBG_MOD_RECSIZE,
+    DBG_SCOPE_RECSIZE,
+    DBG_SEG_RECSIZE,
+    DBG_SPAN_RECSIZE,
+    DBG_SYM_RECSIZE,
+    DBG_TYPE_RECSIZE,
+};
+
+
+
+static unsigned long BinWord (const BinData* B, unsigned long Pos)
+/* Return the little endian word at the given word position */
+{
+    const unsigned char* P = B->Data + Pos * 4;
+    return ((unsigned long) P[0])       |
+           ((unsigned long) P[1] << 8)  |
+           ((unsigned long) P[2] << 16) |
+           ((unsigned long) P[3] << 24);
+}
+
+
+
+static unsigned long BinField (const BinData* B, unsigned Kind, unsigned Id,
+                               unsigned Field)
+/* Return a field from the record of an item */
+{
+    return BinWord (B, B->Table[Kind] + (unsigned long) Id * BinRecSize[Kind] + Field);
+}
+
+
+
+static unsigned BinId (unsigned long Val)
+/* Convert an id from the file into an id as used in this module */
+{
+    return (Val == DBG_INV_ID)? CC65_INV_ID : (unsigned) Val;
+}
+
+
+
+static long BinSigned (unsigned long Val)
+/* Sign extend a value from the file */
+{
+    return (Val & 0x80000000UL)? -(long) ((~Val & 0x7FFFFFFFUL) + 1) : (long) Val;
+}
+
+
+
+static int BinString (InputData* D, const BinData* B, unsigned long Offs,
+                      StrBuf* S)
+/* Copy a string from the string pool into S. Return false on errors. */
+{
+    const char* Str;
+
+    if (Offs >= B->StrSize) {
+        ParseError (D, CC65_ERROR, "Invalid string offset %lu", Offs);
+        return 0;
+    }
+    Str = B->Strings + Offs;
+    SB_CopyBuf (S, Str, strlen (Str));
+    SB_Terminate (S);
+    return 1;
+}
+
+
+
+static int BinIdList (InputData* D, const BinData* B, unsigned long Pos,
+                      unsigned long Count, Collection* C)
+/* Append a list of ids from the list pool to C. Return false on errors. */
+{
+    unsigned long I;
+
+    if (Pos > B->ListCount || Count > B->ListCount - Pos) {
+        ParseError (D, CC65_ERROR, "Invalid id list at %lu", Pos);
+        return 0;
+    }
+    CollGrow (C, Count);
+    for (I = 0; I < Count; ++I) {
+        CollAppendId (C, BinId (BinWord (B, B->Lists + Pos + I)));
+    }
+    return 1;
+}
+
+
+
+static int BinIndex (InputData* D, const BinData* B, unsigned Index,
+                     const Collection* Items, Collection* C)
+/* Append the items from Items to C in the order given by an index. Return
+** false on errors.
+*/
+{
+    unsigned I;
+    int      Ok = 1;
+
+    /* Track the items already seen, so an index with duplicates is detected */
+    unsigned Count = CollCount (Items);
+    char*    Seen  = xmalloc (Count + 1);
+    memset (Seen, 0, Count + 1);
+
+    CollGrow (C, Count);
+    for (I = 0; I < Count; ++I) {
+        unsigned long Id = BinWord (B, B->Index[Index] + I);
+        if (Id >= Count || Seen[Id]) {
+            ParseError (D, CC65_ERROR, "Invalid id %lu in index %u", Id, Index);
+            Ok = 0;
+            break;
+        }
+        Seen[Id] = 1;
+        CollAppend (C, CollAt (Items, (unsigned) Id));
+    }
+
+    xfree (Seen);
+    return Ok;
+}
+
+
+
+static int ReadBinHeader (InputData* D, BinData* B)
+/* Check the header of a binary debug info file and determine the position of
+** the tables. Return false on errors.
+*/
+{
+    unsigned      I;
+    unsigned long Pos;
+
+    /* Check the version. The layout of the tables depends on it, so we
+    ** cannot use files with a newer format.
+    */
+    D->Info->MajorVersion = (unsigned) BinWord (B, 1);
+    D->Info->MinorVersion = (unsigned) BinWord (B, 2);
+    if (D->Info->MajorVersion != DBG_VER_MAJOR ||
+        D->Info->MinorVersion > DBG_VER_MINOR) {
+        ParseError (D, CC65_ERROR,
+                    "Unsupported version of the binary debug info format. "
+                    "Version found = %u.%u, version supported = %u.%u",
+                    D->Info->MajorVersion, D->Info->MinorVersion,
+                    DBG_VER_MAJOR, DBG_VER_MINOR);
+        return 0;
+    }
+
+    /* Determine the position of the item tables. Check each against the
+    ** file size, so we won't overflow with a damaged header.
+    */
+    Pos = DBG_HDR_SIZE;
+    for (I = 0; I < DBG_KIND_COUNT; ++I) {
+        B->Count[I] = BinWord (B, 3 + I);
+        if (B->Count[I] > (B->Size - Pos) / BinRecSize[I]) {
+            goto Damaged;
+        }
+        B->Table[I] = Pos;
+        Pos += B->Count[I] * BinRecSize[I];
+    }
+
+    /* The indexes follow */
+    for (I = 0; I < DBG_INDEX_COUNT; ++I) {
+        unsigned long Count;
+        switch (I) {
+            case DBG_INDEX_FILE_BYNAME:  Count = B->Count[DBG_KIND_FILE];  break;
+            case DBG_INDEX_MOD_BYNAME:   Count = B->Count[DBG_KIND_MOD];   break;
+            case DBG_INDEX_SCOPE_BYNAME: Count = B->Count[DBG_KIND_SCOPE]; break;
+            case DBG_INDEX_SEG_BYNAME:   Count = B->Count[DBG_KIND_SEG];   break;
+            case DBG_INDEX_SPAN_BYADDR:  Count = B->Count[DBG_KIND_SPAN];  break;
+            default:                     Count = B->Count[DBG_KIND_SYM];   break;
+        }
+        if (Count > B->Size - Pos) {
+            goto Damaged;
+        }
+        B->Index[I] = Pos;
+        Pos += Count;
+    }
+
+    /* Then the list pool and the string pool */
+    B->ListCount = BinWord (B, 3 + DBG_KIND_COUNT);
+    B->StrSize   = BinWord (B, 4 + DBG_KIND_COUNT);
+    if (B->ListCount > B->Size - Pos) {
+        goto Damaged;
+    }
+    B->Lists   = Pos;
+    Pos       += B->ListCount;
+    B->Strings = (const char*) B->Data + Pos * 4;
+
+    /* The string pool must fill the remainder of the file and end with a
+    ** terminator, so all strings within are terminated.
+    */
+    if (B->StrSize != (B->Size - Pos) * 4 ||
+        (B->StrSize > 0 && B->Strings[B->StrSize-1] != '\0')) {
+        goto Damaged;
+    }
+
+    /* Done */
+    return 1;
+
+Damaged:
+    ParseError (D, CC65_ERROR, "Binary debug info file is damaged");
+    return 0;
+}
+
+
+
+static int ReadBinItems (InputData* D, const BinData* B)
+/* Create the items from the tables of a binary debug info file. Return false
+** on errors.
+*/
+{
+    unsigned I;
+    DbgInfo* Info = D->Info;
+    StrBuf   Name = STRBUF_INITIALIZER;
+    StrBuf   Str  = STRBUF_INITIALIZER;
+
+    /* Make room for the items */
+    CollGrow (&Info->CSymInfoById,  B->Count[DBG_KIND_CSYM]);
+    CollGrow (&Info->FileInfoById,  B->Count[DBG_KIND_FILE]);
+    CollGrow (&Info->LibInfoById,   B->Count[DBG_KIND_LIB]);
+    CollGrow (&Info->LineInfoById,  B->Count[DBG_KIND_LINE]);
+    CollGrow (&Info->ModInfoById,   B->Count[DBG_KIND_MOD]);
+    CollGrow (&Info->ScopeInfoById, B->Count[DBG_KIND_SCOPE]);
+    CollGrow (&Info->SegInfoById,   B->Count[DBG_KIND_SEG]);
+    CollGrow (&Info->SpanInfoById,  B->Count[DBG_KIND_SPAN]);
+    CollGrow (&Info->SymInfoById,   B->Count[DBG_KIND_SYM]);
+    CollGrow (&Info->TypeInfoById,  B->Count[DBG_KIND_TYPE]);
+
+    /* C symbols */
+    for (I = 0; I < B->Count[DBG_KIND_CSYM]; ++I) {
+        CSymInfo* S;
+        unsigned  SymId = BinId (BinField (B, DBG_KIND_CSYM, I, DBG_CSYM_SYM));
+        unsigned  SC;
+        switch (BinField (B, DBG_KIND_CSYM, I, DBG_CSYM_SC)) {
+            case DBG_SC_AUTO:   SC = CC65_CSYM_AUTO;    break;
+            case DBG_SC_REG:    SC = CC65_CSYM_REG;     break;
+            case DBG_SC_STATIC: SC = CC65_CSYM_STATIC;  break;
+            case DBG_SC_EXTERN: SC = CC65_CSYM_EXTERN;  break;
+            default:
+                ParseError (D, CC65_ERROR,
+                            "Invalid storage class for c symbol with id %u", I);
+                goto ErrorExit;
+        }
+        if (SymId != CC65_INV_ID && SC == CC65_CSYM_AUTO) {
+            ParseError (D, CC65_ERROR, "Only non auto symbols can have a symbol attached");
+            goto ErrorExit;
+        }
+        if (!BinString (D, B, BinField (B, DBG_KIND_CSYM, I, DBG_CSYM_NAME), &Name)) {
+            goto ErrorExit;
+        }
+        S = NewCSymInfo (&Name);
+        S->Id       = I;
+        S->Kind     = CC65_CSYM_VAR;
+        S->SC       = SC;
+        S->Offs     = (int) BinSigned (BinField (B, DBG_KIND_CSYM, I, DBG_CSYM_OFFS));
+        S->Sym.Id   = SymId;
+        S->Type.Id  = BinId (BinField (B, DBG_KIND_CSYM, I, DBG_CSYM_TYPE));
+        S->Scope.Id = BinId (BinField (B, DBG_KIND_CSYM, I, DBG_CSYM_SCOPE));
+        CollAppend (&Info->CSymInfoById, S);
+    }
+
+    /* Files. The module list contains ids until ProcessFileInfo resolves
+    ** them.
+    */
+    for (I = 0; I < B->Count[DBG_KIND_FILE]; ++I) {
+        FileInfo* F;
+        if (!BinString (D, B, BinField (B, DBG_KIND_FILE, I, DBG_FILE_NAME), &Name)) {
+            goto ErrorExit;
+        }
+        F = NewFileInfo (&Name);
+        F->Id    = I;
+        F->Size  = BinField (B, DBG_KIND_FILE, I, DBG_FILE_SIZE);
+        F->MTime = BinField (B, DBG_KIND_FILE, I, DBG_FILE_MTIME);
+        CollAppend (&Info->FileInfoById, F);
+        if (!BinIdList (D, B, BinField (B, DBG_KIND_FILE, I, DBG_FILE_MODS),
+                        BinField (B, DBG_KIND_FILE, I, DBG_FILE_MODCOUNT),
+                        &F->ModInfoByName)) {
+            goto ErrorExit;
+        }
+    }
+
+    /* Libraries */
+    for (I = 0; I < B->Count[DBG_KIND_LIB]; ++I) {
+        LibInfo* L;
+        if (!BinString (D, B, BinField (B, DBG_KIND_LIB, I, DBG_LIB_NAME), &Name)) {
+            goto ErrorExit;
+        }
+        L = NewLibInfo (&Name);
+        L->Id = I;
+        CollAppend (&Info->LibInfoById, L);
+    }
+
+    /* Line infos */
+    for (I = 0; I < B->Count[DBG_KIND_LINE]; ++I) {
+        LineInfo* L = NewLineInfo ();
+        L->Id      = I;
+        L->Line    = (cc65_line) BinField (B, DBG_KIND_LINE, I, DBG_LINE_LINE);
+        L->File.Id = BinId (BinField (B, DBG_KIND_LINE, I, DBG_LINE_FILE));
+        L->Type    = (cc65_line_type) BinField (B, DBG_KIND_LINE, I, DBG_LINE_TYPE);
+        L->Count   = (unsigned) BinField (B, DBG_KIND_LINE, I, DBG_LINE_COUNT);
+        CollAppend (&Info->LineInfoById, L);
+        if (!BinIdList (D, B, BinField (B, DBG_KIND_LINE, I, DBG_LINE_SPANS),
+                        BinField (B, DBG_KIND_LINE, I, DBG_LINE_SPANCOUNT),
+                        &L->SpanInfoList)) {
+            goto ErrorExit;
+        }
+    }
+
+    /* Modules */
+    for (I = 0; I < B->Count[DBG_KIND_MOD]; ++I) {
+        ModInfo* M;
+        if (!BinString (D, B, BinField (B, DBG_KIND_MOD, I, DBG_MOD_NAME), &Name)) {
+            goto ErrorExit;
+        }
+        M = NewModInfo (&Name);
+        M->Id      = I;
+        M->File.Id = BinId (BinField (B, DBG_KIND_MOD, I, DBG_MOD_FILE));
+        M->Lib.Id  = BinId (BinField (B, DBG_KIND_MOD, I, DBG_MOD_LIB));
+        CollAppend (&Info->ModInfoById, M);
+    }
+
+    /* Scopes */
+    for (I = 0; I < B->Count[DBG_KIND_SCOPE]; ++I) {
+        ScopeInfo*      S;
+        cc65_scope_type Type;
+        switch (BinField (B, DBG_KIND_SCOPE, I, DBG_SCOPE_TYPE)) {
+            case 0:     Type = CC65_SCOPE_GLOBAL;       break;
+            case 1:     Type = CC65_SCOPE_MODULE;       break;
+            case 2:     Type = CC65_SCOPE_SCOPE;        break;
+            case 3:     Type = CC65_SCOPE_STRUCT;       break;
+            case 4:     Type = CC65_SCOPE_ENUM;         break;
+            default:
+                ParseError (D, CC65_ERROR,
+                            "Invalid type for scope with id %u", I);
+                goto ErrorExit;
+        }
+        if (!BinString (D, B, BinField (B, DBG_KIND_SCOPE, I, DBG_SCOPE_NAME), &Name)) {
+            goto ErrorExit;
+        }
+        S = NewScopeInfo (&Name);
+        S->Id        = I;
+        S->Type      = Type;
+        S->Size      = BinField (B, DBG_KIND_SCOPE, I, DBG_SCOPE_SIZE);
+        S->Mod.Id    = BinId (BinField (B, DBG_KIND_SCOPE, I, DBG_SCOPE_MOD));
+        S->Parent.Id = BinId (BinField (B, DBG_KIND_SCOPE, I, DBG_SCOPE_PARENT));
+        S->Label.Id  = BinId (BinField (B, DBG_KIND_SCOPE, I, DBG_SCOPE_SYM));
+        CollAppend (&Info->ScopeInfoById, S);
+        if (!BinIdList (D, B, BinField (B, DBG_KIND_SCOPE, I, DBG_SCOPE_SPANS),
+                        BinField (B, DBG_KIND_SCOPE, I, DBG_SCOPE_SPANCOUNT),
+                        &S->SpanInfoList)) {
+            goto ErrorExit;
+        }
+    }
+
+    /* Segments. An output name is optional. */
+    for (I = 0; I < B->Count[DBG_KIND_SEG]; ++I) {
+        unsigned long OName = BinField (B, DBG_KIND_SEG, I, DBG_SEG_ONAME);
+        if (!BinString (D, B, BinField (B, DBG_KIND_SEG, I, DBG_SEG_NAME), &Name)) {
+            goto ErrorExit;
+        }
+        if (OName == DBG_INV_ID) {
+            SB_Clear (&Str);
+        } else if (!BinString (D, B, OName, &Str)) {
+            goto ErrorExit;
+        }
+        CollAppend (&Info->SegInfoById,
+                    NewSegInfo (&Name, I,
+                                BinField (B, DBG_KIND_SEG, I, DBG_SEG_START),
+                                BinField (B, DBG_KIND_SEG, I, DBG_SEG_SIZE),
+                                &Str,
+                                BinField (B, DBG_KIND_SEG, I, DBG_SEG_OOFFS)));
+    }
+
+    /* Spans. The start is relocated by ProcessSpanInfo. */
+    for (I = 0; I < B->Count[DBG_KIND_SPAN]; ++I) {
+        SpanInfo* S = NewSpanInfo ();
+        S->Id      = I;
+        S->Start   = BinField (B, DBG_KIND_SPAN, I, DBG_SPAN_START);
+        S->End     = S->Start + BinField (B, DBG_KIND_SPAN, I, DBG_SPAN_SIZE) - 1;
+        S->Seg.Id  = BinId (BinField (B, DBG_KIND_SPAN, I, DBG_SPAN_SEG));
+        S->Type.Id = BinId (BinField (B, DBG_KIND_SPAN, I, DBG_SPAN_TYPE));
+        CollAppend (&Info->SpanInfoById, S);
+    }
+
+    /* Symbols */
+    for (I = 0; I < B->Count[DBG_KIND_SYM]; ++I) {
+        SymInfo*         S;
+        cc65_symbol_type Type;
+        unsigned         ScopeId  = BinId (BinField (B, DBG_KIND_SYM, I, DBG_SYM_SCOPE));
+        unsigned         ParentId = BinId (BinField (B, DBG_KIND_SYM, I, DBG_SYM_PARENT));
+        switch (BinField (B, DBG_KIND_SYM, I, DBG_SYM_TYPE)) {
+            case DBG_SYM_EQUATE:        Type = CC65_SYM_EQUATE;         break;
+            case DBG_SYM_LABEL:         Type = CC65_SYM_LABEL;          break;
+            case DBG_SYM_IMPORT:        Type = CC65_SYM_IMPORT;         break;
+            default:
+                ParseError (D, CC65_ERROR,
+                            "Invalid type for symbol with id %u", I);
+                goto ErrorExit;
+        }
+        if ((ScopeId == CC65_INV_ID) == (ParentId == CC65_INV_ID)) {
+            ParseError (D, CC65_ERROR, "Only one of \"parent\", \"scope\" must be specified");
+            goto ErrorExit;
+        }
+        if (!BinString (D, B, BinField (B, DBG_KIND_SYM, I, DBG_SYM_NAME), &Name)) {
+            goto ErrorExit;
+        }
+        S = NewSymInfo (&Name);
+        S->Id        = I;
+        S->Type      = Type;
+        S->Value     = BinSigned (BinField (B, DBG_KIND_SYM, I, DBG_SYM_VALUE));
+        S->Size      = BinField (B, DBG_KIND_SYM, I, DBG_SYM_SIZE);
+        S->Exp.Id    = BinId (BinField (B, DBG_KIND_SYM, I, DBG_SYM_EXP));
+        S->Seg.Id    = BinId (BinField (B, DBG_KIND_SYM, I, DBG_SYM_SEG));
+        S->Scope.Id  = ScopeId;
+        S->Parent.Id = ParentId;
+        CollAppend (&Info->SymInfoById, S);
+        if (!BinIdList (D, B, BinField (B, DBG_KIND_SYM, I, DBG_SYM_DEFS),
+                        BinField (B, DBG_KIND_SYM, I, DBG_SYM_DEFCOUNT),
+                        &S->DefLineInfoList) ||
+            !BinIdList (D, B, BinField (B, DBG_KIND_SYM, I, DBG_SYM_REFS),
+                        BinField (B, DBG_KIND_SYM, I, DBG_SYM_REFCOUNT),
+                        &S->RefLineInfoList)) {
+            goto ErrorExit;
+        }
+    }
+
+    /* Types are stored as strings in the same format as in the text file */
+    for (I = 0; I < B->Count[DBG_KIND_TYPE]; ++I) {
+        TypeInfo* T;
+        if (!BinString (D, B, BinField (B, DBG_KIND_TYPE, I, DBG_TYPE_VAL), &Str)) {
+            goto ErrorExit;
+        }
+        T = ParseTypeString (D, &Str);
+        if (T == 0) {
+            goto ErrorExit;
+        }
+        T->Id = I;
+        CollAppend (&Info->TypeInfoById, T);
+    }
+
+    /* Fill the collections with other sort criteria from the indexes. Since
+    ** they are already sorted, the postprocessing won't have to sort them.
+    */
+    if (!BinIndex (D, B, DBG_INDEX_FILE_BYNAME,  &Info->FileInfoById,  &Info->FileInfoByName)  ||
+        !BinIndex (D, B, DBG_INDEX_MOD_BYNAME,   &Info->ModInfoById,   &Info->ModInfoByName)   ||
+        !BinIndex (D, B, DBG_INDEX_SCOPE_BYNAME, &Info->ScopeInfoById, &Info->ScopeInfoByName) ||
+        !BinIndex (D, B, DBG_INDEX_SEG_BYNAME,   &Info->SegInfoById,   &Info->SegInfoByName)   ||
+        !BinIndex (D, B, DBG_INDEX_SPAN_BYADDR,  &Info->SpanInfoById,  &D->SpanInfoByAddr)     ||
+        !BinIndex (D, B, DBG_INDEX_SYM_BYNAME,   &Info->SymInfoById,   &Info->SymInfoByName)   ||
+        !BinIndex (D, B, DBG_INDEX_SYM_BYVAL,    &Info->SymInfoById,   &Info->LabelInfoByVal)) {
+        goto ErrorExit;
+    }
+
+ErrorExit:
+    /* Entry point in case of errors */
+    SB_Done (&Name);
+    SB_Done (&Str);
+    return D->Errors == 0;
+}
+
+
+
+static void ReadBinDbgInfo (InputData* D)
+/* Read a binary debug info file. The file position is expected at the start
+** of the file.
+*/
+{
+    BinData B;
+    long    Size;
+
+    /* Determine the file size */
+    if (fseek (D->F, 0, SEEK_END) != 0 || (Size = ftell (D->F)) < 0 ||
+        fseek (D->F, 0, SEEK_SET) != 0) {
+        ParseError (D, CC65_ERROR, "Cannot read input file \"%s\": %s",
+                    D->FileName, strerror (errno));
+        return;
+    }
+    if (Size < (long) (DBG_HDR_SIZE * 4) || (Size % 4) != 0) {
+        ParseError (D, CC65_ERROR, "Binary debug info file is damaged");
+        return;
+    }
+
+    /* Read the complete file with one call */
+    B.Size = (unsigned long) Size / 4;
+    B.Data = xmalloc (Size);
+    if (fread (B.Data, 1, Size, D->F) != (size_t) Size) {
+        ParseError (D, CC65_ERROR, "Cannot read input file \"%s\"",
+                    D->FileName);
+    } else if (ReadBinHeader (D, &B)) {
+        ReadBinItems (D, &B);
+    }
+
+    /* The data was copied into the items, so it's not needed any longer */
+    xfree (B.Data);
+}
+
+
+
 /*****************************************************************************/
 /*                              Data processing                              */
 /*****************************************************************************/
@@ -4708,9 +5404,25 @@ static SpanInfoListEntry* FindSpanInfoByAddr (const SpanInfoList* L, cc65_addr A
 ** SpanInfo was found.
 */
 {
-    /* Do a binary search */
-    int Lo = 0;
-    int Hi = (int) L->Count - 1;
+    int       Lo, Hi;
+    cc65_addr Offs;
+
+    /* Check if the address is in the range of the list */
+    if (L->Count == 0 || Addr < L->Base || Addr > L->Last) {
+        return 0;
+    }
+
+    /* Get the range of entries from the index. If each index entry covers
+    ** one address, this is either exactly one entry for the address, or none.
+    */
+    Offs = (Addr - L->Base) >> L->Shift;
+    Lo   = (int) L->Index[Offs];
+    Hi   = (int) L->Index[Offs+1] - 1;
+    if (L->Shift == 0) {
+        return (Lo <= Hi)? &L->List[Lo] : 0;
+    }
+
+    /* Do a binary search within the range */
     while (Lo <= Hi) {
 
         /* Mid of range */
@@ -5365,11 +6077,12 @@ static void ProcessSpanInfo (InputData* D)
 {
     unsigned I;
 
-    /* Temporary collection with span infos sorted by address */
-    Collection SpanInfoByAddr = COLLECTION_INITIALIZER;
-
-    /* Resize the temporary collection */
-    CollGrow (&SpanInfoByAddr, CollCount (&D->Info->SpanInfoById));
+    /* If the input file did contain the span infos sorted by address, use
+    ** that order. Otherwise create a temporary collection that is sorted
+    ** later.
+    */
+    int HaveOrder = (CollCount (&D->SpanInfoByAddr) > 0);
+    CollGrow (&D->SpanInfoByAddr, CollCount (&D->Info->SpanInfoById));
 
     /* Walk over all spans and resolve the ids */
     for (I = 0; I < CollCount (&D->Info->SpanInfoById); ++I) {
@@ -5406,17 +6119,19 @@ static void ProcessSpanInfo (InputData* D)
         /* Append this span info to the temporary collection that is later
         ** sorted by address.
         */
-        CollAppend (&SpanInfoByAddr, S);
+        if (!HaveOrder) {
+            CollAppend (&D->SpanInfoByAddr, S);
+        }
     }
 
     /* Sort the collection with all span infos by address */
-    CollSort (&SpanInfoByAddr, CompareSpanInfoByAddr);
+    CollSort (&D->SpanInfoByAddr, CompareSpanInfoByAddr);
 
     /* Create the span info list from the span info collection */
-    CreateSpanInfoList (&D->Info->SpanInfoByAddr, &SpanInfoByAddr);
+    CreateSpanInfoList (&D->Info->SpanInfoByAddr, &D->SpanInfoByAddr);
 
     /* Remove the temporary collection */
-    CollDone (&SpanInfoByAddr);
+    CollDone (&D->SpanInfoByAddr);
 }
 
 
@@ -5576,9 +6291,20 @@ static void ProcessSymInfo (InputData* D)
         CollSort (&S->SymInfoByName, CompareSymInfoByName);
     }
 
+    /* Only labels are searched by value, so remove all other symbols from
+    ** the collection sorted by value. This keeps the order.
+    */
+    for (I = 0, J = 0; I < CollCount (&D->Info->LabelInfoByVal); ++I) {
+        SymInfo* S = CollAt (&D->Info->LabelInfoByVal, I);
+        if (S->Type == CC65_SYM_LABEL) {
+            CollReplace (&D->Info->LabelInfoByVal, S, J++);
+        }
+    }
+    CollTruncate (&D->Info->LabelInfoByVal, J);
+
     /* Sort the symbol infos */
-    CollSort (&D->Info->SymInfoByName, CompareSymInfoByName);
-    CollSort (&D->Info->SymInfoByVal,  CompareSymInfoByVal);
+    CollSort (&D->Info->SymInfoByName,  CompareSymInfoByName);
+    CollSort (&D->Info->LabelInfoByVal, CompareSymInfoByVal);
 }
 
 
@@ -5597,6 +6323,8 @@ cc65_dbginfo cc65_read_dbginfo (const char* FileName, cc65_errorfunc ErrFunc)
 ** read successfully, NULL is returned.
 */
 {
+    unsigned char Magic[4];
+
     /* Data structure used to control scanning and parsing */
     InputData D = {
         0,                      /* Name of input file */
@@ -5612,12 +6340,13 @@ cc65_dbginfo cc65_read_dbginfo (const char* FileName, cc65_errorfunc ErrFunc)
         STRBUF_INITIALIZER,     /* String constant */
         0,                      /* Function called in case of errors */
         0,                      /* Pointer to debug info */
+        COLLECTION_INITIALIZER, /* Span infos sorted by address */
     };
     D.FileName = FileName;
     D.Error    = ErrFunc;
 
     /* Open the input file */
-    D.F = fopen (FileName, "rt");
+    D.F = fopen (FileName, "rb");
     if (D.F == 0) {
         /* Cannot open */
         ParseError (&D, CC65_ERROR,
@@ -5629,6 +6358,26 @@ cc65_dbginfo cc65_read_dbginfo (const char* FileName, cc65_errorfunc ErrFunc)
     /* Create a new debug info struct */
     D.Info = NewDbgInfo (FileName);
 
+    /* Check for a binary debug info file. If it's not one, reopen the file
+    ** in text mode.
+    */
+    if (fread (Magic, 1, sizeof (Magic), D.F) == sizeof (Magic) &&
+        Magic[0] == (DBG_MAGIC & 0xFF)         &&
+        Magic[1] == ((DBG_MAGIC >> 8) & 0xFF)  &&
+        Magic[2] == ((DBG_MAGIC >> 16) & 0xFF) &&
+        Magic[3] == ((DBG_MAGIC >> 24) & 0xFF)) {
+        ReadBinDbgInfo (&D);
+        goto CloseAndExit;
+    }
+    D.F = freopen (FileName, "rt", D.F);
+    if (D.F == 0) {
+        ParseError (&D, CC65_ERROR,
+                    "Cannot open input file \"%s\": %s",
+                     FileName, strerror (errno));
+        FreeDbgInfo (D.Info);
+        return 0;
+    }
+
     /* Prime the pump */
     NextToken (&D);
 
@@ -5757,6 +6506,7 @@ CloseAndExit:
     */
     if (D.Errors > 0) {
         /* Free allocated stuff */
+        CollDone (&D.SpanInfoByAddr);
         FreeDbgInfo (D.Info);
         return 0;
     }
@@ -6526,6 +7276,72 @@ const cc65_spaninfo* cc65_span_byaddr (cc65_dbginfo Handle, unsigned long Addr)
 
 
 
+const cc65_spaninfo* cc65_span_byaddrlist (cc65_dbginfo Handle,
+                                           const unsigned long* Addrs,
+                                           unsigned Count, unsigned* First)
+/* Return span information for a list of addresses. First must point to an
+** array with Count+1 entries. On return, the spans for Addrs[I] are stored
+** in data[First[I]] to data[First[I+1]-1] of the returned struct. The
+** function returns NULL if no spans were found for any of the addresses.
+*/
+{
+    const DbgInfo*      Info;
+    cc65_spaninfo*      D;
+    unsigned            I, J;
+    unsigned            Total;
+
+    /* Check the parameter */
+    assert (Handle != 0);
+
+    /* The handle is actually a pointer to a debug info struct */
+    Info = Handle;
+
+    /* Determine the position of the spans for each address in the result.
+    ** Lookups are cheap with the address index, so the addresses are just
+    ** searched again when copying the data.
+    */
+    Total = 0;
+    for (I = 0; I < Count; ++I) {
+        const SpanInfoListEntry* E = FindSpanInfoByAddr (&Info->SpanInfoByAddr, Addrs[I]);
+        First[I] = Total;
+        if (E) {
+            Total += E->Count;
+        }
+    }
+    First[Count] = Total;
+
+    /* Bail out if we didn't find anything */
+    if (Total == 0) {
+        return 0;
+    }
+
+    /* Prepare the struct we will return to the caller */
+    D = new_cc65_spaninfo (Total);
+    for (I = 0; I < Count; ++I) {
+
+        /* Nothing to do if there are no spans for this address */
+        const SpanInfoListEntry* E;
+        if (First[I] == First[I+1]) {
+            continue;
+        }
+
+        /* Copy the data */
+        E = FindSpanInfoByAddr (&Info->SpanInfoByAddr, Addrs[I]);
+        if (E->Count == 1) {
+            CopySpanInfo (D->data + First[I], E->Data);
+        } else {
+            for (J = 0; J < E->Count; ++J) {
+                CopySpanInfo (D->data + First[I] + J, ((SpanInfo**) E->Data)[J]);
+            }
+        }
+    }
+
+    /* Return the struct we've created */
+    return D;
+}
+
+
+
 const cc65_spaninfo* cc65_span_byline (cc65_dbginfo Handle, unsigned LineId)
 /* Return span information for the given source line. The function returns NULL
 ** if the line id is invalid, otherwise the spans for this line (possibly zero).
@@ -7249,15 +8065,16 @@ const cc65_symbolinfo* cc65_symbol_inrange (cc65_dbginfo Handle, cc65_addr Start
     /* Search for the symbol. Because we're searching for a range, we cannot
     ** make use of the function result.
     */
-    FindSymInfoByValue (&Info->SymInfoByVal, Start, &Index);
+    FindSymInfoByValue (&Info->LabelInfoByVal, Start, &Index);
 
     /* Start from the given index, check all symbols until the end address is
-    ** reached. Place all symbols into SymInfoList for later.
+    ** reached. Place all symbols into SymInfoList for later. The collection
+    ** does only contain labels, so no other symbols must be skipped.
     */
-    for (I = Index; I < CollCount (&Info->SymInfoByVal); ++I) {
+    for (I = Index; I < CollCount (&Info->LabelInfoByVal); ++I) {
 
         /* Get the item */
-        SymInfo* Item = CollAt (&Info->SymInfoByVal, I);
+        SymInfo* Item = CollAt (&Info->LabelInfoByVal, I);
 
         /* The collection is sorted by address, so if we get a value larger
         ** than the end address, we're done.
@@ -7266,11 +8083,6 @@ const cc65_symbolinfo* cc65_symbol_inrange (cc65_dbginfo Handle, cc65_addr Start
             break;
         }
 
-        /* Ignore non-labels (this will also ignore imports) */
-        if (Item->Type != CC65_SYM_LABEL) {
-            continue;
-        }
-
         /* Ok, remember this one */
         CollAppend (&SymInfoList, Item);
     }
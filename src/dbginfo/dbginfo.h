@@ -371,6 +371,16 @@ const cc65_spaninfo* cc65_span_byaddr (cc65_dbginfo handle,
 ** if no spans were found for this address.
 */
 
+const cc65_spaninfo* cc65_span_byaddrlist (cc65_dbginfo handle,
+                                           const unsigned long* addrs,
+                                           unsigned count, unsigned* first);
+/* Return span information for a list of addresses with one call. first must
+** point to an array with count+1 entries. On return, the spans for addrs[i]
+** are stored in data[first[i]] to data[first[i+1]-1] of the returned
+** struct. The function returns NULL if no spans were found for any of the
+** addresses.
+*/
+
 const cc65_spaninfo* cc65_span_byline (cc65_dbginfo handle, unsigned line_id);
 /* Return span information for the given source line. The function returns NULL
 ** if the line id is invalid, otherwise the spans for this line (possibly zero).
@@ -54,7 +54,8 @@
 /* Assertion object forward decl */
 typedef struct Assertion Assertion;
 
-/* ObjData forward decl */
+/* Forwards */
+struct ExprNode;
 struct ObjData;
 
 
@@ -68,6 +69,9 @@ struct ObjData;
 Assertion* ReadAssertion (FILE* F, struct ObjData* O);
 /* Read an assertion from the given file */
 
+struct ExprNode* GetAssertionExpr (const Assertion* A);
+/* Return the expression of an assertion */
+
 void CheckAssertions (void);
 /* Check all assertions */
 
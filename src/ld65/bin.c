@@ -131,6 +131,23 @@ static void PrintNumVal (const char* Name, unsigned long V)
 
 
 
+static void BinWritePacked (BinDesc* D, SegDesc* S)
+/* Write the compressed data of a segment, padded to the size it was given
+** when placing the segments. The data was compressed in the last placement
+** pass, which placed the segments where they are now.
+*/
+{
+    const StrBuf* Packed = &S->Packed;
+
+    Print (stdout, 1, "    Compressed `%s' from %lu to %u bytes\n",
+           GetString (S->Name), S->Seg->Size, SB_GetLen (Packed));
+
+    WriteData (D->F, SB_GetConstBuf (Packed), SB_GetLen (Packed));
+    WriteMult (D->F, S->Seg->FillVal, S->LoadSize - SB_GetLen (Packed));
+}
+
+
+
 static void BinWriteMem (BinDesc* D, MemoryArea* M)
 /* Write the segments of one memory area to a file */
 {
@@ -219,11 +236,15 @@ static void BinWriteMem (BinDesc* D, MemoryArea* M)
         */
         if (DoWrite) {
             unsigned long P = ftell (D->F);
-            SegWrite (D->Filename, D->F, S->Seg, BinWriteExpr, D);
+            if (S->Flags & SF_COMPRESS) {
+                BinWritePacked (D, S);
+            } else {
+                SegWrite (D->Filename, D->F, S->Seg, BinWriteExpr, D);
+            }
             PrintNumVal ("Wrote", (unsigned long) (ftell (D->F) - P));
         } else if (M->Flags & MF_FILL) {
-            WriteMult (D->F, S->Seg->FillVal, S->Seg->Size);
-            PrintNumVal ("Filled", (unsigned long) S->Seg->Size);
+            WriteMult (D->F, S->Seg->FillVal, SegDescSize (S, M));
+            PrintNumVal ("Filled", SegDescSize (S, M));
         }
 
         /* If this was the load memory area, mark the segment as dumped */
@@ -232,7 +253,7 @@ static void BinWriteMem (BinDesc* D, MemoryArea* M)
         }
 
         /* Calculate the new address */
-        Addr += S->Seg->Size;
+        Addr += SegDescSize (S, M);
     }
 
     /* If a fill was requested, fill the remaining space */
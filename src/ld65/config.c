@@ -62,10 +62,13 @@
 #include "error.h"
 #include "exports.h"
 #include "expr.h"
+#include "gc.h"
 #include "global.h"
+#include "lz4.h"
 #include "memarea.h"
 #include "o65.h"
 #include "objdata.h"
+#include "relax.h"
 #include "scanner.h"
 #include "spool.h"
 
@@ -120,6 +123,7 @@ static Collection       SegDescList = STATIC_COLLECTION_INITIALIZER;
 #define SA_START        0x0080
 #define SA_OPTIONAL     0x0100
 #define SA_FILLVAL      0x0200
+#define SA_COMPRESS     0x0400
 
 /* Symbol types used in the CfgSymbol structure */
 typedef enum {
@@ -150,6 +154,12 @@ static Collection       CfgSymbols = STATIC_COLLECTION_INITIALIZER;
 static BinDesc* BinFmtDesc      = 0;
 static O65Desc* O65FmtDesc      = 0;
 
+/* Number of times the segments were placed */
+static unsigned PlacePasses     = 0;
+
+/* After this many passes, the compressed size of a segment may only grow */
+#define MAX_SHRINK_PASSES       8
+
 
 
 /*****************************************************************************/
@@ -358,6 +368,8 @@ static SegDesc* NewSegDesc (unsigned Name)
     S->FillVal       = 0;
     S->RunAlignment  = 1;
     S->LoadAlignment = 1;
+    S->LoadSize      = 0;
+    SB_Init (&S->Packed);
 
     /* Insert the struct into the list ... */
     CollAppend (&SegDescList, S);
@@ -639,6 +651,7 @@ static void ParseSegments (void)
     static const IdentTok Attributes [] = {
         {   "ALIGN",            CFGTOK_ALIGN            },
         {   "ALIGN_LOAD",       CFGTOK_ALIGN_LOAD       },
+        {   "COMPRESS",         CFGTOK_COMPRESS         },
         {   "DEFINE",           CFGTOK_DEFINE           },
         {   "FILLVAL",          CFGTOK_FILLVAL          },
         {   "LOAD",             CFGTOK_LOAD             },
@@ -700,6 +713,15 @@ static void ParseSegments (void)
                     S->Flags |= SF_ALIGN_LOAD;
                     break;
 
+                case CFGTOK_COMPRESS:
+                    FlagAttr (&S->Attr, SA_COMPRESS, "COMPRESS");
+                    CfgBoolToken ();
+                    if (CfgTok == CFGTOK_TRUE) {
+                        S->Flags |= SF_COMPRESS;
+                    }
+                    CfgNextTok ();
+                    break;
+
                 case CFGTOK_DEFINE:
                     FlagAttr (&S->Attr, SA_DEFINE, "DEFINE");
                     /* Map the token to a boolean */
@@ -800,6 +822,22 @@ static void ParseSegments (void)
                         "memory areas assigned");
         }
 
+        /* A compressed segment is unpacked from its load into its run memory
+        ** area, so it needs both. It must also have data.
+        */
+        if ((S->Flags & SF_COMPRESS) != 0) {
+            if (S->Load == S->Run) {
+                CfgError (&CfgErrorPos,
+                          "Compressed segment `%s' needs separate LOAD and "
+                          "RUN memory areas", GetString (S->Name));
+            }
+            if ((S->Flags & SF_BSS) != 0) {
+                CfgError (&CfgErrorPos,
+                          "Segment `%s' with type `bss' cannot be compressed",
+                          GetString (S->Name));
+            }
+        }
+
         /* Don't allow read/write data to be put into a readonly area */
         if ((S->Flags & SF_RO) == 0) {
             if (S->Run->Flags & MF_RO) {
@@ -1622,6 +1660,11 @@ static void ProcessSegments (void)
             /* Use the fill value from the config */
             S->Seg->FillVal = S->FillVal;
 
+            /* Until it's compressed, assume that a compressed segment
+            ** doesn't get smaller.
+            */
+            S->LoadSize = S->Seg->Size;
+
             /* Process the next segment descriptor in the next run */
             ++I;
 
@@ -1682,6 +1725,9 @@ static void ProcessSymbols (void)
 
                 /* Insert the symbol into the table */
                 O65SetExport (O65FmtDesc, Sym->Name);
+
+                /* The symbol is used from outside, so don't remove it */
+                GCKeepSymbol (Sym->Name);
                 break;
 
             case CfgSymO65Import:
@@ -1729,21 +1775,61 @@ static void ProcessSymbols (void)
 
 
 
+static void UpdateExport (unsigned Name, ExprNode* Expr)
+/* Replace the value of a symbol defined in an earlier pass */
+{
+    Export* E = FindExport (Name);
+    CHECK (E != 0 && E->Expr != 0);
+    FreeExpr (E->Expr);
+    E->Expr = Expr;
+}
+
+
+
+static void DefineMemoryExport (unsigned Name, MemoryArea* M,
+                                unsigned long Offs, LineInfo* LI)
+/* Define a symbol for an offset into a memory area. If the segments are
+** placed more than once, the symbol exists already and is updated.
+*/
+{
+    if (PlacePasses == 0) {
+        Export* E = CreateMemoryExport (Name, M, Offs);
+        CollAppend (&E->DefLines, LI);
+    } else {
+        UpdateExport (Name, MemoryExpr (M, Offs, 0));
+    }
+}
+
+
+
+static void DefineConstExport (unsigned Name, long Value, LineInfo* LI)
+/* Define a constant symbol. If the segments are placed more than once, the
+** symbol exists already and is updated.
+*/
+{
+    if (PlacePasses == 0) {
+        Export* E = CreateConstExport (Name, Value);
+        CollAppend (&E->DefLines, LI);
+    } else {
+        UpdateExport (Name, LiteralExpr (Value, 0));
+    }
+}
+
+
+
 static void CreateRunDefines (SegDesc* S, unsigned long SegAddr)
 /* Create the defines for a RUN segment */
 {
-    Export* E;
     StrBuf Buf = STATIC_STRBUF_INITIALIZER;
 
     /* Define the run address of the segment */
     SB_Printf (&Buf, "__%s_RUN__", GetString (S->Name));
-    E = CreateMemoryExport (GetStrBufId (&Buf), S->Run, SegAddr - S->Run->Start);
-    CollAppend (&E->DefLines, S->LI);
+    DefineMemoryExport (GetStrBufId (&Buf), S->Run,
+                        SegAddr - S->Run->Start, S->LI);
 
     /* Define the size of the segment */
     SB_Printf (&Buf, "__%s_SIZE__", GetString (S->Name));
-    E = CreateConstExport (GetStrBufId (&Buf), S->Seg->Size);
-    CollAppend (&E->DefLines, S->LI);
+    DefineConstExport (GetStrBufId (&Buf), S->Seg->Size, S->LI);
 
     S->Flags |= SF_RUN_DEF;
     SB_Done (&Buf);
@@ -1754,13 +1840,12 @@ static void CreateRunDefines (SegDesc* S, unsigned long SegAddr)
 static void CreateLoadDefines (SegDesc* S, unsigned long SegAddr)
 /* Create the defines for a LOAD segment */
 {
-    Export* E;
     StrBuf Buf = STATIC_STRBUF_INITIALIZER;
 
     /* Define the load address of the segment */
     SB_Printf (&Buf, "__%s_LOAD__", GetString (S->Name));
-    E = CreateMemoryExport (GetStrBufId (&Buf), S->Load, SegAddr - S->Load->Start);
-    CollAppend (&E->DefLines, S->LI);
+    DefineMemoryExport (GetStrBufId (&Buf), S->Load,
+                        SegAddr - S->Load->Start, S->LI);
 
     S->Flags |= SF_LOAD_DEF;
     SB_Done (&Buf);
@@ -1768,25 +1853,133 @@ static void CreateLoadDefines (SegDesc* S, unsigned long SegAddr)
 
 
 
-unsigned CfgProcess (void)
-/* Process the config file, after reading in object files and libraries. This
-** includes postprocessing of the config file data; but also assigning segments,
-** and defining segment/memory-area related symbols. The function will return
-** the number of memory area overflows (so, zero means everything went OK).
-** In case of overflows, a short mapfile can be generated later, to ease the
-** user's task of re-arranging segments.
+unsigned long SegDescSize (const SegDesc* S, const MemoryArea* M)
+/* Return the size of a segment in the given memory area. This is the size
+** of the compressed data in the load area of a compressed segment.
+*/
+{
+    if (S->Run != M && (S->Flags & SF_COMPRESS) != 0) {
+        return S->LoadSize;
+    }
+    return S->Seg->Size;
+}
+
+
+
+static void LayoutSegments (void)
+/* Assign tentative start addresses to the segments, so the linker can decide
+** which instructions may be shortened. This follows the rules used when
+** placing the segments in CfgProcess, but doesn't output diagnostics or
+** define any symbols. Memory areas with an unknown start address are left
+** unplaced.
 */
 {
-    unsigned Overflows = 0;
     unsigned I;
 
-    /* Postprocess symbols. We must do that first, since weak symbols are
-    ** defined here, which may be needed later.
-    */
-    ProcessSymbols ();
+    for (I = 0; I < CollCount (&MemoryAreas); ++I) {
+        unsigned J;
+        unsigned long Addr;
+        unsigned long Size;
+        int Overflow = 0;
 
-    /* Postprocess segments */
-    ProcessSegments ();
+        /* Get the next memory area */
+        MemoryArea* M = CollAtUnchecked (&MemoryAreas, I);
+
+        /* Check if we know where it is */
+        M->Relocatable = RelocatableBinFmt (M->F->Format);
+        if (!IsConstExpr (M->StartExpr)) {
+            continue;
+        }
+        Addr = M->Start = GetExprVal (M->StartExpr);
+        Size = IsConstExpr (M->SizeExpr)? (unsigned long) GetExprVal (M->SizeExpr) : ~0UL;
+        M->Flags |= MF_PLACED;
+
+        /* Walk through the segments in this memory area */
+        for (J = 0; J < CollCount (&M->SegList); ++J) {
+            SegDesc* S = CollAtUnchecked (&M->SegList, J);
+            if (S->Run == M) {
+                if (S->Flags & SF_ALIGN) {
+                    Addr = AlignAddr (Addr, S->RunAlignment);
+                } else if ((S->Flags & (SF_OFFSET | SF_START)) != 0 && !Overflow) {
+                    unsigned long NewAddr = S->Addr;
+                    if (S->Flags & SF_OFFSET) {
+                        NewAddr += M->Start;
+                    }
+                    if (NewAddr >= Addr) {
+                        Addr = NewAddr;
+                    }
+                }
+                S->Seg->PC = Addr;
+                S->Seg->MemArea = M;
+            } else if (S->Load == M) {
+                if (S->Flags & SF_ALIGN_LOAD) {
+                    Addr = AlignAddr (Addr, S->LoadAlignment);
+                }
+            }
+            if (Addr + SegDescSize (S, M) - M->Start > Size) {
+                Overflow = 1;
+            }
+            Addr += SegDescSize (S, M);
+        }
+    }
+}
+
+
+
+static void RelaxSegments (void)
+/* Shorten instructions where the addresses allow it. Since this moves code,
+** it's repeated until the layout doesn't change any longer.
+*/
+{
+    unsigned I;
+
+    if (!RelaxPrepare ()) {
+        return;
+    }
+
+    do {
+        LayoutSegments ();
+    } while (RelaxPass ());
+
+    /* Undo the tentative placement */
+    for (I = 0; I < CollCount (&MemoryAreas); ++I) {
+        MemoryArea* M = CollAtUnchecked (&MemoryAreas, I);
+        M->Flags &= ~MF_PLACED;
+    }
+    for (I = 0; I < CollCount (&SegDescList); ++I) {
+        SegDesc* S = CollAtUnchecked (&SegDescList, I);
+        S->Seg->MemArea = 0;
+    }
+
+    RelaxDone ();
+}
+
+
+
+static unsigned PlaceSegments (int Quiet)
+/* Assign the start addresses of the segments, check for overflows of the
+** memory areas and define the linker generated symbols. This may be done
+** more than once, diagnostics are only output if Quiet is false. Return the
+** number of memory area overflows.
+*/
+{
+    unsigned Overflows = 0;
+    unsigned I;
+
+    /* Reset the state of an earlier pass */
+    for (I = 0; I < CollCount (&FileList); ++I) {
+        File* F = CollAtUnchecked (&FileList, I);
+        F->Size = 0;
+    }
+    for (I = 0; I < CollCount (&MemoryAreas); ++I) {
+        MemoryArea* M = CollAtUnchecked (&MemoryAreas, I);
+        M->FillLevel = 0;
+        M->Flags &= ~MF_OVERFLOW;
+    }
+    for (I = 0; I < CollCount (&SegDescList); ++I) {
+        SegDesc* S = CollAtUnchecked (&SegDescList, I);
+        S->Flags &= ~(SF_RUN_DEF | SF_LOAD_DEF);
+    }
 
     /* Walk through each of the memory sections. Add up the sizes; and, check
     ** for an overflow of the section. Assign the start addresses of the
@@ -1821,13 +2014,11 @@ unsigned CfgProcess (void)
         ** may reference this symbol.
         */
         if (M->Flags & MF_DEFINE) {
-            Export* E;
             StrBuf Buf = STATIC_STRBUF_INITIALIZER;
 
             /* Define the start of the memory area */
             SB_Printf (&Buf, "__%s_START__", GetString (M->Name));
-            E = CreateMemoryExport (GetStrBufId (&Buf), M, 0);
-            CollAppend (&E->DefLines, M->LI);
+            DefineMemoryExport (GetStrBufId (&Buf), M, 0, M->LI);
 
             SB_Done (&Buf);
         }
@@ -1859,7 +2050,7 @@ unsigned CfgProcess (void)
                 /* Check if the alignment for the segment from the linker
                 ** config. is a multiple for that of the segment.
                 */
-                if ((S->RunAlignment % S->Seg->Alignment) != 0) {
+                if ((S->RunAlignment % S->Seg->Alignment) != 0 && !Quiet) {
                     /* Segment requires another alignment than configured
                     ** in the linker.
                     */
@@ -1877,7 +2068,7 @@ unsigned CfgProcess (void)
                     ** fill bytes for the alignment, emit a warning, since
                     ** that is somewhat suspicious.
                     */
-                    if (M->FillLevel == 0 && NewAddr > Addr) {
+                    if (M->FillLevel == 0 && NewAddr > Addr && !Quiet) {
                         CfgWarning (GetSourcePos (S->LI),
                                     "The first segment in memory area `%s' "
                                     "needs fill bytes for alignment.",
@@ -1899,12 +2090,12 @@ unsigned CfgProcess (void)
                     if (NewAddr < Addr) {
                         /* Offset already too large */
                         ++Overflows;
-                        if (S->Flags & SF_OFFSET) {
+                        if (!Quiet && (S->Flags & SF_OFFSET) != 0) {
                             CfgWarning (GetSourcePos (S->LI),
                                         "Segment `%s' offset is too small in `%s' by %lu byte%c",
                                         GetString (S->Name), GetString (M->Name),
                                         Addr - NewAddr, (Addr - NewAddr == 1) ? ' ' : 's');
-                        } else {
+                        } else if (!Quiet) {
                             CfgWarning (GetSourcePos (S->LI),
                                         "Segment `%s' start address is too low in `%s' by %lu byte%c",
                                         GetString (S->Name), GetString (M->Name),
@@ -1947,14 +2138,16 @@ unsigned CfgProcess (void)
             /* Increment the fill level of the memory area; and, check for an
             ** overflow.
             */
-            M->FillLevel = Addr + S->Seg->Size - M->Start;
+            M->FillLevel = Addr + SegDescSize (S, M) - M->Start;
             if (M->FillLevel > M->Size && (M->Flags & MF_OVERFLOW) == 0) {
                 ++Overflows;
                 M->Flags |= MF_OVERFLOW;
-                CfgWarning (GetSourcePos (M->LI),
-                            "Segment `%s' overflows memory area `%s' by %lu byte%c",
-                            GetString (S->Name), GetString (M->Name),
-                            M->FillLevel - M->Size, (M->FillLevel - M->Size == 1) ? ' ' : 's');
+                if (!Quiet) {
+                    CfgWarning (GetSourcePos (M->LI),
+                                "Segment `%s' overflows memory area `%s' by %lu byte%c",
+                                GetString (S->Name), GetString (M->Name),
+                                M->FillLevel - M->Size, (M->FillLevel - M->Size == 1) ? ' ' : 's');
+                }
             }
 
             /* If requested, define symbols for the start and size of the
@@ -1970,7 +2163,7 @@ unsigned CfgProcess (void)
             }
 
             /* Calculate the new address */
-            Addr += S->Seg->Size;
+            Addr += SegDescSize (S, M);
 
             /* If this segment will go out to the file, or its place
             ** in the file will be filled, then increase the file size.
@@ -1985,26 +2178,22 @@ unsigned CfgProcess (void)
         ** memory area
         */
         if (M->Flags & MF_DEFINE) {
-            Export* E;
             StrBuf Buf = STATIC_STRBUF_INITIALIZER;
 
             /* Define the size of the memory area */
             SB_Printf (&Buf, "__%s_SIZE__", GetString (M->Name));
-            E = CreateConstExport (GetStrBufId (&Buf), M->Size);
-            CollAppend (&E->DefLines, M->LI);
+            DefineConstExport (GetStrBufId (&Buf), M->Size, M->LI);
 
             /* Define the fill level of the memory area */
             SB_Printf (&Buf, "__%s_LAST__", GetString (M->Name));
-            E = CreateMemoryExport (GetStrBufId (&Buf), M, M->FillLevel);
-            CollAppend (&E->DefLines, M->LI);
+            DefineMemoryExport (GetStrBufId (&Buf), M, M->FillLevel, M->LI);
 
             /* Define the file offset of the memory area. This isn't of much
             ** use for relocatable output files.
             */
             if (!M->Relocatable) {
                 SB_Printf (&Buf, "__%s_FILEOFFS__", GetString (M->Name));
-                E = CreateConstExport (GetStrBufId (&Buf), M->FileOffs);
-                CollAppend (&E->DefLines, M->LI);
+                DefineConstExport (GetStrBufId (&Buf), M->FileOffs, M->LI);
             }
 
             /* Throw away the string buffer */
@@ -2019,12 +2208,122 @@ unsigned CfgProcess (void)
         }
     }
 
+    /* Remember that the symbols are defined now */
+    ++PlacePasses;
+
     /* Return the number of memory area overflows */
     return Overflows;
 }
 
 
 
+
+
+
+static int PackSegments (void)
+/* Compress the segments with the COMPRESS attribute using the current
+** placement, and remember the compressed data and its size. Return true if
+** any of the sizes changed, so the segments must be placed again.
+*/
+{
+    unsigned I;
+    int Changed = 0;
+
+    /* The data cannot be determined if there are unresolved symbols. This
+    ** is reported later when writing the output file.
+    */
+    if (HaveUnresolvedImports ()) {
+        return 0;
+    }
+
+    for (I = 0; I < CollCount (&SegDescList); ++I) {
+
+        StrBuf Data = AUTO_STRBUF_INITIALIZER;
+        unsigned long Size;
+
+        SegDesc* S = CollAtUnchecked (&SegDescList, I);
+        if ((S->Flags & SF_COMPRESS) == 0) {
+            continue;
+        }
+        if (S->Load->Relocatable) {
+            CfgError (GetSourcePos (S->LI),
+                      "Compressed segment `%s' needs the binary output format",
+                      GetString (S->Name));
+        }
+
+        /* Compress the segment data. The block is kept for the output file,
+        ** since the last pass has the final placement.
+        */
+        SegGetData (&Data, S->Seg);
+        SB_Clear (&S->Packed);
+        LZ4Compress (&S->Packed, (const unsigned char*) SB_GetConstBuf (&Data),
+                     SB_GetLen (&Data));
+        Size = SB_GetLen (&S->Packed);
+        SB_Done (&Data);
+
+        /* Use the new size. After a few passes, the size may only grow, and
+        ** smaller data is padded when written. This makes sure that the
+        ** placement doesn't change forever.
+        */
+        if (Size > S->LoadSize ||
+            (Size < S->LoadSize && PlacePasses <= MAX_SHRINK_PASSES)) {
+            S->LoadSize = Size;
+            Changed = 1;
+        }
+    }
+
+    return Changed;
+}
+
+
+
+unsigned CfgProcess (void)
+/* Process the config file, after reading in object files and libraries. This
+** includes postprocessing of the config file data; but also assigning segments,
+** and defining segment/memory-area related symbols. The function will return
+** the number of memory area overflows (so, zero means everything went OK).
+** In case of overflows, a short mapfile can be generated later, to ease the
+** user's task of re-arranging segments.
+*/
+{
+    unsigned I;
+
+    /* Postprocess symbols. We must do that first, since weak symbols are
+    ** defined here, which may be needed later.
+    */
+    ProcessSymbols ();
+
+    /* Remove sections that are never referenced if requested */
+    if (GCSections) {
+        GCCollect ();
+    }
+
+    /* Postprocess segments */
+    ProcessSegments ();
+
+    /* Shorten instructions now that the segments are known */
+    RelaxSegments ();
+
+    /* The size of a compressed segment in its load area depends on its
+    ** contents, which depend on the addresses of the segments. So place the
+    ** segments until the sizes don't change any longer.
+    */
+    for (I = 0; I < CollCount (&SegDescList); ++I) {
+        SegDesc* S = CollAtUnchecked (&SegDescList, I);
+        if (S->Flags & SF_COMPRESS) {
+            do {
+                PlaceSegments (1);
+            } while (PackSegments ());
+            break;
+        }
+    }
+
+    /* Place the segments for real */
+    return PlaceSegments (0);
+}
+
+
+
 void CfgWriteTarget (void)
 /* Write the target file(s) */
 {
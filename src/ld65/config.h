@@ -41,6 +41,7 @@
 /* common */
 #include "coll.h"
 #include "filepos.h"
+#include "strbuf.h"
 
 /* ld65 */
 #include "lineinfo.h"
@@ -81,6 +82,8 @@ struct SegDesc {
     unsigned long       Addr;           /* Start address or offset into segment */
     unsigned long       RunAlignment;   /* Run area alignment if given */
     unsigned long       LoadAlignment;  /* Load area alignment if given */
+    unsigned long       LoadSize;       /* Size in load area if compressed */
+    StrBuf              Packed;         /* Compressed data of last placement */
 };
 
 /* Segment flags */
@@ -96,6 +99,7 @@ struct SegDesc {
 #define SF_RUN_DEF      0x0200          /* RUN symbols already defined */
 #define SF_LOAD_DEF     0x0400          /* LOAD symbols already defined */
 #define SF_FILLVAL      0x0800          /* Segment has separate fill value */
+#define SF_COMPRESS     0x1000          /* Compressed in the load area */
 
 
 
@@ -117,6 +121,11 @@ unsigned CfgProcess (void);
 ** task of rearranging segments for the user.
 */
 
+unsigned long SegDescSize (const SegDesc* S, const struct MemoryArea* M);
+/* Return the size of a segment in the given memory area. This is the size
+** of the compressed data in the load area of a compressed segment.
+*/
+
 void CfgWriteTarget (void);
 /* Write the target file(s) */
 
@@ -34,14 +34,22 @@
 
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <errno.h>
 
+/* common */
+#include "check.h"
+#include "dbgdefs.h"
+#include "strbuf.h"
+#include "xmalloc.h"
+
 /* ld65 */
 #include "dbgfile.h"
 #include "dbgsyms.h"
 #include "error.h"
 #include "fileinfo.h"
+#include "fileio.h"
 #include "global.h"
 #include "library.h"
 #include "lineinfo.h"
@@ -52,6 +60,233 @@
 
 
 
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Size of the records of the item kinds in a binary debug info file */
+static const unsigned RecSize[DBG_KIND_COUNT] = {
+    DBG_CSYM_RECSIZE,
+    DBG_FILE_RECSIZE,
+    DBG_LIB_RECSIZE,
+    DBG_LINE_RECSIZE,
+    DBG_MOD_RECSIZE,
+    DBG_SCOPE_RECSIZE,
+    DBG_SEG_RECSIZE,
+    DBG_SPAN_RECSIZE,
+    DBG_SYM_RECSIZE,
+    DBG_TYPE_RECSIZE,
+};
+
+/* The tables of a binary debug info file */
+typedef struct DbgBinTable DbgBinTable;
+struct DbgBinTable {
+    unsigned            Count;          /* Number of items */
+    unsigned long*      Data;           /* Records of all items */
+};
+static DbgBinTable Tables[DBG_KIND_COUNT];
+
+/* The pools of a binary debug info file */
+static unsigned long*   ListPool   = 0;
+static unsigned         ListCount  = 0;
+static unsigned         ListSize   = 0;
+static StrBuf           BinStrPool = STATIC_STRBUF_INITIALIZER;
+
+/* Data used while sorting the indexes */
+static unsigned         SortKind;       /* Item kind */
+static unsigned         SortField;      /* Field with the name */
+
+
+
+/*****************************************************************************/
+/*                              Binary debug info                            */
+/*****************************************************************************/
+
+
+
+static const unsigned long* GetRecord (unsigned Kind, unsigned long Id)
+/* Return the record for the given item */
+{
+    return Tables[Kind].Data + Id * RecSize[Kind];
+}
+
+
+
+static const char* GetName (unsigned Kind, unsigned Field, unsigned long Id)
+/* Return the name stored in a field of the given item */
+{
+    return SB_GetConstBuf (&BinStrPool) + GetRecord (Kind, Id)[Field];
+}
+
+
+
+static long SignExtend (unsigned long Val)
+/* Sign extend a 32 bit value stored in the debug info */
+{
+    Val &= 0xFFFFFFFFUL;
+    if (Val & 0x80000000UL) {
+        return -(long) (0xFFFFFFFFUL - Val) - 1;
+    }
+    return (long) Val;
+}
+
+
+
+static int CompareIds (unsigned long L, unsigned long R)
+/* Compare two ids. Used to resolve ties, so the sort order is well defined */
+{
+    return (L < R)? -1 : (L > R);
+}
+
+
+
+static int CompareByName (const void* L, const void* R)
+/* Compare function for qsort, sorts items by name */
+{
+    unsigned long Left  = *(const unsigned long*) L;
+    unsigned long Right = *(const unsigned long*) R;
+    int Res = strcmp (GetName (SortKind, SortField, Left),
+                      GetName (SortKind, SortField, Right));
+    return (Res != 0)? Res : CompareIds (Left, Right);
+}
+
+
+
+static int CompareFileByName (const void* L, const void* R)
+/* Compare function for qsort, sorts files by name, modification time and size */
+{
+    unsigned long Left  = *(const unsigned long*) L;
+    unsigned long Right = *(const unsigned long*) R;
+    const unsigned long* LFile = GetRecord (DBG_KIND_FILE, Left);
+    const unsigned long* RFile = GetRecord (DBG_KIND_FILE, Right);
+    int Res = strcmp (GetName (DBG_KIND_FILE, DBG_FILE_NAME, Left),
+                      GetName (DBG_KIND_FILE, DBG_FILE_NAME, Right));
+    if (Res != 0) {
+        return Res;
+    } else if (LFile[DBG_FILE_MTIME] != RFile[DBG_FILE_MTIME]) {
+        return (LFile[DBG_FILE_MTIME] < RFile[DBG_FILE_MTIME])? -1 : 1;
+    } else if (LFile[DBG_FILE_SIZE] != RFile[DBG_FILE_SIZE]) {
+        return (LFile[DBG_FILE_SIZE] < RFile[DBG_FILE_SIZE])? -1 : 1;
+    }
+    return CompareIds (Left, Right);
+}
+
+
+
+static int CompareSymByVal (const void* L, const void* R)
+/* Compare function for qsort, sorts symbols by value, then by name */
+{
+    unsigned long Left  = *(const unsigned long*) L;
+    unsigned long Right = *(const unsigned long*) R;
+    long LVal = SignExtend (GetRecord (DBG_KIND_SYM, Left)[DBG_SYM_VALUE]);
+    long RVal = SignExtend (GetRecord (DBG_KIND_SYM, Right)[DBG_SYM_VALUE]);
+    if (LVal != RVal) {
+        return (LVal < RVal)? -1 : 1;
+    }
+    return CompareByName (L, R);
+}
+
+
+
+static void GetSpanAddr (unsigned long Id, unsigned long* Start, unsigned long* End)
+/* Get the absolute start and end address of a span */
+{
+    const unsigned long* Span = GetRecord (DBG_KIND_SPAN, Id);
+    const unsigned long* Seg  = GetRecord (DBG_KIND_SEG, Span[DBG_SPAN_SEG]);
+    *Start = (Seg[DBG_SEG_START] + Span[DBG_SPAN_START]) & 0xFFFFFFFFUL;
+    *End   = (*Start + Span[DBG_SPAN_SIZE] - 1) & 0xFFFFFFFFUL;
+}
+
+
+
+static int CompareSpanByAddr (const void* L, const void* R)
+/* Compare function for qsort, sorts spans by start, then by end address */
+{
+    unsigned long Left  = *(const unsigned long*) L;
+    unsigned long Right = *(const unsigned long*) R;
+    unsigned long LStart, LEnd, RStart, REnd;
+    GetSpanAddr (Left, &LStart, &LEnd);
+    GetSpanAddr (Right, &RStart, &REnd);
+    if (LStart != RStart) {
+        return (LStart < RStart)? -1 : 1;
+    } else if (LEnd != REnd) {
+        return (LEnd < REnd)? -1 : 1;
+    }
+    return CompareIds (Left, Right);
+}
+
+
+
+static void WriteIndex (FILE* F, unsigned Kind, unsigned Field,
+                        int (*Compare) (const void*, const void*))
+/* Sort the items of a kind and write the ids in sort order */
+{
+    unsigned       Count = Tables[Kind].Count;
+    unsigned long* Ids   = xmalloc ((Count + 1) * sizeof (Ids[0]));
+    unsigned       I;
+
+    for (I = 0; I < Count; ++I) {
+        Ids[I] = I;
+    }
+    SortKind  = Kind;
+    SortField = Field;
+    qsort (Ids, Count, sizeof (Ids[0]), Compare);
+
+    for (I = 0; I < Count; ++I) {
+        Write32 (F, Ids[I]);
+    }
+    xfree (Ids);
+}
+
+
+
+unsigned long* DbgBinRecord (unsigned Kind, unsigned Id)
+/* Return the record for the item with the given kind and id in a binary
+** debug info file. The record must be filled completely by the caller.
+*/
+{
+    CHECK (Kind < DBG_KIND_COUNT && Id < Tables[Kind].Count);
+    return Tables[Kind].Data + Id * RecSize[Kind];
+}
+
+
+
+unsigned long DbgBinStr (const char* S)
+/* Add a string to the string pool of a binary debug info file and return
+** its offset.
+*/
+{
+    unsigned long Offs = SB_GetLen (&BinStrPool);
+    SB_AppendBuf (&BinStrPool, S, strlen (S) + 1);
+    return Offs;
+}
+
+
+
+unsigned long DbgBinListPos (void)
+/* Return the position of the next id added to the list pool of a binary
+** debug info file.
+*/
+{
+    return ListCount;
+}
+
+
+
+void DbgBinListAdd (unsigned long Id)
+/* Add an id to the list pool of a binary debug info file */
+{
+    if (ListCount >= ListSize) {
+        ListSize = (ListSize == 0)? 1024 : ListSize * 2;
+        ListPool = xrealloc (ListPool, ListSize * sizeof (ListPool[0]));
+    }
+    ListPool[ListCount++] = Id;
+}
+
+
+
 /*****************************************************************************/
 /*                                   Code                                    */
 /*****************************************************************************/
@@ -101,9 +336,117 @@ static void AssignIds (void)
 
 
 
+static void CreateBinDbgFile (void)
+/* Create a binary debug info file */
+{
+    FILE*    F;
+    unsigned I, J;
+
+    /* Assign the ids to the items. This will also remove unused file infos,
+    ** so it must be done before counting.
+    */
+    AssignIds ();
+
+    /* Allocate the tables */
+    Tables[DBG_KIND_CSYM].Count  = HLLDbgSymCount ();
+    Tables[DBG_KIND_FILE].Count  = FileInfoCount ();
+    Tables[DBG_KIND_LIB].Count   = LibraryCount ();
+    Tables[DBG_KIND_LINE].Count  = LineInfoCount ();
+    Tables[DBG_KIND_MOD].Count   = ObjDataCount ();
+    Tables[DBG_KIND_SCOPE].Count = ScopeCount ();
+    Tables[DBG_KIND_SEG].Count   = SegmentCount ();
+    Tables[DBG_KIND_SPAN].Count  = SpanCount ();
+    Tables[DBG_KIND_SYM].Count   = DbgSymCount ();
+    Tables[DBG_KIND_TYPE].Count  = TypeCount ();
+    for (I = 0; I < DBG_KIND_COUNT; ++I) {
+        unsigned Size = Tables[I].Count * RecSize[I];
+        Tables[I].Data = xmalloc ((Size + 1) * sizeof (Tables[I].Data[0]));
+    }
+
+    /* Collect the items */
+    CollectHLLDbgSyms ();
+    CollectDbgFileInfo ();
+    CollectDbgLibraries ();
+    CollectDbgLineInfo ();
+    CollectDbgModules ();
+    CollectDbgScopes ();
+    CollectDbgSegments ();
+    CollectDbgSpans ();
+    CollectDbgSyms ();
+    CollectDbgTypes ();
+
+    /* Open the debug info file */
+    F = fopen (DbgFileName, "wb");
+    if (F == 0) {
+        Error ("Cannot create debug file `%s': %s", DbgFileName, strerror (errno));
+    }
+
+    /* The file consists of 32 bit words, so pad the string pool with
+    ** terminators to a multiple of four bytes.
+    */
+    while ((SB_GetLen (&BinStrPool) % 4) != 0) {
+        SB_AppendChar (&BinStrPool, '\0');
+    }
+
+    /* Write the header */
+    Write32 (F, DBG_MAGIC);
+    Write32 (F, DBG_VER_MAJOR);
+    Write32 (F, DBG_VER_MINOR);
+    for (I = 0; I < DBG_KIND_COUNT; ++I) {
+        Write32 (F, Tables[I].Count);
+    }
+    Write32 (F, ListCount);
+    Write32 (F, SB_GetLen (&BinStrPool));
+
+    /* Write the item tables */
+    for (I = 0; I < DBG_KIND_COUNT; ++I) {
+        unsigned Size = Tables[I].Count * RecSize[I];
+        for (J = 0; J < Size; ++J) {
+            Write32 (F, Tables[I].Data[J]);
+        }
+    }
+
+    /* Write the indexes, so the debug info doesn't have to be sorted when
+    ** it is loaded.
+    */
+    WriteIndex (F, DBG_KIND_FILE, DBG_FILE_NAME, CompareFileByName);
+    WriteIndex (F, DBG_KIND_MOD, DBG_MOD_NAME, CompareByName);
+    WriteIndex (F, DBG_KIND_SCOPE, DBG_SCOPE_NAME, CompareByName);
+    WriteIndex (F, DBG_KIND_SEG, DBG_SEG_NAME, CompareByName);
+    WriteIndex (F, DBG_KIND_SPAN, 0, CompareSpanByAddr);
+    WriteIndex (F, DBG_KIND_SYM, DBG_SYM_NAME, CompareByName);
+    WriteIndex (F, DBG_KIND_SYM, DBG_SYM_NAME, CompareSymByVal);
+
+    /* Write the pools */
+    for (I = 0; I < ListCount; ++I) {
+        Write32 (F, ListPool[I]);
+    }
+    WriteData (F, SB_GetConstBuf (&BinStrPool), SB_GetLen (&BinStrPool));
+
+    /* Close the file */
+    if (fclose (F) != 0) {
+        Error ("Error closing debug file `%s': %s", DbgFileName, strerror (errno));
+    }
+
+    /* Free the memory */
+    for (I = 0; I < DBG_KIND_COUNT; ++I) {
+        xfree (Tables[I].Data);
+    }
+    xfree (ListPool);
+    SB_Done (&BinStrPool);
+}
+
+
+
 void CreateDbgFile (void)
 /* Create a debug info file */
 {
+    /* Create a binary file if requested */
+    if (BinDbgFile) {
+        CreateBinDbgFile ();
+        return;
+    }
+
     /* Open the debug info file */
     FILE* F = fopen (DbgFileName, "w");
     if (F == 0) {
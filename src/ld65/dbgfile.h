@@ -47,6 +47,24 @@
 void CreateDbgFile (void);
 /* Create a debug info file */
 
+unsigned long* DbgBinRecord (unsigned Kind, unsigned Id);
+/* Return the record for the item with the given kind and id in a binary
+** debug info file. The record must be filled completely by the caller.
+*/
+
+unsigned long DbgBinStr (const char* S);
+/* Add a string to the string pool of a binary debug info file and return
+** its offset.
+*/
+
+unsigned long DbgBinListPos (void);
+/* Return the position of the next id added to the list pool of a binary
+** debug info file.
+*/
+
+void DbgBinListAdd (unsigned long Id);
+/* Add an id to the list pool of a binary debug info file */
+
 
 
 /* End of dbgfile.h */
@@ -39,16 +39,19 @@
 #include "addrsize.h"
 #include "attrib.h"
 #include "check.h"
+#include "dbgdefs.h"
 #include "hlldbgsym.h"
 #include "symdefs.h"
 #include "xmalloc.h"
 
 /* ld65 */
+#include "dbgfile.h"
 #include "dbgsyms.h"
 #include "error.h"
 #include "exports.h"
 #include "expr.h"
 #include "fileio.h"
+#include "gc.h"
 #include "global.h"
 #include "lineinfo.h"
 #include "objdata.h"
@@ -285,6 +288,14 @@ static void ClearDbgSymTable (void)
 
 
 
+ExprNode* GetDbgSymExpr (const DbgSym* D)
+/* Return the expression of a debug symbol or NULL if it has none */
+{
+    return D->Expr;
+}
+
+
+
 static long GetDbgSymVal (const DbgSym* D)
 /* Get the value of this symbol */
 {
@@ -310,6 +321,21 @@ static void PrintLineInfo (FILE* F, const Collection* LineInfos, const char* For
 
 
 
+static void CollectLineInfo (unsigned long* Rec, unsigned Field,
+                             const Collection* LineInfos)
+/* Add a list of line infos to a binary debug file */
+{
+    unsigned I;
+    Rec[Field]   = DbgBinListPos ();
+    Rec[Field+1] = CollCount (LineInfos);
+    for (I = 0; I < CollCount (LineInfos); ++I) {
+        const LineInfo* LI = CollConstAt (LineInfos, I);
+        DbgBinListAdd (LI->Id);
+    }
+}
+
+
+
 unsigned DbgSymCount (void)
 /* Return the total number of debug symbols */
 {
@@ -412,6 +438,11 @@ void PrintDbgSyms (FILE* F)
                     fprintf (F, ",exp=%u", Exp->Obj->SymBaseId + Exp->DbgSymId);
                 }
 
+            } else if (GCIsRemoved (S->Expr)) {
+
+                /* The symbol was in a removed section, so it has no value */
+                fprintf (F, ",type=%s", SYM_IS_LABEL (S->Type)? "lab" : "equ");
+
             } else {
 
                 SegExprDesc D;
@@ -442,6 +473,78 @@ void PrintDbgSyms (FILE* F)
 
 
 
+void CollectDbgSyms (void)
+/* Add the debug symbols to a binary debug file */
+{
+    unsigned I, J;
+
+    for (I = 0; I < CollCount (&ObjDataList); ++I) {
+
+        /* Get the object file */
+        ObjData* O = CollAtUnchecked (&ObjDataList, I);
+
+        /* Walk through all debug symbols in this module */
+        for (J = 0; J < CollCount (&O->DbgSyms); ++J) {
+
+            /* Get the next debug symbol and its record */
+            const DbgSym*  S   = CollConstAt (&O->DbgSyms, J);
+            unsigned long* Rec = DbgBinRecord (DBG_KIND_SYM, O->SymBaseId + J);
+
+            Rec[DBG_SYM_NAME]   = DbgBinStr (GetString (S->Name));
+            Rec[DBG_SYM_SIZE]   = S->Size;
+            Rec[DBG_SYM_EXP]    = DBG_INV_ID;
+            Rec[DBG_SYM_SEG]    = DBG_INV_ID;
+            Rec[DBG_SYM_VALUE]  = 0;
+
+            /* Cheap local symbols have an owner symbol, others a scope */
+            if (SYM_IS_STD (S->Type)) {
+                Rec[DBG_SYM_SCOPE]  = O->ScopeBaseId + S->OwnerId;
+                Rec[DBG_SYM_PARENT] = DBG_INV_ID;
+            } else {
+                Rec[DBG_SYM_SCOPE]  = DBG_INV_ID;
+                Rec[DBG_SYM_PARENT] = O->SymBaseId + S->OwnerId;
+            }
+
+            /* Line infos */
+            CollectLineInfo (Rec, DBG_SYM_DEFS, &S->DefLines);
+            CollectLineInfo (Rec, DBG_SYM_REFS, &S->RefLines);
+
+            /* Imports have the id of the matching export, other symbols a
+            ** value and maybe a segment.
+            */
+            if (SYM_IS_IMPORT (S->Type)) {
+
+                /* Get the export from the import */
+                const Import* Imp = GetObjImport (O, S->ImportId);
+                const Export* Exp = Imp->Exp;
+
+                Rec[DBG_SYM_TYPE] = DBG_SYM_IMPORT;
+                if (Exp->Obj && OBJ_HAS_DBGINFO (Exp->Obj->Header.Flags)) {
+                    Rec[DBG_SYM_EXP] = Exp->Obj->SymBaseId + Exp->DbgSymId;
+                }
+
+            } else if (GCIsRemoved (S->Expr)) {
+
+                /* The symbol was in a removed section, so it has no value */
+                Rec[DBG_SYM_TYPE]  = SYM_IS_LABEL (S->Type)? DBG_SYM_LABEL : DBG_SYM_EQUATE;
+
+            } else {
+
+                SegExprDesc D;
+
+                Rec[DBG_SYM_TYPE]  = SYM_IS_LABEL (S->Type)? DBG_SYM_LABEL : DBG_SYM_EQUATE;
+                Rec[DBG_SYM_VALUE] = (unsigned long) GetDbgSymVal (S) & 0xFFFFFFFFUL;
+                GetSegExprVal (S->Expr, &D);
+                if (!D.TooComplex && D.Seg != 0) {
+                    Rec[DBG_SYM_SEG] = D.Seg->Id;
+                }
+            }
+        }
+    }
+}
+
+
+
 void PrintHLLDbgSyms (FILE* F)
 /* Print the high level language debug symbols in a debug file */
 {
@@ -495,6 +598,48 @@ void PrintHLLDbgSyms (FILE* F)
 
 
 
+void CollectHLLDbgSyms (void)
+/* Add the high level language debug symbols to a binary debug file */
+{
+    unsigned I, J;
+
+    for (I = 0; I < CollCount (&ObjDataList); ++I) {
+
+        /* Get the object file */
+        ObjData* O = CollAtUnchecked (&ObjDataList, I);
+
+        /* Walk through all hll debug symbols in this module */
+        for (J = 0; J < CollCount (&O->HLLDbgSyms); ++J) {
+
+            /* Get the next debug symbol and its record */
+            const HLLDbgSym* S   = CollConstAt (&O->HLLDbgSyms, J);
+            unsigned long*   Rec = DbgBinRecord (DBG_KIND_CSYM, O->HLLSymBaseId + J);
+
+            Rec[DBG_CSYM_NAME]  = DbgBinStr (GetString (S->Name));
+            Rec[DBG_CSYM_SCOPE] = O->ScopeBaseId + S->ScopeId;
+            Rec[DBG_CSYM_TYPE]  = S->Type;
+            Rec[DBG_CSYM_OFFS]  = (unsigned long) S->Offs & 0xFFFFFFFFUL;
+            switch (HLL_GET_SC (S->Flags)) {
+                case HLL_SC_AUTO:       Rec[DBG_CSYM_SC] = DBG_SC_AUTO;         break;
+                case HLL_SC_REG:        Rec[DBG_CSYM_SC] = DBG_SC_REG;          break;
+                case HLL_SC_STATIC:     Rec[DBG_CSYM_SC] = DBG_SC_STATIC;       break;
+                case HLL_SC_EXTERN:     Rec[DBG_CSYM_SC] = DBG_SC_EXTERN;       break;
+                default:
+                    Error ("Invalid storage class %u for hll symbol",
+                           HLL_GET_SC (S->Flags));
+                    break;
+            }
+            if (HLL_HAS_SYM (S->Flags)) {
+                Rec[DBG_CSYM_SYM] = O->SymBaseId + S->Sym->Id;
+            } else {
+                Rec[DBG_CSYM_SYM] = DBG_INV_ID;
+            }
+        }
+    }
+}
+
+
+
 void PrintDbgSymLabels (FILE* F)
 /* Print the debug symbols in a VICE label file */
 {
@@ -517,8 +662,11 @@ void PrintDbgSymLabels (FILE* F)
             /* Get the next debug symbol */
             DbgSym* D = CollAt (&O->DbgSyms, J);
 
-            /* Emit this symbol only if it is a label (ignore equates and imports) */
-            if (SYM_IS_EQUATE (D->Type) || SYM_IS_IMPORT (D->Type)) {
+            /* Emit this symbol only if it is a label (ignore equates and
+            ** imports) and still exists
+            */
+            if (SYM_IS_EQUATE (D->Type) || SYM_IS_IMPORT (D->Type) ||
+                GCIsRemoved (D->Expr)) {
                 continue;
             }
 
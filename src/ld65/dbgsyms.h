@@ -79,6 +79,12 @@ struct HLLDbgSym* ReadHLLDbgSym (FILE* F, ObjData* Obj, unsigned Id);
 void PrintDbgSyms (FILE* F);
 /* Print the debug symbols in a debug file */
 
+void CollectDbgSyms (void);
+/* Add the debug symbols to a binary debug file */
+
+ExprNode* GetDbgSymExpr (const DbgSym* D);
+/* Return the expression of a debug symbol or NULL if it has none */
+
 unsigned DbgSymCount (void);
 /* Return the total number of debug symbols */
 
@@ -88,6 +94,9 @@ unsigned HLLDbgSymCount (void);
 void PrintHLLDbgSyms (FILE* F);
 /* Print the high level language debug symbols in a debug file */
 
+void CollectHLLDbgSyms (void);
+/* Add the high level language debug symbols to a binary debug file */
+
 void PrintDbgSymLabels (FILE* F);
 /* Print the debug symbols in a VICE label file */
 
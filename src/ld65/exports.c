@@ -51,6 +51,7 @@
 #include "exports.h"
 #include "expr.h"
 #include "fileio.h"
+#include "gc.h"
 #include "global.h"
 #include "lineinfo.h"
 #include "memarea.h"
@@ -839,6 +840,14 @@ void CheckExports (void)
 
 
 
+int HaveUnresolvedImports (void)
+/* Return true if there are imports without a matching export */
+{
+    return ImpOpen != 0;
+}
+
+
+
 void CheckUnresolvedImports (ExpCheckFunc F, void* Data)
 /* Check if there are any unresolved imports. On unresolved imports, F is
 ** called (see the comments on ExpCheckFunc in the data section).
@@ -881,8 +890,11 @@ void PrintExportMapByName (FILE* F)
     for (I = 0; I < ExpCount; ++I) {
         const Export* E = ExpPool [I];
 
-        /* Print unreferenced symbols only if explictly requested */
-        if (VerboseMap || E->ImpCount > 0 || SYM_IS_CONDES (E->Type)) {
+        /* Print unreferenced symbols only if explictly requested. Skip
+        ** symbols in removed sections, since they don't have an address.
+        */
+        if ((VerboseMap || E->ImpCount > 0 || SYM_IS_CONDES (E->Type)) &&
+            !GCIsRemoved (E->Expr)) {
             fprintf (F,
                      "%-25s %06lX %c%c%c%c   ",
                      GetString (E->Name),
@@ -935,8 +947,11 @@ void PrintExportMapByValue (FILE* F)
     for (I = 0; I < ExpCount; ++I) {
         const Export* E = ExpPool [ExpValXlat [I]];
 
-        /* Print unreferenced symbols only if explictly requested */
-        if (VerboseMap || E->ImpCount > 0 || SYM_IS_CONDES (E->Type)) {
+        /* Print unreferenced symbols only if explictly requested. Skip
+        ** symbols in removed sections, since they don't have an address.
+        */
+        if ((VerboseMap || E->ImpCount > 0 || SYM_IS_CONDES (E->Type)) &&
+            !GCIsRemoved (E->Expr)) {
             fprintf (F,
                      "%-25s %06lX %c%c%c%c   ",
                      GetString (E->Name),
@@ -970,9 +985,9 @@ void PrintImportMap (FILE* F)
         const Export* Exp = ExpPool [I];
 
         /* Print the symbol only if there are imports, or if a verbose map
-        ** file is requested.
+        ** file is requested. Skip symbols in removed sections.
         */
-        if (VerboseMap || Exp->ImpCount > 0) {
+        if ((VerboseMap || Exp->ImpCount > 0) && !GCIsRemoved (Exp->Expr)) {
 
             /* Print the export */
             fprintf (F,
@@ -1019,7 +1034,9 @@ void PrintExportLabels (FILE* F)
     /* Print all exports */
     for (I = 0; I < ExpCount; ++I) {
         const Export* E = ExpPool [I];
-        fprintf (F, "al %06lX .%s\n", GetExportVal (E), GetString (E->Name));
+        if (!GCIsRemoved (E->Expr)) {
+            fprintf (F, "al %06lX .%s\n", GetExportVal (E), GetString (E->Name));
+        }
     }
 }
 
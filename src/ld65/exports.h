@@ -181,6 +181,9 @@ void CheckExports (void);
 ** mismatches.
 */
 
+int HaveUnresolvedImports (void);
+/* Return true if there are imports without a matching export */
+
 void CheckUnresolvedImports (ExpCheckFunc F, void* Data);
 /* Check if there are any unresolved imports. On unresolved imports, F is
 ** called (see the comments on ExpCheckFunc in the data section).
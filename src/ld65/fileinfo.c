@@ -35,9 +35,11 @@
 
 /* common */
 #include "coll.h"
+#include "dbgdefs.h"
 #include "xmalloc.h"
 
 /* ld65 */
+#include "dbgfile.h"
 #include "fileio.h"
 #include "fileinfo.h"
 #include "objdata.h"
@@ -261,3 +263,31 @@ void PrintDbgFileInfo (FILE* F)
         fputc ('\n', F);
     }
 }
+
+
+
+void CollectDbgFileInfo (void)
+/* Add the file info to a binary debug info file */
+{
+    unsigned I, J;
+
+    for (I = 0; I < CollCount (&FileInfos); ++I) {
+
+        /* Get the file info and its record */
+        const FileInfo* FI  = CollAtUnchecked (&FileInfos, I);
+        unsigned long*  Rec = DbgBinRecord (DBG_KIND_FILE, FI->Id);
+
+        /* Base info */
+        Rec[DBG_FILE_NAME]  = DbgBinStr (GetString (FI->Name));
+        Rec[DBG_FILE_SIZE]  = FI->Size;
+        Rec[DBG_FILE_MTIME] = FI->MTime;
+
+        /* Modules that use the file */
+        Rec[DBG_FILE_MODS]     = DbgBinListPos ();
+        Rec[DBG_FILE_MODCOUNT] = CollCount (&FI->Modules);
+        for (J = 0; J < CollCount (&FI->Modules); ++J) {
+            const ObjData* O = CollConstAt (&FI->Modules, J);
+            DbgBinListAdd (O->Id);
+        }
+    }
+}
@@ -84,6 +84,9 @@ void AssignFileInfoIds (void);
 void PrintDbgFileInfo (FILE* F);
 /* Output the file info to a debug info file */
 
+void CollectDbgFileInfo (void);
+/* Add the file info to a binary debug info file */
+
 
 
 /* End of fileinfo.h */
@@ -62,6 +62,9 @@ Fragment* NewFragment (unsigned char Type, unsigned Size, Section* S)
     unsigned FragSize = sizeof (Fragment) - 1;
     if (Type == FRAG_LITERAL) {
         FragSize += Size;
+    } else if (Type == FRAG_RELAX) {
+        /* Opcodes, see relax.h */
+        FragSize += Size + 1;
     }
 
     /* Allocate memory */
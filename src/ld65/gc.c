@@ -0,0 +1,286 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                   gc.c                                    */
+/*                                                                           */
+/*                  Remove sections that are not referenced                  */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+
+/* common */
+#include "alignment.h"
+#include "coll.h"
+#include "print.h"
+#include "segdefs.h"
+#include "symdefs.h"
+
+/* ld65 */
+#include "asserts.h"
+#include "exports.h"
+#include "expr.h"
+#include "fragment.h"
+#include "gc.h"
+#include "objdata.h"
+#include "segments.h"
+#include "span.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Exports that must be kept even if no module uses them */
+static Collection KeepList = STATIC_COLLECTION_INITIALIZER;
+
+/* Used sections whose fragments haven't been scanned so far */
+static Collection Pending = STATIC_COLLECTION_INITIALIZER;
+
+/* Exports that were marked as used */
+static Collection Marked = STATIC_COLLECTION_INITIALIZER;
+
+
+
+/*****************************************************************************/
+/*                             Helper functions                              */
+/*****************************************************************************/
+
+
+
+static void UseExpr (ExprNode* E);
+
+
+
+static void UseSection (Section* S)
+/* Mark a section as used */
+{
+    if (!S->Live) {
+        S->Live = 1;
+        CollAppend (&Pending, S);
+    }
+}
+
+
+
+static void UseExport (Export* E)
+/* Mark an export and everything its value depends on as used */
+{
+    if (E != 0 && !ExportHasMark (E)) {
+        MarkExport (E);
+        CollAppend (&Marked, E);
+        UseExpr (E->Expr);
+    }
+}
+
+
+
+static void UseExpr (ExprNode* E)
+/* Mark everything referenced by an expression as used */
+{
+    if (E == 0) {
+        return;
+    }
+
+    switch (E->Op) {
+
+        case EXPR_SYMBOL:
+            UseExport (GetExprExport (E));
+            break;
+
+        case EXPR_SECTION:
+            UseSection (GetExprSection (E));
+            break;
+
+        default:
+            UseExpr (E->Left);
+            UseExpr (E->Right);
+            break;
+    }
+}
+
+
+
+static int IsLinkerRef (const Export* E)
+/* Return true if the export is imported by the config or the command line */
+{
+    const Import* I;
+    for (I = E->ImpList; I; I = I->Next) {
+        if (I->Obj == 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+
+static void RemoveSections (Segment* Seg)
+/* Remove the unused sections from a segment and update its layout */
+{
+    unsigned I, J;
+
+    Seg->Alignment = 1;
+    for (I = 0, J = 0; I < CollCount (&Seg->Sections); ++I) {
+        Section* S = CollAtUnchecked (&Seg->Sections, I);
+        if (S->Live) {
+            Seg->Alignment = LeastCommonMultiple (Seg->Alignment, S->Alignment);
+            CollReplace (&Seg->Sections, S, J++);
+        }
+    }
+    Seg->Sections.Count = J;
+
+    SegPlaceSections (Seg);
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void GCKeepSymbol (unsigned Name)
+/* Keep the export with the given name and everything it references, even if
+** no module uses it.
+*/
+{
+    Export* E = FindExport (Name);
+    if (E) {
+        CollAppend (&KeepList, E);
+    }
+}
+
+
+
+void GCCollect (void)
+/* Remove all sections that may be removed and are not referenced from any of
+** the remaining ones, from the config or from the command line.
+*/
+{
+    unsigned      I, J;
+    unsigned      Count = 0;
+    unsigned long Bytes = 0;
+    Collection    Segs  = AUTO_COLLECTION_INITIALIZER;
+
+    /* Sections that may be removed are unused until we find a reference */
+    for (I = 0; I < CollCount (&ObjDataList); ++I) {
+        ObjData* O = CollAtUnchecked (&ObjDataList, I);
+        for (J = 0; J < CollCount (&O->Sections); ++J) {
+            Section* S = CollAtUnchecked (&O->Sections, J);
+            if (S->Flags & SEG_FLAG_GC) {
+                S->Live = 0;
+            }
+        }
+    }
+
+    /* Mark the roots. These are all other sections, constructors and
+    ** destructors, symbols imported by the config or the command line, and
+    ** everything used in assertions.
+    */
+    for (I = 0; I < CollCount (&ObjDataList); ++I) {
+        ObjData* O = CollAtUnchecked (&ObjDataList, I);
+        for (J = 0; J < CollCount (&O->Sections); ++J) {
+            Section* S = CollAtUnchecked (&O->Sections, J);
+            if (S->Live) {
+                CollAppend (&Pending, S);
+            }
+        }
+        for (J = 0; J < CollCount (&O->Exports); ++J) {
+            Export* E = CollAtUnchecked (&O->Exports, J);
+            if (SYM_IS_CONDES (E->Type) || IsLinkerRef (E)) {
+                UseExport (E);
+            }
+        }
+        for (J = 0; J < CollCount (&O->Assertions); ++J) {
+            UseExpr (GetAssertionExpr (CollAtUnchecked (&O->Assertions, J)));
+        }
+    }
+    for (I = 0; I < CollCount (&KeepList); ++I) {
+        UseExport (CollAtUnchecked (&KeepList, I));
+    }
+
+    /* Follow the references from the used sections */
+    while (CollCount (&Pending) > 0) {
+        Section*  S = CollPop (&Pending);
+        Fragment* F;
+        for (F = S->FragRoot; F; F = F->Next) {
+            UseExpr (F->Expr);
+        }
+    }
+
+    /* Remove the marks from the exports */
+    for (I = 0; I < CollCount (&Marked); ++I) {
+        UnmarkExport (CollAtUnchecked (&Marked, I));
+    }
+    CollDeleteAll (&Marked);
+
+    /* Find the segments with unused sections */
+    for (I = 0; I < CollCount (&ObjDataList); ++I) {
+        ObjData* O = CollAtUnchecked (&ObjDataList, I);
+        for (J = 0; J < CollCount (&O->Sections); ++J) {
+            const Section* S = CollAtUnchecked (&O->Sections, J);
+            if (!S->Live) {
+                ++Count;
+                Bytes += S->Size;
+                if (CollIndex (&Segs, S->Seg) < 0) {
+                    CollAppend (&Segs, S->Seg);
+                }
+            }
+        }
+    }
+
+    /* Remove the sections and the debug info for them */
+    if (Count > 0) {
+        for (I = 0; I < CollCount (&Segs); ++I) {
+            RemoveSections (CollAtUnchecked (&Segs, I));
+        }
+        RemoveSpans ();
+    }
+    DoneCollection (&Segs);
+
+    Print (stdout, 1, "Removed %u unused section%s with %lu bytes\n",
+           Count, (Count == 1)? "" : "s", Bytes);
+}
+
+
+
+int GCIsRemoved (ExprNode* Expr)
+/* Return true if the expression contains a position in a section that was
+** removed. Symbols are not followed.
+*/
+{
+    if (Expr == 0) {
+        return 0;
+    } else if (Expr->Op == EXPR_SECTION) {
+        return !GetExprSection (Expr)->Live;
+    } else {
+        return GCIsRemoved (Expr->Left) || GCIsRemoved (Expr->Right);
+    }
+}
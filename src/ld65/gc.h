@@ -0,0 +1,69 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                   gc.h                                    */
+/*                                                                           */
+/*                  Remove sections that are not referenced                  */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+
+#ifndef GC_H
+#define GC_H
+
+
+
+/* common */
+#include "exprdefs.h"
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void GCKeepSymbol (unsigned Name);
+/* Keep the export with the given name and everything it references, even if
+** no module uses it.
+*/
+
+void GCCollect (void);
+/* Remove all sections that may be removed and are not referenced from any of
+** the remaining ones, from the config or from the command line.
+*/
+
+int GCIsRemoved (ExprNode* Expr);
+/* Return true if the expression contains a position in a section that was
+** removed. Symbols are not followed.
+*/
+
+
+
+/* End of gc.h */
+
+#endif
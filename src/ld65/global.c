@@ -52,7 +52,10 @@ unsigned ModuleId           = 0;        /* Id for o65 module */
 unsigned char HaveStartAddr = 0;        /* Start address not given */
 unsigned long StartAddr     = 0x200;    /* Start address */
 
+unsigned char GCSections    = 0;        /* Remove unused sections */
+
 unsigned char VerboseMap    = 0;        /* Verbose map file */
 const char* MapFileName     = 0;        /* Name of the map file */
 const char* LabelFileName   = 0;        /* Name of the label file */
 const char* DbgFileName     = 0;        /* Name of the debug file */
+unsigned char BinDbgFile    = 0;        /* Write a binary debug file */
@@ -52,10 +52,13 @@ extern unsigned         ModuleId;       /* Id for o65 module */
 extern unsigned char    HaveStartAddr;  /* True if start address was given */
 extern unsigned long    StartAddr;      /* Start address */
 
+extern unsigned char    GCSections;     /* Remove unused sections */
+
 extern unsigned char    VerboseMap;     /* Verbose map file */
 extern const char*      MapFileName;    /* Name of the map file */
 extern const char*      LabelFileName;  /* Name of the label file */
 extern const char*      DbgFileName;    /* Name of the debug file */
+extern unsigned char    BinDbgFile;     /* Write a binary debug file */
 
 
 
@@ -39,13 +39,16 @@
 
 /* common */
 #include "coll.h"
+#include "dbgdefs.h"
 #include "exprdefs.h"
+#include "hashfunc.h"
 #include "libdefs.h"
 #include "objdefs.h"
 #include "symdefs.h"
 #include "xmalloc.h"
 
 /* ld65 */
+#include "dbgfile.h"
 #include "error.h"
 #include "exports.h"
 #include "fileio.h"
@@ -70,6 +73,13 @@ struct Library {
     FILE*       F;              /* Open file stream */
     LibHeader   Header;         /* Library header */
     Collection  Modules;        /* Modules */
+    unsigned*   ExpStart;       /* Export index: First name for each module */
+    unsigned*   ExpNames;       /* Export index: Names ordered by module */
+    unsigned    HashSize;       /* Export index: Number of hash buckets */
+    unsigned*   HashStart;      /* Export index: First entry for each bucket */
+    unsigned*   HashNames;      /* Export index: Names ordered by bucket */
+    unsigned*   HashModules;    /* Export index: Module for each entry */
+    unsigned char* Pending;     /* Modules that must be checked again */
 };
 
 /* List of open libraries */
@@ -100,6 +110,13 @@ static Library* NewLibrary (FILE* F, const char* Name)
     L->Name     = GetStringId (Name);
     L->F        = F;
     L->Modules  = EmptyCollection;
+    L->ExpStart = 0;
+    L->ExpNames = 0;
+    L->HashSize    = 0;
+    L->HashStart   = 0;
+    L->HashNames   = 0;
+    L->HashModules = 0;
+    L->Pending     = 0;
 
     /* Return the new struct */
     return L;
@@ -115,6 +132,21 @@ static void CloseLibrary (Library* L)
         Error ("Error closing `%s': %s", GetString (L->Name), strerror (errno));
     }
     L->F = 0;
+
+    /* The export index is no longer needed */
+    xfree (L->ExpStart);
+    xfree (L->ExpNames);
+    xfree (L->HashStart);
+    xfree (L->HashNames);
+    xfree (L->HashModules);
+    xfree (L->Pending);
+    L->ExpStart    = 0;
+    L->ExpNames    = 0;
+    L->HashSize    = 0;
+    L->HashStart   = 0;
+    L->HashNames   = 0;
+    L->HashModules = 0;
+    L->Pending     = 0;
 }
 
 
@@ -157,7 +189,8 @@ static void LibReadHeader (Library* L)
     /* Read the remaining header fields (magic is already read) */
     L->Header.Magic   = LIB_MAGIC;
     L->Header.Version = Read16 (L->F);
-    if (L->Header.Version != LIB_VERSION) {
+    if (L->Header.Version != LIB_VERSION &&
+        L->Header.Version != LIB_VERSION_OLD) {
         Error ("Wrong data version in `%s'", GetString (L->Name));
     }
     L->Header.Flags   = Read16 (L->F);
@@ -257,6 +290,73 @@ static void ReadBasicData (Library* L, ObjData* O)
 
 
 
+static void LibReadExportIndex (Library* L)
+/* Read the export index of a library file. The hash table is kept as is, so
+** the entries of bucket I are HashNames/HashModules[HashStart[I]] up to
+** [HashStart[I+1]-1]. The names are also stored ordered by module, so the
+** exports of module I are ExpNames[ExpStart[I]] up to ExpNames[ExpStart[I+1]-1].
+*/
+{
+    unsigned  ModuleCount = CollCount (&L->Modules);
+    unsigned  Count = 0;
+    unsigned  Size  = 16;
+    unsigned* Names   = xmalloc (Size * sizeof (Names[0]));
+    unsigned* Modules = xmalloc (Size * sizeof (Modules[0]));
+    unsigned  I;
+
+    /* Read the hash table */
+    L->HashSize  = ReadVar (L->F);
+    L->HashStart = xmalloc ((L->HashSize + 1) * sizeof (L->HashStart[0]));
+    for (I = 0; I < L->HashSize; ++I) {
+        unsigned long Entries = ReadVar (L->F);
+        L->HashStart[I] = Count;
+        while (Entries--) {
+            if (Count == Size) {
+                Size   *= 2;
+                Names   = xrealloc (Names, Size * sizeof (Names[0]));
+                Modules = xrealloc (Modules, Size * sizeof (Modules[0]));
+            }
+            Names[Count]   = ReadStr (L->F);
+            Modules[Count] = ReadVar (L->F);
+            if (Modules[Count] >= ModuleCount) {
+                Error ("Invalid export index in `%s'", GetString (L->Name));
+            }
+            ++Count;
+        }
+    }
+    L->HashStart[L->HashSize] = Count;
+
+    /* Sort the names by module */
+    L->ExpStart = xmalloc ((ModuleCount + 1) * sizeof (L->ExpStart[0]));
+    memset (L->ExpStart, 0, (ModuleCount + 1) * sizeof (L->ExpStart[0]));
+    for (I = 0; I < Count; ++I) {
+        ++L->ExpStart[Modules[I] + 1];
+    }
+    for (I = 1; I <= ModuleCount; ++I) {
+        L->ExpStart[I] += L->ExpStart[I-1];
+    }
+    L->ExpNames = xmalloc ((Count + 1) * sizeof (L->ExpNames[0]));
+    for (I = 0; I < Count; ++I) {
+        L->ExpNames[L->ExpStart[Modules[I]]++] = Names[I];
+    }
+
+    /* Sorting moved the start of each module to the start of the next one */
+    for (I = ModuleCount; I > 0; --I) {
+        L->ExpStart[I] = L->ExpStart[I-1];
+    }
+    L->ExpStart[0] = 0;
+
+    /* Keep the entries of the hash table */
+    L->HashNames   = Names;
+    L->HashModules = Modules;
+
+    /* All modules must be checked when the library is searched first */
+    L->Pending = xmalloc (ModuleCount + 1);
+    memset (L->Pending, 1, ModuleCount + 1);
+}
+
+
+
 static void LibReadIndex (Library* L)
 /* Read the index of a library file */
 {
@@ -274,11 +374,16 @@ static void LibReadIndex (Library* L)
         CollAppend (&L->Modules, ReadIndexEntry (L));
     }
 
-    /* Walk over the index and read basic data for all object files in the
-    ** library.
+    /* If the library has an export index, the remaining data for a module
+    ** is read when it's needed. Otherwise walk over the index and read basic
+    ** data for all object files in the library.
     */
-    for (I = 0; I < CollCount (&L->Modules); ++I) {
-        ReadBasicData (L, CollAtUnchecked (&L->Modules, I));
+    if (L->Header.Version == LIB_VERSION) {
+        LibReadExportIndex (L);
+    } else {
+        for (I = 0; I < CollCount (&L->Modules); ++I) {
+            ReadBasicData (L, CollAtUnchecked (&L->Modules, I));
+        }
     }
 }
 
@@ -290,27 +395,97 @@ static void LibReadIndex (Library* L)
 
 
 
-static void LibCheckExports (ObjData* O)
-/* Check if the exports from this file can satisfy any import requests. If so,
-** insert the imports and exports from this file and mark the file as added.
+static int LibNeedsModule (const Library* L, unsigned Index)
+/* Check if the exports from module Index of library L can satisfy any import
+** requests.
 */
 {
     unsigned I;
 
-    /* Check all exports */
-    for (I = 0; I < CollCount (&O->Exports); ++I) {
-        const Export* E = CollConstAt (&O->Exports, I);
-        if (IsUnresolved (E->Name)) {
-           /* We need this module, insert the imports and exports */
-            O->Flags |= OBJ_REF;
-            InsertObjGlobals (O);
-            break;
+    if (L->ExpStart) {
+        /* Use the export index */
+        for (I = L->ExpStart[Index]; I < L->ExpStart[Index+1]; ++I) {
+            if (IsUnresolved (L->ExpNames[I])) {
+                return 1;
+            }
+        }
+    } else {
+        /* Check the exports read from the module */
+        const ObjData* O = CollConstAt (&L->Modules, Index);
+        for (I = 0; I < CollCount (&O->Exports); ++I) {
+            const Export* E = CollConstAt (&O->Exports, I);
+            if (IsUnresolved (E->Name)) {
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+
+
+static void LibMarkPending (const ObjData* O)
+/* Look up the unresolved imports of the newly added module O in the export
+** indices of all open libraries, and mark the modules exporting them, so
+** they are checked again.
+*/
+{
+    unsigned I, J, K;
+
+    for (I = 0; I < CollCount (&O->Imports); ++I) {
+
+        const Export* E = ((const Import*) CollConstAt (&O->Imports, I))->Exp;
+        unsigned      Hash;
+
+        if (!IsUnresolvedExport (E)) {
+            continue;
+        }
+        Hash = HashStr (GetString (E->Name));
+
+        for (J = 0; J < CollCount (&OpenLibs); ++J) {
+            Library* L = CollAtUnchecked (&OpenLibs, J);
+            if (L->HashSize > 0) {
+                unsigned Bucket = Hash % L->HashSize;
+                for (K = L->HashStart[Bucket]; K < L->HashStart[Bucket+1]; ++K) {
+                    if (L->HashNames[K] == E->Name) {
+                        L->Pending[L->HashModules[K]] = 1;
+                    }
+                }
+            }
         }
     }
 }
 
 
 
+static void LibCheckExports (Library* L, unsigned Index)
+/* Check if the exports from module Index of library L can satisfy any import
+** requests. If so, insert the imports and exports from this file and mark the
+** file as added.
+*/
+{
+    if (LibNeedsModule (L, Index)) {
+
+        ObjData* O = CollAtUnchecked (&L->Modules, Index);
+
+        /* With an export index, the module data wasn't read before */
+        if (L->ExpStart) {
+            ReadBasicData (L, O);
+        }
+
+        /* We need this module, insert the imports and exports */
+        O->Flags |= OBJ_REF;
+        InsertObjGlobals (O);
+
+        /* Modules of libraries with an export index are only checked again
+        ** if they export one of the imports added here.
+        */
+        LibMarkPending (O);
+    }
+}
+
+
+
 static void LibOpen (FILE* F, const char* Name)
 /* Open the library for use */
 {
@@ -357,9 +532,16 @@ static void LibResolve (void)
                 /* Get the next module */
                 ObjData* O = CollAtUnchecked (&L->Modules, J);
 
-                /* We only need to check this module if it wasn't added before */
-                if ((O->Flags & OBJ_REF) == 0) {
-                    LibCheckExports (O);
+                /* We only need to check this module if it wasn't added
+                ** before, and, if the library has an export index, if one
+                ** of its exports was imported since it was checked last.
+                */
+                if ((O->Flags & OBJ_REF) == 0 &&
+                    (L->Pending == 0 || L->Pending[J])) {
+                    if (L->Pending) {
+                        L->Pending[J] = 0;
+                    }
+                    LibCheckExports (L, J);
                     if (O->Flags & OBJ_REF) {
                         /* The routine added the file */
                         ++Additions;
@@ -553,3 +735,17 @@ void PrintDbgLibraries (FILE* F)
         fprintf (F, "lib\tid=%u,name=\"%s\"\n", L->Id, GetString (L->Name));
     }
 }
+
+
+
+void CollectDbgLibraries (void)
+/* Add the libraries to a binary debug info file */
+{
+    unsigned I;
+
+    for (I = 0; I < CollCount (&LibraryList); ++I) {
+        const Library* L   = CollAtUnchecked (&LibraryList, I);
+        unsigned long* Rec = DbgBinRecord (DBG_KIND_LIB, L->Id);
+        Rec[DBG_LIB_NAME] = DbgBinStr (GetString (L->Name));
+    }
+}
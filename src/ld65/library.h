@@ -87,6 +87,9 @@ unsigned LibraryCount (void);
 void PrintDbgLibraries (FILE* F);
 /* Output the libraries to a debug info file */
 
+void CollectDbgLibraries (void);
+/* Add the libraries to a binary debug info file */
+
 
 
 /* End of library.h */
@@ -35,10 +35,12 @@
 
 /* common */
 #include "check.h"
+#include "dbgdefs.h"
 #include "lidefs.h"
 #include "xmalloc.h"
 
 /* ld65 */
+#include "dbgfile.h"
 #include "error.h"
 #include "fileinfo.h"
 #include "fileio.h"
@@ -284,3 +286,31 @@ void PrintDbgLineInfo (FILE* F)
         }
     }
 }
+
+
+
+void CollectDbgLineInfo (void)
+/* Add the line infos to a binary debug info file */
+{
+    unsigned I, J;
+
+    for (I = 0; I < CollCount (&ObjDataList); ++I) {
+
+        /* Get the object file */
+        const ObjData* O = CollAtUnchecked (&ObjDataList, I);
+
+        /* Add the line infos */
+        for (J = 0; J < CollCount (&O->LineInfos); ++J) {
+
+            /* Get this line info and its record */
+            const LineInfo* LI  = CollConstAt (&O->LineInfos, J);
+            unsigned long*  Rec = DbgBinRecord (DBG_KIND_LINE, LI->Id);
+
+            Rec[DBG_LINE_FILE]  = LI->File->Id;
+            Rec[DBG_LINE_LINE]  = GetSourceLine (LI);
+            Rec[DBG_LINE_TYPE]  = LI_GET_TYPE (LI->Type);
+            Rec[DBG_LINE_COUNT] = LI_GET_COUNT (LI->Type);
+            CollectDbgSpanList (Rec, DBG_LINE_SPANS, O, LI->Spans);
+        }
+    }
+}
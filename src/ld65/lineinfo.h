@@ -183,6 +183,9 @@ void AssignLineInfoIds (void);
 void PrintDbgLineInfo (FILE* F);
 /* Output the line infos to a debug info file */
 
+void CollectDbgLineInfo (void);
+/* Add the line infos to a binary debug info file */
+
 
 
 /* End of lineinfo.h */
@@ -0,0 +1,259 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                   lz4.c                                   */
+/*                                                                           */
+/*                   LZ4 compression for compressed segments                 */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+/* The data is parsed optimally: Starting at the end, the cheapest encoding
+** of the rest of the data is determined for every position, using the
+** longest match found there or any shorter one. The cost of literals is
+** estimated as one byte each, which ignores the additional length bytes of
+** very long literal runs.
+*/
+
+
+
+/* common */
+#include "xmalloc.h"
+
+/* ld65 */
+#include "lz4.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Limits from the LZ4 block format */
+#define MIN_MATCH       4               /* Minimum match length */
+#define MAX_OFFS        0xFFFFUL        /* Maximum match offset */
+#define LAST_LITERALS   5               /* Last bytes are always literals */
+#define MATCH_LIMIT     12              /* Last match starts before this */
+
+/* Parameters for the match finder */
+#define HASH_BITS       15
+#define HASH_SIZE       (1UL << HASH_BITS)
+#define MAX_CHAIN       256             /* Max number of positions tried */
+#define NICE_LEN        256             /* Stop searching at this length */
+
+/* No position */
+#define NO_POS          (~0UL)
+
+
+
+/*****************************************************************************/
+/*                             Helper functions                              */
+/*****************************************************************************/
+
+
+
+static unsigned long Hash (const unsigned char* P)
+/* Hash the four bytes at P */
+{
+    unsigned long V = P[0] | (P[1] << 8) | ((unsigned long) P[2] << 16) |
+                      ((unsigned long) P[3] << 24);
+    return ((V * 2654435761UL) & 0xFFFFFFFFUL) >> (32 - HASH_BITS);
+}
+
+
+
+static unsigned long LenCost (unsigned long Len)
+/* Return the number of additional bytes needed for a length field */
+{
+    return (Len < 15)? 0 : 1 + (Len - 15) / 255;
+}
+
+
+
+static void PutLen (StrBuf* B, unsigned long Len)
+/* Output the additional bytes for a length field */
+{
+    if (Len >= 15) {
+        Len -= 15;
+        while (Len >= 255) {
+            SB_AppendChar (B, (char) 255);
+            Len -= 255;
+        }
+        SB_AppendChar (B, (char) Len);
+    }
+}
+
+
+
+static void PutSeq (StrBuf* B, const unsigned char* Lit, unsigned long LitLen,
+                    unsigned long Offs, unsigned long MatchLen)
+/* Output a sequence of literals followed by a match. A match length of zero
+** ends the block.
+*/
+{
+    unsigned char Token = (unsigned char) ((LitLen < 15)? LitLen << 4 : 0xF0);
+    if (MatchLen > 0) {
+        unsigned long M = MatchLen - MIN_MATCH;
+        Token |= (unsigned char) ((M < 15)? M : 15);
+    }
+    SB_AppendChar (B, (char) Token);
+    PutLen (B, LitLen);
+    SB_AppendBuf (B, (const char*) Lit, LitLen);
+    if (MatchLen > 0) {
+        SB_AppendChar (B, (char) (Offs & 0xFF));
+        SB_AppendChar (B, (char) (Offs >> 8));
+        PutLen (B, MatchLen - MIN_MATCH);
+    }
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void LZ4Compress (StrBuf* Packed, const unsigned char* Data,
+                  unsigned long Size)
+/* Compress Size bytes from Data into a raw LZ4 block, which is appended to
+** Packed. The block can be unpacked with decompress_lz4 from the library.
+*/
+{
+    unsigned long* Head;
+    unsigned long* Prev;
+    unsigned long* Len;         /* Longest match at each position */
+    unsigned long* Offs;        /* Offset of this match */
+    unsigned long* Cost;        /* Cost of the rest of the data */
+    unsigned long* Choice;      /* Match length used or zero */
+    unsigned long  Limit;
+    unsigned long  I;
+    unsigned long  Lit;
+
+    /* Data that is too short for a match is stored as literals */
+    if (Size <= MATCH_LIMIT) {
+        PutSeq (Packed, Data, Size, 0, 0);
+        return;
+    }
+    Limit = Size - MATCH_LIMIT;
+
+    Head   = xmalloc (HASH_SIZE * sizeof (Head[0]));
+    Prev   = xmalloc (Size * sizeof (Prev[0]));
+    Len    = xmalloc (Size * sizeof (Len[0]));
+    Offs   = xmalloc (Size * sizeof (Offs[0]));
+    Cost   = xmalloc ((Size + 1) * sizeof (Cost[0]));
+    Choice = xmalloc (Size * sizeof (Choice[0]));
+
+    /* Find the longest match at each position where a match may start */
+    for (I = 0; I < HASH_SIZE; ++I) {
+        Head[I] = NO_POS;
+    }
+    for (I = 0; I < Size; ++I) {
+        Len[I] = 0;
+        Offs[I] = 0;
+        if (I < Limit) {
+            unsigned long H = Hash (Data + I);
+            unsigned long MaxLen = Size - LAST_LITERALS - I;
+            unsigned long P = Head[H];
+            unsigned Tries = MAX_CHAIN;
+            if (MaxLen > NICE_LEN) {
+                MaxLen = NICE_LEN;
+            }
+            while (P != NO_POS && I - P <= MAX_OFFS && Tries-- > 0) {
+                unsigned long L = 0;
+                while (L < MaxLen && Data[P + L] == Data[I + L]) {
+                    ++L;
+                }
+                if (L > Len[I]) {
+                    Len[I] = L;
+                    Offs[I] = I - P;
+                    if (L == MaxLen) {
+                        break;
+                    }
+                }
+                P = Prev[P];
+            }
+            if (Len[I] < MIN_MATCH) {
+                Len[I] = 0;
+            }
+            Prev[I] = Head[H];
+            Head[H] = I;
+        }
+    }
+
+    /* Determine the cheapest encoding backwards from the end. Matches that
+    ** reached the search limit are extended by following the match with the
+    ** same offset at the next position. Such long matches are always used
+    ** as a whole.
+    */
+    Cost[Size] = 1;
+    for (I = Size; I-- > 0; ) {
+        unsigned long L;
+        Cost[I] = Cost[I + 1] + 1;
+        Choice[I] = 0;
+        if (Len[I] >= NICE_LEN && Offs[I + 1] == Offs[I] &&
+            Len[I + 1] >= NICE_LEN - 1) {
+            Len[I] = Len[I + 1] + 1;
+        }
+        if (Len[I] >= NICE_LEN) {
+            unsigned long C = 3 + LenCost (Len[I] - MIN_MATCH) +
+                              Cost[I + Len[I]];
+            if (C < Cost[I]) {
+                Cost[I] = C;
+                Choice[I] = Len[I];
+            }
+        } else {
+            for (L = MIN_MATCH; L <= Len[I]; ++L) {
+                unsigned long C = 3 + LenCost (L - MIN_MATCH) + Cost[I + L];
+                if (C < Cost[I]) {
+                    Cost[I] = C;
+                    Choice[I] = L;
+                }
+            }
+        }
+    }
+
+    /* Output the sequences */
+    I = Lit = 0;
+    while (I < Size) {
+        if (Choice[I] > 0) {
+            PutSeq (Packed, Data + Lit, I - Lit, Offs[I], Choice[I]);
+            I += Choice[I];
+            Lit = I;
+        } else {
+            ++I;
+        }
+    }
+    PutSeq (Packed, Data + Lit, Size - Lit, 0, 0);
+
+    xfree (Head);
+    xfree (Prev);
+    xfree (Len);
+    xfree (Offs);
+    xfree (Cost);
+    xfree (Choice);
+}
@@ -0,0 +1,59 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                   lz4.h                                   */
+/*                                                                           */
+/*                   LZ4 compression for compressed segments                 */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef LZ4_H
+#define LZ4_H
+
+
+
+/* common */
+#include "strbuf.h"
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void LZ4Compress (StrBuf* Packed, const unsigned char* Data,
+                  unsigned long Size);
+/* Compress Size bytes from Data into a raw LZ4 block, which is appended to
+** Packed. The block can be unpacked with decompress_lz4 from the library.
+*/
+
+
+
+/* End of lz4.h */
+
+#endif
@@ -131,9 +131,11 @@ static void Usage (void)
             "  --cfg-path path\tSpecify a config file search path\n"
             "  --config name\t\tUse linker config file\n"
             "  --dbgfile name\tGenerate debug information\n"
+            "  --dbgfile-format fmt\tSet the debug file format (text/binary)\n"
             "  --define sym=val\tDefine a symbol\n"
             "  --end-group\t\tEnd a library group\n"
             "  --force-import sym\tForce an import of symbol `sym'\n"
+            "  --gc-sections\t\tRemove unused sections\n"
             "  --help\t\tHelp (this text)\n"
             "  --lib file\t\tLink this library\n"
             "  --lib-path path\tSpecify a library search path\n"
@@ -340,6 +342,20 @@ static void OptDbgFile (const char* Opt attribute ((unused)), const char* Arg)
 
 
 
+static void OptDbgFileFormat (const char* Opt attribute ((unused)), const char* Arg)
+/* Set the format of the debug file */
+{
+    if (strcmp (Arg, "text") == 0) {
+        BinDbgFile = 0;
+    } else if (strcmp (Arg, "binary") == 0) {
+        BinDbgFile = 1;
+    } else {
+        Error ("Invalid debug file format: `%s'", Arg);
+    }
+}
+
+
+
 static void OptDefine (const char* Opt attribute ((unused)), const char* Arg)
 /* Define a symbol on the command line */
 {
@@ -395,6 +411,15 @@ static void OptForceImport (const char* Opt attribute ((unused)), const char* Ar
 
 
 
+static void OptGCSections (const char* Opt attribute ((unused)),
+                           const char* Arg attribute ((unused)))
+/* Remove unused sections */
+{
+    GCSections = 1;
+}
+
+
+
 static void OptHelp (const char* Opt attribute ((unused)),
                      const char* Arg attribute ((unused)))
 /* Print usage information and exit */
@@ -602,9 +627,11 @@ static void ParseCommandLine(void)
         { "--cfg-path",         1,      OptCfgPath              },
         { "--config",           1,      CmdlOptConfig           },
         { "--dbgfile",          1,      OptDbgFile              },
+        { "--dbgfile-format",   1,      OptDbgFileFormat        },
         { "--define",           1,      OptDefine               },
         { "--end-group",        0,      CmdlOptEndGroup         },
         { "--force-import",     1,      OptForceImport          },
+        { "--gc-sections",      0,      OptGCSections           },
         { "--help",             0,      OptHelp                 },
         { "--lib",              1,      OptLib                  },
         { "--lib-path",         1,      OptLibPath              },
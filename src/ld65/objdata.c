@@ -37,9 +37,11 @@
 
 /* common */
 #include "check.h"
+#include "dbgdefs.h"
 #include "xmalloc.h"
 
 /* ld65 */
+#include "dbgfile.h"
 #include "error.h"
 #include "exports.h"
 #include "fileinfo.h"
@@ -309,3 +311,25 @@ void PrintDbgModules (FILE* F)
     }
 
 }
+
+
+
+void CollectDbgModules (void)
+/* Add the modules to a binary debug info file */
+{
+    unsigned I;
+
+    for (I = 0; I < CollCount (&ObjDataList); ++I) {
+
+        /* Get this object file and its record */
+        const ObjData* O   = CollConstAt (&ObjDataList, I);
+        unsigned long* Rec = DbgBinRecord (DBG_KIND_MOD, I);
+
+        /* The main source file is the one at index zero */
+        const FileInfo* Source = CollConstAt (&O->Files, 0);
+
+        Rec[DBG_MOD_NAME] = DbgBinStr (GetObjFileName (O));
+        Rec[DBG_MOD_FILE] = Source->Id;
+        Rec[DBG_MOD_LIB]  = O->Lib? GetLibId (O->Lib) : DBG_INV_ID;
+    }
+}
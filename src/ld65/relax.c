@@ -0,0 +1,747 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  relax.c                                  */
+/*                                                                           */
+/*               Shorten instructions once addresses are known               */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#include <stdio.h>
+
+/* common */
+#include "addrsize.h"
+#include "coll.h"
+#include "fragdefs.h"
+#include "print.h"
+#include "xmalloc.h"
+
+/* ld65 */
+#include "asserts.h"
+#include "dbgsyms.h"
+#include "exports.h"
+#include "expr.h"
+#include "fragment.h"
+#include "memarea.h"
+#include "objdata.h"
+#include "relax.h"
+#include "segments.h"
+#include "span.h"
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* States of a relaxable instruction */
+enum {
+    RU_LONG,                            /* Long form, may be shortened */
+    RU_SHORT,                           /* Short form */
+    RU_FIXED                            /* Long form, must not be changed */
+};
+
+/* A relaxable instruction */
+typedef struct RelaxUnit RelaxUnit;
+struct RelaxUnit {
+    Fragment*           F;              /* The fragment */
+    unsigned long       OrigOffs;       /* Offset in section as read */
+    unsigned long       Offs;           /* Current offset in section */
+    unsigned long       NewOffs;        /* Offset after pending changes */
+    unsigned            NewSize;        /* Size after pending changes */
+    unsigned char       State;          /* State, see above */
+};
+
+/* The relaxable instructions of a section */
+typedef struct RelaxInfo RelaxInfo;
+struct RelaxInfo {
+    Section*            Sec;            /* The section */
+    Collection          Units;          /* Units sorted by offset */
+};
+
+/* List of all sections with relaxable instructions */
+static Collection RelaxInfos = STATIC_COLLECTION_INITIALIZER;
+
+/* What to do with the positions found in an expression */
+enum {
+    WALK_CHECK,                         /* Check for references into units */
+    WALK_REMAP                          /* Remap to the pending layout */
+};
+
+/* Number of passes */
+static unsigned PassCount = 0;
+
+
+
+/*****************************************************************************/
+/*                             Helper functions                              */
+/*****************************************************************************/
+
+
+
+static unsigned LongSize (const Fragment* F)
+/* Return the size of the long form of an instruction */
+{
+    return F->LitBuf[RELAX_BUF_LONGSIZE];
+}
+
+
+
+static RelaxUnit* GetUnit (const RelaxInfo* R, unsigned Index)
+/* Return a unit from a section */
+{
+    return CollAtUnchecked (&R->Units, Index);
+}
+
+
+
+static unsigned FindUnit (const RelaxInfo* R, long Offs, int Orig)
+/* Return the index of the first unit that ends behind Offs. Orig selects
+** the layout as read from the object file, otherwise the current layout is
+** used. Returns the number of units if there's no such unit.
+*/
+{
+    unsigned Lo = 0;
+    unsigned Hi = CollCount (&R->Units);
+    while (Lo < Hi) {
+        unsigned Mid = (Lo + Hi) / 2;
+        const RelaxUnit* U = GetUnit (R, Mid);
+        long End = Orig? (long) (U->OrigOffs + LongSize (U->F)) :
+                         (long) (U->Offs + U->F->Size);
+        if (End > Offs) {
+            Hi = Mid;
+        } else {
+            Lo = Mid + 1;
+        }
+    }
+    return Lo;
+}
+
+
+
+static long MapOffs (const RelaxInfo* R, long Offs, int Orig)
+/* Map an offset in a section to the new layout. If Orig is true, Offs is
+** an offset in the layout as read from the object file, and the result is
+** for the current layout. Otherwise Offs is for the current layout, and the
+** result is for the layout with the pending changes applied. Offsets that
+** point into an instruction keep their distance to its start as far as
+** possible.
+*/
+{
+    unsigned Count = CollCount (&R->Units);
+    unsigned I     = FindUnit (R, Offs, Orig);
+    const RelaxUnit* U;
+    long Start, NewStart;
+    unsigned NewSize;
+
+    if (Count == 0) {
+        return Offs;
+    }
+
+    /* Get the unit and its old and new position */
+    U = GetUnit (R, (I < Count)? I : Count - 1);
+    if (Orig) {
+        Start    = U->OrigOffs;
+        NewStart = U->Offs;
+        NewSize  = U->F->Size;
+    } else {
+        Start    = U->Offs;
+        NewStart = U->NewOffs;
+        NewSize  = U->NewSize;
+    }
+
+    if (I == Count) {
+        /* Behind the last unit */
+        unsigned Size = Orig? LongSize (U->F) : U->F->Size;
+        return Offs + (NewStart + (long) NewSize) - (Start + (long) Size);
+    } else if (Offs > Start) {
+        /* Inside the unit */
+        long Dist = Offs - Start;
+        return NewStart + ((Dist < (long) NewSize)? Dist : (long) NewSize);
+    } else {
+        /* In front of the unit */
+        return Offs + NewStart - Start;
+    }
+}
+
+
+
+static void FixUnits (const RelaxInfo* R, long From, long To)
+/* Fix all units that overlap the range From to To (exclusive). Used for
+** references that must keep their distance.
+*/
+{
+    unsigned I;
+    for (I = FindUnit (R, From, 0); I < CollCount (&R->Units); ++I) {
+        RelaxUnit* U = GetUnit (R, I);
+        if ((long) U->Offs >= To) {
+            break;
+        }
+        U->State = RU_FIXED;
+    }
+}
+
+
+
+static int IsLiteralTree (const ExprNode* E)
+/* Return true if the expression contains no leafs other than literals */
+{
+    if (E == 0) {
+        return 1;
+    } else if (EXPR_IS_LEAF (E->Op)) {
+        return E->Op == EXPR_LITERAL;
+    } else {
+        return IsLiteralTree (E->Left) && IsLiteralTree (E->Right);
+    }
+}
+
+
+
+static Section* GetSecPos (ExprNode* E, ExprNode** Offs)
+/* If E is a position in a section, that is, a section with an optional
+** constant offset, return the section and the node with the offset (NULL
+** if there's none). Otherwise return NULL.
+*/
+{
+    *Offs = 0;
+    if (E->Op == EXPR_SECTION) {
+        return GetExprSection (E);
+    } else if (E->Op == EXPR_PLUS) {
+        if (E->Left->Op == EXPR_SECTION && IsLiteralTree (E->Right)) {
+            *Offs = E->Right;
+            return GetExprSection (E->Left);
+        } else if (E->Right->Op == EXPR_SECTION && IsLiteralTree (E->Left)) {
+            *Offs = E->Left;
+            return GetExprSection (E->Right);
+        }
+    }
+    return 0;
+}
+
+
+
+static Section* GetPos (ExprNode* E, long* Offs)
+/* If E resolves to a position in a section, following symbols, return the
+** section and the offset. Otherwise return NULL.
+*/
+{
+    Section*  S = 0;
+    ExprNode* OffsNode;
+    Export*   Exp;
+
+    if (E->Op == EXPR_SYMBOL) {
+        Exp = GetExprExport (E);
+        if (Exp != 0 && Exp->Expr != 0 && !ExportHasMark (Exp)) {
+            MarkExport (Exp);
+            S = GetPos (Exp->Expr, Offs);
+            UnmarkExport (Exp);
+        }
+    } else if ((S = GetSecPos (E, &OffsNode)) != 0) {
+        *Offs = OffsNode? GetExprVal (OffsNode) : 0;
+    } else if (E->Op == EXPR_PLUS && IsLiteralTree (E->Right)) {
+        if ((S = GetPos (E->Left, Offs)) != 0) {
+            *Offs += GetExprVal (E->Right);
+        }
+    } else if (E->Op == EXPR_PLUS && IsLiteralTree (E->Left)) {
+        if ((S = GetPos (E->Right, Offs)) != 0) {
+            *Offs += GetExprVal (E->Left);
+        }
+    } else if (E->Op == EXPR_MINUS && IsLiteralTree (E->Right)) {
+        if ((S = GetPos (E->Left, Offs)) != 0) {
+            *Offs -= GetExprVal (E->Right);
+        }
+    }
+
+    return S;
+}
+
+
+
+static void MovePos (ExprNode* E, ExprNode* OffsNode, long NewOffs)
+/* Change the offset of the position E */
+{
+    if (OffsNode == 0) {
+        /* A bare section, add an offset */
+        ExprNode* Sec = NewExprNode (E->Obj, EXPR_SECTION);
+        Sec->V      = E->V;
+        E->Op       = EXPR_PLUS;
+        E->V.IVal   = 0;
+        E->Left     = Sec;
+        E->Right    = LiteralExpr (NewOffs, E->Obj);
+    } else {
+        /* Replace the offset by a literal */
+        FreeExpr (OffsNode->Left);
+        FreeExpr (OffsNode->Right);
+        OffsNode->Op    = EXPR_LITERAL;
+        OffsNode->Left  = 0;
+        OffsNode->Right = 0;
+        OffsNode->V.IVal = NewOffs;
+    }
+}
+
+
+
+static void WalkExpr (ExprNode* E, long Addend, int What)
+/* Walk over an expression and handle all positions in sections with
+** relaxable instructions. Addend is the constant that is added to the
+** expression by its parents.
+*/
+{
+    Section*  S;
+    ExprNode* OffsNode;
+
+    if (E == 0) {
+        return;
+    }
+
+    if (E->Op == EXPR_SYMBOL) {
+
+        /* The symbol is remapped where it is defined. But if something is
+        ** added to it, all units in between must keep their size.
+        */
+        long Offs;
+        if (What == WALK_CHECK && Addend != 0 &&
+            (S = GetPos (E, &Offs)) != 0 && S->Relax != 0) {
+            if (Addend > 0) {
+                FixUnits (S->Relax, Offs, Offs + Addend);
+            } else {
+                FixUnits (S->Relax, Offs + Addend, Offs);
+            }
+        }
+
+    } else if ((S = GetSecPos (E, &OffsNode)) != 0) {
+
+        /* A position in a section */
+        if (S->Relax != 0) {
+            long Offs = OffsNode? GetExprVal (OffsNode) : 0;
+            long Pos  = Offs + Addend;
+            if (What == WALK_CHECK) {
+                /* Fix the unit if the position points into it */
+                unsigned I = FindUnit (S->Relax, Pos, 0);
+                if (I < CollCount (&S->Relax->Units)) {
+                    RelaxUnit* U = GetUnit (S->Relax, I);
+                    if (Pos > (long) U->Offs) {
+                        U->State = RU_FIXED;
+                    }
+                }
+            } else {
+                long NewOffs = MapOffs (S->Relax, Pos, 0) - Addend;
+                if (NewOffs != Offs) {
+                    MovePos (E, OffsNode, NewOffs);
+                }
+            }
+        }
+
+    } else if (E->Op == EXPR_PLUS && IsLiteralTree (E->Right)) {
+        WalkExpr (E->Left, Addend + GetExprVal (E->Right), What);
+    } else if (E->Op == EXPR_PLUS && IsLiteralTree (E->Left)) {
+        WalkExpr (E->Right, Addend + GetExprVal (E->Left), What);
+    } else if (E->Op == EXPR_MINUS && IsLiteralTree (E->Right)) {
+        WalkExpr (E->Left, Addend - GetExprVal (E->Right), What);
+    } else {
+        /* The position of anything else is its own value */
+        WalkExpr (E->Left, 0, What);
+        WalkExpr (E->Right, 0, What);
+    }
+}
+
+
+
+static void WalkAllExprs (int What)
+/* Walk over all expressions that may contain positions. Positions in debug
+** symbols are remapped but don't fix any units, so the code doesn't depend
+** on the debug info.
+*/
+{
+    unsigned I, J;
+
+    for (I = 0; I < CollCount (&ObjDataList); ++I) {
+
+        ObjData* O = CollAtUnchecked (&ObjDataList, I);
+
+        /* Fragments */
+        for (J = 0; J < CollCount (&O->Sections); ++J) {
+            const Section* S = CollAtUnchecked (&O->Sections, J);
+            Fragment* F;
+            for (F = S->FragRoot; F; F = F->Next) {
+                WalkExpr (F->Expr, 0, What);
+            }
+        }
+
+        /* Exports */
+        for (J = 0; J < CollCount (&O->Exports); ++J) {
+            const Export* E = CollAtUnchecked (&O->Exports, J);
+            WalkExpr (E->Expr, 0, What);
+        }
+
+        /* Assertions */
+        for (J = 0; J < CollCount (&O->Assertions); ++J) {
+            WalkExpr (GetAssertionExpr (CollAtUnchecked (&O->Assertions, J)), 0, What);
+        }
+
+        /* Debug symbols */
+        if (What != WALK_CHECK) {
+            for (J = 0; J < CollCount (&O->DbgSyms); ++J) {
+                WalkExpr (GetDbgSymExpr (CollAtUnchecked (&O->DbgSyms, J)), 0, What);
+            }
+        }
+    }
+}
+
+
+
+static int CanEval (ExprNode* E)
+/* Return true if the expression can be evaluated with the tentative layout.
+** Contrary to IsConstExpr, this doesn't complain about circular references.
+*/
+{
+    Export*     Exp;
+    MemoryArea* M;
+    int         Ok;
+
+    if (E == 0) {
+        return 1;
+    }
+
+    switch (E->Op) {
+
+        case EXPR_LITERAL:
+            return 1;
+
+        case EXPR_SYMBOL:
+            Exp = GetExprExport (E);
+            if (Exp == 0 || Exp->Expr == 0 || ExportHasMark (Exp)) {
+                return 0;
+            }
+            MarkExport (Exp);
+            Ok = CanEval (Exp->Expr);
+            UnmarkExport (Exp);
+            return Ok;
+
+        case EXPR_SECTION:
+            M = GetExprSection (E)->Seg->MemArea;
+            return M != 0 && (M->Flags & MF_PLACED) != 0 && !M->Relocatable;
+
+        case EXPR_SEGMENT:
+            M = E->V.Seg->MemArea;
+            return M != 0 && (M->Flags & MF_PLACED) != 0 && !M->Relocatable;
+
+        case EXPR_MEMAREA:
+            M = E->V.Mem;
+            return (M->Flags & MF_PLACED) != 0 && !M->Relocatable;
+
+        case EXPR_BANK:
+            /* Depends on more than the layout */
+            return 0;
+
+        case EXPR_DIV:
+        case EXPR_MOD:
+            return CanEval (E->Left) && CanEval (E->Right) &&
+                   GetExprVal (E->Right) != 0;
+
+        default:
+            if (EXPR_IS_LEAF (E->Op)) {
+                return 0;
+            }
+            return CanEval (E->Left) && CanEval (E->Right);
+    }
+}
+
+
+
+static int IsZPExpr (ExprNode* E)
+/* Return true if all symbols and sections in the expression are zero page */
+{
+    Export* Exp;
+
+    if (E == 0) {
+        return 1;
+    }
+
+    switch (E->Op) {
+
+        case EXPR_LITERAL:
+            return 1;
+
+        case EXPR_SYMBOL:
+            Exp = GetExprExport (E);
+            return Exp != 0 && Exp->AddrSize == ADDR_SIZE_ZP;
+
+        case EXPR_SECTION:
+            return GetExprSection (E)->AddrSize == ADDR_SIZE_ZP;
+
+        default:
+            if (EXPR_IS_LEAF (E->Op)) {
+                return 0;
+            }
+            return IsZPExpr (E->Left) && IsZPExpr (E->Right);
+    }
+}
+
+
+
+static int CanShorten (const RelaxUnit* U)
+/* Return true if the short form of the instruction may be used with the
+** tentative layout.
+*/
+{
+    const Fragment* F = U->F;
+    const Section*  S = F->Sec;
+    MemoryArea*     M;
+    long            Val;
+
+    if (!CanEval (F->Expr)) {
+        return 0;
+    }
+    Val = GetExprVal (F->Expr);
+
+    switch (F->LitBuf[RELAX_BUF_KIND]) {
+
+        case RELAX_ZP:
+            return Val >= 0 && Val <= 0xFF;
+
+        case RELAX_ZP_IND:
+            /* Indexed zero page addressing wraps around within the zero
+            ** page, so the address must be meant as a zero page one.
+            */
+            return Val >= 0 && Val <= 0xFF && IsZPExpr (F->Expr);
+
+        case RELAX_BRANCH:
+            M = S->Seg->MemArea;
+            if (M == 0 || (M->Flags & MF_PLACED) == 0 || M->Relocatable) {
+                return 0;
+            }
+            Val -= (long) (S->Seg->PC + S->Offs + U->Offs + 2);
+            return Val >= -128 && Val <= 127;
+
+        default:
+            return 0;
+    }
+}
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void RelaxAddFragment (Fragment* F, unsigned long Offs)
+/* Remember a relaxable fragment at offset Offs of its section */
+{
+    RelaxUnit* U;
+    Section*   S = F->Sec;
+
+    /* Get the info for the section */
+    if (S->Relax == 0) {
+        S->Relax = xmalloc (sizeof (RelaxInfo));
+        S->Relax->Sec   = S;
+        S->Relax->Units = EmptyCollection;
+        CollAppend (&RelaxInfos, S->Relax);
+    }
+
+    /* Add the unit */
+    U = xmalloc (sizeof (RelaxUnit));
+    U->F        = F;
+    U->OrigOffs = Offs;
+    U->Offs     = Offs;
+    U->NewOffs  = Offs;
+    U->NewSize  = F->Size;
+    U->State    = RU_LONG;
+    CollAppend (&S->Relax->Units, U);
+}
+
+
+
+int RelaxPrepare (void)
+/* Prepare relaxation. Instructions with references into them are never
+** changed. Return true if there's anything left that may be shortened.
+*/
+{
+    unsigned I, J;
+
+    /* Fix the instructions with references into them */
+    WalkAllExprs (WALK_CHECK);
+
+    /* Sections that were removed as unused don't need any work */
+    for (I = 0; I < CollCount (&RelaxInfos); ++I) {
+        const RelaxInfo* R = CollAtUnchecked (&RelaxInfos, I);
+        if (!R->Sec->Live) {
+            for (J = 0; J < CollCount (&R->Units); ++J) {
+                GetUnit (R, J)->State = RU_FIXED;
+            }
+        }
+    }
+
+    /* Check if anything is left */
+    for (I = 0; I < CollCount (&RelaxInfos); ++I) {
+        const RelaxInfo* R = CollAtUnchecked (&RelaxInfos, I);
+        for (J = 0; J < CollCount (&R->Units); ++J) {
+            if (GetUnit (R, J)->State != RU_FIXED) {
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+
+
+int RelaxPass (void)
+/* Decide about the form of all instructions using the current tentative
+** addresses of the segments and update the layout of the segments. Return
+** true if anything has changed, in which case the segments must be placed
+** again and another pass is needed.
+*/
+{
+    unsigned I, J;
+    int      Changed = 0;
+
+    ++PassCount;
+
+    /* Decide about the instructions. If an instruction in its short form
+    ** doesn't fit any longer, it's fixed in its long form, so the passes
+    ** will come to an end.
+    */
+    for (I = 0; I < CollCount (&RelaxInfos); ++I) {
+        const RelaxInfo* R = CollAtUnchecked (&RelaxInfos, I);
+        for (J = 0; J < CollCount (&R->Units); ++J) {
+            RelaxUnit* U = GetUnit (R, J);
+            U->NewSize = U->F->Size;
+            if (U->State == RU_LONG && CanShorten (U)) {
+                U->State   = RU_SHORT;
+                U->NewSize = 2;
+                Changed    = 1;
+            } else if (U->State == RU_SHORT && !CanShorten (U)) {
+                U->State   = RU_FIXED;
+                U->NewSize = LongSize (U->F);
+                Changed    = 1;
+            }
+        }
+    }
+    if (!Changed) {
+        return 0;
+    }
+
+    /* Calculate the new offsets */
+    for (I = 0; I < CollCount (&RelaxInfos); ++I) {
+        const RelaxInfo* R = CollAtUnchecked (&RelaxInfos, I);
+        long Delta = 0;
+        for (J = 0; J < CollCount (&R->Units); ++J) {
+            RelaxUnit* U = GetUnit (R, J);
+            U->NewOffs = U->Offs + Delta;
+            Delta += (long) U->NewSize - (long) U->F->Size;
+        }
+    }
+
+    /* Move all positions in expressions */
+    WalkAllExprs (WALK_REMAP);
+
+    /* Apply the changes */
+    for (I = 0; I < CollCount (&RelaxInfos); ++I) {
+        const RelaxInfo* R = CollAtUnchecked (&RelaxInfos, I);
+        for (J = 0; J < CollCount (&R->Units); ++J) {
+            RelaxUnit* U = GetUnit (R, J);
+            R->Sec->Size += U->NewSize;
+            R->Sec->Size -= U->F->Size;
+            U->F->Size    = U->NewSize;
+            U->Offs       = U->NewOffs;
+        }
+        SegPlaceSections (R->Sec->Seg);
+    }
+
+    /* We need another pass */
+    return 1;
+}
+
+
+
+void RelaxDone (void)
+/* Finish relaxation once the layout is stable */
+{
+    unsigned I, J;
+    unsigned ZPCount     = 0;
+    unsigned BranchCount = 0;
+    unsigned long Bytes  = 0;
+    unsigned long Cycles = 0;
+
+    /* Adjust the debug info */
+    RelaxSpans ();
+
+    /* Tell the user what we did */
+    for (I = 0; I < CollCount (&RelaxInfos); ++I) {
+        const RelaxInfo* R = CollAtUnchecked (&RelaxInfos, I);
+        for (J = 0; J < CollCount (&R->Units); ++J) {
+            const RelaxUnit* U = GetUnit (R, J);
+            if (U->State != RU_SHORT) {
+                continue;
+            }
+            Bytes += LongSize (U->F) - 2;
+            switch (U->F->LitBuf[RELAX_BUF_KIND]) {
+
+                case RELAX_ZP:
+                    /* One cycle less for each access */
+                    ++ZPCount;
+                    ++Cycles;
+                    break;
+
+                case RELAX_ZP_IND:
+                    /* Page crossing penalty only */
+                    ++ZPCount;
+                    break;
+
+                case RELAX_BRANCH:
+                    /* A branch over a jump saves at least one cycle, a
+                    ** jump replaced by BRA doesn't save anything for sure.
+                    */
+                    ++BranchCount;
+                    if (LongSize (U->F) == 5) {
+                        ++Cycles;
+                    }
+                    break;
+            }
+        }
+    }
+    Print (stdout, 1,
+           "Relaxation took %u pass%s: %u zero page and %u branch "
+           "instruction%s shortened, %lu bytes and at least %lu cycles saved\n",
+           PassCount, (PassCount == 1)? "" : "es",
+           ZPCount, BranchCount, (BranchCount == 1)? "" : "s",
+           Bytes, Cycles);
+}
+
+
+
+unsigned long RelaxMapOffs (const Section* S, unsigned long Offs)
+/* Map an offset in a section as read from the object file to its offset in
+** the final layout.
+*/
+{
+    return (S->Relax == 0)? Offs : (unsigned long) MapOffs (S->Relax, Offs, 1);
+}
@@ -0,0 +1,99 @@
+/*****************************************************************************/
+/*                                                                           */
+/*                                  relax.h                                  */
+/*                                                                           */
+/*               Shorten instructions once addresses are known               */
+/*                                                                           */
+/*                                                                           */
+/*                                                                           */
+/* (C) 2026, The cc65 Authors                                                */
+/*                                                                           */
+/*                                                                           */
+/* This software is provided 'as-is', without any expressed or implied       */
+/* warranty.  In no event will the authors be held liable for any damages    */
+/* arising from the use of this software.                                    */
+/*                                                                           */
+/* Permission is granted to anyone to use this software for any purpose,     */
+/* including commercial applications, and to alter it and redistribute it    */
+/* freely, subject to the following restrictions:                            */
+/*                                                                           */
+/* 1. The origin of this software must not be misrepresented; you must not   */
+/*    claim that you wrote the original software. If you use this software   */
+/*    in a product, an acknowledgment in the product documentation would be  */
+/*    appreciated but is not required.                                       */
+/* 2. Altered source versions must be plainly marked as such, and must not   */
+/*    be misrepresented as being the original software.                      */
+/* 3. This notice may not be removed or altered from any source              */
+/*    distribution.                                                          */
+/*                                                                           */
+/*****************************************************************************/
+
+
+
+#ifndef RELAX_H
+#define RELAX_H
+
+
+
+/*****************************************************************************/
+/*                                 Forwards                                  */
+/*****************************************************************************/
+
+
+
+struct Fragment;
+struct Section;
+
+
+
+/*****************************************************************************/
+/*                                   Data                                    */
+/*****************************************************************************/
+
+
+
+/* Layout of the literal buffer of a FRAG_RELAX fragment. The size of the
+** fragment is two if the short form is used, otherwise it's the size of the
+** long form.
+*/
+#define RELAX_BUF_KIND          0       /* Kind of relaxation, RELAX_xxx */
+#define RELAX_BUF_LONGSIZE      1       /* Size of the long form */
+#define RELAX_BUF_SHORTOPC      2       /* Opcode of the short form */
+#define RELAX_BUF_LONGOPC       3       /* Opcode bytes of the long form */
+
+
+
+/*****************************************************************************/
+/*                                   Code                                    */
+/*****************************************************************************/
+
+
+
+void RelaxAddFragment (struct Fragment* F, unsigned long Offs);
+/* Remember a relaxable fragment at offset Offs of its section */
+
+int RelaxPrepare (void);
+/* Prepare relaxation. Instructions with references into them are never
+** changed. Return true if there's anything left that may be shortened.
+*/
+
+int RelaxPass (void);
+/* Decide about the form of all instructions using the current tentative
+** addresses of the segments and update the layout of the segments. Return
+** true if anything has changed, in which case the segments must be placed
+** again and another pass is needed.
+*/
+
+void RelaxDone (void);
+/* Finish relaxation once the layout is stable */
+
+unsigned long RelaxMapOffs (const struct Section* S, unsigned long Offs);
+/* Map an offset in a section as read from the object file to its offset in
+** the final layout.
+*/
+
+
+
+/* End of relax.h */
+
+#endif
@@ -42,6 +42,7 @@
 /* common */
 #include "chartype.h"
 #include "strbuf.h"
+#include "textfile.h"
 #include "xsprintf.h"
 
 /* ld65 */
@@ -72,7 +73,7 @@ static const char*      CfgName         = 0;
 /* Other input stuff */
 static int              C               = ' ';
 static FilePos          InputPos;
-static FILE*            InputFile       = 0;
+static TextFile*        InputFile       = 0;
 
 
 
@@ -126,7 +127,7 @@ static void NextChar (void)
 /* Read the next character from the input file */
 {
     /* Read from the file */
-    C = getc (InputFile);
+    C = TF_GetChar (InputFile);
 
     /* Count columns */
     if (C != EOF) {
@@ -554,7 +555,7 @@ void CfgOpenInput (void)
 /* Open the input file if we have one */
 {
     /* Open the file */
-    InputFile = fopen (CfgName, "r");
+    InputFile = ReadTextFile (CfgName);
     if (InputFile == 0) {
         Error ("Cannot open `%s': %s", CfgName, strerror (errno));
     }
@@ -574,9 +575,9 @@ void CfgOpenInput (void)
 void CfgCloseInput (void)
 /* Close the input file if we have one */
 {
-    /* Close the input file if we had one */
+    /* Free the input file if we had one */
     if (InputFile) {
-        (void) fclose (InputFile);
+        FreeTextFile (InputFile);
         InputFile = 0;
     }
 }
@@ -98,6 +98,7 @@ typedef enum {
     CFGTOK_RUN,
     CFGTOK_ALIGN,
     CFGTOK_ALIGN_LOAD,
+    CFGTOK_COMPRESS,
     CFGTOK_OFFSET,
     CFGTOK_OPTIONAL,
 
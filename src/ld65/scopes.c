@@ -34,9 +34,11 @@
 
 
 /* common */
+#include "dbgdefs.h"
 #include "xmalloc.h"
 
 /* ld65 */
+#include "dbgfile.h"
 #include "error.h"
 #include "fileio.h"
 #include "scopes.h"
@@ -171,3 +173,39 @@ void PrintDbgScopes (FILE* F)
         }
     }
 }
+
+
+
+void CollectDbgScopes (void)
+/* Add the scopes to a binary debug info file */
+{
+    unsigned I, J;
+
+    for (I = 0; I < CollCount (&ObjDataList); ++I) {
+
+        /* Get the object file */
+        ObjData* O = CollAtUnchecked (&ObjDataList, I);
+
+        /* Add the scopes for this object file */
+        for (J = 0; J < CollCount (&O->Scopes); ++J) {
+
+            /* Get the scope and its record */
+            const Scope*   S   = CollConstAt (&O->Scopes, J);
+            unsigned long* Rec = DbgBinRecord (DBG_KIND_SCOPE, O->ScopeBaseId + S->Id);
+
+            if (S->Type > SCOPE_ENUM) {
+                Error ("Module `%s': Unknown scope type %u",
+                       GetObjFileName (O), S->Type);
+            }
+            Rec[DBG_SCOPE_NAME]   = DbgBinStr (GetString (S->Name));
+            Rec[DBG_SCOPE_MOD]    = I;
+            Rec[DBG_SCOPE_TYPE]   = S->Type;
+            Rec[DBG_SCOPE_SIZE]   = S->Size;
+            Rec[DBG_SCOPE_PARENT] = (S->Id != S->ParentId)?
+                                    O->ScopeBaseId + S->ParentId : DBG_INV_ID;
+            Rec[DBG_SCOPE_SYM]    = SCOPE_HAS_LABEL (S->Flags)?
+                                    O->SymBaseId + S->LabelId : DBG_INV_ID;
+            CollectDbgSpanList (Rec, DBG_SCOPE_SPANS, O, S->Spans);
+        }
+    }
+}
@@ -87,6 +87,9 @@ unsigned ScopeCount (void);
 void PrintDbgScopes (FILE* F);
 /* Output the scopes to a debug info file */
 
+void CollectDbgScopes (void);
+/* Add the scopes to a binary debug info file */
+
 
 
 /* End of scopes.h */
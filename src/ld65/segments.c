@@ -39,8 +39,10 @@
 /* common */
 #include "addrsize.h"
 #include "alignment.h"
+#include "attrib.h"
 #include "check.h"
 #include "coll.h"
+#include "dbgdefs.h"
 #include "exprdefs.h"
 #include "fragdefs.h"
 #include "hashfunc.h"
@@ -50,12 +52,14 @@
 #include "xmalloc.h"
 
 /* ld65 */
+#include "dbgfile.h"
 #include "error.h"
 #include "expr.h"
 #include "fileio.h"
 #include "fragment.h"
 #include "global.h"
 #include "lineinfo.h"
+#include "relax.h"
 #include "segments.h"
 #include "spool.h"
 
@@ -169,7 +173,10 @@ Section* NewSection (Segment* Seg, unsigned long Alignment, unsigned char AddrSi
     S->FragLast = 0;
     S->Size     = 0;
     S->Alignment= Alignment;
+    S->Relax    = 0;
+    S->Flags    = SEG_FLAG_NONE;
     S->AddrSize = AddrSize;
+    S->Live     = 1;
 
     /* Calculate the alignment bytes needed for the section */
     S->Fill = AlignCount (Seg->Size, S->Alignment);
@@ -191,6 +198,7 @@ Section* ReadSection (FILE* F, ObjData* O)
 /* Read a section from a file */
 {
     unsigned      Name;
+    unsigned      Flags;
     unsigned      Size;
     unsigned long Alignment;
     unsigned char Type;
@@ -201,7 +209,7 @@ Section* ReadSection (FILE* F, ObjData* O)
     /* Read the segment data */
     (void) Read32 (F);          /* File size of data */
     Name      = MakeGlobalStringId (O, ReadVar (F));    /* Segment name */
-                ReadVar (F);    /* Segment flags (currently unused) */
+    Flags     = ReadVar (F);    /* Segment flags */
     Size      = ReadVar (F);    /* Size of data */
     Alignment = ReadVar (F);    /* Alignment */
     Type      = Read8 (F);      /* Segment type */
@@ -220,7 +228,8 @@ Section* ReadSection (FILE* F, ObjData* O)
     Sec = NewSection (S, Alignment, Type);
 
     /* Remember the object file this section was from */
-    Sec->Obj = O;
+    Sec->Obj   = O;
+    Sec->Flags = Flags;
 
     /* Set up the combined segment alignment */
     if (Sec->Alignment > 1) {
@@ -269,6 +278,20 @@ Section* ReadSection (FILE* F, ObjData* O)
                 Frag = NewFragment (Type, ReadVar (F), Sec);
                 break;
 
+            case FRAG_RELAX:
+                if (Bytes != 3 && Bytes != 5) {
+                    Error ("Invalid relaxable fragment in module `%s', segment `%s'",
+                           GetObjFileName (O), GetString (S->Name));
+                }
+                Frag = NewFragment (Type, Bytes, Sec);
+                Frag->LitBuf[RELAX_BUF_KIND]     = Read8 (F);
+                Frag->LitBuf[RELAX_BUF_LONGSIZE] = Bytes;
+                Frag->LitBuf[RELAX_BUF_SHORTOPC] = Read8 (F);
+                ReadData (F, Frag->LitBuf + RELAX_BUF_LONGOPC, Bytes - 2);
+                Frag->Expr = ReadExpr (F, O);
+                RelaxAddFragment (Frag, Sec->Size - Bytes);
+                break;
+
             default:
                 Error ("Unknown fragment type in module `%s', segment `%s': %02X",
                        GetObjFileName (O), GetString (S->Name), Type);
@@ -289,6 +312,23 @@ Section* ReadSection (FILE* F, ObjData* O)
 
 
 
+void SegPlaceSections (Segment* S)
+/* Recalculate the offsets of the sections in a segment and its size */
+{
+    unsigned I;
+
+    S->Size = 0;
+    for (I = 0; I < CollCount (&S->Sections); ++I) {
+        Section* Sec = CollAtUnchecked (&S->Sections, I);
+        Sec->Fill = AlignCount (S->Size, Sec->Alignment);
+        S->Size  += Sec->Fill;
+        Sec->Offs = S->Size;
+        S->Size  += Sec->Size;
+    }
+}
+
+
+
 Segment* SegFind (unsigned Name)
 /* Return the given segment or NULL if not found. */
 {
@@ -333,6 +373,9 @@ int IsBSSType (Segment* S)
                 if (GetExprVal (F->Expr) != 0) {
                     return 0;
                 }
+            } else if (F->Type == FRAG_RELAX) {
+                /* Contains an opcode */
+                return 0;
             }
             F = F->Next;
         }
@@ -392,6 +435,13 @@ void SegDump (void)
                         printf ("    Empty space (%u bytes)\n", F->Size);
                         break;
 
+                    case FRAG_RELAX:
+                        printf ("    Relaxable instruction (%u bytes, kind %u):\n",
+                                F->Size, F->LitBuf[RELAX_BUF_KIND]);
+                        printf ("      ");
+                        DumpExpr (F->Expr, 0);
+                        break;
+
                     default:
                         Internal ("Invalid fragment type: %02X", F->Type);
                 }
@@ -403,9 +453,9 @@ void SegDump (void)
 
 
 
-unsigned SegWriteConstExpr (FILE* F, ExprNode* E, int Signed, unsigned Size)
-/* Write a supposedly constant expression to the target file. Do a range
-** check and return one of the SEG_EXPR_xxx codes.
+static unsigned CheckConstExpr (ExprNode* E, int Signed, unsigned Size, long* Val)
+/* Evaluate a supposedly constant expression into Val. Do a range check and
+** return one of the SEG_EXPR_xxx codes.
 */
 {
     static const unsigned long U_Hi[4] = {
@@ -420,47 +470,98 @@ unsigned SegWriteConstExpr (FILE* F, ExprNode* E, int Signed, unsigned Size)
 
 
     /* Get the expression value */
-    long Val = GetExprVal (E);
+    *Val = GetExprVal (E);
 
     /* Check the size */
     CHECK (Size >= 1 && Size <= 4);
 
     /* Check for a range error */
     if (Signed) {
-        if (Val > S_Hi[Size-1] || Val < S_Lo[Size-1]) {
+        if (*Val > S_Hi[Size-1] || *Val < S_Lo[Size-1]) {
             /* Range error */
             return SEG_EXPR_RANGE_ERROR;
         }
     } else {
-        if (((unsigned long)Val) > U_Hi[Size-1]) {
+        if (((unsigned long) *Val) > U_Hi[Size-1]) {
             /* Range error */
             return SEG_EXPR_RANGE_ERROR;
         }
     }
 
-    /* Write the value to the file */
-    WriteVal (F, Val, Size);
-
     /* Success */
     return SEG_EXPR_OK;
 }
 
 
 
-void SegWrite (const char* TgtName, FILE* Tgt, Segment* S, SegWriteFunc F, void* Data)
-/* Write the data from the given segment to a file. For expressions, F is
-** called (see description of SegWriteFunc above).
+unsigned SegWriteConstExpr (FILE* F, ExprNode* E, int Signed, unsigned Size)
+/* Write a supposedly constant expression to the target file. Do a range
+** check and return one of the SEG_EXPR_xxx codes.
+*/
+{
+    long Val;
+    unsigned Res = CheckConstExpr (E, Signed, Size, &Val);
+
+    /* Write the value to the file */
+    if (Res == SEG_EXPR_OK) {
+        WriteVal (F, Val, Size);
+    }
+    return Res;
+}
+
+
+
+static void TgtWrite8 (FILE* Tgt, StrBuf* Buf, unsigned Val)
+/* Write a byte to the file Tgt, or append it to Buf if Tgt is NULL */
+{
+    if (Tgt) {
+        Write8 (Tgt, Val);
+    } else {
+        SB_AppendChar (Buf, (char) Val);
+    }
+}
+
+
+
+static void TgtWriteData (FILE* Tgt, StrBuf* Buf, const void* Data, unsigned Size)
+/* Write data to the file Tgt, or append it to Buf if Tgt is NULL */
+{
+    if (Tgt) {
+        WriteData (Tgt, Data, Size);
+    } else {
+        SB_AppendBuf (Buf, Data, Size);
+    }
+}
+
+
+
+static void TgtWriteMult (FILE* Tgt, StrBuf* Buf, unsigned char Val,
+                          unsigned long Count)
+/* Write Count bytes with the value Val to the file Tgt, or append them to Buf
+** if Tgt is NULL.
+*/
+{
+    if (Tgt) {
+        WriteMult (Tgt, Val, Count);
+    } else {
+        while (Count--) {
+            SB_AppendChar (Buf, Val);
+        }
+    }
+}
+
+
+
+static void WriteSegData (FILE* Tgt, StrBuf* Buf, Segment* S,
+                          SegWriteFunc F, void* Data)
+/* Write the data from the given segment to the file Tgt, or append it to Buf
+** if Tgt is NULL. For expressions, F is called.
 */
 {
     unsigned      I;
     int           Sign;
     unsigned long Offs = 0;
 
-
-    /* Remember the output file and offset for the segment */
-    S->OutputName = TgtName;
-    S->OutputOffs = (unsigned long) ftell (Tgt);
-
     /* Loop over all sections in this segment */
     for (I = 0; I < CollCount (&S->Sections); ++I) {
 
@@ -478,60 +579,87 @@ void SegWrite (const char* TgtName, FILE* Tgt, Segment* S, SegWriteFunc F, void*
         FillVal = (I == 0)? S->MemArea->FillVal : S->FillVal;
         Print (stdout, 2, "        Filling 0x%lx bytes with 0x%02x\n",
                Sec->Fill, FillVal);
-        WriteMult (Tgt, FillVal, Sec->Fill);
+        TgtWriteMult (Tgt, Buf, FillVal, Sec->Fill);
         Offs += Sec->Fill;
 
         /* Loop over all fragments in this section */
         Frag = Sec->FragRoot;
         while (Frag) {
 
+            /* Assume there's no expression */
+            unsigned Res = SEG_EXPR_OK;
+
             /* Output fragment data */
             switch (Frag->Type) {
 
                 case FRAG_LITERAL:
-                    WriteData (Tgt, Frag->LitBuf, Frag->Size);
+                    TgtWriteData (Tgt, Buf, Frag->LitBuf, Frag->Size);
                     break;
 
                 case FRAG_EXPR:
                 case FRAG_SEXPR:
                     Sign = (Frag->Type == FRAG_SEXPR);
-                    /* Call the users function and evaluate the result */
-                    switch (F (Frag->Expr, Sign, Frag->Size, Offs, Data)) {
-
-                        case SEG_EXPR_OK:
-                            break;
-
-                        case SEG_EXPR_RANGE_ERROR:
-                            Error ("Range error in module `%s', line %u",
-                                   GetFragmentSourceName (Frag),
-                                   GetFragmentSourceLine (Frag));
-                            break;
-
-                        case SEG_EXPR_TOO_COMPLEX:
-                            Error ("Expression too complex in module `%s', line %u",
-                                   GetFragmentSourceName (Frag),
-                                   GetFragmentSourceLine (Frag));
-                            break;
-
-                        case SEG_EXPR_INVALID:
-                            Error ("Invalid expression in module `%s', line %u",
-                                   GetFragmentSourceName (Frag),
-                                   GetFragmentSourceLine (Frag));
-                            break;
-
-                        default:
-                            Internal ("Invalid return code from SegWriteFunc");
+                    /* Call the users function */
+                    Res = F (Frag->Expr, Sign, Frag->Size, Offs, Data);
+                    break;
+
+                case FRAG_RELAX:
+                    if (Frag->Size == 2) {
+                        /* The short form */
+                        TgtWrite8 (Tgt, Buf, Frag->LitBuf[RELAX_BUF_SHORTOPC]);
+                        if (Frag->LitBuf[RELAX_BUF_KIND] == RELAX_BRANCH) {
+                            /* The distance was checked when relaxing */
+                            long Dist = GetExprVal (Frag->Expr) - (long) (S->PC + Offs + 2);
+                            if (Dist < -128 || Dist > 127) {
+                                Res = SEG_EXPR_RANGE_ERROR;
+                            }
+                            TgtWrite8 (Tgt, Buf, (unsigned char) Dist);
+                        } else {
+                            Res = F (Frag->Expr, 0, 1, Offs + 1, Data);
+                        }
+                    } else {
+                        /* The long form */
+                        TgtWriteData (Tgt, Buf, Frag->LitBuf + RELAX_BUF_LONGOPC, Frag->Size - 2);
+                        Res = F (Frag->Expr, 0, 2, Offs + Frag->Size - 2, Data);
                     }
                     break;
 
                 case FRAG_FILL:
-                    WriteMult (Tgt, S->FillVal, Frag->Size);
+                    TgtWriteMult (Tgt, Buf, S->FillVal, Frag->Size);
                     break;
 
                 default:
                     Internal ("Invalid fragment type: %02X", Frag->Type);
             }
 
+            /* Evaluate the result of an expression */
+            switch (Res) {
+
+                case SEG_EXPR_OK:
+                    break;
+
+                case SEG_EXPR_RANGE_ERROR:
+                    Error ("Range error in module `%s', line %u",
+                           GetFragmentSourceName (Frag),
+                           GetFragmentSourceLine (Frag));
+                    break;
+
+                case SEG_EXPR_TOO_COMPLEX:
+                    Error ("Expression too complex in module `%s', line %u",
+                           GetFragmentSourceName (Frag),
+                           GetFragmentSourceLine (Frag));
+                    break;
+
+                case SEG_EXPR_INVALID:
+                    Error ("Invalid expression in module `%s', line %u",
+                           GetFragmentSourceName (Frag),
+                           GetFragmentSourceLine (Frag));
+                    break;
+
+                default:
+                    Internal ("Invalid return code from SegWriteFunc");
+            }
+
             /* Update the offset */
             Print (stdout, 2, "        Fragment with 0x%x bytes\n",
                    Frag->Size);
@@ -545,6 +673,51 @@ void SegWrite (const char* TgtName, FILE* Tgt, Segment* S, SegWriteFunc F, void*
 
 
 
+void SegWrite (const char* TgtName, FILE* Tgt, Segment* S, SegWriteFunc F, void* Data)
+/* Write the data from the given segment to a file. For expressions, F is
+** called (see description of SegWriteFunc above).
+*/
+{
+    /* Remember the output file and offset for the segment */
+    S->OutputName = TgtName;
+    S->OutputOffs = (unsigned long) ftell (Tgt);
+
+    /* Write the data */
+    WriteSegData (Tgt, 0, S, F, Data);
+}
+
+
+
+static unsigned GetDataExpr (ExprNode* E, int Signed, unsigned Size,
+                             unsigned long Offs attribute ((unused)),
+                             void* Data)
+/* Called from SegWrite for an expression when getting the segment data */
+{
+    long Val;
+    unsigned Res = CheckConstExpr (E, Signed, Size, &Val);
+
+    /* Append the value to the buffer, low byte first */
+    if (Res == SEG_EXPR_OK) {
+        while (Size--) {
+            SB_AppendChar ((StrBuf*) Data, (char) (Val & 0xFF));
+            Val >>= 8;
+        }
+    }
+    return Res;
+}
+
+
+
+void SegGetData (StrBuf* Buf, Segment* S)
+/* Append the data of a placed segment to Buf, as it would be written to the
+** output file.
+*/
+{
+    WriteSegData (0, Buf, S, GetDataExpr, Buf);
+}
+
+
+
 unsigned SegmentCount (void)
 /* Return the total number of segments */
 {
@@ -644,6 +817,32 @@ void PrintDbgSegments (FILE* F)
 
 
 
+void CollectDbgSegments (void)
+/* Add the segments to a binary debug file */
+{
+    unsigned I;
+
+    for (I = 0; I < CollCount (&SegmentList); ++I) {
+
+        /* Get the next segment and its record */
+        const Segment* S   = CollAtUnchecked (&SegmentList, I);
+        unsigned long* Rec = DbgBinRecord (DBG_KIND_SEG, S->Id);
+
+        Rec[DBG_SEG_NAME]  = DbgBinStr (GetString (S->Name));
+        Rec[DBG_SEG_START] = S->PC;
+        Rec[DBG_SEG_SIZE]  = S->Size;
+        if (S->OutputName) {
+            Rec[DBG_SEG_ONAME] = DbgBinStr (S->OutputName);
+            Rec[DBG_SEG_OOFFS] = S->OutputOffs;
+        } else {
+            Rec[DBG_SEG_ONAME] = DBG_INV_ID;
+            Rec[DBG_SEG_OOFFS] = 0;
+        }
+    }
+}
+
+
+
 void CheckSegments (void)
 /* Walk through the segment list and check if there are segments that were
 ** not written to the output file. Output an error if this is the case.
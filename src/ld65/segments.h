@@ -43,6 +43,7 @@
 /* common */
 #include "coll.h"
 #include "exprdefs.h"
+#include "strbuf.h"
 
 
 
@@ -54,6 +55,7 @@
 
 /* Forwards */
 struct MemoryArea;
+struct RelaxInfo;
 
 /* Segment structure */
 typedef struct Segment Segment;
@@ -89,7 +91,10 @@ struct Section {
     unsigned long       Size;           /* Size of the section */
     unsigned long       Fill;           /* Fill bytes for alignment */
     unsigned long       Alignment;      /* Alignment */
+    struct RelaxInfo*   Relax;          /* Relaxable instructions or NULL */
+    unsigned char       Flags;          /* Section flags */
     unsigned char       AddrSize;       /* Address size of segment */
+    unsigned char       Live;           /* Not removed as unused */
 };
 
 
@@ -128,6 +133,9 @@ Section* NewSection (Segment* Seg, unsigned long Alignment, unsigned char AddrSi
 Section* ReadSection (FILE* F, struct ObjData* O);
 /* Read a section from a file */
 
+void SegPlaceSections (Segment* S);
+/* Recalculate the offsets of the sections in a segment and its size */
+
 Segment* SegFind (unsigned Name);
 /* Return the given segment or NULL if not found. */
 
@@ -149,6 +157,11 @@ void SegWrite (const char* TgtName, FILE* Tgt, Segment* S, SegWriteFunc F, void*
 ** called (see description of SegWriteFunc above).
 */
 
+void SegGetData (StrBuf* Buf, Segment* S);
+/* Append the data of a placed segment to Buf, as it would be written to the
+** output file.
+*/
+
 unsigned SegmentCount (void);
 /* Return the total number of segments */
 
@@ -158,6 +171,9 @@ void PrintSegmentMap (FILE* F);
 void PrintDbgSegments (FILE* F);
 /* Output the segments to the debug file */
 
+void CollectDbgSegments (void);
+/* Add the segments to a binary debug file */
+
 void CheckSegments (void);
 /* Walk through the segment list and check if there are segments that were
 ** not written to the output file. Output an error if this is the case.
@@ -34,12 +34,17 @@
 
 
 /* common */
+#include "dbgdefs.h"
 #include "gentype.h"
 #include "xmalloc.h"
 
 /* ld65 */
+#include "dbgfile.h"
 #include "fileio.h"
+#include "lineinfo.h"
 #include "objdata.h"
+#include "relax.h"
+#include "scopes.h"
 #include "segments.h"
 #include "span.h"
 #include "tpool.h"
@@ -52,6 +57,9 @@
 
 
 
+/* Id of a removed span */
+#define INVALID_SPAN_ID         (~0U)
+
 /* Definition of a span */
 struct Span {
     unsigned            Id;             /* Id of the span */
@@ -165,6 +173,89 @@ void FreeSpan (Span* S)
 
 
 
+void RelaxSpans (void)
+/* Adjust the spans after instructions were shortened by relaxation */
+{
+    unsigned I, J;
+
+    for (I = 0; I < CollCount (&ObjDataList); ++I) {
+
+        /* Get this object file */
+        const ObjData* O = CollAtUnchecked (&ObjDataList, I);
+
+        /* Map the start and end of all spans */
+        for (J = 0; J < CollCount (&O->Spans); ++J) {
+            Span* S = CollAtUnchecked (&O->Spans, J);
+            const Section* Sec = GetObjSection (O, S->Sec);
+            unsigned long End = RelaxMapOffs (Sec, S->Offs + S->Size);
+            S->Offs = RelaxMapOffs (Sec, S->Offs);
+            S->Size = End - S->Offs;
+        }
+    }
+}
+
+
+
+static void RemapSpanList (unsigned* List, const unsigned* Map)
+/* Replace the span ids in a list by the ones from Map. Spans mapped to
+** INVALID_SPAN_ID are removed from the list.
+*/
+{
+    if (List) {
+        unsigned I, J;
+        for (I = 0, J = 0; I < *List; ++I) {
+            unsigned Id = Map[List[I+1]];
+            if (Id != INVALID_SPAN_ID) {
+                List[++J] = Id;
+            }
+        }
+        *List = J;
+    }
+}
+
+
+
+void RemoveSpans (void)
+/* Remove the spans of sections that were removed as unused */
+{
+    unsigned I, J;
+
+    for (I = 0; I < CollCount (&ObjDataList); ++I) {
+
+        /* Get this object file */
+        ObjData* O = CollAtUnchecked (&ObjDataList, I);
+
+        /* Remove the spans and remember the new ids of the others */
+        unsigned  Count = 0;
+        unsigned* Map   = xmalloc ((CollCount (&O->Spans) + 1) * sizeof (*Map));
+        for (J = 0; J < CollCount (&O->Spans); ++J) {
+            Span* S = CollAtUnchecked (&O->Spans, J);
+            if (GetObjSection (O, S->Sec)->Live) {
+                Map[J] = S->Id = Count;
+                CollReplace (&O->Spans, S, Count++);
+            } else {
+                Map[J] = INVALID_SPAN_ID;
+                FreeSpan (S);
+            }
+        }
+        O->Spans.Count = Count;
+
+        /* Update the lists of spans that reference them */
+        for (J = 0; J < CollCount (&O->LineInfos); ++J) {
+            LineInfo* LI = CollAtUnchecked (&O->LineInfos, J);
+            RemapSpanList (LI->Spans, Map);
+        }
+        for (J = 0; J < CollCount (&O->Scopes); ++J) {
+            Scope* S = CollAtUnchecked (&O->Scopes, J);
+            RemapSpanList (S->Spans, Map);
+        }
+
+        xfree (Map);
+    }
+}
+
+
+
 unsigned SpanCount (void)
 /* Return the total number of spans */
 {
@@ -203,6 +294,23 @@ void PrintDbgSpanList (FILE* F, const ObjData* O, const unsigned* List)
 
 
 
+void CollectDbgSpanList (unsigned long* Rec, unsigned Field,
+                         const ObjData* O, const unsigned* List)
+/* Store the given list of spans in the fields Field and Field+1 of a record
+** in a binary debug info file. This is a helper function for other modules
+** to add a list of spans read by ReadSpanList.
+*/
+{
+    unsigned I;
+    Rec[Field]   = DbgBinListPos ();
+    Rec[Field+1] = List? *List : 0;
+    for (I = 0; I < Rec[Field+1]; ++I) {
+        DbgBinListAdd (O->SpanBaseId + List[I+1]);
+    }
+}
+
+
+
 void PrintDbgSpans (FILE* F)
 /* Output the spans to a debug info file */
 {
@@ -245,3 +353,31 @@ void PrintDbgSpans (FILE* F)
     /* Free the string buffer */
     SB_Done (&SpanType);
 }
+
+
+
+void CollectDbgSpans (void)
+/* Add the spans to a binary debug info file */
+{
+    unsigned I, J;
+
+    for (I = 0; I < CollCount (&ObjDataList); ++I) {
+
+        /* Get this object file */
+        ObjData* O = CollAtUnchecked (&ObjDataList, I);
+
+        /* Walk over all spans in this object file */
+        for (J = 0; J < CollCount (&O->Spans); ++J) {
+
+            /* Get this span, its section and its record */
+            const Span*    S   = CollAtUnchecked (&O->Spans, J);
+            const Section* Sec = GetObjSection (O, S->Sec);
+            unsigned long* Rec = DbgBinRecord (DBG_KIND_SPAN, O->SpanBaseId + S->Id);
+
+            Rec[DBG_SPAN_SEG]   = Sec->Seg->Id;
+            Rec[DBG_SPAN_START] = Sec->Offs + S->Offs;
+            Rec[DBG_SPAN_SIZE]  = S->Size;
+            Rec[DBG_SPAN_TYPE]  = (S->Type != INVALID_TYPE_ID)? S->Type : DBG_INV_ID;
+        }
+    }
+}
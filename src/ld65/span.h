@@ -88,6 +88,12 @@ unsigned* DupSpanList (const unsigned* S);
 void FreeSpan (Span* S);
 /* Free a span structure */
 
+void RelaxSpans (void);
+/* Adjust the spans after instructions were shortened by relaxation */
+
+void RemoveSpans (void);
+/* Remove the spans of sections that were removed as unused */
+
 unsigned SpanCount (void);
 /* Return the total number of spans */
 
@@ -97,9 +103,19 @@ void PrintDbgSpanList (FILE* F, const struct ObjData* O, const unsigned* List);
 ** print a list of spans read by ReadSpanList to the debug info file.
 */
 
+void CollectDbgSpanList (unsigned long* Rec, unsigned Field,
+                         const struct ObjData* O, const unsigned* List);
+/* Store the given list of spans in the fields Field and Field+1 of a record
+** in a binary debug info file. This is a helper function for other modules
+** to add a list of spans read by ReadSpanList.
+*/
+
 void PrintDbgSpans (FILE* F);
 /* Output the spans to a debug info file */
 
+void CollectDbgSpans (void);
+/* Add the spans to a binary debug info file */
+
 
 
 /* End of span.h */
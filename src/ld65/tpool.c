@@ -34,9 +34,11 @@
 
 
 /* common */
+#include "dbgdefs.h"
 #include "gentype.h"
 
 /* ld65 */
+#include "dbgfile.h"
 #include "tpool.h"
 
 
@@ -82,6 +84,24 @@ void PrintDbgTypes (FILE* F)
 
 
 
+void CollectDbgTypes (void)
+/* Add the types to a binary debug info file */
+{
+    StrBuf   Type  = STATIC_STRBUF_INITIALIZER;
+    unsigned Count = SP_GetCount (TypePool);
+    unsigned Id;
+
+    for (Id = 0; Id < Count; ++Id) {
+        unsigned long* Rec = DbgBinRecord (DBG_KIND_TYPE, Id);
+        Rec[DBG_TYPE_VAL] = DbgBinStr (GT_AsString (SP_Get (TypePool, Id), &Type));
+    }
+
+    /* Free the memory for the temporary string */
+    SB_Done (&Type);
+}
+
+
+
 void InitTypePool (void)
 /* Initialize the type pool */
 {
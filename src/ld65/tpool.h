@@ -98,6 +98,9 @@ INLINE unsigned TypeCount (void)
 void PrintDbgTypes (FILE* F);
 /* Output the types to a debug info file */
 
+void CollectDbgTypes (void);
+/* Add the types to a binary debug info file */
+
 void InitTypePool (void);
 /* Initialize the type pool */
 
@@ -33,6 +33,7 @@
 
 
 
+#include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 #include <fcntl.h>
@@ -283,6 +284,43 @@ static void PVWrite (CPURegs* Regs)
 
 
 
+static void PVLseek (CPURegs* Regs)
+{
+    long RetVal;
+    int Whence;
+
+    unsigned Mode   = GetAX (Regs);
+    unsigned Low    = PopParam (2);
+    unsigned High   = PopParam (2);
+    unsigned FD     = PopParam (2);
+    long     Offset = (((long) High ^ 0x8000L) - 0x8000L) * 0x10000L + Low;
+
+    Print (stderr, 2, "PVLseek ($%04X, %ld, $%04X)\n", FD, Offset, Mode);
+
+    /* The cc65 values for whence differ from the host ones */
+    switch (Mode) {
+        case 0:
+            Whence = SEEK_CUR;
+            break;
+        case 1:
+            Whence = SEEK_END;
+            break;
+        case 2:
+            Whence = SEEK_SET;
+            break;
+        default:
+            Whence = -1;
+            break;
+    }
+
+    RetVal = lseek (FD, Offset, Whence);
+
+    SetAX (Regs, (unsigned) RetVal);
+    MemWriteWord (0x0002, (unsigned) (RetVal >> 16));
+}
+
+
+
 static const PVFunc Hooks[] = {
     PVArgs,
     PVExit,
@@ -290,6 +328,7 @@ static const PVFunc Hooks[] = {
     PVClose,
     PVRead,
     PVWrite,
+    PVLseek,
 };
 
 
@@ -0,0 +1,56 @@
+; Debug info written in text and binary format (ld65 --dbgfile-format). The
+; lookups of the debug info library must return the same items in the same
+; order for both files. Many names are used more than once: the cheap local
+; @loop in each procedure, the equates in the scopes, and the labels that
+; dbginfoimp.s defines, too. Several labels in different segments share the
+; same address, so the lookups by value have ties as well.
+
+        .export         start
+        .import         fill, clear
+
+        .code
+
+start:  jsr     fill
+        jsr     clear
+        jmp     copy
+
+.proc   copy
+        ldx     #count-1
+@loop:  lda     table,x
+        sta     buffer,x
+        dex
+        bpl     @loop
+        rts
+.endproc
+
+.proc   count2
+        ldx     #0
+@loop:  inx
+        cpx     #count
+        bne     @loop
+        rts
+.endproc
+
+.scope  one
+        size    = 4
+        flag    = 1
+.endscope
+
+.scope  two
+        size    = 4
+        flag    = 2
+.endscope
+
+        count   = one::size + two::size
+
+        .rodata
+
+table:  .res    count
+
+        .data
+
+value:  .byte   one::flag, two::flag
+
+        .bss
+
+buffer: .res    count
@@ -0,0 +1,34 @@
+; Second module for dbginfo.s
+
+        .export         fill, clear
+
+        .code
+
+.proc   fill
+        ldx     #3
+@loop:  sta     buffer,x
+        dex
+        bpl     @loop
+        rts
+.endproc
+
+.proc   clear
+        lda     #0
+        beq     fill
+.endproc
+
+.scope  one
+        size    = 4
+.endscope
+
+        .rodata
+
+table:  .byte   0
+
+        .data
+
+value:  .byte   1
+
+        .bss
+
+buffer: .res    4
@@ -0,0 +1,29 @@
+; Sections removed by the linker (ld65 --gc-sections). The code outside of
+; sections is always kept and calls keep1. keep2 is referenced only from the
+; other module gcimp.s through an import. drop1 is exported, but nothing
+; refers to it except drop2, which is only imported by a removed section of
+; gcimp.s. Both must be missing from the output and the map file.
+
+        .export         keep1, keep2, drop1, drop2
+        .import         caller
+
+        .code
+
+        jsr     keep1
+        jmp     caller
+
+        .section
+keep1:  lda     #1
+        rts
+
+        .section
+drop1:  lda     #2
+        rts
+
+        .section
+keep2:  lda     #3
+        rts
+
+        .section
+drop2:  lda     #4
+        jmp     drop1
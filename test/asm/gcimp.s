@@ -0,0 +1,11 @@
+; Second module for gc.s
+
+        .export         caller
+        .import         keep2, drop2
+
+        .code
+
+caller: jmp     keep2
+
+        .section
+unused: jmp     drop2
@@ -0,0 +1,29 @@
+; Instructions shortened by the linker (ca65 --link-relax). Each comment
+; tells what the linker must do with the instruction.
+
+        .macpack        longbranch
+        .export         lowvar, highvar
+
+        .code
+
+        lda     lowvar          ; zero page
+        sta     lowvar+1        ; zero page
+        lda     highvar         ; stays absolute
+        lda     lowvar,x        ; stays absolute, lowvar isn't a zero page symbol
+smc:    ldx     lowvar          ; stays absolute, it is changed below
+        inc     smc+1
+        jeq     near            ; branch
+        jne     far             ; stays a branch over a jump
+        jmp     near            ; stays a jump, the 6502 has no BRA
+near:   nop
+        .res    200, $EA
+far:    rts
+
+        .segment "LOWBSS"
+
+lowvar: .res    2
+
+        .bss
+
+highvar:
+        .res    1
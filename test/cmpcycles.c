@@ -0,0 +1,73 @@
+// minimal tool to compare the output of programs run with sim65 -c
+//
+// The last line of each file is the cycle count printed by sim65. The lines
+// before it must be the same in all files, and each file must have fewer
+// cycles than the next one.
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#define MAXOUT 4096
+
+static char out[2][MAXOUT];
+
+static int readout(const char *name, char *buf, unsigned long *cycles)
+{
+    FILE *f = fopen(name, "rb");
+    size_t n;
+    char *last;
+
+    if (f == NULL) {
+        fprintf(stderr, "cmpcycles: cannot open %s\n", name);
+        return 0;
+    }
+    n = fread(buf, 1, MAXOUT - 1, f);
+    fclose(f);
+    buf[n] = '\0';
+
+    // Cut off the cycle count
+    while (n > 0 && (buf[n - 1] == '\n' || buf[n - 1] == '\r')) {
+        buf[--n] = '\0';
+    }
+    last = strrchr(buf, '\n');
+    last = (last == NULL) ? buf : last + 1;
+    if (sscanf(last, "%lu cycles", cycles) != 1) {
+        fprintf(stderr, "cmpcycles: no cycle count in %s\n", name);
+        return 0;
+    }
+    *last = '\0';
+    return 1;
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned long cycles[2];
+    int i;
+
+    if (argc < 3) {
+        return EXIT_FAILURE;
+    }
+    if (!readout(argv[1], out[0], &cycles[0])) {
+        return EXIT_FAILURE;
+    }
+    printf("%s: %lu cycles\n", argv[1], cycles[0]);
+    for (i = 2; i < argc; ++i) {
+        if (!readout(argv[i], out[1], &cycles[1])) {
+            return EXIT_FAILURE;
+        }
+        printf("%s: %lu cycles\n", argv[i], cycles[1]);
+        if (strcmp(out[0], out[1]) != 0) {
+            fprintf(stderr, "cmpcycles: output of %s differs from %s\n",
+                    argv[i], argv[1]);
+            return EXIT_FAILURE;
+        }
+        if (cycles[0] >= cycles[1]) {
+            fprintf(stderr, "cmpcycles: %s needs %lu cycles, %s only %lu\n",
+                    argv[i - 1], cycles[0], argv[i], cycles[1]);
+            return EXIT_FAILURE;
+        }
+        cycles[0] = cycles[1];
+    }
+    return EXIT_SUCCESS;
+}
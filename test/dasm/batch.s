@@ -0,0 +1,9 @@
+; Input for the batch mode test. It disassembles into more than one page of
+; 60 lines.
+
+        .repeat 40, I
+        lda     $1234,x
+        sta     $10+I
+        inx
+        .endrep
+        rts
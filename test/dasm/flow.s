@@ -0,0 +1,24 @@
+; Input for the flow analysis round trip test. The text, the jump vector
+; and the bytes at the end would not reassemble to the same binary if they
+; were disassembled as code.
+
+start:  ldx     #0
+loop:   lda     text,x
+        beq     done
+        jsr     out
+        inx
+        bne     loop
+done:   jmp     (vector)
+
+out:    sta     $D020
+        rts
+
+text:   .byte   "HELLO, WORLD", 0
+vector: .word   next
+
+next:   lda     #$FF
+        sta     $10
+        rts
+
+; Not reached, ends with a truncated instruction
+        .byte   $02, $12, $FF, $AD, $34
@@ -0,0 +1,143 @@
+// minimal tool to print the results of the lookups in a debug info file
+//
+// The output only depends on what the debug info library returns, so a text
+// and a binary debug info file of the same program must give the same output.
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "dbginfo.h"
+
+static unsigned errors = 0;
+
+static void error(const cc65_parseerror *e)
+{
+    fprintf(stderr, "dbgdump: %s(%lu): %s\n", e->name,
+            (unsigned long) e->line, e->errormsg);
+    if (e->type == CC65_ERROR) {
+        ++errors;
+    }
+}
+
+static void symbols(cc65_dbginfo h, const char *what,
+                    const cc65_symbolinfo *s)
+{
+    unsigned i;
+
+    printf("%s:", what);
+    if (s != NULL) {
+        for (i = 0; i < s->count; ++i) {
+            printf(" %u", s->data[i].symbol_id);
+        }
+        cc65_free_symbolinfo(h, s);
+    }
+    printf("\n");
+}
+
+static void spans(cc65_dbginfo h, const char *what, const cc65_spaninfo *s)
+{
+    unsigned i;
+
+    printf("%s:", what);
+    if (s != NULL) {
+        for (i = 0; i < s->count; ++i) {
+            printf(" %u", s->data[i].span_id);
+        }
+        cc65_free_spaninfo(h, s);
+    }
+    printf("\n");
+}
+
+int main(int argc, char *argv[])
+{
+    cc65_dbginfo h;
+    const cc65_sourceinfo *src;
+    const cc65_moduleinfo *mod;
+    const cc65_segmentinfo *seg;
+    const cc65_scopeinfo *scope;
+    const cc65_symbolinfo *sym;
+    const cc65_lineinfo *line;
+    unsigned i, j;
+    unsigned long addr;
+
+    if (argc != 2) {
+        return EXIT_FAILURE;
+    }
+    h = cc65_read_dbginfo(argv[1], error);
+    if (h == NULL || errors != 0) {
+        return EXIT_FAILURE;
+    }
+
+    // Lists of all items
+    src = cc65_get_sourcelist(h);
+    for (i = 0; i < src->count; ++i) {
+        printf("source %u %s %lu %lu\n", src->data[i].source_id,
+               src->data[i].source_name, src->data[i].source_size,
+               src->data[i].source_mtime);
+        line = cc65_line_bysource(h, src->data[i].source_id);
+        printf("lines:");
+        for (j = 0; line != NULL && j < line->count; ++j) {
+            printf(" %u:%lu", line->data[j].line_id,
+                   (unsigned long) line->data[j].source_line);
+        }
+        printf("\n");
+        cc65_free_lineinfo(h, line);
+    }
+    cc65_free_sourceinfo(h, src);
+
+    mod = cc65_get_modulelist(h);
+    for (i = 0; i < mod->count; ++i) {
+        printf("module %u %s %u\n", mod->data[i].module_id,
+               mod->data[i].module_name, mod->data[i].scope_id);
+    }
+    cc65_free_moduleinfo(h, mod);
+
+    // Segments by name, spans by address
+    seg = cc65_get_segmentlist(h);
+    for (i = 0; i < seg->count; ++i) {
+        const cc65_segmentinfo *s =
+            cc65_segment_byname(h, seg->data[i].segment_name);
+        printf("segment %s %u %lu %lu\n", seg->data[i].segment_name,
+               s->data[0].segment_id,
+               (unsigned long) s->data[0].segment_start,
+               (unsigned long) s->data[0].segment_size);
+        cc65_free_segmentinfo(h, s);
+        for (j = 0; j < seg->data[i].segment_size; ++j) {
+            char what[32];
+            addr = seg->data[i].segment_start + j;
+            sprintf(what, "span %04lX", addr);
+            spans(h, what, cc65_span_byaddr(h, addr));
+        }
+    }
+    cc65_free_segmentinfo(h, seg);
+
+    // Scopes by name, symbols by scope
+    scope = cc65_get_scopelist(h);
+    for (i = 0; i < scope->count; ++i) {
+        const cc65_scopeinfo *s =
+            cc65_scope_byname(h, scope->data[i].scope_name);
+        char what[32];
+        printf("scope '%s':", scope->data[i].scope_name);
+        for (j = 0; s != NULL && j < s->count; ++j) {
+            printf(" %u", s->data[j].scope_id);
+        }
+        printf("\n");
+        cc65_free_scopeinfo(h, s);
+        sprintf(what, "symbols in scope %u", scope->data[i].scope_id);
+        symbols(h, what, cc65_symbol_byscope(h, scope->data[i].scope_id));
+    }
+    cc65_free_scopeinfo(h, scope);
+
+    // Symbols by name and by value
+    for (i = 0; (sym = cc65_symbol_byid(h, i)) != NULL; ++i) {
+        char what[64];
+        sprintf(what, "symbol %u %s %ld", i, sym->data[0].symbol_name,
+                sym->data[0].symbol_value);
+        symbols(h, what, cc65_symbol_byname(h, sym->data[0].symbol_name));
+        cc65_free_symbolinfo(h, sym);
+    }
+    symbols(h, "labels", cc65_symbol_inrange(h, 0, 0xFFFFFFFFUL));
+
+    cc65_free_dbginfo(h);
+    return EXIT_SUCCESS;
+}
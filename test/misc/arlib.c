@@ -0,0 +1,32 @@
+/*
+  !!DESCRIPTION!! ar65 libraries: in place update, compaction, old format
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+  !!AUTHOR!!
+*/
+
+/*
+  Linked against libraries that contain arlib2.s assembled with VALUE and,
+  unless SMALL is defined, arlib1.s.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+extern int libsmall (void);
+extern int libbig (void);
+
+int main (void)
+{
+    if (libsmall () != VALUE) {
+        printf ("Failed: libsmall () = %d, expected %d\n", libsmall (), VALUE);
+        return EXIT_FAILURE;
+    }
+#ifndef SMALL
+    if (libbig () != 1) {
+        printf ("Failed: libbig () = %d, expected 1\n", libbig ());
+        return EXIT_FAILURE;
+    }
+#endif
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,18 @@
+;
+; Large module for the ar65 library test (arlib.c)
+;
+
+        .export         _libbig
+
+.rodata
+
+table:  .repeat 1000, I
+        .word   I
+        .endrepeat
+
+.code
+
+_libbig:
+        lda     table+2
+        ldx     table+3
+        rts
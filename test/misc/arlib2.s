@@ -0,0 +1,12 @@
+;
+; Small module for the ar65 library test (arlib.c), returns VALUE
+;
+
+        .export         _libsmall
+
+.code
+
+_libsmall:
+        lda     #<VALUE
+        ldx     #>VALUE
+        rts
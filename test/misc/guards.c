@@ -0,0 +1,30 @@
+/*
+  !!DESCRIPTION!! include guard detection and #pragma once
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+  !!AUTHOR!!
+*/
+
+/*
+  All headers are included twice. Only guards4.h must be read again, since
+  the macro of its guard is undefined in between. The verbose output of the
+  compiler shows which files were read (see guards.ref), so no system
+  headers are used.
+*/
+
+#include "guards1.h"
+#include "guards2.h"
+#include "guards3.h"
+#include "guards4.h"
+
+#include "guards1.h"
+#include "guards2.h"
+#include "guards3.h"
+#undef GUARDS4_H
+#define SECOND
+#include "guards4.h"
+
+int main (void)
+{
+    return (guards1 + guards2 + guards3 + first + second == 8)? 0 : 1;
+}
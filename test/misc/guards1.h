@@ -0,0 +1,13 @@
+/*
+  !!DESCRIPTION!! include guard using #if !defined(X) (see guards.c)
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+  !!AUTHOR!!
+*/
+
+#if !defined(GUARDS1_H)
+#define GUARDS1_H
+
+int guards1 = 1;
+
+#endif
@@ -0,0 +1,13 @@
+/*
+  !!DESCRIPTION!! include guard using #if !defined X (see guards.c)
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+  !!AUTHOR!!
+*/
+
+#if ! defined GUARDS2_H         /* comment */
+#define GUARDS2_H
+
+int guards2 = 2;
+
+#endif  /* GUARDS2_H */
@@ -0,0 +1,10 @@
+/*
+  !!DESCRIPTION!! #pragma once followed by a comment (see guards.c)
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+  !!AUTHOR!!
+*/
+
+#pragma once    /* comment */  
+
+int guards3 = 3;
@@ -0,0 +1,17 @@
+/*
+  !!DESCRIPTION!! include guard whose macro is undefined (see guards.c)
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+  !!AUTHOR!!
+*/
+
+#ifndef GUARDS4_H
+#define GUARDS4_H
+
+#ifdef SECOND
+int second = 1;
+#else
+int first = 1;
+#endif
+
+#endif
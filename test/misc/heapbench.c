@@ -0,0 +1,261 @@
+/*
+  !!DESCRIPTION!! heap stress test and allocator benchmark
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+  !!AUTHOR!!
+*/
+
+/*
+  Allocate and free blocks of mostly small sizes in a pseudo random order,
+  and check that the blocks don't overlap and that no memory gets lost. The
+  program is linked with the default allocator, with the pool allocator in
+  <target>-poolheap.o, and built a third time with BASELINE defined, which
+  runs the same loop without calling the allocator. sim65 -c prints the
+  cycles of each run. Subtract the baseline and divide by the number of
+  operations the program prints to get the cycles per operation. The Makefile
+  checks that all three print the same, and that the pool allocator is faster
+  than the default one.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <_heap.h>
+
+#define SLOTS   64              /* Must be a power of two */
+#define ROUNDS  2
+#define OPS     2000            /* Per round */
+#define LARGE   300             /* Largest block */
+
+static unsigned char failures = 0;
+static unsigned ops = 0;
+
+static unsigned char* slot[SLOTS];
+static unsigned size[SLOTS];
+static unsigned seed;
+
+#ifdef BASELINE
+
+/* Blocks are taken from a static array */
+static unsigned char mem[SLOTS][LARGE];
+
+static void* get (unsigned char i, unsigned n)
+{
+    (void) n;
+    return mem[i];
+}
+
+static void* reget (unsigned char i, unsigned n)
+{
+    (void) n;
+    return mem[i];
+}
+
+static void put (unsigned char i)
+{
+    (void) i;
+}
+
+#else
+
+/* Memory added to the heap with _heapadd */
+static unsigned char extra[200];
+
+static void* get (unsigned char i, unsigned n)
+{
+    void* p;
+
+    /* Use calloc and posix_memalign now and then */
+    switch (ops & 0x1F) {
+        case 0:
+            p = calloc (n, 1);
+            if (p && *(unsigned char*) p != 0) {
+                printf ("calloc didn't clear the block\n");
+                ++failures;
+            }
+            break;
+        case 1:
+            if (posix_memalign (&p, 16, n) != 0) {
+                p = 0;
+            } else if ((unsigned) p & 15) {
+                printf ("posix_memalign: %p not aligned\n", p);
+                ++failures;
+            }
+            break;
+        default:
+            p = malloc (n);
+            break;
+    }
+    if (p && _heapblocksize (p) < n) {
+        printf ("slot %u: block size %u < %u\n", i, _heapblocksize (p), n);
+        ++failures;
+    }
+    return p;
+}
+
+static void* reget (unsigned char i, unsigned n)
+{
+    return realloc (slot[i], n);
+}
+
+static void put (unsigned char i)
+{
+    free (slot[i]);
+}
+
+#endif
+
+static unsigned rnd (void)
+{
+    seed ^= seed << 7;
+    seed ^= seed >> 9;
+    seed ^= seed << 8;
+    return seed;
+}
+
+static unsigned rndsize (void)
+{
+    unsigned r = rnd ();
+
+    /* Mostly small blocks */
+    if ((r & 0x0700) == 0) {
+        return 65 + r % (LARGE - 64);
+    }
+    return 1 + (r & 0x3F);
+}
+
+static void fill (unsigned char i)
+{
+    slot[i][0] = i;
+    slot[i][size[i] - 1] = i;
+}
+
+static void check (unsigned char i)
+{
+    if (slot[i][0] != i || slot[i][size[i] - 1] != i) {
+        printf ("slot %u: block of %u bytes was overwritten\n", i, size[i]);
+        ++failures;
+    }
+}
+
+static void round (void)
+{
+    unsigned k, n, r;
+    unsigned char i;
+    unsigned char* p;
+
+    seed = 0x1234;
+    for (k = 0; k < OPS; ++k) {
+        r = rnd ();
+        i = r & (SLOTS - 1);
+        if (slot[i] == 0) {
+            /* Allocate a new block */
+            n = rndsize ();
+            slot[i] = get (i, n);
+            if (slot[i] == 0) {
+                printf ("cannot allocate %u bytes\n", n);
+                ++failures;
+                return;
+            }
+            size[i] = n;
+            fill (i);
+        } else if ((r & 0x0F00) == 0) {
+            /* Resize the block */
+            check (i);
+            n = rndsize ();
+            p = reget (i, n);
+            if (p == 0) {
+                printf ("cannot reallocate %u bytes\n", n);
+                ++failures;
+                return;
+            }
+            slot[i] = p;
+            if (p[0] != i) {
+                printf ("slot %u: realloc lost the data\n", i);
+                ++failures;
+            }
+            size[i] = n;
+            fill (i);
+        } else {
+            /* Free the block */
+            check (i);
+            put (i);
+            slot[i] = 0;
+        }
+        ++ops;
+    }
+
+    /* Free the remaining blocks */
+    for (i = 0; i < SLOTS; ++i) {
+        if (slot[i]) {
+            check (i);
+            put (i);
+            slot[i] = 0;
+            ++ops;
+        }
+    }
+}
+
+#ifndef BASELINE
+
+/* Fill the heap completely. Each request is for what _heapmaxavail reports
+   and must succeed. Near the end, the space at the heap top is too small for
+   another pool page.
+*/
+#define FULL    256
+
+static void* full[FULL];
+
+static void fillheap (void)
+{
+    unsigned n;
+    unsigned k;
+
+    for (k = 0; k < FULL && (n = _heapmaxavail ()) > 0; ++k) {
+        full[k] = malloc (n);
+        if (full[k] == 0) {
+            printf ("heap full: cannot allocate %u bytes\n", n);
+            ++failures;
+            break;
+        }
+    }
+    while (k > 0) {
+        free (full[--k]);
+    }
+}
+
+#endif
+
+int main (void)
+{
+#ifndef BASELINE
+    unsigned avail = 0;
+    unsigned char r;
+
+    _heapadd (extra, sizeof (extra));
+    for (r = 0; r < ROUNDS; ++r) {
+        round ();
+
+        /* Both rounds do the same, so the heap must be in the same state */
+        if (r > 0 && _heapmemavail () != avail) {
+            printf ("_heapmemavail: %u, expected %u\n", _heapmemavail (), avail);
+            ++failures;
+        }
+        avail = _heapmemavail ();
+        if (_heapmaxavail () < LARGE || _heapmaxavail () > avail) {
+            printf ("_heapmaxavail: %u\n", _heapmaxavail ());
+            ++failures;
+        }
+    }
+    fillheap ();
+#else
+    unsigned char r;
+
+    for (r = 0; r < ROUNDS; ++r) {
+        round ();
+    }
+#endif
+
+    printf ("%u operations\n", ops);
+    return failures? EXIT_FAILURE : EXIT_SUCCESS;
+}
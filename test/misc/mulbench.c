@@ -0,0 +1,85 @@
+/*
+  !!DESCRIPTION!! table based multiplication (fastmul.o)
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+  !!AUTHOR!!
+*/
+
+/*
+  The program is linked twice, once with the multiplication routines from the
+  library and once with the table based ones from <target>-fastmul.o. Check
+  the products against running sums. The Makefile checks that the table based
+  routines need fewer cycles.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <cc65.h>
+
+static unsigned char failures = 0;
+
+static void fail (const char* op, unsigned a, unsigned b, unsigned got, unsigned expected)
+{
+    if (failures < 20) {
+        printf ("%u %s %u = %u, expected %u\n", a, op, b, got, expected);
+        ++failures;
+    }
+}
+
+static void check_int (unsigned a)
+{
+    unsigned b = 0;
+    unsigned p = 0;
+    unsigned q = (a << 8) + (a << 6) - (a << 3) - a;     /* a * 311 */
+    int s = (int) a;
+    unsigned char i;
+
+    for (i = 0; i < 200; ++i) {
+        if (a * b != p) {
+            fail ("*", a, b, a * b, p);
+        }
+        if (s * (int) b != (int) p) {
+            fail ("*", s, b, s * (int) b, p);
+        }
+        p += q;
+        b += 311U;
+    }
+}
+
+static void check_char (unsigned char a)
+{
+    unsigned char b = 0;
+    unsigned p = 0;
+    unsigned x = a;
+
+    do {
+        if (cc65_umul8x8r16 (a, b) != p) {
+            fail ("*", a, b, cc65_umul8x8r16 (a, b), p);
+        }
+        if (x * b != p) {
+            fail ("*", x, b, x * b, p);
+        }
+        if (cc65_imul8x8r16 ((signed char) a, (signed char) b) !=
+            (int) (signed char) a * (signed char) b) {
+            fail ("*", a, b, cc65_imul8x8r16 (a, b), (int) (signed char) a * (signed char) b);
+        }
+        p += a;
+    } while (++b != 0);
+}
+
+int main (void)
+{
+    unsigned a = 0;
+    unsigned char i;
+
+    for (i = 0; i < 100; ++i) {
+        check_int (a);
+        a += 653U;
+    }
+    for (i = 0; i < 250; i += 13) {
+        check_char (i);
+    }
+    check_char (255);
+
+    return failures? EXIT_FAILURE : EXIT_SUCCESS;
+}
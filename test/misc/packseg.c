@@ -0,0 +1,115 @@
+/*
+  !!DESCRIPTION!! segments compressed by the linker (compress = yes)
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+  !!AUTHOR!!
+*/
+
+/*
+  The PACKED segment is stored LZ4 compressed in the program file and is
+  unpacked to its run address with decompress_lz4. Check the unpacked code
+  and data against copies that are not compressed. The program is built a
+  second time with UNPACKS=11, so the difference of the cycle counts printed
+  by sim65 -c is the time needed to unpack the segment ten times. The Makefile
+  checks that both print the same and that the second one is slower.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <lz4.h>
+
+#ifndef UNPACKS
+#define UNPACKS 1
+#endif
+
+/* Linker generated */
+extern unsigned char _PACKED_LOAD__[], _PACKED_RUN__[], _PACKED_SIZE__[];
+
+#define TEXT                                                                \
+    "The linker stores segments with the compress attribute in their load " \
+    "memory area as LZ4 compressed data. The program unpacks them to the "  \
+    "run memory area before it uses them. Since load times from disk and "  \
+    "tape are dominated by the number of bytes transferred, a smaller "     \
+    "program file loads faster, even if it has to be unpacked afterwards. " \
+    "Text like this one compresses well, because many words and phrases "   \
+    "occur more than once, and because the same letters occur again and "   \
+    "again. Code compresses less well, but the opcodes of loads, stores "   \
+    "and branches, and the addresses of variables and subroutines, repeat " \
+    "often enough to save about a third of the size in most programs. The " \
+    "linker stores segments with the compress attribute in their load "     \
+    "memory area as LZ4 compressed data, and the program unpacks them."
+
+#pragma code-name (push, "PACKED")
+#pragma rodata-name (push, "PACKED")
+#pragma data-name (push, "PACKED")
+
+const char packed_text[] = TEXT;
+
+unsigned char packed_squares[] = {
+      0,   1,   4,   9,  16,  25,  36,  49,
+     64,  81, 100, 121, 144, 169, 196, 225,
+      0,   1,   4,   9,  16,  25,  36,  49,
+     64,  81, 100, 121, 144, 169, 196, 225
+};
+
+unsigned calls;
+
+unsigned packed_checksum (const char* s)
+{
+    unsigned sum = 0;
+    ++calls;
+    while (*s) {
+        sum = (sum << 1) ^ (unsigned char) *s++;
+    }
+    return sum;
+}
+
+#pragma data-name (pop)
+#pragma rodata-name (pop)
+#pragma code-name (pop)
+
+static const char ref_text[] = TEXT;
+
+static unsigned checksum (const char* s)
+{
+    unsigned sum = 0;
+    while (*s) {
+        sum = (sum << 1) ^ (unsigned char) *s++;
+    }
+    return sum;
+}
+
+int main (void)
+{
+    unsigned char failures = 0;
+    unsigned char i;
+
+    for (i = 0; i < UNPACKS; ++i) {
+        decompress_lz4 (_PACKED_LOAD__, _PACKED_RUN__,
+                        (unsigned) _PACKED_SIZE__);
+    }
+
+    if (strcmp (packed_text, ref_text) != 0) {
+        printf ("text differs\n");
+        ++failures;
+    }
+    for (i = 0; i < sizeof (packed_squares); ++i) {
+        if (packed_squares[i] != (unsigned char) ((i & 15) * (i & 15))) {
+            printf ("square %u is %u\n", i, packed_squares[i]);
+            ++failures;
+        }
+    }
+    if (packed_checksum (ref_text) != checksum (ref_text)) {
+        printf ("checksum is %u, expected %u\n", packed_checksum (ref_text),
+                checksum (ref_text));
+        ++failures;
+    }
+
+    if (calls != 1) {
+        printf ("calls is %u\n", calls);
+        ++failures;
+    }
+
+    return failures? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,32 @@
+/*
+  !!DESCRIPTION!! precompiled headers (--create-pch, --use-pch)
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+  !!AUTHOR!!
+*/
+
+/*
+  This file is compiled with and without a precompiled header made from
+  pch.h, and the output must be the same. The headers are included again,
+  so the include guard of pch.h and the #pragma once of pchonce.h must be
+  known when the precompiled header is used.
+*/
+
+#include "pch.h"
+#include "pch.h"
+#include "pchonce.h"
+
+int counter = 5;
+
+int main (void)
+{
+    pair p;
+
+    p.a = twice (counter);
+    p.b = strlen ("abc");
+    if (p.a + p.b != 13) {
+        printf ("Failed: %d\n", p.a + p.b);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,28 @@
+/*
+  !!DESCRIPTION!! header for the precompiled header test (pch.c)
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+  !!AUTHOR!!
+*/
+
+#ifndef PCH_H
+#define PCH_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pchonce.h"
+
+#define TWICE(x)        ((x) * 2)
+
+extern int counter;
+
+/* The warning for the unused local must refer to this file
+** and not to the precompiled header
+*/ static int twice (int x)
+{
+    int unused;
+    return TWICE (x);
+}
+
+#endif
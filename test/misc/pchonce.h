@@ -0,0 +1,12 @@
+/*
+  !!DESCRIPTION!! header for the precompiled header test (pch.c)
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+  !!AUTHOR!!
+*/
+
+#pragma once
+
+typedef struct {
+    int a, b;
+} pair;
@@ -0,0 +1,94 @@
+/*
+  !!DESCRIPTION!! overlaid static frames (--static-frames)
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+  !!AUTHOR!!
+*/
+
+/*
+  With --static-frames, the local variables of functions that can't be
+  active at the same time share memory. Check that the variables of callers
+  survive calls, that functions called through pointers still work, and
+  that recursive functions work if their locals are kept on the stack.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static unsigned char failures = 0;
+
+static unsigned leaf1 (unsigned a)
+{
+    unsigned t = a * 3;
+    unsigned char i;
+
+    for (i = 0; i < 3; ++i) {
+        t += i;
+    }
+    return t;
+}
+
+static unsigned leaf2 (unsigned a)
+{
+    unsigned u = a + 7;
+    unsigned v = u * 2;
+    return u + v;
+}
+
+static unsigned mid (unsigned a)
+{
+    unsigned x = leaf1 (a);
+    unsigned y = leaf2 (a);
+    return x ^ y;
+}
+
+static unsigned top (unsigned a)
+{
+    unsigned k = a;
+    unsigned r = mid (k) + leaf1 (k);
+    return r + k;
+}
+
+static unsigned apply (unsigned (*f) (unsigned), unsigned a)
+{
+    unsigned b = a + 1;
+    unsigned r = f (b);
+    return r + b;
+}
+
+#pragma static-locals (push, off)
+static unsigned fact (unsigned n)
+{
+    unsigned m = n;
+    return m <= 1 ? 1 : m * fact (m - 1);
+}
+#pragma static-locals (pop)
+
+static unsigned ref (unsigned a)
+{
+    unsigned x = a * 3 + 3;
+    unsigned y = (a + 7) * 3;
+    return (x ^ y) + x + a;
+}
+
+int main (void)
+{
+    unsigned i;
+
+    for (i = 0; i < 300; ++i) {
+        if (top (i) != ref (i)) {
+            printf ("top(%u) = %u, expected %u\n", i, top (i), ref (i));
+            ++failures;
+        }
+        if (apply (top, i) != ref (i + 1) + i + 1) {
+            printf ("apply(top, %u) = %u, expected %u\n", i, apply (top, i), ref (i + 1) + i + 1);
+            ++failures;
+        }
+    }
+    if (fact (7) != 5040) {
+        printf ("fact(7) = %u, expected 5040\n", fact (7));
+        ++failures;
+    }
+
+    return failures? EXIT_FAILURE : EXIT_SUCCESS;
+}
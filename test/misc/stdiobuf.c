@@ -0,0 +1,245 @@
+/*
+  !!DESCRIPTION!! buffered stdio streams (setvbuf)
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+  !!AUTHOR!!
+*/
+
+/*
+  Write a file with fputc, fputs and fwrite, and read it back with fgetc,
+  fgets, ungetc and fread, and check that fflush on the read stream keeps
+  the position. The file name is passed on the command line. With
+  BUFFER set to zero the streams are unbuffered, otherwise setvbuf gives
+  them a buffer of that size. The program is built both ways, and the
+  Makefile checks that the buffered one needs fewer cycles.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef BUFFER
+#define BUFFER 256
+#endif
+
+#define LINELEN 64
+#define LINES   100
+#define TOTAL   (LINELEN * LINES)
+
+static unsigned char failures = 0;
+
+/* Read with a buffer of our own, write with one allocated by setvbuf */
+#if BUFFER
+static char readbuf[BUFFER];
+#define READBUF readbuf
+#else
+#define READBUF 0
+#endif
+
+static char line[LINELEN + 1];
+static char block[600];
+
+static char expect (unsigned p)
+{
+    /* Keep this cheap, so the timing is dominated by the stdio functions */
+    if ((p & (LINELEN - 1)) == LINELEN - 1) {
+        return '\n';
+    }
+    return 'A' + ((p ^ (p >> 4)) & 0x0F);
+}
+
+static void make_line (unsigned p)
+{
+    unsigned char i;
+
+    for (i = 0; i < LINELEN; ++i) {
+        line[i] = expect (p + i);
+    }
+    line[LINELEN] = '\0';
+}
+
+static FILE* open_file (const char* name, const char* mode, char* buf)
+{
+    FILE* f = fopen (name, mode);
+
+    if (f == 0) {
+        printf ("cannot open %s\n", name);
+        exit (EXIT_FAILURE);
+    }
+#if BUFFER
+    if (setvbuf (f, buf, _IOFBF, BUFFER) != 0) {
+        printf ("setvbuf failed\n");
+        ++failures;
+    }
+#else
+    (void) buf;
+#endif
+    return f;
+}
+
+static void write_file (const char* name)
+{
+    FILE* f = open_file (name, "wb", 0);
+    unsigned p, i;
+
+    /* First half char by char */
+    for (p = 0; p < TOTAL / 2; ++p) {
+        fputc (expect (p), f);
+    }
+
+    /* Then a few lines with fputs */
+    for (i = 0; i < 10; ++i, p += LINELEN) {
+        make_line (p);
+        fputs (line, f);
+    }
+
+    /* And the rest in small and large blocks */
+    while (p < TOTAL) {
+        unsigned n = (p & 1)? 13 : sizeof (block);
+        if (n > TOTAL - p) {
+            n = TOTAL - p;
+        }
+        for (i = 0; i < n; ++i) {
+            block[i] = expect (p + i);
+        }
+        if (fwrite (block, 1, n, f) != n) {
+            printf ("fwrite failed at %u\n", p);
+            ++failures;
+        }
+        p += n;
+    }
+
+    if (fclose (f) != 0) {
+        printf ("fclose failed\n");
+        ++failures;
+    }
+}
+
+static void read_chars (const char* name)
+{
+    FILE* f = open_file (name, "rb", READBUF);
+    unsigned p;
+    int c;
+
+    for (p = 0; (c = fgetc (f)) != EOF; ++p) {
+        if (p >= TOTAL || c != expect (p)) {
+            printf ("fgetc: %d at %u\n", c, p);
+            ++failures;
+            break;
+        }
+    }
+    if (p != TOTAL || !feof (f) || ferror (f)) {
+        printf ("fgetc: %u chars read\n", p);
+        ++failures;
+    }
+    fclose (f);
+}
+
+static void read_lines (const char* name)
+{
+    FILE* f = open_file (name, "rb", READBUF);
+    static char buf[LINELEN + 10];
+    unsigned p;
+    int c;
+
+    for (p = 0; fgets (buf, sizeof (buf), f); p += LINELEN) {
+        make_line (p);
+        if (strcmp (buf, line) != 0) {
+            printf ("fgets: bad line at %u\n", p);
+            ++failures;
+            break;
+        }
+
+        /* Push back the first char of every second line */
+        if (p & LINELEN) {
+            c = fgetc (f);
+            if (c != EOF && ungetc (c, f) != c) {
+                printf ("ungetc failed at %u\n", p);
+                ++failures;
+            }
+        }
+    }
+    if (p != TOTAL) {
+        printf ("fgets: %u chars read\n", p);
+        ++failures;
+    }
+    fclose (f);
+}
+
+static void read_blocks (const char* name)
+{
+    FILE* f = open_file (name, "rb", READBUF);
+    unsigned p, i, n;
+    size_t got;
+
+    for (p = 0; p < TOTAL; p += got) {
+        n = (p & 1)? 17 : sizeof (block);
+        got = fread (block, 1, n, f);
+        if (got == 0) {
+            break;
+        }
+        for (i = 0; i < got; ++i) {
+            if (block[i] != expect (p + i)) {
+                printf ("fread: bad data at %u\n", p + i);
+                ++failures;
+                goto done;
+            }
+        }
+    }
+    if (p != TOTAL || fread (block, 1, 1, f) != 0 || !feof (f)) {
+        printf ("fread: %u chars read\n", p);
+        ++failures;
+    }
+done:
+    fclose (f);
+}
+
+static void read_flush (const char* name)
+{
+    FILE* f = open_file (name, "rb", READBUF);
+    unsigned p;
+    int c;
+
+    /* Read a few chars, flush, and check that reading continues at the same
+    ** position, and that ftell agrees with it.
+    */
+    for (p = 0; p < TOTAL; p += 100) {
+        if ((c = fgetc (f)) != expect (p)) {
+            printf ("flush: %d at %u\n", c, p);
+            ++failures;
+            break;
+        }
+        if (fflush (f) != 0 || ftell (f) != p + 1) {
+            printf ("flush: bad position at %u\n", p);
+            ++failures;
+            break;
+        }
+        if ((c = fgetc (f)) != expect (p + 1)) {
+            printf ("flush: %d at %u\n", c, p + 1);
+            ++failures;
+            break;
+        }
+        if (fseek (f, 98, SEEK_CUR) != 0) {
+            printf ("fseek failed at %u\n", p);
+            ++failures;
+            break;
+        }
+    }
+    fclose (f);
+}
+
+int main (int argc, char* argv[])
+{
+    if (argc != 2) {
+        printf ("usage: %s file\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    write_file (argv[1]);
+    read_chars (argv[1]);
+    read_lines (argv[1]);
+    read_blocks (argv[1]);
+    read_flush (argv[1]);
+
+    return failures? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,119 @@
+/*
+  !!DESCRIPTION!! static frames of leaf functions in the register bank
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+  !!AUTHOR!!
+*/
+
+/*
+  With --static-frames and register variables enabled, the local variables
+  of leaf functions that are only called from main() go into the part of the
+  register bank that no active function uses, the ones used most within
+  loops first. Check that the register variables of the callers survive,
+  and that leaf functions that may be called from elsewhere still work.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static unsigned char failures = 0;
+
+/* Leaf with more variables than fit into the register bank */
+static unsigned long mix (unsigned a, unsigned char b)
+{
+    unsigned char c = b + 1;
+    unsigned d = a ^ 0x5A5A;
+    unsigned long e = (unsigned long) d * c;
+    unsigned f = (unsigned) (e >> 3);
+    return e + f + c;
+}
+
+/* Leaf with a large variable used once and a small one used in the loop */
+static unsigned long count (unsigned n)
+{
+    unsigned long base = (unsigned long) n << 8;
+    unsigned char pad[4];
+    unsigned i;
+
+    pad[0] = (unsigned char) n;
+    pad[1] = 0;
+    for (i = 0; i < n; ++i) {
+        pad[1] = pad[0];
+    }
+    return base + i + pad[1];
+}
+
+/* Leaf that is also called through a pointer */
+static unsigned twice (unsigned a)
+{
+    unsigned t = a + a;
+    return t;
+}
+
+#pragma register-vars (push, off)
+static unsigned thrice (unsigned a)
+{
+    unsigned t = a * 3;
+    return t;
+}
+#pragma register-vars (pop)
+
+static unsigned long walk (unsigned n)
+{
+    register unsigned i;
+    register unsigned char k;
+    unsigned long sum = 0;
+
+    for (i = 0; i < n; ++i) {
+        k = (unsigned char) i;
+        sum += mix (i, k);
+        if (k != (unsigned char) i) {
+            printf ("register variable k clobbered at %u\n", i);
+            ++failures;
+        }
+    }
+    return sum;
+}
+
+static unsigned long refmix (unsigned a, unsigned char b)
+{
+    unsigned long e = (unsigned long) (a ^ 0x5A5A) * (unsigned char) (b + 1);
+    return e + (unsigned) (e >> 3) + (unsigned char) (b + 1);
+}
+
+unsigned call (unsigned (*f) (unsigned), unsigned a)
+{
+    return f (a);
+}
+
+int main (void)
+{
+    register unsigned j;
+    unsigned long sum = 0;
+
+    for (j = 0; j < 200; ++j) {
+        sum += refmix (j, (unsigned char) j);
+        if (twice (j) != call (twice, j) || twice (j) != j * 2) {
+            printf ("twice(%u) = %u\n", j, twice (j));
+            ++failures;
+        }
+        if (count (j) != ((unsigned long) j << 8) + j + (j? (unsigned char) j : 0)) {
+            printf ("count(%u) = %lu\n", j, count (j));
+            ++failures;
+        }
+        if (thrice (j) != j * 3) {
+            printf ("thrice(%u) = %u\n", j, thrice (j));
+            ++failures;
+        }
+    }
+    if (walk (200) != sum) {
+        printf ("walk(200) = %lu, expected %lu\n", walk (200), sum);
+        ++failures;
+    }
+    if (j != 200) {
+        printf ("register variable j clobbered: %u\n", j);
+        ++failures;
+    }
+
+    return failures? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,234 @@
+/*
+  !!DESCRIPTION!! rotated for loops and count down loop counters
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+  !!AUTHOR!!
+*/
+
+/*
+  The test of a for loop is placed behind its body, and simple counted loops
+  with a static or register counter get their counter replaced by a register
+  counting down. Check loops that don't run at all, loops left with break,
+  loops with continue, nested loops and loops whose body needs the X and Y
+  registers.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static unsigned char failures = 0;
+static unsigned char g;
+static unsigned char buf[20];
+
+#pragma static-locals (push, on)
+
+static void counted (void)
+{
+    unsigned char i;
+    for (i = 0; i < 10; ++i) {
+        g += 3;
+    }
+}
+
+static void nested (void)
+{
+    unsigned char i, j;
+    for (i = 3; i < 7; ++i) {
+        for (j = 0; j < 5; ++j) {
+            ++g;
+        }
+    }
+}
+
+static void indexed (void)
+{
+    unsigned char i, j;
+    for (i = 0; i < 20; ++i) {
+        j = i;
+        buf[j] = g;
+    }
+}
+
+static void calls (void)
+{
+    unsigned char i;
+    for (i = 0; i < 4; ++i) {
+        memset (buf, g, sizeof (buf));
+        g += buf[3];
+    }
+}
+
+static void wrap (void)
+{
+    unsigned char i;
+    for (i = 250; i != 4; ++i) {
+        ++g;
+    }
+}
+
+#pragma static-locals (pop)
+
+static unsigned char regcounted (void)
+{
+    register unsigned char i;
+    for (i = 2; i < 9; ++i) {
+        g += 3;
+    }
+    return i;
+}
+
+static unsigned char regcalls (void)
+{
+    register unsigned char i;
+    for (i = 0; i < 4; ++i) {
+        memset (buf, g, sizeof (buf));
+        g += buf[3];
+    }
+    return i;
+}
+
+static unsigned char regbreaks (unsigned char n)
+{
+    register unsigned char i;
+    for (i = 0; i < 100; ++i) {
+        if (i == n) {
+            break;
+        }
+        ++g;
+    }
+    return i;
+}
+
+static unsigned char never (unsigned char n)
+{
+    unsigned char i;
+    for (i = 0; i < n; ++i) {
+        g += 2;
+    }
+    for (i = 5; i < 5; ++i) {
+        g += 7;
+    }
+    return i;
+}
+
+static unsigned char breaks (unsigned char n)
+{
+    unsigned char i;
+    for (i = 0; i < 100; ++i) {
+        if (i == n) {
+            break;
+        }
+        if (i & 1) {
+            continue;
+        }
+        ++g;
+    }
+    return i;
+}
+
+static unsigned endless (void)
+{
+    unsigned i = 0;
+    for (;;) {
+        if (++i == 1000) {
+            break;
+        }
+    }
+    return i;
+}
+
+int main (void)
+{
+    register unsigned char r = 77;
+    unsigned char i;
+
+    g = 0;
+    counted ();
+    if (g != 30) {
+        printf ("counted: g = %u, expected 30\n", g);
+        ++failures;
+    }
+
+    g = 0;
+    nested ();
+    if (g != 20) {
+        printf ("nested: g = %u, expected 20\n", g);
+        ++failures;
+    }
+
+    g = 9;
+    indexed ();
+    for (i = 0; i < sizeof (buf); ++i) {
+        if (buf[i] != 9) {
+            printf ("indexed: buf[%u] = %u, expected 9\n", i, buf[i]);
+            ++failures;
+        }
+    }
+
+    g = 1;
+    calls ();
+    if (g != 16 || buf[0] != 8) {
+        printf ("calls: g = %u, buf[0] = %u, expected 16, 8\n", g, buf[0]);
+        ++failures;
+    }
+
+    g = 0;
+    wrap ();
+    if (g != 10) {
+        printf ("wrap: g = %u, expected 10\n", g);
+        ++failures;
+    }
+
+    g = 0;
+    if (regcounted () != 9 || g != 21) {
+        printf ("regcounted: g = %u, expected 21\n", g);
+        ++failures;
+    }
+
+    g = 1;
+    if (regcalls () != 4 || g != 16 || buf[0] != 8) {
+        printf ("regcalls: g = %u, buf[0] = %u, expected 16, 8\n", g, buf[0]);
+        ++failures;
+    }
+
+    g = 0;
+    if (regbreaks (7) != 7 || g != 7) {
+        printf ("regbreaks (7): g = %u, expected 7\n", g);
+        ++failures;
+    }
+
+    if (r != 77) {
+        printf ("register variable changed: %u, expected 77\n", r);
+        ++failures;
+    }
+
+    g = 0;
+    if (never (0) != 5 || g != 0) {
+        printf ("never (0): g = %u, expected 0\n", g);
+        ++failures;
+    }
+    g = 0;
+    if (never (4) != 5 || g != 8) {
+        printf ("never (4): g = %u, expected 8\n", g);
+        ++failures;
+    }
+
+    g = 0;
+    if (breaks (9) != 9 || g != 5) {
+        printf ("breaks (9): g = %u, expected 5\n", g);
+        ++failures;
+    }
+    g = 0;
+    if (breaks (200) != 100 || g != 50) {
+        printf ("breaks (200): g = %u, expected 50\n", g);
+        ++failures;
+    }
+
+    if (endless () != 1000) {
+        printf ("endless: %u, expected 1000\n", endless ());
+        ++failures;
+    }
+
+    return failures? EXIT_FAILURE : EXIT_SUCCESS;
+}
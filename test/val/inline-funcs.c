@@ -0,0 +1,117 @@
+/*
+  !!DESCRIPTION!! inlining of small static functions
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+  !!AUTHOR!!
+*/
+
+/*
+  Calls of small static functions are replaced by a copy of their code. Check
+  functions with loops, early returns, tail calls and recursion, and functions
+  that are also called through pointers.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static unsigned char failures = 0;
+static unsigned char count = 0;
+
+#pragma inline-funcs (push, on)
+#pragma codesize (push, 400)
+
+static void spin (unsigned char n)
+{
+    do {
+        ++count;
+    } while (--n);
+}
+
+static int sign (int a)
+{
+    if (a < 0) {
+        return -1;
+    }
+    if (a > 0) {
+        return 1;
+    }
+    return 0;
+}
+
+static inline int add (int a, int b)
+{
+    return a + b;
+}
+
+/* The function specifier may also follow the type */
+static int inline sub (int a, int b)
+{
+    return a - b;
+}
+
+static unsigned sum (unsigned char n)
+{
+    unsigned s = 0;
+    while (n) {
+        s += n--;
+    }
+    return s;
+}
+
+static unsigned fib (unsigned char n)
+{
+    return (n < 2)? n : fib (n - 1) + fib (n - 2);
+}
+
+static unsigned char even (unsigned char n);
+
+static unsigned char odd (unsigned char n)
+{
+    return n? even (n - 1) : 0;
+}
+
+static unsigned char even (unsigned char n)
+{
+    return n? odd (n - 1) : 1;
+}
+
+static unsigned twice (unsigned (*f) (unsigned char), unsigned char n)
+{
+    return f (n) + f (n);
+}
+
+int main (void)
+{
+    int i;
+    int t = 0;
+
+    for (i = -5; i < 5; ++i) {
+        t = add (t, sign (i) * 100 + i);
+        t = sub (t, i);
+        spin (3);
+    }
+    if (t != -100 || count != 30) {
+        printf ("t = %d, count = %u, expected -100, 30\n", t, count);
+        ++failures;
+    }
+
+    if (sum (100) != 5050 || twice (sum, 10) != 110) {
+        printf ("sum(100) = %u, twice(sum, 10) = %u\n", sum (100), twice (sum, 10));
+        ++failures;
+    }
+
+    if (fib (12) != 144 || twice (fib, 10) != 110) {
+        printf ("fib(12) = %u, twice(fib, 10) = %u\n", fib (12), twice (fib, 10));
+        ++failures;
+    }
+
+    if (odd (7) != 1 || even (7) != 0 || odd (10) != 0 || even (10) != 1) {
+        printf ("odd/even failed\n");
+        ++failures;
+    }
+
+    return failures? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+#pragma codesize (pop)
+#pragma inline-funcs (pop)
@@ -0,0 +1,128 @@
+/*
+  !!DESCRIPTION!! inline long operations with static operands
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+  !!AUTHOR!!
+*/
+
+/*
+  Long additions, subtractions, bitwise operations and compares with a right
+  operand in static memory are done inline if the code size factor allows
+  it. Check them against the same operations with operands on the stack,
+  which always use the runtime.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static unsigned char failures = 0;
+
+static long sa, sb;
+unsigned long ua, ub;
+
+static const long values[] = {
+    0L, 1L, -1L, 2L, 255L, 256L, -256L, 65535L, 65536L, -65536L,
+    0x12345678L, 0x7FFFFFFFL, (long) 0x80000000UL, -0x12345678L, 0x00FF00FFL
+};
+
+#define COUNT   (sizeof (values) / sizeof (values[0]))
+
+#pragma codesize (push, 200)
+
+static long inl_signed (unsigned char op)
+{
+    switch (op) {
+        case 0: return sa + sb;
+        case 1: return sa - sb;
+        case 2: return sa & sb;
+        case 3: return sa | sb;
+        case 4: return sa ^ sb;
+        case 5: return sa == sb;
+        case 6: return sa != sb;
+        case 7: return sa < sb;
+        case 8: return sa <= sb;
+        case 9: return sa > sb;
+        default: return sa >= sb;
+    }
+}
+
+static unsigned long inl_unsigned (unsigned char op)
+{
+    switch (op) {
+        case 0: return ua + ub;
+        case 1: return ua - ub;
+        case 2: return ua & ub;
+        case 3: return ua | ub;
+        case 4: return ua ^ ub;
+        case 5: return ua == ub;
+        case 6: return ua != ub;
+        case 7: return ua < ub;
+        case 8: return ua <= ub;
+        case 9: return ua > ub;
+        default: return ua >= ub;
+    }
+}
+
+#pragma codesize (pop)
+
+static long ref_signed (unsigned char op, long a, long b)
+{
+    switch (op) {
+        case 0: return a + b;
+        case 1: return a - b;
+        case 2: return a & b;
+        case 3: return a | b;
+        case 4: return a ^ b;
+        case 5: return a == b;
+        case 6: return a != b;
+        case 7: return a < b;
+        case 8: return a <= b;
+        case 9: return a > b;
+        default: return a >= b;
+    }
+}
+
+static unsigned long ref_unsigned (unsigned char op, unsigned long a, unsigned long b)
+{
+    switch (op) {
+        case 0: return a + b;
+        case 1: return a - b;
+        case 2: return a & b;
+        case 3: return a | b;
+        case 4: return a ^ b;
+        case 5: return a == b;
+        case 6: return a != b;
+        case 7: return a < b;
+        case 8: return a <= b;
+        case 9: return a > b;
+        default: return a >= b;
+    }
+}
+
+int main (void)
+{
+    unsigned char i, j, op;
+
+    for (i = 0; i < COUNT; ++i) {
+        for (j = 0; j < COUNT; ++j) {
+            sa = values[i];
+            sb = values[j];
+            ua = sa;
+            ub = sb;
+            for (op = 0; op <= 10; ++op) {
+                if (inl_signed (op) != ref_signed (op, sa, sb)) {
+                    printf ("op %u: %ld, %ld: %ld, expected %ld\n", op, sa, sb,
+                            inl_signed (op), ref_signed (op, sa, sb));
+                    ++failures;
+                }
+                if (inl_unsigned (op) != ref_unsigned (op, ua, ub)) {
+                    printf ("op %u: %lu, %lu: %lu, expected %lu\n", op, ua, ub,
+                            inl_unsigned (op), ref_unsigned (op, ua, ub));
+                    ++failures;
+                }
+            }
+        }
+    }
+
+    return failures? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,95 @@
+/*
+  !!DESCRIPTION!! multiplication by constants
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+  !!AUTHOR!!
+*/
+
+/*
+  Multiplications of ints and longs by constants use sequences of helper
+  calls or add/shift chains instead of the generic multiplication, if the
+  code size factor allows it. Check them against multiplications by
+  variables with the default and a large code size factor.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static unsigned char failures = 0;
+
+static unsigned iv;
+static unsigned long lv;
+
+#define CHECK_INT(c)                                                    \
+    if (x * (c) != x * (iv = (c))) {                                    \
+        printf ("%u * %u = %u, expected %u\n", x, (c), x * (c), x * iv);\
+        ++failures;                                                     \
+    }                                                                   \
+    if (s * (c) != s * (int) (iv = (c))) {                              \
+        printf ("%d * %u = %d, expected %d\n", s, (c), s * (c), s * (int) iv);\
+        ++failures;                                                     \
+    }
+
+#define CHECK_LONG(c)                                                   \
+    if (l * (c) != l * (lv = (c))) {                                    \
+        printf ("%lu * %lu = %lu, expected %lu\n", l, (c), l * (c), l * lv);\
+        ++failures;                                                     \
+    }
+
+#define CHECK_INTS()                                                    \
+    CHECK_INT (11)                                                      \
+    CHECK_INT (12)                                                      \
+    CHECK_INT (13)                                                      \
+    CHECK_INT (15)                                                      \
+    CHECK_INT (18)                                                      \
+    CHECK_INT (24)                                                      \
+    CHECK_INT (40)                                                      \
+    CHECK_INT (45)                                                      \
+    CHECK_INT (63)                                                      \
+    CHECK_INT (100)                                                     \
+    CHECK_INT (300)                                                     \
+    CHECK_INT (1000)                                                    \
+    CHECK_INT (0x5555)                                                  \
+    CHECK_INT (0x7FFF)                                                  \
+    CHECK_INT (0xFFF3)
+
+#define CHECK_LONGS()                                                   \
+    CHECK_LONG (3UL)                                                    \
+    CHECK_LONG (10UL)                                                   \
+    CHECK_LONG (12UL)                                                   \
+    CHECK_LONG (13UL)                                                   \
+    CHECK_LONG (40UL)                                                   \
+    CHECK_LONG (255UL)                                                  \
+    CHECK_LONG (1000UL)                                                 \
+    CHECK_LONG (65537UL)                                                \
+    CHECK_LONG (0x12345UL)
+
+static void check_default (unsigned x, int s, unsigned long l)
+{
+    CHECK_INTS ()
+    CHECK_LONGS ()
+}
+
+#pragma codesize (push, 1000)
+
+static void check_inline (unsigned x, int s, unsigned long l)
+{
+    CHECK_INTS ()
+    CHECK_LONGS ()
+}
+
+#pragma codesize (pop)
+
+int main (void)
+{
+    unsigned x = 0;
+    unsigned char i;
+
+    for (i = 0; i < 100; ++i) {
+        check_default (x, (int) x, (unsigned long) x * 40503UL);
+        check_inline (x, (int) x, (unsigned long) x * 40503UL);
+        x += 1237;
+    }
+
+    return failures? EXIT_FAILURE : EXIT_SUCCESS;
+}
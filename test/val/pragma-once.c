@@ -0,0 +1,25 @@
+/*
+  !!DESCRIPTION!! #pragma once and include guard detection
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+  !!AUTHOR!!
+*/
+
+/*
+  The file includes itself. Since it is marked with #pragma once, the second
+  include must be ignored, otherwise there would be duplicate definitions.
+*/
+
+#pragma once
+
+#include <stdlib.h>
+#include <stdlib.h>
+
+#include "pragma-once.c"
+
+static unsigned char count = 1;
+
+int main (void)
+{
+    return (count == 1)? EXIT_SUCCESS : EXIT_FAILURE;
+}
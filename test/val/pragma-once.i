@@ -0,0 +1,97 @@
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+ 
+typedef unsigned size_t;
+ 
+ 
+typedef struct {
+int rem;
+int quot;
+} div_t;
+ 
+typedef struct {
+long rem;
+long quot;
+} ldiv_t;
+ 
+void* __fastcall__ malloc (size_t size);
+void* __fastcall__ calloc (size_t count, size_t size);
+void* __fastcall__ realloc (void* block, size_t size);
+void __fastcall__ free (void* block);
+ 
+int __fastcall__ posix_memalign (void** memptr, size_t alignment, size_t size);
+ 
+void __fastcall__ _heapadd (void* mem, size_t size);
+ 
+size_t __fastcall__ _heapblocksize (const void* block);
+ 
+size_t _heapmemavail (void);
+ 
+size_t _heapmaxavail (void);
+ 
+ 
+int rand (void);
+void __fastcall__ srand (unsigned seed);
+void _randomize (void); 
+ 
+void abort (void) __attribute__ ((noreturn));
+int __fastcall__ abs (int val);
+long __fastcall__ labs (long val);
+int __fastcall__ atoi (const char* s);
+long __fastcall__ atol (const char* s);
+int __fastcall__ atexit (void (*exitfunc) (void));
+void* __fastcall__ bsearch (const void* key, const void* base, size_t n,
+size_t size, int __fastcall__ (* cmp) (const void*, const void*));
+div_t __fastcall__ div (int numer, int denom);
+void __fastcall__ exit (int ret) __attribute__ ((noreturn));
+char* __fastcall__ getenv (const char* name);
+void __fastcall__ qsort (void* base, size_t count, size_t size,
+int __fastcall__ (* compare) (const void*, const void*));
+long __fastcall__ strtol (const char* nptr, char** endptr, int base);
+unsigned long __fastcall__ strtoul (const char* nptr, char** endptr, int base);
+int __fastcall__ system (const char* s);
+ 
+void __fastcall__ _swap (void* p, void* q, size_t size);
+char* __fastcall__ itoa (int val, char* buf, int radix);
+char* __fastcall__ utoa (unsigned val, char* buf, int radix);
+char* __fastcall__ ltoa (long val, char* buf, int radix);
+char* __fastcall__ ultoa (unsigned long val, char* buf, int radix);
+int __fastcall__ putenv (char* s);
+ 
+static unsigned char count = 1;
+int main (void)
+{
+return (count == 1)? 0 : 1;
+}
@@ -0,0 +1,57 @@
+/*
+  !!DESCRIPTION!! stack op with a zero page lhs changed by a call
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+  !!AUTHOR!!
+*/
+
+/*
+  With a large code size factor, shifts by a constant are inlined using tmp1
+  as scratch location, while shifts by a variable count still call
+  subroutines which destroy tmp1. Check that OptStackOps doesn't use tmp1
+  as the left hand operand of an op after such a call.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static unsigned char failures = 0;
+
+#pragma codesize (push, 500)
+
+static unsigned f (unsigned a, unsigned char n)
+{
+    return (a << 3) + (a >> n) + ((int) a >> 2);
+}
+
+#pragma codesize (pop)
+
+static unsigned ref (unsigned a, unsigned char n)
+{
+    unsigned r = a * 8;
+    unsigned char i;
+    unsigned s = a;
+
+    for (i = 0; i < n; ++i) {
+        s /= 2;
+    }
+    return r + s + ((a >> 2) | ((a & 0x8000)? 0xC000 : 0));
+}
+
+int main (void)
+{
+    unsigned a = 0;
+    unsigned char i;
+    unsigned char n;
+
+    for (i = 0; i < 64; ++i, a += 1021) {
+        for (n = 0; n < 8; ++n) {
+            if (f (a, n) != ref (a, n)) {
+                printf ("f(%u, %u) = %u, expected %u\n", a, n, f (a, n), ref (a, n));
+                ++failures;
+            }
+        }
+    }
+
+    return failures? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,351 @@
+/*
+  !!DESCRIPTION!! switch statements with many case labels
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+  !!AUTHOR!!
+*/
+
+/*
+  Large switch statements are compiled into jump tables or binary searches
+  depending on how dense the case values are. Check all of them against a
+  reference computed without a switch.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static unsigned char failures = 0;
+
+/* Dense values with a few holes, the highest value comes first */
+static unsigned char dense (unsigned char c)
+{
+    switch (c) {
+        case 59: return 177;
+        case 10: return 30;
+        case 11: return 33;
+        case 12: return 36;
+        case 13: return 39;
+        case 15: return 45;
+        case 16: return 48;
+        case 17: return 51;
+        case 18: return 54;
+        case 19: return 57;
+        case 20: return 60;
+        case 22: return 66;
+        case 23: return 69;
+        case 24: return 72;
+        case 25: return 75;
+        case 26: return 78;
+        case 27: return 81;
+        case 29: return 87;
+        case 30: return 90;
+        case 31: return 93;
+        case 32: return 96;
+        case 33: return 99;
+        case 34: return 102;
+        case 36: return 108;
+        case 37: return 111;
+        case 38: return 114;
+        case 39: return 117;
+        case 40: return 120;
+        case 41: return 123;
+        case 43: return 129;
+        case 44: return 132;
+        case 45: return 135;
+        case 46: return 138;
+        case 47: return 141;
+        case 48: return 144;
+        case 50: return 150;
+        case 51: return 153;
+        case 52: return 156;
+        case 53: return 159;
+        case 54: return 162;
+        case 55: return 165;
+        case 57: return 171;
+        case 58: return 174;
+        default: return 0xFF;
+    }
+}
+
+static unsigned char dense_ref (unsigned char c)
+{
+    if (c >= 10 && c < 60 && c % 7 != 0) {
+        return c * 3;
+    }
+    return 0xFF;
+}
+
+/* Dense values with fall through into the default code */
+static unsigned char dense2 (unsigned char c)
+{
+    unsigned char r = 0;
+    switch (c) {
+        case 0: r = 100; break;
+        case 1: r = 101; break;
+        case 2: r = 102; break;
+        case 3: r = 103; break;
+        case 4: r = 104; break;
+        case 5: r = 105; break;
+        case 6: r = 106; break;
+        case 7: r = 107; break;
+        case 8: r = 108; break;
+        case 9: r = 109; break;
+        case 10: r = 110; break;
+        case 11: r = 111; break;
+        case 12: r = 112; break;
+        case 13: r = 113; break;
+        case 14: r = 114; break;
+        case 15: r = 115; break;
+        case 16: r = 116; break;
+        case 17: r = 117; break;
+        case 18: r = 118; break;
+        case 19: r = 119; break;
+        case 20: r = 120; break;
+        case 21: r = 121; break;
+        case 22: r = 122; break;
+        case 23: r = 123; break;
+        case 24: r = 124; break;
+        case 25: r = 125; break;
+        case 26: r = 126; break;
+        case 27: r = 127; break;
+        case 28: r = 128; break;
+        case 29: r = 129; break;
+        case 30: r = 130; break;
+        case 31: r = 131; break;
+        case 32: r = 132; break;
+        case 33: r = 133; break;
+        case 34: r = 134; break;
+        case 35: r = 135; break;
+        case 36: r = 136; break;
+        case 37: r = 137; break;
+        case 38: r = 138; break;
+        case 39: r = 139; break;
+    }
+    return r;
+}
+
+static unsigned char dense2_ref (unsigned char c)
+{
+    return (c < 40)? c + 100 : 0;
+}
+
+/* Sparse values */
+static unsigned char sparse (unsigned char c)
+{
+    switch (c) {
+        case 3: return 1;
+        case 10: return 2;
+        case 17: return 3;
+        case 24: return 4;
+        case 31: return 5;
+        case 38: return 6;
+        case 45: return 7;
+        case 52: return 8;
+        case 59: return 9;
+        case 66: return 10;
+        case 73: return 11;
+        case 80: return 12;
+        case 87: return 13;
+        case 94: return 14;
+        case 101: return 15;
+        case 125: return 16;
+        case 133: return 17;
+        case 141: return 18;
+        case 149: return 19;
+        case 157: return 20;
+        case 165: return 21;
+        case 173: return 22;
+        case 181: return 23;
+        case 189: return 24;
+        case 197: return 25;
+        case 205: return 26;
+        case 213: return 27;
+        case 221: return 28;
+        case 229: return 29;
+        case 237: return 30;
+        default: return 0;
+    }
+}
+
+static unsigned char sparse_ref (unsigned char c)
+{
+    unsigned char i;
+    for (i = 0; i < 30; ++i) {
+        if ((i < 15 && c == (unsigned char) (i * 7 + 3)) ||
+            (i >= 15 && c == (unsigned char) (i * 8 + 5))) {
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+/* Signed values in a wider type */
+static int wide (int i)
+{
+    switch (i) {
+        case -20: return 1;
+        case -18: return 12;
+        case -16: return 23;
+        case -14: return 34;
+        case -12: return 45;
+        case -10: return 56;
+        case -8: return 67;
+        case -6: return 78;
+        case -4: return 89;
+        case -2: return 100;
+        case 0: return 111;
+        case 2: return 122;
+        case 4: return 133;
+        case 6: return 144;
+        case 8: return 155;
+        case 10: return 166;
+        case 12: return 177;
+        case 14: return 188;
+        case 16: return 199;
+        case 18: return 210;
+        case 20: return 221;
+        case 1000: return 232;
+        case 2000: return 243;
+        case 3000: return 254;
+        case -1000: return 265;
+        case -2000: return 276;
+        case -3000: return 287;
+        case 4000: return 298;
+        case 5000: return 309;
+        case 6000: return 320;
+        case 7000: return 331;
+        default: return -1;
+    }
+}
+
+static const int wide_values[] = {
+    -20, -18, -16, -14, -12, -10, -8, -6, -4, -2, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 1000, 2000, 3000, -1000, -2000, -3000, 4000, 5000, 6000, 7000
+};
+
+static int wide_ref (int i)
+{
+    unsigned char j;
+    for (j = 0; j < sizeof (wide_values) / sizeof (wide_values[0]); ++j) {
+        if (wide_values[j] == i) {
+            return j * 11 + 1;
+        }
+    }
+    return -1;
+}
+
+/* Values in a long */
+static unsigned char longsw (long l)
+{
+    switch (l) {
+        case 0x0L: return 1;
+        case 0x10001L: return 2;
+        case 0x20002L: return 3;
+        case 0x30003L: return 4;
+        case 0x40004L: return 5;
+        case 0x50005L: return 6;
+        case 0x60006L: return 7;
+        case 0x70007L: return 8;
+        case 0x80008L: return 9;
+        case 0x90009L: return 10;
+        case 0xA000AL: return 11;
+        case 0xB000BL: return 12;
+        case 0x1000000L: return 13;
+        case 0x2000000L: return 14;
+        case 0x3000000L: return 15;
+        default: return 0;
+    }
+}
+
+static const long long_values[] = {
+    0x0L, 0x10001L, 0x20002L, 0x30003L, 0x40004L, 0x50005L, 0x60006L, 0x70007L, 0x80008L, 0x90009L, 0xA000AL, 0xB000BL, 0x1000000L, 0x2000000L, 0x3000000L
+};
+
+static unsigned char longsw_ref (long l)
+{
+    unsigned char j;
+    for (j = 0; j < sizeof (long_values) / sizeof (long_values[0]); ++j) {
+        if (long_values[j] == l) {
+            return j + 1;
+        }
+    }
+    return 0;
+}
+
+/* Only compare chains of switch statements are turned into tables. The code
+   at the target of this one relies on the flags of the matching compare.
+*/
+static unsigned char asmflags;
+
+#define ASMCASE(n)      __asm__ ("cmp #%b", n); __asm__ ("jeq %g", found)
+
+static void asmchain (unsigned char c)
+{
+    asmflags = c;
+    __asm__ ("lda %v", asmflags);
+    ASMCASE (1);  ASMCASE (2);  ASMCASE (3);  ASMCASE (4);
+    ASMCASE (5);  ASMCASE (6);  ASMCASE (7);  ASMCASE (8);
+    ASMCASE (9);  ASMCASE (10); ASMCASE (11); ASMCASE (12);
+    ASMCASE (13); ASMCASE (14); ASMCASE (15); ASMCASE (16);
+    ASMCASE (17); ASMCASE (18); ASMCASE (19); ASMCASE (20);
+    __asm__ ("jmp %g", done);
+found:
+    __asm__ ("php");
+    __asm__ ("pla");
+    __asm__ ("sta %v", asmflags);
+done:
+    ;
+}
+
+int main (void)
+{
+    unsigned i;
+    int      k;
+
+    for (i = 0; i < 256; ++i) {
+        if (dense (i) != dense_ref (i)) {
+            printf ("dense (%u) failed\n", i);
+            ++failures;
+        }
+        if (dense2 (i) != dense2_ref (i)) {
+            printf ("dense2 (%u) failed\n", i);
+            ++failures;
+        }
+        if (sparse (i) != sparse_ref (i)) {
+            printf ("sparse (%u) failed\n", i);
+            ++failures;
+        }
+    }
+
+    for (k = -40; k < 40; ++k) {
+        if (wide (k) != wide_ref (k)) {
+            printf ("wide (%d) failed\n", k);
+            ++failures;
+        }
+    }
+    for (i = 0; i < sizeof (wide_values) / sizeof (wide_values[0]); ++i) {
+        k = wide_values[i];
+        if (wide (k) != wide_ref (k) || wide (k + 1) != wide_ref (k + 1)) {
+            printf ("wide (%d) failed\n", k);
+            ++failures;
+        }
+    }
+
+    for (i = 0; i < sizeof (long_values) / sizeof (long_values[0]); ++i) {
+        long l = long_values[i];
+        if (longsw (l) != longsw_ref (l) || longsw (l + 1) != longsw_ref (l + 1)) {
+            printf ("longsw (%ld) failed\n", l);
+            ++failures;
+        }
+    }
+
+    for (i = 1; i <= 20; ++i) {
+        asmchain (i);
+        if ((asmflags & 0x03) != 0x03) {
+            printf ("asmchain (%u) failed\n", i);
+            ++failures;
+        }
+    }
+
+    printf ("failures: %u\n", failures);
+    return failures? EXIT_FAILURE : EXIT_SUCCESS;
+}
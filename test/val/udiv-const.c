@@ -0,0 +1,105 @@
+/*
+  !!DESCRIPTION!! unsigned division by constants
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+  !!AUTHOR!!
+*/
+
+/*
+  Unsigned division by some small constants doesn't use the generic division,
+  but helpers that multiply by the reciprocal. Check all possible 16 bit
+  dividends against running quotients, all 8 bit dividends for the char
+  forms, and every 16th dividend for divisors that contain a power of two.
+  The remainders are checked by umod-const.c.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static unsigned char failures = 0;
+
+static unsigned q3, q5, q7, q10, q100;
+static unsigned char r3, r5, r7, r10, r100;
+
+static void fail (const char* op, unsigned n, unsigned d, unsigned got, unsigned expected)
+{
+    if (failures < 20) {
+        printf ("%u %s %u = %u, expected %u\n", n, op, d, got, expected);
+        ++failures;
+    }
+}
+
+static void check (unsigned n)
+{
+    if (n / 3 != q3)            fail ("/", n, 3, n / 3, q3);
+    if (n / 5 != q5)            fail ("/", n, 5, n / 5, q5);
+    if (n / 7 != q7)            fail ("/", n, 7, n / 7, q7);
+    if (n / 10 != q10)          fail ("/", n, 10, n / 10, q10);
+    if (n / 100 != q100)        fail ("/", n, 100, n / 100, q100);
+}
+
+static void check_scaled (unsigned n)
+{
+    /* Divisors with a power of two factor shift first */
+    if (n / 6 != q3 / 2)        fail ("/", n, 6, n / 6, q3 / 2);
+    if (n / 12 != q3 / 4)       fail ("/", n, 12, n / 12, q3 / 4);
+    if (n / 20 != q10 / 2)      fail ("/", n, 20, n / 20, q10 / 2);
+    if (n / 40 != q5 / 8)       fail ("/", n, 40, n / 40, q5 / 8);
+    if (n / 56 != q7 / 8)       fail ("/", n, 56, n / 56, q7 / 8);
+    if (n / 400 != q100 / 4)    fail ("/", n, 400, n / 400, q100 / 4);
+}
+
+static void check_char (unsigned char c)
+{
+    unsigned char x;
+
+    x = c;
+    x /= 10;
+    if (x != q10) {
+        fail ("/=", c, 10, x, q10);
+    }
+    x = c;
+    x /= 20;
+    if (x != q10 / 2) {
+        fail ("/=", c, 20, x, q10 / 2);
+    }
+}
+
+int main (void)
+{
+    unsigned n = 0;
+
+    do {
+        check (n);
+        if (n < 256) {
+            check_char (n);
+        }
+        if ((n & 0x0F) == 0) {
+            check_scaled (n);
+        }
+
+        /* Next dividend, keep the running quotients and remainders */
+        if (++r3 == 3) {
+            r3 = 0;
+            ++q3;
+        }
+        if (++r5 == 5) {
+            r5 = 0;
+            ++q5;
+        }
+        if (++r7 == 7) {
+            r7 = 0;
+            ++q7;
+        }
+        if (++r10 == 10) {
+            r10 = 0;
+            ++q10;
+        }
+        if (++r100 == 100) {
+            r100 = 0;
+            ++q100;
+        }
+    } while (++n != 0);
+
+    return failures? EXIT_FAILURE : EXIT_SUCCESS;
+}
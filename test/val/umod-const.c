@@ -0,0 +1,84 @@
+/*
+  !!DESCRIPTION!! unsigned modulo by constants
+  !!ORIGIN!!      cc65 regression tests
+  !!LICENCE!!     Public Domain
+  !!AUTHOR!!
+*/
+
+/*
+  Unsigned modulo by some small constants uses the remainder returned by the
+  division helpers. Check all possible 16 bit dividends against running
+  remainders, and all 8 bit dividends for the char forms. The quotients are
+  checked by udiv-const.c.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static unsigned char failures = 0;
+
+static unsigned char r3, r5, r7, r10, r100;
+
+static void fail (const char* op, unsigned n, unsigned d, unsigned got, unsigned expected)
+{
+    if (failures < 20) {
+        printf ("%u %s %u = %u, expected %u\n", n, op, d, got, expected);
+        ++failures;
+    }
+}
+
+static void check (unsigned n)
+{
+    if (n % 3 != r3)            fail ("%", n, 3, n % 3, r3);
+    if (n % 5 != r5)            fail ("%", n, 5, n % 5, r5);
+    if (n % 7 != r7)            fail ("%", n, 7, n % 7, r7);
+    if (n % 10 != r10)          fail ("%", n, 10, n % 10, r10);
+    if (n % 100 != r100)        fail ("%", n, 100, n % 100, r100);
+}
+
+static void check_char (unsigned char c)
+{
+    unsigned char x;
+
+    x = c;
+    x %= 7;
+    if (x != r7) {
+        fail ("%=", c, 7, x, r7);
+    }
+    x = c;
+    x %= 100;
+    if (x != r100) {
+        fail ("%=", c, 100, x, r100);
+    }
+}
+
+int main (void)
+{
+    unsigned n = 0;
+
+    do {
+        check (n);
+        if (n < 256) {
+            check_char (n);
+        }
+
+        /* Next dividend, keep the running remainders */
+        if (++r3 == 3) {
+            r3 = 0;
+        }
+        if (++r5 == 5) {
+            r5 = 0;
+        }
+        if (++r7 == 7) {
+            r7 = 0;
+        }
+        if (++r10 == 10) {
+            r10 = 0;
+        }
+        if (++r100 == 100) {
+            r100 = 0;
+        }
+    } while (++n != 0);
+
+    return failures? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,295 @@
+; da65 V2.16 - Git b0e3ed9
+; Created:    2026-10-19 06:25:24
+; Input file: ../../testwrk/dasm/4510-disass.bin
+; Page:       1
+
+
+        .setcpu "4510"
+
+L2345           := $2345
+L2456           := $2456
+L8000:  brk
+        ora     ($12,x)
+        cle
+        see
+        tsb     $12
+        ora     $12
+        asl     $12
+        rmb0    $12
+        php
+        ora     #$01
+        asl     a
+        tsy
+        tsb     L2345
+        ora     L2345
+        asl     L2345
+        bbr0    $12,L801E
+L801E:  bpl     L8041
+        ora     ($12),y
+        ora     ($12),z
+        lbpl    L8000
+        trb     $12
+        ora     $12,x
+        asl     $12,x
+        rmb1    $12
+        clc
+        ora     L2345,y
+        inc     a
+        inz
+        trb     L2345
+        ora     L2345,x
+        asl     L2345,x
+        bbr1    $12,L8041
+L8041:  jsr     L2345
+        and     ($12,x)
+        jsr     (L2345)
+
+        jsr     (L2456,x)
+
+        bit     $12
+        and     $12
+        rol     $12
+        rmb2    $12
+        plp
+        and     #$01
+        rol     a
+        tys
+        bit     L2345
+        and     L2345
+        rol     L2345
+        bbr2    $12,L8065
+; da65 V2.16 - Git b0e3ed9
+; Created:    2026-10-19 06:25:24
+; Input file: ../../testwrk/dasm/4510-disass.bin
+; Page:       2
+
+L8065:  bmi     L8088
+        and     ($12),y
+        and     ($12),z
+        lbmi    L8000
+        bit     $12,x
+        and     $12,x
+        rol     $12,x
+        rmb3    $12
+        sec
+        and     L2345,y
+        dec     a
+        dez
+        bit     L2345,x
+        and     L2345,x
+        rol     L2345,x
+        bbr3    $12,L8088
+L8088:  rti
+
+        eor     ($12,x)
+        neg
+        asr     a
+        asr     $12
+        eor     $12
+        lsr     $12
+        rmb4    $12
+        pha
+        eor     #$01
+        lsr     a
+        taz
+        jmp     L2345
+
+        eor     L2345
+        lsr     L2345
+        bbr4    $12,L80A6
+L80A6:  bvc     L80C7
+        eor     ($12),y
+        eor     ($12),z
+        lbvc    L8000
+        asr     $12,x
+        eor     $12,x
+        lsr     $12,x
+        rmb5    $12
+        cli
+        eor     L2345,y
+        phy
+        tab
+        map
+        eor     L2345,x
+        lsr     L2345,x
+        bbr5    $12,L80C7
+L80C7:  rts
+
+        adc     ($12,x)
+        rtn     #$09
+        bsr     L8000
+; da65 V2.16 - Git b0e3ed9
+; Created:    2026-10-19 06:25:24
+; Input file: ../../testwrk/dasm/4510-disass.bin
+; Page:       3
+
+        stz     $12
+        adc     $12
+        ror     $12
+        rmb6    $12
+        pla
+        adc     #$01
+        ror     a
+        tza
+        jmp     (L2345)
+
+        adc     L2345
+        ror     L2345
+        bbr6    $12,L80E8
+L80E8:  bvs     L810B
+        adc     ($12),y
+        adc     ($12),z
+        lbvs    L8000
+        stz     $12,x
+        adc     $12,x
+        ror     $12,x
+        rmb7    $12
+        sei
+        adc     L2345,y
+        ply
+        tba
+        jmp     (L2456,x)
+        adc     L2345,x
+        ror     L2345,x
+        bbr7    $12,L810B
+L810B:  bra     L812F
+        sta     ($12,x)
+        sta     ($0F,sp),y
+        lbra    L8000
+        sty     $12
+        sta     $12
+        stx     $12
+        smb0    $12
+        dey
+        bit     #$01
+        txa
+        sty     L2345,x
+        sty     L2345
+        sta     L2345
+        stx     L2345
+        bbs0    $12,L812F
+L812F:  bcc     L8154
+        sta     ($12),y
+        sta     ($12),z
+        lbcc    L8000
+        sty     $12,x
+        sta     $12,x
+        stx     $12,y
+        smb1    $12
+        tya
+        sta     L2345,y
+; da65 V2.16 - Git b0e3ed9
+; Created:    2026-10-19 06:25:24
+; Input file: ../../testwrk/dasm/4510-disass.bin
+; Page:       4
+
+        txs
+        stx     L2345,y
+        stz     L2345
+        sta     L2345,x
+        stz     L2345,x
+        bbs1    $12,L8154
+L8154:  ldy     #$01
+        lda     ($12,x)
+        ldx     #$01
+        ldz     #$01
+        ldy     $12
+        lda     $12
+        ldx     $12
+        smb2    $12
+        tay
+        lda     #$01
+        tax
+        ldz     L2345
+        ldy     L2345
+        lda     L2345
+        ldx     L2345
+        bbs2    $12,L8177
+L8177:  bcs     L819C
+        lda     ($12),y
+        lda     ($12),z
+        lbcs    L8000
+        ldy     $12,x
+        lda     $12,x
+        ldx     $12,y
+        smb3    $12
+        clv
+        lda     L2345,y
+        tsx
+        ldz     L2345,x
+        ldy     L2345,x
+        lda     L2345,x
+        ldx     L2345,y
+        bbs3    $12,L819C
+L819C:  cpy     #$01
+        cmp     ($12,x)
+        cpz     #$01
+        dew     $12
+        cpy     $12
+        cmp     $12
+        dec     $12
+        smb4    $12
+        iny
+        cmp     #$01
+        dex
+        asw     L2345
+        cpy     L2345
+        cmp     L2345
+        dec     L2345
+        bbs4    $12,L81BF
+L81BF:  bne     L81E2
+; da65 V2.16 - Git b0e3ed9
+; Created:    2026-10-19 06:25:24
+; Input file: ../../testwrk/dasm/4510-disass.bin
+; Page:       5
+
+        cmp     ($12),y
+        cmp     ($12),z
+        lbne    L8000
+        cpz     $12
+        cmp     $12,x
+        dec     $12,x
+        smb5    $12
+        cld
+        cmp     L2345,y
+        phx
+        phz
+        cpz     L2345
+        cmp     L2345,x
+        dec     L2345,x
+        bbs5    $12,L81E2
+L81E2:  cpx     #$01
+        sbc     ($12,x)
+        lda     ($0F,sp),y
+        inw     $12
+        cpx     $12
+        sbc     $12
+        inc     $12
+        smb6    $12
+        inx
+        sbc     #$01
+        eom
+        eom
+        row     L2345
+        cpx     L2345
+        sbc     L2345
+        inc     L2345
+        bbs6    $12,L8206
+L8206:  beq     L822D
+        sbc     ($12),y
+        sbc     ($12),z
+        lbeq    L8000
+        phw     #$089A
+        sbc     $12,x
+        inc     $12,x
+        smb7    $12
+        sed
+        sbc     L2345,y
+        plx
+        plz
+        phw     L2345
+        phw     L2345
+        sbc     L2345,x
+        inc     L2345,x
+        bbs7    $12,L822D
+L822D:  brk
@@ -0,0 +1,140 @@
+; da65 V2.16 - Git b0e3ed9
+; Created:    2026-10-19 06:25:24
+; Input file: ../../testwrk/dasm/batch.bin
+; Page:       1
+
+
+        .setcpu "4510"
+
+        lda     $1234,x
+        sta     $10
+        inx
+        lda     $1234,x
+        sta     $11
+        inx
+        lda     $1234,x
+        sta     $12
+        inx
+        lda     $1234,x
+        sta     $13
+        inx
+        lda     $1234,x
+        sta     $14
+        inx
+        lda     $1234,x
+        sta     $15
+        inx
+        lda     $1234,x
+        sta     $16
+        inx
+        lda     $1234,x
+        sta     $17
+        inx
+        lda     $1234,x
+        sta     $18
+        inx
+        lda     $1234,x
+        sta     $19
+        inx
+        lda     $1234,x
+        sta     $1A
+        inx
+        lda     $1234,x
+        sta     $1B
+        inx
+        lda     $1234,x
+        sta     $1C
+        inx
+        lda     $1234,x
+        sta     $1D
+        inx
+        lda     $1234,x
+        sta     $1E
+        inx
+        lda     $1234,x
+        sta     $1F
+        inx
+        lda     $1234,x
+        sta     $20
+        inx
+        lda     $1234,x
+; da65 V2.16 - Git b0e3ed9
+; Created:    2026-10-19 06:25:24
+; Input file: ../../testwrk/dasm/batch.bin
+; Page:       2
+
+        sta     $21
+        inx
+        lda     $1234,x
+        sta     $22
+        inx
+        lda     $1234,x
+        sta     $23
+        inx
+        lda     $1234,x
+        sta     $24
+        inx
+        lda     $1234,x
+        sta     $25
+        inx
+        lda     $1234,x
+        sta     $26
+        inx
+        lda     $1234,x
+        sta     $27
+        inx
+        lda     $1234,x
+        sta     $28
+        inx
+        lda     $1234,x
+        sta     $29
+        inx
+        lda     $1234,x
+        sta     $2A
+        inx
+        lda     $1234,x
+        sta     $2B
+        inx
+        lda     $1234,x
+        sta     $2C
+        inx
+        lda     $1234,x
+        sta     $2D
+        inx
+        lda     $1234,x
+        sta     $2E
+        inx
+        lda     $1234,x
+        sta     $2F
+        inx
+        lda     $1234,x
+        sta     $30
+        inx
+        lda     $1234,x
+        sta     $31
+        inx
+        lda     $1234,x
+        sta     $32
+        inx
+        lda     $1234,x
+        sta     $33
+; da65 V2.16 - Git b0e3ed9
+; Created:    2026-10-19 06:25:24
+; Input file: ../../testwrk/dasm/batch.bin
+; Page:       3
+
+        inx
+        lda     $1234,x
+        sta     $34
+        inx
+        lda     $1234,x
+        sta     $35
+        inx
+        lda     $1234,x
+        sta     $36
+        inx
+        lda     $1234,x
+        sta     $37
+        inx
+        rts
+
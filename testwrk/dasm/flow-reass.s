@@ -0,0 +1,27 @@
+; da65 V2.16 - Git b0e3ed9
+; Created:    2026-10-19 06:25:24
+; Input file: ../../testwrk/dasm/flow.bin
+; Page:       1
+
+
+        .setcpu "6502"
+
+        ldx     #$00
+L8002:  lda     L8014,x
+        beq     L800D
+        jsr     L8010
+        inx
+        bne     L8002
+L800D:  jmp     (L8021)
+
+L8010:  sta     $D020
+        rts
+
+L8014:  .byte   $48,$45,$4C,$4C,$4F,$2C,$20,$57
+        .byte   $4F,$52,$4C,$44,$00
+L8021:  .addr   L8023
+L8023:  lda     #$FF
+        sta     $10
+        rts
+
+        .byte   $02,$12,$FF,$AD,$34
@@ -0,0 +1,76 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_libsmall
+	.import		_libbig
+	.export		_main
+
+.segment	"RODATA"
+
+L0006:
+	.byte	$46,$61,$69,$6C,$65,$64,$3A,$20,$6C,$69,$62,$73,$6D,$61,$6C,$6C
+	.byte	$20,$28,$29,$20,$3D,$20,$25,$64,$2C,$20,$65,$78,$70,$65,$63,$74
+	.byte	$65,$64,$20,$25,$64,$0A,$00
+L000F:
+	.byte	$46,$61,$69,$6C,$65,$64,$3A,$20,$6C,$69,$62,$62,$69,$67,$20,$28
+	.byte	$29,$20,$3D,$20,$25,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64
+	.byte	$20,$31,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     _libsmall
+	cpx     #$00
+	bne     L0014
+	cmp     #$03
+	beq     L0002
+L0014:	lda     #<(L0006)
+	ldx     #>(L0006)
+	jsr     pushax
+	jsr     _libsmall
+	jsr     pushax
+	lda     #$03
+	jsr     pusha0
+	ldy     #$06
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	rts
+L0002:	jsr     _libbig
+	cpx     #$00
+	bne     L0015
+	cmp     #$01
+	beq     L0016
+L0015:	lda     #<(L000F)
+	ldx     #>(L000F)
+	jsr     pushax
+	jsr     _libbig
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	rts
+L0016:	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,100 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "arlib.c", 722, 1792385645
+	.dbg		file, "/root/repo/include/stdio.h", 6363, 1792382670
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1515150330
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1515150330
+	.dbg		file, "/root/repo/include/stdlib.h", 5748, 1515150330
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.dbg		sym, "libsmall", "00", extern, "_libsmall"
+	.dbg		sym, "libbig", "00", extern, "_libbig"
+	.import		_printf
+	.import		_libsmall
+	.import		_libbig
+	.export		_main
+
+.segment	"RODATA"
+
+L0006:
+	.byte	$46,$61,$69,$6C,$65,$64,$3A,$20,$6C,$69,$62,$73,$6D,$61,$6C,$6C
+	.byte	$20,$28,$29,$20,$3D,$20,$25,$64,$2C,$20,$65,$78,$70,$65,$63,$74
+	.byte	$65,$64,$20,$25,$64,$0A,$00
+L000F:
+	.byte	$46,$61,$69,$6C,$65,$64,$3A,$20,$6C,$69,$62,$62,$69,$67,$20,$28
+	.byte	$29,$20,$3D,$20,$25,$64,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64
+	.byte	$20,$31,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "arlib.c", 21
+	jsr     _libsmall
+	cpx     #$00
+	bne     L0004
+	cmp     #$03
+L0004:	jsr     boolne
+	jeq     L0002
+	.dbg	line, "arlib.c", 22
+	lda     #<(L0006)
+	ldx     #>(L0006)
+	jsr     pushax
+	jsr     _libsmall
+	jsr     pushax
+	ldx     #$00
+	lda     #$03
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "arlib.c", 23
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "arlib.c", 26
+L0002:	jsr     _libbig
+	cpx     #$00
+	bne     L000D
+	cmp     #$01
+L000D:	jsr     boolne
+	jeq     L000B
+	.dbg	line, "arlib.c", 27
+	lda     #<(L000F)
+	ldx     #>(L000F)
+	jsr     pushax
+	jsr     _libbig
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "arlib.c", 28
+	ldx     #$00
+	lda     #$01
+	jmp     L0001
+	.dbg	line, "arlib.c", 31
+L000B:	ldx     #$00
+	lda     #$00
+	jmp     L0001
+	.dbg	line, "arlib.c", 32
+L0001:	rts
+	.dbg	line
+
+.endproc
+
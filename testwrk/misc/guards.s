@@ -0,0 +1,76 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.export		_guards1
+	.export		_guards2
+	.export		_guards3
+	.export		_first
+	.export		_second
+	.export		_main
+
+.segment	"DATA"
+
+_guards1:
+	.word	$0001
+_guards2:
+	.word	$0002
+_guards3:
+	.word	$0003
+_first:
+	.word	$0001
+_second:
+	.word	$0001
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     _guards1
+	ldx     _guards1+1
+	jsr     pushax
+	lda     _guards2
+	ldx     _guards2+1
+	jsr     tosaddax
+	jsr     pushax
+	lda     _guards3
+	ldx     _guards3+1
+	jsr     tosaddax
+	jsr     pushax
+	lda     _first
+	ldx     _first+1
+	jsr     tosaddax
+	jsr     pushax
+	lda     _second
+	ldx     _second+1
+	jsr     tosaddax
+	cpx     #$00
+	bne     L0009
+	cmp     #$08
+L0009:	jsr     booleq
+	jeq     L000A
+	ldx     #$00
+	lda     #$00
+	jmp     L000C
+L000A:	ldx     #$00
+	lda     #$01
+L000C:	jmp     L0006
+L0006:	rts
+
+.endproc
+
@@ -0,0 +1,717 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_ops:
+	.word	$0000
+
+.segment	"RODATA"
+
+L0037:
+	.byte	$73,$6C,$6F,$74,$20,$25,$75,$3A,$20,$62,$6C,$6F,$63,$6B,$20,$6F
+	.byte	$66,$20,$25,$75,$20,$62,$79,$74,$65,$73,$20,$77,$61,$73,$20,$6F
+	.byte	$76,$65,$72,$77,$72,$69,$74,$74,$65,$6E,$0A,$00
+L0083:
+	.byte	$73,$6C,$6F,$74,$20,$25,$75,$3A,$20,$72,$65,$61,$6C,$6C,$6F,$63
+	.byte	$20,$6C,$6F,$73,$74,$20,$74,$68,$65,$20,$64,$61,$74,$61,$0A,$00
+L0078:
+	.byte	$63,$61,$6E,$6E,$6F,$74,$20,$72,$65,$61,$6C,$6C,$6F,$63,$61,$74
+	.byte	$65,$20,$25,$75,$20,$62,$79,$74,$65,$73,$0A,$00
+L005E:
+	.byte	$63,$61,$6E,$6E,$6F,$74,$20,$61,$6C,$6C,$6F,$63,$61,$74,$65,$20
+	.byte	$25,$75,$20,$62,$79,$74,$65,$73,$0A,$00
+L00B5:
+	.byte	$25,$75,$20,$6F,$70,$65,$72,$61,$74,$69,$6F,$6E,$73,$0A,$00
+
+.segment	"BSS"
+
+_slot:
+	.res	128,$00
+_size:
+	.res	128,$00
+_seed:
+	.res	2,$00
+_mem:
+	.res	19200,$00
+
+; ---------------------------------------------------------------
+; __near__ void * __near__ get (unsigned char, unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_get: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     mulax3
+	jsr     mulax10
+	jsr     mulax10
+	clc
+	adc     #<(_mem)
+	tay
+	txa
+	adc     #>(_mem)
+	tax
+	tya
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; __near__ void * __near__ reget (unsigned char, unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_reget: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     mulax3
+	jsr     mulax10
+	jsr     mulax10
+	clc
+	adc     #<(_mem)
+	tay
+	txa
+	adc     #>(_mem)
+	tax
+	tya
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ put (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_put: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ rnd (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_rnd: near
+
+.segment	"CODE"
+
+	lda     _seed
+	ldx     _seed+1
+	jsr     shlax4
+	jsr     shlax3
+	eor     _seed
+	pha
+	txa
+	eor     _seed+1
+	tax
+	pla
+	sta     _seed
+	stx     _seed+1
+	sta     ptr1
+	stx     ptr1+1
+	lda     _seed+1
+	lsr     a
+	eor     ptr1
+	pha
+	lda     #$00
+	eor     ptr1+1
+	tax
+	pla
+	sta     _seed
+	stx     _seed+1
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$00
+	eor     ptr1
+	pha
+	lda     _seed
+	eor     ptr1+1
+	tax
+	pla
+	sta     _seed
+	stx     _seed+1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ rndsize (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_rndsize: near
+
+.segment	"CODE"
+
+	jsr     _rnd
+	jsr     pushax
+	jsr     ldax0sp
+	txa
+	and     #$07
+	tax
+	cpx     #$00
+	bne     L001B
+	jsr     pushw0sp
+	lda     #$EC
+	jsr     tosumoda0
+	ldy     #$41
+	jsr     incaxy
+	jmp     incsp2
+L001B:	ldy     #$00
+	lda     (sp),y
+	ldx     #$00
+	and     #$3F
+	jsr     incax1
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ fill (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fill: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldx     #$00
+	lda     (sp,x)
+	asl     a
+	bcc     L00C0
+	inx
+	clc
+L00C0:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     ldaxi
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (sp),y
+	sta     (ptr1),y
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L00C1
+	inx
+	clc
+L00C1:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     ldaxi
+	sta     sreg
+	stx     sreg+1
+	ldx     #$00
+	lda     (sp,x)
+	asl     a
+	bcc     L00C2
+	inx
+	clc
+L00C2:	adc     #<(_size)
+	tay
+	txa
+	adc     #>(_size)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     decax1
+	clc
+	adc     sreg
+	sta     ptr1
+	txa
+	adc     sreg+1
+	sta     ptr1+1
+	ldy     #$00
+	lda     (sp),y
+	sta     (ptr1),y
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ check (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_check: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldx     #$00
+	lda     (sp,x)
+	asl     a
+	bcc     L00C9
+	inx
+	clc
+L00C9:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     ldaxi
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	ldx     #$00
+	lda     (ptr1),y
+	cmp     (sp),y
+	bne     L00CD
+	lda     (sp),y
+	asl     a
+	bcc     L00CA
+	inx
+	clc
+L00CA:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     ldaxi
+	sta     sreg
+	stx     sreg+1
+	ldx     #$00
+	lda     (sp,x)
+	asl     a
+	bcc     L00CB
+	inx
+	clc
+L00CB:	adc     #<(_size)
+	tay
+	txa
+	adc     #>(_size)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     decax1
+	clc
+	adc     sreg
+	sta     ptr1
+	txa
+	adc     sreg+1
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	cmp     (sp),y
+	jeq     incsp1
+L00CD:	lda     #<(L0037)
+	ldx     #>(L0037)
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	asl     a
+	bcc     L00CC
+	ldx     #$01
+	clc
+L00CC:	adc     #<(_size)
+	tay
+	txa
+	adc     #>(_size)
+	tax
+	tya
+	jsr     pushw
+	ldy     #$06
+	jsr     _printf
+	inc     _failures
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ round (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_round: near
+
+.segment	"CODE"
+
+	ldy     #$09
+	jsr     subysp
+	ldx     #$12
+	lda     #$34
+	sta     _seed
+	stx     _seed+1
+	ldx     #$00
+	txa
+	ldy     #$07
+	jsr     staxysp
+	jmp     L0040
+L0043:	jsr     _rnd
+	ldy     #$03
+	jsr     staxysp
+	and     #$3F
+	ldy     #$02
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L00D9
+	inx
+	clc
+L00D9:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     ldaxi
+	cpx     #$00
+	jne     L004E
+	cmp     #$00
+	jne     L004E
+	jsr     _rndsize
+	ldy     #$05
+	jsr     staxysp
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L00DA
+	inx
+	clc
+L00DA:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     _get
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L00DB
+	inx
+	clc
+L00DB:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     ldaxi
+	cpx     #$00
+	bne     L0059
+	cmp     #$00
+	bne     L0059
+	lda     #<(L005E)
+	ldx     #>(L005E)
+	jsr     pushax
+	ldy     #$0A
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	jmp     L0097
+L0059:	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L00DC
+	inx
+	clc
+L00DC:	adc     #<(_size)
+	sta     ptr1
+	txa
+	adc     #>(_size)
+	sta     ptr1+1
+	ldy     #$06
+	jsr     ldaxysp
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	iny
+	lda     (sp),y
+	jsr     _fill
+	jmp     L008C
+L004E:	ldy     #$04
+	jsr     ldaxysp
+	txa
+	and     #$0F
+	tax
+	cpx     #$00
+	jne     L0068
+	ldy     #$02
+	lda     (sp),y
+	jsr     _check
+	jsr     _rndsize
+	ldy     #$05
+	jsr     staxysp
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _reget
+	jsr     stax0sp
+	cpx     #$00
+	bne     L0074
+	cmp     #$00
+	bne     L0074
+	lda     #<(L0078)
+	ldx     #>(L0078)
+	jsr     pushax
+	ldy     #$0A
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	jmp     L0097
+L0074:	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L00DD
+	inx
+	clc
+L00DD:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	jsr     ldax0sp
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	jsr     ldax0sp
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1,x)
+	ldy     #$02
+	cmp     (sp),y
+	beq     L00E3
+	lda     #<(L0083)
+	ldx     #>(L0083)
+	jsr     pushax
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	ldy     #$02
+	ldx     #$00
+L00E3:	lda     (sp),y
+	asl     a
+	bcc     L00DE
+	inx
+	clc
+L00DE:	adc     #<(_size)
+	sta     ptr1
+	txa
+	adc     #>(_size)
+	sta     ptr1+1
+	ldy     #$06
+	jsr     ldaxysp
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	iny
+	lda     (sp),y
+	jsr     _fill
+	jmp     L008C
+L0068:	ldy     #$02
+	lda     (sp),y
+	jsr     _check
+	ldy     #$02
+	lda     (sp),y
+	jsr     _put
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L00DF
+	inx
+	clc
+L00DF:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	iny
+	sta     (ptr1),y
+L008C:	inc     _ops
+	bne     L0095
+	inc     _ops+1
+L0095:	ldy     #$07
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0040:	ldy     #$08
+	lda     (sp),y
+	cmp     #$07
+	bne     L0047
+	dey
+	lda     (sp),y
+	cmp     #$D0
+L0047:	jcc     L0043
+	lda     #$00
+	ldy     #$02
+	jmp     L00D8
+L00E5:	lda     (sp),y
+	asl     a
+	bcc     L00E0
+	ldx     #$01
+	clc
+L00E0:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	beq     L009E
+	iny
+	lda     (sp),y
+	jsr     _check
+	ldy     #$02
+	lda     (sp),y
+	jsr     _put
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L00E1
+	inx
+	clc
+L00E1:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	iny
+	sta     (ptr1),y
+	inc     _ops
+	bne     L009E
+	inc     _ops+1
+L009E:	iny
+	clc
+	lda     #$01
+	adc     (sp),y
+L00D8:	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$40
+	bcc     L00E5
+L0097:	ldy     #$09
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     #$00
+	tay
+	jmp     L00E7
+L00AE:	jsr     _round
+	ldy     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+L00E7:	sta     (sp),y
+	cmp     #$02
+	bcc     L00AE
+	lda     #<(L00B5)
+	ldx     #>(L00B5)
+	jsr     pushax
+	lda     _ops
+	ldx     _ops+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     _failures
+	beq     L00B9
+	ldx     #$00
+	lda     #$01
+	jmp     incsp1
+L00B9:	tax
+	jmp     incsp1
+
+.endproc
+
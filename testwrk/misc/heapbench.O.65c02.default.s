@@ -0,0 +1,970 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_malloc
+	.import		_calloc
+	.import		_realloc
+	.import		_free
+	.import		_posix_memalign
+	.import		__heapadd
+	.import		__heapblocksize
+	.import		__heapmemavail
+	.import		__heapmaxavail
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_ops:
+	.word	$0000
+
+.segment	"RODATA"
+
+L006C:
+	.byte	$73,$6C,$6F,$74,$20,$25,$75,$3A,$20,$62,$6C,$6F,$63,$6B,$20,$6F
+	.byte	$66,$20,$25,$75,$20,$62,$79,$74,$65,$73,$20,$77,$61,$73,$20,$6F
+	.byte	$76,$65,$72,$77,$72,$69,$74,$74,$65,$6E,$0A,$00
+L00F7:
+	.byte	$68,$65,$61,$70,$20,$66,$75,$6C,$6C,$3A,$20,$63,$61,$6E,$6E,$6F
+	.byte	$74,$20,$61,$6C,$6C,$6F,$63,$61,$74,$65,$20,$25,$75,$20,$62,$79
+	.byte	$74,$65,$73,$0A,$00
+L0026:
+	.byte	$70,$6F,$73,$69,$78,$5F,$6D,$65,$6D,$61,$6C,$69,$67,$6E,$3A,$20
+	.byte	$25,$70,$20,$6E,$6F,$74,$20,$61,$6C,$69,$67,$6E,$65,$64,$0A,$00
+L0117:
+	.byte	$5F,$68,$65,$61,$70,$6D,$65,$6D,$61,$76,$61,$69,$6C,$3A,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$25,$75,$0A,$00
+L00B8:
+	.byte	$73,$6C,$6F,$74,$20,$25,$75,$3A,$20,$72,$65,$61,$6C,$6C,$6F,$63
+	.byte	$20,$6C,$6F,$73,$74,$20,$74,$68,$65,$20,$64,$61,$74,$61,$0A,$00
+L0015:
+	.byte	$63,$61,$6C,$6C,$6F,$63,$20,$64,$69,$64,$6E,$27,$74,$20,$63,$6C
+	.byte	$65,$61,$72,$20,$74,$68,$65,$20,$62,$6C,$6F,$63,$6B,$0A,$00
+L0034:
+	.byte	$73,$6C,$6F,$74,$20,$25,$75,$3A,$20,$62,$6C,$6F,$63,$6B,$20,$73
+	.byte	$69,$7A,$65,$20,$25,$75,$20,$3C,$20,$25,$75,$0A,$00
+L00AD:
+	.byte	$63,$61,$6E,$6E,$6F,$74,$20,$72,$65,$61,$6C,$6C,$6F,$63,$61,$74
+	.byte	$65,$20,$25,$75,$20,$62,$79,$74,$65,$73,$0A,$00
+L0093	:=	L00F7+11
+L0123:
+	.byte	$5F,$68,$65,$61,$70,$6D,$61,$78,$61,$76,$61,$69,$6C,$3A,$20,$25
+	.byte	$75,$0A,$00
+L0129:
+	.byte	$25,$75,$20,$6F,$70,$65,$72,$61,$74,$69,$6F,$6E,$73,$0A,$00
+
+.segment	"BSS"
+
+_slot:
+	.res	128,$00
+_size:
+	.res	128,$00
+_seed:
+	.res	2,$00
+_extra:
+	.res	200,$00
+_full:
+	.res	512,$00
+
+; ---------------------------------------------------------------
+; __near__ void * __near__ get (unsigned char, unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_get: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+	lda     _ops
+	and     #$1F
+	beq     L000B
+	cmp     #$01
+	beq     L0019
+	bra     L002A
+L000B:	ldy     #$05
+	jsr     pushwysp
+	ldx     #$00
+	lda     #$01
+	jsr     _calloc
+	jsr     stax0sp
+	ldy     #$01
+	lda     (sp),y
+	ora     (sp)
+	beq     L0009
+	jsr     ldax0sp
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1)
+	beq     L0009
+	lda     #<(L0015)
+	ldx     #>(L0015)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	bra     L0009
+L0019:	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	lda     #$10
+	jsr     pusha0
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _posix_memalign
+	cpx     #$00
+	bne     L0133
+	cmp     #$00
+	beq     L001A
+L0133:	ldx     #$00
+	txa
+	bra     L0134
+L001A:	lda     (sp)
+	and     #$0F
+	beq     L0009
+	lda     #<(L0026)
+	ldx     #>(L0026)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bra     L0009
+L002A:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _malloc
+L0134:	jsr     stax0sp
+L0009:	ldy     #$01
+	lda     (sp),y
+	ora     (sp)
+	beq     L002E
+	jsr     ldax0sp
+	jsr     __heapblocksize
+	ldy     #$02
+	cmp     (sp),y
+	txa
+	iny
+	sbc     (sp),y
+	bcs     L002E
+	lda     #<(L0034)
+	ldx     #>(L0034)
+	jsr     pushax
+	ldy     #$06
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     __heapblocksize
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$08
+	jsr     _printf
+	inc     _failures
+L002E:	jsr     ldax0sp
+	jmp     incsp5
+
+.endproc
+
+; ---------------------------------------------------------------
+; __near__ void * __near__ reget (unsigned char, unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_reget: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L0136
+	inx
+	clc
+L0136:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     pushw
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _realloc
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ put (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_put: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldx     #$00
+	lda     (sp)
+	asl     a
+	bcc     L0138
+	inx
+	clc
+L0138:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     _free
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ rnd (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_rnd: near
+
+.segment	"CODE"
+
+	lda     _seed
+	ldx     _seed+1
+	jsr     shlax4
+	jsr     shlax3
+	eor     _seed
+	pha
+	txa
+	eor     _seed+1
+	tax
+	pla
+	sta     _seed
+	stx     _seed+1
+	sta     ptr1
+	stx     ptr1+1
+	lda     _seed+1
+	lsr     a
+	eor     ptr1
+	pha
+	lda     #$00
+	eor     ptr1+1
+	tax
+	pla
+	sta     _seed
+	stx     _seed+1
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$00
+	eor     ptr1
+	pha
+	lda     _seed
+	eor     ptr1+1
+	tax
+	pla
+	sta     _seed
+	stx     _seed+1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ rndsize (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_rndsize: near
+
+.segment	"CODE"
+
+	jsr     _rnd
+	jsr     pushax
+	jsr     ldax0sp
+	txa
+	and     #$07
+	tax
+	cpx     #$00
+	bne     L004F
+	jsr     pushw0sp
+	lda     #$EC
+	jsr     tosumoda0
+	ldy     #$41
+	jsr     incaxy
+	jmp     incsp2
+L004F:	lda     (sp)
+	ldx     #$00
+	and     #$3F
+	ina
+	bne     L004D
+	inx
+L004D:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ fill (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fill: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldx     #$00
+	lda     (sp)
+	asl     a
+	bcc     L013C
+	inx
+	clc
+L013C:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     ldaxi
+	sta     ptr1
+	stx     ptr1+1
+	lda     (sp)
+	sta     (ptr1)
+	ldx     #$00
+	lda     (sp)
+	asl     a
+	bcc     L013D
+	inx
+	clc
+L013D:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     ldaxi
+	sta     sreg
+	stx     sreg+1
+	ldx     #$00
+	lda     (sp)
+	asl     a
+	bcc     L013E
+	inx
+	clc
+L013E:	adc     #<(_size)
+	tay
+	txa
+	adc     #>(_size)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     decax1
+	clc
+	adc     sreg
+	sta     ptr1
+	txa
+	adc     sreg+1
+	sta     ptr1+1
+	lda     (sp)
+	sta     (ptr1)
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ check (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_check: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldx     #$00
+	lda     (sp)
+	asl     a
+	bcc     L0145
+	inx
+	clc
+L0145:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     ldaxi
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1)
+	cmp     (sp)
+	bne     L0149
+	lda     (sp)
+	asl     a
+	bcc     L0146
+	inx
+	clc
+L0146:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     ldaxi
+	sta     sreg
+	stx     sreg+1
+	ldx     #$00
+	lda     (sp)
+	asl     a
+	bcc     L0147
+	inx
+	clc
+L0147:	adc     #<(_size)
+	tay
+	txa
+	adc     #>(_size)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     decax1
+	clc
+	adc     sreg
+	sta     ptr1
+	txa
+	adc     sreg+1
+	sta     ptr1+1
+	lda     (ptr1)
+	cmp     (sp)
+	jeq     incsp1
+L0149:	lda     #<(L006C)
+	ldx     #>(L006C)
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	asl     a
+	bcc     L0148
+	ldx     #$01
+	clc
+L0148:	adc     #<(_size)
+	tay
+	txa
+	adc     #>(_size)
+	tax
+	tya
+	jsr     pushw
+	ldy     #$06
+	jsr     _printf
+	inc     _failures
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ round (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_round: near
+
+.segment	"CODE"
+
+	ldy     #$09
+	jsr     subysp
+	ldx     #$12
+	lda     #$34
+	sta     _seed
+	stx     _seed+1
+	ldx     #$00
+	txa
+	ldy     #$07
+	jsr     staxysp
+	jmp     L0075
+L0078:	jsr     _rnd
+	ldy     #$03
+	jsr     staxysp
+	and     #$3F
+	ldy     #$02
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L0155
+	inx
+	clc
+L0155:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     ldaxi
+	cpx     #$00
+	jne     L0083
+	cmp     #$00
+	jne     L0083
+	jsr     _rndsize
+	ldy     #$05
+	jsr     staxysp
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L0156
+	inx
+	clc
+L0156:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     _get
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L0157
+	inx
+	clc
+L0157:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     ldaxi
+	cpx     #$00
+	bne     L008E
+	cmp     #$00
+	bne     L008E
+	lda     #<(L0093)
+	ldx     #>(L0093)
+	jsr     pushax
+	ldy     #$0A
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	jmp     L00CC
+L008E:	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L0158
+	inx
+	clc
+L0158:	adc     #<(_size)
+	sta     ptr1
+	txa
+	adc     #>(_size)
+	sta     ptr1+1
+	ldy     #$06
+	jsr     ldaxysp
+	sta     (ptr1)
+	ldy     #$01
+	txa
+	sta     (ptr1),y
+	iny
+	lda     (sp),y
+	jsr     _fill
+	jmp     L00C1
+L0083:	ldy     #$04
+	jsr     ldaxysp
+	txa
+	and     #$0F
+	tax
+	cpx     #$00
+	jne     L009D
+	ldy     #$02
+	lda     (sp),y
+	jsr     _check
+	jsr     _rndsize
+	ldy     #$05
+	jsr     staxysp
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _reget
+	jsr     stax0sp
+	cpx     #$00
+	bne     L00A9
+	cmp     #$00
+	bne     L00A9
+	lda     #<(L00AD)
+	ldx     #>(L00AD)
+	jsr     pushax
+	ldy     #$0A
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	jmp     L00CC
+L00A9:	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L0159
+	inx
+	clc
+L0159:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	jsr     ldax0sp
+	sta     (ptr1)
+	ldy     #$01
+	txa
+	sta     (ptr1),y
+	jsr     ldax0sp
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1)
+	ldy     #$02
+	cmp     (sp),y
+	beq     L015F
+	lda     #<(L00B8)
+	ldx     #>(L00B8)
+	jsr     pushax
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	ldy     #$02
+	ldx     #$00
+L015F:	lda     (sp),y
+	asl     a
+	bcc     L015A
+	inx
+	clc
+L015A:	adc     #<(_size)
+	sta     ptr1
+	txa
+	adc     #>(_size)
+	sta     ptr1+1
+	ldy     #$06
+	jsr     ldaxysp
+	sta     (ptr1)
+	ldy     #$01
+	txa
+	sta     (ptr1),y
+	iny
+	lda     (sp),y
+	jsr     _fill
+	bra     L00C1
+L009D:	ldy     #$02
+	lda     (sp),y
+	jsr     _check
+	ldy     #$02
+	lda     (sp),y
+	jsr     _put
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L015B
+	inx
+	clc
+L015B:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	lda     #$00
+	sta     (ptr1)
+	dey
+	sta     (ptr1),y
+L00C1:	inc     _ops
+	bne     L00CA
+	inc     _ops+1
+L00CA:	ldy     #$07
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0075:	ldy     #$08
+	lda     (sp),y
+	cmp     #$07
+	bne     L007C
+	dey
+	lda     (sp),y
+	cmp     #$D0
+L007C:	jcc     L0078
+	lda     #$00
+	ldy     #$02
+	bra     L0154
+L0161:	lda     (sp),y
+	asl     a
+	bcc     L015C
+	ldx     #$01
+	clc
+L015C:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	lda     (ptr1)
+	ldy     #$01
+	ora     (ptr1),y
+	beq     L00D3
+	iny
+	lda     (sp),y
+	jsr     _check
+	ldy     #$02
+	lda     (sp),y
+	jsr     _put
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L015D
+	inx
+	clc
+L015D:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	lda     #$00
+	sta     (ptr1)
+	dey
+	sta     (ptr1),y
+	inc     _ops
+	bne     L00D3
+	inc     _ops+1
+L00D3:	iny
+	clc
+	ina
+	adc     (sp),y
+L0154:	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$40
+	bcc     L0161
+L00CC:	ldy     #$09
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ fillheap (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fillheap: near
+
+.segment	"CODE"
+
+	jsr     decsp4
+	ldx     #$00
+	txa
+	jsr     stax0sp
+	bra     L00E1
+L00E4:	jsr     ldax0sp
+	jsr     aslax1
+	clc
+	adc     #<(_full)
+	tay
+	txa
+	adc     #>(_full)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _malloc
+	ldy     #$00
+	jsr     staxspidx
+	jsr     ldax0sp
+	jsr     aslax1
+	clc
+	adc     #<(_full)
+	tay
+	txa
+	adc     #>(_full)
+	tax
+	tya
+	jsr     ldaxi
+	cpx     #$00
+	bne     L00F2
+	cmp     #$00
+	bne     L00F2
+	lda     #<(L00F7)
+	ldx     #>(L00F7)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bra     L00FD
+L00F2:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+L00E1:	jsr     ldax0sp
+	cpx     #$01
+	bcs     L00FD
+	jsr     __heapmaxavail
+	ldy     #$02
+	jsr     staxysp
+	cpx     #$00
+	bne     L00E4
+	cmp     #$00
+	bne     L00E4
+	bra     L00FD
+L00FB:	ldx     #$00
+	tya
+	jsr     subeq0sp
+	jsr     aslax1
+	clc
+	adc     #<(_full)
+	tay
+	txa
+	adc     #>(_full)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     _free
+L00FD:	lda     (sp)
+	ldy     #$01
+	ora     (sp),y
+	bne     L00FB
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     push0
+	jsr     decsp1
+	lda     #<(_extra)
+	ldx     #>(_extra)
+	jsr     pushax
+	ldx     #$00
+	lda     #$C8
+	jsr     __heapadd
+	lda     #$00
+	bra     L0166
+L010C:	jsr     _round
+	lda     (sp)
+	beq     L0112
+	jsr     __heapmemavail
+	ldy     #$01
+	cmp     (sp),y
+	bne     L0113
+	txa
+	iny
+	cmp     (sp),y
+	beq     L0112
+L0113:	lda     #<(L0117)
+	ldx     #>(L0117)
+	jsr     pushax
+	jsr     __heapmemavail
+	jsr     pushax
+	ldy     #$08
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _printf
+	inc     _failures
+L0112:	jsr     __heapmemavail
+	ldy     #$01
+	jsr     staxysp
+	jsr     __heapmaxavail
+	cpx     #$01
+	bne     L0120
+	cmp     #$2C
+L0120:	bcc     L011F
+	jsr     __heapmaxavail
+	sec
+	ldy     #$01
+	sbc     (sp),y
+	sta     tmp1
+	txa
+	iny
+	sbc     (sp),y
+	ora     tmp1
+	beq     L011E
+	bcc     L011E
+L011F:	lda     #<(L0123)
+	ldx     #>(L0123)
+	jsr     pushax
+	jsr     __heapmaxavail
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L011E:	clc
+	lda     #$01
+	adc     (sp)
+L0166:	sta     (sp)
+	cmp     #$02
+	bcc     L010C
+	jsr     _fillheap
+	lda     #<(L0129)
+	ldx     #>(L0129)
+	jsr     pushax
+	lda     _ops
+	ldx     _ops+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     _failures
+	beq     L012D
+	ldx     #$00
+	lda     #$01
+	jmp     incsp3
+L012D:	tax
+	jmp     incsp3
+
+.endproc
+
@@ -0,0 +1,749 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_ops:
+	.word	$0000
+
+.segment	"RODATA"
+
+L003B:
+	.byte	$73,$6C,$6F,$74,$20,$25,$75,$3A,$20,$62,$6C,$6F,$63,$6B,$20,$6F
+	.byte	$66,$20,$25,$75,$20,$62,$79,$74,$65,$73,$20,$77,$61,$73,$20,$6F
+	.byte	$76,$65,$72,$77,$72,$69,$74,$74,$65,$6E,$0A,$00
+L0087:
+	.byte	$73,$6C,$6F,$74,$20,$25,$75,$3A,$20,$72,$65,$61,$6C,$6C,$6F,$63
+	.byte	$20,$6C,$6F,$73,$74,$20,$74,$68,$65,$20,$64,$61,$74,$61,$0A,$00
+L007C:
+	.byte	$63,$61,$6E,$6E,$6F,$74,$20,$72,$65,$61,$6C,$6C,$6F,$63,$61,$74
+	.byte	$65,$20,$25,$75,$20,$62,$79,$74,$65,$73,$0A,$00
+L0062:
+	.byte	$63,$61,$6E,$6E,$6F,$74,$20,$61,$6C,$6C,$6F,$63,$61,$74,$65,$20
+	.byte	$25,$75,$20,$62,$79,$74,$65,$73,$0A,$00
+L00B9:
+	.byte	$25,$75,$20,$6F,$70,$65,$72,$61,$74,$69,$6F,$6E,$73,$0A,$00
+
+.segment	"BSS"
+
+_slot:
+	.res	128,$00
+_size:
+	.res	128,$00
+_seed:
+	.res	2,$00
+_mem:
+	.res	19200,$00
+
+; ---------------------------------------------------------------
+; __near__ void * __near__ get (unsigned char, unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_get: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     mulax3
+	jsr     mulax10
+	jsr     mulax10
+	clc
+	adc     #<(_mem)
+	tay
+	txa
+	adc     #>(_mem)
+	tax
+	tya
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; __near__ void * __near__ reget (unsigned char, unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_reget: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     mulax3
+	jsr     mulax10
+	jsr     mulax10
+	clc
+	adc     #<(_mem)
+	tay
+	txa
+	adc     #>(_mem)
+	tax
+	tya
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ put (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_put: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ rnd (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_rnd: near
+
+.segment	"CODE"
+
+	lda     _seed
+	ldx     _seed+1
+	jsr     shlax4
+	jsr     shlax3
+	eor     _seed
+	pha
+	txa
+	eor     _seed+1
+	tax
+	pla
+	sta     _seed
+	stx     _seed+1
+	sta     ptr1
+	stx     ptr1+1
+	lda     _seed+1
+	lsr     a
+	eor     ptr1
+	pha
+	lda     #$00
+	eor     ptr1+1
+	tax
+	pla
+	sta     _seed
+	stx     _seed+1
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$00
+	eor     ptr1
+	pha
+	lda     _seed
+	eor     ptr1+1
+	tax
+	pla
+	sta     _seed
+	stx     _seed+1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ rndsize (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_rndsize: near
+
+.segment	"CODE"
+
+	jsr     _rnd
+	jsr     pushax
+	ldy     #$01
+	lda     (sp),y
+	and     #$07
+	tax
+	cpx     #$00
+	bne     L001B
+	jsr     pushw0sp
+	lda     #$EC
+	jsr     tosumoda0
+	clc
+	adc     #$41
+	bcc     L0019
+	inx
+	jmp     incsp2
+L001B:	lda     (sp)
+	ldx     #$00
+	and     #$3F
+	ina
+	bne     L0019
+	inx
+L0019:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ fill (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fill: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldx     #$00
+	lda     (sp)
+	asl     a
+	bcc     L00C4
+	inx
+	clc
+L00C4:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	sta     ptr1
+	stx     ptr1+1
+	lda     (sp)
+	sta     (ptr1)
+	ldx     #$00
+	lda     (sp)
+	asl     a
+	bcc     L00C5
+	inx
+	clc
+L00C5:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	sta     sreg
+	stx     sreg+1
+	ldx     #$00
+	lda     (sp)
+	asl     a
+	bcc     L00C6
+	inx
+	clc
+L00C6:	adc     #<(_size)
+	sta     ptr1
+	txa
+	adc     #>(_size)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	sec
+	sbc     #$01
+	bcs     L002E
+	dex
+L002E:	clc
+	adc     sreg
+	sta     ptr1
+	txa
+	adc     sreg+1
+	sta     ptr1+1
+	lda     (sp)
+	sta     (ptr1)
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ check (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_check: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldx     #$00
+	lda     (sp)
+	asl     a
+	bcc     L00CD
+	inx
+	clc
+L00CD:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1)
+	cmp     (sp)
+	bne     L00D1
+	lda     (sp)
+	asl     a
+	bcc     L00CE
+	inx
+	clc
+L00CE:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	sta     sreg
+	stx     sreg+1
+	ldx     #$00
+	lda     (sp)
+	asl     a
+	bcc     L00CF
+	inx
+	clc
+L00CF:	adc     #<(_size)
+	sta     ptr1
+	txa
+	adc     #>(_size)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	sec
+	sbc     #$01
+	bcs     L0038
+	dex
+L0038:	clc
+	adc     sreg
+	sta     ptr1
+	txa
+	adc     sreg+1
+	sta     ptr1+1
+	lda     (ptr1)
+	cmp     (sp)
+	jeq     incsp1
+L00D1:	lda     #<(L003B)
+	ldx     #>(L003B)
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	asl     a
+	bcc     L00D0
+	ldx     #$01
+	clc
+L00D0:	adc     #<(_size)
+	sta     ptr1
+	txa
+	adc     #>(_size)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	inc     _failures
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ round (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_round: near
+
+.segment	"CODE"
+
+	ldy     #$09
+	jsr     subysp
+	ldx     #$12
+	lda     #$34
+	sta     _seed
+	stx     _seed+1
+	ldy     #$07
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L00E8
+L0047:	jsr     _rnd
+	ldy     #$03
+	jsr     staxysp
+	and     #$3F
+	ldy     #$02
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L00DD
+	inx
+	clc
+L00DD:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	dey
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	cpx     #$00
+	jne     L0052
+	cmp     #$00
+	jne     L0052
+	jsr     _rndsize
+	ldy     #$05
+	jsr     staxysp
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L00DE
+	inx
+	clc
+L00DE:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _get
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L00DF
+	inx
+	clc
+L00DF:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	dey
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	cpx     #$00
+	bne     L005D
+	cmp     #$00
+	bne     L005D
+	lda     #<(L0062)
+	ldx     #>(L0062)
+	jsr     pushax
+	ldy     #$0A
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	jmp     L009B
+L005D:	iny
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L00E0
+	inx
+	clc
+L00E0:	adc     #<(_size)
+	sta     ptr1
+	txa
+	adc     #>(_size)
+	sta     ptr1+1
+	ldy     #$06
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     (ptr1)
+	ldy     #$01
+	txa
+	sta     (ptr1),y
+	iny
+	lda     (sp),y
+	jsr     _fill
+	jmp     L0090
+L0052:	ldy     #$04
+	lda     (sp),y
+	and     #$0F
+	tax
+	cpx     #$00
+	jne     L006C
+	ldy     #$02
+	lda     (sp),y
+	jsr     _check
+	jsr     _rndsize
+	ldy     #$05
+	jsr     staxysp
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _reget
+	jsr     stax0sp
+	cpx     #$00
+	bne     L0078
+	cmp     #$00
+	bne     L0078
+	lda     #<(L007C)
+	ldx     #>(L007C)
+	jsr     pushax
+	ldy     #$0A
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	jmp     L009B
+L0078:	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L00E1
+	inx
+	clc
+L00E1:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	tax
+	lda     (sp)
+	sta     (ptr1)
+	ldy     #$01
+	txa
+	sta     (ptr1),y
+	lda     (sp),y
+	sta     ptr1+1
+	lda     (sp)
+	sta     ptr1
+	ldx     #$00
+	lda     (ptr1)
+	iny
+	cmp     (sp),y
+	beq     L00E7
+	lda     #<(L0087)
+	ldx     #>(L0087)
+	jsr     pushax
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	ldy     #$02
+	ldx     #$00
+L00E7:	lda     (sp),y
+	asl     a
+	bcc     L00E2
+	inx
+	clc
+L00E2:	adc     #<(_size)
+	sta     ptr1
+	txa
+	adc     #>(_size)
+	sta     ptr1+1
+	ldy     #$06
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     (ptr1)
+	ldy     #$01
+	txa
+	sta     (ptr1),y
+	iny
+	lda     (sp),y
+	jsr     _fill
+	bra     L0090
+L006C:	ldy     #$02
+	lda     (sp),y
+	jsr     _check
+	ldy     #$02
+	lda     (sp),y
+	jsr     _put
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L00E3
+	inx
+	clc
+L00E3:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	lda     #$00
+	sta     (ptr1)
+	dey
+	sta     (ptr1),y
+L0090:	inc     _ops
+	bne     L0099
+	inc     _ops+1
+L0099:	ldy     #$07
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$08
+L00E8:	lda     (sp),y
+	cmp     #$07
+	bne     L004B
+	dey
+	lda     (sp),y
+	cmp     #$D0
+L004B:	jcc     L0047
+	lda     #$00
+	ldy     #$02
+	bra     L00DC
+L00EA:	lda     (sp),y
+	asl     a
+	bcc     L00E4
+	ldx     #$01
+	clc
+L00E4:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	lda     (ptr1)
+	ldy     #$01
+	ora     (ptr1),y
+	beq     L00A2
+	iny
+	lda     (sp),y
+	jsr     _check
+	ldy     #$02
+	lda     (sp),y
+	jsr     _put
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L00E5
+	inx
+	clc
+L00E5:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	lda     #$00
+	sta     (ptr1)
+	dey
+	sta     (ptr1),y
+	inc     _ops
+	bne     L00A2
+	inc     _ops+1
+L00A2:	iny
+	clc
+	ina
+	adc     (sp),y
+L00DC:	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$40
+	bcc     L00EA
+L009B:	ldy     #$09
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     #$00
+	bra     L00EC
+L00B2:	jsr     _round
+	clc
+	lda     #$01
+	adc     (sp)
+L00EC:	sta     (sp)
+	cmp     #$02
+	bcc     L00B2
+	lda     #<(L00B9)
+	ldx     #>(L00B9)
+	jsr     pushax
+	lda     _ops
+	ldx     _ops+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     _failures
+	beq     L00BD
+	ldx     #$00
+	lda     #$01
+	jmp     incsp1
+L00BD:	tax
+	jmp     incsp1
+
+.endproc
+
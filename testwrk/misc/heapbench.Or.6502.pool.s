@@ -0,0 +1,986 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_malloc
+	.import		_calloc
+	.import		_realloc
+	.import		_free
+	.import		_posix_memalign
+	.import		__heapadd
+	.import		__heapblocksize
+	.import		__heapmemavail
+	.import		__heapmaxavail
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_ops:
+	.word	$0000
+
+.segment	"RODATA"
+
+L006B:
+	.byte	$73,$6C,$6F,$74,$20,$25,$75,$3A,$20,$62,$6C,$6F,$63,$6B,$20,$6F
+	.byte	$66,$20,$25,$75,$20,$62,$79,$74,$65,$73,$20,$77,$61,$73,$20,$6F
+	.byte	$76,$65,$72,$77,$72,$69,$74,$74,$65,$6E,$0A,$00
+L00F6:
+	.byte	$68,$65,$61,$70,$20,$66,$75,$6C,$6C,$3A,$20,$63,$61,$6E,$6E,$6F
+	.byte	$74,$20,$61,$6C,$6C,$6F,$63,$61,$74,$65,$20,$25,$75,$20,$62,$79
+	.byte	$74,$65,$73,$0A,$00
+L0026:
+	.byte	$70,$6F,$73,$69,$78,$5F,$6D,$65,$6D,$61,$6C,$69,$67,$6E,$3A,$20
+	.byte	$25,$70,$20,$6E,$6F,$74,$20,$61,$6C,$69,$67,$6E,$65,$64,$0A,$00
+L0116:
+	.byte	$5F,$68,$65,$61,$70,$6D,$65,$6D,$61,$76,$61,$69,$6C,$3A,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$25,$75,$0A,$00
+L00B7:
+	.byte	$73,$6C,$6F,$74,$20,$25,$75,$3A,$20,$72,$65,$61,$6C,$6C,$6F,$63
+	.byte	$20,$6C,$6F,$73,$74,$20,$74,$68,$65,$20,$64,$61,$74,$61,$0A,$00
+L0015:
+	.byte	$63,$61,$6C,$6C,$6F,$63,$20,$64,$69,$64,$6E,$27,$74,$20,$63,$6C
+	.byte	$65,$61,$72,$20,$74,$68,$65,$20,$62,$6C,$6F,$63,$6B,$0A,$00
+L0034:
+	.byte	$73,$6C,$6F,$74,$20,$25,$75,$3A,$20,$62,$6C,$6F,$63,$6B,$20,$73
+	.byte	$69,$7A,$65,$20,$25,$75,$20,$3C,$20,$25,$75,$0A,$00
+L00AC:
+	.byte	$63,$61,$6E,$6E,$6F,$74,$20,$72,$65,$61,$6C,$6C,$6F,$63,$61,$74
+	.byte	$65,$20,$25,$75,$20,$62,$79,$74,$65,$73,$0A,$00
+L0092	:=	L00F6+11
+L0122:
+	.byte	$5F,$68,$65,$61,$70,$6D,$61,$78,$61,$76,$61,$69,$6C,$3A,$20,$25
+	.byte	$75,$0A,$00
+L0128:
+	.byte	$25,$75,$20,$6F,$70,$65,$72,$61,$74,$69,$6F,$6E,$73,$0A,$00
+
+.segment	"BSS"
+
+_slot:
+	.res	128,$00
+_size:
+	.res	128,$00
+_seed:
+	.res	2,$00
+_extra:
+	.res	200,$00
+_full:
+	.res	512,$00
+
+; ---------------------------------------------------------------
+; __near__ void * __near__ get (unsigned char, unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_get: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+	lda     _ops
+	and     #$1F
+	beq     L000B
+	cmp     #$01
+	beq     L0019
+	jmp     L002A
+L000B:	ldy     #$05
+	jsr     pushwysp
+	ldx     #$00
+	lda     #$01
+	jsr     _calloc
+	jsr     stax0sp
+	ldy     #$01
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L0009
+	jsr     ldax0sp
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	beq     L0009
+	lda     #<(L0015)
+	ldx     #>(L0015)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	jmp     L0009
+L0019:	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	lda     #$10
+	jsr     pusha0
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _posix_memalign
+	cpx     #$00
+	bne     L0132
+	cmp     #$00
+	beq     L001A
+L0132:	ldx     #$00
+	txa
+	jmp     L0133
+L001A:	lda     (sp,x)
+	and     #$0F
+	beq     L0009
+	lda     #<(L0026)
+	ldx     #>(L0026)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	jmp     L0009
+L002A:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _malloc
+L0133:	jsr     stax0sp
+L0009:	ldy     #$01
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L002E
+	jsr     ldax0sp
+	jsr     __heapblocksize
+	ldy     #$02
+	cmp     (sp),y
+	txa
+	iny
+	sbc     (sp),y
+	bcs     L002E
+	lda     #<(L0034)
+	ldx     #>(L0034)
+	jsr     pushax
+	ldy     #$06
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     __heapblocksize
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$08
+	jsr     _printf
+	inc     _failures
+L002E:	jsr     ldax0sp
+	jmp     incsp5
+
+.endproc
+
+; ---------------------------------------------------------------
+; __near__ void * __near__ reget (unsigned char, unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_reget: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L0135
+	inx
+	clc
+L0135:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     pushw
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _realloc
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ put (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_put: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldx     #$00
+	lda     (sp,x)
+	asl     a
+	bcc     L0137
+	inx
+	clc
+L0137:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     _free
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ rnd (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_rnd: near
+
+.segment	"CODE"
+
+	lda     _seed
+	ldx     _seed+1
+	jsr     shlax4
+	jsr     shlax3
+	eor     _seed
+	pha
+	txa
+	eor     _seed+1
+	tax
+	pla
+	sta     _seed
+	stx     _seed+1
+	sta     ptr1
+	stx     ptr1+1
+	lda     _seed+1
+	lsr     a
+	eor     ptr1
+	pha
+	lda     #$00
+	eor     ptr1+1
+	tax
+	pla
+	sta     _seed
+	stx     _seed+1
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$00
+	eor     ptr1
+	pha
+	lda     _seed
+	eor     ptr1+1
+	tax
+	pla
+	sta     _seed
+	stx     _seed+1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ rndsize (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_rndsize: near
+
+.segment	"CODE"
+
+	jsr     _rnd
+	jsr     pushax
+	jsr     ldax0sp
+	txa
+	and     #$07
+	tax
+	cpx     #$00
+	bne     L004F
+	jsr     pushw0sp
+	lda     #$EC
+	jsr     tosumoda0
+	ldy     #$41
+	jsr     incaxy
+	jmp     incsp2
+L004F:	ldy     #$00
+	lda     (sp),y
+	ldx     #$00
+	and     #$3F
+	jsr     incax1
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ fill (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fill: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldx     #$00
+	lda     (sp,x)
+	asl     a
+	bcc     L013B
+	inx
+	clc
+L013B:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     ldaxi
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	lda     (sp),y
+	sta     (ptr1),y
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L013C
+	inx
+	clc
+L013C:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     ldaxi
+	sta     sreg
+	stx     sreg+1
+	ldx     #$00
+	lda     (sp,x)
+	asl     a
+	bcc     L013D
+	inx
+	clc
+L013D:	adc     #<(_size)
+	tay
+	txa
+	adc     #>(_size)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     decax1
+	clc
+	adc     sreg
+	sta     ptr1
+	txa
+	adc     sreg+1
+	sta     ptr1+1
+	ldy     #$00
+	lda     (sp),y
+	sta     (ptr1),y
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ check (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_check: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldx     #$00
+	lda     (sp,x)
+	asl     a
+	bcc     L0144
+	inx
+	clc
+L0144:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     ldaxi
+	sta     ptr1
+	stx     ptr1+1
+	ldy     #$00
+	ldx     #$00
+	lda     (ptr1),y
+	cmp     (sp),y
+	bne     L0148
+	lda     (sp),y
+	asl     a
+	bcc     L0145
+	inx
+	clc
+L0145:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     ldaxi
+	sta     sreg
+	stx     sreg+1
+	ldx     #$00
+	lda     (sp,x)
+	asl     a
+	bcc     L0146
+	inx
+	clc
+L0146:	adc     #<(_size)
+	tay
+	txa
+	adc     #>(_size)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     decax1
+	clc
+	adc     sreg
+	sta     ptr1
+	txa
+	adc     sreg+1
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	cmp     (sp),y
+	jeq     incsp1
+L0148:	lda     #<(L006B)
+	ldx     #>(L006B)
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	asl     a
+	bcc     L0147
+	ldx     #$01
+	clc
+L0147:	adc     #<(_size)
+	tay
+	txa
+	adc     #>(_size)
+	tax
+	tya
+	jsr     pushw
+	ldy     #$06
+	jsr     _printf
+	inc     _failures
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ round (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_round: near
+
+.segment	"CODE"
+
+	ldy     #$09
+	jsr     subysp
+	ldx     #$12
+	lda     #$34
+	sta     _seed
+	stx     _seed+1
+	ldx     #$00
+	txa
+	ldy     #$07
+	jsr     staxysp
+	jmp     L0074
+L0077:	jsr     _rnd
+	ldy     #$03
+	jsr     staxysp
+	and     #$3F
+	ldy     #$02
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L0154
+	inx
+	clc
+L0154:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     ldaxi
+	cpx     #$00
+	jne     L0082
+	cmp     #$00
+	jne     L0082
+	jsr     _rndsize
+	ldy     #$05
+	jsr     staxysp
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L0155
+	inx
+	clc
+L0155:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     _get
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L0156
+	inx
+	clc
+L0156:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     ldaxi
+	cpx     #$00
+	bne     L008D
+	cmp     #$00
+	bne     L008D
+	lda     #<(L0092)
+	ldx     #>(L0092)
+	jsr     pushax
+	ldy     #$0A
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	jmp     L00CB
+L008D:	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L0157
+	inx
+	clc
+L0157:	adc     #<(_size)
+	sta     ptr1
+	txa
+	adc     #>(_size)
+	sta     ptr1+1
+	ldy     #$06
+	jsr     ldaxysp
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	iny
+	lda     (sp),y
+	jsr     _fill
+	jmp     L00C0
+L0082:	ldy     #$04
+	jsr     ldaxysp
+	txa
+	and     #$0F
+	tax
+	cpx     #$00
+	jne     L009C
+	ldy     #$02
+	lda     (sp),y
+	jsr     _check
+	jsr     _rndsize
+	ldy     #$05
+	jsr     staxysp
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _reget
+	jsr     stax0sp
+	cpx     #$00
+	bne     L00A8
+	cmp     #$00
+	bne     L00A8
+	lda     #<(L00AC)
+	ldx     #>(L00AC)
+	jsr     pushax
+	ldy     #$0A
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	jmp     L00CB
+L00A8:	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L0158
+	inx
+	clc
+L0158:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	jsr     ldax0sp
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	jsr     ldax0sp
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1,x)
+	ldy     #$02
+	cmp     (sp),y
+	beq     L015E
+	lda     #<(L00B7)
+	ldx     #>(L00B7)
+	jsr     pushax
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	ldy     #$02
+	ldx     #$00
+L015E:	lda     (sp),y
+	asl     a
+	bcc     L0159
+	inx
+	clc
+L0159:	adc     #<(_size)
+	sta     ptr1
+	txa
+	adc     #>(_size)
+	sta     ptr1+1
+	ldy     #$06
+	jsr     ldaxysp
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	iny
+	lda     (sp),y
+	jsr     _fill
+	jmp     L00C0
+L009C:	ldy     #$02
+	lda     (sp),y
+	jsr     _check
+	ldy     #$02
+	lda     (sp),y
+	jsr     _put
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L015A
+	inx
+	clc
+L015A:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	iny
+	sta     (ptr1),y
+L00C0:	inc     _ops
+	bne     L00C9
+	inc     _ops+1
+L00C9:	ldy     #$07
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0074:	ldy     #$08
+	lda     (sp),y
+	cmp     #$07
+	bne     L007B
+	dey
+	lda     (sp),y
+	cmp     #$D0
+L007B:	jcc     L0077
+	lda     #$00
+	ldy     #$02
+	jmp     L0153
+L0160:	lda     (sp),y
+	asl     a
+	bcc     L015B
+	ldx     #$01
+	clc
+L015B:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	beq     L00D2
+	iny
+	lda     (sp),y
+	jsr     _check
+	ldy     #$02
+	lda     (sp),y
+	jsr     _put
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L015C
+	inx
+	clc
+L015C:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	iny
+	sta     (ptr1),y
+	inc     _ops
+	bne     L00D2
+	inc     _ops+1
+L00D2:	iny
+	clc
+	lda     #$01
+	adc     (sp),y
+L0153:	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$40
+	bcc     L0160
+L00CB:	ldy     #$09
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ fillheap (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fillheap: near
+
+.segment	"CODE"
+
+	jsr     decsp4
+	ldx     #$00
+	txa
+	jsr     stax0sp
+	jmp     L00E0
+L00E3:	jsr     ldax0sp
+	jsr     aslax1
+	clc
+	adc     #<(_full)
+	tay
+	txa
+	adc     #>(_full)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _malloc
+	ldy     #$00
+	jsr     staxspidx
+	jsr     ldax0sp
+	jsr     aslax1
+	clc
+	adc     #<(_full)
+	tay
+	txa
+	adc     #>(_full)
+	tax
+	tya
+	jsr     ldaxi
+	cpx     #$00
+	bne     L00F1
+	cmp     #$00
+	bne     L00F1
+	lda     #<(L00F6)
+	ldx     #>(L00F6)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	jmp     L00FC
+L00F1:	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+L00E0:	jsr     ldax0sp
+	cpx     #$01
+	bcs     L00FC
+	jsr     __heapmaxavail
+	ldy     #$02
+	jsr     staxysp
+	cpx     #$00
+	bne     L00E3
+	cmp     #$00
+	bne     L00E3
+	jmp     L00FC
+L00FA:	ldx     #$00
+	tya
+	jsr     subeq0sp
+	jsr     aslax1
+	clc
+	adc     #<(_full)
+	tay
+	txa
+	adc     #>(_full)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     _free
+L00FC:	ldy     #$00
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L00FA
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     push0
+	jsr     decsp1
+	lda     #<(_extra)
+	ldx     #>(_extra)
+	jsr     pushax
+	ldx     #$00
+	lda     #$C8
+	jsr     __heapadd
+	lda     #$00
+	tay
+	jmp     L0165
+L010B:	jsr     _round
+	ldy     #$00
+	lda     (sp),y
+	beq     L0111
+	jsr     __heapmemavail
+	ldy     #$01
+	cmp     (sp),y
+	bne     L0112
+	txa
+	iny
+	cmp     (sp),y
+	beq     L0111
+L0112:	lda     #<(L0116)
+	ldx     #>(L0116)
+	jsr     pushax
+	jsr     __heapmemavail
+	jsr     pushax
+	ldy     #$08
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _printf
+	inc     _failures
+L0111:	jsr     __heapmemavail
+	ldy     #$01
+	jsr     staxysp
+	jsr     __heapmaxavail
+	cpx     #$01
+	bne     L011F
+	cmp     #$2C
+L011F:	bcc     L011E
+	jsr     __heapmaxavail
+	sec
+	ldy     #$01
+	sbc     (sp),y
+	sta     tmp1
+	txa
+	iny
+	sbc     (sp),y
+	ora     tmp1
+	beq     L011D
+	bcc     L011D
+L011E:	lda     #<(L0122)
+	ldx     #>(L0122)
+	jsr     pushax
+	jsr     __heapmaxavail
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L011D:	ldy     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+L0165:	sta     (sp),y
+	cmp     #$02
+	bcc     L010B
+	jsr     _fillheap
+	lda     #<(L0128)
+	ldx     #>(L0128)
+	jsr     pushax
+	lda     _ops
+	ldx     _ops+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     _failures
+	beq     L012C
+	ldx     #$00
+	lda     #$01
+	jmp     incsp3
+L012C:	tax
+	jmp     incsp3
+
+.endproc
+
@@ -0,0 +1,706 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_ops:
+	.word	$0000
+
+.segment	"RODATA"
+
+L0038:
+	.byte	$73,$6C,$6F,$74,$20,$25,$75,$3A,$20,$62,$6C,$6F,$63,$6B,$20,$6F
+	.byte	$66,$20,$25,$75,$20,$62,$79,$74,$65,$73,$20,$77,$61,$73,$20,$6F
+	.byte	$76,$65,$72,$77,$72,$69,$74,$74,$65,$6E,$0A,$00
+L0084:
+	.byte	$73,$6C,$6F,$74,$20,$25,$75,$3A,$20,$72,$65,$61,$6C,$6C,$6F,$63
+	.byte	$20,$6C,$6F,$73,$74,$20,$74,$68,$65,$20,$64,$61,$74,$61,$0A,$00
+L0079:
+	.byte	$63,$61,$6E,$6E,$6F,$74,$20,$72,$65,$61,$6C,$6C,$6F,$63,$61,$74
+	.byte	$65,$20,$25,$75,$20,$62,$79,$74,$65,$73,$0A,$00
+L005F:
+	.byte	$63,$61,$6E,$6E,$6F,$74,$20,$61,$6C,$6C,$6F,$63,$61,$74,$65,$20
+	.byte	$25,$75,$20,$62,$79,$74,$65,$73,$0A,$00
+L00B6:
+	.byte	$25,$75,$20,$6F,$70,$65,$72,$61,$74,$69,$6F,$6E,$73,$0A,$00
+
+.segment	"BSS"
+
+_slot:
+	.res	128,$00
+_size:
+	.res	128,$00
+_seed:
+	.res	2,$00
+_mem:
+	.res	19200,$00
+
+; ---------------------------------------------------------------
+; __near__ void * __near__ get (unsigned char, unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_get: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     mulax3
+	jsr     mulax10
+	jsr     mulax10
+	clc
+	adc     #<(_mem)
+	tay
+	txa
+	adc     #>(_mem)
+	tax
+	tya
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; __near__ void * __near__ reget (unsigned char, unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_reget: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     mulax3
+	jsr     mulax10
+	jsr     mulax10
+	clc
+	adc     #<(_mem)
+	tay
+	txa
+	adc     #>(_mem)
+	tax
+	tya
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ put (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_put: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ rnd (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_rnd: near
+
+.segment	"CODE"
+
+	lda     _seed
+	ldx     _seed+1
+	jsr     shlax4
+	jsr     shlax3
+	eor     _seed
+	pha
+	txa
+	eor     _seed+1
+	tax
+	pla
+	sta     _seed
+	stx     _seed+1
+	sta     ptr1
+	stx     ptr1+1
+	lda     _seed+1
+	lsr     a
+	eor     ptr1
+	pha
+	lda     #$00
+	eor     ptr1+1
+	tax
+	pla
+	sta     _seed
+	stx     _seed+1
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$00
+	eor     ptr1
+	pha
+	lda     _seed
+	eor     ptr1+1
+	tax
+	pla
+	sta     _seed
+	stx     _seed+1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ rndsize (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_rndsize: near
+
+.segment	"CODE"
+
+	jsr     _rnd
+	jsr     pushax
+	jsr     ldax0sp
+	txa
+	and     #$07
+	tax
+	cpx     #$00
+	bne     L001B
+	jsr     pushw0sp
+	lda     #$EC
+	jsr     tosumoda0
+	ldy     #$41
+	jsr     incaxy
+	jmp     incsp2
+L001B:	lda     (sp)
+	ldx     #$00
+	and     #$3F
+	ina
+	bne     L0019
+	inx
+L0019:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ fill (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fill: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldx     #$00
+	lda     (sp)
+	asl     a
+	bcc     L00C1
+	inx
+	clc
+L00C1:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     ldaxi
+	sta     ptr1
+	stx     ptr1+1
+	lda     (sp)
+	sta     (ptr1)
+	ldx     #$00
+	lda     (sp)
+	asl     a
+	bcc     L00C2
+	inx
+	clc
+L00C2:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     ldaxi
+	sta     sreg
+	stx     sreg+1
+	ldx     #$00
+	lda     (sp)
+	asl     a
+	bcc     L00C3
+	inx
+	clc
+L00C3:	adc     #<(_size)
+	tay
+	txa
+	adc     #>(_size)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     decax1
+	clc
+	adc     sreg
+	sta     ptr1
+	txa
+	adc     sreg+1
+	sta     ptr1+1
+	lda     (sp)
+	sta     (ptr1)
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ check (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_check: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldx     #$00
+	lda     (sp)
+	asl     a
+	bcc     L00CA
+	inx
+	clc
+L00CA:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     ldaxi
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1)
+	cmp     (sp)
+	bne     L00CE
+	lda     (sp)
+	asl     a
+	bcc     L00CB
+	inx
+	clc
+L00CB:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     ldaxi
+	sta     sreg
+	stx     sreg+1
+	ldx     #$00
+	lda     (sp)
+	asl     a
+	bcc     L00CC
+	inx
+	clc
+L00CC:	adc     #<(_size)
+	tay
+	txa
+	adc     #>(_size)
+	tax
+	tya
+	jsr     ldaxi
+	jsr     decax1
+	clc
+	adc     sreg
+	sta     ptr1
+	txa
+	adc     sreg+1
+	sta     ptr1+1
+	lda     (ptr1)
+	cmp     (sp)
+	jeq     incsp1
+L00CE:	lda     #<(L0038)
+	ldx     #>(L0038)
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	asl     a
+	bcc     L00CD
+	ldx     #$01
+	clc
+L00CD:	adc     #<(_size)
+	tay
+	txa
+	adc     #>(_size)
+	tax
+	tya
+	jsr     pushw
+	ldy     #$06
+	jsr     _printf
+	inc     _failures
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ round (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_round: near
+
+.segment	"CODE"
+
+	ldy     #$09
+	jsr     subysp
+	ldx     #$12
+	lda     #$34
+	sta     _seed
+	stx     _seed+1
+	ldx     #$00
+	txa
+	ldy     #$07
+	jsr     staxysp
+	jmp     L0041
+L0044:	jsr     _rnd
+	ldy     #$03
+	jsr     staxysp
+	and     #$3F
+	ldy     #$02
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L00DA
+	inx
+	clc
+L00DA:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     ldaxi
+	cpx     #$00
+	jne     L004F
+	cmp     #$00
+	jne     L004F
+	jsr     _rndsize
+	ldy     #$05
+	jsr     staxysp
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L00DB
+	inx
+	clc
+L00DB:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     _get
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L00DC
+	inx
+	clc
+L00DC:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     ldaxi
+	cpx     #$00
+	bne     L005A
+	cmp     #$00
+	bne     L005A
+	lda     #<(L005F)
+	ldx     #>(L005F)
+	jsr     pushax
+	ldy     #$0A
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	jmp     L0098
+L005A:	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L00DD
+	inx
+	clc
+L00DD:	adc     #<(_size)
+	sta     ptr1
+	txa
+	adc     #>(_size)
+	sta     ptr1+1
+	ldy     #$06
+	jsr     ldaxysp
+	sta     (ptr1)
+	ldy     #$01
+	txa
+	sta     (ptr1),y
+	iny
+	lda     (sp),y
+	jsr     _fill
+	jmp     L008D
+L004F:	ldy     #$04
+	jsr     ldaxysp
+	txa
+	and     #$0F
+	tax
+	cpx     #$00
+	jne     L0069
+	ldy     #$02
+	lda     (sp),y
+	jsr     _check
+	jsr     _rndsize
+	ldy     #$05
+	jsr     staxysp
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _reget
+	jsr     stax0sp
+	cpx     #$00
+	bne     L0075
+	cmp     #$00
+	bne     L0075
+	lda     #<(L0079)
+	ldx     #>(L0079)
+	jsr     pushax
+	ldy     #$0A
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	jmp     L0098
+L0075:	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L00DE
+	inx
+	clc
+L00DE:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	jsr     ldax0sp
+	sta     (ptr1)
+	ldy     #$01
+	txa
+	sta     (ptr1),y
+	jsr     ldax0sp
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1)
+	ldy     #$02
+	cmp     (sp),y
+	beq     L00E4
+	lda     #<(L0084)
+	ldx     #>(L0084)
+	jsr     pushax
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	ldy     #$02
+	ldx     #$00
+L00E4:	lda     (sp),y
+	asl     a
+	bcc     L00DF
+	inx
+	clc
+L00DF:	adc     #<(_size)
+	sta     ptr1
+	txa
+	adc     #>(_size)
+	sta     ptr1+1
+	ldy     #$06
+	jsr     ldaxysp
+	sta     (ptr1)
+	ldy     #$01
+	txa
+	sta     (ptr1),y
+	iny
+	lda     (sp),y
+	jsr     _fill
+	bra     L008D
+L0069:	ldy     #$02
+	lda     (sp),y
+	jsr     _check
+	ldy     #$02
+	lda     (sp),y
+	jsr     _put
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L00E0
+	inx
+	clc
+L00E0:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	lda     #$00
+	sta     (ptr1)
+	dey
+	sta     (ptr1),y
+L008D:	inc     _ops
+	bne     L0096
+	inc     _ops+1
+L0096:	ldy     #$07
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0041:	ldy     #$08
+	lda     (sp),y
+	cmp     #$07
+	bne     L0048
+	dey
+	lda     (sp),y
+	cmp     #$D0
+L0048:	jcc     L0044
+	lda     #$00
+	ldy     #$02
+	bra     L00D9
+L00E6:	lda     (sp),y
+	asl     a
+	bcc     L00E1
+	ldx     #$01
+	clc
+L00E1:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	lda     (ptr1)
+	ldy     #$01
+	ora     (ptr1),y
+	beq     L009F
+	iny
+	lda     (sp),y
+	jsr     _check
+	ldy     #$02
+	lda     (sp),y
+	jsr     _put
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L00E2
+	inx
+	clc
+L00E2:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	lda     #$00
+	sta     (ptr1)
+	dey
+	sta     (ptr1),y
+	inc     _ops
+	bne     L009F
+	inc     _ops+1
+L009F:	iny
+	clc
+	ina
+	adc     (sp),y
+L00D9:	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$40
+	bcc     L00E6
+L0098:	ldy     #$09
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp1
+	lda     #$00
+	bra     L00E8
+L00AF:	jsr     _round
+	clc
+	lda     #$01
+	adc     (sp)
+L00E8:	sta     (sp)
+	cmp     #$02
+	bcc     L00AF
+	lda     #<(L00B6)
+	ldx     #>(L00B6)
+	jsr     pushax
+	lda     _ops
+	ldx     _ops+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     _failures
+	beq     L00BA
+	ldx     #$00
+	lda     #$01
+	jmp     incsp1
+L00BA:	tax
+	jmp     incsp1
+
+.endproc
+
@@ -0,0 +1,1110 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_malloc
+	.import		_calloc
+	.import		_realloc
+	.import		_free
+	.import		_posix_memalign
+	.import		__heapadd
+	.import		__heapblocksize
+	.import		__heapmemavail
+	.import		__heapmaxavail
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_ops:
+	.word	$0000
+
+.segment	"RODATA"
+
+L0070:
+	.byte	$73,$6C,$6F,$74,$20,$25,$75,$3A,$20,$62,$6C,$6F,$63,$6B,$20,$6F
+	.byte	$66,$20,$25,$75,$20,$62,$79,$74,$65,$73,$20,$77,$61,$73,$20,$6F
+	.byte	$76,$65,$72,$77,$72,$69,$74,$74,$65,$6E,$0A,$00
+L00FB:
+	.byte	$68,$65,$61,$70,$20,$66,$75,$6C,$6C,$3A,$20,$63,$61,$6E,$6E,$6F
+	.byte	$74,$20,$61,$6C,$6C,$6F,$63,$61,$74,$65,$20,$25,$75,$20,$62,$79
+	.byte	$74,$65,$73,$0A,$00
+L0027:
+	.byte	$70,$6F,$73,$69,$78,$5F,$6D,$65,$6D,$61,$6C,$69,$67,$6E,$3A,$20
+	.byte	$25,$70,$20,$6E,$6F,$74,$20,$61,$6C,$69,$67,$6E,$65,$64,$0A,$00
+L011B:
+	.byte	$5F,$68,$65,$61,$70,$6D,$65,$6D,$61,$76,$61,$69,$6C,$3A,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$25,$75,$0A,$00
+L00BC:
+	.byte	$73,$6C,$6F,$74,$20,$25,$75,$3A,$20,$72,$65,$61,$6C,$6C,$6F,$63
+	.byte	$20,$6C,$6F,$73,$74,$20,$74,$68,$65,$20,$64,$61,$74,$61,$0A,$00
+L0015:
+	.byte	$63,$61,$6C,$6C,$6F,$63,$20,$64,$69,$64,$6E,$27,$74,$20,$63,$6C
+	.byte	$65,$61,$72,$20,$74,$68,$65,$20,$62,$6C,$6F,$63,$6B,$0A,$00
+L0035:
+	.byte	$73,$6C,$6F,$74,$20,$25,$75,$3A,$20,$62,$6C,$6F,$63,$6B,$20,$73
+	.byte	$69,$7A,$65,$20,$25,$75,$20,$3C,$20,$25,$75,$0A,$00
+L00B1:
+	.byte	$63,$61,$6E,$6E,$6F,$74,$20,$72,$65,$61,$6C,$6C,$6F,$63,$61,$74
+	.byte	$65,$20,$25,$75,$20,$62,$79,$74,$65,$73,$0A,$00
+L0097	:=	L00FB+11
+L0127:
+	.byte	$5F,$68,$65,$61,$70,$6D,$61,$78,$61,$76,$61,$69,$6C,$3A,$20,$25
+	.byte	$75,$0A,$00
+L012D:
+	.byte	$25,$75,$20,$6F,$70,$65,$72,$61,$74,$69,$6F,$6E,$73,$0A,$00
+
+.segment	"BSS"
+
+_slot:
+	.res	128,$00
+_size:
+	.res	128,$00
+_seed:
+	.res	2,$00
+_extra:
+	.res	200,$00
+_full:
+	.res	512,$00
+
+; ---------------------------------------------------------------
+; __near__ void * __near__ get (unsigned char, unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_get: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+	lda     _ops
+	and     #$1F
+	beq     L000B
+	cmp     #$01
+	beq     L0019
+	jmp     L002B
+L000B:	ldy     #$05
+	jsr     pushwysp
+	ldx     #$00
+	lda     #$01
+	jsr     _calloc
+	jsr     stax0sp
+	ldy     #$01
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0009
+	iny
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	lda     (ptr1),y
+	beq     L0009
+	lda     #<(L0015)
+	ldx     #>(L0015)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+	jmp     L0009
+L0019:	jsr     decsp4
+	lda     sp
+	ldx     sp+1
+	clc
+	adc     #$04
+	bcc     L001D
+	inx
+L001D:	ldy     #$02
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	lda     #$10
+	ldy     #$00
+	sta     (sp),y
+	iny
+	lda     #$00
+	sta     (sp),y
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _posix_memalign
+	cpx     #$00
+	bne     L0137
+	cmp     #$00
+	beq     L001A
+L0137:	ldy     #$00
+	tya
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L0136
+L001A:	lda     (sp,x)
+	and     #$0F
+	beq     L0009
+	lda     #<(L0027)
+	ldx     #>(L0027)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	jmp     L0009
+L002B:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _malloc
+	jsr     stax0sp
+L0009:	ldy     #$01
+L0136:	lda     (sp),y
+	dey
+	ora     (sp),y
+	beq     L002F
+	iny
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     __heapblocksize
+	ldy     #$02
+	cmp     (sp),y
+	txa
+	iny
+	sbc     (sp),y
+	bcs     L002F
+	lda     #<(L0035)
+	ldx     #>(L0035)
+	jsr     pushax
+	ldy     #$06
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     __heapblocksize
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$08
+	jsr     _printf
+	inc     _failures
+L002F:	ldy     #$01
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jmp     incsp5
+
+.endproc
+
+; ---------------------------------------------------------------
+; __near__ void * __near__ reget (unsigned char, unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_reget: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L0139
+	inx
+	clc
+L0139:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	dey
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _realloc
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ put (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_put: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldx     #$00
+	lda     (sp,x)
+	asl     a
+	bcc     L013B
+	inx
+	clc
+L013B:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     _free
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ rnd (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_rnd: near
+
+.segment	"CODE"
+
+	lda     _seed
+	ldx     _seed+1
+	jsr     shlax4
+	jsr     shlax3
+	eor     _seed
+	pha
+	txa
+	eor     _seed+1
+	tax
+	pla
+	sta     _seed
+	stx     _seed+1
+	sta     ptr1
+	stx     ptr1+1
+	lda     _seed+1
+	lsr     a
+	eor     ptr1
+	pha
+	lda     #$00
+	eor     ptr1+1
+	tax
+	pla
+	sta     _seed
+	stx     _seed+1
+	sta     ptr1
+	stx     ptr1+1
+	lda     #$00
+	eor     ptr1
+	pha
+	lda     _seed
+	eor     ptr1+1
+	tax
+	pla
+	sta     _seed
+	stx     _seed+1
+	rts
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ rndsize (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_rndsize: near
+
+.segment	"CODE"
+
+	jsr     _rnd
+	jsr     pushax
+	ldy     #$01
+	lda     (sp),y
+	tax
+	dey
+	txa
+	and     #$07
+	tax
+	cpx     #$00
+	bne     L0050
+	jsr     pushw0sp
+	lda     #$EC
+	jsr     tosumoda0
+	clc
+	adc     #$41
+	bcc     L004E
+	inx
+	jmp     incsp2
+L0050:	lda     (sp),y
+	ldx     #$00
+	and     #$3F
+	clc
+	adc     #$01
+	bcc     L004E
+	inx
+L004E:	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ fill (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fill: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldx     #$00
+	lda     (sp,x)
+	asl     a
+	bcc     L013F
+	inx
+	clc
+L013F:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	sta     ptr1
+	stx     ptr1+1
+	lda     (sp),y
+	sta     (ptr1),y
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L0140
+	inx
+	clc
+L0140:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	iny
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	sta     sreg
+	stx     sreg+1
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L0141
+	inx
+	clc
+L0141:	adc     #<(_size)
+	sta     ptr1
+	txa
+	adc     #>(_size)
+	sta     ptr1+1
+	iny
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	sec
+	sbc     #$01
+	bcs     L0063
+	dex
+L0063:	clc
+	adc     sreg
+	sta     ptr1
+	txa
+	adc     sreg+1
+	sta     ptr1+1
+	lda     (sp),y
+	sta     (ptr1),y
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ check (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_check: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldx     #$00
+	lda     (sp,x)
+	asl     a
+	bcc     L0148
+	inx
+	clc
+L0148:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	sta     ptr1
+	stx     ptr1+1
+	ldx     #$00
+	lda     (ptr1),y
+	cmp     (sp),y
+	bne     L014C
+	lda     (sp),y
+	asl     a
+	bcc     L0149
+	inx
+	clc
+L0149:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	iny
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	sta     sreg
+	stx     sreg+1
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L014A
+	inx
+	clc
+L014A:	adc     #<(_size)
+	sta     ptr1
+	txa
+	adc     #>(_size)
+	sta     ptr1+1
+	iny
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	sec
+	sbc     #$01
+	bcs     L006D
+	dex
+L006D:	clc
+	adc     sreg
+	sta     ptr1
+	txa
+	adc     sreg+1
+	sta     ptr1+1
+	lda     (ptr1),y
+	cmp     (sp),y
+	jeq     incsp1
+L014C:	lda     #<(L0070)
+	ldx     #>(L0070)
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	asl     a
+	bcc     L014B
+	ldx     #$01
+	clc
+L014B:	adc     #<(_size)
+	sta     ptr1
+	txa
+	adc     #>(_size)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	inc     _failures
+	jmp     incsp1
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ round (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_round: near
+
+.segment	"CODE"
+
+	ldy     #$09
+	jsr     subysp
+	ldx     #$12
+	lda     #$34
+	sta     _seed
+	stx     _seed+1
+	ldy     #$07
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L0163
+L007C:	jsr     _rnd
+	ldy     #$03
+	jsr     staxysp
+	and     #$3F
+	ldy     #$02
+	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L0158
+	inx
+	clc
+L0158:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	dey
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	jne     L0087
+	cmp     #$00
+	jne     L0087
+	jsr     _rndsize
+	ldy     #$05
+	jsr     staxysp
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L0159
+	inx
+	clc
+L0159:	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _get
+	ldy     #$00
+	jsr     staxspidx
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L015A
+	inx
+	clc
+L015A:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	dey
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0092
+	cmp     #$00
+	bne     L0092
+	lda     #<(L0097)
+	ldx     #>(L0097)
+	jsr     pushax
+	ldy     #$0A
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	jmp     L00D0
+L0092:	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L015B
+	inx
+	clc
+L015B:	adc     #<(_size)
+	sta     ptr1
+	txa
+	adc     #>(_size)
+	sta     ptr1+1
+	ldy     #$06
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	iny
+	lda     (sp),y
+	jsr     _fill
+	jmp     L00C5
+L0087:	ldy     #$04
+	lda     (sp),y
+	and     #$0F
+	tax
+	cpx     #$00
+	jne     L00A1
+	ldy     #$02
+	lda     (sp),y
+	jsr     _check
+	jsr     _rndsize
+	ldy     #$05
+	jsr     staxysp
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _reget
+	jsr     stax0sp
+	cpx     #$00
+	bne     L00AD
+	cmp     #$00
+	bne     L00AD
+	lda     #<(L00B1)
+	ldx     #>(L00B1)
+	jsr     pushax
+	ldy     #$0A
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	jmp     L00D0
+L00AD:	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L015C
+	inx
+	clc
+L015C:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldx     #$00
+	lda     (ptr1),y
+	ldy     #$02
+	cmp     (sp),y
+	beq     L0162
+	lda     #<(L00BC)
+	ldx     #>(L00BC)
+	jsr     pushax
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	ldy     #$02
+	ldx     #$00
+L0162:	lda     (sp),y
+	asl     a
+	bcc     L015D
+	inx
+	clc
+L015D:	adc     #<(_size)
+	sta     ptr1
+	txa
+	adc     #>(_size)
+	sta     ptr1+1
+	ldy     #$06
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$00
+	sta     (ptr1),y
+	iny
+	txa
+	sta     (ptr1),y
+	iny
+	lda     (sp),y
+	jsr     _fill
+	jmp     L00C5
+L00A1:	ldy     #$02
+	lda     (sp),y
+	jsr     _check
+	ldy     #$02
+	lda     (sp),y
+	jsr     _put
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L015E
+	inx
+	clc
+L015E:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	iny
+	sta     (ptr1),y
+L00C5:	inc     _ops
+	bne     L00CE
+	inc     _ops+1
+L00CE:	ldy     #$07
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$08
+L0163:	lda     (sp),y
+	cmp     #$07
+	bne     L0080
+	dey
+	lda     (sp),y
+	cmp     #$D0
+L0080:	jcc     L007C
+	lda     #$00
+	ldy     #$02
+	jmp     L0157
+L0165:	lda     (sp),y
+	asl     a
+	bcc     L015F
+	ldx     #$01
+	clc
+L015F:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	ldy     #$00
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	beq     L00D7
+	iny
+	lda     (sp),y
+	jsr     _check
+	ldy     #$02
+	lda     (sp),y
+	jsr     _put
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	asl     a
+	bcc     L0160
+	inx
+	clc
+L0160:	adc     #<(_slot)
+	sta     ptr1
+	txa
+	adc     #>(_slot)
+	sta     ptr1+1
+	lda     #$00
+	tay
+	sta     (ptr1),y
+	iny
+	sta     (ptr1),y
+	inc     _ops
+	bne     L00D7
+	inc     _ops+1
+L00D7:	iny
+	clc
+	lda     #$01
+	adc     (sp),y
+L0157:	sta     (sp),y
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$40
+	bcc     L0165
+L00D0:	ldy     #$09
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ fillheap (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fillheap: near
+
+.segment	"CODE"
+
+	jsr     decsp4
+	ldy     #$00
+	tya
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L0169
+L00E8:	ldy     #$01
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_full)
+	tay
+	lda     tmp1
+	adc     #>(_full)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _malloc
+	ldy     #$00
+	jsr     staxspidx
+	iny
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_full)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_full)
+	sta     ptr1+1
+	iny
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	cpx     #$00
+	bne     L0168
+	cmp     #$00
+	bne     L016A
+	lda     #<(L00FB)
+	ldx     #>(L00FB)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	jmp     L0101
+L0168:	ldx     #$00
+L016A:	lda     #$01
+	jsr     addeq0sp
+	ldy     #$01
+L0169:	lda     (sp),y
+	tax
+	cpx     #$01
+	bcs     L0101
+	jsr     __heapmaxavail
+	ldy     #$02
+	jsr     staxysp
+	cpx     #$00
+	jne     L00E8
+	cmp     #$00
+	jne     L00E8
+	jmp     L0101
+L00FF:	ldx     #$00
+	tya
+	jsr     subeq0sp
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	clc
+	adc     #<(_full)
+	sta     ptr1
+	lda     tmp1
+	adc     #>(_full)
+	sta     ptr1+1
+	ldy     #$01
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     _free
+L0101:	ldy     #$00
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L00FF
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     push0
+	jsr     decsp1
+	lda     #<(_extra)
+	ldx     #>(_extra)
+	jsr     pushax
+	ldx     #$00
+	lda     #$C8
+	jsr     __heapadd
+	lda     #$00
+	tay
+	jmp     L016D
+L0110:	jsr     _round
+	ldy     #$00
+	lda     (sp),y
+	beq     L0116
+	jsr     __heapmemavail
+	ldy     #$01
+	cmp     (sp),y
+	bne     L0117
+	txa
+	iny
+	cmp     (sp),y
+	beq     L0116
+L0117:	lda     #<(L011B)
+	ldx     #>(L011B)
+	jsr     pushax
+	jsr     __heapmemavail
+	jsr     pushax
+	ldy     #$08
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _printf
+	inc     _failures
+L0116:	jsr     __heapmemavail
+	ldy     #$01
+	jsr     staxysp
+	jsr     __heapmaxavail
+	cpx     #$01
+	bne     L0124
+	cmp     #$2C
+L0124:	bcc     L0123
+	jsr     __heapmaxavail
+	sec
+	ldy     #$01
+	sbc     (sp),y
+	sta     tmp1
+	txa
+	iny
+	sbc     (sp),y
+	ora     tmp1
+	beq     L0122
+	bcc     L0122
+L0123:	lda     #<(L0127)
+	ldx     #>(L0127)
+	jsr     pushax
+	jsr     __heapmaxavail
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0122:	ldy     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+L016D:	sta     (sp),y
+	cmp     #$02
+	bcc     L0110
+	jsr     _fillheap
+	lda     #<(L012D)
+	ldx     #>(L012D)
+	jsr     pushax
+	lda     _ops
+	ldx     _ops+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	lda     _failures
+	beq     L0131
+	ldx     #$00
+	lda     #$01
+	jmp     incsp3
+L0131:	tax
+	jmp     incsp3
+
+.endproc
+
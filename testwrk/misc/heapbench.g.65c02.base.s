@@ -0,0 +1,898 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "heapbench.c", 6029, 1792389723
+	.dbg		file, "/root/repo/include/stdio.h", 6363, 1792382670
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1515150330
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1515150330
+	.dbg		file, "/root/repo/include/stdlib.h", 5748, 1515150330
+	.dbg		file, "/root/repo/include/string.h", 5041, 1515150330
+	.dbg		file, "/root/repo/include/_heap.h", 1452, 1792383632
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_ops:
+	.word	$0000
+
+.segment	"RODATA"
+
+L0038:
+	.byte	$73,$6C,$6F,$74,$20,$25,$75,$3A,$20,$62,$6C,$6F,$63,$6B,$20,$6F
+	.byte	$66,$20,$25,$75,$20,$62,$79,$74,$65,$73,$20,$77,$61,$73,$20,$6F
+	.byte	$76,$65,$72,$77,$72,$69,$74,$74,$65,$6E,$0A,$00
+L0084:
+	.byte	$73,$6C,$6F,$74,$20,$25,$75,$3A,$20,$72,$65,$61,$6C,$6C,$6F,$63
+	.byte	$20,$6C,$6F,$73,$74,$20,$74,$68,$65,$20,$64,$61,$74,$61,$0A,$00
+L0079:
+	.byte	$63,$61,$6E,$6E,$6F,$74,$20,$72,$65,$61,$6C,$6C,$6F,$63,$61,$74
+	.byte	$65,$20,$25,$75,$20,$62,$79,$74,$65,$73,$0A,$00
+L005F:
+	.byte	$63,$61,$6E,$6E,$6F,$74,$20,$61,$6C,$6C,$6F,$63,$61,$74,$65,$20
+	.byte	$25,$75,$20,$62,$79,$74,$65,$73,$0A,$00
+L00B6:
+	.byte	$25,$75,$20,$6F,$70,$65,$72,$61,$74,$69,$6F,$6E,$73,$0A,$00
+
+.segment	"BSS"
+
+_slot:
+	.res	128,$00
+_size:
+	.res	128,$00
+_seed:
+	.res	2,$00
+_mem:
+	.res	19200,$00
+
+; ---------------------------------------------------------------
+; __near__ void * __near__ get (unsigned char, unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_get: near
+
+	.dbg	func, "get", "00", static, "_get"
+	.dbg	sym, "i", "00", auto, 2
+	.dbg	sym, "n", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "heapbench.c", 43
+	jsr     pushax
+	.dbg	line, "heapbench.c", 45
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     mulax3
+	jsr     mulax10
+	jsr     mulax10
+	clc
+	adc     #<(_mem)
+	tay
+	txa
+	adc     #>(_mem)
+	tax
+	tya
+	jmp     L0007
+	.dbg	line, "heapbench.c", 46
+L0007:	jsr     incsp3
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; __near__ void * __near__ reget (unsigned char, unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_reget: near
+
+	.dbg	func, "reget", "00", static, "_reget"
+	.dbg	sym, "i", "00", auto, 2
+	.dbg	sym, "n", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "heapbench.c", 49
+	jsr     pushax
+	.dbg	line, "heapbench.c", 51
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     mulax3
+	jsr     mulax10
+	jsr     mulax10
+	clc
+	adc     #<(_mem)
+	tay
+	txa
+	adc     #>(_mem)
+	tax
+	tya
+	jmp     L000B
+	.dbg	line, "heapbench.c", 52
+L000B:	jsr     incsp3
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ put (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_put: near
+
+	.dbg	func, "put", "00", static, "_put"
+	.dbg	sym, "i", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "heapbench.c", 55
+	jsr     pusha
+	.dbg	line, "heapbench.c", 57
+	jsr     incsp1
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ rnd (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_rnd: near
+
+	.dbg	func, "rnd", "00", static, "_rnd"
+
+.segment	"CODE"
+
+	.dbg	line, "heapbench.c", 110
+	lda     _seed
+	ldx     _seed+1
+	jsr     pushax
+	lda     _seed
+	ldx     _seed+1
+	jsr     shlax4
+	jsr     shlax3
+	jsr     tosxorax
+	sta     _seed
+	stx     _seed+1
+	.dbg	line, "heapbench.c", 111
+	lda     _seed
+	ldx     _seed+1
+	jsr     pushax
+	ldx     #$00
+	lda     _seed+1
+	jsr     shrax1
+	jsr     tosxorax
+	sta     _seed
+	stx     _seed+1
+	.dbg	line, "heapbench.c", 112
+	lda     _seed
+	ldx     _seed+1
+	jsr     pushax
+	lda     _seed
+	ldx     _seed+1
+	tax
+	lda     #$00
+	jsr     tosxorax
+	sta     _seed
+	stx     _seed+1
+	.dbg	line, "heapbench.c", 113
+	lda     _seed
+	ldx     _seed+1
+	jmp     L0011
+	.dbg	line, "heapbench.c", 114
+L0011:	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ rndsize (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_rndsize: near
+
+	.dbg	func, "rndsize", "00", static, "_rndsize"
+	.dbg	sym, "r", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "heapbench.c", 118
+	jsr     _rnd
+	jsr     pushax
+	.dbg	line, "heapbench.c", 121
+	ldy     #$01
+	jsr     ldaxysp
+	txa
+	and     #$07
+	tax
+	lda     #$00
+	cpx     #$00
+	bne     L001E
+	cmp     #$00
+L001E:	jsr     booleq
+	jeq     L001B
+	.dbg	line, "heapbench.c", 122
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$EC
+	jsr     tosumodax
+	ldy     #$41
+	jsr     incaxy
+	jmp     L0019
+	.dbg	line, "heapbench.c", 124
+L001B:	ldy     #$01
+	jsr     ldaxysp
+	ldx     #$00
+	and     #$3F
+	ina
+	bne     L0023
+	inx
+L0023:	jmp     L0019
+	.dbg	line, "heapbench.c", 125
+L0019:	jsr     incsp2
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ fill (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fill: near
+
+	.dbg	func, "fill", "00", static, "_fill"
+	.dbg	sym, "i", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "heapbench.c", 128
+	jsr     pusha
+	.dbg	line, "heapbench.c", 129
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$00
+	jsr     staspidx
+	.dbg	line, "heapbench.c", 130
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_size)
+	tay
+	txa
+	adc     #>(_size)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     decax1
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$00
+	jsr     staspidx
+	.dbg	line, "heapbench.c", 131
+	jsr     incsp1
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ check (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_check: near
+
+	.dbg	func, "check", "00", static, "_check"
+	.dbg	sym, "i", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "heapbench.c", 134
+	jsr     pusha
+	.dbg	line, "heapbench.c", 135
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$00
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosneax
+	jne     L0030
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_size)
+	tay
+	txa
+	adc     #>(_size)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     decax1
+	jsr     tosaddax
+	ldy     #$00
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosneax
+	jne     L0030
+	ldx     #$00
+	lda     #$00
+	jeq     L0036
+L0030:	ldx     #$00
+	lda     #$01
+L0036:	jeq     L002F
+	.dbg	line, "heapbench.c", 136
+	lda     #<(L0038)
+	ldx     #>(L0038)
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_size)
+	tay
+	txa
+	adc     #>(_size)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "heapbench.c", 137
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "heapbench.c", 139
+L002F:	jsr     incsp1
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ round (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_round: near
+
+	.dbg	func, "round", "00", static, "_round"
+	.dbg	sym, "k", "00", auto, -2
+	.dbg	sym, "n", "00", auto, -4
+	.dbg	sym, "r", "00", auto, -6
+	.dbg	sym, "i", "00", auto, -7
+	.dbg	sym, "p", "00", auto, -9
+
+.segment	"CODE"
+
+	.dbg	line, "heapbench.c", 147
+	ldy     #$09
+	jsr     subysp
+	ldx     #$12
+	lda     #$34
+	sta     _seed
+	stx     _seed+1
+	.dbg	line, "heapbench.c", 148
+	ldx     #$00
+	lda     #$00
+	ldy     #$07
+	jsr     staxysp
+	jmp     L0041
+	.dbg	line, "heapbench.c", 149
+L0044:	jsr     _rnd
+	ldy     #$03
+	jsr     staxysp
+	.dbg	line, "heapbench.c", 150
+	ldy     #$04
+	jsr     ldaxysp
+	ldx     #$00
+	and     #$3F
+	ldx     #$00
+	ldy     #$02
+	sta     (sp),y
+	.dbg	line, "heapbench.c", 151
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0052
+	cmp     #$00
+L0052:	jsr     booleq
+	jeq     L004F
+	.dbg	line, "heapbench.c", 153
+	jsr     _rndsize
+	ldy     #$05
+	jsr     staxysp
+	.dbg	line, "heapbench.c", 154
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     _get
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "heapbench.c", 155
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L005D
+	cmp     #$00
+L005D:	jsr     booleq
+	jeq     L005A
+	.dbg	line, "heapbench.c", 156
+	lda     #<(L005F)
+	ldx     #>(L005F)
+	jsr     pushax
+	ldy     #$08
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "heapbench.c", 157
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "heapbench.c", 158
+	jmp     L0098
+	.dbg	line, "heapbench.c", 160
+L005A:	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_size)
+	tay
+	txa
+	adc     #>(_size)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$08
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "heapbench.c", 161
+	ldy     #$02
+	lda     (sp),y
+	jsr     _fill
+	.dbg	line, "heapbench.c", 162
+	jmp     L008D
+L004F:	ldy     #$04
+	jsr     ldaxysp
+	txa
+	and     #$0F
+	tax
+	lda     #$00
+	cpx     #$00
+	bne     L006C
+	cmp     #$00
+L006C:	jsr     booleq
+	jeq     L0069
+	.dbg	line, "heapbench.c", 164
+	ldy     #$02
+	lda     (sp),y
+	jsr     _check
+	.dbg	line, "heapbench.c", 165
+	jsr     _rndsize
+	ldy     #$05
+	jsr     staxysp
+	.dbg	line, "heapbench.c", 166
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _reget
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "heapbench.c", 167
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0077
+	cmp     #$00
+L0077:	jsr     booleq
+	jeq     L0075
+	.dbg	line, "heapbench.c", 168
+	lda     #<(L0079)
+	ldx     #>(L0079)
+	jsr     pushax
+	ldy     #$08
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "heapbench.c", 169
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "heapbench.c", 170
+	jmp     L0098
+	.dbg	line, "heapbench.c", 172
+L0075:	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "heapbench.c", 173
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosneax
+	jeq     L0080
+	.dbg	line, "heapbench.c", 174
+	lda     #<(L0084)
+	ldx     #>(L0084)
+	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "heapbench.c", 175
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "heapbench.c", 177
+L0080:	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_size)
+	tay
+	txa
+	adc     #>(_size)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$08
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "heapbench.c", 178
+	ldy     #$02
+	lda     (sp),y
+	jsr     _fill
+	.dbg	line, "heapbench.c", 179
+	jmp     L008D
+	.dbg	line, "heapbench.c", 181
+L0069:	ldy     #$02
+	lda     (sp),y
+	jsr     _check
+	.dbg	line, "heapbench.c", 182
+	ldy     #$02
+	lda     (sp),y
+	jsr     _put
+	.dbg	line, "heapbench.c", 183
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "heapbench.c", 185
+L008D:	inc     _ops
+	bne     L0096
+	inc     _ops+1
+L0096:	lda     _ops
+	ldx     _ops+1
+	.dbg	line, "heapbench.c", 148
+	ldy     #$07
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0041:	ldy     #$08
+	jsr     ldaxysp
+	cpx     #$07
+	bne     L0048
+	cmp     #$D0
+L0048:	jsr     boolult
+	jne     L0044
+	.dbg	line, "heapbench.c", 189
+	ldx     #$00
+	lda     #$00
+	ldy     #$02
+	sta     (sp),y
+	jmp     L0097
+	.dbg	line, "heapbench.c", 190
+L009A:	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L009F
+	.dbg	line, "heapbench.c", 191
+	ldy     #$02
+	lda     (sp),y
+	jsr     _check
+	.dbg	line, "heapbench.c", 192
+	ldy     #$02
+	lda     (sp),y
+	jsr     _put
+	.dbg	line, "heapbench.c", 193
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "heapbench.c", 194
+	inc     _ops
+	bne     L00AA
+	inc     _ops+1
+L00AA:	lda     _ops
+	ldx     _ops+1
+	.dbg	line, "heapbench.c", 189
+L009F:	ldy     #$02
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+L0097:	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$40
+	jsr     boolult
+	jne     L009A
+	.dbg	line, "heapbench.c", 197
+L0098:	ldy     #$09
+	jsr     addysp
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "r", "00", auto, -1
+
+.segment	"CODE"
+
+	.dbg	line, "heapbench.c", 254
+	jsr     decsp1
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	sta     (sp),y
+	jmp     L00AC
+	.dbg	line, "heapbench.c", 255
+L00AF:	jsr     _round
+	.dbg	line, "heapbench.c", 254
+	ldy     #$00
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+L00AC:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$02
+	jsr     boolult
+	jne     L00AF
+	.dbg	line, "heapbench.c", 259
+	lda     #<(L00B6)
+	ldx     #>(L00B6)
+	jsr     pushax
+	lda     _ops
+	ldx     _ops+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "heapbench.c", 260
+	lda     _failures
+	jeq     L00BA
+	ldx     #$00
+	lda     #$01
+	jmp     L00BC
+L00BA:	ldx     #$00
+	lda     #$00
+L00BC:	jmp     L00AB
+	.dbg	line, "heapbench.c", 261
+L00AB:	jsr     incsp1
+	rts
+	.dbg	line
+
+.endproc
+
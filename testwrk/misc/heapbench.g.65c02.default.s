@@ -0,0 +1,1304 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "heapbench.c", 6029, 1792389723
+	.dbg		file, "/root/repo/include/stdio.h", 6363, 1792382670
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1515150330
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1515150330
+	.dbg		file, "/root/repo/include/stdlib.h", 5748, 1515150330
+	.dbg		file, "/root/repo/include/string.h", 5041, 1515150330
+	.dbg		file, "/root/repo/include/_heap.h", 1452, 1792383632
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.dbg		sym, "malloc", "00", extern, "_malloc"
+	.dbg		sym, "calloc", "00", extern, "_calloc"
+	.dbg		sym, "realloc", "00", extern, "_realloc"
+	.dbg		sym, "free", "00", extern, "_free"
+	.dbg		sym, "posix_memalign", "00", extern, "_posix_memalign"
+	.dbg		sym, "_heapadd", "00", extern, "__heapadd"
+	.dbg		sym, "_heapblocksize", "00", extern, "__heapblocksize"
+	.dbg		sym, "_heapmemavail", "00", extern, "__heapmemavail"
+	.dbg		sym, "_heapmaxavail", "00", extern, "__heapmaxavail"
+	.import		_printf
+	.import		_malloc
+	.import		_calloc
+	.import		_realloc
+	.import		_free
+	.import		_posix_memalign
+	.import		__heapadd
+	.import		__heapblocksize
+	.import		__heapmemavail
+	.import		__heapmaxavail
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+_ops:
+	.word	$0000
+
+.segment	"RODATA"
+
+L006C:
+	.byte	$73,$6C,$6F,$74,$20,$25,$75,$3A,$20,$62,$6C,$6F,$63,$6B,$20,$6F
+	.byte	$66,$20,$25,$75,$20,$62,$79,$74,$65,$73,$20,$77,$61,$73,$20,$6F
+	.byte	$76,$65,$72,$77,$72,$69,$74,$74,$65,$6E,$0A,$00
+L00F7:
+	.byte	$68,$65,$61,$70,$20,$66,$75,$6C,$6C,$3A,$20,$63,$61,$6E,$6E,$6F
+	.byte	$74,$20,$61,$6C,$6C,$6F,$63,$61,$74,$65,$20,$25,$75,$20,$62,$79
+	.byte	$74,$65,$73,$0A,$00
+L0026:
+	.byte	$70,$6F,$73,$69,$78,$5F,$6D,$65,$6D,$61,$6C,$69,$67,$6E,$3A,$20
+	.byte	$25,$70,$20,$6E,$6F,$74,$20,$61,$6C,$69,$67,$6E,$65,$64,$0A,$00
+L0117:
+	.byte	$5F,$68,$65,$61,$70,$6D,$65,$6D,$61,$76,$61,$69,$6C,$3A,$20,$25
+	.byte	$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$25,$75,$0A,$00
+L00B8:
+	.byte	$73,$6C,$6F,$74,$20,$25,$75,$3A,$20,$72,$65,$61,$6C,$6C,$6F,$63
+	.byte	$20,$6C,$6F,$73,$74,$20,$74,$68,$65,$20,$64,$61,$74,$61,$0A,$00
+L0015:
+	.byte	$63,$61,$6C,$6C,$6F,$63,$20,$64,$69,$64,$6E,$27,$74,$20,$63,$6C
+	.byte	$65,$61,$72,$20,$74,$68,$65,$20,$62,$6C,$6F,$63,$6B,$0A,$00
+L0034:
+	.byte	$73,$6C,$6F,$74,$20,$25,$75,$3A,$20,$62,$6C,$6F,$63,$6B,$20,$73
+	.byte	$69,$7A,$65,$20,$25,$75,$20,$3C,$20,$25,$75,$0A,$00
+L00AD:
+	.byte	$63,$61,$6E,$6E,$6F,$74,$20,$72,$65,$61,$6C,$6C,$6F,$63,$61,$74
+	.byte	$65,$20,$25,$75,$20,$62,$79,$74,$65,$73,$0A,$00
+L0093	:=	L00F7+11
+L0123:
+	.byte	$5F,$68,$65,$61,$70,$6D,$61,$78,$61,$76,$61,$69,$6C,$3A,$20,$25
+	.byte	$75,$0A,$00
+L0129:
+	.byte	$25,$75,$20,$6F,$70,$65,$72,$61,$74,$69,$6F,$6E,$73,$0A,$00
+
+.segment	"BSS"
+
+_slot:
+	.res	128,$00
+_size:
+	.res	128,$00
+_seed:
+	.res	2,$00
+_extra:
+	.res	200,$00
+_full:
+	.res	512,$00
+
+; ---------------------------------------------------------------
+; __near__ void * __near__ get (unsigned char, unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_get: near
+
+	.dbg	func, "get", "00", static, "_get"
+	.dbg	sym, "i", "00", auto, 2
+	.dbg	sym, "n", "00", auto, 0
+	.dbg	sym, "p", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "heapbench.c", 65
+	jsr     pushax
+	.dbg	line, "heapbench.c", 69
+	jsr     decsp2
+	lda     _ops
+	ldx     _ops+1
+	ldx     #$00
+	and     #$1F
+	jmp     L0008
+	.dbg	line, "heapbench.c", 88
+L0008:	cpx     #$00
+	jne     L002A
+	cmp     #$00
+	jeq     L000B
+	cmp     #$01
+	jeq     L0019
+	jmp     L002A
+	jmp     L002A
+	.dbg	line, "heapbench.c", 71
+L000B:	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     _calloc
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "heapbench.c", 72
+	ldy     #$01
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0012
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	cmp     #$00
+	jsr     boolne
+	jne     L0011
+L0012:	ldx     #$00
+	lda     #$00
+	jeq     L0013
+L0011:	ldx     #$00
+	lda     #$01
+L0013:	jeq     L0010
+	.dbg	line, "heapbench.c", 73
+	lda     #<(L0015)
+	ldx     #>(L0015)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "heapbench.c", 74
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "heapbench.c", 76
+L0010:	jmp     L0009
+	.dbg	line, "heapbench.c", 78
+L0019:	lda     sp
+	ldx     sp+1
+	jsr     pushax
+	ldx     #$00
+	lda     #$10
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _posix_memalign
+	cpx     #$00
+	bne     L001F
+	cmp     #$00
+L001F:	jsr     boolne
+	jeq     L001A
+	.dbg	line, "heapbench.c", 79
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "heapbench.c", 80
+	jmp     L0023
+L001A:	ldy     #$01
+	jsr     ldaxysp
+	ldx     #$00
+	and     #$0F
+	stx     tmp1
+	ora     tmp1
+	jeq     L0023
+	.dbg	line, "heapbench.c", 81
+	lda     #<(L0026)
+	ldx     #>(L0026)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "heapbench.c", 82
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "heapbench.c", 84
+L0023:	jmp     L0009
+	.dbg	line, "heapbench.c", 86
+L002A:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _malloc
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "heapbench.c", 87
+	jmp     L0009
+	.dbg	line, "heapbench.c", 89
+L0009:	ldy     #$01
+	lda     (sp),y
+	dey
+	ora     (sp),y
+	jeq     L0030
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     __heapblocksize
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosultax
+	jne     L002F
+L0030:	ldx     #$00
+	lda     #$00
+	jeq     L0032
+L002F:	ldx     #$00
+	lda     #$01
+L0032:	jeq     L002E
+	.dbg	line, "heapbench.c", 90
+	lda     #<(L0034)
+	ldx     #>(L0034)
+	jsr     pushax
+	ldy     #$06
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     __heapblocksize
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "heapbench.c", 91
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "heapbench.c", 93
+L002E:	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0006
+	.dbg	line, "heapbench.c", 94
+L0006:	jsr     incsp5
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; __near__ void * __near__ reget (unsigned char, unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_reget: near
+
+	.dbg	func, "reget", "00", static, "_reget"
+	.dbg	sym, "i", "00", auto, 2
+	.dbg	sym, "n", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "heapbench.c", 97
+	jsr     pushax
+	.dbg	line, "heapbench.c", 98
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     _realloc
+	jmp     L003C
+	.dbg	line, "heapbench.c", 99
+L003C:	jsr     incsp3
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ put (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_put: near
+
+	.dbg	func, "put", "00", static, "_put"
+	.dbg	sym, "i", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "heapbench.c", 102
+	jsr     pusha
+	.dbg	line, "heapbench.c", 103
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     _free
+	.dbg	line, "heapbench.c", 104
+	jsr     incsp1
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ rnd (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_rnd: near
+
+	.dbg	func, "rnd", "00", static, "_rnd"
+
+.segment	"CODE"
+
+	.dbg	line, "heapbench.c", 110
+	lda     _seed
+	ldx     _seed+1
+	jsr     pushax
+	lda     _seed
+	ldx     _seed+1
+	jsr     shlax4
+	jsr     shlax3
+	jsr     tosxorax
+	sta     _seed
+	stx     _seed+1
+	.dbg	line, "heapbench.c", 111
+	lda     _seed
+	ldx     _seed+1
+	jsr     pushax
+	ldx     #$00
+	lda     _seed+1
+	jsr     shrax1
+	jsr     tosxorax
+	sta     _seed
+	stx     _seed+1
+	.dbg	line, "heapbench.c", 112
+	lda     _seed
+	ldx     _seed+1
+	jsr     pushax
+	lda     _seed
+	ldx     _seed+1
+	tax
+	lda     #$00
+	jsr     tosxorax
+	sta     _seed
+	stx     _seed+1
+	.dbg	line, "heapbench.c", 113
+	lda     _seed
+	ldx     _seed+1
+	jmp     L0045
+	.dbg	line, "heapbench.c", 114
+L0045:	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ rndsize (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_rndsize: near
+
+	.dbg	func, "rndsize", "00", static, "_rndsize"
+	.dbg	sym, "r", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "heapbench.c", 118
+	jsr     _rnd
+	jsr     pushax
+	.dbg	line, "heapbench.c", 121
+	ldy     #$01
+	jsr     ldaxysp
+	txa
+	and     #$07
+	tax
+	lda     #$00
+	cpx     #$00
+	bne     L0052
+	cmp     #$00
+L0052:	jsr     booleq
+	jeq     L004F
+	.dbg	line, "heapbench.c", 122
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$EC
+	jsr     tosumodax
+	ldy     #$41
+	jsr     incaxy
+	jmp     L004D
+	.dbg	line, "heapbench.c", 124
+L004F:	ldy     #$01
+	jsr     ldaxysp
+	ldx     #$00
+	and     #$3F
+	ina
+	bne     L0057
+	inx
+L0057:	jmp     L004D
+	.dbg	line, "heapbench.c", 125
+L004D:	jsr     incsp2
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ fill (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fill: near
+
+	.dbg	func, "fill", "00", static, "_fill"
+	.dbg	sym, "i", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "heapbench.c", 128
+	jsr     pusha
+	.dbg	line, "heapbench.c", 129
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$00
+	jsr     staspidx
+	.dbg	line, "heapbench.c", 130
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_size)
+	tay
+	txa
+	adc     #>(_size)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     decax1
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	ldy     #$00
+	jsr     staspidx
+	.dbg	line, "heapbench.c", 131
+	jsr     incsp1
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ check (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_check: near
+
+	.dbg	func, "check", "00", static, "_check"
+	.dbg	sym, "i", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "heapbench.c", 134
+	jsr     pusha
+	.dbg	line, "heapbench.c", 135
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	ldy     #$00
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosneax
+	jne     L0064
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_size)
+	tay
+	txa
+	adc     #>(_size)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     decax1
+	jsr     tosaddax
+	ldy     #$00
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosneax
+	jne     L0064
+	ldx     #$00
+	lda     #$00
+	jeq     L006A
+L0064:	ldx     #$00
+	lda     #$01
+L006A:	jeq     L0063
+	.dbg	line, "heapbench.c", 136
+	lda     #<(L006C)
+	ldx     #>(L006C)
+	jsr     pushax
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_size)
+	tay
+	txa
+	adc     #>(_size)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "heapbench.c", 137
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "heapbench.c", 139
+L0063:	jsr     incsp1
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ round (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_round: near
+
+	.dbg	func, "round", "00", static, "_round"
+	.dbg	sym, "k", "00", auto, -2
+	.dbg	sym, "n", "00", auto, -4
+	.dbg	sym, "r", "00", auto, -6
+	.dbg	sym, "i", "00", auto, -7
+	.dbg	sym, "p", "00", auto, -9
+
+.segment	"CODE"
+
+	.dbg	line, "heapbench.c", 147
+	ldy     #$09
+	jsr     subysp
+	ldx     #$12
+	lda     #$34
+	sta     _seed
+	stx     _seed+1
+	.dbg	line, "heapbench.c", 148
+	ldx     #$00
+	lda     #$00
+	ldy     #$07
+	jsr     staxysp
+	jmp     L0075
+	.dbg	line, "heapbench.c", 149
+L0078:	jsr     _rnd
+	ldy     #$03
+	jsr     staxysp
+	.dbg	line, "heapbench.c", 150
+	ldy     #$04
+	jsr     ldaxysp
+	ldx     #$00
+	and     #$3F
+	ldx     #$00
+	ldy     #$02
+	sta     (sp),y
+	.dbg	line, "heapbench.c", 151
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0086
+	cmp     #$00
+L0086:	jsr     booleq
+	jeq     L0083
+	.dbg	line, "heapbench.c", 153
+	jsr     _rndsize
+	ldy     #$05
+	jsr     staxysp
+	.dbg	line, "heapbench.c", 154
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$04
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     _get
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "heapbench.c", 155
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L0091
+	cmp     #$00
+L0091:	jsr     booleq
+	jeq     L008E
+	.dbg	line, "heapbench.c", 156
+	lda     #<(L0093)
+	ldx     #>(L0093)
+	jsr     pushax
+	ldy     #$08
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "heapbench.c", 157
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "heapbench.c", 158
+	jmp     L00CC
+	.dbg	line, "heapbench.c", 160
+L008E:	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_size)
+	tay
+	txa
+	adc     #>(_size)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$08
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "heapbench.c", 161
+	ldy     #$02
+	lda     (sp),y
+	jsr     _fill
+	.dbg	line, "heapbench.c", 162
+	jmp     L00C1
+L0083:	ldy     #$04
+	jsr     ldaxysp
+	txa
+	and     #$0F
+	tax
+	lda     #$00
+	cpx     #$00
+	bne     L00A0
+	cmp     #$00
+L00A0:	jsr     booleq
+	jeq     L009D
+	.dbg	line, "heapbench.c", 164
+	ldy     #$02
+	lda     (sp),y
+	jsr     _check
+	.dbg	line, "heapbench.c", 165
+	jsr     _rndsize
+	ldy     #$05
+	jsr     staxysp
+	.dbg	line, "heapbench.c", 166
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _reget
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "heapbench.c", 167
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00AB
+	cmp     #$00
+L00AB:	jsr     booleq
+	jeq     L00A9
+	.dbg	line, "heapbench.c", 168
+	lda     #<(L00AD)
+	ldx     #>(L00AD)
+	jsr     pushax
+	ldy     #$08
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "heapbench.c", 169
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "heapbench.c", 170
+	jmp     L00CC
+	.dbg	line, "heapbench.c", 172
+L00A9:	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "heapbench.c", 173
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosneax
+	jeq     L00B4
+	.dbg	line, "heapbench.c", 174
+	lda     #<(L00B8)
+	ldx     #>(L00B8)
+	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "heapbench.c", 175
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "heapbench.c", 177
+L00B4:	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_size)
+	tay
+	txa
+	adc     #>(_size)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$08
+	jsr     ldaxysp
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "heapbench.c", 178
+	ldy     #$02
+	lda     (sp),y
+	jsr     _fill
+	.dbg	line, "heapbench.c", 179
+	jmp     L00C1
+	.dbg	line, "heapbench.c", 181
+L009D:	ldy     #$02
+	lda     (sp),y
+	jsr     _check
+	.dbg	line, "heapbench.c", 182
+	ldy     #$02
+	lda     (sp),y
+	jsr     _put
+	.dbg	line, "heapbench.c", 183
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "heapbench.c", 185
+L00C1:	inc     _ops
+	bne     L00CA
+	inc     _ops+1
+L00CA:	lda     _ops
+	ldx     _ops+1
+	.dbg	line, "heapbench.c", 148
+	ldy     #$07
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0075:	ldy     #$08
+	jsr     ldaxysp
+	cpx     #$07
+	bne     L007C
+	cmp     #$D0
+L007C:	jsr     boolult
+	jne     L0078
+	.dbg	line, "heapbench.c", 189
+	ldx     #$00
+	lda     #$00
+	ldy     #$02
+	sta     (sp),y
+	jmp     L00CB
+	.dbg	line, "heapbench.c", 190
+L00CE:	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	ldy     #$00
+	sta     ptr1
+	stx     ptr1+1
+	lda     (ptr1),y
+	iny
+	ora     (ptr1),y
+	jeq     L00D3
+	.dbg	line, "heapbench.c", 191
+	ldy     #$02
+	lda     (sp),y
+	jsr     _check
+	.dbg	line, "heapbench.c", 192
+	ldy     #$02
+	lda     (sp),y
+	jsr     _put
+	.dbg	line, "heapbench.c", 193
+	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	jsr     aslax1
+	clc
+	adc     #<(_slot)
+	tay
+	txa
+	adc     #>(_slot)
+	tax
+	tya
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "heapbench.c", 194
+	inc     _ops
+	bne     L00DE
+	inc     _ops+1
+L00DE:	lda     _ops
+	ldx     _ops+1
+	.dbg	line, "heapbench.c", 189
+L00D3:	ldy     #$02
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+L00CB:	ldy     #$02
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$40
+	jsr     boolult
+	jne     L00CE
+	.dbg	line, "heapbench.c", 197
+L00CC:	ldy     #$09
+	jsr     addysp
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ fillheap (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fillheap: near
+
+	.dbg	func, "fillheap", "00", static, "_fillheap"
+	.dbg	sym, "n", "00", auto, -2
+	.dbg	sym, "k", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "heapbench.c", 214
+	jsr     decsp4
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	jmp     L00E1
+	.dbg	line, "heapbench.c", 215
+L00E4:	ldy     #$01
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_full)
+	tay
+	txa
+	adc     #>(_full)
+	tax
+	tya
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _malloc
+	ldy     #$00
+	jsr     staxspidx
+	.dbg	line, "heapbench.c", 216
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     aslax1
+	clc
+	adc     #<(_full)
+	tay
+	txa
+	adc     #>(_full)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	cpx     #$00
+	bne     L00F5
+	cmp     #$00
+L00F5:	jsr     booleq
+	jeq     L00F2
+	.dbg	line, "heapbench.c", 217
+	lda     #<(L00F7)
+	ldx     #>(L00F7)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "heapbench.c", 218
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "heapbench.c", 219
+	jmp     L00E2
+	.dbg	line, "heapbench.c", 214
+L00F2:	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L00E1:	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$01
+	jsr     boolult
+	jeq     L00E8
+	jsr     __heapmaxavail
+	ldy     #$02
+	jsr     staxysp
+	cpx     #$00
+	bne     L00EB
+	cmp     #$00
+L00EB:	jsr     boolne
+	jne     L00E7
+L00E8:	ldx     #$00
+	lda     #$00
+	jeq     L00EC
+L00E7:	ldx     #$00
+	lda     #$01
+L00EC:	jne     L00E4
+	.dbg	line, "heapbench.c", 222
+L00E2:	jmp     L00FD
+	.dbg	line, "heapbench.c", 223
+L00FB:	ldx     #$00
+	lda     #$01
+	ldy     #$00
+	jsr     subeqysp
+	jsr     aslax1
+	clc
+	adc     #<(_full)
+	tay
+	txa
+	adc     #>(_full)
+	tax
+	tya
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     _free
+	.dbg	line, "heapbench.c", 222
+L00FD:	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L00FF
+	cmp     #$00
+L00FF:	jsr     boolne
+	jne     L00FB
+	.dbg	line, "heapbench.c", 225
+	jsr     incsp4
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "avail", "00", auto, -2
+	.dbg	sym, "r", "00", auto, -3
+
+.segment	"CODE"
+
+	.dbg	line, "heapbench.c", 232
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	.dbg	line, "heapbench.c", 235
+	jsr     decsp1
+	lda     #<(_extra)
+	ldx     #>(_extra)
+	jsr     pushax
+	ldx     #$00
+	lda     #$C8
+	jsr     __heapadd
+	.dbg	line, "heapbench.c", 236
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	sta     (sp),y
+	jmp     L0109
+	.dbg	line, "heapbench.c", 237
+L010C:	jsr     _round
+	.dbg	line, "heapbench.c", 240
+	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$00
+	jsr     boolne
+	jeq     L0114
+	jsr     __heapmemavail
+	jsr     pushax
+	ldy     #$04
+	jsr     ldaxysp
+	jsr     tosneax
+	jne     L0113
+L0114:	ldx     #$00
+	lda     #$00
+	jeq     L0115
+L0113:	ldx     #$00
+	lda     #$01
+L0115:	jeq     L0112
+	.dbg	line, "heapbench.c", 241
+	lda     #<(L0117)
+	ldx     #>(L0117)
+	jsr     pushax
+	jsr     __heapmemavail
+	jsr     pushax
+	ldy     #$06
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "heapbench.c", 242
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "heapbench.c", 244
+L0112:	jsr     __heapmemavail
+	ldy     #$01
+	jsr     staxysp
+	.dbg	line, "heapbench.c", 245
+	jsr     __heapmaxavail
+	cpx     #$01
+	bne     L0120
+	cmp     #$2C
+L0120:	jsr     boolult
+	jne     L011F
+	jsr     __heapmaxavail
+	jsr     pushax
+	ldy     #$04
+	jsr     ldaxysp
+	jsr     tosugtax
+	jne     L011F
+	ldx     #$00
+	lda     #$00
+	jeq     L0121
+L011F:	ldx     #$00
+	lda     #$01
+L0121:	jeq     L011E
+	.dbg	line, "heapbench.c", 246
+	lda     #<(L0123)
+	ldx     #>(L0123)
+	jsr     pushax
+	jsr     __heapmaxavail
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "heapbench.c", 247
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "heapbench.c", 236
+L011E:	ldy     #$00
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+L0109:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$02
+	jsr     boolult
+	jne     L010C
+	.dbg	line, "heapbench.c", 250
+	jsr     _fillheap
+	.dbg	line, "heapbench.c", 259
+	lda     #<(L0129)
+	ldx     #>(L0129)
+	jsr     pushax
+	lda     _ops
+	ldx     _ops+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "heapbench.c", 260
+	lda     _failures
+	jeq     L012D
+	ldx     #$00
+	lda     #$01
+	jmp     L012F
+L012D:	ldx     #$00
+	lda     #$00
+L012F:	jmp     L0103
+	.dbg	line, "heapbench.c", 261
+L0103:	jsr     incsp3
+	rts
+	.dbg	line
+
+.endproc
+
@@ -0,0 +1,388 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_cc65_imul8x8r16
+	.import		_cc65_umul8x8r16
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+L0006:
+	.byte	$25,$75,$20,$25,$73,$20,$25,$75,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$25,$75,$0A,$00
+L002A:
+	.byte	$2A,$00
+L0040	:=	L002A+0
+L004B	:=	L002A+0
+L0059	:=	L002A+0
+L0021	:=	L002A+0
+
+; ---------------------------------------------------------------
+; void __near__ fail (__near__ const unsigned char *, unsigned int, unsigned int, unsigned int, unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fail: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     _failures
+	cmp     #$14
+	bcs     L0003
+	lda     #<(L0006)
+	ldx     #>(L0006)
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     pushwysp
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0D
+	jsr     pushwysp
+	ldy     #$0C
+	jsr     _printf
+	inc     _failures
+L0003:	ldy     #$0A
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ check_int (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_check_int: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     push0
+	jsr     push0
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     shlax4
+	jsr     shlax2
+	clc
+	adc     #$00
+	pha
+	txa
+	ldy     #$04
+	adc     (sp),y
+	tax
+	pla
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     shlax3
+	jsr     tossubax
+	sec
+	ldy     #$04
+	sbc     (sp),y
+	pha
+	txa
+	iny
+	sbc     (sp),y
+	tax
+	pla
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	jsr     decsp1
+	lda     #$00
+	tay
+	jmp     L0089
+L0019:	ldy     #$0C
+	jsr     pushwysp
+	ldy     #$0A
+	jsr     ldaxysp
+	jsr     tosumulax
+	ldy     #$05
+	cmp     (sp),y
+	bne     L008A
+	txa
+	iny
+	cmp     (sp),y
+	beq     L001E
+L008A:	lda     #<(L0021)
+	ldx     #>(L0021)
+	jsr     pushax
+	ldy     #$0E
+	jsr     pushwysp
+	ldy     #$0E
+	jsr     pushwysp
+	ldy     #$12
+	jsr     pushwysp
+	ldy     #$10
+	jsr     ldaxysp
+	jsr     tosumulax
+	jsr     pushax
+	ldy     #$0E
+	jsr     ldaxysp
+	jsr     _fail
+L001E:	ldy     #$04
+	jsr     pushwysp
+	ldy     #$0A
+	jsr     ldaxysp
+	jsr     tosmulax
+	ldy     #$05
+	cmp     (sp),y
+	bne     L008B
+	txa
+	iny
+	cmp     (sp),y
+	beq     L0027
+L008B:	lda     #<(L002A)
+	ldx     #>(L002A)
+	jsr     pushax
+	ldy     #$06
+	jsr     pushwysp
+	ldy     #$0E
+	jsr     pushwysp
+	ldy     #$0A
+	jsr     pushwysp
+	ldy     #$10
+	jsr     ldaxysp
+	jsr     tosmulax
+	jsr     pushax
+	ldy     #$0E
+	jsr     ldaxysp
+	jsr     _fail
+L0027:	ldy     #$04
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     addeqysp
+	ldy     #$07
+	ldx     #$01
+	lda     #$37
+	jsr     addeqysp
+	ldy     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+L0089:	sta     (sp),y
+	cmp     #$C8
+	jcc     L0019
+	ldy     #$0B
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ check_char (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_check_char: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	lda     #$00
+	jsr     pusha
+	jsr     push0
+	ldy     #$03
+	lda     (sp),y
+	jsr     pusha0
+L0038:	ldy     #$05
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$05
+	lda     (sp),y
+	jsr     _cc65_umul8x8r16
+	ldy     #$02
+	cmp     (sp),y
+	bne     L0090
+	txa
+	iny
+	cmp     (sp),y
+	beq     L003B
+L0090:	lda     #<(L0040)
+	ldx     #>(L0040)
+	jsr     pushax
+	ldy     #$07
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$08
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$0B
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$0B
+	lda     (sp),y
+	jsr     _cc65_umul8x8r16
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     _fail
+L003B:	jsr     pushw0sp
+	ldy     #$06
+	lda     (sp),y
+	jsr     tosumula0
+	ldy     #$02
+	cmp     (sp),y
+	bne     L0091
+	txa
+	iny
+	cmp     (sp),y
+	beq     L0048
+L0091:	lda     #<(L004B)
+	ldx     #>(L004B)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$08
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$0C
+	lda     (sp),y
+	jsr     tosumula0
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     _fail
+L0048:	ldy     #$05
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$05
+	lda     (sp),y
+	jsr     _cc65_imul8x8r16
+	jsr     pushax
+	ldy     #$07
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$80
+	bcc     L0056
+	dex
+L0056:	jsr     pushax
+	ldy     #$08
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0057
+	dex
+L0057:	jsr     tosmulax
+	jsr     tosicmp
+	beq     L0051
+	lda     #<(L0059)
+	ldx     #>(L0059)
+	jsr     pushax
+	ldy     #$07
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$08
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$0B
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$0B
+	lda     (sp),y
+	jsr     _cc65_imul8x8r16
+	jsr     pushax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$80
+	bcc     L0062
+	dex
+L0062:	jsr     pushax
+	ldy     #$0E
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0063
+	dex
+L0063:	jsr     tosmulax
+	jsr     _fail
+L0051:	ldy     #$05
+	lda     (sp),y
+	ldx     #$00
+	ldy     #$02
+	jsr     addeqysp
+	ldy     #$04
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	jne     L0038
+	jmp     incsp6
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     push0
+	jsr     decsp1
+	ldy     #$00
+	jmp     L0092
+L006C:	ldy     #$02
+	jsr     ldaxysp
+	jsr     _check_int
+	ldy     #$01
+	ldx     #$02
+	lda     #$8D
+	jsr     addeqysp
+	ldy     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+L0092:	sta     (sp),y
+	cmp     #$64
+	bcc     L006C
+	tya
+	jmp     L0093
+L0094:	lda     (sp),y
+	jsr     _check_char
+	ldy     #$00
+	clc
+	lda     #$0D
+	adc     (sp),y
+L0093:	sta     (sp),y
+	cmp     #$FA
+	bcc     L0094
+	lda     #$FF
+	jsr     _check_char
+	lda     _failures
+	beq     L0083
+	ldx     #$00
+	lda     #$01
+	jmp     incsp3
+L0083:	tax
+	jmp     incsp3
+
+.endproc
+
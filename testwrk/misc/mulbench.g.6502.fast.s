@@ -0,0 +1,538 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "mulbench.c", 2024, 1792386540
+	.dbg		file, "/root/repo/include/stdio.h", 6363, 1792382670
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1515150330
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1515150330
+	.dbg		file, "/root/repo/include/stdlib.h", 5748, 1515150330
+	.dbg		file, "/root/repo/include/cc65.h", 4900, 1515150330
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.dbg		sym, "cc65_imul8x8r16", "00", extern, "_cc65_imul8x8r16"
+	.dbg		sym, "cc65_umul8x8r16", "00", extern, "_cc65_umul8x8r16"
+	.import		_printf
+	.import		_cc65_imul8x8r16
+	.import		_cc65_umul8x8r16
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+L0006:
+	.byte	$25,$75,$20,$25,$73,$20,$25,$75,$20,$3D,$20,$25,$75,$2C,$20,$65
+	.byte	$78,$70,$65,$63,$74,$65,$64,$20,$25,$75,$0A,$00
+L002A:
+	.byte	$2A,$00
+L0040	:=	L002A+0
+L004B	:=	L002A+0
+L0059	:=	L002A+0
+L0021	:=	L002A+0
+
+; ---------------------------------------------------------------
+; void __near__ fail (__near__ const unsigned char *, unsigned int, unsigned int, unsigned int, unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fail: near
+
+	.dbg	func, "fail", "00", static, "_fail"
+	.dbg	sym, "op", "00", auto, 8
+	.dbg	sym, "a", "00", auto, 6
+	.dbg	sym, "b", "00", auto, 4
+	.dbg	sym, "got", "00", auto, 2
+	.dbg	sym, "expected", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "mulbench.c", 22
+	jsr     pushax
+	.dbg	line, "mulbench.c", 23
+	ldx     #$00
+	lda     _failures
+	cmp     #$14
+	jsr     boolult
+	jeq     L0003
+	.dbg	line, "mulbench.c", 24
+	lda     #<(L0006)
+	ldx     #>(L0006)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0C
+	jsr     _printf
+	.dbg	line, "mulbench.c", 25
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "mulbench.c", 27
+L0003:	ldy     #$0A
+	jsr     addysp
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ check_int (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_check_int: near
+
+	.dbg	func, "check_int", "00", static, "_check_int"
+	.dbg	sym, "a", "00", auto, 0
+	.dbg	sym, "b", "00", auto, -2
+	.dbg	sym, "p", "00", auto, -4
+	.dbg	sym, "q", "00", auto, -6
+	.dbg	sym, "s", "00", auto, -8
+	.dbg	sym, "i", "00", auto, -9
+
+.segment	"CODE"
+
+	.dbg	line, "mulbench.c", 30
+	jsr     pushax
+	.dbg	line, "mulbench.c", 31
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	.dbg	line, "mulbench.c", 32
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	.dbg	line, "mulbench.c", 33
+	ldy     #$05
+	jsr     ldaxysp
+	tax
+	lda     #$00
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     shlax4
+	jsr     shlax2
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     shlax3
+	jsr     tossubax
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tossubax
+	jsr     pushax
+	.dbg	line, "mulbench.c", 34
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	.dbg	line, "mulbench.c", 37
+	jsr     decsp1
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	sta     (sp),y
+	jmp     L0016
+	.dbg	line, "mulbench.c", 38
+L0019:	ldy     #$0A
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0A
+	jsr     ldaxysp
+	jsr     tosumulax
+	jsr     pushax
+	ldy     #$08
+	jsr     ldaxysp
+	jsr     tosneax
+	jeq     L001E
+	.dbg	line, "mulbench.c", 39
+	lda     #<(L0021)
+	ldx     #>(L0021)
+	jsr     pushax
+	ldy     #$0C
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0C
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$10
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$10
+	jsr     ldaxysp
+	jsr     tosumulax
+	jsr     pushax
+	ldy     #$0E
+	jsr     ldaxysp
+	jsr     _fail
+	.dbg	line, "mulbench.c", 41
+L001E:	ldy     #$02
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0A
+	jsr     ldaxysp
+	jsr     tosmulax
+	jsr     pushax
+	ldy     #$08
+	jsr     ldaxysp
+	jsr     tosneax
+	jeq     L0027
+	.dbg	line, "mulbench.c", 42
+	lda     #<(L002A)
+	ldx     #>(L002A)
+	jsr     pushax
+	ldy     #$04
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0C
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$08
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$10
+	jsr     ldaxysp
+	jsr     tosmulax
+	jsr     pushax
+	ldy     #$0E
+	jsr     ldaxysp
+	jsr     _fail
+	.dbg	line, "mulbench.c", 44
+L0027:	ldy     #$04
+	jsr     ldaxysp
+	ldy     #$05
+	jsr     addeqysp
+	.dbg	line, "mulbench.c", 45
+	ldy     #$07
+	ldx     #$01
+	lda     #$37
+	jsr     addeqysp
+	.dbg	line, "mulbench.c", 37
+	ldy     #$00
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+L0016:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$C8
+	jsr     boolult
+	jne     L0019
+	.dbg	line, "mulbench.c", 47
+	ldy     #$0B
+	jsr     addysp
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ check_char (unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_check_char: near
+
+	.dbg	func, "check_char", "00", static, "_check_char"
+	.dbg	sym, "a", "00", auto, 0
+	.dbg	sym, "b", "00", auto, -1
+	.dbg	sym, "p", "00", auto, -3
+	.dbg	sym, "x", "00", auto, -5
+
+.segment	"CODE"
+
+	.dbg	line, "mulbench.c", 50
+	jsr     pusha
+	.dbg	line, "mulbench.c", 51
+	lda     #$00
+	jsr     pusha
+	.dbg	line, "mulbench.c", 52
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	.dbg	line, "mulbench.c", 53
+	ldy     #$03
+	ldx     #$00
+	lda     (sp),y
+	ldx     #$00
+	jsr     pushax
+	.dbg	line, "mulbench.c", 56
+L0038:	ldy     #$05
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$05
+	lda     (sp),y
+	jsr     _cc65_umul8x8r16
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosneax
+	jeq     L003B
+	.dbg	line, "mulbench.c", 57
+	lda     #<(L0040)
+	ldx     #>(L0040)
+	jsr     pushax
+	ldy     #$07
+	ldx     #$00
+	lda     (sp),y
+	ldx     #$00
+	jsr     pushax
+	ldy     #$08
+	ldx     #$00
+	lda     (sp),y
+	ldx     #$00
+	jsr     pushax
+	ldy     #$0B
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$0B
+	lda     (sp),y
+	jsr     _cc65_umul8x8r16
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     _fail
+	.dbg	line, "mulbench.c", 59
+L003B:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$06
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosumulax
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosneax
+	jeq     L0048
+	.dbg	line, "mulbench.c", 60
+	lda     #<(L004B)
+	ldx     #>(L004B)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$08
+	ldx     #$00
+	lda     (sp),y
+	ldx     #$00
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0C
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosumulax
+	jsr     pushax
+	ldy     #$0B
+	jsr     ldaxysp
+	jsr     _fail
+	.dbg	line, "mulbench.c", 62
+L0048:	ldy     #$05
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$05
+	lda     (sp),y
+	jsr     _cc65_imul8x8r16
+	.dbg	line, "mulbench.c", 63
+	jsr     pushax
+	ldy     #$07
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0055
+	dex
+L0055:	ldx     #$00
+	cmp     #$80
+	bcc     L0056
+	dex
+L0056:	jsr     pushax
+	ldy     #$08
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0057
+	dex
+L0057:	jsr     tosmulax
+	jsr     tosneax
+	jeq     L0051
+	.dbg	line, "mulbench.c", 64
+	lda     #<(L0059)
+	ldx     #>(L0059)
+	jsr     pushax
+	ldy     #$07
+	ldx     #$00
+	lda     (sp),y
+	ldx     #$00
+	jsr     pushax
+	ldy     #$08
+	ldx     #$00
+	lda     (sp),y
+	ldx     #$00
+	jsr     pushax
+	ldy     #$0B
+	lda     (sp),y
+	jsr     pusha
+	ldy     #$0B
+	lda     (sp),y
+	jsr     _cc65_imul8x8r16
+	jsr     pushax
+	ldy     #$0D
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0061
+	dex
+L0061:	ldx     #$00
+	cmp     #$80
+	bcc     L0062
+	dex
+L0062:	jsr     pushax
+	ldy     #$0E
+	ldx     #$00
+	lda     (sp),y
+	bpl     L0063
+	dex
+L0063:	jsr     tosmulax
+	jsr     _fail
+	.dbg	line, "mulbench.c", 66
+L0051:	ldy     #$05
+	ldx     #$00
+	lda     (sp),y
+	ldx     #$00
+	ldy     #$02
+	jsr     addeqysp
+	.dbg	line, "mulbench.c", 67
+	ldy     #$04
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+	cmp     #$00
+	jsr     boolne
+	jne     L0038
+	.dbg	line, "mulbench.c", 68
+	jsr     incsp6
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "a", "00", auto, -2
+	.dbg	sym, "i", "00", auto, -3
+
+.segment	"CODE"
+
+	.dbg	line, "mulbench.c", 72
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	.dbg	line, "mulbench.c", 75
+	jsr     decsp1
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	sta     (sp),y
+	jmp     L0069
+	.dbg	line, "mulbench.c", 76
+L006C:	ldy     #$02
+	jsr     ldaxysp
+	jsr     _check_int
+	.dbg	line, "mulbench.c", 77
+	ldy     #$01
+	ldx     #$02
+	lda     #$8D
+	jsr     addeqysp
+	.dbg	line, "mulbench.c", 75
+	ldy     #$00
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+L0069:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$64
+	jsr     boolult
+	jne     L006C
+	.dbg	line, "mulbench.c", 79
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	sta     (sp),y
+	jmp     L0075
+	.dbg	line, "mulbench.c", 80
+L0078:	ldy     #$00
+	lda     (sp),y
+	jsr     _check_char
+	.dbg	line, "mulbench.c", 79
+	ldy     #$00
+	ldx     #$00
+	clc
+	lda     #$0D
+	adc     (sp),y
+	sta     (sp),y
+L0075:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$FA
+	jsr     boolult
+	jne     L0078
+	.dbg	line, "mulbench.c", 82
+	lda     #$FF
+	jsr     _check_char
+	.dbg	line, "mulbench.c", 84
+	lda     _failures
+	jeq     L0083
+	ldx     #$00
+	lda     #$01
+	jmp     L0085
+L0083:	ldx     #$00
+	lda     #$00
+L0085:	jmp     L0067
+	.dbg	line, "mulbench.c", 85
+L0067:	jsr     incsp3
+	rts
+	.dbg	line
+
+.endproc
+
@@ -0,0 +1,458 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_strcmp
+	.import		_decompress_lz4
+	.import		__PACKED_LOAD__
+	.import		__PACKED_RUN__
+	.import		__PACKED_SIZE__
+	.export		_packed_text
+	.export		_packed_squares
+	.export		_calls
+	.export		_packed_checksum
+	.export		_main
+
+.segment	"DATA"
+
+.segment	"PACKED"
+_packed_squares:
+	.byte	$00
+	.byte	$01
+	.byte	$04
+	.byte	$09
+	.byte	$10
+	.byte	$19
+	.byte	$24
+	.byte	$31
+	.byte	$40
+	.byte	$51
+	.byte	$64
+	.byte	$79
+	.byte	$90
+	.byte	$A9
+	.byte	$C4
+	.byte	$E1
+	.byte	$00
+	.byte	$01
+	.byte	$04
+	.byte	$09
+	.byte	$10
+	.byte	$19
+	.byte	$24
+	.byte	$31
+	.byte	$40
+	.byte	$51
+	.byte	$64
+	.byte	$79
+	.byte	$90
+	.byte	$A9
+	.byte	$C4
+	.byte	$E1
+.segment	"DATA"
+
+.segment	"RODATA"
+
+.segment	"PACKED"
+_packed_text:
+	.byte	$54,$68,$65,$20,$6C,$69,$6E,$6B,$65,$72,$20,$73,$74,$6F,$72,$65
+	.byte	$73,$20,$73,$65,$67,$6D,$65,$6E,$74,$73,$20,$77,$69,$74,$68,$20
+	.byte	$74,$68,$65,$20,$63,$6F,$6D,$70,$72,$65,$73,$73,$20,$61,$74,$74
+	.byte	$72,$69,$62,$75,$74,$65,$20,$69,$6E,$20,$74,$68,$65,$69,$72,$20
+	.byte	$6C,$6F,$61,$64,$20,$6D,$65,$6D,$6F,$72,$79,$20,$61,$72,$65,$61
+	.byte	$20,$61,$73,$20,$4C,$5A,$34,$20,$63,$6F,$6D,$70,$72,$65,$73,$73
+	.byte	$65,$64,$20,$64,$61,$74,$61,$2E,$20,$54,$68,$65,$20,$70,$72,$6F
+	.byte	$67,$72,$61,$6D,$20,$75,$6E,$70,$61,$63,$6B,$73,$20,$74,$68,$65
+	.byte	$6D,$20,$74,$6F,$20,$74,$68,$65,$20,$72,$75,$6E,$20,$6D,$65,$6D
+	.byte	$6F,$72,$79,$20,$61,$72,$65,$61,$20,$62,$65,$66,$6F,$72,$65,$20
+	.byte	$69,$74,$20,$75,$73,$65,$73,$20,$74,$68,$65,$6D,$2E,$20,$53,$69
+	.byte	$6E,$63,$65,$20,$6C,$6F,$61,$64,$20,$74,$69,$6D,$65,$73,$20,$66
+	.byte	$72,$6F,$6D,$20,$64,$69,$73,$6B,$20,$61,$6E,$64,$20,$74,$61,$70
+	.byte	$65,$20,$61,$72,$65,$20,$64,$6F,$6D,$69,$6E,$61,$74,$65,$64,$20
+	.byte	$62,$79,$20,$74,$68,$65,$20,$6E,$75,$6D,$62,$65,$72,$20,$6F,$66
+	.byte	$20,$62,$79,$74,$65,$73,$20,$74,$72,$61,$6E,$73,$66,$65,$72,$72
+	.byte	$65,$64,$2C,$20,$61,$20,$73,$6D,$61,$6C,$6C,$65,$72,$20,$70,$72
+	.byte	$6F,$67,$72,$61,$6D,$20,$66,$69,$6C,$65,$20,$6C,$6F,$61,$64,$73
+	.byte	$20,$66,$61,$73,$74,$65,$72,$2C,$20,$65,$76,$65,$6E,$20,$69,$66
+	.byte	$20,$69,$74,$20,$68,$61,$73,$20,$74,$6F,$20,$62,$65,$20,$75,$6E
+	.byte	$70,$61,$63,$6B,$65,$64,$20,$61,$66,$74,$65,$72,$77,$61,$72,$64
+	.byte	$73,$2E,$20,$54,$65,$78,$74,$20,$6C,$69,$6B,$65,$20,$74,$68,$69
+	.byte	$73,$20,$6F,$6E,$65,$20,$63,$6F,$6D,$70,$72,$65,$73,$73,$65,$73
+	.byte	$20,$77,$65,$6C,$6C,$2C,$20,$62,$65,$63,$61,$75,$73,$65,$20,$6D
+	.byte	$61,$6E,$79,$20,$77,$6F,$72,$64,$73,$20,$61,$6E,$64,$20,$70,$68
+	.byte	$72,$61,$73,$65,$73,$20,$6F,$63,$63,$75,$72,$20,$6D,$6F,$72,$65
+	.byte	$20,$74,$68,$61,$6E,$20,$6F,$6E,$63,$65,$2C,$20,$61,$6E,$64,$20
+	.byte	$62,$65,$63,$61,$75,$73,$65,$20,$74,$68,$65,$20,$73,$61,$6D,$65
+	.byte	$20,$6C,$65,$74,$74,$65,$72,$73,$20,$6F,$63,$63,$75,$72,$20,$61
+	.byte	$67,$61,$69,$6E,$20,$61,$6E,$64,$20,$61,$67,$61,$69,$6E,$2E,$20
+	.byte	$43,$6F,$64,$65,$20,$63,$6F,$6D,$70,$72,$65,$73,$73,$65,$73,$20
+	.byte	$6C,$65,$73,$73,$20,$77,$65,$6C,$6C,$2C,$20,$62,$75,$74,$20,$74
+	.byte	$68,$65,$20,$6F,$70,$63,$6F,$64,$65,$73,$20,$6F,$66,$20,$6C,$6F
+	.byte	$61,$64,$73,$2C,$20,$73,$74,$6F,$72,$65,$73,$20,$61,$6E,$64,$20
+	.byte	$62,$72,$61,$6E,$63,$68,$65,$73,$2C,$20,$61,$6E,$64,$20,$74,$68
+	.byte	$65,$20,$61,$64,$64,$72,$65,$73,$73,$65,$73,$20,$6F,$66,$20,$76
+	.byte	$61,$72,$69,$61,$62,$6C,$65,$73,$20,$61,$6E,$64,$20,$73,$75,$62
+	.byte	$72,$6F,$75,$74,$69,$6E,$65,$73,$2C,$20,$72,$65,$70,$65,$61,$74
+	.byte	$20,$6F,$66,$74,$65,$6E,$20,$65,$6E,$6F,$75,$67,$68,$20,$74,$6F
+	.byte	$20,$73,$61,$76,$65,$20,$61,$62,$6F,$75,$74,$20,$61,$20,$74,$68
+	.byte	$69,$72,$64,$20,$6F,$66,$20,$74,$68,$65,$20,$73,$69,$7A,$65,$20
+	.byte	$69,$6E,$20,$6D,$6F,$73,$74,$20,$70,$72,$6F,$67,$72,$61,$6D,$73
+	.byte	$2E,$20,$54,$68,$65,$20,$6C,$69,$6E,$6B,$65,$72,$20,$73,$74,$6F
+	.byte	$72,$65,$73,$20,$73,$65,$67,$6D,$65,$6E,$74,$73,$20,$77,$69,$74
+	.byte	$68,$20,$74,$68,$65,$20,$63,$6F,$6D,$70,$72,$65,$73,$73,$20,$61
+	.byte	$74,$74,$72,$69,$62,$75,$74,$65,$20,$69,$6E,$20,$74,$68,$65,$69
+	.byte	$72,$20,$6C,$6F,$61,$64,$20,$6D,$65,$6D,$6F,$72,$79,$20,$61,$72
+	.byte	$65,$61,$20,$61,$73,$20,$4C,$5A,$34,$20,$63,$6F,$6D,$70,$72,$65
+	.byte	$73,$73,$65,$64,$20,$64,$61,$74,$61,$2C,$20,$61,$6E,$64,$20,$74
+	.byte	$68,$65,$20,$70,$72,$6F,$67,$72,$61,$6D,$20,$75,$6E,$70,$61,$63
+	.byte	$6B,$73,$20,$74,$68,$65,$6D,$2E,$00
+.segment	"RODATA"
+_ref_text:
+	.byte	$54,$68,$65,$20,$6C,$69,$6E,$6B,$65,$72,$20,$73,$74,$6F,$72,$65
+	.byte	$73,$20,$73,$65,$67,$6D,$65,$6E,$74,$73,$20,$77,$69,$74,$68,$20
+	.byte	$74,$68,$65,$20,$63,$6F,$6D,$70,$72,$65,$73,$73,$20,$61,$74,$74
+	.byte	$72,$69,$62,$75,$74,$65,$20,$69,$6E,$20,$74,$68,$65,$69,$72,$20
+	.byte	$6C,$6F,$61,$64,$20,$6D,$65,$6D,$6F,$72,$79,$20,$61,$72,$65,$61
+	.byte	$20,$61,$73,$20,$4C,$5A,$34,$20,$63,$6F,$6D,$70,$72,$65,$73,$73
+	.byte	$65,$64,$20,$64,$61,$74,$61,$2E,$20,$54,$68,$65,$20,$70,$72,$6F
+	.byte	$67,$72,$61,$6D,$20,$75,$6E,$70,$61,$63,$6B,$73,$20,$74,$68,$65
+	.byte	$6D,$20,$74,$6F,$20,$74,$68,$65,$20,$72,$75,$6E,$20,$6D,$65,$6D
+	.byte	$6F,$72,$79,$20,$61,$72,$65,$61,$20,$62,$65,$66,$6F,$72,$65,$20
+	.byte	$69,$74,$20,$75,$73,$65,$73,$20,$74,$68,$65,$6D,$2E,$20,$53,$69
+	.byte	$6E,$63,$65,$20,$6C,$6F,$61,$64,$20,$74,$69,$6D,$65,$73,$20,$66
+	.byte	$72,$6F,$6D,$20,$64,$69,$73,$6B,$20,$61,$6E,$64,$20,$74,$61,$70
+	.byte	$65,$20,$61,$72,$65,$20,$64,$6F,$6D,$69,$6E,$61,$74,$65,$64,$20
+	.byte	$62,$79,$20,$74,$68,$65,$20,$6E,$75,$6D,$62,$65,$72,$20,$6F,$66
+	.byte	$20,$62,$79,$74,$65,$73,$20,$74,$72,$61,$6E,$73,$66,$65,$72,$72
+	.byte	$65,$64,$2C,$20,$61,$20,$73,$6D,$61,$6C,$6C,$65,$72,$20,$70,$72
+	.byte	$6F,$67,$72,$61,$6D,$20,$66,$69,$6C,$65,$20,$6C,$6F,$61,$64,$73
+	.byte	$20,$66,$61,$73,$74,$65,$72,$2C,$20,$65,$76,$65,$6E,$20,$69,$66
+	.byte	$20,$69,$74,$20,$68,$61,$73,$20,$74,$6F,$20,$62,$65,$20,$75,$6E
+	.byte	$70,$61,$63,$6B,$65,$64,$20,$61,$66,$74,$65,$72,$77,$61,$72,$64
+	.byte	$73,$2E,$20,$54,$65,$78,$74,$20,$6C,$69,$6B,$65,$20,$74,$68,$69
+	.byte	$73,$20,$6F,$6E,$65,$20,$63,$6F,$6D,$70,$72,$65,$73,$73,$65,$73
+	.byte	$20,$77,$65,$6C,$6C,$2C,$20,$62,$65,$63,$61,$75,$73,$65,$20,$6D
+	.byte	$61,$6E,$79,$20,$77,$6F,$72,$64,$73,$20,$61,$6E,$64,$20,$70,$68
+	.byte	$72,$61,$73,$65,$73,$20,$6F,$63,$63,$75,$72,$20,$6D,$6F,$72,$65
+	.byte	$20,$74,$68,$61,$6E,$20,$6F,$6E,$63,$65,$2C,$20,$61,$6E,$64,$20
+	.byte	$62,$65,$63,$61,$75,$73,$65,$20,$74,$68,$65,$20,$73,$61,$6D,$65
+	.byte	$20,$6C,$65,$74,$74,$65,$72,$73,$20,$6F,$63,$63,$75,$72,$20,$61
+	.byte	$67,$61,$69,$6E,$20,$61,$6E,$64,$20,$61,$67,$61,$69,$6E,$2E,$20
+	.byte	$43,$6F,$64,$65,$20,$63,$6F,$6D,$70,$72,$65,$73,$73,$65,$73,$20
+	.byte	$6C,$65,$73,$73,$20,$77,$65,$6C,$6C,$2C,$20,$62,$75,$74,$20,$74
+	.byte	$68,$65,$20,$6F,$70,$63,$6F,$64,$65,$73,$20,$6F,$66,$20,$6C,$6F
+	.byte	$61,$64,$73,$2C,$20,$73,$74,$6F,$72,$65,$73,$20,$61,$6E,$64,$20
+	.byte	$62,$72,$61,$6E,$63,$68,$65,$73,$2C,$20,$61,$6E,$64,$20,$74,$68
+	.byte	$65,$20,$61,$64,$64,$72,$65,$73,$73,$65,$73,$20,$6F,$66,$20,$76
+	.byte	$61,$72,$69,$61,$62,$6C,$65,$73,$20,$61,$6E,$64,$20,$73,$75,$62
+	.byte	$72,$6F,$75,$74,$69,$6E,$65,$73,$2C,$20,$72,$65,$70,$65,$61,$74
+	.byte	$20,$6F,$66,$74,$65,$6E,$20,$65,$6E,$6F,$75,$67,$68,$20,$74,$6F
+	.byte	$20,$73,$61,$76,$65,$20,$61,$62,$6F,$75,$74,$20,$61,$20,$74,$68
+	.byte	$69,$72,$64,$20,$6F,$66,$20,$74,$68,$65,$20,$73,$69,$7A,$65,$20
+	.byte	$69,$6E,$20,$6D,$6F,$73,$74,$20,$70,$72,$6F,$67,$72,$61,$6D,$73
+	.byte	$2E,$20,$54,$68,$65,$20,$6C,$69,$6E,$6B,$65,$72,$20,$73,$74,$6F
+	.byte	$72,$65,$73,$20,$73,$65,$67,$6D,$65,$6E,$74,$73,$20,$77,$69,$74
+	.byte	$68,$20,$74,$68,$65,$20,$63,$6F,$6D,$70,$72,$65,$73,$73,$20,$61
+	.byte	$74,$74,$72,$69,$62,$75,$74,$65,$20,$69,$6E,$20,$74,$68,$65,$69
+	.byte	$72,$20,$6C,$6F,$61,$64,$20,$6D,$65,$6D,$6F,$72,$79,$20,$61,$72
+	.byte	$65,$61,$20,$61,$73,$20,$4C,$5A,$34,$20,$63,$6F,$6D,$70,$72,$65
+	.byte	$73,$73,$65,$64,$20,$64,$61,$74,$61,$2C,$20,$61,$6E,$64,$20,$74
+	.byte	$68,$65,$20,$70,$72,$6F,$67,$72,$61,$6D,$20,$75,$6E,$70,$61,$63
+	.byte	$6B,$73,$20,$74,$68,$65,$6D,$2E,$00
+L0075:
+	.byte	$63,$68,$65,$63,$6B,$73,$75,$6D,$20,$69,$73,$20,$25,$75,$2C,$20
+	.byte	$65,$78,$70,$65,$63,$74,$65,$64,$20,$25,$75,$0A,$00
+L0069:
+	.byte	$73,$71,$75,$61,$72,$65,$20,$25,$75,$20,$69,$73,$20,$25,$75,$0A
+	.byte	$00
+L0055:
+	.byte	$74,$65,$78,$74,$20,$64,$69,$66,$66,$65,$72,$73,$0A,$00
+L0080:
+	.byte	$63,$61,$6C,$6C,$73,$20,$69,$73,$20,$25,$75,$0A,$00
+
+.segment	"BSS"
+
+_calls:
+	.res	2,$00
+
+; ---------------------------------------------------------------
+; unsigned int __near__ packed_checksum (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"PACKED"
+
+.proc	_packed_checksum: near
+
+.segment	"PACKED"
+
+	jsr     pushax
+	jsr     push0
+	inc     _calls
+	bne     L002B
+	inc     _calls+1
+	jmp     L002B
+L0029:	ldy     #$01
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	jsr     pushax
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     regsave
+	stx     regsave+1
+	clc
+	adc     #$01
+	bcc     L0030
+	inx
+L0030:	jsr     staxysp
+	ldx     #$00
+	lda     (regsave,x)
+	jsr     tosxora0
+	jsr     stax0sp
+L002B:	ldy     #$03
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	bne     L0029
+	iny
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ checksum (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_checksum: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     push0
+	jmp     L003A
+L0038:	ldy     #$01
+	lda     (sp),y
+	sta     tmp1
+	dey
+	lda     (sp),y
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	jsr     pushax
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     regsave
+	stx     regsave+1
+	clc
+	adc     #$01
+	bcc     L003F
+	inx
+L003F:	jsr     staxysp
+	ldx     #$00
+	lda     (regsave,x)
+	jsr     tosxora0
+	jsr     stax0sp
+L003A:	ldy     #$03
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$00
+	lda     (ptr1),y
+	bne     L0038
+	iny
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #$00
+	jsr     pusha
+	jsr     decsp1
+	tay
+	jmp     L0089
+L0046:	jsr     decsp4
+	lda     #<(__PACKED_LOAD__)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(__PACKED_LOAD__)
+	sta     (sp),y
+	lda     #<(__PACKED_RUN__)
+	ldy     #$00
+	sta     (sp),y
+	iny
+	lda     #>(__PACKED_RUN__)
+	sta     (sp),y
+	lda     #<(__PACKED_SIZE__)
+	ldx     #>(__PACKED_SIZE__)
+	jsr     _decompress_lz4
+	ldy     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+L0089:	sta     (sp),y
+	cmp     #$0B
+	bcc     L0046
+	lda     #<(_packed_text)
+	ldx     #>(_packed_text)
+	jsr     pushax
+	lda     #<(_ref_text)
+	ldx     #>(_ref_text)
+	jsr     _strcmp
+	cpx     #$00
+	bne     L008C
+	cmp     #$00
+	beq     L008E
+L008C:	lda     #<(L0055)
+	ldx     #>(L0055)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+	lda     #$00
+L008E:	tay
+	jmp     L008A
+L008B:	lda     (sp),y
+	tay
+	lda     _packed_squares,y
+	jsr     pusha0
+	ldy     #$02
+	lda     (sp),y
+	and     #$0F
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	and     #$0F
+	jsr     tosumula0
+	jsr     tosicmp0
+	beq     L0061
+	lda     #<(L0069)
+	ldx     #>(L0069)
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	jsr     pusha0
+	ldy     #$04
+	lda     (sp),y
+	tay
+	lda     _packed_squares,y
+	jsr     pusha0
+	ldy     #$06
+	jsr     _printf
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+L0061:	ldy     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+L008A:	sta     (sp),y
+	cmp     #$20
+	bcc     L008B
+	lda     #<(_ref_text)
+	ldx     #>(_ref_text)
+	jsr     _packed_checksum
+	jsr     pushax
+	lda     #<(_ref_text)
+	ldx     #>(_ref_text)
+	jsr     _checksum
+	jsr     tosicmp
+	beq     L0070
+	lda     #<(L0075)
+	ldx     #>(L0075)
+	jsr     pushax
+	lda     #<(_ref_text)
+	ldx     #>(_ref_text)
+	jsr     _packed_checksum
+	jsr     pushax
+	lda     #<(_ref_text)
+	ldx     #>(_ref_text)
+	jsr     _checksum
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+L0070:	lda     _calls+1
+	bne     L008D
+	lda     _calls
+	cmp     #$01
+	beq     L007C
+L008D:	lda     #<(L0080)
+	ldx     #>(L0080)
+	jsr     pushax
+	lda     _calls
+	ldx     _calls+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldy     #$01
+	clc
+	tya
+	adc     (sp),y
+	sta     (sp),y
+L007C:	ldy     #$01
+	lda     (sp),y
+	beq     L0085
+	ldx     #$00
+	tya
+	jmp     incsp2
+L0085:	tax
+	jmp     incsp2
+
+.endproc
+
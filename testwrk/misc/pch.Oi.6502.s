@@ -0,0 +1,116 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_strlen
+	.export		_counter
+	.export		_main
+
+.segment	"DATA"
+
+_counter:
+	.word	$0005
+
+.segment	"RODATA"
+
+L0012:
+	.byte	$46,$61,$69,$6C,$65,$64,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ twice (int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_twice: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp4
+	lda     _counter
+	ldx     _counter+1
+	jsr     _twice
+	jsr     stax0sp
+	ldy     #$02
+	lda     #$03
+	sta     (sp),y
+	lda     #$00
+	iny
+	sta     (sp),y
+	tay
+	lda     (sp),y
+	ldy     #$02
+	clc
+	adc     (sp),y
+	pha
+	dey
+	lda     (sp),y
+	ldy     #$03
+	adc     (sp),y
+	tax
+	pla
+	cpx     #$00
+	bne     L0017
+	cmp     #$0D
+	beq     L0018
+L0017:	lda     #<(L0012)
+	ldx     #>(L0012)
+	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	ldy     #$04
+	clc
+	adc     (sp),y
+	pha
+	dey
+	lda     (sp),y
+	ldy     #$05
+	adc     (sp),y
+	tax
+	pla
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     incsp4
+L0018:	txa
+	jmp     incsp4
+
+.endproc
+
@@ -0,0 +1,103 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.import		_strlen
+	.export		_counter
+	.export		_main
+
+.segment	"DATA"
+
+_counter:
+	.word	$0005
+
+.segment	"RODATA"
+
+L0012:
+	.byte	$46,$61,$69,$6C,$65,$64,$3A,$20,$25,$64,$0A,$00
+
+; ---------------------------------------------------------------
+; int __near__ twice (int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_twice: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp2
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax1
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	jsr     decsp4
+	lda     _counter
+	ldx     _counter+1
+	jsr     _twice
+	jsr     stax0sp
+	ldx     #$00
+	lda     #$03
+	ldy     #$02
+	jsr     staxysp
+	clc
+	adc     (sp)
+	pha
+	txa
+	ldy     #$01
+	adc     (sp),y
+	tax
+	pla
+	cpx     #$00
+	bne     L0017
+	cmp     #$0D
+	beq     L0018
+L0017:	lda     #<(L0012)
+	ldx     #>(L0012)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	clc
+	ldy     #$02
+	adc     (sp),y
+	pha
+	txa
+	iny
+	adc     (sp),y
+	tax
+	pla
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     incsp4
+L0018:	txa
+	jmp     incsp4
+
+.endproc
+
@@ -0,0 +1,135 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "pch.c", 719, 1792385221
+	.dbg		file, "pch.h", 498, 1792385221
+	.dbg		file, "/root/repo/include/stdio.h", 6363, 1792382670
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1515150330
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1515150330
+	.dbg		file, "/root/repo/include/stdlib.h", 5748, 1515150330
+	.dbg		file, "/root/repo/include/string.h", 5041, 1515150330
+	.dbg		file, "pchonce.h", 210, 1792385221
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.dbg		sym, "strlen", "00", extern, "_strlen"
+	.import		_printf
+	.import		_strlen
+	.export		_counter
+	.export		_main
+
+.segment	"DATA"
+
+_counter:
+	.word	$0005
+
+.segment	"RODATA"
+
+L0012:
+	.byte	$46,$61,$69,$6C,$65,$64,$3A,$20,$25,$64,$0A,$00
+L000C:
+	.byte	$61,$62,$63,$00
+
+; ---------------------------------------------------------------
+; int __near__ twice (int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_twice: near
+
+	.dbg	func, "twice", "00", static, "_twice"
+	.dbg	sym, "x", "00", auto, 0
+	.dbg	sym, "unused", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "pch.h", 23
+	jsr     pushax
+	.dbg	line, "pch.h", 25
+	jsr     decsp2
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     aslax1
+	jmp     L0001
+	.dbg	line, "pch.h", 26
+L0001:	jsr     incsp4
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "p", "00", auto, -4
+
+.segment	"CODE"
+
+	.dbg	line, "pch.c", 25
+	jsr     decsp4
+	lda     _counter
+	ldx     _counter+1
+	jsr     _twice
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "pch.c", 26
+	lda     #<(L000C)
+	ldx     #>(L000C)
+	jsr     _strlen
+	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "pch.c", 27
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     tosaddax
+	cpx     #$00
+	bne     L0010
+	cmp     #$0D
+L0010:	jsr     boolne
+	jeq     L000E
+	.dbg	line, "pch.c", 28
+	lda     #<(L0012)
+	ldx     #>(L0012)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "pch.c", 29
+	ldx     #$00
+	lda     #$01
+	jmp     L0006
+	.dbg	line, "pch.c", 31
+L000E:	ldx     #$00
+	lda     #$00
+	jmp     L0006
+	.dbg	line, "pch.c", 32
+L0006:	jsr     incsp4
+	rts
+	.dbg	line
+
+.endproc
+
@@ -0,0 +1,434 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+L0063:
+	.byte	$61,$70,$70,$6C,$79,$28,$74,$6F,$70,$2C,$20,$25,$75,$29,$20,$3D
+	.byte	$20,$25,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$25,$75
+	.byte	$0A,$00
+L0073:
+	.byte	$66,$61,$63,$74,$28,$37,$29,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$35,$30,$34,$30,$0A,$00
+L0053:
+	.byte	$74,$6F,$70,$28,$25,$75,$29,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$25,$75,$0A,$00
+
+.segment	"BSS"
+
+L007D:
+	.res	18,$00
+L0003	:=	L007D+4
+L0005	:=	L007D+6
+L0012	:=	L007D+4
+L0014	:=	L007D+6
+L0018	:=	L007D+0
+L001B	:=	L007D+2
+L0020	:=	L007D+8
+L0022	:=	L007D+10
+L0028	:=	L007D+12
+L002B	:=	L007D+14
+L003B	:=	L007D+0
+L003D	:=	L007D+2
+L0043	:=	L007D+16
+
+; ---------------------------------------------------------------
+; unsigned int __near__ leaf1 (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_leaf1: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	jsr     mulax3
+	sta     L0003
+	stx     L0003+1
+	stz     L0005
+	bra     L007F
+L007E:	lda     L0005
+	clc
+	adc     L0003
+	sta     L0003
+	lda     #$00
+	adc     L0003+1
+	sta     L0003+1
+	inc     L0005
+L007F:	lda     L0005
+	cmp     #$03
+	bcc     L007E
+	lda     L0003
+	ldx     L0003+1
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ leaf2 (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_leaf2: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	jsr     incax7
+	sta     L0012
+	stx     L0012+1
+	jsr     shlax1
+	sta     L0014
+	stx     L0014+1
+	lda     L0012
+	clc
+	adc     L0014
+	pha
+	lda     L0012+1
+	adc     L0014+1
+	tax
+	pla
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ mid (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_mid: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	jsr     _leaf1
+	sta     L0018
+	stx     L0018+1
+	jsr     ldax0sp
+	jsr     _leaf2
+	sta     L001B
+	stx     L001B+1
+	lda     L001B
+	eor     L0018
+	pha
+	lda     L001B+1
+	eor     L0018+1
+	tax
+	pla
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ top (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_top: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	sta     L0020
+	stx     L0020+1
+	jsr     _mid
+	jsr     pushax
+	lda     L0020
+	ldx     L0020+1
+	jsr     _leaf1
+	jsr     tosaddax
+	sta     L0022
+	stx     L0022+1
+	clc
+	adc     L0020
+	pha
+	txa
+	adc     L0020+1
+	tax
+	pla
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ apply (__near__ __near__ function returning unsigned int *, unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_apply: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	ina
+	bne     L002A
+	inx
+L002A:	sta     L0028
+	stx     L0028+1
+	ldy     #$05
+	jsr     pushwysp
+	lda     L0028
+	ldx     L0028+1
+	pha
+	lda     (sp)
+	sta     jmpvec+1
+	ldy     #$01
+	lda     (sp),y
+	sta     jmpvec+2
+	pla
+	jsr     jmpvec
+	jsr     incsp2
+	sta     L002B
+	stx     L002B+1
+	clc
+	adc     L0028
+	pha
+	txa
+	adc     L0028+1
+	tax
+	pla
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ fact (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fact: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     pushw0sp
+	ldy     #$01
+	lda     (sp),y
+	cmp     #$00
+	bne     L0033
+	lda     (sp)
+	cmp     #$02
+L0033:	bcs     L0034
+	ldx     #$00
+	tya
+	jmp     incsp4
+L0034:	jsr     pushw0sp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     decax1
+	jsr     _fact
+	jsr     tosumulax
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ ref (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_ref: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	jsr     mulax3
+	jsr     incax3
+	sta     L003B
+	stx     L003B+1
+	jsr     ldax0sp
+	jsr     incax7
+	jsr     mulax3
+	sta     L003D
+	stx     L003D+1
+	lda     L003D
+	eor     L003B
+	pha
+	lda     L003D+1
+	eor     L003B+1
+	tax
+	pla
+	clc
+	adc     L003B
+	sta     ptr1
+	txa
+	adc     L003B+1
+	sta     ptr1+1
+	jsr     ldax0sp
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	stz     L0043
+	stz     L0043+1
+	jmp     L0044
+L0047:	lda     L0043
+	ldx     L0043+1
+	jsr     _top
+	jsr     pushax
+	lda     L0043
+	ldx     L0043+1
+	jsr     _ref
+	jsr     tosicmp
+	beq     L004E
+	lda     #<(L0053)
+	ldx     #>(L0053)
+	jsr     pushax
+	lda     L0043
+	ldx     L0043+1
+	jsr     pushax
+	lda     L0043
+	ldx     L0043+1
+	jsr     _top
+	jsr     pushax
+	lda     L0043
+	ldx     L0043+1
+	jsr     _ref
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	inc     _failures
+L004E:	lda     #<(_top)
+	ldx     #>(_top)
+	jsr     pushax
+	lda     L0043
+	ldx     L0043+1
+	jsr     _apply
+	jsr     pushax
+	lda     L0043
+	ldx     L0043+1
+	ina
+	bne     L0060
+	inx
+L0060:	jsr     _ref
+	clc
+	adc     L0043
+	pha
+	txa
+	adc     L0043+1
+	tax
+	pla
+	ina
+	bne     L0061
+	inx
+L0061:	jsr     tosicmp
+	beq     L005B
+	lda     #<(L0063)
+	ldx     #>(L0063)
+	jsr     pushax
+	lda     L0043
+	ldx     L0043+1
+	jsr     pushax
+	lda     #<(_top)
+	ldx     #>(_top)
+	jsr     pushax
+	lda     L0043
+	ldx     L0043+1
+	jsr     _apply
+	jsr     pushax
+	lda     L0043
+	ldx     L0043+1
+	ina
+	bne     L006B
+	inx
+L006B:	jsr     _ref
+	clc
+	adc     L0043
+	pha
+	txa
+	adc     L0043+1
+	tax
+	pla
+	ina
+	bne     L006C
+	inx
+L006C:	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	inc     _failures
+L005B:	inc     L0043
+	bne     L0044
+	inc     L0043+1
+L0044:	lda     L0043+1
+	cmp     #$01
+	bne     L004B
+	lda     L0043
+	cmp     #$2C
+L004B:	jcc     L0047
+	ldx     #$00
+	lda     #$07
+	jsr     _fact
+	cpx     #$13
+	bne     L0080
+	cmp     #$B0
+	beq     L006E
+L0080:	lda     #<(L0073)
+	ldx     #>(L0073)
+	jsr     pushax
+	ldx     #$00
+	lda     #$07
+	jsr     _fact
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L006E:	lda     _failures
+	beq     L0079
+	ldx     #$00
+	lda     #$01
+	rts
+L0079:	ldx     #$00
+	txa
+	rts
+
+.endproc
+
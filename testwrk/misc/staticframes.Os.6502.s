@@ -0,0 +1,428 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+L0060:
+	.byte	$61,$70,$70,$6C,$79,$28,$74,$6F,$70,$2C,$20,$25,$75,$29,$20,$3D
+	.byte	$20,$25,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$25,$75
+	.byte	$0A,$00
+L006E:
+	.byte	$66,$61,$63,$74,$28,$37,$29,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$35,$30,$34,$30,$0A,$00
+L0052:
+	.byte	$74,$6F,$70,$28,$25,$75,$29,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$25,$75,$0A,$00
+
+.segment	"BSS"
+
+L0078:
+	.res	18,$00
+L0003	:=	L0078+4
+L0005	:=	L0078+6
+L0012	:=	L0078+4
+L0014	:=	L0078+6
+L0018	:=	L0078+0
+L001B	:=	L0078+2
+L0020	:=	L0078+8
+L0022	:=	L0078+10
+L0028	:=	L0078+12
+L002A	:=	L0078+14
+L003A	:=	L0078+0
+L003C	:=	L0078+2
+L0042	:=	L0078+16
+
+; ---------------------------------------------------------------
+; unsigned int __near__ leaf1 (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_leaf1: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	jsr     mulax3
+	sta     L0003
+	stx     L0003+1
+	lda     #$00
+	sta     L0005
+	jmp     L007A
+L0079:	lda     L0005
+	clc
+	adc     L0003
+	sta     L0003
+	lda     #$00
+	adc     L0003+1
+	sta     L0003+1
+	inc     L0005
+L007A:	lda     L0005
+	cmp     #$03
+	bcc     L0079
+	lda     L0003
+	ldx     L0003+1
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ leaf2 (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_leaf2: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	jsr     incax7
+	sta     L0012
+	stx     L0012+1
+	jsr     shlax1
+	sta     L0014
+	stx     L0014+1
+	lda     L0012
+	clc
+	adc     L0014
+	pha
+	lda     L0012+1
+	adc     L0014+1
+	tax
+	pla
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ mid (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_mid: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	jsr     _leaf1
+	sta     L0018
+	stx     L0018+1
+	jsr     ldax0sp
+	jsr     _leaf2
+	sta     L001B
+	stx     L001B+1
+	lda     L001B
+	eor     L0018
+	pha
+	lda     L001B+1
+	eor     L0018+1
+	tax
+	pla
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ top (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_top: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	sta     L0020
+	stx     L0020+1
+	jsr     _mid
+	jsr     pushax
+	lda     L0020
+	ldx     L0020+1
+	jsr     _leaf1
+	jsr     tosaddax
+	sta     L0022
+	stx     L0022+1
+	clc
+	adc     L0020
+	pha
+	txa
+	adc     L0020+1
+	tax
+	pla
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ apply (__near__ __near__ function returning unsigned int *, unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_apply: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	jsr     incax1
+	sta     L0028
+	stx     L0028+1
+	ldy     #$05
+	jsr     pushwysp
+	lda     L0028
+	ldx     L0028+1
+	pha
+	ldy     #$00
+	lda     (sp),y
+	sta     jmpvec+1
+	iny
+	lda     (sp),y
+	sta     jmpvec+2
+	pla
+	jsr     jmpvec
+	jsr     incsp2
+	sta     L002A
+	stx     L002A+1
+	clc
+	adc     L0028
+	pha
+	txa
+	adc     L0028+1
+	tax
+	pla
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ fact (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fact: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     pushw0sp
+	ldy     #$01
+	lda     (sp),y
+	cmp     #$00
+	bne     L0032
+	dey
+	lda     (sp),y
+	cmp     #$02
+L0032:	bcs     L0033
+	ldx     #$00
+	lda     #$01
+	jmp     incsp4
+L0033:	jsr     pushw0sp
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     decax1
+	jsr     _fact
+	jsr     tosumulax
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ ref (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_ref: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     ldax0sp
+	jsr     mulax3
+	jsr     incax3
+	sta     L003A
+	stx     L003A+1
+	jsr     ldax0sp
+	jsr     incax7
+	jsr     mulax3
+	sta     L003C
+	stx     L003C+1
+	lda     L003C
+	eor     L003A
+	pha
+	lda     L003C+1
+	eor     L003A+1
+	tax
+	pla
+	clc
+	adc     L003A
+	sta     ptr1
+	txa
+	adc     L003A+1
+	sta     ptr1+1
+	jsr     ldax0sp
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     #$00
+	sta     L0042
+	sta     L0042+1
+	jmp     L0043
+L0046:	lda     L0042
+	ldx     L0042+1
+	jsr     _top
+	jsr     pushax
+	lda     L0042
+	ldx     L0042+1
+	jsr     _ref
+	jsr     tosicmp
+	beq     L004D
+	lda     #<(L0052)
+	ldx     #>(L0052)
+	jsr     pushax
+	lda     L0042
+	ldx     L0042+1
+	jsr     pushax
+	lda     L0042
+	ldx     L0042+1
+	jsr     _top
+	jsr     pushax
+	lda     L0042
+	ldx     L0042+1
+	jsr     _ref
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	inc     _failures
+L004D:	lda     #<(_top)
+	ldx     #>(_top)
+	jsr     pushax
+	lda     L0042
+	ldx     L0042+1
+	jsr     _apply
+	jsr     pushax
+	lda     L0042
+	ldx     L0042+1
+	jsr     incax1
+	jsr     _ref
+	clc
+	adc     L0042
+	pha
+	txa
+	adc     L0042+1
+	tax
+	pla
+	jsr     incax1
+	jsr     tosicmp
+	beq     L005A
+	lda     #<(L0060)
+	ldx     #>(L0060)
+	jsr     pushax
+	lda     L0042
+	ldx     L0042+1
+	jsr     pushax
+	lda     #<(_top)
+	ldx     #>(_top)
+	jsr     pushax
+	lda     L0042
+	ldx     L0042+1
+	jsr     _apply
+	jsr     pushax
+	lda     L0042
+	ldx     L0042+1
+	jsr     incax1
+	jsr     _ref
+	clc
+	adc     L0042
+	pha
+	txa
+	adc     L0042+1
+	tax
+	pla
+	jsr     incax1
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	inc     _failures
+L005A:	inc     L0042
+	bne     L0043
+	inc     L0042+1
+L0043:	lda     L0042+1
+	cmp     #$01
+	bne     L004A
+	lda     L0042
+	cmp     #$2C
+L004A:	jcc     L0046
+	ldx     #$00
+	lda     #$07
+	jsr     _fact
+	cpx     #$13
+	bne     L007B
+	cmp     #$B0
+	beq     L0069
+L007B:	lda     #<(L006E)
+	ldx     #>(L006E)
+	jsr     pushax
+	ldx     #$00
+	lda     #$07
+	jsr     _fact
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0069:	lda     _failures
+	beq     L0074
+	ldx     #$00
+	lda     #$01
+	rts
+L0074:	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,479 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+L0067:
+	.byte	$61,$70,$70,$6C,$79,$28,$74,$6F,$70,$2C,$20,$25,$75,$29,$20,$3D
+	.byte	$20,$25,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$25,$75
+	.byte	$0A,$00
+L0077:
+	.byte	$66,$61,$63,$74,$28,$37,$29,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$35,$30,$34,$30,$0A,$00
+L0057:
+	.byte	$74,$6F,$70,$28,$25,$75,$29,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$25,$75,$0A,$00
+
+.segment	"BSS"
+
+L0081:
+	.res	18,$00
+L0003	:=	L0081+4
+L0005	:=	L0081+6
+L0012	:=	L0081+4
+L0015	:=	L0081+6
+L0019	:=	L0081+0
+L001C	:=	L0081+2
+L0021	:=	L0081+8
+L0023	:=	L0081+10
+L0029	:=	L0081+12
+L002C	:=	L0081+14
+L0047	:=	L0081+16
+L003D	:=	regbank+0
+L0040	:=	regbank+2
+
+; ---------------------------------------------------------------
+; unsigned int __near__ leaf1 (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_leaf1: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     mulax3
+	sta     L0003
+	stx     L0003+1
+	stz     L0005
+	bra     L0083
+L0082:	lda     L0005
+	clc
+	adc     L0003
+	sta     L0003
+	lda     #$00
+	adc     L0003+1
+	sta     L0003+1
+	inc     L0005
+L0083:	lda     L0005
+	cmp     #$03
+	bcc     L0082
+	lda     L0003
+	ldx     L0003+1
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ leaf2 (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_leaf2: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	clc
+	adc     #$07
+	bcc     L0014
+	inx
+L0014:	sta     L0012
+	stx     L0012+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	sta     L0015
+	stx     L0015+1
+	lda     L0012
+	clc
+	adc     L0015
+	pha
+	lda     L0012+1
+	adc     L0015+1
+	tax
+	pla
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ mid (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_mid: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _leaf1
+	sta     L0019
+	stx     L0019+1
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     _leaf2
+	sta     L001C
+	stx     L001C+1
+	lda     L001C
+	eor     L0019
+	pha
+	lda     L001C+1
+	eor     L0019+1
+	tax
+	pla
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ top (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_top: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	sta     L0021
+	stx     L0021+1
+	jsr     _mid
+	jsr     pushax
+	lda     L0021
+	ldx     L0021+1
+	jsr     _leaf1
+	jsr     tosaddax
+	sta     L0023
+	stx     L0023+1
+	clc
+	adc     L0021
+	pha
+	txa
+	adc     L0021+1
+	tax
+	pla
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ apply (__near__ __near__ function returning unsigned int *, unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_apply: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	ina
+	bne     L002B
+	inx
+L002B:	sta     L0029
+	stx     L0029+1
+	ldy     #$05
+	jsr     pushwysp
+	lda     L0029
+	ldx     L0029+1
+	pha
+	lda     (sp)
+	sta     jmpvec+1
+	ldy     #$01
+	lda     (sp),y
+	sta     jmpvec+2
+	pla
+	jsr     jmpvec
+	jsr     incsp2
+	sta     L002C
+	stx     L002C+1
+	clc
+	adc     L0029
+	pha
+	txa
+	adc     L0029+1
+	tax
+	pla
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ fact (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fact: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     pushw0sp
+	ldy     #$01
+	lda     (sp),y
+	cmp     #$00
+	bne     L0034
+	lda     (sp)
+	cmp     #$02
+L0034:	bcs     L0035
+	ldx     #$00
+	tya
+	jmp     incsp4
+L0035:	jsr     pushw0sp
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sec
+	sbc     #$01
+	bcs     L003A
+	dex
+L003A:	jsr     _fact
+	jsr     tosumulax
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ ref (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_ref: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     mulax3
+	clc
+	adc     #$03
+	bcc     L003F
+	inx
+L003F:	sta     L003D
+	stx     L003D+1
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	clc
+	adc     #$07
+	bcc     L0043
+	inx
+L0043:	jsr     mulax3
+	sta     L0040
+	stx     L0040+1
+	lda     L0040
+	eor     L003D
+	pha
+	lda     L0040+1
+	eor     L003D+1
+	tax
+	pla
+	clc
+	adc     L003D
+	sta     ptr1
+	txa
+	adc     L003D+1
+	sta     ptr1+1
+	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	clc
+	adc     ptr1
+	pha
+	txa
+	adc     ptr1+1
+	tax
+	pla
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	stz     L0047
+	stz     L0047+1
+	jmp     L0048
+L004B:	lda     L0047
+	ldx     L0047+1
+	jsr     _top
+	jsr     pushax
+	lda     L0047
+	ldx     L0047+1
+	jsr     _ref
+	jsr     tosicmp
+	beq     L0052
+	lda     #<(L0057)
+	ldx     #>(L0057)
+	jsr     pushax
+	lda     L0047
+	ldx     L0047+1
+	jsr     pushax
+	lda     L0047
+	ldx     L0047+1
+	jsr     _top
+	jsr     pushax
+	lda     L0047
+	ldx     L0047+1
+	jsr     _ref
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	inc     _failures
+L0052:	lda     #<(_top)
+	ldx     #>(_top)
+	jsr     pushax
+	lda     L0047
+	ldx     L0047+1
+	jsr     _apply
+	jsr     pushax
+	lda     L0047
+	ldx     L0047+1
+	ina
+	bne     L0064
+	inx
+L0064:	jsr     _ref
+	clc
+	adc     L0047
+	pha
+	txa
+	adc     L0047+1
+	tax
+	pla
+	ina
+	bne     L0065
+	inx
+L0065:	jsr     tosicmp
+	beq     L005F
+	lda     #<(L0067)
+	ldx     #>(L0067)
+	jsr     pushax
+	lda     L0047
+	ldx     L0047+1
+	jsr     pushax
+	lda     #<(_top)
+	ldx     #>(_top)
+	jsr     pushax
+	lda     L0047
+	ldx     L0047+1
+	jsr     _apply
+	jsr     pushax
+	lda     L0047
+	ldx     L0047+1
+	ina
+	bne     L006F
+	inx
+L006F:	jsr     _ref
+	clc
+	adc     L0047
+	pha
+	txa
+	adc     L0047+1
+	tax
+	pla
+	ina
+	bne     L0070
+	inx
+L0070:	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	inc     _failures
+L005F:	inc     L0047
+	bne     L0048
+	inc     L0047+1
+L0048:	lda     L0047+1
+	cmp     #$01
+	bne     L004F
+	lda     L0047
+	cmp     #$2C
+L004F:	jcc     L004B
+	ldx     #$00
+	lda     #$07
+	jsr     _fact
+	cpx     #$13
+	bne     L0084
+	cmp     #$B0
+	beq     L0072
+L0084:	lda     #<(L0077)
+	ldx     #>(L0077)
+	jsr     pushax
+	ldx     #$00
+	lda     #$07
+	jsr     _fact
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0072:	lda     _failures
+	beq     L007D
+	ldx     #$00
+	lda     #$01
+	rts
+L007D:	ldx     #$00
+	txa
+	rts
+
+.endproc
+
@@ -0,0 +1,559 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "staticframes.c", 1994, 1792373376
+	.dbg		file, "/root/repo/include/stdio.h", 6363, 1792382670
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1515150330
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1515150330
+	.dbg		file, "/root/repo/include/stdlib.h", 5748, 1515150330
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+L0063:
+	.byte	$61,$70,$70,$6C,$79,$28,$74,$6F,$70,$2C,$20,$25,$75,$29,$20,$3D
+	.byte	$20,$25,$75,$2C,$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$25,$75
+	.byte	$0A,$00
+L0073:
+	.byte	$66,$61,$63,$74,$28,$37,$29,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$35,$30,$34,$30,$0A,$00
+L0053:
+	.byte	$74,$6F,$70,$28,$25,$75,$29,$20,$3D,$20,$25,$75,$2C,$20,$65,$78
+	.byte	$70,$65,$63,$74,$65,$64,$20,$25,$75,$0A,$00
+
+.segment	"BSS"
+
+L007D:
+	.res	18,$00
+L0003	:=	L007D+4
+L0005	:=	L007D+6
+L0012	:=	L007D+4
+L0014	:=	L007D+6
+L0018	:=	L007D+0
+L001B	:=	L007D+2
+L0020	:=	L007D+8
+L0022	:=	L007D+10
+L0028	:=	L007D+12
+L002B	:=	L007D+14
+L003B	:=	L007D+0
+L003D	:=	L007D+2
+L0043	:=	L007D+16
+
+; ---------------------------------------------------------------
+; unsigned int __near__ leaf1 (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_leaf1: near
+
+	.dbg	func, "leaf1", "00", static, "_leaf1"
+	.dbg	sym, "a", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "staticframes.c", 21
+	jsr     pushax
+	.dbg	line, "staticframes.c", 22
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     mulax3
+	sta     L0003
+	stx     L0003+1
+	.dbg	line, "staticframes.c", 25
+	ldx     #$00
+	lda     #$00
+	sta     L0005
+	jmp     L0006
+	.dbg	line, "staticframes.c", 26
+L0009:	ldx     #$00
+	lda     L0005
+	ldx     #$00
+	clc
+	adc     L0003
+	sta     L0003
+	txa
+	adc     L0003+1
+	sta     L0003+1
+	tax
+	lda     L0003
+	.dbg	line, "staticframes.c", 25
+	ldx     #$00
+	inc     L0005
+	lda     L0005
+L0006:	ldx     #$00
+	lda     L0005
+	cmp     #$03
+	jsr     boolult
+	jne     L0009
+	.dbg	line, "staticframes.c", 28
+	lda     L0003
+	ldx     L0003+1
+	jmp     L0002
+	.dbg	line, "staticframes.c", 29
+L0002:	jsr     incsp2
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ leaf2 (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_leaf2: near
+
+	.dbg	func, "leaf2", "00", static, "_leaf2"
+	.dbg	sym, "a", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "staticframes.c", 32
+	jsr     pushax
+	.dbg	line, "staticframes.c", 33
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     incax7
+	sta     L0012
+	stx     L0012+1
+	.dbg	line, "staticframes.c", 34
+	lda     L0012
+	ldx     L0012+1
+	jsr     shlax1
+	sta     L0014
+	stx     L0014+1
+	.dbg	line, "staticframes.c", 35
+	lda     L0012
+	ldx     L0012+1
+	jsr     pushax
+	lda     L0014
+	ldx     L0014+1
+	jsr     tosaddax
+	jmp     L0011
+	.dbg	line, "staticframes.c", 36
+L0011:	jsr     incsp2
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ mid (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_mid: near
+
+	.dbg	func, "mid", "00", static, "_mid"
+	.dbg	sym, "a", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "staticframes.c", 39
+	jsr     pushax
+	.dbg	line, "staticframes.c", 40
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _leaf1
+	sta     L0018
+	stx     L0018+1
+	.dbg	line, "staticframes.c", 41
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     _leaf2
+	sta     L001B
+	stx     L001B+1
+	.dbg	line, "staticframes.c", 42
+	lda     L0018
+	ldx     L0018+1
+	jsr     pushax
+	lda     L001B
+	ldx     L001B+1
+	jsr     tosxorax
+	jmp     L0017
+	.dbg	line, "staticframes.c", 43
+L0017:	jsr     incsp2
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ top (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_top: near
+
+	.dbg	func, "top", "00", static, "_top"
+	.dbg	sym, "a", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "staticframes.c", 46
+	jsr     pushax
+	.dbg	line, "staticframes.c", 47
+	ldy     #$01
+	jsr     ldaxysp
+	sta     L0020
+	stx     L0020+1
+	.dbg	line, "staticframes.c", 48
+	lda     L0020
+	ldx     L0020+1
+	jsr     _mid
+	jsr     pushax
+	lda     L0020
+	ldx     L0020+1
+	jsr     _leaf1
+	jsr     tosaddax
+	sta     L0022
+	stx     L0022+1
+	.dbg	line, "staticframes.c", 49
+	lda     L0022
+	ldx     L0022+1
+	jsr     pushax
+	lda     L0020
+	ldx     L0020+1
+	jsr     tosaddax
+	jmp     L001F
+	.dbg	line, "staticframes.c", 50
+L001F:	jsr     incsp2
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ apply (__near__ __near__ function returning unsigned int *, unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_apply: near
+
+	.dbg	func, "apply", "00", static, "_apply"
+	.dbg	sym, "f", "00", auto, 2
+	.dbg	sym, "a", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "staticframes.c", 53
+	jsr     pushax
+	.dbg	line, "staticframes.c", 54
+	ldy     #$01
+	jsr     ldaxysp
+	ina
+	bne     L002A
+	inx
+L002A:	sta     L0028
+	stx     L0028+1
+	.dbg	line, "staticframes.c", 55
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	lda     L0028
+	ldx     L0028+1
+	pha
+	ldy     #$00
+	lda     (sp),y
+	sta     jmpvec+1
+	iny
+	lda     (sp),y
+	sta     jmpvec+2
+	pla
+	jsr     jmpvec
+	jsr     incsp2
+	sta     L002B
+	stx     L002B+1
+	.dbg	line, "staticframes.c", 56
+	lda     L002B
+	ldx     L002B+1
+	jsr     pushax
+	lda     L0028
+	ldx     L0028+1
+	jsr     tosaddax
+	jmp     L0027
+	.dbg	line, "staticframes.c", 57
+L0027:	jsr     incsp4
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ fact (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_fact: near
+
+	.dbg	func, "fact", "00", static, "_fact"
+	.dbg	sym, "n", "00", auto, 0
+	.dbg	sym, "m", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "staticframes.c", 61
+	jsr     pushax
+	.dbg	line, "staticframes.c", 62
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	.dbg	line, "staticframes.c", 63
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0033
+	cmp     #$02
+L0033:	jsr     boolult
+	jeq     L0034
+	ldx     #$00
+	lda     #$01
+	jmp     L0036
+L0034:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     decax1
+	jsr     _fact
+	jsr     tosumulax
+L0036:	jmp     L0030
+	.dbg	line, "staticframes.c", 64
+L0030:	jsr     incsp4
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ ref (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_ref: near
+
+	.dbg	func, "ref", "00", static, "_ref"
+	.dbg	sym, "a", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "staticframes.c", 68
+	jsr     pushax
+	.dbg	line, "staticframes.c", 69
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     mulax3
+	jsr     incax3
+	sta     L003B
+	stx     L003B+1
+	.dbg	line, "staticframes.c", 70
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     incax7
+	jsr     mulax3
+	sta     L003D
+	stx     L003D+1
+	.dbg	line, "staticframes.c", 71
+	lda     L003B
+	ldx     L003B+1
+	jsr     pushax
+	lda     L003D
+	ldx     L003D+1
+	jsr     tosxorax
+	jsr     pushax
+	lda     L003B
+	ldx     L003B+1
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosaddax
+	jmp     L003A
+	.dbg	line, "staticframes.c", 72
+L003A:	jsr     incsp2
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+
+.segment	"CODE"
+
+	.dbg	line, "staticframes.c", 78
+	ldx     #$00
+	lda     #$00
+	sta     L0043
+	stx     L0043+1
+	jmp     L0044
+	.dbg	line, "staticframes.c", 79
+L0047:	lda     L0043
+	ldx     L0043+1
+	jsr     _top
+	jsr     pushax
+	lda     L0043
+	ldx     L0043+1
+	jsr     _ref
+	jsr     tosneax
+	jeq     L004E
+	.dbg	line, "staticframes.c", 80
+	lda     #<(L0053)
+	ldx     #>(L0053)
+	jsr     pushax
+	lda     L0043
+	ldx     L0043+1
+	jsr     pushax
+	lda     L0043
+	ldx     L0043+1
+	jsr     _top
+	jsr     pushax
+	lda     L0043
+	ldx     L0043+1
+	jsr     _ref
+	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "staticframes.c", 81
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "staticframes.c", 83
+L004E:	lda     #<(_top)
+	ldx     #>(_top)
+	jsr     pushax
+	lda     L0043
+	ldx     L0043+1
+	jsr     _apply
+	jsr     pushax
+	lda     L0043
+	ldx     L0043+1
+	ina
+	bne     L0060
+	inx
+L0060:	jsr     _ref
+	jsr     pushax
+	lda     L0043
+	ldx     L0043+1
+	jsr     tosaddax
+	ina
+	bne     L0061
+	inx
+L0061:	jsr     tosneax
+	jeq     L005B
+	.dbg	line, "staticframes.c", 84
+	lda     #<(L0063)
+	ldx     #>(L0063)
+	jsr     pushax
+	lda     L0043
+	ldx     L0043+1
+	jsr     pushax
+	lda     #<(_top)
+	ldx     #>(_top)
+	jsr     pushax
+	lda     L0043
+	ldx     L0043+1
+	jsr     _apply
+	jsr     pushax
+	lda     L0043
+	ldx     L0043+1
+	ina
+	bne     L006B
+	inx
+L006B:	jsr     _ref
+	jsr     pushax
+	lda     L0043
+	ldx     L0043+1
+	jsr     tosaddax
+	ina
+	bne     L006C
+	inx
+L006C:	jsr     pushax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "staticframes.c", 85
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "staticframes.c", 78
+L005B:	inc     L0043
+	bne     L004D
+	inc     L0043+1
+L004D:	lda     L0043
+	ldx     L0043+1
+L0044:	lda     L0043
+	ldx     L0043+1
+	cpx     #$01
+	bne     L004B
+	cmp     #$2C
+L004B:	jsr     boolult
+	jne     L0047
+	.dbg	line, "staticframes.c", 88
+	ldx     #$00
+	lda     #$07
+	jsr     _fact
+	cpx     #$13
+	bne     L0071
+	cmp     #$B0
+L0071:	jsr     boolne
+	jeq     L006E
+	.dbg	line, "staticframes.c", 89
+	lda     #<(L0073)
+	ldx     #>(L0073)
+	jsr     pushax
+	ldx     #$00
+	lda     #$07
+	jsr     _fact
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "staticframes.c", 90
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "staticframes.c", 93
+L006E:	lda     _failures
+	jeq     L0079
+	ldx     #$00
+	lda     #$01
+	jmp     L007B
+L0079:	ldx     #$00
+	lda     #$00
+L007B:	jmp     L0042
+	.dbg	line, "staticframes.c", 94
+L0042:	rts
+	.dbg	line
+
+.endproc
+
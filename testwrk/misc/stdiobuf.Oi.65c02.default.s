@@ -0,0 +1,1316 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_fclose
+	.import		_feof
+	.import		_ferror
+	.import		_fflush
+	.import		_fgetc
+	.import		_fgets
+	.import		_fopen
+	.import		_fputc
+	.import		_fputs
+	.import		_fread
+	.import		_fwrite
+	.import		_ftell
+	.import		_fseek
+	.import		_printf
+	.import		_setvbuf
+	.import		_ungetc
+	.import		_exit
+	.import		_strcmp
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+L0163:
+	.byte	$66,$6C,$75,$73,$68,$3A,$20,$62,$61,$64,$20,$70,$6F,$73,$69,$74
+	.byte	$69,$6F,$6E,$20,$61,$74,$20,$25,$75,$0A,$00
+L00DA:
+	.byte	$66,$67,$65,$74,$73,$3A,$20,$62,$61,$64,$20,$6C,$69,$6E,$65,$20
+	.byte	$61,$74,$20,$25,$75,$0A,$00
+L0128:
+	.byte	$66,$72,$65,$61,$64,$3A,$20,$62,$61,$64,$20,$64,$61,$74,$61,$20
+	.byte	$61,$74,$20,$25,$75,$0A,$00
+L00F4:
+	.byte	$66,$67,$65,$74,$73,$3A,$20,$25,$75,$20,$63,$68,$61,$72,$73,$20
+	.byte	$72,$65,$61,$64,$0A,$00
+L00B7:
+	.byte	$66,$67,$65,$74,$63,$3A,$20,$25,$75,$20,$63,$68,$61,$72,$73,$20
+	.byte	$72,$65,$61,$64,$0A,$00
+L0139:
+	.byte	$66,$72,$65,$61,$64,$3A,$20,$25,$75,$20,$63,$68,$61,$72,$73,$20
+	.byte	$72,$65,$61,$64,$0A,$00
+L0084:
+	.byte	$66,$77,$72,$69,$74,$65,$20,$66,$61,$69,$6C,$65,$64,$20,$61,$74
+	.byte	$20,$25,$75,$0A,$00
+L00EB:
+	.byte	$75,$6E,$67,$65,$74,$63,$20,$66,$61,$69,$6C,$65,$64,$20,$61,$74
+	.byte	$20,$25,$75,$0A,$00
+L017C:
+	.byte	$66,$73,$65,$65,$6B,$20,$66,$61,$69,$6C,$65,$64,$20,$61,$74,$20
+	.byte	$25,$75,$0A,$00
+L016F:
+	.byte	$66,$6C,$75,$73,$68,$3A,$20,$25,$64,$20,$61,$74,$20,$25,$75,$0A
+	.byte	$00
+L0156	:=	L016F+0
+L00AA:
+	.byte	$66,$67,$65,$74,$63,$3A,$20,$25,$64,$20,$61,$74,$20,$25,$75,$0A
+	.byte	$00
+L0037:
+	.byte	$73,$65,$74,$76,$62,$75,$66,$20,$66,$61,$69,$6C,$65,$64,$0A,$00
+L0187:
+	.byte	$75,$73,$61,$67,$65,$3A,$20,$25,$73,$20,$66,$69,$6C,$65,$0A,$00
+L002A:
+	.byte	$63,$61,$6E,$6E,$6F,$74,$20,$6F,$70,$65,$6E,$20,$25,$73,$0A,$00
+L008F:
+	.byte	$66,$63,$6C,$6F,$73,$65,$20,$66,$61,$69,$6C,$65,$64,$0A,$00
+L00C0:
+	.byte	$72,$62,$00
+L0095	:=	L00C0+0
+L00FD	:=	L00C0+0
+L003E:
+	.byte	$77,$62,$00
+L0142	:=	L00C0+0
+
+.segment	"BSS"
+
+_readbuf:
+	.res	256,$00
+_line:
+	.res	65,$00
+_block:
+	.res	600,$00
+
+; ---------------------------------------------------------------
+; unsigned char __near__ expect (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_expect: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     (sp)
+	and     #$3F
+	cmp     #$3F
+	bne     L0006
+	ldx     #$00
+	lda     #$0A
+	jmp     incsp2
+L0006:	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jsr     shrax4
+	eor     (sp)
+	pha
+	txa
+	ldy     #$01
+	eor     (sp),y
+	pla
+	and     #$0F
+	clc
+	adc     #$41
+	ldx     #$00
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ make_line (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_make_line: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp1
+	lda     #$00
+	bra     L01A0
+L0015:	lda     #<(_line)
+	ldx     #>(_line)
+	clc
+	adc     (sp)
+	bcc     L001C
+	inx
+L001C:	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	clc
+	iny
+	adc     (sp),y
+	pha
+	lda     #$00
+	iny
+	adc     (sp),y
+	tax
+	pla
+	jsr     _expect
+	ldy     #$00
+	jsr     staspidx
+	clc
+	lda     #$01
+	adc     (sp)
+L01A0:	sta     (sp)
+	cmp     #$40
+	bcc     L0015
+	stz     _line+64
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; __near__ struct _FILE * __near__ open_file (__near__ const unsigned char *, __near__ const unsigned char *, __near__ unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_open_file: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fopen
+	jsr     pushax
+	lda     (sp)
+	ldy     #$01
+	ora     (sp),y
+	bne     L0026
+	lda     #<(L002A)
+	ldx     #>(L002A)
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0026:	jsr     decsp6
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$04
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$02
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	lda     #$00
+	sta     (sp)
+	ldy     #$01
+	sta     (sp),y
+	ldx     #$01
+	jsr     _setvbuf
+	cpx     #$00
+	bne     L01A1
+	cmp     #$00
+	beq     L002F
+L01A1:	lda     #<(L0037)
+	ldx     #>(L0037)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+L002F:	ldy     #$01
+	lda     (sp),y
+	tax
+	lda     (sp)
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ write_file (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_write_file: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp4
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$02
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	lda     #<(L003E)
+	sta     (sp)
+	ldy     #$01
+	lda     #>(L003E)
+	sta     (sp),y
+	ldx     #$00
+	txa
+	jsr     _open_file
+	jsr     pushax
+	jsr     decsp4
+	ldy     #$02
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	bra     L01A3
+L0044:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _expect
+	jsr     pusha0
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fputc
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$03
+L01A3:	lda     (sp),y
+	cmp     #$0C
+	bne     L0049
+	dey
+	lda     (sp),y
+	cmp     #$80
+L0049:	bcc     L0044
+	lda     #$00
+	sta     (sp)
+	ldy     #$01
+	sta     (sp),y
+	bra     L01A4
+L0052:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _make_line
+	lda     #<(_line)
+	ldx     #>(_line)
+	jsr     pushax
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fputs
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$02
+	ldx     #$00
+	lda     #$40
+	jsr     addeqysp
+	ldy     #$01
+L01A4:	lda     (sp),y
+	cmp     #$00
+	bne     L0056
+	lda     (sp)
+	cmp     #$0A
+L0056:	bcc     L0052
+	jmp     L0061
+L005F:	ldy     #$02
+	lda     (sp),y
+	and     #$01
+	beq     L0066
+	ldx     #$00
+	lda     #$0D
+	bra     L0068
+L0066:	ldx     #$02
+	lda     #$58
+L0068:	jsr     pushax
+	jsr     pushw0sp
+	lda     #$00
+	sec
+	ldy     #$06
+	sbc     (sp),y
+	pha
+	lda     #$19
+	iny
+	sbc     (sp),y
+	tax
+	pla
+	jsr     tosicmp
+	bcc     L006B
+	beq     L006B
+	lda     #$00
+	sec
+	ldy     #$04
+	sbc     (sp),y
+	pha
+	lda     #$19
+	iny
+	sbc     (sp),y
+	tax
+	pla
+	jsr     stax0sp
+L006B:	ldy     #$02
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	bra     L01A5
+L0074:	lda     #<(_block)
+	ldy     #$02
+	clc
+	adc     (sp),y
+	pha
+	lda     #>(_block)
+	iny
+	adc     (sp),y
+	tax
+	pla
+	jsr     pushax
+	ldy     #$06
+	lda     (sp),y
+	ldy     #$04
+	clc
+	adc     (sp),y
+	pha
+	ldy     #$07
+	lda     (sp),y
+	ldy     #$05
+	adc     (sp),y
+	tax
+	pla
+	jsr     _expect
+	ldy     #$00
+	jsr     staspidx
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$03
+L01A5:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     (sp)
+	txa
+	dey
+	sbc     (sp),y
+	bcc     L0074
+	jsr     decsp6
+	lda     #<(_block)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(_block)
+	sta     (sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     (sp)
+	ldy     #$01
+	txa
+	sta     (sp),y
+	ldy     #$0D
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fwrite
+	cmp     (sp)
+	bne     L01A6
+	txa
+	ldy     #$01
+	cmp     (sp),y
+	beq     L007D
+L01A6:	lda     #<(L0084)
+	ldx     #>(L0084)
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L007D:	lda     (sp)
+	ldy     #$04
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$01
+	lda     (sp),y
+	ldy     #$05
+	adc     (sp),y
+	sta     (sp),y
+	jsr     incsp2
+L0061:	ldy     #$03
+	lda     (sp),y
+	tax
+	cpx     #$19
+	jcc     L005F
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fclose
+	cpx     #$00
+	bne     L01A7
+	cmp     #$00
+	beq     L008A
+L01A7:	lda     #<(L008F)
+	ldx     #>(L008F)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+L008A:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ read_chars (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_read_chars: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp4
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$02
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	lda     #<(L0095)
+	sta     (sp)
+	ldy     #$01
+	lda     #>(L0095)
+	sta     (sp),y
+	lda     #<(_readbuf)
+	ldx     #>(_readbuf)
+	jsr     _open_file
+	jsr     pushax
+	jsr     decsp4
+	ldy     #$02
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	bra     L0098
+L009B:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$00
+	txa
+	sbc     #$19
+	bcs     L01A8
+	jsr     pushw0sp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _expect
+	jsr     tosicmp
+	beq     L00A4
+L01A8:	lda     #<(L00AA)
+	ldx     #>(L00AA)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _printf
+	inc     _failures
+	bra     L0099
+L00A4:	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0098:	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fgetc
+	jsr     stax0sp
+	cpx     #$FF
+	bne     L009B
+	cmp     #$FF
+	bne     L009B
+L0099:	ldy     #$03
+	lda     (sp),y
+	cmp     #$19
+	bne     L00B0
+	dey
+	lda     (sp),y
+	bne     L00B0
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _feof
+	stx     tmp1
+	ora     tmp1
+	beq     L00B0
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _ferror
+	stx     tmp1
+	ora     tmp1
+	beq     L00AF
+L00B0:	lda     #<(L00B7)
+	ldx     #>(L00B7)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L00AF:	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fclose
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ read_lines (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_read_lines: near
+
+.segment	"BSS"
+
+L00C4:
+	.res	74,$00
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp4
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$02
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	lda     #<(L00C0)
+	sta     (sp)
+	ldy     #$01
+	lda     #>(L00C0)
+	sta     (sp),y
+	lda     #<(_readbuf)
+	ldx     #>(_readbuf)
+	jsr     _open_file
+	jsr     pushax
+	jsr     decsp4
+	ldy     #$02
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L00C5
+L00C8:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _make_line
+	lda     #<(L00C4)
+	ldx     #>(L00C4)
+	jsr     pushax
+	lda     #<(_line)
+	ldx     #>(_line)
+	jsr     _strcmp
+	cpx     #$00
+	bne     L01AC
+	cmp     #$00
+	beq     L00D4
+L01AC:	lda     #<(L00DA)
+	ldx     #>(L00DA)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	jmp     L00C6
+L00D4:	ldy     #$02
+	lda     (sp),y
+	and     #$40
+	beq     L01AB
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fgetc
+	jsr     stax0sp
+	cpx     #$FF
+	bne     L01AD
+	cmp     #$FF
+	beq     L00E3
+L01AD:	jsr     pushw0sp
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _ungetc
+	cmp     (sp)
+	bne     L00E4
+	txa
+	ldy     #$01
+	cmp     (sp),y
+	beq     L00E3
+L00E4:	lda     #<(L00EB)
+	ldx     #>(L00EB)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L00E3:	ldy     #$02
+	ldx     #$00
+L01AB:	lda     #$40
+	jsr     addeqysp
+L00C5:	jsr     decsp4
+	lda     #<(L00C4)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(L00C4)
+	sta     (sp),y
+	lda     #$4A
+	sta     (sp)
+	ldy     #$01
+	lda     #$00
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fgets
+	stx     tmp1
+	ora     tmp1
+	jne     L00C8
+L00C6:	ldy     #$03
+	lda     (sp),y
+	cmp     #$19
+	bne     L01AE
+	dey
+	lda     (sp),y
+	beq     L00EF
+L01AE:	lda     #<(L00F4)
+	ldx     #>(L00F4)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L00EF:	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fclose
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ read_blocks (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_read_blocks: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp4
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$02
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	lda     #<(L00FD)
+	sta     (sp)
+	ldy     #$01
+	lda     #>(L00FD)
+	sta     (sp),y
+	lda     #<(_readbuf)
+	ldx     #>(_readbuf)
+	jsr     _open_file
+	jsr     pushax
+	jsr     decsp8
+	ldy     #$06
+	lda     #$00
+	sta     (sp),y
+	iny
+	jmp     L01AF
+L0103:	ldy     #$06
+	lda     (sp),y
+	and     #$01
+	beq     L010D
+	ldx     #$00
+	lda     #$11
+	bra     L010F
+L010D:	ldx     #$02
+	lda     #$58
+L010F:	ldy     #$02
+	jsr     staxysp
+	jsr     decsp6
+	lda     #<(_block)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(_block)
+	sta     (sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	sta     (sp)
+	ldy     #$01
+	txa
+	sta     (sp),y
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fread
+	jsr     stax0sp
+	cpx     #$00
+	bne     L01B2
+	cmp     #$00
+	jeq     L0101
+L01B2:	ldy     #$04
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	bra     L01B1
+L011E:	lda     #<(_block)
+	ldy     #$04
+	clc
+	adc     (sp),y
+	sta     ptr1
+	lda     #>(_block)
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	lda     (ptr1)
+	jsr     pusha0
+	ldy     #$08
+	lda     (sp),y
+	ldy     #$06
+	clc
+	adc     (sp),y
+	pha
+	ldy     #$09
+	lda     (sp),y
+	ldy     #$07
+	adc     (sp),y
+	tax
+	pla
+	jsr     _expect
+	jsr     tosicmp
+	beq     L0123
+	lda     #<(L0128)
+	ldx     #>(L0128)
+	jsr     pushax
+	ldy     #$08
+	lda     (sp),y
+	ldy     #$06
+	clc
+	adc     (sp),y
+	pha
+	ldy     #$09
+	lda     (sp),y
+	ldy     #$07
+	adc     (sp),y
+	tax
+	pla
+	jmp     L01B6
+L0123:	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$05
+L01B1:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     (sp)
+	txa
+	ldy     #$01
+	sbc     (sp),y
+	bcc     L011E
+	lda     (sp)
+	ldy     #$06
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$01
+	lda     (sp),y
+	ldy     #$07
+	adc     (sp),y
+L01AF:	sta     (sp),y
+	lda     (sp),y
+	tax
+	cpx     #$19
+	jcc     L0103
+L0101:	ldy     #$07
+	lda     (sp),y
+	cmp     #$19
+	bne     L012E
+	dey
+	lda     (sp),y
+	bne     L012E
+	jsr     decsp6
+	lda     #<(_block)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(_block)
+	sta     (sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (sp),y
+	iny
+	dea
+	sta     (sp),y
+	ina
+	sta     (sp)
+	tay
+	dea
+	sta     (sp),y
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fread
+	cpx     #$00
+	bne     L012E
+	cmp     #$00
+	bne     L012E
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _feof
+	stx     tmp1
+	ora     tmp1
+	bne     L012D
+L012E:	lda     #<(L0139)
+	ldx     #>(L0139)
+	jsr     pushax
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+L01B6:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L012D:	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fclose
+	ldy     #$0C
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ read_flush (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_read_flush: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp4
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$02
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	lda     #<(L0142)
+	sta     (sp)
+	ldy     #$01
+	lda     #>(L0142)
+	sta     (sp),y
+	lda     #<(_readbuf)
+	ldx     #>(_readbuf)
+	jsr     _open_file
+	jsr     pushax
+	jsr     decsp4
+	ldy     #$02
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L01B7
+L0148:	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fgetc
+	jsr     stax0sp
+	jsr     pushax
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _expect
+	jsr     tosicmp
+	beq     L014F
+	lda     #<(L0156)
+	ldx     #>(L0156)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _printf
+	inc     _failures
+	jmp     L0146
+L014F:	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fflush
+	cpx     #$00
+	bne     L015C
+	cmp     #$00
+	bne     L015C
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _ftell
+	jsr     pusheax
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ina
+	bne     L0160
+	inx
+L0160:	stz     sreg
+	stz     sreg+1
+	jsr     tosneeax
+	beq     L015B
+L015C:	lda     #<(L0163)
+	ldx     #>(L0163)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	jmp     L0146
+L015B:	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fgetc
+	jsr     stax0sp
+	jsr     pushax
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ina
+	bne     L016D
+	inx
+L016D:	jsr     _expect
+	jsr     tosicmp
+	beq     L0167
+	lda     #<(L016F)
+	ldx     #>(L016F)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ina
+	bne     L0173
+	inx
+L0173:	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	inc     _failures
+	bra     L0146
+L0167:	jsr     decsp6
+	ldy     #$0B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$04
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	ldx     #$00
+	lda     #$62
+	sta     (sp)
+	txa
+	ldy     #$01
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     _fseek
+	cpx     #$00
+	bne     L01B8
+	cmp     #$00
+	beq     L0175
+L01B8:	lda     #<(L017C)
+	ldx     #>(L017C)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bra     L0146
+L0175:	ldy     #$02
+	lda     #$64
+	jsr     addeqysp
+	ldy     #$03
+L01B7:	lda     (sp),y
+	tax
+	cpx     #$19
+	jcc     L0148
+L0146:	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fclose
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int, __near__ unsigned char * *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldy     #$03
+	lda     (sp),y
+	bne     L01B9
+	dey
+	lda     (sp),y
+	cmp     #$02
+	beq     L0183
+L01B9:	lda     #<(L0187)
+	ldx     #>(L0187)
+	jsr     pushax
+	ldy     #$03
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	dey
+	lda     (ptr1),y
+	tax
+	lda     (ptr1)
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     incsp4
+L0183:	dey
+	lda     (sp),y
+	sta     ptr1+1
+	lda     (sp)
+	sta     ptr1
+	ldy     #$03
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     _write_file
+	ldy     #$01
+	lda     (sp),y
+	sta     ptr1+1
+	lda     (sp)
+	sta     ptr1
+	ldy     #$03
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     _read_chars
+	ldy     #$01
+	lda     (sp),y
+	sta     ptr1+1
+	lda     (sp)
+	sta     ptr1
+	ldy     #$03
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     _read_lines
+	ldy     #$01
+	lda     (sp),y
+	sta     ptr1+1
+	lda     (sp)
+	sta     ptr1
+	ldy     #$03
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     _read_blocks
+	ldy     #$01
+	lda     (sp),y
+	sta     ptr1+1
+	lda     (sp)
+	sta     ptr1
+	ldy     #$03
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     _read_flush
+	lda     _failures
+	beq     L019C
+	ldx     #$00
+	lda     #$01
+	jmp     incsp4
+L019C:	tax
+	jmp     incsp4
+
+.endproc
+
@@ -0,0 +1,973 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_fclose
+	.import		_feof
+	.import		_ferror
+	.import		_fflush
+	.import		_fgetc
+	.import		_fgets
+	.import		_fopen
+	.import		_fputc
+	.import		_fputs
+	.import		_fread
+	.import		_fwrite
+	.import		_ftell
+	.import		_fseek
+	.import		_printf
+	.import		_ungetc
+	.import		_exit
+	.import		_strcmp
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+L0157:
+	.byte	$66,$6C,$75,$73,$68,$3A,$20,$62,$61,$64,$20,$70,$6F,$73,$69,$74
+	.byte	$69,$6F,$6E,$20,$61,$74,$20,$25,$75,$0A,$00
+L00CE:
+	.byte	$66,$67,$65,$74,$73,$3A,$20,$62,$61,$64,$20,$6C,$69,$6E,$65,$20
+	.byte	$61,$74,$20,$25,$75,$0A,$00
+L011C:
+	.byte	$66,$72,$65,$61,$64,$3A,$20,$62,$61,$64,$20,$64,$61,$74,$61,$20
+	.byte	$61,$74,$20,$25,$75,$0A,$00
+L00E8:
+	.byte	$66,$67,$65,$74,$73,$3A,$20,$25,$75,$20,$63,$68,$61,$72,$73,$20
+	.byte	$72,$65,$61,$64,$0A,$00
+L00AB:
+	.byte	$66,$67,$65,$74,$63,$3A,$20,$25,$75,$20,$63,$68,$61,$72,$73,$20
+	.byte	$72,$65,$61,$64,$0A,$00
+L012D:
+	.byte	$66,$72,$65,$61,$64,$3A,$20,$25,$75,$20,$63,$68,$61,$72,$73,$20
+	.byte	$72,$65,$61,$64,$0A,$00
+L00DF:
+	.byte	$75,$6E,$67,$65,$74,$63,$20,$66,$61,$69,$6C,$65,$64,$20,$61,$74
+	.byte	$20,$25,$75,$0A,$00
+L0078:
+	.byte	$66,$77,$72,$69,$74,$65,$20,$66,$61,$69,$6C,$65,$64,$20,$61,$74
+	.byte	$20,$25,$75,$0A,$00
+L0170:
+	.byte	$66,$73,$65,$65,$6B,$20,$66,$61,$69,$6C,$65,$64,$20,$61,$74,$20
+	.byte	$25,$75,$0A,$00
+L0163:
+	.byte	$66,$6C,$75,$73,$68,$3A,$20,$25,$64,$20,$61,$74,$20,$25,$75,$0A
+	.byte	$00
+L014A	:=	L0163+0
+L009E:
+	.byte	$66,$67,$65,$74,$63,$3A,$20,$25,$64,$20,$61,$74,$20,$25,$75,$0A
+	.byte	$00
+L017B:
+	.byte	$75,$73,$61,$67,$65,$3A,$20,$25,$73,$20,$66,$69,$6C,$65,$0A,$00
+L0028:
+	.byte	$63,$61,$6E,$6E,$6F,$74,$20,$6F,$70,$65,$6E,$20,$25,$73,$0A,$00
+L0083:
+	.byte	$66,$63,$6C,$6F,$73,$65,$20,$66,$61,$69,$6C,$65,$64,$0A,$00
+L00B4:
+	.byte	$72,$62,$00
+L0089	:=	L00B4+0
+L00F1	:=	L00B4+0
+L0032:
+	.byte	$77,$62,$00
+L0136	:=	L00B4+0
+
+.segment	"BSS"
+
+_line:
+	.res	65,$00
+_block:
+	.res	600,$00
+
+; ---------------------------------------------------------------
+; unsigned char __near__ expect (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_expect: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     (sp)
+	and     #$3F
+	cmp     #$3F
+	bne     L0005
+	ldx     #$00
+	lda     #$0A
+	jmp     incsp2
+L0005:	jsr     ldax0sp
+	jsr     shrax4
+	eor     (sp)
+	pha
+	txa
+	ldy     #$01
+	eor     (sp),y
+	pla
+	ldx     #$00
+	and     #$0F
+	ldy     #$41
+	jsr     incaxy
+	ldx     #$00
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ make_line (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_make_line: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp1
+	lda     #$00
+	bra     L0194
+L0013:	lda     #<(_line)
+	ldx     #>(_line)
+	clc
+	adc     (sp)
+	bcc     L001A
+	inx
+L001A:	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	clc
+	iny
+	adc     (sp),y
+	pha
+	lda     #$00
+	iny
+	adc     (sp),y
+	tax
+	pla
+	jsr     _expect
+	ldy     #$00
+	jsr     staspidx
+	clc
+	lda     #$01
+	adc     (sp)
+L0194:	sta     (sp)
+	cmp     #$40
+	bcc     L0013
+	stz     _line+64
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; __near__ struct _FILE * __near__ open_file (__near__ const unsigned char *, __near__ const unsigned char *, __near__ unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_open_file: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fopen
+	jsr     pushax
+	lda     (sp)
+	ldy     #$01
+	ora     (sp),y
+	bne     L0195
+	lda     #<(L0028)
+	ldx     #>(L0028)
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L0195:	jsr     ldax0sp
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ write_file (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_write_file: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     pushw0sp
+	lda     #<(L0032)
+	ldx     #>(L0032)
+	jsr     pushax
+	ldx     #$00
+	txa
+	jsr     _open_file
+	jsr     pushax
+	jsr     decsp4
+	ldx     #$00
+	txa
+	ldy     #$02
+	jsr     staxysp
+	bra     L0035
+L0038:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _expect
+	jsr     pusha0
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _fputc
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0035:	ldy     #$03
+	lda     (sp),y
+	cmp     #$0C
+	bne     L003D
+	dey
+	lda     (sp),y
+	cmp     #$80
+L003D:	bcc     L0038
+	ldx     #$00
+	txa
+	jsr     stax0sp
+	bra     L0043
+L0046:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _make_line
+	lda     #<(_line)
+	ldx     #>(_line)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _fputs
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$02
+	ldx     #$00
+	lda     #$40
+	jsr     addeqysp
+L0043:	ldy     #$01
+	lda     (sp),y
+	cmp     #$00
+	bne     L004A
+	lda     (sp)
+	cmp     #$0A
+L004A:	bcc     L0046
+	jmp     L0055
+L0053:	ldy     #$02
+	lda     (sp),y
+	and     #$01
+	beq     L005A
+	ldx     #$00
+	lda     #$0D
+	bra     L005C
+L005A:	ldx     #$02
+	lda     #$58
+L005C:	jsr     pushax
+	jsr     pushw0sp
+	lda     #$00
+	sec
+	ldy     #$06
+	sbc     (sp),y
+	pha
+	lda     #$19
+	iny
+	sbc     (sp),y
+	tax
+	pla
+	jsr     tosicmp
+	bcc     L005F
+	beq     L005F
+	lda     #$00
+	sec
+	ldy     #$04
+	sbc     (sp),y
+	pha
+	lda     #$19
+	iny
+	sbc     (sp),y
+	tax
+	pla
+	jsr     stax0sp
+L005F:	ldx     #$00
+	txa
+	ldy     #$02
+	jsr     staxysp
+	bra     L0065
+L0068:	lda     #<(_block)
+	ldy     #$02
+	clc
+	adc     (sp),y
+	pha
+	lda     #>(_block)
+	iny
+	adc     (sp),y
+	tax
+	pla
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	clc
+	ldy     #$06
+	adc     (sp),y
+	pha
+	txa
+	iny
+	adc     (sp),y
+	tax
+	pla
+	jsr     _expect
+	ldy     #$00
+	jsr     staspidx
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0065:	ldy     #$03
+	jsr     ldaxysp
+	cmp     (sp)
+	txa
+	ldy     #$01
+	sbc     (sp),y
+	bcc     L0068
+	lda     #<(_block)
+	ldx     #>(_block)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     _fwrite
+	cmp     (sp)
+	bne     L0197
+	txa
+	ldy     #$01
+	cmp     (sp),y
+	beq     L0199
+L0197:	lda     #<(L0078)
+	ldx     #>(L0078)
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0199:	jsr     ldax0sp
+	ldy     #$04
+	jsr     addeqysp
+	jsr     incsp2
+L0055:	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$19
+	jcc     L0053
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fclose
+	cpx     #$00
+	bne     L0198
+	cmp     #$00
+	beq     L007E
+L0198:	lda     #<(L0083)
+	ldx     #>(L0083)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+L007E:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ read_chars (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_read_chars: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     pushw0sp
+	lda     #<(L0089)
+	ldx     #>(L0089)
+	jsr     pushax
+	ldx     #$00
+	txa
+	jsr     _open_file
+	jsr     pushax
+	jsr     decsp4
+	ldx     #$00
+	txa
+	ldy     #$02
+	jsr     staxysp
+	bra     L008C
+L008F:	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$00
+	txa
+	sbc     #$19
+	bcs     L019A
+	jsr     pushw0sp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _expect
+	jsr     tosicmp
+	beq     L0098
+L019A:	lda     #<(L009E)
+	ldx     #>(L009E)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _printf
+	inc     _failures
+	bra     L008D
+L0098:	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L008C:	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fgetc
+	jsr     stax0sp
+	cpx     #$FF
+	bne     L008F
+	cmp     #$FF
+	bne     L008F
+L008D:	ldy     #$03
+	lda     (sp),y
+	cmp     #$19
+	bne     L00A4
+	dey
+	lda     (sp),y
+	bne     L00A4
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _feof
+	stx     tmp1
+	ora     tmp1
+	beq     L00A4
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _ferror
+	stx     tmp1
+	ora     tmp1
+	beq     L00A3
+L00A4:	lda     #<(L00AB)
+	ldx     #>(L00AB)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L00A3:	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fclose
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ read_lines (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_read_lines: near
+
+.segment	"BSS"
+
+L00B8:
+	.res	74,$00
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     pushw0sp
+	lda     #<(L00B4)
+	ldx     #>(L00B4)
+	jsr     pushax
+	ldx     #$00
+	txa
+	jsr     _open_file
+	jsr     pushax
+	jsr     decsp4
+	ldx     #$00
+	txa
+	ldy     #$02
+	jsr     staxysp
+	jmp     L00B9
+L00BC:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _make_line
+	lda     #<(L00B8)
+	ldx     #>(L00B8)
+	jsr     pushax
+	lda     #<(_line)
+	ldx     #>(_line)
+	jsr     _strcmp
+	cpx     #$00
+	bne     L019E
+	cmp     #$00
+	beq     L00C8
+L019E:	lda     #<(L00CE)
+	ldx     #>(L00CE)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bra     L00BA
+L00C8:	ldy     #$02
+	lda     (sp),y
+	and     #$40
+	beq     L019D
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fgetc
+	jsr     stax0sp
+	cpx     #$FF
+	bne     L019F
+	cmp     #$FF
+	beq     L00D7
+L019F:	jsr     pushw0sp
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _ungetc
+	cmp     (sp)
+	bne     L00D8
+	txa
+	ldy     #$01
+	cmp     (sp),y
+	beq     L00D7
+L00D8:	lda     #<(L00DF)
+	ldx     #>(L00DF)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L00D7:	ldy     #$02
+	ldx     #$00
+L019D:	lda     #$40
+	jsr     addeqysp
+L00B9:	lda     #<(L00B8)
+	ldx     #>(L00B8)
+	jsr     pushax
+	lda     #$4A
+	jsr     pusha0
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     _fgets
+	stx     tmp1
+	ora     tmp1
+	jne     L00BC
+L00BA:	ldy     #$03
+	lda     (sp),y
+	cmp     #$19
+	bne     L01A0
+	dey
+	lda     (sp),y
+	beq     L00E3
+L01A0:	lda     #<(L00E8)
+	ldx     #>(L00E8)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L00E3:	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fclose
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ read_blocks (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_read_blocks: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     pushw0sp
+	lda     #<(L00F1)
+	ldx     #>(L00F1)
+	jsr     pushax
+	ldx     #$00
+	txa
+	jsr     _open_file
+	jsr     pushax
+	jsr     decsp8
+	ldx     #$00
+	txa
+	ldy     #$06
+	jsr     staxysp
+	jmp     L00F4
+L00F7:	ldy     #$06
+	lda     (sp),y
+	and     #$01
+	beq     L0101
+	ldx     #$00
+	lda     #$11
+	bra     L0103
+L0101:	ldx     #$02
+	lda     #$58
+L0103:	ldy     #$02
+	jsr     staxysp
+	lda     #<(_block)
+	ldx     #>(_block)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     _fread
+	jsr     stax0sp
+	cpx     #$00
+	bne     L01A2
+	cmp     #$00
+	beq     L00F5
+L01A2:	ldx     #$00
+	txa
+	ldy     #$04
+	jsr     staxysp
+	bra     L010F
+L0112:	lda     #<(_block)
+	ldy     #$04
+	clc
+	adc     (sp),y
+	sta     ptr1
+	lda     #>(_block)
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	lda     (ptr1)
+	jsr     pusha0
+	ldy     #$07
+	jsr     ldaxysp
+	clc
+	ldy     #$08
+	adc     (sp),y
+	pha
+	txa
+	iny
+	adc     (sp),y
+	tax
+	pla
+	jsr     _expect
+	jsr     tosicmp
+	beq     L0117
+	lda     #<(L011C)
+	ldx     #>(L011C)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	clc
+	ldy     #$08
+	adc     (sp),y
+	pha
+	txa
+	iny
+	adc     (sp),y
+	tax
+	pla
+	bra     L01A6
+L0117:	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L010F:	ldy     #$05
+	jsr     ldaxysp
+	cmp     (sp)
+	txa
+	ldy     #$01
+	sbc     (sp),y
+	bcc     L0112
+	jsr     ldax0sp
+	ldy     #$06
+	jsr     addeqysp
+L00F4:	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$19
+	jcc     L00F7
+L00F5:	ldy     #$07
+	lda     (sp),y
+	cmp     #$19
+	bne     L0122
+	dey
+	lda     (sp),y
+	bne     L0122
+	lda     #<(_block)
+	ldx     #>(_block)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	jsr     pusha0
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     _fread
+	cpx     #$00
+	bne     L0122
+	cmp     #$00
+	bne     L0122
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     _feof
+	stx     tmp1
+	ora     tmp1
+	bne     L0121
+L0122:	lda     #<(L012D)
+	ldx     #>(L012D)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+L01A6:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0121:	ldy     #$09
+	jsr     ldaxysp
+	jsr     _fclose
+	ldy     #$0C
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ read_flush (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_read_flush: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     pushw0sp
+	lda     #<(L0136)
+	ldx     #>(L0136)
+	jsr     pushax
+	ldx     #$00
+	txa
+	jsr     _open_file
+	jsr     pushax
+	jsr     decsp4
+	ldx     #$00
+	txa
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0139
+L013C:	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fgetc
+	jsr     stax0sp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _expect
+	jsr     tosicmp
+	beq     L0143
+	lda     #<(L014A)
+	ldx     #>(L014A)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _printf
+	inc     _failures
+	jmp     L013A
+L0143:	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fflush
+	cpx     #$00
+	bne     L0150
+	cmp     #$00
+	bne     L0150
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _ftell
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldaxysp
+	ina
+	bne     L0154
+	inx
+L0154:	jsr     axulong
+	jsr     tosneeax
+	beq     L014F
+L0150:	lda     #<(L0157)
+	ldx     #>(L0157)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	jmp     L013A
+L014F:	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fgetc
+	jsr     stax0sp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ina
+	bne     L0161
+	inx
+L0161:	jsr     _expect
+	jsr     tosicmp
+	beq     L015B
+	lda     #<(L0163)
+	ldx     #>(L0163)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$07
+	jsr     ldaxysp
+	ina
+	bne     L0167
+	inx
+L0167:	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	inc     _failures
+	bra     L013A
+L015B:	ldy     #$07
+	jsr     pushwysp
+	ldx     #$00
+	lda     #$62
+	jsr     push0ax
+	txa
+	jsr     _fseek
+	cpx     #$00
+	bne     L01A7
+	cmp     #$00
+	beq     L0169
+L01A7:	lda     #<(L0170)
+	ldx     #>(L0170)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bra     L013A
+L0169:	ldy     #$02
+	lda     #$64
+	jsr     addeqysp
+L0139:	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$19
+	jcc     L013C
+L013A:	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fclose
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int, __near__ unsigned char * *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldy     #$03
+	lda     (sp),y
+	bne     L01A8
+	dey
+	lda     (sp),y
+	cmp     #$02
+	beq     L0177
+L01A8:	lda     #<(L017B)
+	ldx     #>(L017B)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushw
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     incsp4
+L0177:	jsr     ldax0sp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     _write_file
+	jsr     ldax0sp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     _read_chars
+	jsr     ldax0sp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     _read_lines
+	jsr     ldax0sp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     _read_blocks
+	jsr     ldax0sp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     _read_flush
+	lda     _failures
+	beq     L0190
+	ldx     #$00
+	lda     #$01
+	jmp     incsp4
+L0190:	tax
+	jmp     incsp4
+
+.endproc
+
@@ -0,0 +1,1315 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_fclose
+	.import		_feof
+	.import		_ferror
+	.import		_fflush
+	.import		_fgetc
+	.import		_fgets
+	.import		_fopen
+	.import		_fputc
+	.import		_fputs
+	.import		_fread
+	.import		_fwrite
+	.import		_ftell
+	.import		_fseek
+	.import		_printf
+	.import		_ungetc
+	.import		_exit
+	.import		_strcmp
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+L015B:
+	.byte	$66,$6C,$75,$73,$68,$3A,$20,$62,$61,$64,$20,$70,$6F,$73,$69,$74
+	.byte	$69,$6F,$6E,$20,$61,$74,$20,$25,$75,$0A,$00
+L00D2:
+	.byte	$66,$67,$65,$74,$73,$3A,$20,$62,$61,$64,$20,$6C,$69,$6E,$65,$20
+	.byte	$61,$74,$20,$25,$75,$0A,$00
+L0120:
+	.byte	$66,$72,$65,$61,$64,$3A,$20,$62,$61,$64,$20,$64,$61,$74,$61,$20
+	.byte	$61,$74,$20,$25,$75,$0A,$00
+L00EC:
+	.byte	$66,$67,$65,$74,$73,$3A,$20,$25,$75,$20,$63,$68,$61,$72,$73,$20
+	.byte	$72,$65,$61,$64,$0A,$00
+L00AC:
+	.byte	$66,$67,$65,$74,$63,$3A,$20,$25,$75,$20,$63,$68,$61,$72,$73,$20
+	.byte	$72,$65,$61,$64,$0A,$00
+L0131:
+	.byte	$66,$72,$65,$61,$64,$3A,$20,$25,$75,$20,$63,$68,$61,$72,$73,$20
+	.byte	$72,$65,$61,$64,$0A,$00
+L00E3:
+	.byte	$75,$6E,$67,$65,$74,$63,$20,$66,$61,$69,$6C,$65,$64,$20,$61,$74
+	.byte	$20,$25,$75,$0A,$00
+L0079:
+	.byte	$66,$77,$72,$69,$74,$65,$20,$66,$61,$69,$6C,$65,$64,$20,$61,$74
+	.byte	$20,$25,$75,$0A,$00
+L0174:
+	.byte	$66,$73,$65,$65,$6B,$20,$66,$61,$69,$6C,$65,$64,$20,$61,$74,$20
+	.byte	$25,$75,$0A,$00
+L0167:
+	.byte	$66,$6C,$75,$73,$68,$3A,$20,$25,$64,$20,$61,$74,$20,$25,$75,$0A
+	.byte	$00
+L014E	:=	L0167+0
+L009F:
+	.byte	$66,$67,$65,$74,$63,$3A,$20,$25,$64,$20,$61,$74,$20,$25,$75,$0A
+	.byte	$00
+L017F:
+	.byte	$75,$73,$61,$67,$65,$3A,$20,$25,$73,$20,$66,$69,$6C,$65,$0A,$00
+L0029:
+	.byte	$63,$61,$6E,$6E,$6F,$74,$20,$6F,$70,$65,$6E,$20,$25,$73,$0A,$00
+L0084:
+	.byte	$66,$63,$6C,$6F,$73,$65,$20,$66,$61,$69,$6C,$65,$64,$0A,$00
+L00B5:
+	.byte	$72,$62,$00
+L008A	:=	L00B5+0
+L00F5	:=	L00B5+0
+L0033:
+	.byte	$77,$62,$00
+L013A	:=	L00B5+0
+
+.segment	"BSS"
+
+_line:
+	.res	65,$00
+_block:
+	.res	600,$00
+
+; ---------------------------------------------------------------
+; unsigned char __near__ expect (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_expect: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$00
+	lda     (sp),y
+	and     #$3F
+	cmp     #$3F
+	bne     L0005
+	ldx     #$00
+	lda     #$0A
+	jmp     incsp2
+L0005:	iny
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     shrax4
+	eor     (sp),y
+	pha
+	txa
+	iny
+	eor     (sp),y
+	pla
+	and     #$0F
+	clc
+	adc     #$41
+	ldx     #$00
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ make_line (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_make_line: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp1
+	lda     #$00
+	tay
+	jmp     L0198
+L0014:	lda     #<(_line)
+	ldx     #>(_line)
+	ldy     #$00
+	clc
+	adc     (sp),y
+	bcc     L001B
+	inx
+L001B:	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	clc
+	iny
+	adc     (sp),y
+	pha
+	lda     #$00
+	iny
+	adc     (sp),y
+	tax
+	pla
+	jsr     _expect
+	ldy     #$00
+	jsr     staspidx
+	ldy     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+L0198:	sta     (sp),y
+	cmp     #$40
+	bcc     L0014
+	sty     _line+64
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; __near__ struct _FILE * __near__ open_file (__near__ const unsigned char *, __near__ const unsigned char *, __near__ unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_open_file: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fopen
+	jsr     pushax
+	ldy     #$00
+	lda     (sp),y
+	iny
+	ora     (sp),y
+	bne     L0199
+	lda     #<(L0029)
+	ldx     #>(L0029)
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+	ldy     #$01
+L0199:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ write_file (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_write_file: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp4
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$02
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	lda     #<(L0033)
+	ldy     #$00
+	sta     (sp),y
+	iny
+	lda     #>(L0033)
+	sta     (sp),y
+	ldx     #$00
+	txa
+	jsr     _open_file
+	jsr     pushax
+	jsr     decsp4
+	ldy     #$02
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L019B
+L0039:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _expect
+	jsr     pusha0
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fputc
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$03
+L019B:	lda     (sp),y
+	cmp     #$0C
+	bne     L003E
+	dey
+	lda     (sp),y
+	cmp     #$80
+L003E:	bcc     L0039
+	ldy     #$00
+	tya
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L019C
+L0047:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _make_line
+	lda     #<(_line)
+	ldx     #>(_line)
+	jsr     pushax
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fputs
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$02
+	ldx     #$00
+	lda     #$40
+	jsr     addeqysp
+	ldy     #$01
+L019C:	lda     (sp),y
+	cmp     #$00
+	bne     L004B
+	dey
+	lda     (sp),y
+	cmp     #$0A
+L004B:	bcc     L0047
+	jmp     L0056
+L0054:	ldy     #$02
+	lda     (sp),y
+	and     #$01
+	beq     L005B
+	ldx     #$00
+	lda     #$0D
+	jmp     L005D
+L005B:	ldx     #$02
+	lda     #$58
+L005D:	jsr     pushax
+	jsr     pushw0sp
+	lda     #$00
+	sec
+	ldy     #$06
+	sbc     (sp),y
+	pha
+	lda     #$19
+	iny
+	sbc     (sp),y
+	tax
+	pla
+	jsr     tosicmp
+	bcc     L0060
+	beq     L0060
+	lda     #$00
+	sec
+	ldy     #$04
+	sbc     (sp),y
+	pha
+	lda     #$19
+	iny
+	sbc     (sp),y
+	tax
+	pla
+	jsr     stax0sp
+L0060:	ldy     #$02
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L019D
+L0069:	lda     #<(_block)
+	ldy     #$02
+	clc
+	adc     (sp),y
+	pha
+	lda     #>(_block)
+	iny
+	adc     (sp),y
+	tax
+	pla
+	jsr     pushax
+	ldy     #$06
+	lda     (sp),y
+	ldy     #$04
+	clc
+	adc     (sp),y
+	pha
+	ldy     #$07
+	lda     (sp),y
+	ldy     #$05
+	adc     (sp),y
+	tax
+	pla
+	jsr     _expect
+	ldy     #$00
+	jsr     staspidx
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$03
+L019D:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$00
+	cmp     (sp),y
+	txa
+	iny
+	sbc     (sp),y
+	bcc     L0069
+	jsr     decsp6
+	lda     #<(_block)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(_block)
+	sta     (sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #$00
+	sta     (sp),y
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$00
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	ldy     #$0D
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fwrite
+	ldy     #$00
+	cmp     (sp),y
+	bne     L019E
+	txa
+	iny
+	cmp     (sp),y
+	beq     L0072
+L019E:	lda     #<(L0079)
+	ldx     #>(L0079)
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0072:	ldy     #$00
+	lda     (sp),y
+	ldy     #$04
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$01
+	lda     (sp),y
+	ldy     #$05
+	adc     (sp),y
+	sta     (sp),y
+	jsr     incsp2
+L0056:	ldy     #$03
+	lda     (sp),y
+	tax
+	cpx     #$19
+	jcc     L0054
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fclose
+	cpx     #$00
+	bne     L019F
+	cmp     #$00
+	beq     L007F
+L019F:	lda     #<(L0084)
+	ldx     #>(L0084)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+L007F:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ read_chars (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_read_chars: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp4
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$02
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	lda     #<(L008A)
+	ldy     #$00
+	sta     (sp),y
+	iny
+	lda     #>(L008A)
+	sta     (sp),y
+	ldx     #$00
+	txa
+	jsr     _open_file
+	jsr     pushax
+	jsr     decsp4
+	ldy     #$02
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L008D
+L0090:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	cmp     #$00
+	txa
+	sbc     #$19
+	bcs     L01A0
+	jsr     pushw0sp
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _expect
+	jsr     tosicmp
+	beq     L0099
+L01A0:	lda     #<(L009F)
+	ldx     #>(L009F)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _printf
+	inc     _failures
+	jmp     L008E
+L0099:	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L008D:	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fgetc
+	jsr     stax0sp
+	cpx     #$FF
+	bne     L0090
+	cmp     #$FF
+	bne     L0090
+L008E:	ldy     #$03
+	lda     (sp),y
+	cmp     #$19
+	bne     L00A5
+	dey
+	lda     (sp),y
+	bne     L00A5
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _feof
+	stx     tmp1
+	ora     tmp1
+	beq     L00A5
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _ferror
+	stx     tmp1
+	ora     tmp1
+	beq     L00A4
+L00A5:	lda     #<(L00AC)
+	ldx     #>(L00AC)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L00A4:	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fclose
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ read_lines (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_read_lines: near
+
+.segment	"BSS"
+
+L00B9:
+	.res	74,$00
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp4
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$02
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	lda     #<(L00B5)
+	ldy     #$00
+	sta     (sp),y
+	iny
+	lda     #>(L00B5)
+	sta     (sp),y
+	ldx     #$00
+	txa
+	jsr     _open_file
+	jsr     pushax
+	jsr     decsp4
+	ldy     #$02
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L00BA
+L00BD:	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _make_line
+	ldy     #$00
+	jmp     L00CD
+L00CE:	tax
+	beq     L00CF
+	iny
+L00CD:	lda     L00B9,y
+	cmp     _line,y
+	beq     L00CE
+	ldx     #$01
+	bcs     L00CF
+	ldx     #$FF
+L00CF:	cpx     #$00
+	bne     L01A4
+	cmp     #$00
+	beq     L00C9
+L01A4:	lda     #<(L00D2)
+	ldx     #>(L00D2)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	jmp     L00BB
+L00C9:	ldy     #$02
+	lda     (sp),y
+	and     #$40
+	beq     L01A3
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fgetc
+	jsr     stax0sp
+	cpx     #$FF
+	bne     L01A5
+	cmp     #$FF
+	beq     L00DB
+L01A5:	jsr     pushw0sp
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _ungetc
+	ldy     #$00
+	cmp     (sp),y
+	bne     L00DC
+	txa
+	iny
+	cmp     (sp),y
+	beq     L00DB
+L00DC:	lda     #<(L00E3)
+	ldx     #>(L00E3)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L00DB:	ldy     #$02
+	ldx     #$00
+L01A3:	lda     #$40
+	jsr     addeqysp
+L00BA:	jsr     decsp4
+	lda     #<(L00B9)
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #>(L00B9)
+	sta     (sp),y
+	lda     #$4A
+	ldy     #$00
+	sta     (sp),y
+	iny
+	lda     #$00
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fgets
+	stx     tmp1
+	ora     tmp1
+	jne     L00BD
+L00BB:	ldy     #$03
+	lda     (sp),y
+	cmp     #$19
+	bne     L01A6
+	dey
+	lda     (sp),y
+	beq     L00E7
+L01A6:	lda     #<(L00EC)
+	ldx     #>(L00EC)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L00E7:	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fclose
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ read_blocks (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_read_blocks: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp4
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$02
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	lda     #<(L00F5)
+	ldy     #$00
+	sta     (sp),y
+	iny
+	lda     #>(L00F5)
+	sta     (sp),y
+	ldx     #$00
+	txa
+	jsr     _open_file
+	jsr     pushax
+	jsr     decsp8
+	ldy     #$06
+	lda     #$00
+	sta     (sp),y
+	iny
+	jmp     L01A7
+L00FB:	ldy     #$06
+	lda     (sp),y
+	and     #$01
+	beq     L0105
+	ldx     #$00
+	lda     #$11
+	jmp     L0107
+L0105:	ldx     #$02
+	lda     #$58
+L0107:	ldy     #$02
+	jsr     staxysp
+	jsr     decsp6
+	lda     #<(_block)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(_block)
+	sta     (sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #$00
+	sta     (sp),y
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$00
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fread
+	jsr     stax0sp
+	cpx     #$00
+	bne     L01AA
+	cmp     #$00
+	jeq     L00F9
+L01AA:	ldy     #$04
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L01A9
+L0116:	lda     #<(_block)
+	ldy     #$04
+	clc
+	adc     (sp),y
+	sta     ptr1
+	lda     #>(_block)
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	ldx     #$00
+	lda     (ptr1,x)
+	jsr     pusha0
+	ldy     #$08
+	lda     (sp),y
+	ldy     #$06
+	clc
+	adc     (sp),y
+	pha
+	ldy     #$09
+	lda     (sp),y
+	ldy     #$07
+	adc     (sp),y
+	tax
+	pla
+	jsr     _expect
+	jsr     tosicmp
+	beq     L011B
+	lda     #<(L0120)
+	ldx     #>(L0120)
+	jsr     pushax
+	ldy     #$08
+	lda     (sp),y
+	ldy     #$06
+	clc
+	adc     (sp),y
+	pha
+	ldy     #$09
+	lda     (sp),y
+	ldy     #$07
+	adc     (sp),y
+	tax
+	pla
+	jmp     L01AE
+L011B:	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$05
+L01A9:	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$00
+	cmp     (sp),y
+	txa
+	iny
+	sbc     (sp),y
+	bcc     L0116
+	dey
+	lda     (sp),y
+	ldy     #$06
+	clc
+	adc     (sp),y
+	sta     (sp),y
+	ldy     #$01
+	lda     (sp),y
+	ldy     #$07
+	adc     (sp),y
+L01A7:	sta     (sp),y
+	lda     (sp),y
+	tax
+	cpx     #$19
+	jcc     L00FB
+L00F9:	ldy     #$07
+	lda     (sp),y
+	cmp     #$19
+	bne     L0126
+	dey
+	lda     (sp),y
+	bne     L0126
+	jsr     decsp6
+	lda     #<(_block)
+	ldy     #$04
+	sta     (sp),y
+	iny
+	lda     #>(_block)
+	sta     (sp),y
+	lda     #$01
+	ldy     #$02
+	sta     (sp),y
+	iny
+	lda     #$00
+	sta     (sp),y
+	lda     #$01
+	ldy     #$00
+	sta     (sp),y
+	iny
+	lda     #$00
+	sta     (sp),y
+	ldy     #$0F
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fread
+	cpx     #$00
+	bne     L0126
+	cmp     #$00
+	bne     L0126
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _feof
+	stx     tmp1
+	ora     tmp1
+	bne     L0125
+L0126:	lda     #<(L0131)
+	ldx     #>(L0131)
+	jsr     pushax
+	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+L01AE:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0125:	ldy     #$09
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fclose
+	ldy     #$0C
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ read_flush (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_read_flush: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp4
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$02
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	lda     #<(L013A)
+	ldy     #$00
+	sta     (sp),y
+	iny
+	lda     #>(L013A)
+	sta     (sp),y
+	ldx     #$00
+	txa
+	jsr     _open_file
+	jsr     pushax
+	jsr     decsp4
+	ldy     #$02
+	lda     #$00
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jmp     L01AF
+L0140:	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fgetc
+	jsr     stax0sp
+	jsr     pushax
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _expect
+	jsr     tosicmp
+	beq     L0147
+	lda     #<(L014E)
+	ldx     #>(L014E)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _printf
+	inc     _failures
+	jmp     L013E
+L0147:	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fflush
+	cpx     #$00
+	bne     L0154
+	cmp     #$00
+	bne     L0154
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _ftell
+	jsr     pusheax
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$01
+	bcc     L0158
+	inx
+L0158:	ldy     #$00
+	sty     sreg
+	sty     sreg+1
+	jsr     tosneeax
+	beq     L0153
+L0154:	lda     #<(L015B)
+	ldx     #>(L015B)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	jmp     L013E
+L0153:	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fgetc
+	jsr     stax0sp
+	jsr     pushax
+	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$01
+	bcc     L0165
+	inx
+L0165:	jsr     _expect
+	jsr     tosicmp
+	beq     L015F
+	lda     #<(L0167)
+	ldx     #>(L0167)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$07
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	clc
+	adc     #$01
+	bcc     L016B
+	inx
+L016B:	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	inc     _failures
+	jmp     L013E
+L015F:	jsr     decsp6
+	ldy     #$0B
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	ldy     #$04
+	sta     (sp),y
+	iny
+	txa
+	sta     (sp),y
+	ldx     #$00
+	ldy     #$00
+	lda     #$62
+	sta     (sp),y
+	txa
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	iny
+	sta     (sp),y
+	jsr     _fseek
+	cpx     #$00
+	bne     L01B0
+	cmp     #$00
+	beq     L016D
+L01B0:	lda     #<(L0174)
+	ldx     #>(L0174)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	jmp     L013E
+L016D:	ldy     #$02
+	lda     #$64
+	jsr     addeqysp
+	ldy     #$03
+L01AF:	lda     (sp),y
+	tax
+	cpx     #$19
+	jcc     L0140
+L013E:	ldy     #$05
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     _fclose
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int, __near__ unsigned char * *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldy     #$03
+	lda     (sp),y
+	bne     L01B1
+	dey
+	lda     (sp),y
+	cmp     #$02
+	beq     L017B
+L01B1:	lda     #<(L017F)
+	ldx     #>(L017F)
+	jsr     pushax
+	ldy     #$03
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	dey
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     incsp4
+L017B:	dey
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$03
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     _write_file
+	ldy     #$01
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$03
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     _read_chars
+	ldy     #$01
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$03
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     _read_lines
+	ldy     #$01
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$03
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     _read_blocks
+	ldy     #$01
+	lda     (sp),y
+	sta     ptr1+1
+	dey
+	lda     (sp),y
+	sta     ptr1
+	ldy     #$03
+	lda     (ptr1),y
+	tax
+	dey
+	lda     (ptr1),y
+	jsr     _read_flush
+	lda     _failures
+	beq     L0194
+	ldx     #$00
+	lda     #$01
+	jmp     incsp4
+L0194:	tax
+	jmp     incsp4
+
+.endproc
+
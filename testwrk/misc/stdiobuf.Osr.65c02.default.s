@@ -0,0 +1,994 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.import		_fclose
+	.import		_feof
+	.import		_ferror
+	.import		_fflush
+	.import		_fgetc
+	.import		_fgets
+	.import		_fopen
+	.import		_fputc
+	.import		_fputs
+	.import		_fread
+	.import		_fwrite
+	.import		_ftell
+	.import		_fseek
+	.import		_printf
+	.import		_setvbuf
+	.import		_ungetc
+	.import		_exit
+	.import		_strcmp
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+L0162:
+	.byte	$66,$6C,$75,$73,$68,$3A,$20,$62,$61,$64,$20,$70,$6F,$73,$69,$74
+	.byte	$69,$6F,$6E,$20,$61,$74,$20,$25,$75,$0A,$00
+L00D9:
+	.byte	$66,$67,$65,$74,$73,$3A,$20,$62,$61,$64,$20,$6C,$69,$6E,$65,$20
+	.byte	$61,$74,$20,$25,$75,$0A,$00
+L0127:
+	.byte	$66,$72,$65,$61,$64,$3A,$20,$62,$61,$64,$20,$64,$61,$74,$61,$20
+	.byte	$61,$74,$20,$25,$75,$0A,$00
+L00F3:
+	.byte	$66,$67,$65,$74,$73,$3A,$20,$25,$75,$20,$63,$68,$61,$72,$73,$20
+	.byte	$72,$65,$61,$64,$0A,$00
+L00B6:
+	.byte	$66,$67,$65,$74,$63,$3A,$20,$25,$75,$20,$63,$68,$61,$72,$73,$20
+	.byte	$72,$65,$61,$64,$0A,$00
+L0138:
+	.byte	$66,$72,$65,$61,$64,$3A,$20,$25,$75,$20,$63,$68,$61,$72,$73,$20
+	.byte	$72,$65,$61,$64,$0A,$00
+L0083:
+	.byte	$66,$77,$72,$69,$74,$65,$20,$66,$61,$69,$6C,$65,$64,$20,$61,$74
+	.byte	$20,$25,$75,$0A,$00
+L00EA:
+	.byte	$75,$6E,$67,$65,$74,$63,$20,$66,$61,$69,$6C,$65,$64,$20,$61,$74
+	.byte	$20,$25,$75,$0A,$00
+L017B:
+	.byte	$66,$73,$65,$65,$6B,$20,$66,$61,$69,$6C,$65,$64,$20,$61,$74,$20
+	.byte	$25,$75,$0A,$00
+L016E:
+	.byte	$66,$6C,$75,$73,$68,$3A,$20,$25,$64,$20,$61,$74,$20,$25,$75,$0A
+	.byte	$00
+L0155	:=	L016E+0
+L00A9:
+	.byte	$66,$67,$65,$74,$63,$3A,$20,$25,$64,$20,$61,$74,$20,$25,$75,$0A
+	.byte	$00
+L0036:
+	.byte	$73,$65,$74,$76,$62,$75,$66,$20,$66,$61,$69,$6C,$65,$64,$0A,$00
+L0186:
+	.byte	$75,$73,$61,$67,$65,$3A,$20,$25,$73,$20,$66,$69,$6C,$65,$0A,$00
+L0029:
+	.byte	$63,$61,$6E,$6E,$6F,$74,$20,$6F,$70,$65,$6E,$20,$25,$73,$0A,$00
+L008E:
+	.byte	$66,$63,$6C,$6F,$73,$65,$20,$66,$61,$69,$6C,$65,$64,$0A,$00
+L00BF:
+	.byte	$72,$62,$00
+L0094	:=	L00BF+0
+L00FC	:=	L00BF+0
+L003D:
+	.byte	$77,$62,$00
+L0141	:=	L00BF+0
+
+.segment	"BSS"
+
+_readbuf:
+	.res	256,$00
+_line:
+	.res	65,$00
+_block:
+	.res	600,$00
+
+; ---------------------------------------------------------------
+; unsigned char __near__ expect (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_expect: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     (sp)
+	and     #$3F
+	cmp     #$3F
+	bne     L0006
+	ldx     #$00
+	lda     #$0A
+	jmp     incsp2
+L0006:	jsr     ldax0sp
+	jsr     shrax4
+	eor     (sp)
+	pha
+	txa
+	ldy     #$01
+	eor     (sp),y
+	pla
+	ldx     #$00
+	and     #$0F
+	ldy     #$41
+	jsr     incaxy
+	ldx     #$00
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ make_line (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_make_line: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     decsp1
+	lda     #$00
+	bra     L019F
+L0014:	lda     #<(_line)
+	ldx     #>(_line)
+	clc
+	adc     (sp)
+	bcc     L001B
+	inx
+L001B:	jsr     pushax
+	ldy     #$02
+	lda     (sp),y
+	clc
+	iny
+	adc     (sp),y
+	pha
+	lda     #$00
+	iny
+	adc     (sp),y
+	tax
+	pla
+	jsr     _expect
+	ldy     #$00
+	jsr     staspidx
+	clc
+	lda     #$01
+	adc     (sp)
+L019F:	sta     (sp)
+	cmp     #$40
+	bcc     L0014
+	stz     _line+64
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; __near__ struct _FILE * __near__ open_file (__near__ const unsigned char *, __near__ const unsigned char *, __near__ unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_open_file: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fopen
+	jsr     pushax
+	lda     (sp)
+	ldy     #$01
+	ora     (sp),y
+	bne     L01A0
+	lda     #<(L0029)
+	ldx     #>(L0029)
+	jsr     pushax
+	ldy     #$0B
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+L01A0:	jsr     pushw0sp
+	ldy     #$07
+	jsr     pushwysp
+	jsr     push0
+	ldx     #$01
+	jsr     _setvbuf
+	cpx     #$00
+	bne     L01A1
+	cmp     #$00
+	beq     L002E
+L01A1:	lda     #<(L0036)
+	ldx     #>(L0036)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+L002E:	jsr     ldax0sp
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ write_file (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_write_file: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     pushw0sp
+	lda     #<(L003D)
+	ldx     #>(L003D)
+	jsr     pushax
+	ldx     #$00
+	txa
+	jsr     _open_file
+	jsr     pushax
+	jsr     decsp4
+	ldx     #$00
+	txa
+	ldy     #$02
+	jsr     staxysp
+	bra     L0040
+L0043:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _expect
+	jsr     pusha0
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _fputc
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0040:	ldy     #$03
+	lda     (sp),y
+	cmp     #$0C
+	bne     L0048
+	dey
+	lda     (sp),y
+	cmp     #$80
+L0048:	bcc     L0043
+	ldx     #$00
+	txa
+	jsr     stax0sp
+	bra     L004E
+L0051:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _make_line
+	lda     #<(_line)
+	ldx     #>(_line)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _fputs
+	ldx     #$00
+	lda     #$01
+	jsr     addeq0sp
+	ldy     #$02
+	ldx     #$00
+	lda     #$40
+	jsr     addeqysp
+L004E:	ldy     #$01
+	lda     (sp),y
+	cmp     #$00
+	bne     L0055
+	lda     (sp)
+	cmp     #$0A
+L0055:	bcc     L0051
+	jmp     L0060
+L005E:	ldy     #$02
+	lda     (sp),y
+	and     #$01
+	beq     L0065
+	ldx     #$00
+	lda     #$0D
+	bra     L0067
+L0065:	ldx     #$02
+	lda     #$58
+L0067:	jsr     pushax
+	jsr     pushw0sp
+	lda     #$00
+	sec
+	ldy     #$06
+	sbc     (sp),y
+	pha
+	lda     #$19
+	iny
+	sbc     (sp),y
+	tax
+	pla
+	jsr     tosicmp
+	bcc     L006A
+	beq     L006A
+	lda     #$00
+	sec
+	ldy     #$04
+	sbc     (sp),y
+	pha
+	lda     #$19
+	iny
+	sbc     (sp),y
+	tax
+	pla
+	jsr     stax0sp
+L006A:	ldx     #$00
+	txa
+	ldy     #$02
+	jsr     staxysp
+	bra     L0070
+L0073:	lda     #<(_block)
+	ldy     #$02
+	clc
+	adc     (sp),y
+	pha
+	lda     #>(_block)
+	iny
+	adc     (sp),y
+	tax
+	pla
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	clc
+	ldy     #$06
+	adc     (sp),y
+	pha
+	txa
+	iny
+	adc     (sp),y
+	tax
+	pla
+	jsr     _expect
+	ldy     #$00
+	jsr     staspidx
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0070:	ldy     #$03
+	jsr     ldaxysp
+	cmp     (sp)
+	txa
+	ldy     #$01
+	sbc     (sp),y
+	bcc     L0073
+	lda     #<(_block)
+	ldx     #>(_block)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     _fwrite
+	cmp     (sp)
+	bne     L01A3
+	txa
+	ldy     #$01
+	cmp     (sp),y
+	beq     L01A5
+L01A3:	lda     #<(L0083)
+	ldx     #>(L0083)
+	jsr     pushax
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L01A5:	jsr     ldax0sp
+	ldy     #$04
+	jsr     addeqysp
+	jsr     incsp2
+L0060:	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$19
+	jcc     L005E
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fclose
+	cpx     #$00
+	bne     L01A4
+	cmp     #$00
+	beq     L0089
+L01A4:	lda     #<(L008E)
+	ldx     #>(L008E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	inc     _failures
+L0089:	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ read_chars (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_read_chars: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     pushw0sp
+	lda     #<(L0094)
+	ldx     #>(L0094)
+	jsr     pushax
+	lda     #<(_readbuf)
+	ldx     #>(_readbuf)
+	jsr     _open_file
+	jsr     pushax
+	jsr     decsp4
+	ldx     #$00
+	txa
+	ldy     #$02
+	jsr     staxysp
+	bra     L0097
+L009A:	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$00
+	txa
+	sbc     #$19
+	bcs     L01A6
+	jsr     pushw0sp
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _expect
+	jsr     tosicmp
+	beq     L00A3
+L01A6:	lda     #<(L00A9)
+	ldx     #>(L00A9)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _printf
+	inc     _failures
+	bra     L0098
+L00A3:	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0097:	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fgetc
+	jsr     stax0sp
+	cpx     #$FF
+	bne     L009A
+	cmp     #$FF
+	bne     L009A
+L0098:	ldy     #$03
+	lda     (sp),y
+	cmp     #$19
+	bne     L00AF
+	dey
+	lda     (sp),y
+	bne     L00AF
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _feof
+	stx     tmp1
+	ora     tmp1
+	beq     L00AF
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _ferror
+	stx     tmp1
+	ora     tmp1
+	beq     L00AE
+L00AF:	lda     #<(L00B6)
+	ldx     #>(L00B6)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L00AE:	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fclose
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ read_lines (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_read_lines: near
+
+.segment	"BSS"
+
+L00C3:
+	.res	74,$00
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     pushw0sp
+	lda     #<(L00BF)
+	ldx     #>(L00BF)
+	jsr     pushax
+	lda     #<(_readbuf)
+	ldx     #>(_readbuf)
+	jsr     _open_file
+	jsr     pushax
+	jsr     decsp4
+	ldx     #$00
+	txa
+	ldy     #$02
+	jsr     staxysp
+	jmp     L00C4
+L00C7:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _make_line
+	lda     #<(L00C3)
+	ldx     #>(L00C3)
+	jsr     pushax
+	lda     #<(_line)
+	ldx     #>(_line)
+	jsr     _strcmp
+	cpx     #$00
+	bne     L01AA
+	cmp     #$00
+	beq     L00D3
+L01AA:	lda     #<(L00D9)
+	ldx     #>(L00D9)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bra     L00C5
+L00D3:	ldy     #$02
+	lda     (sp),y
+	and     #$40
+	beq     L01A9
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fgetc
+	jsr     stax0sp
+	cpx     #$FF
+	bne     L01AB
+	cmp     #$FF
+	beq     L00E2
+L01AB:	jsr     pushw0sp
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _ungetc
+	cmp     (sp)
+	bne     L00E3
+	txa
+	ldy     #$01
+	cmp     (sp),y
+	beq     L00E2
+L00E3:	lda     #<(L00EA)
+	ldx     #>(L00EA)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L00E2:	ldy     #$02
+	ldx     #$00
+L01A9:	lda     #$40
+	jsr     addeqysp
+L00C4:	lda     #<(L00C3)
+	ldx     #>(L00C3)
+	jsr     pushax
+	lda     #$4A
+	jsr     pusha0
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     _fgets
+	stx     tmp1
+	ora     tmp1
+	jne     L00C7
+L00C5:	ldy     #$03
+	lda     (sp),y
+	cmp     #$19
+	bne     L01AC
+	dey
+	lda     (sp),y
+	beq     L00EE
+L01AC:	lda     #<(L00F3)
+	ldx     #>(L00F3)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L00EE:	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fclose
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ read_blocks (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_read_blocks: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     pushw0sp
+	lda     #<(L00FC)
+	ldx     #>(L00FC)
+	jsr     pushax
+	lda     #<(_readbuf)
+	ldx     #>(_readbuf)
+	jsr     _open_file
+	jsr     pushax
+	jsr     decsp8
+	ldx     #$00
+	txa
+	ldy     #$06
+	jsr     staxysp
+	jmp     L00FF
+L0102:	ldy     #$06
+	lda     (sp),y
+	and     #$01
+	beq     L010C
+	ldx     #$00
+	lda     #$11
+	bra     L010E
+L010C:	ldx     #$02
+	lda     #$58
+L010E:	ldy     #$02
+	jsr     staxysp
+	lda     #<(_block)
+	ldx     #>(_block)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     _fread
+	jsr     stax0sp
+	cpx     #$00
+	bne     L01AE
+	cmp     #$00
+	beq     L0100
+L01AE:	ldx     #$00
+	txa
+	ldy     #$04
+	jsr     staxysp
+	bra     L011A
+L011D:	lda     #<(_block)
+	ldy     #$04
+	clc
+	adc     (sp),y
+	sta     ptr1
+	lda     #>(_block)
+	iny
+	adc     (sp),y
+	sta     ptr1+1
+	lda     (ptr1)
+	jsr     pusha0
+	ldy     #$07
+	jsr     ldaxysp
+	clc
+	ldy     #$08
+	adc     (sp),y
+	pha
+	txa
+	iny
+	adc     (sp),y
+	tax
+	pla
+	jsr     _expect
+	jsr     tosicmp
+	beq     L0122
+	lda     #<(L0127)
+	ldx     #>(L0127)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	clc
+	ldy     #$08
+	adc     (sp),y
+	pha
+	txa
+	iny
+	adc     (sp),y
+	tax
+	pla
+	bra     L01B2
+L0122:	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L011A:	ldy     #$05
+	jsr     ldaxysp
+	cmp     (sp)
+	txa
+	ldy     #$01
+	sbc     (sp),y
+	bcc     L011D
+	jsr     ldax0sp
+	ldy     #$06
+	jsr     addeqysp
+L00FF:	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$19
+	jcc     L0102
+L0100:	ldy     #$07
+	lda     (sp),y
+	cmp     #$19
+	bne     L012D
+	dey
+	lda     (sp),y
+	bne     L012D
+	lda     #<(_block)
+	ldx     #>(_block)
+	jsr     pushax
+	lda     #$01
+	jsr     pusha0
+	jsr     pusha0
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     _fread
+	cpx     #$00
+	bne     L012D
+	cmp     #$00
+	bne     L012D
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     _feof
+	stx     tmp1
+	ora     tmp1
+	bne     L012C
+L012D:	lda     #<(L0138)
+	ldx     #>(L0138)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+L01B2:	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L012C:	ldy     #$09
+	jsr     ldaxysp
+	jsr     _fclose
+	ldy     #$0C
+	jmp     addysp
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ read_flush (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_read_flush: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	jsr     pushw0sp
+	lda     #<(L0141)
+	ldx     #>(L0141)
+	jsr     pushax
+	lda     #<(_readbuf)
+	ldx     #>(_readbuf)
+	jsr     _open_file
+	jsr     pushax
+	jsr     decsp4
+	ldx     #$00
+	txa
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0144
+L0147:	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fgetc
+	jsr     stax0sp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _expect
+	jsr     tosicmp
+	beq     L014E
+	lda     #<(L0155)
+	ldx     #>(L0155)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$09
+	jsr     pushwysp
+	ldy     #$06
+	jsr     _printf
+	inc     _failures
+	jmp     L0145
+L014E:	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fflush
+	cpx     #$00
+	bne     L015B
+	cmp     #$00
+	bne     L015B
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _ftell
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldaxysp
+	ina
+	bne     L015F
+	inx
+L015F:	jsr     axulong
+	jsr     tosneeax
+	beq     L015A
+L015B:	lda     #<(L0162)
+	ldx     #>(L0162)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	jmp     L0145
+L015A:	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fgetc
+	jsr     stax0sp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	ina
+	bne     L016C
+	inx
+L016C:	jsr     _expect
+	jsr     tosicmp
+	beq     L0166
+	lda     #<(L016E)
+	ldx     #>(L016E)
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$07
+	jsr     ldaxysp
+	ina
+	bne     L0172
+	inx
+L0172:	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	inc     _failures
+	bra     L0145
+L0166:	ldy     #$07
+	jsr     pushwysp
+	ldx     #$00
+	lda     #$62
+	jsr     push0ax
+	txa
+	jsr     _fseek
+	cpx     #$00
+	bne     L01B3
+	cmp     #$00
+	beq     L0174
+L01B3:	lda     #<(L017B)
+	ldx     #>(L017B)
+	jsr     pushax
+	ldy     #$07
+	jsr     pushwysp
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+	bra     L0145
+L0174:	ldy     #$02
+	lda     #$64
+	jsr     addeqysp
+L0144:	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$19
+	jcc     L0147
+L0145:	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fclose
+	jmp     incsp8
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int, __near__ unsigned char * *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	ldy     #$03
+	lda     (sp),y
+	bne     L01B4
+	dey
+	lda     (sp),y
+	cmp     #$02
+	beq     L0182
+L01B4:	lda     #<(L0186)
+	ldx     #>(L0186)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushw
+	ldy     #$04
+	jsr     _printf
+	ldx     #$00
+	lda     #$01
+	jmp     incsp4
+L0182:	jsr     ldax0sp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     _write_file
+	jsr     ldax0sp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     _read_chars
+	jsr     ldax0sp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     _read_lines
+	jsr     ldax0sp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     _read_blocks
+	jsr     ldax0sp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     _read_flush
+	lda     _failures
+	beq     L019B
+	ldx     #$00
+	lda     #$01
+	jmp     incsp4
+L019B:	tax
+	jmp     incsp4
+
+.endproc
+
@@ -0,0 +1,1362 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "stdiobuf.c", 5803, 1792389889
+	.dbg		file, "/root/repo/include/stdio.h", 6363, 1792382670
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1515150330
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1515150330
+	.dbg		file, "/root/repo/include/stdlib.h", 5748, 1515150330
+	.dbg		file, "/root/repo/include/string.h", 5041, 1515150330
+	.forceimport	__STARTUP__
+	.forceimport	initmainargs
+	.dbg		sym, "fclose", "00", extern, "_fclose"
+	.dbg		sym, "feof", "00", extern, "_feof"
+	.dbg		sym, "ferror", "00", extern, "_ferror"
+	.dbg		sym, "fflush", "00", extern, "_fflush"
+	.dbg		sym, "fgetc", "00", extern, "_fgetc"
+	.dbg		sym, "fgets", "00", extern, "_fgets"
+	.dbg		sym, "fopen", "00", extern, "_fopen"
+	.dbg		sym, "fputc", "00", extern, "_fputc"
+	.dbg		sym, "fputs", "00", extern, "_fputs"
+	.dbg		sym, "fread", "00", extern, "_fread"
+	.dbg		sym, "fwrite", "00", extern, "_fwrite"
+	.dbg		sym, "ftell", "00", extern, "_ftell"
+	.dbg		sym, "fseek", "00", extern, "_fseek"
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.dbg		sym, "setvbuf", "00", extern, "_setvbuf"
+	.dbg		sym, "ungetc", "00", extern, "_ungetc"
+	.dbg		sym, "exit", "00", extern, "_exit"
+	.dbg		sym, "strcmp", "00", extern, "_strcmp"
+	.import		_fclose
+	.import		_feof
+	.import		_ferror
+	.import		_fflush
+	.import		_fgetc
+	.import		_fgets
+	.import		_fopen
+	.import		_fputc
+	.import		_fputs
+	.import		_fread
+	.import		_fwrite
+	.import		_ftell
+	.import		_fseek
+	.import		_printf
+	.import		_setvbuf
+	.import		_ungetc
+	.import		_exit
+	.import		_strcmp
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+L0161:
+	.byte	$66,$6C,$75,$73,$68,$3A,$20,$62,$61,$64,$20,$70,$6F,$73,$69,$74
+	.byte	$69,$6F,$6E,$20,$61,$74,$20,$25,$75,$0A,$00
+L00D9:
+	.byte	$66,$67,$65,$74,$73,$3A,$20,$62,$61,$64,$20,$6C,$69,$6E,$65,$20
+	.byte	$61,$74,$20,$25,$75,$0A,$00
+L0127:
+	.byte	$66,$72,$65,$61,$64,$3A,$20,$62,$61,$64,$20,$64,$61,$74,$61,$20
+	.byte	$61,$74,$20,$25,$75,$0A,$00
+L00F3:
+	.byte	$66,$67,$65,$74,$73,$3A,$20,$25,$75,$20,$63,$68,$61,$72,$73,$20
+	.byte	$72,$65,$61,$64,$0A,$00
+L00B6:
+	.byte	$66,$67,$65,$74,$63,$3A,$20,$25,$75,$20,$63,$68,$61,$72,$73,$20
+	.byte	$72,$65,$61,$64,$0A,$00
+L0138:
+	.byte	$66,$72,$65,$61,$64,$3A,$20,$25,$75,$20,$63,$68,$61,$72,$73,$20
+	.byte	$72,$65,$61,$64,$0A,$00
+L0083:
+	.byte	$66,$77,$72,$69,$74,$65,$20,$66,$61,$69,$6C,$65,$64,$20,$61,$74
+	.byte	$20,$25,$75,$0A,$00
+L00EA:
+	.byte	$75,$6E,$67,$65,$74,$63,$20,$66,$61,$69,$6C,$65,$64,$20,$61,$74
+	.byte	$20,$25,$75,$0A,$00
+L0178:
+	.byte	$66,$73,$65,$65,$6B,$20,$66,$61,$69,$6C,$65,$64,$20,$61,$74,$20
+	.byte	$25,$75,$0A,$00
+L016C:
+	.byte	$66,$6C,$75,$73,$68,$3A,$20,$25,$64,$20,$61,$74,$20,$25,$75,$0A
+	.byte	$00
+L0155	:=	L016C+0
+L00A9:
+	.byte	$66,$67,$65,$74,$63,$3A,$20,$25,$64,$20,$61,$74,$20,$25,$75,$0A
+	.byte	$00
+L0036:
+	.byte	$73,$65,$74,$76,$62,$75,$66,$20,$66,$61,$69,$6C,$65,$64,$0A,$00
+L0183:
+	.byte	$75,$73,$61,$67,$65,$3A,$20,$25,$73,$20,$66,$69,$6C,$65,$0A,$00
+L0029:
+	.byte	$63,$61,$6E,$6E,$6F,$74,$20,$6F,$70,$65,$6E,$20,$25,$73,$0A,$00
+L008E:
+	.byte	$66,$63,$6C,$6F,$73,$65,$20,$66,$61,$69,$6C,$65,$64,$0A,$00
+L00BF:
+	.byte	$72,$62,$00
+L0094	:=	L00BF+0
+L00FC	:=	L00BF+0
+L003D:
+	.byte	$77,$62,$00
+L0141	:=	L00BF+0
+
+.segment	"BSS"
+
+_readbuf:
+	.res	256,$00
+_line:
+	.res	65,$00
+_block:
+	.res	600,$00
+
+; ---------------------------------------------------------------
+; unsigned char __near__ expect (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_expect: near
+
+	.dbg	func, "expect", "00", static, "_expect"
+	.dbg	sym, "p", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "stdiobuf.c", 43
+	jsr     pushax
+	.dbg	line, "stdiobuf.c", 45
+	ldy     #$01
+	jsr     ldaxysp
+	ldx     #$00
+	and     #$3F
+	cpx     #$00
+	bne     L000A
+	cmp     #$3F
+L000A:	jsr     booleq
+	jeq     L0006
+	.dbg	line, "stdiobuf.c", 46
+	ldx     #$00
+	lda     #$0A
+	jmp     L0005
+	.dbg	line, "stdiobuf.c", 48
+L0006:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     shrax4
+	jsr     tosxorax
+	ldx     #$00
+	and     #$0F
+	ldy     #$41
+	jsr     incaxy
+	ldx     #$00
+	jmp     L0005
+	.dbg	line, "stdiobuf.c", 49
+L0005:	jsr     incsp2
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ make_line (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_make_line: near
+
+	.dbg	func, "make_line", "00", static, "_make_line"
+	.dbg	sym, "p", "00", auto, 0
+	.dbg	sym, "i", "00", auto, -1
+
+.segment	"CODE"
+
+	.dbg	line, "stdiobuf.c", 52
+	jsr     pushax
+	.dbg	line, "stdiobuf.c", 55
+	jsr     decsp1
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	sta     (sp),y
+	jmp     L0011
+	.dbg	line, "stdiobuf.c", 56
+L0014:	lda     #<(_line)
+	ldx     #>(_line)
+	ldy     #$00
+	clc
+	adc     (sp),y
+	bcc     L001B
+	inx
+L001B:	jsr     pushax
+	ldy     #$04
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	jsr     tosaddax
+	jsr     _expect
+	ldy     #$00
+	jsr     staspidx
+	.dbg	line, "stdiobuf.c", 55
+	ldy     #$00
+	ldx     #$00
+	clc
+	lda     #$01
+	adc     (sp),y
+	sta     (sp),y
+L0011:	ldy     #$00
+	ldx     #$00
+	lda     (sp),y
+	cmp     #$40
+	jsr     boolult
+	jne     L0014
+	.dbg	line, "stdiobuf.c", 58
+	ldx     #$00
+	lda     #$00
+	sta     _line+64
+	.dbg	line, "stdiobuf.c", 59
+	jsr     incsp3
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; __near__ struct _FILE * __near__ open_file (__near__ const unsigned char *, __near__ const unsigned char *, __near__ unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_open_file: near
+
+	.dbg	func, "open_file", "00", static, "_open_file"
+	.dbg	sym, "name", "00", auto, 4
+	.dbg	sym, "mode", "00", auto, 2
+	.dbg	sym, "buf", "00", auto, 0
+	.dbg	sym, "f", "00", auto, -2
+
+.segment	"CODE"
+
+	.dbg	line, "stdiobuf.c", 62
+	jsr     pushax
+	.dbg	line, "stdiobuf.c", 63
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fopen
+	jsr     pushax
+	.dbg	line, "stdiobuf.c", 65
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0027
+	cmp     #$00
+L0027:	jsr     booleq
+	jeq     L0025
+	.dbg	line, "stdiobuf.c", 66
+	lda     #<(L0029)
+	ldx     #>(L0029)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "stdiobuf.c", 67
+	ldx     #$00
+	lda     #$01
+	jsr     _exit
+	.dbg	line, "stdiobuf.c", 70
+L0025:	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     pushax
+	ldx     #$01
+	lda     #$00
+	jsr     _setvbuf
+	cpx     #$00
+	bne     L0034
+	cmp     #$00
+L0034:	jsr     boolne
+	jeq     L002E
+	.dbg	line, "stdiobuf.c", 71
+	lda     #<(L0036)
+	ldx     #>(L0036)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "stdiobuf.c", 72
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "stdiobuf.c", 77
+L002E:	ldy     #$01
+	jsr     ldaxysp
+	jmp     L0021
+	.dbg	line, "stdiobuf.c", 78
+L0021:	jsr     incsp8
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ write_file (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_write_file: near
+
+	.dbg	func, "write_file", "00", static, "_write_file"
+	.dbg	sym, "name", "00", auto, 0
+	.dbg	sym, "f", "00", auto, -2
+	.dbg	sym, "p", "00", auto, -4
+	.dbg	sym, "i", "00", auto, -6
+
+.segment	"CODE"
+
+	.dbg	line, "stdiobuf.c", 81
+	jsr     pushax
+	.dbg	line, "stdiobuf.c", 82
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     #<(L003D)
+	ldx     #>(L003D)
+	jsr     pushax
+	ldx     #$00
+	lda     #$00
+	jsr     _open_file
+	jsr     pushax
+	.dbg	line, "stdiobuf.c", 86
+	jsr     decsp4
+	ldx     #$00
+	lda     #$00
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0040
+	.dbg	line, "stdiobuf.c", 87
+L0043:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _expect
+	ldx     #$00
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _fputc
+	.dbg	line, "stdiobuf.c", 86
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0040:	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$0C
+	bne     L0048
+	cmp     #$80
+L0048:	jsr     boolult
+	jne     L0043
+	.dbg	line, "stdiobuf.c", 91
+	ldx     #$00
+	lda     #$00
+	ldy     #$00
+	jsr     staxysp
+	jmp     L004E
+	.dbg	line, "stdiobuf.c", 92
+L0051:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _make_line
+	.dbg	line, "stdiobuf.c", 93
+	lda     #<(_line)
+	ldx     #>(_line)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _fputs
+	.dbg	line, "stdiobuf.c", 91
+	ldy     #$00
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+	ldy     #$02
+	ldx     #$00
+	lda     #$40
+	jsr     addeqysp
+L004E:	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0055
+	cmp     #$0A
+L0055:	jsr     boolult
+	jne     L0051
+	.dbg	line, "stdiobuf.c", 97
+	jmp     L0060
+	.dbg	line, "stdiobuf.c", 98
+L005E:	ldy     #$03
+	jsr     ldaxysp
+	ldx     #$00
+	and     #$01
+	stx     tmp1
+	ora     tmp1
+	jeq     L0065
+	ldx     #$00
+	lda     #$0D
+	jmp     L0067
+L0065:	ldx     #$02
+	lda     #$58
+L0067:	jsr     pushax
+	.dbg	line, "stdiobuf.c", 99
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$19
+	lda     #$00
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     tossubax
+	jsr     tosugtax
+	jeq     L006A
+	.dbg	line, "stdiobuf.c", 100
+	ldx     #$19
+	lda     #$00
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tossubax
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "stdiobuf.c", 102
+L006A:	ldx     #$00
+	lda     #$00
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0070
+	.dbg	line, "stdiobuf.c", 103
+L0073:	lda     #<(_block)
+	ldx     #>(_block)
+	ldy     #$02
+	clc
+	adc     (sp),y
+	pha
+	txa
+	iny
+	adc     (sp),y
+	tax
+	pla
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     tosaddax
+	jsr     _expect
+	ldy     #$00
+	jsr     staspidx
+	.dbg	line, "stdiobuf.c", 102
+	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0070:	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosultax
+	jne     L0073
+	.dbg	line, "stdiobuf.c", 105
+	lda     #<(_block)
+	ldx     #>(_block)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0D
+	jsr     ldaxysp
+	jsr     _fwrite
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosneax
+	jeq     L007C
+	.dbg	line, "stdiobuf.c", 106
+	lda     #<(L0083)
+	ldx     #>(L0083)
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "stdiobuf.c", 107
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "stdiobuf.c", 109
+L007C:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$04
+	jsr     addeqysp
+	.dbg	line, "stdiobuf.c", 110
+	jsr     incsp2
+	.dbg	line, "stdiobuf.c", 97
+L0060:	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$19
+	jsr     boolult
+	jne     L005E
+	.dbg	line, "stdiobuf.c", 112
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fclose
+	cpx     #$00
+	bne     L008C
+	cmp     #$00
+L008C:	jsr     boolne
+	jeq     L0089
+	.dbg	line, "stdiobuf.c", 113
+	lda     #<(L008E)
+	ldx     #>(L008E)
+	jsr     pushax
+	ldy     #$02
+	jsr     _printf
+	.dbg	line, "stdiobuf.c", 114
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "stdiobuf.c", 116
+L0089:	jsr     incsp8
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ read_chars (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_read_chars: near
+
+	.dbg	func, "read_chars", "00", static, "_read_chars"
+	.dbg	sym, "name", "00", auto, 0
+	.dbg	sym, "f", "00", auto, -2
+	.dbg	sym, "p", "00", auto, -4
+	.dbg	sym, "c", "00", auto, -6
+
+.segment	"CODE"
+
+	.dbg	line, "stdiobuf.c", 119
+	jsr     pushax
+	.dbg	line, "stdiobuf.c", 120
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     #<(L0094)
+	ldx     #>(L0094)
+	jsr     pushax
+	lda     #<(_readbuf)
+	ldx     #>(_readbuf)
+	jsr     _open_file
+	jsr     pushax
+	.dbg	line, "stdiobuf.c", 124
+	jsr     decsp4
+	ldx     #$00
+	lda     #$00
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0097
+	.dbg	line, "stdiobuf.c", 125
+L009A:	ldy     #$03
+	jsr     ldaxysp
+	cmp     #$00
+	txa
+	sbc     #$19
+	lda     #$00
+	ldx     #$00
+	rol     a
+	jne     L00A4
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _expect
+	jsr     tosneax
+	jne     L00A4
+	ldx     #$00
+	lda     #$00
+	jeq     L00A7
+L00A4:	ldx     #$00
+	lda     #$01
+L00A7:	jeq     L00A3
+	.dbg	line, "stdiobuf.c", 126
+	lda     #<(L00A9)
+	ldx     #>(L00A9)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "stdiobuf.c", 127
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "stdiobuf.c", 128
+	jmp     L0098
+	.dbg	line, "stdiobuf.c", 124
+L00A3:	ldy     #$02
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L0097:	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fgetc
+	ldy     #$00
+	jsr     staxysp
+	cpx     #$FF
+	bne     L00A1
+	cmp     #$FF
+L00A1:	jsr     boolne
+	jne     L009A
+	.dbg	line, "stdiobuf.c", 131
+L0098:	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$19
+	bne     L00B1
+	cmp     #$00
+L00B1:	jsr     boolne
+	jne     L00AF
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _feof
+	jsr     bnegax
+	jne     L00AF
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _ferror
+	stx     tmp1
+	ora     tmp1
+	jne     L00AF
+	ldx     #$00
+	lda     #$00
+	jeq     L00B4
+L00AF:	ldx     #$00
+	lda     #$01
+L00B4:	jeq     L00AE
+	.dbg	line, "stdiobuf.c", 132
+	lda     #<(L00B6)
+	ldx     #>(L00B6)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "stdiobuf.c", 133
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "stdiobuf.c", 135
+L00AE:	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fclose
+	.dbg	line, "stdiobuf.c", 136
+	jsr     incsp8
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ read_lines (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_read_lines: near
+
+	.dbg	func, "read_lines", "00", static, "_read_lines"
+	.dbg	sym, "name", "00", auto, 0
+	.dbg	sym, "f", "00", auto, -2
+	.dbg	sym, "p", "00", auto, -4
+	.dbg	sym, "c", "00", auto, -6
+
+.segment	"BSS"
+
+L00C3:
+	.res	74,$00
+
+.segment	"CODE"
+
+	.dbg	line, "stdiobuf.c", 139
+	jsr     pushax
+	.dbg	line, "stdiobuf.c", 140
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     #<(L00BF)
+	ldx     #>(L00BF)
+	jsr     pushax
+	lda     #<(_readbuf)
+	ldx     #>(_readbuf)
+	jsr     _open_file
+	jsr     pushax
+	.dbg	line, "stdiobuf.c", 145
+	jsr     decsp4
+	ldx     #$00
+	lda     #$00
+	ldy     #$02
+	jsr     staxysp
+	jmp     L00C4
+	.dbg	line, "stdiobuf.c", 146
+L00C7:	ldy     #$03
+	jsr     ldaxysp
+	jsr     _make_line
+	.dbg	line, "stdiobuf.c", 147
+	lda     #<(L00C3)
+	ldx     #>(L00C3)
+	jsr     pushax
+	lda     #<(_line)
+	ldx     #>(_line)
+	jsr     _strcmp
+	cpx     #$00
+	bne     L00D7
+	cmp     #$00
+L00D7:	jsr     boolne
+	jeq     L00D3
+	.dbg	line, "stdiobuf.c", 148
+	lda     #<(L00D9)
+	ldx     #>(L00D9)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "stdiobuf.c", 149
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "stdiobuf.c", 150
+	jmp     L00C5
+	.dbg	line, "stdiobuf.c", 154
+L00D3:	ldy     #$03
+	jsr     ldaxysp
+	ldx     #$00
+	and     #$40
+	stx     tmp1
+	ora     tmp1
+	jeq     L00E2
+	.dbg	line, "stdiobuf.c", 155
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fgetc
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "stdiobuf.c", 156
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$FF
+	bne     L00E4
+	cmp     #$FF
+L00E4:	jsr     boolne
+	jeq     L00E5
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     _ungetc
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosneax
+	jne     L00E3
+L00E5:	ldx     #$00
+	lda     #$00
+	jeq     L00E8
+L00E3:	ldx     #$00
+	lda     #$01
+L00E8:	jeq     L00E2
+	.dbg	line, "stdiobuf.c", 157
+	lda     #<(L00EA)
+	ldx     #>(L00EA)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "stdiobuf.c", 158
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "stdiobuf.c", 145
+L00E2:	ldy     #$02
+	ldx     #$00
+	lda     #$40
+	jsr     addeqysp
+L00C4:	lda     #<(L00C3)
+	ldx     #>(L00C3)
+	jsr     pushax
+	ldx     #$00
+	lda     #$4A
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     _fgets
+	stx     tmp1
+	ora     tmp1
+	jne     L00C7
+	.dbg	line, "stdiobuf.c", 162
+L00C5:	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$19
+	bne     L00F1
+	cmp     #$00
+L00F1:	jsr     boolne
+	jeq     L00EE
+	.dbg	line, "stdiobuf.c", 163
+	lda     #<(L00F3)
+	ldx     #>(L00F3)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "stdiobuf.c", 164
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "stdiobuf.c", 166
+L00EE:	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fclose
+	.dbg	line, "stdiobuf.c", 167
+	jsr     incsp8
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ read_blocks (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_read_blocks: near
+
+	.dbg	func, "read_blocks", "00", static, "_read_blocks"
+	.dbg	sym, "name", "00", auto, 0
+	.dbg	sym, "f", "00", auto, -2
+	.dbg	sym, "p", "00", auto, -4
+	.dbg	sym, "i", "00", auto, -6
+	.dbg	sym, "n", "00", auto, -8
+	.dbg	sym, "got", "00", auto, -10
+
+.segment	"CODE"
+
+	.dbg	line, "stdiobuf.c", 170
+	jsr     pushax
+	.dbg	line, "stdiobuf.c", 171
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     #<(L00FC)
+	ldx     #>(L00FC)
+	jsr     pushax
+	lda     #<(_readbuf)
+	ldx     #>(_readbuf)
+	jsr     _open_file
+	jsr     pushax
+	.dbg	line, "stdiobuf.c", 175
+	jsr     decsp8
+	ldx     #$00
+	lda     #$00
+	ldy     #$06
+	jsr     staxysp
+	jmp     L00FF
+	.dbg	line, "stdiobuf.c", 176
+L0102:	ldy     #$07
+	jsr     ldaxysp
+	ldx     #$00
+	and     #$01
+	stx     tmp1
+	ora     tmp1
+	jeq     L010C
+	ldx     #$00
+	lda     #$11
+	jmp     L010E
+L010C:	ldx     #$02
+	lda     #$58
+L010E:	ldy     #$02
+	jsr     staxysp
+	.dbg	line, "stdiobuf.c", 177
+	lda     #<(_block)
+	ldx     #>(_block)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     _fread
+	ldy     #$00
+	jsr     staxysp
+	.dbg	line, "stdiobuf.c", 178
+	ldy     #$01
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0119
+	cmp     #$00
+L0119:	jsr     booleq
+	jeq     L0117
+	.dbg	line, "stdiobuf.c", 179
+	jmp     L0100
+	.dbg	line, "stdiobuf.c", 181
+L0117:	ldx     #$00
+	lda     #$00
+	ldy     #$04
+	jsr     staxysp
+	jmp     L011A
+	.dbg	line, "stdiobuf.c", 182
+L011D:	lda     #<(_block)
+	ldx     #>(_block)
+	ldy     #$04
+	clc
+	adc     (sp),y
+	pha
+	txa
+	iny
+	adc     (sp),y
+	tax
+	pla
+	ldy     #$00
+	jsr     ldauidx
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     tosaddax
+	jsr     _expect
+	jsr     tosneax
+	jeq     L0122
+	.dbg	line, "stdiobuf.c", 183
+	lda     #<(L0127)
+	ldx     #>(L0127)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     tosaddax
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "stdiobuf.c", 184
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "stdiobuf.c", 185
+	jmp     L012C
+	.dbg	line, "stdiobuf.c", 181
+L0122:	ldy     #$04
+	ldx     #$00
+	lda     #$01
+	jsr     addeqysp
+L011A:	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     tosultax
+	jne     L011D
+	.dbg	line, "stdiobuf.c", 175
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$06
+	jsr     addeqysp
+L00FF:	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$19
+	jsr     boolult
+	jne     L0102
+	.dbg	line, "stdiobuf.c", 189
+L0100:	ldy     #$07
+	jsr     ldaxysp
+	cpx     #$19
+	bne     L012F
+	cmp     #$00
+L012F:	jsr     boolne
+	jne     L012D
+	lda     #<(_block)
+	ldx     #>(_block)
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldx     #$00
+	lda     #$01
+	jsr     pushax
+	ldy     #$0F
+	jsr     ldaxysp
+	jsr     _fread
+	cpx     #$00
+	bne     L0134
+	cmp     #$00
+L0134:	jsr     boolne
+	jne     L012D
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     _feof
+	jsr     bnegax
+	jne     L012D
+	ldx     #$00
+	lda     #$00
+	jeq     L0136
+L012D:	ldx     #$00
+	lda     #$01
+L0136:	jeq     L012C
+	.dbg	line, "stdiobuf.c", 190
+	lda     #<(L0138)
+	ldx     #>(L0138)
+	jsr     pushax
+	ldy     #$09
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "stdiobuf.c", 191
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "stdiobuf.c", 194
+L012C:	ldy     #$09
+	jsr     ldaxysp
+	jsr     _fclose
+	.dbg	line, "stdiobuf.c", 195
+	ldy     #$0C
+	jsr     addysp
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; void __near__ read_flush (__near__ const unsigned char *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_read_flush: near
+
+	.dbg	func, "read_flush", "00", static, "_read_flush"
+	.dbg	sym, "name", "00", auto, 0
+	.dbg	sym, "f", "00", auto, -2
+	.dbg	sym, "p", "00", auto, -4
+	.dbg	sym, "c", "00", auto, -6
+
+.segment	"CODE"
+
+	.dbg	line, "stdiobuf.c", 198
+	jsr     pushax
+	.dbg	line, "stdiobuf.c", 199
+	ldy     #$01
+	jsr     ldaxysp
+	jsr     pushax
+	lda     #<(L0141)
+	ldx     #>(L0141)
+	jsr     pushax
+	lda     #<(_readbuf)
+	ldx     #>(_readbuf)
+	jsr     _open_file
+	jsr     pushax
+	.dbg	line, "stdiobuf.c", 206
+	jsr     decsp4
+	ldx     #$00
+	lda     #$00
+	ldy     #$02
+	jsr     staxysp
+	jmp     L0144
+	.dbg	line, "stdiobuf.c", 207
+L0147:	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fgetc
+	ldy     #$00
+	jsr     staxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _expect
+	jsr     tosneax
+	jeq     L014E
+	.dbg	line, "stdiobuf.c", 208
+	lda     #<(L0155)
+	ldx     #>(L0155)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "stdiobuf.c", 209
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "stdiobuf.c", 210
+	jmp     L0145
+	.dbg	line, "stdiobuf.c", 212
+L014E:	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fflush
+	cpx     #$00
+	bne     L015D
+	cmp     #$00
+L015D:	jsr     boolne
+	jne     L015B
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     _ftell
+	jsr     pusheax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     incax1
+	jsr     axulong
+	jsr     tosneeax
+	jne     L015B
+	ldx     #$00
+	lda     #$00
+	jeq     L015F
+L015B:	ldx     #$00
+	lda     #$01
+L015F:	jeq     L015A
+	.dbg	line, "stdiobuf.c", 213
+	lda     #<(L0161)
+	ldx     #>(L0161)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "stdiobuf.c", 214
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "stdiobuf.c", 215
+	jmp     L0145
+	.dbg	line, "stdiobuf.c", 217
+L015A:	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fgetc
+	ldy     #$00
+	jsr     staxysp
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     incax1
+	jsr     _expect
+	jsr     tosneax
+	jeq     L0165
+	.dbg	line, "stdiobuf.c", 218
+	lda     #<(L016C)
+	ldx     #>(L016C)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$07
+	jsr     ldaxysp
+	jsr     incax1
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "stdiobuf.c", 219
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "stdiobuf.c", 220
+	jmp     L0145
+	.dbg	line, "stdiobuf.c", 222
+L0165:	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldx     #$00
+	stx     sreg
+	stx     sreg+1
+	lda     #$62
+	jsr     pusheax
+	ldx     #$00
+	lda     #$00
+	jsr     _fseek
+	cpx     #$00
+	bne     L0176
+	cmp     #$00
+L0176:	jsr     boolne
+	jeq     L0171
+	.dbg	line, "stdiobuf.c", 223
+	lda     #<(L0178)
+	ldx     #>(L0178)
+	jsr     pushax
+	ldy     #$05
+	jsr     ldaxysp
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "stdiobuf.c", 224
+	ldx     #$00
+	inc     _failures
+	lda     _failures
+	.dbg	line, "stdiobuf.c", 225
+	jmp     L0145
+	.dbg	line, "stdiobuf.c", 206
+L0171:	ldy     #$02
+	ldx     #$00
+	lda     #$64
+	jsr     addeqysp
+L0144:	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$19
+	jsr     boolult
+	jne     L0147
+	.dbg	line, "stdiobuf.c", 228
+L0145:	ldy     #$05
+	jsr     ldaxysp
+	jsr     _fclose
+	.dbg	line, "stdiobuf.c", 229
+	jsr     incsp8
+	rts
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ __cdecl__ main (int, __near__ unsigned char * *)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "argc", "00", auto, 2
+	.dbg	sym, "argv", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "stdiobuf.c", 233
+	ldy     #$03
+	jsr     ldaxysp
+	cpx     #$00
+	bne     L0181
+	cmp     #$02
+L0181:	jsr     boolne
+	jeq     L017F
+	.dbg	line, "stdiobuf.c", 234
+	lda     #<(L0183)
+	ldx     #>(L0183)
+	jsr     pushax
+	ldy     #$03
+	jsr     ldaxysp
+	ldy     #$01
+	jsr     ldaxidx
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "stdiobuf.c", 235
+	ldx     #$00
+	lda     #$01
+	jmp     L017E
+	.dbg	line, "stdiobuf.c", 238
+L017F:	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     _write_file
+	.dbg	line, "stdiobuf.c", 239
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     _read_chars
+	.dbg	line, "stdiobuf.c", 240
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     _read_lines
+	.dbg	line, "stdiobuf.c", 241
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     _read_blocks
+	.dbg	line, "stdiobuf.c", 242
+	ldy     #$01
+	jsr     ldaxysp
+	ldy     #$03
+	jsr     ldaxidx
+	jsr     _read_flush
+	.dbg	line, "stdiobuf.c", 244
+	lda     _failures
+	jeq     L0198
+	ldx     #$00
+	lda     #$01
+	jmp     L019A
+L0198:	ldx     #$00
+	lda     #$00
+L019A:	jmp     L017E
+	.dbg	line, "stdiobuf.c", 245
+L017E:	jsr     incsp4
+	rts
+	.dbg	line
+
+.endproc
+
@@ -0,0 +1,603 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	off
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.forceimport	__STARTUP__
+	.import		_printf
+	.export		_call
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+L0048:
+	.byte	$72,$65,$67,$69,$73,$74,$65,$72,$20,$76,$61,$72,$69,$61,$62,$6C
+	.byte	$65,$20,$6B,$20,$63,$6C,$6F,$62,$62,$65,$72,$65,$64,$20,$61,$74
+	.byte	$20,$25,$75,$0A,$00
+L00A2:
+	.byte	$72,$65,$67,$69,$73,$74,$65,$72,$20,$76,$61,$72,$69,$61,$62,$6C
+	.byte	$65,$20,$6A,$20,$63,$6C,$6F,$62,$62,$65,$72,$65,$64,$3A,$20,$25
+	.byte	$75,$0A,$00
+L0098:
+	.byte	$77,$61,$6C,$6B,$28,$32,$30,$30,$29,$20,$3D,$20,$25,$6C,$75,$2C
+	.byte	$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$25,$6C,$75,$0A,$00
+L008D:
+	.byte	$74,$68,$72,$69,$63,$65,$28,$25,$75,$29,$20,$3D,$20,$25,$75,$0A
+	.byte	$00
+L0083:
+	.byte	$63,$6F,$75,$6E,$74,$28,$25,$75,$29,$20,$3D,$20,$25,$6C,$75,$0A
+	.byte	$00
+L0073:
+	.byte	$74,$77,$69,$63,$65,$28,$25,$75,$29,$20,$3D,$20,$25,$75,$0A,$00
+
+.segment	"BSS"
+
+L00AB:
+	.res	18,$00
+L0008	:=	L00AB+0
+L000A	:=	L00AB+4
+L0012	:=	L00AB+0
+L000F	:=	L00AB+4
+L002A	:=	L00AB+8
+L002F	:=	L00AB+0
+L0034	:=	L00AB+10
+L005B	:=	L00AB+14
+L0003	:=	regbank+0
+L0006	:=	regbank+1
+L0013	:=	regbank+0
+L004E	:=	regbank+0
+
+; ---------------------------------------------------------------
+; unsigned long __near__ mix (unsigned int, unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_mix: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldy     #$00
+	lda     (sp),y
+	clc
+	adc     #$01
+	sta     L0003
+	ldy     #$02
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	eor     #$5A
+	pha
+	txa
+	eor     #$5A
+	tax
+	pla
+	sta     L0006
+	stx     L0006+1
+	jsr     push0ax
+	ldx     #$00
+	lda     L0003
+	jsr     tosumul0ax
+	sta     L0008
+	stx     L0008+1
+	ldy     sreg
+	sty     L0008+2
+	ldy     sreg+1
+	sty     L0008+3
+	lda     L0008+3
+	sta     sreg+1
+	lda     L0008+2
+	sta     sreg
+	ldx     L0008+1
+	lda     L0008
+	jsr     shreax3
+	sta     L000A
+	stx     L000A+1
+	lda     L0008+3
+	sta     sreg+1
+	lda     L0008+2
+	sta     sreg
+	ldx     L0008+1
+	lda     L0008
+	jsr     pusheax
+	lda     L000A
+	ldx     L000A+1
+	jsr     tosadd0ax
+	jsr     pusheax
+	ldx     #$00
+	lda     L0003
+	jsr     tosadd0ax
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ count (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_count: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	lda     (sp),y
+	sta     sreg
+	dey
+	lda     (sp),y
+	sta     L000F+1
+	tya
+	sta     L000F
+	ldy     sreg
+	sty     L000F+2
+	tay
+	sta     L000F+3
+	lda     (sp),y
+	sta     L0012
+	tya
+	sta     L0012+1
+	sta     L0013
+	sta     L0013+1
+	jmp     L001A
+L001D:	lda     L0012
+	sta     L0012+1
+	inc     L0013
+	bne     L001A
+	inc     L0013+1
+L001A:	lda     L0013
+	ldy     #$00
+	cmp     (sp),y
+	lda     L0013+1
+	iny
+	sbc     (sp),y
+	bcc     L001D
+	lda     L000F+3
+	sta     sreg+1
+	lda     L000F+2
+	sta     sreg
+	ldx     L000F+1
+	lda     L000F
+	jsr     pusheax
+	lda     L0013
+	ldx     L0013+1
+	jsr     tosadd0ax
+	jsr     pusheax
+	ldx     #$00
+	lda     L0012+1
+	jsr     tosadd0ax
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ twice (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_twice: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$00
+	lda     (sp),y
+	clc
+	adc     (sp),y
+	pha
+	iny
+	lda     (sp),y
+	adc     (sp),y
+	tax
+	pla
+	sta     L002A
+	stx     L002A+1
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ thrice (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_thrice: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$01
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	jsr     mulax3
+	sta     L002F
+	stx     L002F+1
+	jmp     incsp2
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ walk (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_walk: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	lda     regbank+3
+	jsr     pusha
+	lda     #$00
+	sta     L0034
+	sta     L0034+1
+	sta     L0034+2
+	sta     L0034+3
+	sta     regbank+4
+	sta     regbank+4+1
+	jmp     L0036
+L0039:	lda     regbank+4
+	sta     regbank+3
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	lda     regbank+3
+	jsr     _mix
+	ldy     #<(L0034)
+	sty     ptr1
+	ldy     #>(L0034)
+	jsr     laddeq
+	lda     regbank+4
+	cmp     regbank+3
+	beq     L0045
+	lda     #<(L0048)
+	ldx     #>(L0048)
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L0045:	inc     regbank+4
+	bne     L0036
+	inc     regbank+4+1
+L0036:	lda     regbank+4
+	ldy     #$03
+	cmp     (sp),y
+	lda     regbank+4+1
+	iny
+	sbc     (sp),y
+	bcc     L0039
+	lda     L0034+3
+	sta     sreg+1
+	lda     L0034+2
+	sta     sreg
+	ldx     L0034+1
+	lda     L0034
+	pha
+	ldy     #$00
+	lda     (sp),y
+	sta     regbank+3
+	iny
+	lda     (sp),y
+	sta     regbank+4
+	iny
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp5
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ refmix (unsigned int, unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_refmix: near
+
+.segment	"CODE"
+
+	jsr     pusha
+	ldy     #$02
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	eor     #$5A
+	pha
+	txa
+	eor     #$5A
+	tax
+	pla
+	jsr     push0ax
+	ldy     #$04
+	lda     (sp),y
+	clc
+	adc     #$01
+	ldx     #$00
+	jsr     tosumul0ax
+	sta     L004E
+	stx     L004E+1
+	ldy     sreg
+	sty     L004E+2
+	ldy     sreg+1
+	sty     L004E+3
+	lda     L004E+3
+	sta     sreg+1
+	lda     L004E+2
+	sta     sreg
+	ldx     L004E+1
+	lda     L004E
+	jsr     pusheax
+	lda     L004E+3
+	sta     sreg+1
+	lda     L004E+2
+	sta     sreg
+	ldx     L004E+1
+	lda     L004E
+	jsr     shreax3
+	jsr     tosadd0ax
+	jsr     pusheax
+	ldy     #$04
+	lda     (sp),y
+	clc
+	adc     #$01
+	ldx     #$00
+	jsr     tosadd0ax
+	jmp     incsp3
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ call (__near__ __near__ function returning unsigned int *, unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_call: near
+
+.segment	"CODE"
+
+	jsr     pushax
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	lda     (sp),y
+	tax
+	dey
+	lda     (sp),y
+	pha
+	ldy     #$00
+	lda     (sp),y
+	sta     jmpvec+1
+	iny
+	lda     (sp),y
+	sta     jmpvec+2
+	pla
+	jsr     jmpvec
+	jsr     incsp2
+	jmp     incsp4
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+.segment	"CODE"
+
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	lda     #$00
+	sta     L005B
+	sta     L005B+1
+	sta     L005B+2
+	sta     L005B+3
+	sta     regbank+4
+	sta     regbank+4+1
+	jmp     L005D
+L0060:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	lda     regbank+4
+	jsr     _refmix
+	ldy     #<(L005B)
+	sty     ptr1
+	ldy     #>(L005B)
+	jsr     laddeq
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     _twice
+	jsr     pushax
+	lda     #<(_twice)
+	ldx     #>(_twice)
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     _call
+	jsr     tosicmp
+	bne     L006C
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     _twice
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	stx     tmp1
+	asl     a
+	rol     tmp1
+	ldx     tmp1
+	jsr     tosicmp
+	beq     L006B
+L006C:	lda     #<(L0073)
+	ldx     #>(L0073)
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     _twice
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	inc     _failures
+L006B:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     _count
+	jsr     pusheax
+	ldx     regbank+4+1
+	ldy     #$00
+	sty     sreg+1
+	stx     sreg
+	ldx     regbank+4
+	tya
+	jsr     pusheax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     tosadd0ax
+	jsr     pusheax
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L007E
+	lda     regbank+4
+L007E:	ldx     #$00
+	jsr     tosadd0ax
+	jsr     tosneeax
+	beq     L0079
+	lda     #<(L0083)
+	ldx     #>(L0083)
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     _count
+	jsr     pusheax
+	ldy     #$08
+	jsr     _printf
+	inc     _failures
+L0079:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     _thrice
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     mulax3
+	jsr     tosicmp
+	beq     L0089
+	lda     #<(L008D)
+	ldx     #>(L008D)
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     _thrice
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	inc     _failures
+L0089:	inc     regbank+4
+	bne     L005D
+	inc     regbank+4+1
+L005D:	lda     regbank+4+1
+	cmp     #$00
+	bne     L0064
+	lda     regbank+4
+	cmp     #$C8
+L0064:	jcc     L0060
+	ldx     #$00
+	lda     #$C8
+	jsr     _walk
+	cmp     L005B
+	bne     L00AD
+	cpx     L005B+1
+	bne     L00AD
+	lda     sreg
+	cmp     L005B+2
+	bne     L00AD
+	lda     sreg+1
+	cmp     L005B+3
+	beq     L0093
+L00AD:	lda     #<(L0098)
+	ldx     #>(L0098)
+	jsr     pushax
+	ldx     #$00
+	lda     #$C8
+	jsr     _walk
+	jsr     pusheax
+	lda     L005B+3
+	sta     sreg+1
+	lda     L005B+2
+	sta     sreg
+	ldx     L005B+1
+	lda     L005B
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	inc     _failures
+L0093:	lda     regbank+4+1
+	bne     L00AE
+	lda     regbank+4
+	cmp     #$C8
+	beq     L009E
+L00AE:	lda     #<(L00A2)
+	ldx     #>(L00A2)
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	inc     _failures
+L009E:	lda     _failures
+	beq     L00A7
+	ldx     #$00
+	lda     #$01
+	jmp     L005A
+L00A7:	tax
+L005A:	pha
+	lda     (sp,x)
+	sta     regbank+4
+	ldy     #$01
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp2
+
+.endproc
+
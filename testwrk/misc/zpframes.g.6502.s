@@ -0,0 +1,708 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"6502"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "zpframes.c", 3068, 1792390654
+	.dbg		file, "/root/repo/include/stdio.h", 6363, 1792382670
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1515150330
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1515150330
+	.dbg		file, "/root/repo/include/stdlib.h", 5748, 1515150330
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_call
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+L0047:
+	.byte	$72,$65,$67,$69,$73,$74,$65,$72,$20,$76,$61,$72,$69,$61,$62,$6C
+	.byte	$65,$20,$6B,$20,$63,$6C,$6F,$62,$62,$65,$72,$65,$64,$20,$61,$74
+	.byte	$20,$25,$75,$0A,$00
+L009F:
+	.byte	$72,$65,$67,$69,$73,$74,$65,$72,$20,$76,$61,$72,$69,$61,$62,$6C
+	.byte	$65,$20,$6A,$20,$63,$6C,$6F,$62,$62,$65,$72,$65,$64,$3A,$20,$25
+	.byte	$75,$0A,$00
+L0095:
+	.byte	$77,$61,$6C,$6B,$28,$32,$30,$30,$29,$20,$3D,$20,$25,$6C,$75,$2C
+	.byte	$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$25,$6C,$75,$0A,$00
+L008B:
+	.byte	$74,$68,$72,$69,$63,$65,$28,$25,$75,$29,$20,$3D,$20,$25,$75,$0A
+	.byte	$00
+L0081:
+	.byte	$63,$6F,$75,$6E,$74,$28,$25,$75,$29,$20,$3D,$20,$25,$6C,$75,$0A
+	.byte	$00
+L0071:
+	.byte	$74,$77,$69,$63,$65,$28,$25,$75,$29,$20,$3D,$20,$25,$75,$0A,$00
+
+.segment	"BSS"
+
+L00A8:
+	.res	18,$00
+L0007	:=	L00A8+0
+L0009	:=	L00A8+4
+L0011	:=	L00A8+0
+L000E	:=	L00A8+4
+L0029	:=	L00A8+8
+L002E	:=	L00A8+0
+L0033	:=	L00A8+10
+L0059	:=	L00A8+14
+L0003	:=	regbank+0
+L0005	:=	regbank+1
+L0012	:=	regbank+0
+L004E	:=	regbank+0
+
+; ---------------------------------------------------------------
+; unsigned long __near__ mix (unsigned int, unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_mix: near
+
+	.dbg	func, "mix", "00", static, "_mix"
+	.dbg	sym, "a", "00", auto, 1
+	.dbg	sym, "b", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "zpframes.c", 23
+	jsr     pusha
+	.dbg	line, "zpframes.c", 24
+	ldy     #$00
+	lda     (sp),y
+	clc
+	adc     #$01
+	sta     L0003
+	.dbg	line, "zpframes.c", 25
+	ldy     #$02
+	jsr     ldaxysp
+	eor     #$5A
+	pha
+	txa
+	eor     #$5A
+	tax
+	pla
+	sta     L0005
+	stx     L0005+1
+	.dbg	line, "zpframes.c", 26
+	jsr     axulong
+	jsr     pusheax
+	ldx     #$00
+	lda     L0003
+	jsr     axulong
+	jsr     tosumuleax
+	sta     L0007
+	stx     L0007+1
+	ldy     sreg
+	sty     L0007+2
+	ldy     sreg+1
+	sty     L0007+3
+	.dbg	line, "zpframes.c", 27
+	lda     L0007+3
+	sta     sreg+1
+	lda     L0007+2
+	sta     sreg
+	ldx     L0007+1
+	lda     L0007
+	jsr     shreax3
+	sta     L0009
+	stx     L0009+1
+	.dbg	line, "zpframes.c", 28
+	lda     L0007+3
+	sta     sreg+1
+	lda     L0007+2
+	sta     sreg
+	ldx     L0007+1
+	lda     L0007
+	jsr     pusheax
+	lda     L0009
+	ldx     L0009+1
+	jsr     axulong
+	jsr     tosaddeax
+	jsr     pusheax
+	ldx     #$00
+	lda     L0003
+	jsr     axulong
+	jsr     tosaddeax
+	.dbg	line, "zpframes.c", 29
+	jmp     incsp3
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ count (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_count: near
+
+	.dbg	func, "count", "00", static, "_count"
+	.dbg	sym, "n", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "zpframes.c", 33
+	jsr     pushax
+	.dbg	line, "zpframes.c", 34
+	jsr     ldax0sp
+	jsr     axulong
+	ldy     sreg
+	sty     sreg+1
+	stx     sreg
+	sta     L000E+1
+	lda     #$00
+	sta     L000E
+	ldy     sreg
+	sty     L000E+2
+	ldy     sreg+1
+	sty     L000E+3
+	.dbg	line, "zpframes.c", 38
+	tay
+	lda     (sp),y
+	sta     L0011
+	.dbg	line, "zpframes.c", 39
+	tya
+	sta     L0011+1
+	.dbg	line, "zpframes.c", 40
+	sta     L0012
+	sta     L0012+1
+	jmp     L0019
+	.dbg	line, "zpframes.c", 41
+L001C:	lda     L0011
+	sta     L0011+1
+	.dbg	line, "zpframes.c", 40
+	inc     L0012
+	bne     L0019
+	inc     L0012+1
+L0019:	lda     L0012
+	ldy     #$00
+	cmp     (sp),y
+	lda     L0012+1
+	iny
+	sbc     (sp),y
+	bcc     L001C
+	.dbg	line, "zpframes.c", 43
+	lda     L000E+3
+	sta     sreg+1
+	lda     L000E+2
+	sta     sreg
+	ldx     L000E+1
+	lda     L000E
+	jsr     pusheax
+	lda     L0012
+	ldx     L0012+1
+	jsr     axulong
+	jsr     tosaddeax
+	jsr     pusheax
+	ldx     #$00
+	lda     L0011+1
+	jsr     axulong
+	jsr     tosaddeax
+	.dbg	line, "zpframes.c", 44
+	jmp     incsp2
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ twice (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_twice: near
+
+	.dbg	func, "twice", "00", static, "_twice"
+	.dbg	sym, "a", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "zpframes.c", 48
+	jsr     pushax
+	.dbg	line, "zpframes.c", 49
+	jsr     ldax0sp
+	clc
+	ldy     #$00
+	adc     (sp),y
+	pha
+	txa
+	iny
+	adc     (sp),y
+	tax
+	pla
+	sta     L0029
+	stx     L0029+1
+	.dbg	line, "zpframes.c", 51
+	jmp     incsp2
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ thrice (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_thrice: near
+
+	.dbg	func, "thrice", "00", static, "_thrice"
+	.dbg	sym, "a", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "zpframes.c", 55
+	jsr     pushax
+	.dbg	line, "zpframes.c", 56
+	jsr     ldax0sp
+	jsr     mulax3
+	sta     L002E
+	stx     L002E+1
+	.dbg	line, "zpframes.c", 58
+	jmp     incsp2
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ walk (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_walk: near
+
+	.dbg	func, "walk", "00", static, "_walk"
+	.dbg	sym, "n", "00", auto, 0
+	.dbg	sym, "i", "00", register, "regbank", 4
+	.dbg	sym, "k", "00", register, "regbank", 3
+
+.segment	"CODE"
+
+	.dbg	line, "zpframes.c", 62
+	jsr     pushax
+	.dbg	line, "zpframes.c", 63
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	.dbg	line, "zpframes.c", 64
+	lda     regbank+3
+	jsr     pusha
+	.dbg	line, "zpframes.c", 65
+	lda     #$00
+	sta     L0033
+	sta     L0033+1
+	sta     L0033+2
+	sta     L0033+3
+	.dbg	line, "zpframes.c", 67
+	sta     regbank+4
+	sta     regbank+4+1
+	jmp     L0035
+	.dbg	line, "zpframes.c", 68
+L0038:	lda     regbank+4
+	sta     regbank+3
+	.dbg	line, "zpframes.c", 69
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	lda     regbank+3
+	jsr     _mix
+	ldy     #<(L0033)
+	sty     ptr1
+	ldy     #>(L0033)
+	jsr     laddeq
+	.dbg	line, "zpframes.c", 70
+	lda     regbank+4
+	cmp     regbank+3
+	beq     L0044
+	.dbg	line, "zpframes.c", 71
+	lda     #<(L0047)
+	ldx     #>(L0047)
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "zpframes.c", 72
+	inc     _failures
+	.dbg	line, "zpframes.c", 67
+L0044:	inc     regbank+4
+	bne     L0035
+	inc     regbank+4+1
+L0035:	lda     regbank+4
+	ldy     #$03
+	cmp     (sp),y
+	lda     regbank+4+1
+	iny
+	sbc     (sp),y
+	bcc     L0038
+	.dbg	line, "zpframes.c", 75
+	lda     L0033+3
+	sta     sreg+1
+	lda     L0033+2
+	sta     sreg
+	ldx     L0033+1
+	lda     L0033
+	.dbg	line, "zpframes.c", 76
+	pha
+	ldy     #$00
+L004C:	lda     (sp),y
+	sta     regbank+3,y
+	iny
+	cpy     #$03
+	bne     L004C
+	pla
+	jmp     incsp5
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ refmix (unsigned int, unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_refmix: near
+
+	.dbg	func, "refmix", "00", static, "_refmix"
+	.dbg	sym, "a", "00", auto, 1
+	.dbg	sym, "b", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "zpframes.c", 79
+	jsr     pusha
+	.dbg	line, "zpframes.c", 80
+	ldy     #$02
+	jsr     ldaxysp
+	eor     #$5A
+	pha
+	txa
+	eor     #$5A
+	tax
+	pla
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$04
+	lda     (sp),y
+	clc
+	adc     #$01
+	ldx     #$00
+	jsr     axulong
+	jsr     tosumuleax
+	sta     L004E
+	stx     L004E+1
+	ldy     sreg
+	sty     L004E+2
+	ldy     sreg+1
+	sty     L004E+3
+	.dbg	line, "zpframes.c", 81
+	lda     L004E+3
+	sta     sreg+1
+	lda     L004E+2
+	sta     sreg
+	ldx     L004E+1
+	lda     L004E
+	jsr     pusheax
+	lda     L004E+3
+	sta     sreg+1
+	lda     L004E+2
+	sta     sreg
+	ldx     L004E+1
+	lda     L004E
+	jsr     shreax3
+	jsr     axulong
+	jsr     tosaddeax
+	jsr     pusheax
+	ldy     #$04
+	lda     (sp),y
+	clc
+	adc     #$01
+	ldx     #$00
+	jsr     axulong
+	jsr     tosaddeax
+	.dbg	line, "zpframes.c", 82
+	jmp     incsp3
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ call (__near__ __near__ function returning unsigned int *, unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_call: near
+
+	.dbg	func, "call", "00", extern, "_call"
+	.dbg	sym, "f", "00", auto, 2
+	.dbg	sym, "a", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "zpframes.c", 85
+	jsr     pushax
+	.dbg	line, "zpframes.c", 86
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	pha
+	ldy     #$00
+	lda     (sp),y
+	sta     jmpvec+1
+	iny
+	lda     (sp),y
+	sta     jmpvec+2
+	pla
+	jsr     jmpvec
+	jsr     incsp2
+	.dbg	line, "zpframes.c", 87
+	jmp     incsp4
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "j", "00", register, "regbank", 4
+
+.segment	"CODE"
+
+	.dbg	line, "zpframes.c", 91
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	.dbg	line, "zpframes.c", 92
+	lda     #$00
+	sta     L0059
+	sta     L0059+1
+	sta     L0059+2
+	sta     L0059+3
+	.dbg	line, "zpframes.c", 94
+	sta     regbank+4
+	sta     regbank+4+1
+	jmp     L005B
+	.dbg	line, "zpframes.c", 95
+L005E:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	lda     regbank+4
+	jsr     _refmix
+	ldy     #<(L0059)
+	sty     ptr1
+	ldy     #>(L0059)
+	jsr     laddeq
+	.dbg	line, "zpframes.c", 96
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     _twice
+	jsr     pushax
+	lda     #<(_twice)
+	ldx     #>(_twice)
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     _call
+	jsr     tosicmp
+	bne     L006A
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     _twice
+	sta     ptr1
+	stx     ptr1+1
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     shlax1
+	cpx     ptr1+1
+	bne     L006A
+	cmp     ptr1
+	beq     L0069
+	.dbg	line, "zpframes.c", 97
+L006A:	lda     #<(L0071)
+	ldx     #>(L0071)
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     _twice
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "zpframes.c", 98
+	inc     _failures
+	.dbg	line, "zpframes.c", 100
+L0069:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     _count
+	jsr     pusheax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     axulong
+	ldy     sreg
+	sty     sreg+1
+	stx     sreg
+	tax
+	lda     #$00
+	jsr     pusheax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     axulong
+	jsr     tosaddeax
+	jsr     pusheax
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L007C
+	lda     regbank+4
+L007C:	ldx     #$00
+	jsr     axulong
+	jsr     tosaddeax
+	jsr     tosneeax
+	beq     L0077
+	.dbg	line, "zpframes.c", 101
+	lda     #<(L0081)
+	ldx     #>(L0081)
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     _count
+	jsr     pusheax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "zpframes.c", 102
+	inc     _failures
+	.dbg	line, "zpframes.c", 104
+L0077:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     _thrice
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     mulax3
+	jsr     tosicmp
+	beq     L0087
+	.dbg	line, "zpframes.c", 105
+	lda     #<(L008B)
+	ldx     #>(L008B)
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     _thrice
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "zpframes.c", 106
+	inc     _failures
+	.dbg	line, "zpframes.c", 94
+L0087:	inc     regbank+4
+	bne     L005B
+	inc     regbank+4+1
+L005B:	lda     regbank+4+1
+	cmp     #$00
+	bne     L0062
+	lda     regbank+4
+	cmp     #$C8
+L0062:	jcc     L005E
+	.dbg	line, "zpframes.c", 109
+	ldx     #$00
+	lda     #$C8
+	jsr     _walk
+	jsr     pusheax
+	lda     L0059+3
+	sta     sreg+1
+	lda     L0059+2
+	sta     sreg
+	ldx     L0059+1
+	lda     L0059
+	jsr     tosneeax
+	beq     L0091
+	.dbg	line, "zpframes.c", 110
+	lda     #<(L0095)
+	ldx     #>(L0095)
+	jsr     pushax
+	ldx     #$00
+	lda     #$C8
+	jsr     _walk
+	jsr     pusheax
+	lda     L0059+3
+	sta     sreg+1
+	lda     L0059+2
+	sta     sreg
+	ldx     L0059+1
+	lda     L0059
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	.dbg	line, "zpframes.c", 111
+	inc     _failures
+	.dbg	line, "zpframes.c", 113
+L0091:	lda     regbank+4+1
+	bne     L00AB
+	lda     regbank+4
+	cmp     #$C8
+	beq     L009B
+	.dbg	line, "zpframes.c", 114
+L00AB:	lda     #<(L009F)
+	ldx     #>(L009F)
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "zpframes.c", 115
+	inc     _failures
+	.dbg	line, "zpframes.c", 118
+L009B:	lda     _failures
+	beq     L00A4
+	ldx     #$00
+	lda     #$01
+	jmp     L0058
+L00A4:	tax
+	.dbg	line, "zpframes.c", 119
+L0058:	pha
+	lda     (sp,x)
+	sta     regbank+4
+	ldy     #$01
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp2
+	.dbg	line
+
+.endproc
+
@@ -0,0 +1,696 @@
+;
+; File generated by cc65 v 2.16 - Git b0e3ed9
+;
+	.fopt		compiler,"cc65 v 2.16 - Git b0e3ed9"
+	.setcpu		"65C02"
+	.smart		on
+	.autoimport	on
+	.case		on
+	.debuginfo	on
+	.importzp	sp, sreg, regsave, regbank
+	.importzp	tmp1, tmp2, tmp3, tmp4, ptr1, ptr2, ptr3, ptr4
+	.macpack	longbranch
+	.dbg		file, "zpframes.c", 3068, 1792390654
+	.dbg		file, "/root/repo/include/stdio.h", 6363, 1792382670
+	.dbg		file, "/root/repo/include/stddef.h", 3057, 1515150330
+	.dbg		file, "/root/repo/include/stdarg.h", 2913, 1515150330
+	.dbg		file, "/root/repo/include/stdlib.h", 5748, 1515150330
+	.forceimport	__STARTUP__
+	.dbg		sym, "printf", "00", extern, "_printf"
+	.import		_printf
+	.export		_call
+	.export		_main
+
+.segment	"DATA"
+
+_failures:
+	.byte	$00
+
+.segment	"RODATA"
+
+L0048:
+	.byte	$72,$65,$67,$69,$73,$74,$65,$72,$20,$76,$61,$72,$69,$61,$62,$6C
+	.byte	$65,$20,$6B,$20,$63,$6C,$6F,$62,$62,$65,$72,$65,$64,$20,$61,$74
+	.byte	$20,$25,$75,$0A,$00
+L00A2:
+	.byte	$72,$65,$67,$69,$73,$74,$65,$72,$20,$76,$61,$72,$69,$61,$62,$6C
+	.byte	$65,$20,$6A,$20,$63,$6C,$6F,$62,$62,$65,$72,$65,$64,$3A,$20,$25
+	.byte	$75,$0A,$00
+L0098:
+	.byte	$77,$61,$6C,$6B,$28,$32,$30,$30,$29,$20,$3D,$20,$25,$6C,$75,$2C
+	.byte	$20,$65,$78,$70,$65,$63,$74,$65,$64,$20,$25,$6C,$75,$0A,$00
+L008E:
+	.byte	$74,$68,$72,$69,$63,$65,$28,$25,$75,$29,$20,$3D,$20,$25,$75,$0A
+	.byte	$00
+L0084:
+	.byte	$63,$6F,$75,$6E,$74,$28,$25,$75,$29,$20,$3D,$20,$25,$6C,$75,$0A
+	.byte	$00
+L0074:
+	.byte	$74,$77,$69,$63,$65,$28,$25,$75,$29,$20,$3D,$20,$25,$75,$0A,$00
+
+.segment	"BSS"
+
+L00AB:
+	.res	18,$00
+L0008	:=	L00AB+0
+L000A	:=	L00AB+4
+L0012	:=	L00AB+0
+L000F	:=	L00AB+4
+L002A	:=	L00AB+8
+L002F	:=	L00AB+0
+L0034	:=	L00AB+10
+L005C	:=	L00AB+14
+L0003	:=	regbank+0
+L0006	:=	regbank+1
+L0013	:=	regbank+0
+L004F	:=	regbank+0
+
+; ---------------------------------------------------------------
+; unsigned long __near__ mix (unsigned int, unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_mix: near
+
+	.dbg	func, "mix", "00", static, "_mix"
+	.dbg	sym, "a", "00", auto, 1
+	.dbg	sym, "b", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "zpframes.c", 23
+	jsr     pusha
+	.dbg	line, "zpframes.c", 24
+	lda     (sp)
+	ina
+	sta     L0003
+	.dbg	line, "zpframes.c", 25
+	ldy     #$02
+	jsr     ldaxysp
+	eor     #$5A
+	pha
+	txa
+	eor     #$5A
+	tax
+	pla
+	sta     L0006
+	stx     L0006+1
+	.dbg	line, "zpframes.c", 26
+	jsr     axulong
+	jsr     pusheax
+	ldx     #$00
+	lda     L0003
+	jsr     axulong
+	jsr     tosumuleax
+	sta     L0008
+	stx     L0008+1
+	ldy     sreg
+	sty     L0008+2
+	ldy     sreg+1
+	sty     L0008+3
+	.dbg	line, "zpframes.c", 27
+	lda     L0008+3
+	sta     sreg+1
+	lda     L0008+2
+	sta     sreg
+	ldx     L0008+1
+	lda     L0008
+	jsr     shreax3
+	sta     L000A
+	stx     L000A+1
+	.dbg	line, "zpframes.c", 28
+	lda     L0008+3
+	sta     sreg+1
+	lda     L0008+2
+	sta     sreg
+	ldx     L0008+1
+	lda     L0008
+	jsr     pusheax
+	lda     L000A
+	ldx     L000A+1
+	jsr     axulong
+	jsr     tosaddeax
+	jsr     pusheax
+	ldx     #$00
+	lda     L0003
+	jsr     axulong
+	jsr     tosaddeax
+	.dbg	line, "zpframes.c", 29
+	jmp     incsp3
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ count (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_count: near
+
+	.dbg	func, "count", "00", static, "_count"
+	.dbg	sym, "n", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "zpframes.c", 33
+	jsr     pushax
+	.dbg	line, "zpframes.c", 34
+	jsr     ldax0sp
+	jsr     axulong
+	ldy     sreg
+	sty     sreg+1
+	stx     sreg
+	sta     L000F+1
+	stz     L000F
+	ldy     sreg
+	sty     L000F+2
+	ldy     sreg+1
+	sty     L000F+3
+	.dbg	line, "zpframes.c", 38
+	lda     (sp)
+	sta     L0012
+	.dbg	line, "zpframes.c", 39
+	stz     L0012+1
+	.dbg	line, "zpframes.c", 40
+	stz     L0013
+	stz     L0013+1
+	bra     L001A
+	.dbg	line, "zpframes.c", 41
+L001D:	lda     L0012
+	sta     L0012+1
+	.dbg	line, "zpframes.c", 40
+	inc     L0013
+	bne     L001A
+	inc     L0013+1
+L001A:	lda     L0013
+	cmp     (sp)
+	lda     L0013+1
+	ldy     #$01
+	sbc     (sp),y
+	bcc     L001D
+	.dbg	line, "zpframes.c", 43
+	lda     L000F+3
+	sta     sreg+1
+	lda     L000F+2
+	sta     sreg
+	ldx     L000F+1
+	lda     L000F
+	jsr     pusheax
+	lda     L0013
+	ldx     L0013+1
+	jsr     axulong
+	jsr     tosaddeax
+	jsr     pusheax
+	ldx     #$00
+	lda     L0012+1
+	jsr     axulong
+	jsr     tosaddeax
+	.dbg	line, "zpframes.c", 44
+	jmp     incsp2
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ twice (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_twice: near
+
+	.dbg	func, "twice", "00", static, "_twice"
+	.dbg	sym, "a", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "zpframes.c", 48
+	jsr     pushax
+	.dbg	line, "zpframes.c", 49
+	jsr     ldax0sp
+	clc
+	adc     (sp)
+	pha
+	txa
+	ldy     #$01
+	adc     (sp),y
+	tax
+	pla
+	sta     L002A
+	stx     L002A+1
+	.dbg	line, "zpframes.c", 51
+	jmp     incsp2
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ thrice (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_thrice: near
+
+	.dbg	func, "thrice", "00", static, "_thrice"
+	.dbg	sym, "a", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "zpframes.c", 55
+	jsr     pushax
+	.dbg	line, "zpframes.c", 56
+	jsr     ldax0sp
+	jsr     mulax3
+	sta     L002F
+	stx     L002F+1
+	.dbg	line, "zpframes.c", 58
+	jmp     incsp2
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ walk (unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_walk: near
+
+	.dbg	func, "walk", "00", static, "_walk"
+	.dbg	sym, "n", "00", auto, 0
+	.dbg	sym, "i", "00", register, "regbank", 4
+	.dbg	sym, "k", "00", register, "regbank", 3
+
+.segment	"CODE"
+
+	.dbg	line, "zpframes.c", 62
+	jsr     pushax
+	.dbg	line, "zpframes.c", 63
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	.dbg	line, "zpframes.c", 64
+	lda     regbank+3
+	jsr     pusha
+	.dbg	line, "zpframes.c", 65
+	stz     L0034
+	stz     L0034+1
+	stz     L0034+2
+	stz     L0034+3
+	.dbg	line, "zpframes.c", 67
+	stz     regbank+4
+	stz     regbank+4+1
+	bra     L0036
+	.dbg	line, "zpframes.c", 68
+L0039:	lda     regbank+4
+	sta     regbank+3
+	.dbg	line, "zpframes.c", 69
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	lda     regbank+3
+	jsr     _mix
+	ldy     #<(L0034)
+	sty     ptr1
+	ldy     #>(L0034)
+	jsr     laddeq
+	.dbg	line, "zpframes.c", 70
+	lda     regbank+4
+	cmp     regbank+3
+	beq     L0045
+	.dbg	line, "zpframes.c", 71
+	lda     #<(L0048)
+	ldx     #>(L0048)
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "zpframes.c", 72
+	inc     _failures
+	.dbg	line, "zpframes.c", 67
+L0045:	inc     regbank+4
+	bne     L0036
+	inc     regbank+4+1
+L0036:	lda     regbank+4
+	ldy     #$03
+	cmp     (sp),y
+	lda     regbank+4+1
+	iny
+	sbc     (sp),y
+	bcc     L0039
+	.dbg	line, "zpframes.c", 75
+	lda     L0034+3
+	sta     sreg+1
+	lda     L0034+2
+	sta     sreg
+	ldx     L0034+1
+	lda     L0034
+	.dbg	line, "zpframes.c", 76
+	pha
+	ldy     #$00
+L004D:	lda     (sp),y
+	sta     regbank+3,y
+	iny
+	cpy     #$03
+	bne     L004D
+	pla
+	jmp     incsp5
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned long __near__ refmix (unsigned int, unsigned char)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_refmix: near
+
+	.dbg	func, "refmix", "00", static, "_refmix"
+	.dbg	sym, "a", "00", auto, 1
+	.dbg	sym, "b", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "zpframes.c", 79
+	jsr     pusha
+	.dbg	line, "zpframes.c", 80
+	ldy     #$02
+	jsr     ldaxysp
+	eor     #$5A
+	pha
+	txa
+	eor     #$5A
+	tax
+	pla
+	jsr     axulong
+	jsr     pusheax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	ina
+	jsr     axulong
+	jsr     tosumuleax
+	sta     L004F
+	stx     L004F+1
+	ldy     sreg
+	sty     L004F+2
+	ldy     sreg+1
+	sty     L004F+3
+	.dbg	line, "zpframes.c", 81
+	lda     L004F+3
+	sta     sreg+1
+	lda     L004F+2
+	sta     sreg
+	ldx     L004F+1
+	lda     L004F
+	jsr     pusheax
+	lda     L004F+3
+	sta     sreg+1
+	lda     L004F+2
+	sta     sreg
+	ldx     L004F+1
+	lda     L004F
+	jsr     shreax3
+	jsr     axulong
+	jsr     tosaddeax
+	jsr     pusheax
+	ldy     #$04
+	ldx     #$00
+	lda     (sp),y
+	ina
+	jsr     axulong
+	jsr     tosaddeax
+	.dbg	line, "zpframes.c", 82
+	jmp     incsp3
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; unsigned int __near__ call (__near__ __near__ function returning unsigned int *, unsigned int)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_call: near
+
+	.dbg	func, "call", "00", extern, "_call"
+	.dbg	sym, "f", "00", auto, 2
+	.dbg	sym, "a", "00", auto, 0
+
+.segment	"CODE"
+
+	.dbg	line, "zpframes.c", 85
+	jsr     pushax
+	.dbg	line, "zpframes.c", 86
+	ldy     #$05
+	jsr     pushwysp
+	ldy     #$03
+	jsr     ldaxysp
+	pha
+	lda     (sp)
+	sta     jmpvec+1
+	ldy     #$01
+	lda     (sp),y
+	sta     jmpvec+2
+	pla
+	jsr     jmpvec
+	jsr     incsp2
+	.dbg	line, "zpframes.c", 87
+	jmp     incsp4
+	.dbg	line
+
+.endproc
+
+; ---------------------------------------------------------------
+; int __near__ main (void)
+; ---------------------------------------------------------------
+
+.segment	"CODE"
+
+.proc	_main: near
+
+	.dbg	func, "main", "00", extern, "_main"
+	.dbg	sym, "j", "00", register, "regbank", 4
+
+.segment	"CODE"
+
+	.dbg	line, "zpframes.c", 91
+	lda     regbank+4
+	ldx     regbank+5
+	jsr     pushax
+	.dbg	line, "zpframes.c", 92
+	stz     L005C
+	stz     L005C+1
+	stz     L005C+2
+	stz     L005C+3
+	.dbg	line, "zpframes.c", 94
+	stz     regbank+4
+	stz     regbank+4+1
+	jmp     L005E
+	.dbg	line, "zpframes.c", 95
+L0061:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	lda     regbank+4
+	jsr     _refmix
+	ldy     #<(L005C)
+	sty     ptr1
+	ldy     #>(L005C)
+	jsr     laddeq
+	.dbg	line, "zpframes.c", 96
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     _twice
+	jsr     pushax
+	lda     #<(_twice)
+	ldx     #>(_twice)
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     _call
+	jsr     tosicmp
+	bne     L006D
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     _twice
+	sta     ptr1
+	stx     ptr1+1
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     shlax1
+	cpx     ptr1+1
+	bne     L006D
+	cmp     ptr1
+	beq     L006C
+	.dbg	line, "zpframes.c", 97
+L006D:	lda     #<(L0074)
+	ldx     #>(L0074)
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     _twice
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "zpframes.c", 98
+	inc     _failures
+	.dbg	line, "zpframes.c", 100
+L006C:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     _count
+	jsr     pusheax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     axulong
+	ldy     sreg
+	sty     sreg+1
+	stx     sreg
+	tax
+	lda     #$00
+	jsr     pusheax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     axulong
+	jsr     tosaddeax
+	jsr     pusheax
+	lda     regbank+4
+	ora     regbank+4+1
+	beq     L007F
+	lda     regbank+4
+L007F:	ldx     #$00
+	jsr     axulong
+	jsr     tosaddeax
+	jsr     tosneeax
+	beq     L007A
+	.dbg	line, "zpframes.c", 101
+	lda     #<(L0084)
+	ldx     #>(L0084)
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     _count
+	jsr     pusheax
+	ldy     #$08
+	jsr     _printf
+	.dbg	line, "zpframes.c", 102
+	inc     _failures
+	.dbg	line, "zpframes.c", 104
+L007A:	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     _thrice
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     mulax3
+	jsr     tosicmp
+	beq     L008A
+	.dbg	line, "zpframes.c", 105
+	lda     #<(L008E)
+	ldx     #>(L008E)
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     _thrice
+	jsr     pushax
+	ldy     #$06
+	jsr     _printf
+	.dbg	line, "zpframes.c", 106
+	inc     _failures
+	.dbg	line, "zpframes.c", 94
+L008A:	inc     regbank+4
+	bne     L005E
+	inc     regbank+4+1
+L005E:	lda     regbank+4+1
+	cmp     #$00
+	bne     L0065
+	lda     regbank+4
+	cmp     #$C8
+L0065:	jcc     L0061
+	.dbg	line, "zpframes.c", 109
+	ldx     #$00
+	lda     #$C8
+	jsr     _walk
+	jsr     pusheax
+	lda     L005C+3
+	sta     sreg+1
+	lda     L005C+2
+	sta     sreg
+	ldx     L005C+1
+	lda     L005C
+	jsr     tosneeax
+	beq     L0094
+	.dbg	line, "zpframes.c", 110
+	lda     #<(L0098)
+	ldx     #>(L0098)
+	jsr     pushax
+	ldx     #$00
+	lda     #$C8
+	jsr     _walk
+	jsr     pusheax
+	lda     L005C+3
+	sta     sreg+1
+	lda     L005C+2
+	sta     sreg
+	ldx     L005C+1
+	lda     L005C
+	jsr     pusheax
+	ldy     #$0A
+	jsr     _printf
+	.dbg	line, "zpframes.c", 111
+	inc     _failures
+	.dbg	line, "zpframes.c", 113
+L0094:	lda     regbank+4+1
+	bne     L00B1
+	lda     regbank+4
+	cmp     #$C8
+	beq     L009E
+	.dbg	line, "zpframes.c", 114
+L00B1:	lda     #<(L00A2)
+	ldx     #>(L00A2)
+	jsr     pushax
+	lda     regbank+4
+	ldx     regbank+4+1
+	jsr     pushax
+	ldy     #$04
+	jsr     _printf
+	.dbg	line, "zpframes.c", 115
+	inc     _failures
+	.dbg	line, "zpframes.c", 118
+L009E:	lda     _failures
+	beq     L00A7
+	ldx     #$00
+	lda     #$01
+	bra     L005B
+L00A7:	tax
+	.dbg	line, "zpframes.c", 119
+L005B:	pha
+	lda     (sp)
+	sta     regbank+4
+	ldy     #$01
+	lda     (sp),y
+	sta     regbank+5
+	pla
+	jmp     incsp2
+	.dbg	line
+
+.endproc
+